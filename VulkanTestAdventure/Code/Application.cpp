@@ -15,6 +15,10 @@ void vk_test::Application::Release() {
     // Clean pending
     resetFreeQueue(0);
 
+    if (!m_ProfilerTraceFile.empty()) {
+        m_GpuProfiler.writeChromeTrace(m_ProfilerTraceFile);
+    }
+
     m_Swapchain.Release();
 
     // Frame info
@@ -22,6 +26,9 @@ void vk_test::Application::Release() {
         vkFreeCommandBuffers(m_Device, m_FrameData[i].command_pool, 1, &m_FrameData[i].command_buffer);
         vkDestroyCommandPool(m_Device, m_FrameData[i].command_pool, nullptr);
     }
+    m_ParallelRecorder.deinit();
+    m_FramePacer.deinit();
+    m_GpuProfiler.deinit();
     vkDestroySemaphore(m_Device, m_FrameTimelineSemaphore, nullptr);
 
     vkDestroyCommandPool(m_Device, m_TransientCommandPool, nullptr);
@@ -36,6 +43,11 @@ void vk_test::Application::Initialize(ApplicationCreateInfo& info) {
     m_PhysicalDevice = info.physical_device;
     m_Queues         = info.queues;
     m_MaxTexturePool = info.texture_pool_size;
+    m_Vsync          = info.vsync;
+    m_Headless       = info.headless;
+
+    m_HeadlessFrameCount = info.headless_frame_count;
+    m_BenchmarkSettings  = info.benchmark;
 
     // Set the default size and position of the window
     testAndSetWindowSizeAndPos({ info.window_size.x, info.window_size.y });
@@ -46,25 +58,39 @@ void vk_test::Application::Initialize(ApplicationCreateInfo& info) {
     // Create a descriptor pool for creating descriptor set in the application
     createDescriptorPool();
 
-    // VK_ERROR_EXTENSION_NOT_PRESENT
-    const VkResult check_result = glfwCreateWindowSurface(m_Instance, m_Window.getGLFWWindow(), nullptr, &m_Surface);
-
-    // Create the swapchain
-    Swapchain::InitInfo swapchain_init{
-        .physical_device          = m_PhysicalDevice,
-        .device                   = m_Device,
-        .queue                    = m_Queues[0],
-        .surface                  = m_Surface,
-        .command_pool             = m_TransientCommandPool,
-        .preferred_vsync_off_mode = info.preferred_vsync_off_mode,
-        .preferred_vsync_on_mode  = info.preferred_vsync_on_mode,
-    };
+    uint32_t num_frames = HEADLESS_FRAMES_IN_FLIGHT;
+    if (m_Headless) {
+        // The elements render to their own images, the window is not shown
+        glfwHideWindow(m_Window.getGLFWWindow());
+    }
+    else {
+        // VK_ERROR_EXTENSION_NOT_PRESENT
+        const VkResult check_result = glfwCreateWindowSurface(m_Instance, m_Window.getGLFWWindow(), nullptr, &m_Surface);
+
+        // Create the swapchain
+        Swapchain::InitInfo swapchain_init{
+            .physical_device          = m_PhysicalDevice,
+            .device                   = m_Device,
+            .queue                    = m_Queues[0],
+            .surface                  = m_Surface,
+            .command_pool             = m_TransientCommandPool,
+            .preferred_vsync_off_mode = info.preferred_vsync_off_mode,
+            .preferred_vsync_on_mode  = info.preferred_vsync_on_mode,
+        };
 
-    m_Swapchain.Initialize(swapchain_init);
-    m_Swapchain.InitializeResources(m_WindowExtent, IS_VSYN_WANTED); // Update the window size to the actual size of the surface
+        m_Swapchain.Initialize(swapchain_init);
+        m_Swapchain.InitializeResources(m_WindowExtent, m_Vsync); // Update the window size to the actual size of the surface
+        num_frames = m_Swapchain.getMaxFramesInFlight();
+    }
 
     // Create what is needed to submit the scene for each frame in-flight
-    createFrameSubmission(m_Swapchain.getMaxFramesInFlight());
+    createFrameSubmission(num_frames);
+    m_FramePacer.init(m_Device, m_FrameTimelineSemaphore, { .low_latency = info.low_latency });
+    m_GpuProfiler.init(m_Device, m_PhysicalDevice, m_Queues[0].family_index, getFrameCycleSize(), GpuProfiler::DEFAULT_MAX_SECTIONS, info.profiler_statistics);
+
+    // The CPU scopes go in the same trace
+    m_ProfilerTraceFile = info.profiler_trace_file;
+    ScopedTimer::setTraceEnabled(!m_ProfilerTraceFile.empty());
 
     // Set up the resource free queue
     resetFreeQueue(getFrameCycleSize());
@@ -75,19 +101,17 @@ void vk_test::Application::Loop() {
     // Re-load ImGui settings from disk, as there might be application elements with settings to restore.
     //ImGui::LoadIniSettingsFromDisk(m_iniFilename.c_str());
 
-    //// Handle headless mode
-    //if (false) {
-    //    headlessRun();
-    //    return;
-    //}
+    // Handle headless mode
+    if (m_Headless) {
+        headlessRun();
+        return;
+    }
 
     // Main rendering loop
     while (!glfwWindowShouldClose(m_Window.getGLFWWindow())) {
         // Window System Events.
         // We add a delay before polling to reduce latency.
-        //if (IS_VSYN_WANTED) {
-        //m_FramePacer.pace();
-        //}
+        m_FramePacer.pace();
         glfwPollEvents();
 
         // Skip rendering when minimized
@@ -166,6 +190,12 @@ void vk_test::Application::Loop() {
     }
 }
 
+void vk_test::Application::setPresentMode(VkPresentModeKHR present_mode) {
+    m_Vsync = present_mode != VK_PRESENT_MODE_IMMEDIATE_KHR;
+    m_Swapchain.setPreferredPresentMode(present_mode, m_Vsync);
+    m_Swapchain.requestRebuild();
+}
+
 void vk_test::Application::addElement(const std::shared_ptr<IAppElement>& layer) {
     m_Elements.emplace_back(layer);
     layer->onAttach(this);
@@ -177,8 +207,21 @@ VkCommandBuffer vk_test::Application::createTempCmdBuffer() const {
     return command;
 }
 
-void vk_test::Application::submitAndWaitTempCmdBuffer(VkCommandBuffer command) {
-    endSingleTimeCommands(command, m_Device, m_TransientCommandPool, m_Queues[0].queue);
+void vk_test::Application::submitAndWaitTempCmdBuffer(VkCommandBuffer command, std::span<const VkSemaphoreSubmitInfo> wait_semaphores) {
+    endSingleTimeCommands(command, m_Device, m_TransientCommandPool, m_Queues[0].queue, wait_semaphores);
+}
+
+//-----------------------------------------------------------------------
+// The function is stored with the current frame and called when this frame
+// slot comes around again, after waitForFrameCompletion(). By then every frame
+// recorded before the call has finished on the GPU.
+//
+void vk_test::Application::submitResourceFree(std::function<void()>&& func) {
+    if (m_ResourceFreeQueue.empty()) {
+        func(); // No frame in flight yet
+        return;
+    }
+    m_ResourceFreeQueue[m_FrameRingCurrent].push_back(std::move(func));
 }
 
 //-----------------------------------------------------------------------
@@ -241,6 +284,9 @@ void vk_test::Application::createFrameSubmission(uint32_t num_frames) {
         };
         vkAllocateCommandBuffers(m_Device, &command_buffer_allocate_info, &m_FrameData[i].command_buffer);
     }
+
+    // Same for the secondary command buffers, with one pool per thread on top
+    m_ParallelRecorder.init(m_Device, m_PhysicalDevice, m_Queues[0].family_index, num_frames);
 }
 
 void vk_test::Application::resetFreeQueue(uint32_t size) {
@@ -349,8 +395,10 @@ bool vk_test::Application::isWindowPosValid(const glm::ivec2& window_position) {
 
 //-----------------------------------------------------------------------
 // This is the headless version of the run loop.
-// It will render the scene for the number of frames specified in the headlessFrameCount.
+// It will render the warmup frames of the benchmark, then the number of frames specified in the headlessFrameCount.
 // It will call onUIRender() and onRender() for each element.
+// Nothing depends on the clock: no frame pacing, and the camera path of the benchmark is set without animation
+// (see ElementCamera), so the same frames are rendered on every run.
 //
 void vk_test::Application::headlessRun() {
     //ScopedTimer st(__FUNCTION__);
@@ -383,19 +431,30 @@ void vk_test::Application::headlessRun() {
         //ImGui::EndFrame();
     }
 
+    VkPhysicalDeviceProperties properties{};
+    vkGetPhysicalDeviceProperties(m_PhysicalDevice, &properties);
+    m_Benchmark.begin(m_BenchmarkSettings, m_HeadlessFrameCount, m_ViewportExtent, properties.deviceName);
+
+    // The GPU times come back when the frame slot is reused, the frames are numbered by the profiler in the same order
+    m_GpuProfiler.setFrameCallback([this](uint64_t frame_number, double milliseconds) { m_Benchmark.addGpuFrameTime(frame_number, milliseconds); });
+
     // Rendering n-times the scene
-    for (uint32_t frameID = 0; frameID < 1; frameID++) {
+    for (uint32_t frameID = 0; frameID < m_Benchmark.getFrameCount(); frameID++) {
         //ImGui_ImplVulkan_NewFrame();
         //ImGui::NewFrame(); // Even if isn't directly used, helps advancing time if query
 
         waitForFrameCompletion();
+        m_Benchmark.beginFrame(frameID);
+        PerformanceTimer frame_timer; // The wait above is not CPU work of the frame
 
+        freeResourcesQueue();
         prepareFrameToSignal(getFrameCycleSize());
 
         VkCommandBuffer cmd = beginCommandRecording(); // Start the command buffer
         drawFrame(cmd);                                // Call onUIRender() and onRender() for each element
         endFrame(cmd, getFrameCycleSize());            // End the frame and submit it
-        advanceFrame(getFrameCycleSize());             // Advance to the next frame in the ring buffer
+        m_Benchmark.endFrame(frame_timer.getMilliseconds());
+        advanceFrame(getFrameCycleSize()); // Advance to the next frame in the ring buffer
 
         //ImGui::EndFrame();
     }
@@ -403,11 +462,38 @@ void vk_test::Application::headlessRun() {
 
     // At this point, everything has been rendered. Let it finish.
     vkDeviceWaitIdle(m_Device);
+    m_GpuProfiler.readbackAll();
+    m_GpuProfiler.setFrameCallback(nullptr);
+    m_Benchmark.end();
 
     // Call back the application, such that it can do something with the rendered image
     for (std::shared_ptr<IAppElement>& e : m_Elements) {
         e->onLastHeadlessFrame();
     }
+
+    const Benchmark::Percentiles cpu = m_Benchmark.getCpuPercentiles();
+    const Benchmark::Percentiles gpu = m_Benchmark.getGpuPercentiles();
+    VK_TEST_SAY("Benchmark : " << m_Benchmark.getFrameCount() << " frames, CPU " << cpu.p50_ms << " ms (p99 " << cpu.p99_ms << "), GPU " << gpu.p50_ms << " ms (p99 " << gpu.p99_ms << ")");
+
+    // Pipeline statistics of the last frame, only the outermost sections have some (ApplicationCreateInfo::profiler_statistics)
+    for (const GpuProfiler::SectionStats& stats : m_GpuProfiler.getSectionStats()) {
+        if (stats.statistics.empty()) {
+            continue;
+        }
+        std::string line        = stats.name + " :";
+        size_t      value_index = 0;
+        for (uint32_t bit = 0; bit < 32; bit++) {
+            const auto statistic = VkQueryPipelineStatisticFlagBits(1U << bit);
+            if ((m_GpuProfiler.getStatisticFlags() & statistic) != 0 && value_index < stats.statistics.size()) {
+                const char* name = GpuProfiler::getStatisticName(statistic);
+                line += " " + std::string(name != nullptr ? name : "?") + " " + std::to_string(stats.statistics[value_index++]);
+            }
+        }
+        VK_TEST_SAY(line.c_str());
+    }
+    if (!m_BenchmarkSettings.report_file.empty()) {
+        m_Benchmark.writeReport(m_BenchmarkSettings.report_file);
+    }
 }
 
 //-----------------------------------------------------------------------
@@ -442,7 +528,7 @@ void vk_test::Application::onViewportSizeChange(VkExtent2D extent) {
 ///
 bool vk_test::Application::prepareFrameResources() {
     if (m_Swapchain.needRebuilding()) {
-        m_Swapchain.ReinitializeResources(m_WindowExtent, IS_VSYN_WANTED);
+        m_Swapchain.ReinitializeResources(m_WindowExtent, m_Vsync);
     }
 
     waitForFrameCompletion(); // Wait until GPU has finished processing
@@ -483,6 +569,7 @@ VkCommandBuffer vk_test::Application::beginCommandRecording() {
 
     // Reset the command pool to reuse the command buffer for recording new rendering commands for the current frame.
     vkResetCommandPool(m_Device, frame.command_pool, 0);
+    m_ParallelRecorder.beginFrame(m_FrameRingCurrent);
     VkCommandBuffer command = frame.command_buffer;
 
     // Begin the command buffer recording for the frame
@@ -490,6 +577,9 @@ VkCommandBuffer vk_test::Application::beginCommandRecording() {
                                                .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT };
     vkBeginCommandBuffer(command, &begin_info);
 
+    // Reads back the timestamps of the previous use of this frame, completed
+    m_GpuProfiler.beginFrame(command, m_FrameRingCurrent);
+
     return command;
 }
 
@@ -583,6 +673,7 @@ void vk_test::Application::addSwapchainSemaphores() {
 
 void vk_test::Application::endFrame(VkCommandBuffer command, uint32_t frame_in_flights) {
     // Ends recording of commands for the frame
+    m_GpuProfiler.cmdEndFrame(command);
     vkEndCommandBuffer(command);
 
     // Get the frame data for the current frame in the ring buffer
@@ -614,6 +705,7 @@ void vk_test::Application::endFrame(VkCommandBuffer command, uint32_t frame_in_f
 
     // Submit the command buffer to the GPU and signal when it's done
     vkQueueSubmit2(m_Queues[0].queue, 1, &submitInfo, nullptr);
+    m_FramePacer.frameSubmitted(frame.frame_number);
 }
 
 void vk_test::Application::presentFrame() {
@@ -3,9 +3,15 @@
 #include "resources.hpp"
 #include "Context.hpp"
 #include "Swapchain.hpp"
+#include "semaphore.hpp"
+#include "parallel_recording.hpp"
+#include "frame_pacer.hpp"
+#include "gpu_profiler.hpp"
+#include "benchmark.hpp"
 
 namespace vk_test {
-    constexpr inline static bool IS_VSYN_WANTED = true;
+    constexpr inline static bool     IS_VSYN_WANTED            = true;
+    constexpr inline static uint32_t HEADLESS_FRAMES_IN_FLIGHT = 2; // No swapchain to follow in headless mode
 
     // Forward declarations
     class Application;
@@ -22,7 +28,7 @@ namespace vk_test {
         virtual void onPreRender() {}                                             // called post onUIRender and prior onRender (looped over all elements)
         virtual void onRender(VkCommandBuffer command) {}                         // For anything to render within a frame
         virtual void onFileDrop(const std::filesystem::path& filename) {}         // For when a file is dragged on top of the window
-        virtual void onLastHeadlessFrame() {};                                    // Called at the end of the last frame in headless mode
+        virtual void onLastHeadlessFrame() {};                                    // Called at the end of the last frame in headless mode, before the benchmark report
 
         virtual ~IAppElement() = default;
     };
@@ -43,13 +49,21 @@ namespace vk_test {
         bool       vsync{ true };       // Enable V-Sync by default
 
         // Headless
-        bool     headless{ false };         // Run without a window
-        uint32_t headless_frame_count{ 1 }; // Frames to render in headless mode
+        bool                headless{ false };         // Run without a window, Loop() renders the frames below and returns
+        uint32_t            headless_frame_count{ 1 }; // Frames to render in headless mode, after the warmup ones
+        Benchmark::Settings benchmark;                 // Warmup frames, camera path and report of the headless run
 
         // Swapchain
         // VK_PRESENT_MODE_MAX_ENUM_KHR means no preference
         VkPresentModeKHR preferred_vsync_off_mode = VK_PRESENT_MODE_MAX_ENUM_KHR;
         VkPresentModeKHR preferred_vsync_on_mode  = VK_PRESENT_MODE_MAX_ENUM_KHR;
+
+        // Frame pacing
+        bool low_latency{ true }; // Sample the input just in time, see FramePacer
+
+        // Profiling
+        VkQueryPipelineStatisticFlags profiler_statistics{ 0 }; // Pipeline statistics of the outermost GPU sections
+        std::filesystem::path         profiler_trace_file;      // When set, the CPU and GPU trace is written there by Release()
     };
 
     class Application {
@@ -69,13 +83,41 @@ namespace vk_test {
 
         // Utility to create a temporary command buffer
         VkCommandBuffer createTempCmdBuffer() const;
-        void            submitAndWaitTempCmdBuffer(VkCommandBuffer command);
+        void            submitAndWaitTempCmdBuffer(VkCommandBuffer command, std::span<const VkSemaphoreSubmitInfo> wait_semaphores = {});
+
+        // Extra semaphores of the frame being recorded, to call from onRender (ex. waiting on another queue)
+        void addWaitSemaphore(const VkSemaphoreSubmitInfo& wait) { m_WaitSemaphores.push_back(wait); }
+        void addSignalSemaphore(const VkSemaphoreSubmitInfo& signal) { m_SignalSemaphores.push_back(signal); }
+
+        // Signaled when the frame being recorded has completed on the GPU (ex. to keep staging space)
+        SemaphoreState getFrameSemaphoreState() const { return SemaphoreState::makeFixed(m_FrameTimelineSemaphore, m_FrameData[m_FrameRingCurrent].frame_number); }
+
+        // Queue a function to be called once the frames currently in flight have completed on the GPU
+        void submitResourceFree(std::function<void()>&& func);
+
+        // Records secondary command buffers of the frame on several threads, to call from onRender
+        ParallelCommandRecorder& getParallelRecorder() { return m_ParallelRecorder; }
+
+        // Latency of the frames, and the low latency settings
+        FramePacer& getFramePacer() { return m_FramePacer; }
+
+        // GPU time of the frame, and of the sections recorded from onRender
+        GpuProfiler& getGpuProfiler() { return m_GpuProfiler; }
+
+        // Frame times of the headless run, elements can add counters to its report
+        Benchmark& getBenchmark() { return m_Benchmark; }
+
+        // The swapchain is rebuilt with this mode, or the closest supported one, before the next frame.
+        // IMMEDIATE turns vSync off, MAILBOX, FIFO and FIFO_RELAXED keep it on.
+        void             setPresentMode(VkPresentModeKHR present_mode);
+        VkPresentModeKHR getPresentMode() const { return m_Swapchain.getPresentMode(); }
 
         // Getters
         VkInstance        getInstance() const { return m_Instance; }
         VkPhysicalDevice  getPhysicalDevice() const { return m_PhysicalDevice; }
         VkDevice          getDevice() const { return m_Device; }
         const QueueInfo&  getQueue(uint32_t index) const { return m_Queues[index]; }
+        uint32_t          getQueueCount() const { return uint32_t(m_Queues.size()); }
         VkCommandPool     getCommandPool() const { return m_TransientCommandPool; }
         VkDescriptorPool  getTextureDescriptorPool() const { return m_DescriptorPool; }
         const VkExtent2D& getViewportSize() const { return m_ViewportExtent; }
@@ -128,9 +170,18 @@ namespace vk_test {
             VkCommandBuffer command_buffer{}; // Command buffer containing the frame's rendering commands
             uint64_t        frame_number{};   // Timeline value for synchronization (increases each frame)
         };
-        std::vector<FrameData> m_FrameData;                // Collection of per-frame resources to support multiple frames in flight
-        VkSemaphore            m_FrameTimelineSemaphore{}; // Timeline semaphore used to synchronize CPU submission with GPU completion
-        uint32_t               m_FrameRingCurrent{ 0 };    // Current frame index in the ring buffer (cycles through available frames) : static for resource free queue
+        std::vector<FrameData>  m_FrameData;                // Collection of per-frame resources to support multiple frames in flight
+        VkSemaphore             m_FrameTimelineSemaphore{}; // Timeline semaphore used to synchronize CPU submission with GPU completion
+        uint32_t                m_FrameRingCurrent{ 0 };    // Current frame index in the ring buffer (cycles through available frames) : static for resource free queue
+        ParallelCommandRecorder m_ParallelRecorder;         // Per-frame, per-thread command pools for secondary command buffers
+        FramePacer              m_FramePacer;               // Delays the input sampling from the frame completions
+        GpuProfiler             m_GpuProfiler;              // Timestamp queries of the frames in flight
+        Benchmark               m_Benchmark;                // Measures the headless run
+        std::filesystem::path   m_ProfilerTraceFile;        // Chrome trace written by Release(), if any
+        bool                    m_Vsync{ IS_VSYN_WANTED };  // vSync state given to the swapchain
+        bool                    m_Headless{ false };        // No surface nor swapchain, see headlessRun()
+        uint32_t                m_HeadlessFrameCount{ 1 };  // Measured frames of headlessRun()
+        Benchmark::Settings     m_BenchmarkSettings;        // Given to m_Benchmark by headlessRun()
 
         // Fine control over the frame submission
         std::vector<VkSemaphoreSubmitInfo>     m_WaitSemaphores;   // Possible extra frame wait semaphores
@@ -25,7 +25,11 @@ namespace vk_test {
         return VK_SUCCESS;
     }
 
-    VkResult endSingleTimeCommands(VkCommandBuffer command, VkDevice device, VkCommandPool command_pool, VkQueue queue) {
+    VkResult endSingleTimeCommands(VkCommandBuffer                        command,
+                                   VkDevice                               device,
+                                   VkCommandPool                          command_pool,
+                                   VkQueue                                queue,
+                                   std::span<const VkSemaphoreSubmitInfo> wait_semaphores) {
         // Submit and clean up
         vkEndCommandBuffer(command);
 
@@ -35,9 +39,11 @@ namespace vk_test {
         vkCreateFence(device, &fence_info, nullptr, fence.data());
 
         const VkCommandBufferSubmitInfo    cmd_buffer_info{ .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO, .commandBuffer = command };
-        const std::array<VkSubmitInfo2, 1> submit_info{
-            { { .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2, .commandBufferInfoCount = 1, .pCommandBufferInfos = &cmd_buffer_info } }
-        };
+        const std::array<VkSubmitInfo2, 1> submit_info{ { { .sType                  = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
+                                                            .waitSemaphoreInfoCount = uint32_t(wait_semaphores.size()),
+                                                            .pWaitSemaphoreInfos    = wait_semaphores.data(),
+                                                            .commandBufferInfoCount = 1,
+                                                            .pCommandBufferInfos    = &cmd_buffer_info } } };
         vkQueueSubmit2(queue, uint32_t(submit_info.size()), submit_info.data(), fence[0]);
         vkWaitForFences(device, uint32_t(fence.size()), fence.data(), VK_TRUE, UINT64_MAX);
 
@@ -17,5 +17,10 @@ namespace vk_test {
     }
 
     // Ends command buffer, submits on the provided queue, then waits for completion, and frees the command buffer within the provided pool
-    VkResult endSingleTimeCommands(VkCommandBuffer command, VkDevice device, VkCommandPool command_pool, VkQueue queue);
+    // The submit first waits for `wait_semaphores`, if any
+    VkResult endSingleTimeCommands(VkCommandBuffer                        command,
+                                   VkDevice                               device,
+                                   VkCommandPool                          command_pool,
+                                   VkQueue                                queue,
+                                   std::span<const VkSemaphoreSubmitInfo> wait_semaphores = {});
 } // namespace vk_test
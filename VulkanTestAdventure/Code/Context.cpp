@@ -203,6 +203,16 @@ VkResult vk_test::Context::createDevice() {
     // Activate features on request
     if (m_ContextInfo.enable_all_features) {
         vkGetPhysicalDeviceFeatures2(m_PhysicalDevice, &m_DeviceFeatures);
+
+        // The mesh shaders with a shading rate per primitive need VK_KHR_fragment_shading_rate, which may not be enabled
+        const bool has_shading_rate = std::ranges::any_of(m_ContextInfo.device_extensions, [](const ExtensionInfo& ext) {
+            return std::string_view(ext.extension_name) == VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME;
+        });
+        for (auto* feature = reinterpret_cast<VkBaseOutStructure*>(m_DeviceFeatures.pNext); feature != nullptr; feature = feature->pNext) {
+            if (feature->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT && !has_shading_rate) {
+                reinterpret_cast<VkPhysicalDeviceMeshShaderFeaturesEXT*>(feature)->primitiveFragmentShadingRateMeshShader = VK_FALSE;
+            }
+        }
     }
 
     // List of extensions to enable
@@ -240,6 +250,13 @@ bool vk_test::Context::findQueueFamilies() {
     std::vector<VkQueueFamilyProperties> queue_families(queue_family_count);
     vkGetPhysicalDeviceQueueFamilyProperties(m_PhysicalDevice, &queue_family_count, queue_families.data());
 
+    // Graphics and compute queues support transfer operations, without always reporting it
+    for (VkQueueFamilyProperties& family : queue_families) {
+        if ((family.queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) != 0U) {
+            family.queueFlags |= VK_QUEUE_TRANSFER_BIT;
+        }
+    }
+
     std::unordered_map<uint32_t, uint32_t> queue_family_usage;
     for (uint32_t i = 0; i < queue_family_count; ++i) {
         queue_family_usage[i] = 0;
@@ -296,6 +313,17 @@ bool vk_test::Context::findQueueFamilies() {
             }
         }
 
+        if (!found) {
+            for (uint32_t j = 0; j < queue_family_count; ++j) {
+                // All queues of the family are taken, share the last one created (ex. transfer on the graphics queue)
+                if ((queue_families[j].queueFlags & m_DesiredQueues[i]) == m_DesiredQueues[i] && queue_family_usage[j] > 0) {
+                    m_QueueInfos.push_back({ j, queue_family_usage[j] - 1 });
+                    found = true;
+                    break;
+                }
+            }
+        }
+
         if (!found) {
             // If no suitable queue family is found, assert a failure
             VK_TEST_SAY("Failed to find a suitable queue family");
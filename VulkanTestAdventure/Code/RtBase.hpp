@@ -2,13 +2,24 @@
 #include "Application.hpp"
 #include "resource_allocator.hpp"
 #include "staging.hpp"
+#include "upload_scheduler.hpp"
 #include "sampler_pool.hpp"
 #include "gbuffers.hpp"
 #include "slang.hpp"
+#include "shader_hot_reload.hpp"
 #include "camera_manipulator.hpp"
 #include "graphics_pipeline.hpp"
 #include "descriptors.hpp"
+#include "acceleration_structures.hpp"
+#include "gpu_draws.hpp"
+#include "texture_streamer.hpp"
+#include "image_decode_pool.hpp"
+#include "image_readback.hpp"
+#include "image_compare.hpp"
+#include "batch_transform.hpp"
+#include "bindless_textures.hpp"
 #include "../Common/gltf_utils.hpp"
+#include "../Common/gltf_cache.hpp"
 #include "sky.hpp"
 #include "tonemapper.hpp"
 #include "formats.hpp"
@@ -18,8 +29,6 @@
 
 #include "sky_simple.slang.h"
 #include "tonemapper.slang.h"
-#include "rtbasic.slang.h"
-#include "foundation.slang.h"
 
 namespace vk_test {
     //---------------------------------------------------------------------------------------
@@ -36,6 +45,9 @@ namespace vk_test {
             eImgTonemapped
         };
 
+        // Below, recording the draws on one thread is faster than starting the others
+        static constexpr size_t PARALLEL_DRAW_MIN_INSTANCES = 4096;
+
     public:
         RtBasic()           = default;
         ~RtBasic() override = default;
@@ -61,12 +73,24 @@ namespace vk_test {
             // The VMA allocator is used for all allocations, the staging uploader will use it for staging buffers and images
             m_StagingUploader.init(&m_Allocator, true);
 
+            // Copies of the rendered images, for the golden image check of a headless run
+            m_ImageReadback.init(&m_Allocator);
+
+            // Uploads go to the transfer queue when there is one, and are acquired by the next graphics submit
+            const QueueInfo& transfer_queue = m_App->getQueue(m_App->getQueueCount() > 1 ? 1 : 0);
+            m_UploadScheduler.init(app->getDevice(), transfer_queue, m_App->getQueue(0).family_index);
+
+            // Images are decoded on worker threads, straight into the staging space
+            m_ImageDecodePool.init();
+
             // Setting up the Slang compiler for hot reload shader
             m_SlangCompiler.addSearchPaths({ PATH.getShadersPath() });
             m_SlangCompiler.defaultTarget();
             m_SlangCompiler.defaultOptions();
             m_SlangCompiler.addOption({ slang::CompilerOptionName::DebugInformation,
                                         { slang::CompilerOptionValueKind::Int, SLANG_DEBUG_INFO_LEVEL_MAXIMAL } });
+            // Unchanged shaders are loaded from disk on the next launches, without invoking Slang
+            m_SlangCompiler.setCacheDirectory(PATH.getExecutablePath() / L"ShaderCache");
 #if defined(AFTERMATH_AVAILABLE)
             // This aftermath callback is used to report the shader hash (Spirv) to the Aftermath library.
             m_slangCompiler.setCompileCallback([&](const std::filesystem::path& sourceFile, const uint32_t* spirvCode, size_t spirvSize) {
@@ -90,10 +114,17 @@ namespace vk_test {
             };
             m_GBuffers.init(g_buffer_init);
 
+            createGraphicsDescriptorSetLayout(); // Create the bindless texture table, the scene allocates its slots
+
+            // The shaders index the feedback with the texture slot
+            m_TextureStreamer.init(&m_Allocator, &m_StagingUploader, m_App->getFrameCycleSize(), m_TextureTable.getCapacity());
+
             createScene();                       // Create the scene with a teapot and a plane
-            createGraphicsDescriptorSetLayout(); // Create the descriptor set layout for the graphics pipeline
             createGraphicsPipelineLayout();      // Create the graphics pipeline layout
             compileAndCreateGraphicsShaders();   // Compile the graphics shaders and create the shader modules
+            createMeshShaderDraws();             // Draw the meshlets with the task and mesh shaders, when the device has them
+            startShaderHotReload();              // Recompile the graphics shaders in the background when they are edited
+            createGpuDraws();                    // Build the raster draws on the GPU
             updateTextures();                    // Update the textures in the descriptor set (if any)
 
             // Initialize the Sky with the pre-compiled shader
@@ -115,6 +146,18 @@ namespace vk_test {
             // Set up ray tracing pipeline infrastructure
             createRaytraceDescriptorLayout(); // Create descriptor layout
             createRayTracingPipeline();       // Create pipeline structure and SBT
+
+            VK_TEST_SAY("Shader cache hits : " << m_SlangCompiler.getCacheHits() << ", misses : " << m_SlangCompiler.getCacheMisses());
+
+            // Reported by the benchmark of a headless run
+            Benchmark& benchmark = m_App->getBenchmark();
+            benchmark.addCounter("uploaded_bytes", [this] { return double(m_StagingUploader.getRingStats().uploaded_bytes); });
+            benchmark.addCounter("device_local_bytes", [this] {
+                VkDeviceSize budget = 0;
+                VkDeviceSize usage  = 0;
+                m_Allocator.getDeviceLocalBudget(budget, usage);
+                return double(usage);
+            });
         }
 
         //-------------------------------------------------------------------------------
@@ -124,14 +167,23 @@ namespace vk_test {
         void onDetach() override {
             vkQueueWaitIdle(m_App->getQueue(0).queue);
 
+            // Stop the watcher and apply what it already built, so no shader object is leaked
+            m_ShaderHotReload.deinit();
+            m_ShaderHotReload.applyPending();
+
             VkDevice device = m_App->getDevice();
 
-            m_DescPack.deinit();
+            m_TextureTable.deinit();
             vkDestroyPipelineLayout(device, m_GraphicPipelineLayout, nullptr);
             vkDestroyShaderEXT(device, m_VertexShader, nullptr);
             vkDestroyShaderEXT(device, m_FragmentShader, nullptr);
+            vkDestroyShaderEXT(device, m_TaskShader, nullptr);
+            vkDestroyShaderEXT(device, m_MeshShader, nullptr);
+            m_Allocator.destroyBuffer(m_MeshletTaskGroupsBuffer);
+            m_GpuDrawBuilder.deinit();
 
             m_Allocator.destroyBuffer(m_SceneResource.b_scene_info);
+            m_Allocator.destroyBuffer(m_NormalMatricesBuffer);
             m_Allocator.destroyBuffer(m_SceneResource.b_meshes);
             m_Allocator.destroyBuffer(m_SceneResource.b_materials);
             m_Allocator.destroyBuffer(m_SceneResource.b_instances);
@@ -143,6 +195,10 @@ namespace vk_test {
             }
 
             m_GBuffers.deinit();
+            m_ImageReadback.deinit();
+            m_ImageDecodePool.deinit();
+            m_TextureStreamer.deinit();
+            m_UploadScheduler.deinit();
             m_StagingUploader.deinit();
             m_SkySimple.deinit();
             m_Tonemapper.deinit();
@@ -153,6 +209,8 @@ namespace vk_test {
                 m_Allocator.destroyAcceleration(blas);
             }
             m_Allocator.destroyAcceleration(m_TlasAccel);
+            m_Allocator.destroyBuffer(m_TlasInstancesBuffer);
+            m_Allocator.destroyBuffer(m_TlasScratchBuffer);
             vkDestroyPipelineLayout(device, m_RtPipelineLayout, nullptr);
             vkDestroyPipeline(device, m_RtPipeline, nullptr);
             m_RtDescPack.deinit();
@@ -221,7 +279,17 @@ namespace vk_test {
         //---------------------------------------------------------------------------------------------------------------
         // When the viewport is resized, the GBuffer must be resized
         // - Called when the Window "viewport is resized
-        void onResize(VkCommandBuffer cmd, const VkExtent2D& size) override { m_GBuffers.update(cmd, size); }
+        void onResize(VkCommandBuffer cmd, const VkExtent2D& size) override {
+            m_GBuffers.update(cmd, size);
+            if (m_UseGpuDraws) {
+                m_GpuDrawBuilder.setHizSize(cmd, size); // The pyramid follows the depth buffer
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------------------------
+        // Frame boundary, before any command referencing the shaders is recorded
+        // - Swaps in the shaders rebuilt by the hot reload thread
+        void onPreRender() override { m_ShaderHotReload.applyPending(); }
 
         //---------------------------------------------------------------------------------------------------------------
         // Rendering the scene
@@ -229,22 +297,79 @@ namespace vk_test {
         // Only the ImGui is rendered to the swapchain image.
         // - Called every frame
         void onRender(VkCommandBuffer cmd) override {
+            // Resources uploaded on the transfer queue since the last submit
+            if (m_UploadScheduler.hasPendingUploads()) {
+                m_App->addWaitSemaphore(m_UploadScheduler.cmdAcquireUploads(cmd));
+            }
+
+            GpuProfiler& profiler = m_App->getGpuProfiler();
+
+            // Readbacks of the previous frames that are completed
+            m_ImageReadback.poll();
+
+            // Stream the texture levels wanted by the previous frames, before the textures are sampled
+            m_StagingUploader.releaseStaging();
+            {
+                GpuProfiler::Scope scope(profiler, cmd, "TextureStreamer");
+                if (m_TextureStreamer.update(cmd, m_App->getFrameCycleIndex(), m_App->getFrameSemaphoreState())) {
+                    updateStreamedTextures(cmd);
+                }
+            }
+
             // Update the scene information buffer, this cannot be done in between dynamic rendering
-            updateSceneBuffer(cmd);
+            {
+                GpuProfiler::Scope scope(profiler, cmd, "SceneUpdate");
+                updateSceneBuffer(cmd);
+                updateTopLevelAS(cmd);
+            }
 
             if (m_UseRayTracing) {
+                GpuProfiler::Scope scope(profiler, cmd, "RayTrace");
                 raytraceScene(cmd);
             }
             else {
+                GpuProfiler::Scope scope(profiler, cmd, "Raster");
                 rasterScene(cmd);
             }
 
             postProcess(cmd);
+
+            // The tonemapped image of the last frame of a headless run is compared to the golden image
+            const Benchmark& benchmark = m_App->getBenchmark();
+            if (benchmark.isLastFrame() && (!m_GoldenImage.golden_file.empty() || !m_GoldenImage.output_file.empty())) {
+                readbackGoldenImage(cmd);
+            }
+        }
+
+        void readbackGoldenImage(VkCommandBuffer cmd) {
+            m_ImageReadback.cmdReadback(cmd,
+                                        m_GBuffers.getColorImage(eImgTonemapped),
+                                        VK_IMAGE_LAYOUT_GENERAL,
+                                        m_GBuffers.getColorFormat(eImgTonemapped),
+                                        m_GBuffers.getSize(),
+                                        m_App->getFrameSemaphoreState(),
+                                        [this](const ImageRgba8& image) {
+                                            Benchmark& benchmark = m_App->getBenchmark();
+                                            if (m_GoldenImage.golden_file.empty()) {
+                                                writeImageRgba8(m_GoldenImage.output_file, image);
+                                                return;
+                                            }
+
+                                            const ImageCompareResult result = checkGoldenImage(image, m_GoldenImage);
+                                            benchmark.addResult("golden_psnr_db", std::isinf(result.psnr_db) ? 1000.0 : result.psnr_db); // JSON has no infinity
+                                            benchmark.addResult("golden_mean_error", result.mean_error);
+                                            benchmark.addResult("golden_max_error", result.max_error);
+                                            benchmark.addResult("golden_different_rate", result.different_rate);
+                                            if (!result.passed) {
+                                                benchmark.addFailure("The image differs from " + utf8FromPath(m_GoldenImage.golden_file));
+                                            }
+                                        });
         }
 
         // Apply post-processing
         void postProcess(VkCommandBuffer cmd) {
             // Default post-processing: tonemapping
+            GpuProfiler::Scope scope(m_App->getGpuProfiler(), cmd, "Tonemapper");
             m_Tonemapper.runCompute(cmd, m_GBuffers.getSize(), m_TonemapperData, m_GBuffers.getDescriptorImageInfo(eImgRendered), m_GBuffers.getDescriptorImageInfo(eImgTonemapped));
 
             // Barrier to make sure the image is ready for been display
@@ -273,56 +398,117 @@ namespace vk_test {
             }*/
         }
 
+        //---------------------------------------------------------------------------------------------------------------
+        // Temporary command buffer of the graphics queue, ordered after the uploads submitted to the transfer queue:
+        // their acquire barriers are recorded first, and the submit waits for them.
+        VkCommandBuffer beginTempCmdBuffer() {
+            VkCommandBuffer cmd = m_App->createTempCmdBuffer();
+            m_TempCmdUploadWait = m_UploadScheduler.cmdAcquireUploads(cmd);
+            return cmd;
+        }
+
+        void submitTempCmdBuffer(VkCommandBuffer cmd) { m_App->submitAndWaitTempCmdBuffer(cmd, std::span(&m_TempCmdUploadWait, 1)); }
+
         //---------------------------------------------------------------------------------------------------------------
         // Create the scene for this sample
-        // - Load a teapot, a plane and an image.
-        // - Create instances for them, assign a material and a transformation
+        // - Load a teapot (or the scene file), a plane and an image.
+        // - The model brings its instances and materials, the plane gets its own material and transformation
         void createScene() {
             SCOPED_TIMER(__FUNCTION__);
 
-            VkCommandBuffer cmd = m_App->createTempCmdBuffer();
+            // Recorded for the transfer queue, the CPU does not wait for it.
+            // The staging space is released after the next temporary command buffer, which waits for the upload.
+            VkCommandBuffer cmd = m_UploadScheduler.beginUpload();
+            m_StagingUploader.beginTransferOnly();
 
             // Load the GLTF resources
+            uint32_t floor_texture_slot     = BindlessTextureTable::NULL_SLOT;
+            uint32_t floor_streamed_texture = ~0U; // Id in m_TextureStreamer, when streamed
+            uint32_t plane_first_mesh   = 0; // The meshes of plane.gltf, after those of the model
             {
-                tinygltf::Model teapot_model =
-                    loadGltfResources(findFile("teapot.gltf", { PATH.getResourcesPath() })); // Load the GLTF resources from the file
-
-                tinygltf::Model plane_model =
-                    loadGltfResources(findFile("plane.gltf", { PATH.getResourcesPath() })); // Load the GLTF resources from the file
-
                 // Textures
                 {
-                    std::filesystem::path image_filename = findFile("tiled_floor.png", { PATH.getResourcesPath() });
-                    Image                 texture        = loadAndCreateImage(cmd, m_StagingUploader, m_App->getDevice(), image_filename); // Load the image from the file and create a texture from it
-                    m_SamplerPool.acquireSampler(texture.descriptor.sampler);
-                    m_Textures.emplace_back(texture); // Store the texture in the vector of textures
+                    // A block compressed KTX2 version of the image is streamed when there is one,
+                    // its levels show up over the next frames
+                    std::filesystem::path image_filename = PATH.getResourcesPath() / "tiled_floor.ktx2";
+                    if (std::filesystem::exists(image_filename)) {
+                        VkSampler sampler{};
+                        m_SamplerPool.acquireSampler(sampler);
+                        floor_texture_slot              = m_TextureTable.allocateSlot(VkDescriptorImageInfo{}); // Set below, before any flush
+                        floor_streamed_texture          = m_TextureStreamer.addTexture(image_filename, sampler, floor_texture_slot);
+                        m_TextureTable.updateSlot(floor_texture_slot, m_TextureStreamer.getDescriptorImageInfo(floor_streamed_texture));
+                    }
+                    else {
+                        image_filename = findFile("tiled_floor.png", { PATH.getResourcesPath() });
+                        Image texture  = m_ImageDecodePool.appendImage(m_StagingUploader, image_filename, true, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, m_UploadScheduler.getUploadSemaphoreState()); // Decoded while the rest of the scene loads
+                        m_SamplerPool.acquireSampler(texture.descriptor.sampler);
+                        floor_texture_slot = m_TextureTable.allocateSlot(texture);
+                        m_Textures.emplace_back(texture); // Store the texture in the vector of textures
+                    }
                 }
 
                 // Upload the GLTF resources to the GPU
+                // The binary cache next to each file is used when up to date, otherwise the file is parsed and the cache rewritten
                 {
-                    importGltfData(m_SceneResource, teapot_model, m_StagingUploader); // Import the GLTF resources
-                    importGltfData(m_SceneResource, plane_model, m_StagingUploader);  // Import the GLTF resources
+                    // The quantized positions are read by the BLAS build as R16G16B16A16_SNORM
+                    VkFormatProperties format_properties{};
+                    vkGetPhysicalDeviceFormatProperties(m_App->getPhysicalDevice(), VK_FORMAT_R16G16B16A16_SNORM, &format_properties);
+                    const bool quantize_vertices = m_QuantizeVertices && (format_properties.bufferFeatures & VK_FORMAT_FEATURE_ACCELERATION_STRUCTURE_VERTEX_BUFFER_BIT_KHR) != 0;
+
+                    const std::filesystem::path model_file = m_SceneFile.empty() ? findFile("teapot.gltf", { PATH.getResourcesPath() }) : m_SceneFile;
+                    const GltfImportSettings import_settings{
+                        .import_instance   = true, // The nodes and materials of the model
+                        .quantize_vertices = quantize_vertices,
+                        .optimize_meshes   = m_OptimizeMeshes,
+                        .build_meshlets    = m_UseMeshShaders, // Only read by the mesh shaders
+                        .build_lods        = m_LodThreshold > 0.0F || m_ShadowRayLod > 0,
+                    };
+                    m_SceneResource.instances.clear();
+                    m_SceneResource.instance_bounds.clear();
+                    m_SceneResource.materials.clear();
+                    importGltfCached(m_SceneResource, model_file, m_StagingUploader, import_settings); // Import the GLTF resources
+
+                    if (m_SceneFile.empty()) {
+                        // The teapot has no material, it gets its own color and is scaled down to sit on the plane
+                        for (shaderio::GltfMetallicRoughness& material : m_SceneResource.materials) {
+                            material = { .baseColorFactor = glm::vec4(0.8F, 1.0F, 0.6F, 1.0F), .metallicFactor = 0.5F, .roughnessFactor = 0.5F };
+                        }
+                        for (shaderio::GltfInstance& instance : m_SceneResource.instances) {
+                            instance.transform = glm::scale(glm::mat4(1), glm::vec3(0.5F)) * instance.transform;
+                        }
+                        m_SceneResource.instance_bounds.clear(); // Recomputed below with the new transforms
+                    }
+
+                    // The plane is placed below the model, with its own instances and material
+                    plane_first_mesh = uint32_t(m_SceneResource.meshes.size());
+                    GltfImportSettings plane_settings = import_settings;
+                    plane_settings.import_instance    = false;
+                    importGltfCached(m_SceneResource, findFile("plane.gltf", { PATH.getResourcesPath() }), m_StagingUploader, plane_settings);
                 }
             }
 
-            m_SceneResource.materials = {
-                // Teapot material
-                { .baseColorFactor = glm::vec4(0.8F, 1.0F, 0.6F, 1.0F), .metallicFactor = 0.5F, .roughnessFactor = 0.5F },
-                // Plane material with texture
-                { .baseColorFactor = glm::vec4(1.0F, 1.0F, 1.0F, 1.0F), .metallicFactor = 0.1F, .roughnessFactor = 0.8F, .baseColorTextureIndex = 1 }
-            };
-
-            m_SceneResource.instances = {
-                // Teapot
-                { .transform     = glm::translate(glm::mat4(1), glm::vec3(0, 0, 0)) * glm::scale(glm::mat4(1), glm::vec3(0.5F)),
-                  .materialIndex = 0,
-                  .meshIndex     = 0 },
-                // Plane
-                { .transform = glm::scale(glm::translate(glm::mat4(1), glm::vec3(0, -0.9F, 0)), glm::vec3(2.F)), .materialIndex = 1, .meshIndex = 1 },
-            };
+            // Plane material with texture
+            const uint32_t plane_material_index = uint32_t(m_SceneResource.materials.size());
+            m_SceneResource.materials.push_back({ .baseColorFactor = glm::vec4(1.0F, 1.0F, 1.0F, 1.0F), .metallicFactor = 0.1F, .roughnessFactor = 0.8F, .baseColorTextureIndex = int(floor_texture_slot) });
+            if (floor_streamed_texture != ~0U) {
+                m_StreamedTextureMaterials.resize(m_TextureStreamer.getTextureCount(), ~0U);
+                m_StreamedTextureMaterials[floor_streamed_texture] = plane_material_index; // Follows the slot of the texture
+            }
+            for (uint32_t mesh_index = plane_first_mesh; mesh_index < uint32_t(m_SceneResource.meshes.size()); mesh_index++) {
+                m_SceneResource.instances.push_back({ .transform = glm::scale(glm::translate(glm::mat4(1), glm::vec3(0, -0.9F, 0)), glm::vec3(2.F)), .materialIndex = plane_material_index, .meshIndex = mesh_index });
+            }
+            updateInstanceBounds(m_SceneResource); // The plane, and the model when its transforms were changed
 
             createGltfSceneInfoBuffer(m_SceneResource, m_StagingUploader); // Create buffers for the scene data (GPU buffers)
 
+            // Normal matrices are only recomputed when an instance moves (see setInstanceTransform)
+            m_NormalMatrices.resize(m_SceneResource.instances.size());
+            for (size_t i = 0; i < m_SceneResource.instances.size(); i++) {
+                m_NormalMatrices[i] = toNormalMatrix(m_SceneResource.instances[i].transform);
+            }
+            m_Allocator.createBuffer(m_NormalMatricesBuffer, std::span(m_NormalMatrices).size_bytes(), VK_BUFFER_USAGE_2_STORAGE_BUFFER_BIT);
+            m_StagingUploader.appendBuffer(m_NormalMatricesBuffer, 0, std::span(m_NormalMatrices));
+
             m_StagingUploader.cmdUploadAppended(cmd); // Upload the scene information to the GPU
 
             // Scene information
@@ -340,7 +526,18 @@ namespace vk_test {
             scene_info.punctualLights[0].type      = shaderio::GltfLightType::ePoint;
             scene_info.punctualLights[0].coneAngle = 0.9F; // Cone angle for spot lights (0 for point and directional lights)
 
-            m_App->submitAndWaitTempCmdBuffer(cmd); // Submit the command buffer to upload the resources
+            // Hand the resources over to the graphics queue, then submit the upload
+            for (const Buffer& gltf_data : m_SceneResource.b_gltf_datas) {
+                m_UploadScheduler.cmdReleaseBuffer(cmd, gltf_data);
+            }
+            for (const Buffer* buffer : { &m_SceneResource.b_meshes, &m_SceneResource.b_instances, &m_SceneResource.b_materials, &m_SceneResource.b_scene_info, &m_NormalMatricesBuffer }) {
+                m_UploadScheduler.cmdReleaseBuffer(cmd, *buffer);
+            }
+            for (const Image& texture : m_Textures) {
+                m_UploadScheduler.cmdReleaseImage(cmd, texture);
+            }
+            m_ImageDecodePool.waitDecoded(); // The staging space of the images must be written before the submit
+            m_UploadScheduler.submitUpload(cmd);
 
             // Default camera
             m_CameraManip->setClipPlanes({ 0.01F, 100.0F });
@@ -349,16 +546,9 @@ namespace vk_test {
 
         //---------------------------------------------------------------------------------------------------------------
         // The Vulkan descriptor set defines the resources that are used by the shaders.
-        // Here we add the bindings for the textures.
+        // Here it is the bindless texture table, indexed by the materials (GltfMetallicRoughness::baseColorTextureIndex).
         void createGraphicsDescriptorSetLayout() {
-            DescriptorBindings bindings;
-            bindings.addBinding({ .binding         = shaderio::BindingPoints::eTextures,
-                                  .descriptorType  = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
-                                  .descriptorCount = 10, // Maximum number of textures used in the scene
-                                  .stageFlags      = VK_SHADER_STAGE_ALL },
-                                VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT | VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT);
-            // Creating the descriptor set and set layout from the bindings
-            m_DescPack.init(bindings, m_App->getDevice(), 1, VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT, VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT);
+            m_TextureTable.init(m_App->getDevice(), m_App->getPhysicalDevice(), shaderio::BindingPoints::eTextures);
         }
 
         //--------------------------------------------------------------------------------------------------
@@ -366,9 +556,12 @@ namespace vk_test {
         // Stages like: vertex shader, fragment shader, rasterization, and blending.
         //
         void createGraphicsPipelineLayout() {
+            // The task and mesh shaders read the same push constant, all the shader objects bound together must have the same range
+            m_PushConstantStages = VK_SHADER_STAGE_ALL_GRAPHICS | (m_MeshShaderSupport ? VK_SHADER_STAGE_TASK_BIT_EXT | VK_SHADER_STAGE_MESH_BIT_EXT : 0);
+
             // Push constant is used to pass data to the shader at each frame
             const VkPushConstantRange push_constant_range{
-                .stageFlags = VK_SHADER_STAGE_ALL_GRAPHICS,
+                .stageFlags = m_PushConstantStages,
                 .offset     = 0,
                 .size       = sizeof(shaderio::TutoPushConstant)
             };
@@ -377,7 +570,7 @@ namespace vk_test {
             const VkPipelineLayoutCreateInfo pipeline_layout_info{
                 .sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
                 .setLayoutCount         = 1,
-                .pSetLayouts            = m_DescPack.getLayoutPtr(),
+                .pSetLayouts            = m_TextureTable.getLayoutPtr(),
                 .pushConstantRangeCount = 1,
                 .pPushConstantRanges    = &push_constant_range,
             };
@@ -386,59 +579,85 @@ namespace vk_test {
 
         //--------------------------------------------------------------------------------------------------
         // Update the textures: this is called when the scene is loaded
-        // Textures are updated in the descriptor set (0)
-        void updateTextures() {
-            if (m_Textures.empty()) {
-                return;
+        // Textures are updated in the descriptor set (0), only the slots that changed are written
+        void updateTextures() { m_TextureTable.flush(); }
+
+        // A streamed texture with a new image gets a new slot, the frames in flight keep sampling the previous image
+        // through the previous slot, recycled once this frame has completed. Its material is moved to the new slot.
+        void updateStreamedTextures(VkCommandBuffer cmd) {
+            std::vector<uint32_t> changed_materials;
+            for (uint32_t texture_id = 0; texture_id < m_TextureStreamer.getTextureCount(); texture_id++) {
+                if (!m_TextureStreamer.hasChanged(texture_id)) {
+                    continue;
+                }
+                const uint32_t old_slot = m_TextureStreamer.getFeedbackIndex(texture_id);
+                const uint32_t new_slot = m_TextureTable.allocateSlot(m_TextureStreamer.getDescriptorImageInfo(texture_id));
+                if (new_slot == BindlessTextureTable::NULL_SLOT) {
+                    // The table is full, the slot is rewritten once no frame uses it
+                    vkDeviceWaitIdle(m_App->getDevice());
+                    m_TextureTable.updateSlot(old_slot, m_TextureStreamer.getDescriptorImageInfo(texture_id));
+                    continue;
+                }
+                m_TextureTable.freeSlot(old_slot, m_App->getFrameSemaphoreState());
+                m_TextureStreamer.setFeedbackIndex(texture_id, new_slot);
+
+                if (texture_id < m_StreamedTextureMaterials.size() && m_StreamedTextureMaterials[texture_id] != ~0U) {
+                    m_SceneResource.materials[m_StreamedTextureMaterials[texture_id]].baseColorTextureIndex = int(new_slot);
+                    changed_materials.push_back(m_StreamedTextureMaterials[texture_id]);
+                }
             }
+            m_TextureTable.flush();
 
-            // Update the descriptor set with the textures
-            WriteSetContainer    write{};
-            VkWriteDescriptorSet all_textures = m_DescPack.makeWrite(shaderio::BindingPoints::eTextures, 0, 1, uint32_t(m_Textures.size()));
-            Image*               all_images   = m_Textures.data();
-            write.append(all_textures, all_images);
-            vkUpdateDescriptorSets(m_App->getDevice(), write.size(), write.data(), 0, nullptr);
+            if (changed_materials.empty()) {
+                return;
+            }
+            // The previous frames are done reading the materials before they are written
+            const VkPipelineStageFlags2 material_readers = VK_PIPELINE_STAGE_2_ALL_GRAPHICS_BIT | VK_PIPELINE_STAGE_2_RAY_TRACING_SHADER_BIT_KHR;
+            cmdBufferMemoryBarrier(cmd, { m_SceneResource.b_materials.buffer, material_readers, VK_PIPELINE_STAGE_2_TRANSFER_BIT });
+            for (uint32_t material_index : changed_materials) {
+                vkCmdUpdateBuffer(cmd, m_SceneResource.b_materials.buffer, material_index * sizeof(shaderio::GltfMetallicRoughness), sizeof(shaderio::GltfMetallicRoughness),
+                                  &m_SceneResource.materials[material_index]);
+            }
+            cmdBufferMemoryBarrier(cmd, { m_SceneResource.b_materials.buffer, VK_PIPELINE_STAGE_2_TRANSFER_BIT, material_readers });
         }
 
-        // This function is used to compile the Slang shader, and when it fails, it will use the pre-compiled shaders
-        VkShaderModuleCreateInfo compileSlangShader(const std::filesystem::path& filename, const std::span<const uint32_t>& spirv) {
+        // Compile a Slang shader of the scene. There is no pre-compiled fallback: the shaders follow the scene
+        // layout (shaderio.h) and the code compiled against an older one would read the wrong data, so a failure is fatal.
+        VkShaderModuleCreateInfo compileSlangShader(const std::filesystem::path& filename) {
             SCOPED_TIMER(__FUNCTION__);
 
-            // Use pre-compiled shaders by default
-            VkShaderModuleCreateInfo shader_code = getShaderModuleCreateInfo(spirv);
-
-            // Try compiling the shader
             std::filesystem::path shader_source = findFile(filename, { PATH.getShadersPath() });
-            if (m_SlangCompiler.compileFile(shader_source)) {
-                // Using the Slang compiler to compile the shaders
-                shader_code.codeSize = m_SlangCompiler.getSpirvSize();
-                shader_code.pCode    = m_SlangCompiler.getSpirv();
-            }
-            else {
+            if (!m_SlangCompiler.compileFile(shader_source)) {
                 VK_TEST_SAY("Error compiling shaders : " << shader_source.string().c_str() << '\n'
                                                          << m_SlangCompiler.getLastDiagnosticMessage().c_str());
+                throw std::runtime_error("failed to compile " + filename.string());
             }
-            return shader_code;
+            return getShaderModuleCreateInfo(std::span(m_SlangCompiler.getSpirv(), m_SlangCompiler.getSpirvSize() / sizeof(uint32_t)));
         }
 
         //---------------------------------------------------------------------------------------------------------------
         // Compile the graphics shaders and create the shader modules.
         // This function only creates vertex and fragment shader modules for the graphics pipeline.
         // The actual graphics pipeline is created elsewhere and uses these shader modules.
-        // This function will use the pre-compiled shaders if the compilation fails.
         void compileAndCreateGraphicsShaders() {
             SCOPED_TIMER(__FUNCTION__);
 
-            // Use pre-compiled shaders by default
-            VkShaderModuleCreateInfo shader_code = compileSlangShader("foundation.slang", foundation_slang);
+            VkShaderModuleCreateInfo shader_code = compileSlangShader("foundation.slang");
 
             // Destroy the previous shaders if they exist
             vkDestroyShaderEXT(m_App->getDevice(), m_VertexShader, nullptr);
             vkDestroyShaderEXT(m_App->getDevice(), m_FragmentShader, nullptr);
 
+            createGraphicsShaders(shader_code, m_VertexShader, m_FragmentShader);
+        }
+
+        //---------------------------------------------------------------------------------------------------------------
+        // Create the vertex and fragment shader objects from SPIR-V.
+        // Only reads immutable state (device, descriptor set layout), so it is also called from the hot reload thread.
+        VkResult createGraphicsShaders(const VkShaderModuleCreateInfo& shader_code, VkShaderEXT& vertex_shader, VkShaderEXT& fragment_shader) const {
             // Push constant is used to pass data to the shader at each frame
             const VkPushConstantRange push_constant_range{
-                .stageFlags = VK_SHADER_STAGE_ALL_GRAPHICS,
+                .stageFlags = m_PushConstantStages,
                 .offset     = 0,
                 .size       = sizeof(shaderio::TutoPushConstant),
             };
@@ -449,7 +668,7 @@ namespace vk_test {
                 .codeType               = VK_SHADER_CODE_TYPE_SPIRV_EXT,
                 .pName                  = "main",
                 .setLayoutCount         = 1,
-                .pSetLayouts            = m_DescPack.getLayoutPtr(),
+                .pSetLayouts            = m_TextureTable.getLayoutPtr(),
                 .pushConstantRangeCount = 1,
                 .pPushConstantRanges    = &push_constant_range,
             };
@@ -460,7 +679,10 @@ namespace vk_test {
             shader_info.pName     = "vertexMain"; // The entry point of the vertex shader
             shader_info.codeSize  = shader_code.codeSize;
             shader_info.pCode     = shader_code.pCode;
-            vkCreateShadersEXT(m_App->getDevice(), 1U, &shader_info, nullptr, &m_VertexShader);
+            VkResult result       = vkCreateShadersEXT(m_App->getDevice(), 1U, &shader_info, nullptr, &vertex_shader);
+            if (result != VK_SUCCESS) {
+                return result;
+            }
 
             // Fragment Shader
             shader_info.stage     = VK_SHADER_STAGE_FRAGMENT_BIT;
@@ -468,7 +690,199 @@ namespace vk_test {
             shader_info.pName     = "fragmentMain"; // The entry point of the vertex shader
             shader_info.codeSize  = shader_code.codeSize;
             shader_info.pCode     = shader_code.pCode;
-            vkCreateShadersEXT(m_App->getDevice(), 1U, &shader_info, nullptr, &m_FragmentShader);
+            result                = vkCreateShadersEXT(m_App->getDevice(), 1U, &shader_info, nullptr, &fragment_shader);
+            if (result != VK_SUCCESS) {
+                vkDestroyShaderEXT(m_App->getDevice(), vertex_shader, nullptr);
+                vertex_shader = VK_NULL_HANDLE;
+            }
+            return result;
+        }
+
+        //---------------------------------------------------------------------------------------------------------------
+        // Create the task and mesh shader objects from the SPIR-V of meshlets.slang, drawn with m_FragmentShader.
+        // Like createGraphicsShaders, also called from the hot reload thread.
+        VkResult createMeshShaders(const VkShaderModuleCreateInfo& shader_code, VkShaderEXT& task_shader, VkShaderEXT& mesh_shader) const {
+            const VkPushConstantRange push_constant_range{
+                .stageFlags = m_PushConstantStages,
+                .offset     = 0,
+                .size       = sizeof(shaderio::TutoPushConstant),
+            };
+
+            VkShaderCreateInfoEXT shader_info{
+                .sType                  = VK_STRUCTURE_TYPE_SHADER_CREATE_INFO_EXT,
+                .codeType               = VK_SHADER_CODE_TYPE_SPIRV_EXT,
+                .codeSize               = shader_code.codeSize,
+                .pCode                  = shader_code.pCode,
+                .setLayoutCount         = 1,
+                .pSetLayouts            = m_TextureTable.getLayoutPtr(),
+                .pushConstantRangeCount = 1,
+                .pPushConstantRanges    = &push_constant_range,
+            };
+
+            // Task Shader
+            shader_info.stage     = VK_SHADER_STAGE_TASK_BIT_EXT;
+            shader_info.nextStage = VK_SHADER_STAGE_MESH_BIT_EXT;
+            shader_info.pName     = "taskMain";
+            VkResult result       = vkCreateShadersEXT(m_App->getDevice(), 1U, &shader_info, nullptr, &task_shader);
+            if (result != VK_SUCCESS) {
+                return result;
+            }
+
+            // Mesh Shader
+            shader_info.stage     = VK_SHADER_STAGE_MESH_BIT_EXT;
+            shader_info.nextStage = VK_SHADER_STAGE_FRAGMENT_BIT;
+            shader_info.pName     = "meshMain";
+            result                = vkCreateShadersEXT(m_App->getDevice(), 1U, &shader_info, nullptr, &mesh_shader);
+            if (result != VK_SUCCESS) {
+                vkDestroyShaderEXT(m_App->getDevice(), task_shader, nullptr);
+                task_shader = VK_NULL_HANDLE;
+            }
+            return result;
+        }
+
+        //---------------------------------------------------------------------------------------------------------------
+        // Watch the shader directory and rebuild the graphics shaders in the background.
+        // The new shader objects are created on the watcher thread; only the handle swap
+        // happens on the render thread (onPreRender), and the old handles are destroyed
+        // through the application free queue once no frame in flight uses them.
+        void startShaderHotReload() {
+            m_ShaderHotReload.addProgram("foundation.slang", [this](std::span<const uint32_t> spirv) -> std::function<void()> {
+                VkShaderEXT vertex_shader{};
+                VkShaderEXT fragment_shader{};
+                if (createGraphicsShaders(getShaderModuleCreateInfo(spirv), vertex_shader, fragment_shader) != VK_SUCCESS) {
+                    return {};
+                }
+
+                return [this, vertex_shader, fragment_shader]() {
+                    VkDevice    device              = m_App->getDevice();
+                    VkShaderEXT old_vertex_shader   = std::exchange(m_VertexShader, vertex_shader);
+                    VkShaderEXT old_fragment_shader = std::exchange(m_FragmentShader, fragment_shader);
+                    m_App->submitResourceFree([device, old_vertex_shader, old_fragment_shader]() {
+                        vkDestroyShaderEXT(device, old_vertex_shader, nullptr);
+                        vkDestroyShaderEXT(device, old_fragment_shader, nullptr);
+                    });
+                };
+            });
+
+            if (m_UseMeshShaders) {
+                m_ShaderHotReload.addProgram("meshlets.slang", [this](std::span<const uint32_t> spirv) -> std::function<void()> {
+                    VkShaderEXT task_shader{};
+                    VkShaderEXT mesh_shader{};
+                    if (createMeshShaders(getShaderModuleCreateInfo(spirv), task_shader, mesh_shader) != VK_SUCCESS) {
+                        return {};
+                    }
+
+                    return [this, task_shader, mesh_shader]() {
+                        VkDevice    device          = m_App->getDevice();
+                        VkShaderEXT old_task_shader = std::exchange(m_TaskShader, task_shader);
+                        VkShaderEXT old_mesh_shader = std::exchange(m_MeshShader, mesh_shader);
+                        m_App->submitResourceFree([device, old_task_shader, old_mesh_shader]() {
+                            vkDestroyShaderEXT(device, old_task_shader, nullptr);
+                            vkDestroyShaderEXT(device, old_mesh_shader, nullptr);
+                        });
+                    };
+                });
+            }
+
+            // Same settings as the render thread compiler, but a separate Slang session
+            m_ShaderHotReload.init(PATH.getShadersPath(), [](SlangCompiler& compiler) {
+                compiler.addSearchPaths({ PATH.getShadersPath() });
+                compiler.defaultTarget();
+                compiler.defaultOptions();
+                compiler.addOption({ slang::CompilerOptionName::DebugInformation,
+                                     { slang::CompilerOptionValueKind::Int, SLANG_DEBUG_INFO_LEVEL_MAXIMAL } });
+            });
+        }
+
+        //---------------------------------------------------------------------------------------------------------------
+        // Set up the GPU-driven raster path: a compute pass writes the indirect draws of all instances,
+        // so recording the raster pass no longer depends on the number of instances.
+        // Without a compiled gpu_draws.slang, rasterScene keeps recording one draw per instance.
+        void createGpuDraws() {
+            SCOPED_TIMER(__FUNCTION__);
+
+            std::filesystem::path shader_source = findFile("gpu_draws.slang", { PATH.getShadersPath() });
+            if (!m_SlangCompiler.compileFile(shader_source)) {
+                VK_TEST_SAY("Error compiling shaders : " << shader_source.string().c_str() << '\n'
+                                                         << m_SlangCompiler.getLastDiagnosticMessage().c_str());
+                return;
+            }
+
+            std::span<const uint32_t> spirv(m_SlangCompiler.getSpirv(), m_SlangCompiler.getSpirvSize() / sizeof(uint32_t));
+            if (m_GpuDrawBuilder.init(&m_Allocator, spirv, m_App->getFrameCycleSize()) != VK_SUCCESS) {
+                m_GpuDrawBuilder.deinit();
+                return;
+            }
+
+            VkCommandBuffer cmd = beginTempCmdBuffer();
+            m_GpuDrawBuilder.setScene(m_SceneResource, m_StagingUploader);
+            m_GpuDrawBuilder.setHizSize(cmd, m_GBuffers.getSize());
+            m_StagingUploader.cmdUploadAppended(cmd);
+            submitTempCmdBuffer(cmd);
+            m_StagingUploader.releaseStaging();
+
+            m_UseGpuDraws = true;
+        }
+
+        //---------------------------------------------------------------------------------------------------------------
+        // Set up the mesh shader raster path (meshlets.slang): each task workgroup culls MESHLET_TASK_WORKGROUP_SIZE meshlets
+        // of an instance against the frustum and their normal cone, and launches a mesh workgroup per meshlet left.
+        // It replaces the GPU draws, which cull whole instances. Without it, m_UseMeshShaders is reset and the vertex shader is used.
+        void createMeshShaderDraws() {
+            if (!m_UseMeshShaders) {
+                return;
+            }
+            SCOPED_TIMER(__FUNCTION__);
+            m_UseMeshShaders = false;
+
+            // The meshes all need their meshlets, the ones without triangles have none
+            for (const shaderio::GltfMesh& mesh : m_SceneResource.meshes) {
+                if (mesh.meshlets.count == 0 && mesh.triMesh.indices.count != 0) {
+                    VK_TEST_SAY("WARNING : Mesh without meshlets, the mesh shaders are not used");
+                    return;
+                }
+            }
+
+            std::filesystem::path shader_source = findFile("meshlets.slang", { PATH.getShadersPath() });
+            if (!m_SlangCompiler.compileFile(shader_source)) {
+                VK_TEST_SAY("Error compiling shaders : " << shader_source.string().c_str() << '\n'
+                                                         << m_SlangCompiler.getLastDiagnosticMessage().c_str());
+                return;
+            }
+            std::span<const uint32_t> spirv(m_SlangCompiler.getSpirv(), m_SlangCompiler.getSpirvSize() / sizeof(uint32_t));
+            if (createMeshShaders(getShaderModuleCreateInfo(spirv), m_TaskShader, m_MeshShader) != VK_SUCCESS) {
+                return;
+            }
+
+            // The draws are split in as many vkCmdDrawMeshTasksEXT as the device needs
+            VkPhysicalDeviceMeshShaderPropertiesEXT mesh_properties{ VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_EXT };
+            VkPhysicalDeviceProperties2             properties{ .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2, .pNext = &mesh_properties };
+            vkGetPhysicalDeviceProperties2(m_App->getPhysicalDevice(), &properties);
+            m_MaxTaskWorkGroupCount = std::min(mesh_properties.maxTaskWorkGroupCount[0], mesh_properties.maxTaskWorkGroupTotalCount);
+
+            // One task workgroup per MESHLET_TASK_WORKGROUP_SIZE meshlets of each instance, the instances never change mesh.
+            // With levels of detail, enough for the full resolution, the coarser levels use the first ones.
+            std::vector<shaderio::MeshletTaskGroup> task_groups;
+            for (uint32_t i = 0; i < uint32_t(m_SceneResource.instances.size()); i++) {
+                const shaderio::GltfMesh& mesh          = m_SceneResource.meshes[m_SceneResource.instances[i].meshIndex];
+                const uint32_t            meshlet_count = mesh.lodCount > 0 ? mesh.lods[0].meshletCount : mesh.meshlets.count;
+                for (uint32_t first = 0; first < meshlet_count; first += MESHLET_TASK_WORKGROUP_SIZE) {
+                    task_groups.push_back({ .instanceIndex = i, .firstMeshlet = first });
+                }
+            }
+            m_MeshletTaskGroupCount = uint32_t(task_groups.size());
+            if (task_groups.empty()) {
+                return;
+            }
+
+            VkCommandBuffer cmd = beginTempCmdBuffer();
+            m_Allocator.createBuffer(m_MeshletTaskGroupsBuffer, std::span(task_groups).size_bytes(), VK_BUFFER_USAGE_2_STORAGE_BUFFER_BIT);
+            m_StagingUploader.appendBuffer(m_MeshletTaskGroupsBuffer, 0, std::span(task_groups));
+            m_StagingUploader.cmdUploadAppended(cmd);
+            submitTempCmdBuffer(cmd);
+            m_StagingUploader.releaseStaging();
+
+            m_UseMeshShaders = true;
         }
 
         //---------------------------------------------------------------------------------------------------------------
@@ -487,32 +901,52 @@ namespace vk_test {
             m_SceneResource.scene_info.materials      = (shaderio::GltfMetallicRoughness*) m_SceneResource.b_materials.address; // Get the address of the material buffer
 
             // Making sure the scene information buffer is updated before rendering
-            // Wait that the fragment shader is done reading the previous scene information and wait for the transfer to complete
-            cmdBufferMemoryBarrier(cmd, { m_SceneResource.b_scene_info.buffer, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_2_TRANSFER_BIT });
+            // Wait that the raster shaders (vertex or task and mesh, fragment) are done reading the previous scene information and wait for the transfer to complete
+            cmdBufferMemoryBarrier(cmd, { m_SceneResource.b_scene_info.buffer, VK_PIPELINE_STAGE_2_ALL_GRAPHICS_BIT, VK_PIPELINE_STAGE_2_TRANSFER_BIT });
             vkCmdUpdateBuffer(cmd, m_SceneResource.b_scene_info.buffer, 0, sizeof(shaderio::GltfSceneInfo), &m_SceneResource.scene_info);
-            cmdBufferMemoryBarrier(cmd, { m_SceneResource.b_scene_info.buffer, VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT });
+            cmdBufferMemoryBarrier(cmd, { m_SceneResource.b_scene_info.buffer, VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_PIPELINE_STAGE_2_ALL_GRAPHICS_BIT });
         }
 
         //---------------------------------------------------------------------------------------------------------------
         // Recording the commands to render the scene
         //
         void rasterScene(VkCommandBuffer cmd) {
+            // Level of detail of the instances, the same selection for all the draw paths
+            const float lod_scale = meshLodScale(float(m_App->getViewportSize().height), m_CameraManip->getPerspectiveMatrix(), m_LodThreshold);
+
             // Push constant information, see usage later
             shaderio::TutoPushConstant push_values{
+                .normalMatrices            = (glm::mat4*) m_NormalMatricesBuffer.address,                     // Per instance normal matrices
                 .sceneInfoAddress          = (shaderio::GltfSceneInfo*) m_SceneResource.b_scene_info.address, // Pass the address of the scene information buffer to the shader
                 .metallicRoughnessOverride = m_MetallicRoughnessOverride,                                     // Override the metallic and roughness values
+                .textureFeedback           = (uint32_t*) m_TextureStreamer.getFeedbackBuffer().address,       // Resolution wanted per texture, read back by the streamer
+                .meshletTaskGroups         = (shaderio::MeshletTaskGroup*) m_MeshletTaskGroupsBuffer.address, // Task workgroups of the mesh shader path
+                .meshletTaskGroupOffset    = 0,                                                               // Set per draw
+                .meshletCulling            = m_MeshletCulling,                                                // Frustum and normal cone culling of the meshlets
+                .lodScale                  = lod_scale,                                                       // Level of detail of the instances of the mesh shaders
             };
             const VkPushConstantsInfo push_info{
                 .sType      = VK_STRUCTURE_TYPE_PUSH_CONSTANTS_INFO,
                 .layout     = m_GraphicPipelineLayout,
-                .stageFlags = VK_SHADER_STAGE_ALL_GRAPHICS,
+                .stageFlags = m_PushConstantStages,
                 .offset     = 0,
                 .size       = sizeof(shaderio::TutoPushConstant),
-                .pValues    = &push_values, // Other values are passed later
+                .pValues    = &push_values,
             };
 
+            // The meshlets are culled by the task shader, the GPU draws of whole instances are not needed
+            const bool gpu_draws = m_UseGpuDraws && !m_UseMeshShaders;
+
+            // Cull and write the indirect draws, this cannot be done in between dynamic rendering
+            if (gpu_draws) {
+                m_GpuDrawBuilder.setLodScale(lod_scale);
+                m_GpuDrawBuilder.cmdBuildDraws(cmd, m_SceneResource, m_App->getFrameCycleIndex());
+            }
+
             // Rendering the Sky
             if (m_SceneResource.scene_info.useSky != 0) {
+                GpuProfiler::Scope scope(m_App->getGpuProfiler(), cmd, "Sky");
+
                 const glm::mat4& view_matrix = m_CameraManip->getViewMatrix();
                 const glm::mat4& proj_matrix = m_CameraManip->getPerspectiveMatrix();
                 m_SkySimple.runCompute(cmd, m_App->getViewportSize(), view_matrix, proj_matrix, m_SceneResource.scene_info.skySimpleParam, m_GBuffers.getDescriptorImageInfo(eImgRendered));
@@ -531,8 +965,15 @@ namespace vk_test {
             depth_attachment.imageView                 = m_GBuffers.getDepthImageView();
             depth_attachment.clearValue                = { .depthStencil = DEFAULT_VkClearDepthStencilValue };
 
+            // Without GPU draws, large scenes record their draws on several threads (see ParallelCommandRecorder).
+            // The secondaries must inherit the statistics query of the profiler, when there is one.
+            const VkQueryPipelineStatisticFlags active_statistics = m_App->getGpuProfiler().getActiveStatistics();
+            const bool parallel_draws = !gpu_draws && !m_UseMeshShaders && m_SceneResource.instances.size() >= PARALLEL_DRAW_MIN_INSTANCES
+                                        && (active_statistics == 0 || m_App->getParallelRecorder().canInheritQueries());
+
             // Create the rendering info
             VkRenderingInfo rendering_info      = DEFAULT_VkRenderingInfo;
+            rendering_info.flags                = parallel_draws ? VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT : 0;
             rendering_info.renderArea           = DEFAULT_VkRect2D(m_GBuffers.getSize());
             rendering_info.colorAttachmentCount = 1;
             rendering_info.pColorAttachments    = &color_attachment;
@@ -541,84 +982,168 @@ namespace vk_test {
             // Change the GBuffer layout to prepare for rendering (attachment)
             cmdImageMemoryBarrier(cmd, { m_GBuffers.getColorImage(eImgRendered), VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL });
 
-            // Bind the descriptor sets for the graphics pipeline (making textures available to the shaders)
-            const VkBindDescriptorSetsInfo bind_descriptor_sets_info{ .sType              = VK_STRUCTURE_TYPE_BIND_DESCRIPTOR_SETS_INFO,
-                                                                      .stageFlags         = VK_SHADER_STAGE_ALL_GRAPHICS,
-                                                                      .layout             = m_GraphicPipelineLayout,
-                                                                      .firstSet           = 0,
-                                                                      .descriptorSetCount = 1,
-                                                                      .pDescriptorSets    = m_DescPack.getSetPtr() };
-            vkCmdBindDescriptorSets2(cmd, &bind_descriptor_sets_info);
-
-            // ** BEGIN RENDERING **
-            vkCmdBeginRendering(cmd, &rendering_info);
-
             // All dynamic states are set here
             m_DynamicPipeline.rasterizationState.cullMode = VK_CULL_MODE_NONE; // Don't cull any triangles (double-sided rendering)
-            m_DynamicPipeline.cmdApplyAllStates(cmd);
-            vk_test::GraphicsPipelineState::cmdSetViewportAndScissor(cmd, m_App->getViewportSize());
-            vkCmdSetDepthTestEnable(cmd, VK_TRUE);
 
-            // Same shader for all meshes
-            vk_test::GraphicsPipelineState::cmdBindShaders(cmd, { .vertex = m_VertexShader, .fragment = m_FragmentShader });
+            // Set in the frame command buffer, or in each secondary as they inherit no state
+            auto cmd_set_raster_state = [&](VkCommandBuffer draw_cmd) {
+                // Bind the descriptor sets for the graphics pipeline (making textures available to the shaders)
+                const VkBindDescriptorSetsInfo bind_descriptor_sets_info{ .sType              = VK_STRUCTURE_TYPE_BIND_DESCRIPTOR_SETS_INFO,
+                                                                          .stageFlags         = VK_SHADER_STAGE_ALL_GRAPHICS,
+                                                                          .layout             = m_GraphicPipelineLayout,
+                                                                          .firstSet           = 0,
+                                                                          .descriptorSetCount = 1,
+                                                                          .pDescriptorSets    = m_TextureTable.getSetPtr() };
+                vkCmdBindDescriptorSets2(draw_cmd, &bind_descriptor_sets_info);
+
+                m_DynamicPipeline.cmdApplyAllStates(draw_cmd);
+                vk_test::GraphicsPipelineState::cmdSetViewportAndScissor(draw_cmd, m_App->getViewportSize());
+                vkCmdSetDepthTestEnable(draw_cmd, VK_TRUE);
+
+                // Same shader for all meshes, the task and mesh stages are bound (to null) whenever the device has them
+                if (m_UseMeshShaders) {
+                    vk_test::GraphicsPipelineState::cmdBindShaders(draw_cmd, { .fragment = m_FragmentShader, .task = m_TaskShader, .mesh = m_MeshShader }, true);
+                }
+                else {
+                    vk_test::GraphicsPipelineState::cmdBindShaders(draw_cmd, { .vertex = m_VertexShader, .fragment = m_FragmentShader }, m_MeshShaderSupport);
+                }
 
-            // We don't send vertex attributes, they are pulled in the shader
-            VkVertexInputBindingDescription2EXT   binding_description   = {};
-            VkVertexInputAttributeDescription2EXT attribute_description = {};
-            vkCmdSetVertexInputEXT(cmd, 0, nullptr, 0, nullptr);
+                // We don't send vertex attributes, they are pulled in the shader
+                vkCmdSetVertexInputEXT(draw_cmd, 0, nullptr, 0, nullptr);
 
-            for (size_t i = 0; i < m_SceneResource.instances.size(); i++) {
-                uint32_t                      meshIndex = m_SceneResource.instances[i].meshIndex = 0;
-                const shaderio::GltfMesh&     gltf_mesh                                          = m_SceneResource.meshes[meshIndex];
-                const shaderio::TriangleMesh& triMesh                                            = gltf_mesh.triMesh;
+                // Push constant is the same for all draws, the instance index comes from firstInstance
+                vkCmdPushConstants2(draw_cmd, &push_info);
+            };
+
+            const glm::vec3 eye = m_CameraManip->getEye();
 
-                // Push constant is information that is passed to the shader at each draw call.
-                push_values.normalMatrix  = glm::transpose(glm::inverse(glm::mat3(m_SceneResource.instances[i].transform)));
-                push_values.instanceIndex = int(i); // The index of the instance in the m_instances vector
-                vkCmdPushConstants2(cmd, &push_info);
+            auto cmd_draw_instance = [&](VkCommandBuffer draw_cmd, uint64_t i) {
+                const shaderio::GltfInstance& instance  = m_SceneResource.instances[i];
+                const shaderio::GltfMesh&     gltf_mesh = m_SceneResource.meshes[instance.meshIndex];
+
+                // The levels of detail are other indices on the same vertices
+                const shaderio::BufferView indices = meshLodIndices(gltf_mesh, selectMeshLod(gltf_mesh, instance.transform, eye, lod_scale));
 
                 // Get the buffer directly using the pre-computed mapping
-                uint32_t      buffer_index = m_SceneResource.mesh_to_buffer_index[meshIndex] = 0;
-                const Buffer& v                                                              = m_SceneResource.b_gltf_datas[buffer_index];
+                const uint32_t buffer_index = m_SceneResource.mesh_to_buffer_index[instance.meshIndex];
+                const Buffer&  v            = m_SceneResource.b_gltf_datas[buffer_index];
 
                 // Bind index buffers
-                vkCmdBindIndexBuffer(cmd, v.buffer, triMesh.indices.offset, VkIndexType(gltf_mesh.indexType));
+                vkCmdBindIndexBuffer(draw_cmd, v.buffer, indices.offset, VkIndexType(gltf_mesh.indexType));
+
+                // Draw the mesh, the instance index is passed as firstInstance
+                vkCmdDrawIndexed(draw_cmd, indices.count, 1, 0, 0, uint32_t(i)); // All indices of the level
+            };
+
+            // ** BEGIN RENDERING **
+            vkCmdBeginRendering(cmd, &rendering_info);
 
-                // Draw the mesh
-                vkCmdDrawIndexed(cmd, triMesh.indices.count, 1, 0, 0, 0); // All indices
+            if (parallel_draws) {
+                const VkFormat                                color_format = m_GBuffers.getColorFormat(eImgRendered);
+                const VkCommandBufferInheritanceRenderingInfo inheritance{
+                    .sType                   = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO,
+                    .colorAttachmentCount    = 1,
+                    .pColorAttachmentFormats = &color_format,
+                    .depthAttachmentFormat   = m_GBuffers.getDepthFormat(),
+                    .rasterizationSamples    = VK_SAMPLE_COUNT_1_BIT,
+                };
+                m_App->getParallelRecorder().cmdExecuteParallel(cmd, &inheritance, active_statistics, m_SceneResource.instances.size(), cmd_set_raster_state, cmd_draw_instance);
+            }
+            else {
+                cmd_set_raster_state(cmd);
+                if (m_UseMeshShaders) {
+                    // One task workgroup per MeshletTaskGroup, only the offset changes between the draws
+                    const uint32_t meshlet_offset = offsetof(shaderio::TutoPushConstant, meshletTaskGroupOffset);
+                    for (uint32_t first = 0; first < m_MeshletTaskGroupCount; first += m_MaxTaskWorkGroupCount) {
+                        VkPushConstantsInfo offset_info = push_info;
+                        offset_info.offset              = meshlet_offset;
+                        offset_info.size                = sizeof(uint32_t);
+                        offset_info.pValues             = &first;
+                        vkCmdPushConstants2(cmd, &offset_info);
+                        vkCmdDrawMeshTasksEXT(cmd, std::min(m_MaxTaskWorkGroupCount, m_MeshletTaskGroupCount - first), 1, 1);
+                    }
+                }
+                else if (gpu_draws) {
+                    m_GpuDrawBuilder.cmdDraw(cmd);
+                }
+                else {
+                    for (size_t i = 0; i < m_SceneResource.instances.size(); i++) {
+                        cmd_draw_instance(cmd, i);
+                    }
+                }
             }
 
             // ** END RENDERING **
             vkCmdEndRendering(cmd);
             cmdImageMemoryBarrier(cmd, { m_GBuffers.getColorImage(eImgRendered), VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL });
+
+            // The depth of this frame is the occluder of the next one
+            if (gpu_draws) {
+                m_GpuDrawBuilder.cmdBuildHiz(cmd, m_GBuffers.getDepthImage(), m_GBuffers.getDepthImageView(), m_SceneResource.scene_info.viewProjMatrix);
+            }
         }
 
         void onLastHeadlessFrame() override {
-            //m_App->saveImageToFile(m_GBuffers.getColorImage(eImgTonemapped), m_GBuffers.getSize(), getExecutablePath().replace_extension(".jpg").string());
+            m_ImageReadback.poll(true); // The golden image check
         }
 
         // Accessor for camera manipulator
         std::shared_ptr<CameraManipulator> getCameraManipulator() const { return m_CameraManip; }
 
+        // glTF loaded instead of the teapot, with its material, to call before onAttach
+        void setSceneFile(const std::filesystem::path& filename) { m_SceneFile = filename; }
+
+        // Check of the last frame of a headless run, to call before the run
+        void setGoldenImage(const GoldenImageSettings& settings) { m_GoldenImage = settings; }
+
+        // Vertices stored as shaderio::eVertexQuantized (the default) or as in the glTF, to call before onAttach
+        void setQuantizeVertices(bool quantize) { m_QuantizeVertices = quantize; }
+
+        // Triangles and vertices reordered at import (the default, see optimizeGltfMeshes) or as in the glTF, to call before onAttach
+        void setOptimizeMeshes(bool optimize) { m_OptimizeMeshes = optimize; }
+
+        // Largest error of the levels of detail on the screen, in pixels (1 by default), to call before onAttach.
+        // 0 keeps the full resolution, the levels are then only built for the shadow rays.
+        void setLodThreshold(float pixels) { m_LodThreshold = pixels; }
+
+        // Level of detail traced by the shadow rays, 0 (the default) traces the full resolution, to call before onAttach.
+        // Clamped to the levels of each mesh. The coarse surface can shadow the full one by up to the error of the level.
+        void setShadowRayLod(uint32_t level) { m_ShadowRayLod = std::min(level, uint32_t(MESH_LOD_MAX_COUNT - 1)); }
+
+        // Meshlets drawn by the task and mesh shaders, when `device_support` (VK_EXT_mesh_shader enabled) and `use`, to call before onAttach.
+        // They replace the vertex shader path, with its Hi-Z occlusion culling and parallel recording, so it is off by default.
+        void setMeshShaders(bool device_support, bool use) {
+            m_MeshShaderSupport = device_support;
+            m_UseMeshShaders    = device_support && use;
+        }
+
         //--------------------------------------------------------------------------------------------------
         // Converting a PrimitiveMesh as input for BLAS
+        // Quantized positions need `transform_address`, the VkTransformMatrixKHR from the snorm16 space to the mesh space
+        // `lod` is the level of detail of the triangles, see GltfMesh::lods
         //
         static void primitiveToGeometry(const shaderio::GltfMesh&                 gltf_mesh,
+                                        uint32_t                                  lod,
+                                        VkDeviceAddress                           transform_address,
                                         VkAccelerationStructureGeometryKHR&       geometry,
                                         VkAccelerationStructureBuildRangeInfoKHR& range_info) {
             const shaderio::TriangleMesh triMesh        = gltf_mesh.triMesh;
-            const auto                   triangle_count = static_cast<uint32_t>(triMesh.indices.count / 3U);
+            const shaderio::BufferView   indices        = meshLodIndices(gltf_mesh, lod);
+            const auto                   triangle_count = static_cast<uint32_t>(indices.count / 3U);
+            const bool                   quantized      = gltf_mesh.vertexFormat == shaderio::eVertexQuantized;
 
             // Describe buffer as array of VertexObj.
             VkAccelerationStructureGeometryTrianglesDataKHR triangles{
-                .sType        = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR,
-                .vertexFormat = VK_FORMAT_R32G32B32_SFLOAT, // vec3 vertex position data
-                .vertexData   = { .deviceAddress = VkDeviceAddress(gltf_mesh.gltfBuffer) + triMesh.positions.offset },
-                .vertexStride = triMesh.positions.byteStride,
-                .maxVertex    = triMesh.positions.count - 1,
-                .indexType    = VkIndexType(gltf_mesh.indexType), // Index type (VK_INDEX_TYPE_UINT16 or VK_INDEX_TYPE_UINT32)
-                .indexData    = { .deviceAddress = VkDeviceAddress(gltf_mesh.gltfBuffer) + triMesh.indices.offset },
+                .sType         = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR,
+                .vertexFormat  = quantized ? VK_FORMAT_R16G16B16A16_SNORM : VK_FORMAT_R32G32B32_SFLOAT, // vec3 vertex position data, w is ignored
+                .vertexData    = { .deviceAddress = VkDeviceAddress(gltf_mesh.gltfBuffer) + triMesh.positions.offset },
+                .vertexStride  = triMesh.positions.byteStride,
+                .maxVertex     = triMesh.positions.count - 1,
+                .indexType     = VkIndexType(gltf_mesh.indexType), // Index type (VK_INDEX_TYPE_UINT16 or VK_INDEX_TYPE_UINT32)
+                .indexData     = { .deviceAddress = VkDeviceAddress(gltf_mesh.gltfBuffer) + indices.offset },
+                .transformData = { .deviceAddress = quantized ? transform_address : 0 },
             };
+            assert((!quantized || transform_address != 0) && "Quantized positions need their transform");
 
             // Identify the above data as containing opaque triangles.
             geometry = VkAccelerationStructureGeometryKHR{
@@ -631,156 +1156,308 @@ namespace vk_test {
             range_info = VkAccelerationStructureBuildRangeInfoKHR{ .primitiveCount = triangle_count };
         }
 
-        //--------------------------------------------------------------------------------------------------
-        // Generic function to create an acceleration structure (BLAS or TLAS)
-        // Note: This function creates and destroys a scratch buffer for each call.
-        // Not optimal but easier to read and understand. See Helper function for a better approach.
-        void createAccelerationStructure(VkAccelerationStructureTypeKHR            as_type,             // The type of acceleration structure (BLAS or TLAS)
-                                         AccelerationStructure&                    accel_struct,        // The acceleration structure to create
-                                         VkAccelerationStructureGeometryKHR&       as_geometry,         // The geometry to build the acceleration structure from
-                                         VkAccelerationStructureBuildRangeInfoKHR& as_build_range_info, // The range info for building the acceleration structure
-                                         VkBuildAccelerationStructureFlagsKHR      flags                // Build flags (e.g. prefer fast trace)
-        ) {
+        //---------------------------------------------------------------------------------------------------------------
+        // Create bottom-level acceleration structures
+        // The BLAS are built in chunks sharing one scratch buffer (one submit per chunk),
+        // and each chunk is compacted right after its build.
+        void createBottomLevelAS() {
+            SCOPED_TIMER(__FUNCTION__);
+
             VkDevice device = m_App->getDevice();
 
-            // Helper function to align a value to a given alignment
-            auto align_up = [](auto value, size_t alignment) noexcept { return ((value + alignment - 1) & ~(alignment - 1)); };
-
-            // Fill the build information with the current information, the rest is filled later (scratch buffer and destination AS)
-            VkAccelerationStructureBuildGeometryInfoKHR as_build_info{
-                .sType         = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR,
-                .type          = as_type,                                        // The type of acceleration structure (BLAS or TLAS)
-                .flags         = flags,                                          // Build flags (e.g. prefer fast trace)
-                .mode          = VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR, // Build mode vs update
-                .geometryCount = 1,                                              // Deal with one geometry at a time
-                .pGeometries   = &as_geometry,                                   // The geometry to build the acceleration structure from
-            };
+            // Maximum scratch memory used at once, bigger meshes still get the space they need
+            const VkDeviceSize scratch_budget    = 256ULL << 20;
+            const uint32_t     scratch_alignment = m_AsProperties.minAccelerationStructureScratchOffsetAlignment;
+
+            // Quantized positions are brought back to the mesh space by the build, from the bounds of the mesh
+            std::vector<VkTransformMatrixKHR> dequantize_transforms(m_SceneResource.meshes.size(), toTransformMatrixKHR(glm::mat4(1)));
+            for (size_t i = 0; i < m_SceneResource.meshes.size(); i++) {
+                const shaderio::GltfMesh& mesh = m_SceneResource.meshes[i];
+                if (mesh.vertexFormat == shaderio::eVertexQuantized) {
+                    dequantize_transforms[i] = toTransformMatrixKHR(glm::scale(glm::translate(glm::mat4(1), mesh.positionCenter), mesh.positionHalfExtent));
+                }
+            }
+            Buffer transforms_buffer;
+            m_Allocator.createBuffer(transforms_buffer,
+                                     std::span(dequantize_transforms).size_bytes(),
+                                     VK_BUFFER_USAGE_2_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR,
+                                     VMA_MEMORY_USAGE_AUTO_PREFER_HOST,
+                                     VMA_ALLOCATION_CREATE_MAPPED_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT);
+            memcpy(transforms_buffer.mapping, dequantize_transforms.data(), std::span(dequantize_transforms).size_bytes());
+            m_Allocator.flushBuffer(transforms_buffer);
+
+            // One BLAS per primitive, then one per primitive having a level for the shadow rays (see m_ShadowBlas)
+            const uint32_t                             mesh_count = uint32_t(m_SceneResource.meshes.size());
+            std::vector<std::pair<uint32_t, uint32_t>> blas_geometries; // Mesh and level of detail
+            for (uint32_t mesh_id = 0; mesh_id < mesh_count; mesh_id++) {
+                blas_geometries.emplace_back(mesh_id, 0);
+            }
+            m_ShadowBlas.assign(mesh_count, ~0U);
+            for (uint32_t mesh_id = 0; mesh_id < mesh_count; mesh_id++) {
+                const shaderio::GltfMesh& mesh = m_SceneResource.meshes[mesh_id];
+                if (m_ShadowRayLod > 0 && mesh.lodCount > 1) {
+                    m_ShadowBlas[mesh_id] = uint32_t(blas_geometries.size());
+                    blas_geometries.emplace_back(mesh_id, std::min(m_ShadowRayLod, mesh.lodCount - 1));
+                }
+            }
+
+            // Prepare geometry information for all of them
+            std::vector<AccelerationStructureBuildData> blas_build_data(blas_geometries.size());
+            m_BlasAccel.resize(blas_geometries.size());
+            for (uint32_t blas_id = 0; blas_id < blas_geometries.size(); blas_id++) {
+                VkAccelerationStructureGeometryKHR       as_geometry{};
+                VkAccelerationStructureBuildRangeInfoKHR as_build_range_info{};
 
-            // One geometry at a time (could be multiple)
-            std::vector<uint32_t> max_prim_count(1);
-            max_prim_count[0] = as_build_range_info.primitiveCount;
+                // Convert the primitive information to acceleration structure geometry
+                const auto [mesh_id, lod] = blas_geometries[blas_id];
+                primitiveToGeometry(m_SceneResource.meshes[mesh_id], lod, transforms_buffer.address + mesh_id * sizeof(VkTransformMatrixKHR), as_geometry, as_build_range_info);
 
-            // Find the size of the acceleration structure and the scratch buffer
-            VkAccelerationStructureBuildSizesInfoKHR as_build_size{ .sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_SIZES_INFO_KHR };
-            vkGetAccelerationStructureBuildSizesKHR(device, VK_ACCELERATION_STRUCTURE_BUILD_TYPE_DEVICE_KHR, &as_build_info, max_prim_count.data(), &as_build_size);
+                blas_build_data[blas_id].as_type = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR;
+                blas_build_data[blas_id].addGeometry(as_geometry, as_build_range_info);
+                blas_build_data[blas_id].finalizeGeometry(device, VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR | VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR);
+            }
 
-            // Make sure the scratch buffer is properly aligned
-            VkDeviceSize scratch_size = align_up(as_build_size.buildScratchSize, m_AsProperties.minAccelerationStructureScratchOffsetAlignment);
+            AccelerationStructureBuilder blas_builder;
+            blas_builder.init(&m_Allocator);
 
-            // Create the scratch buffer to store the temporary data for the build
-            Buffer scratch_buffer;
+            // Single scratch buffer, reused by every chunk
+            AccelerationStructureBuilder::ScratchSizeInfo scratch_size = blas_builder.getScratchSize(scratch_budget, blas_build_data, scratch_alignment);
+            Buffer                                        scratch_buffer;
             m_Allocator.createBuffer(
                 scratch_buffer,
-                scratch_size,
+                scratch_size.total_scratch,
                 VK_BUFFER_USAGE_2_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_2_SHADER_DEVICE_ADDRESS_BIT | VK_BUFFER_USAGE_2_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR,
                 VMA_MEMORY_USAGE_AUTO,
                 {}, // Flags
-                m_AsProperties.minAccelerationStructureScratchOffsetAlignment);
-
-            // Create the acceleration structure
-            VkAccelerationStructureCreateInfoKHR create_info{
-                .sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR,
-                .size  = as_build_size.accelerationStructureSize, // The size of the acceleration structure
-                .type  = as_type,                                 // The type of acceleration structure (BLAS or TLAS)
-            };
-            m_Allocator.createAcceleration(accel_struct, create_info);
-
-            // Build the acceleration structure
-            {
-                VkCommandBuffer cmd = m_App->createTempCmdBuffer();
-
-                // Fill with new information for the build,scratch buffer and destination AS
-                as_build_info.dstAccelerationStructure  = accel_struct.accel;
-                as_build_info.scratchData.deviceAddress = scratch_buffer.address;
-
-                VkAccelerationStructureBuildRangeInfoKHR* p_build_range_info = &as_build_range_info;
-                vkCmdBuildAccelerationStructuresKHR(cmd, 1, &as_build_info, &p_build_range_info);
-
-                m_App->submitAndWaitTempCmdBuffer(cmd);
+                scratch_alignment);
+
+            VkResult result = VK_INCOMPLETE;
+            while (result == VK_INCOMPLETE) {
+                // Build as many BLAS as the scratch buffer allows
+                VkCommandBuffer cmd = beginTempCmdBuffer();
+                result              = blas_builder.cmdCreateBlas(cmd, blas_build_data, m_BlasAccel, scratch_buffer.address, scratch_buffer.bufferSize, scratch_alignment);
+                submitTempCmdBuffer(cmd);
+
+                // Copy them to their compacted size, then release the originals
+                cmd = beginTempCmdBuffer();
+                blas_builder.cmdCompactBlas(cmd, blas_build_data, m_BlasAccel);
+                submitTempCmdBuffer(cmd);
+                blas_builder.destroyNonCompactedBlas();
             }
-            // Cleanup the scratch buffer
-            m_Allocator.destroyBuffer(scratch_buffer);
-        }
-
-        //---------------------------------------------------------------------------------------------------------------
-        // Create bottom-level acceleration structures
-        void createBottomLevelAS() {
-            SCOPED_TIMER(__FUNCTION__);
-
-            // Prepare geometry information for all meshes
-            m_BlasAccel.resize(m_SceneResource.meshes.size());
+            assert(result == VK_SUCCESS);
 
-            // One BLAS per primitive
-            for (uint32_t blas_id = 0; blas_id < m_SceneResource.meshes.size(); blas_id++) {
-                VkAccelerationStructureGeometryKHR       as_geometry{};
-                VkAccelerationStructureBuildRangeInfoKHR as_build_range_info{};
-
-                // Convert the primitive information to acceleration structure geometry
-                primitiveToGeometry(m_SceneResource.meshes[blas_id], as_geometry, as_build_range_info);
+            const AccelerationStructureBuilder::Stats& stats = blas_builder.getStatistics();
+            VK_TEST_SAY("BLAS : " << m_BlasAccel.size() << " in " << stats.num_builds << " submits, " << stats.total_original_size / 1024 << " KB -> "
+                                  << stats.total_compact_size / 1024 << " KB compacted");
 
-                createAccelerationStructure(VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR, m_BlasAccel[blas_id], as_geometry, as_build_range_info, VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR);
-            }
+            m_Allocator.destroyBuffer(scratch_buffer);
+            m_Allocator.destroyBuffer(transforms_buffer);
+            blas_builder.deinit();
         }
 
         //--------------------------------------------------------------------------------------------------
         // Create the top level acceleration structures, referencing all BLAS
+        // The instance buffer, the build data and the scratch buffer are kept, so that
+        // moving instances only requires an in-place refit (see updateTopLevelAS).
         //
         void createTopLevelAS() {
             SCOPED_TIMER(__FUNCTION__);
 
-            // VkTransformMatrixKHR is row-major 3x4, glm::mat4 is column-major; transpose before memcpy.
-            auto to_transform_matrix_khr = [](const glm::mat4& m) {
-                VkTransformMatrixKHR t;
-                memcpy(&t, glm::value_ptr(glm::transpose(m)), sizeof(t));
-                return t;
-            };
+            VkDevice device = m_App->getDevice();
 
-            // First create the instance data for the TLAS
-            std::vector<VkAccelerationStructureInstanceKHR> tlas_instances;
-            tlas_instances.reserve(m_SceneResource.instances.size());
+            // First create the instance data for the TLAS.
+            // The instances with a shadow BLAS are only seen by the primary rays, their copy on the shadow BLAS follows all the instances.
+            m_TlasInstances.clear();
+            m_TlasInstances.reserve(m_SceneResource.instances.size());
             for (const shaderio::GltfInstance& instance : m_SceneResource.instances) {
                 VkAccelerationStructureInstanceKHR as_instance{};
-                as_instance.transform                              = to_transform_matrix_khr(instance.transform);       // Position of the instance
                 as_instance.instanceCustomIndex                    = instance.meshIndex;                                // gl_InstanceCustomIndexEXT
                 as_instance.accelerationStructureReference         = m_BlasAccel[instance.meshIndex].address;           // Address of the BLAS
                 as_instance.instanceShaderBindingTableRecordOffset = 0;                                                 // We will use the same hit group for all objects
                 as_instance.flags                                  = VK_GEOMETRY_INSTANCE_TRIANGLE_CULL_DISABLE_BIT_NV; // No culling - double sided
-                as_instance.mask                                   = 0xFF;
-                tlas_instances.emplace_back(as_instance);
+                as_instance.mask                                   = m_ShadowBlas[instance.meshIndex] != ~0U ? TLAS_MASK_PRIMARY : 0xFF;
+                m_TlasInstances.emplace_back(as_instance);
             }
+            // Position of the instances, all the matrices at once
+            if (!m_TlasInstances.empty()) {
+                toTransformMatricesKHR(&m_SceneResource.instances[0].transform, sizeof(shaderio::GltfInstance), &m_TlasInstances[0].transform, sizeof(VkAccelerationStructureInstanceKHR), m_TlasInstances.size());
+            }
+            m_ShadowTlasInstances.assign(m_SceneResource.instances.size(), ~0U);
+            for (uint32_t instance_id = 0; instance_id < m_SceneResource.instances.size(); instance_id++) {
+                const uint32_t shadow_blas = m_ShadowBlas[m_SceneResource.instances[instance_id].meshIndex];
+                if (shadow_blas != ~0U) {
+                    VkAccelerationStructureInstanceKHR as_instance = m_TlasInstances[instance_id];
+                    as_instance.accelerationStructureReference     = m_BlasAccel[shadow_blas].address;
+                    as_instance.mask                               = TLAS_MASK_SHADOW;
+                    m_ShadowTlasInstances[instance_id]             = uint32_t(m_TlasInstances.size());
+                    m_TlasInstances.emplace_back(as_instance);
+                }
+            }
+            m_InstanceDirtyFlags.assign(m_SceneResource.instances.size(), 0);
+            m_DirtyInstances.clear();
+
+            // Persistent instance buffer, updated in place when instances move
+            m_Allocator.createBuffer(m_TlasInstancesBuffer,
+                                     std::span<VkAccelerationStructureInstanceKHR const>(m_TlasInstances).size_bytes(),
+                                     VK_BUFFER_USAGE_2_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR | VK_BUFFER_USAGE_2_SHADER_DEVICE_ADDRESS_BIT);
+
+            // Convert the instance information to acceleration structure geometry, similar to primitiveToGeometry()
+            VkAccelerationStructureGeometryInstancesDataKHR geometry_instances{ .sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR,
+                                                                                .data  = { .deviceAddress = m_TlasInstancesBuffer.address } };
+            VkAccelerationStructureGeometryKHR              as_geometry{ .sType        = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR,
+                                                                         .geometryType = VK_GEOMETRY_TYPE_INSTANCES_KHR,
+                                                                         .geometry     = { .instances = geometry_instances } };
+            VkAccelerationStructureBuildRangeInfoKHR        as_build_range_info{ .primitiveCount = static_cast<uint32_t>(m_TlasInstances.size()) };
+
+            m_TlasBuildData         = {};
+            m_TlasBuildData.as_type = VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR;
+            m_TlasBuildData.addGeometry(as_geometry, as_build_range_info);
+            m_TlasBuildData.finalizeGeometry(device, VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR | VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR);
+
+            m_Allocator.createAcceleration(m_TlasAccel, m_TlasBuildData.makeCreateInfo());
+
+            // The scratch buffer is shared by the initial build and all refits
+            const VkDeviceSize scratch_size = std::max(m_TlasBuildData.size_info.buildScratchSize, m_TlasBuildData.size_info.updateScratchSize);
+            m_Allocator.createBuffer(
+                m_TlasScratchBuffer,
+                scratch_size,
+                VK_BUFFER_USAGE_2_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_2_SHADER_DEVICE_ADDRESS_BIT | VK_BUFFER_USAGE_2_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR,
+                VMA_MEMORY_USAGE_AUTO,
+                {}, // Flags
+                m_AsProperties.minAccelerationStructureScratchOffsetAlignment);
 
-            // Then create the buffer with the instance data
-            Buffer tlas_instances_buffer;
+            // Upload the instances on the transfer queue, and build the TLAS on the graphics queue once acquired
             {
-                VkCommandBuffer cmd = m_App->createTempCmdBuffer();
-
-                // Create the instances buffer and upload the instance data
-                m_Allocator.createBuffer(
-                    tlas_instances_buffer,
-                    std::span<VkAccelerationStructureInstanceKHR const>(tlas_instances).size_bytes(),
-                    VK_BUFFER_USAGE_2_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR | VK_BUFFER_USAGE_2_SHADER_DEVICE_ADDRESS_BIT);
-                m_StagingUploader.appendBuffer(tlas_instances_buffer, 0, std::span<VkAccelerationStructureInstanceKHR const>(tlas_instances));
-                m_StagingUploader.cmdUploadAppended(cmd);
-                m_App->submitAndWaitTempCmdBuffer(cmd);
+                VkCommandBuffer upload_cmd = m_UploadScheduler.beginUpload();
+                m_StagingUploader.beginTransferOnly();
+                m_StagingUploader.appendBuffer(m_TlasInstancesBuffer,
+                                               0,
+                                               std::span<VkAccelerationStructureInstanceKHR const>(m_TlasInstances),
+                                               m_UploadScheduler.getUploadSemaphoreState());
+                m_StagingUploader.cmdUploadAppended(upload_cmd);
+                m_UploadScheduler.cmdReleaseBuffer(upload_cmd, m_TlasInstancesBuffer);
+                m_UploadScheduler.submitUpload(upload_cmd);
+
+                VkCommandBuffer cmd = beginTempCmdBuffer();
+                m_TlasBuildData.cmdBuildAccelerationStructure(cmd, m_TlasAccel.accel, m_TlasScratchBuffer.address);
+                submitTempCmdBuffer(cmd);
             }
+            m_StagingUploader.releaseStaging();
+        }
 
-            // Then create the TLAS geometry
-            {
-                VkAccelerationStructureGeometryKHR       as_geometry{};
-                VkAccelerationStructureBuildRangeInfoKHR as_build_range_info{};
+        //--------------------------------------------------------------------------------------------------
+        // Visible and culled instances of the raster path, a few frames late (all zero with the CPU draw loop)
+        //
+        const shaderio::CullingStats& getCullingStats() const { return m_GpuDrawBuilder.getCullingStats(); }
 
-                // Convert the instance information to acceleration structure geometry, similar to primitiveToGeometry()
-                VkAccelerationStructureGeometryInstancesDataKHR geometry_instances{ .sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR,
-                                                                                    .data  = { .deviceAddress = tlas_instances_buffer.address } };
-                as_geometry         = { .sType        = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR,
-                                        .geometryType = VK_GEOMETRY_TYPE_INSTANCES_KHR,
-                                        .geometry     = { .instances = geometry_instances } };
-                as_build_range_info = { .primitiveCount = static_cast<uint32_t>(m_SceneResource.instances.size()) };
+        //--------------------------------------------------------------------------------------------------
+        // Change the transform of an instance, used by both the rasterizer and the TLAS.
+        // Only the changed entries are uploaded, and the TLAS is refit, at the next frame.
+        //
+        void setInstanceTransform(uint32_t instance_id, const glm::mat4& transform) {
+            m_SceneResource.instances[instance_id].transform = transform;
+            m_TlasInstances[instance_id].transform           = toTransformMatrixKHR(transform);
+            m_NormalMatrices[instance_id]                    = toNormalMatrix(transform);
+            if (m_ShadowTlasInstances[instance_id] != ~0U) {
+                m_TlasInstances[m_ShadowTlasInstances[instance_id]].transform = m_TlasInstances[instance_id].transform;
+            }
 
-                createAccelerationStructure(VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR, m_TlasAccel, as_geometry, as_build_range_info, VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR);
+            // World bounds for the culling
+            const Bbox& mesh_bounds = m_SceneResource.mesh_bounds[m_SceneResource.instances[instance_id].meshIndex];
+            if (!mesh_bounds.isEmpty()) {
+                m_SceneResource.instance_bounds[instance_id] = mesh_bounds.transform(transform);
             }
 
-            m_Allocator.destroyBuffer(tlas_instances_buffer); // Cleanup
+            if (m_InstanceDirtyFlags[instance_id] == 0) {
+                m_InstanceDirtyFlags[instance_id] = 1;
+                m_DirtyInstances.push_back(instance_id);
+            }
+        }
+
+        //--------------------------------------------------------------------------------------------------
+        // Upload the instances changed since the last frame and refit the TLAS, in the frame command buffer.
+        // The data is written with vkCmdUpdateBuffer, so it is ordered with the frames still in flight:
+        // no staging buffer to manage and no risk of changing what a previous frame is reading.
+        //
+        void updateTopLevelAS(VkCommandBuffer cmd) {
+            if (m_DirtyInstances.empty()) {
+                return;
+            }
+
+            // Previous frames must be done reading the instances and the TLAS
+            cmdMemoryBarrier(cmd,
+                             VK_PIPELINE_STAGE_2_RAY_TRACING_SHADER_BIT_KHR | VK_PIPELINE_STAGE_2_ALL_GRAPHICS_BIT | VK_PIPELINE_STAGE_2_ACCELERATION_STRUCTURE_BUILD_BIT_KHR | VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                             VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+                             VK_ACCESS_2_SHADER_READ_BIT | VK_ACCESS_2_ACCELERATION_STRUCTURE_READ_BIT_KHR,
+                             VK_ACCESS_2_TRANSFER_WRITE_BIT);
+
+            // Upload contiguous runs of dirty instances, vkCmdUpdateBuffer is limited to 65536 bytes per call
+            constexpr uint32_t max_run = 65536 / std::max(sizeof(VkAccelerationStructureInstanceKHR), sizeof(shaderio::GltfInstance));
+            std::ranges::sort(m_DirtyInstances);
+            for (size_t i = 0; i < m_DirtyInstances.size();) {
+                const uint32_t first = m_DirtyInstances[i];
+                uint32_t       count = 1;
+                while (i + count < m_DirtyInstances.size() && m_DirtyInstances[i + count] == first + count && count < max_run) {
+                    count++;
+                }
+                i += count;
+
+                vkCmdUpdateBuffer(cmd,
+                                  m_TlasInstancesBuffer.buffer,
+                                  first * sizeof(VkAccelerationStructureInstanceKHR),
+                                  count * sizeof(VkAccelerationStructureInstanceKHR),
+                                  &m_TlasInstances[first]);
+                vkCmdUpdateBuffer(cmd,
+                                  m_SceneResource.b_instances.buffer,
+                                  first * sizeof(shaderio::GltfInstance),
+                                  count * sizeof(shaderio::GltfInstance),
+                                  &m_SceneResource.instances[first]);
+                vkCmdUpdateBuffer(cmd, m_NormalMatricesBuffer.buffer, first * sizeof(glm::mat4), count * sizeof(glm::mat4), &m_NormalMatrices[first]);
+                if (m_UseGpuDraws) {
+                    m_GpuDrawBuilder.cmdUpdateInstanceBounds(cmd, m_SceneResource, first, count);
+                }
+            }
+            for (uint32_t instance_id : m_DirtyInstances) {
+                m_InstanceDirtyFlags[instance_id] = 0;
+
+                // The copy on the shadow BLAS, one by one as they are not contiguous
+                const uint32_t shadow_instance = m_ShadowTlasInstances[instance_id];
+                if (shadow_instance != ~0U) {
+                    vkCmdUpdateBuffer(cmd,
+                                      m_TlasInstancesBuffer.buffer,
+                                      shadow_instance * sizeof(VkAccelerationStructureInstanceKHR),
+                                      sizeof(VkAccelerationStructureInstanceKHR),
+                                      &m_TlasInstances[shadow_instance]);
+                }
+            }
+            m_DirtyInstances.clear();
+
+            // The instances and normal matrices are read by the ray tracing shaders, the raster and the GPU culling
+            cmdMemoryBarrier(cmd,
+                             VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+                             VK_PIPELINE_STAGE_2_ACCELERATION_STRUCTURE_BUILD_BIT_KHR | VK_PIPELINE_STAGE_2_RAY_TRACING_SHADER_BIT_KHR | VK_PIPELINE_STAGE_2_ALL_GRAPHICS_BIT
+                                 | VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                             VK_ACCESS_2_TRANSFER_WRITE_BIT,
+                             VK_ACCESS_2_ACCELERATION_STRUCTURE_READ_BIT_KHR | VK_ACCESS_2_SHADER_READ_BIT);
+
+            // Refit: the topology is unchanged, only the bounds are updated
+            m_TlasBuildData.cmdUpdateAccelerationStructure(cmd, m_TlasAccel.accel, m_TlasScratchBuffer.address);
+
+            cmdMemoryBarrier(cmd,
+                             VK_PIPELINE_STAGE_2_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
+                             VK_PIPELINE_STAGE_2_RAY_TRACING_SHADER_BIT_KHR,
+                             VK_ACCESS_2_ACCELERATION_STRUCTURE_WRITE_BIT_KHR,
+                             VK_ACCESS_2_ACCELERATION_STRUCTURE_READ_BIT_KHR);
+        }
+
+        // Inverse transpose of the upper 3x3, stored in a mat4 to match the shader array stride
+        static glm::mat4 toNormalMatrix(const glm::mat4& m) { return glm::mat4(glm::transpose(glm::inverse(glm::mat3(m)))); }
+
+        // VkTransformMatrixKHR is row-major 3x4, glm::mat4 is column-major; transpose before memcpy.
+        static VkTransformMatrixKHR toTransformMatrixKHR(const glm::mat4& m) {
+            VkTransformMatrixKHR t;
+            memcpy(&t, glm::value_ptr(glm::transpose(m)), sizeof(t));
+            return t;
         }
 
         //--------------------------------------------------------------------------------------------------
@@ -825,8 +1502,8 @@ namespace vk_test {
                 s.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
             }
 
-            // Compile shader, fallback to pre-compiled
-            VkShaderModuleCreateInfo shader_code = compileSlangShader("rtbasic.slang", rtbasic_slang);
+            // Compile shader
+            VkShaderModuleCreateInfo shader_code = compileSlangShader("rtbasic.slang");
 
             stages[eRaygen].pNext     = &shader_code;
             stages[eRaygen].pName     = "rgenMain";
@@ -870,7 +1547,7 @@ namespace vk_test {
             pipeline_layout_create_info.pPushConstantRanges    = &push_constant;
 
             // Descriptor sets: one specific to ray tracing, and one shared with the rasterization pipeline
-            std::array<VkDescriptorSetLayout, 2> layouts = { { m_DescPack.getLayout(), m_RtDescPack.getLayout() } };
+            std::array<VkDescriptorSetLayout, 2> layouts = { { m_TextureTable.getLayout(), m_RtDescPack.getLayout() } };
             pipeline_layout_create_info.setLayoutCount   = uint32_t(layouts.size());
             pipeline_layout_create_info.pSetLayouts      = layouts.data();
             vkCreatePipelineLayout(m_App->getDevice(), &pipeline_layout_create_info, nullptr, &m_RtPipelineLayout);
@@ -966,7 +1643,7 @@ namespace vk_test {
                                                                       .layout             = m_RtPipelineLayout,
                                                                       .firstSet           = 0,
                                                                       .descriptorSetCount = 1,
-                                                                      .pDescriptorSets    = m_DescPack.getSetPtr() };
+                                                                      .pDescriptorSets    = m_TextureTable.getSetPtr() };
             vkCmdBindDescriptorSets2(cmd, &bind_descriptor_sets_info);
 
             // Push descriptor sets for ray tracing
@@ -979,6 +1656,7 @@ namespace vk_test {
             shaderio::TutoPushConstant push_values{
                 .sceneInfoAddress          = (shaderio::GltfSceneInfo*) m_SceneResource.b_scene_info.address,
                 .metallicRoughnessOverride = m_MetallicRoughnessOverride,
+                .textureFeedback           = (uint32_t*) m_TextureStreamer.getFeedbackBuffer().address,
             };
             const VkPushConstantsInfo push_info{ .sType      = VK_STRUCTURE_TYPE_PUSH_CONSTANTS_INFO,
                                                  .layout     = m_RtPipelineLayout,
@@ -997,28 +1675,61 @@ namespace vk_test {
 
     private:
         // Application and core components
-        Application*      m_App{};           // The application framework
-        ResourceAllocator m_Allocator;       // Resource allocator for Vulkan resources, used for buffers and images
-        StagingUploader   m_StagingUploader; // Utility to upload data to the GPU, used for staging buffers and images
-        SamplerPool       m_SamplerPool;     // Texture sampler pool, used to acquire texture samplers for images
-        GBuffer           m_GBuffers;        // The G-Buffer
-        SlangCompiler     m_SlangCompiler;   // The Slang compiler used to compile the shaders
+        Application*        m_App{};           // The application framework
+        ResourceAllocator   m_Allocator;       // Resource allocator for Vulkan resources, used for buffers and images
+        StagingRingUploader m_StagingUploader; // Utility to upload data to the GPU, staging space taken from a persistent ring buffer
+        UploadScheduler     m_UploadScheduler; // Submits the scene uploads to the transfer queue
+        ImageDecodePool     m_ImageDecodePool; // Decodes the scene images on worker threads
+        SamplerPool         m_SamplerPool;     // Texture sampler pool, used to acquire texture samplers for images
+        GBuffer             m_GBuffers;        // The G-Buffer
+        SlangCompiler       m_SlangCompiler;   // The Slang compiler used to compile the shaders
+        ShaderHotReload     m_ShaderHotReload; // Background recompilation of the graphics shaders
+        ImageReadback       m_ImageReadback;   // Copies of the rendered images to the host
+        GoldenImageSettings m_GoldenImage;     // Compared with the last frame of a headless run
+
+        VkSemaphoreSubmitInfo m_TempCmdUploadWait{}; // Wait of the temporary command buffer on the uploads, see beginTempCmdBuffer
 
         // Camera manipulator
         std::shared_ptr<vk_test::CameraManipulator> m_CameraManip{ std::make_shared<vk_test::CameraManipulator>() };
 
         // Pipeline
         GraphicsPipelineState m_DynamicPipeline;         // The dynamic pipeline state used to set the graphics pipeline state, like viewport, scissor, and depth test
-        DescriptorPack        m_DescPack;                // The descriptor bindings used to create the descriptor set layout and descriptor sets
+        BindlessTextureTable  m_TextureTable;            // The descriptor set of all textures, indexed by the materials
         VkPipelineLayout      m_GraphicPipelineLayout{}; // The pipeline layout use with graphics pipeline
 
         // Shaders
         VkShaderEXT m_VertexShader{};   // The vertex shader used to render the scene
         VkShaderEXT m_FragmentShader{}; // The fragment shader used to render the scene
 
+        // GPU-driven raster
+        GpuDrawBuilder         m_GpuDrawBuilder;       // Writes the indirect draws of all instances
+        bool                   m_UseGpuDraws = false;  // False when gpu_draws.slang could not be compiled
+        std::vector<glm::mat4> m_NormalMatrices;       // Per instance normal matrix
+        Buffer                 m_NormalMatricesBuffer; // GPU copy of m_NormalMatrices
+
+        // Mesh shader raster, see createMeshShaderDraws
+        bool               m_MeshShaderSupport  = false;                                             // VK_EXT_mesh_shader enabled, its stages must then be bound
+        bool               m_UseMeshShaders     = false;                                             // False when meshlets.slang could not be compiled
+        VkShaderStageFlags m_PushConstantStages = VK_SHADER_STAGE_ALL_GRAPHICS;                      // Of all the raster shader objects
+        VkShaderEXT        m_TaskShader{};                                                           // Culls the meshlets
+        VkShaderEXT        m_MeshShader{};                                                           // Draws the meshlets left
+        Buffer             m_MeshletTaskGroupsBuffer;                                                // shaderio::MeshletTaskGroup of all the instances
+        uint32_t           m_MeshletTaskGroupCount = 0;                                              // Task workgroups of a frame
+        uint32_t           m_MaxTaskWorkGroupCount = 0;                                              // Task workgroups of a vkCmdDrawMeshTasksEXT
+        uint32_t           m_MeshletCulling        = MESHLET_CULLING_FRUSTUM | MESHLET_CULLING_CONE; // shaderio::TutoPushConstant::meshletCulling
+
+        // Levels of detail, see GltfMesh::lods
+        float    m_LodThreshold = 1.0F; // Largest error on the screen in pixels, 0 for the full resolution
+        uint32_t m_ShadowRayLod = 0;    // Level traced by the shadow rays, 0 for the full resolution
+
         // Scene information buffer (UBO)
-        GltfSceneResource  m_SceneResource{}; // The GLTF scene resource, contains all the buffers and data for the scene
-        std::vector<Image> m_Textures;        // Textures used in the scene
+        std::filesystem::path m_SceneFile;               // Replaces the teapot when set
+        bool                  m_QuantizeVertices = true; // Import the meshes as shaderio::eVertexQuantized, when the BLAS can be built from them
+        bool                  m_OptimizeMeshes   = true; // Reorder the meshes for the vertex cache, the overdraw and the vertex fetch at import
+        GltfSceneResource     m_SceneResource{};         // The GLTF scene resource, contains all the buffers and data for the scene
+        std::vector<Image>    m_Textures;                // Textures used in the scene, loaded at once
+        TextureStreamer       m_TextureStreamer;         // Textures used in the scene, streamed mip by mip after m_Textures
+        std::vector<uint32_t> m_StreamedTextureMaterials; // Per streamed texture, the material sampling it (~0U for none), moved to its new slots
 
         SkySimple                m_SkySimple;                                   // Sky rendering
         Tonemapper               m_Tonemapper;                                  // Tonemapper for post-processing effects
@@ -1031,8 +1742,16 @@ namespace vk_test {
         VkPipelineLayout m_RtPipelineLayout{}; // Ray tracing pipeline layout
 
         // Acceleration Structure Components
-        std::vector<AccelerationStructure> m_BlasAccel;
-        AccelerationStructure              m_TlasAccel;
+        std::vector<AccelerationStructure>              m_BlasAccel;
+        AccelerationStructure                           m_TlasAccel;
+        AccelerationStructureBuildData                  m_TlasBuildData;       // Kept to refit the TLAS in place
+        std::vector<VkAccelerationStructureInstanceKHR> m_TlasInstances;       // CPU copy of the TLAS instance buffer
+        Buffer                                          m_TlasInstancesBuffer; // Persistent instance buffer, input of the build and refits
+        Buffer                                          m_TlasScratchBuffer;   // Scratch of the build and refits
+        std::vector<uint32_t>                           m_DirtyInstances;      // Instances changed since the last refit
+        std::vector<uint8_t>                            m_InstanceDirtyFlags;  // Per instance, avoids duplicates in m_DirtyInstances
+        std::vector<uint32_t>                           m_ShadowBlas;          // Per mesh, its BLAS for the shadow rays in m_BlasAccel, ~0U when it has none
+        std::vector<uint32_t>                           m_ShadowTlasInstances; // Per instance, its copy for the shadow rays in m_TlasInstances, ~0U when it has none
 
         // Direct SBT management
         Buffer                          m_SbtBuffer;        // Buffer for shader binding table
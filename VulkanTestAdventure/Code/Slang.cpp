@@ -24,16 +24,36 @@
 
 #include "pch.h"
 #include "slang.hpp"
+#include "hash_operations.hpp"
 
-vk_test::SlangCompiler::SlangCompiler() {
-    SlangGlobalSessionDesc desc{ .enableGLSL = true };
-    slang::createGlobalSession(&desc, m_GlobalSession.writeRef());
+#include <sstream>
+
+#if __has_include(<slang/slang-tag-version.h>)
+#include <slang/slang-tag-version.h>
+#endif
+
+// Version of the Slang headers the binary is built with, the key of the SPIR-V cache depends on it.
+// Without the tag, the build time of this file changes it at each build.
+#ifdef SLANG_TAG_VERSION
+static constexpr const char* SLANG_CACHE_VERSION = SLANG_TAG_VERSION;
+#else
+static constexpr const char* SLANG_CACHE_VERSION = __DATE__ " " __TIME__;
+#endif
+
+// The global session is only created for a compilation, a hit of the SPIR-V cache does not pay its start-up
+slang::IGlobalSession* vk_test::SlangCompiler::getGlobalSession() {
+    if (m_GlobalSession == nullptr) {
+        SlangGlobalSessionDesc desc{ .enableGLSL = true };
+        slang::createGlobalSession(&desc, m_GlobalSession.writeRef());
+    }
+    return m_GlobalSession.get();
 }
 
 void vk_test::SlangCompiler::defaultTarget() {
+    m_DefaultProfileName = "spirv_1_6+vulkan_1_4"; // Found when the session is created
     m_Targets.push_back({
         .format                      = SLANG_SPIRV,
-        .profile                     = m_GlobalSession->findProfile("spirv_1_6+vulkan_1_4"),
+        .profile                     = SLANG_PROFILE_UNKNOWN,
         .flags                       = SLANG_TARGET_FLAG_GENERATE_SPIRV_DIRECTLY,
         .forceGLSLScalarBufferLayout = true,
     });
@@ -62,14 +82,14 @@ void vk_test::SlangCompiler::clearSearchPaths() {
 
 const uint32_t* vk_test::SlangCompiler::getSpirv() const {
     if (m_Spirv == nullptr) {
-        return nullptr;
+        return m_CachedSpirv.empty() ? nullptr : m_CachedSpirv.data();
     }
     return reinterpret_cast<const uint32_t*>(m_Spirv->getBufferPointer());
 }
 
 size_t vk_test::SlangCompiler::getSpirvSize() const {
     if (m_Spirv == nullptr) {
-        return 0;
+        return m_CachedSpirv.size() * sizeof(uint32_t);
     }
     return m_Spirv->getBufferSize();
 }
@@ -95,8 +115,28 @@ bool vk_test::SlangCompiler::compileFile(const std::filesystem::path& filename)
         VK_TEST_SAY(m_LastDiagnosticMessage.c_str());
         return false;
     }
+
+    // Try the persistent cache first, Slang is not involved on a hit
+    std::filesystem::path cache_file;
+    if (!m_CacheDirectory.empty()) {
+        cache_file = m_CacheDirectory / source_file.filename().replace_extension(std::to_string(computeCacheKey(source_file)) + ".spv");
+        if (loadCachedSpirv(cache_file)) {
+            m_CacheHits++;
+            if (m_Callback) {
+                m_Callback(source_file, getSpirv(), getSpirvSize());
+            }
+            return true;
+        }
+        m_CacheMisses++;
+    }
+
     bool success = loadFromSourceString(vk_test::utf8FromPath(source_file.stem()), vk_test::loadFile(source_file));
     if (success) {
+        if (!cache_file.empty()) {
+            std::error_code ec;
+            std::filesystem::create_directories(m_CacheDirectory, ec);
+            writeCachedSpirv(cache_file);
+        }
         if (m_Callback) {
             m_Callback(source_file, getSpirv(), getSpirvSize());
         }
@@ -105,6 +145,169 @@ bool vk_test::SlangCompiler::compileFile(const std::filesystem::path& filename)
     return success;
 }
 
+// Collects the files reached through `#include "file"`, `import module;` and `__include module;`, recursively.
+// Slang maps `import a.b_c;` to "a/b-c.slang", both spellings are tried.
+// Names that cannot be resolved (e.g. built-in modules) are still returned so they take part in the hash.
+static void collectSlangDependencies(const std::filesystem::path&              file_path,
+                                     const std::vector<std::filesystem::path>& search_paths,
+                                     std::vector<std::filesystem::path>&       closure,
+                                     std::set<std::string>&                    unresolved) {
+    if (std::ranges::find(closure, file_path) != closure.end()) {
+        return;
+    }
+    closure.push_back(file_path);
+
+    auto resolve = [&](const std::string& name, bool is_module) -> std::filesystem::path {
+        std::vector<std::filesystem::path> candidates = { vk_test::pathFromUtf8(name) };
+        if (is_module && !vk_test::extensionMatches(candidates[0], ".slang")) {
+            std::string module_path = name;
+            std::ranges::replace(module_path, '.', '/');
+            candidates[0] = vk_test::pathFromUtf8(module_path + ".slang");
+            std::ranges::replace(module_path, '_', '-');
+            candidates.push_back(vk_test::pathFromUtf8(module_path + ".slang"));
+        }
+        for (const auto& candidate : candidates) {
+            if (std::filesystem::exists(file_path.parent_path() / candidate)) {
+                return file_path.parent_path() / candidate;
+            }
+            for (const auto& search_path : search_paths) {
+                if (std::filesystem::exists(search_path / candidate)) {
+                    return search_path / candidate;
+                }
+            }
+        }
+        return {};
+    };
+
+    std::istringstream stream(vk_test::loadFile(file_path));
+    std::string        line;
+    while (std::getline(stream, line)) {
+        const size_t first = line.find_first_not_of(" \t");
+        if (first == std::string::npos) {
+            continue;
+        }
+        std::string_view statement(line.c_str() + first);
+
+        std::string name;
+        const bool  is_module = !statement.starts_with("#include");
+        if (!is_module) {
+            const size_t open  = statement.find_first_of("\"<");
+            const size_t close = statement.find_first_of("\">", open + 1);
+            if (open == std::string_view::npos || close == std::string_view::npos) {
+                continue;
+            }
+            name = statement.substr(open + 1, close - open - 1);
+        }
+        else if (statement.starts_with("import ") || statement.starts_with("__include ")) {
+            statement.remove_prefix(statement.find(' ') + 1);
+            name = statement.substr(0, statement.find(';'));
+            std::erase_if(name, [](char c) { return c == ' ' || c == '\t' || c == '"' || c == '\r'; });
+        }
+        else {
+            continue;
+        }
+
+        const std::filesystem::path dependency = resolve(name, is_module);
+        if (dependency.empty()) {
+            unresolved.insert(name);
+        }
+        else {
+            collectSlangDependencies(std::filesystem::weakly_canonical(dependency), search_paths, closure, unresolved);
+        }
+    }
+}
+
+std::size_t vk_test::SlangCompiler::computeCacheKey(const std::filesystem::path& source_file) const {
+    auto str = [](const char* value) { return std::string(value != nullptr ? value : ""); };
+
+    std::size_t seed = 0;
+    hashCombine(seed, str(SLANG_CACHE_VERSION), m_DefaultProfileName);
+
+    for (const auto& target : m_Targets) {
+        hashCombine(seed, int(target.format), int(target.profile), uint32_t(target.flags), target.forceGLSLScalarBufferLayout);
+    }
+    for (const auto& option : m_Options) {
+        hashCombine(seed, int(option.name), int(option.value.kind), option.value.intValue0, option.value.intValue1,
+                    str(option.value.stringValue0), str(option.value.stringValue1));
+    }
+    for (const auto& macro : m_Macros) {
+        hashCombine(seed, str(macro.name), str(macro.value));
+    }
+    for (const auto& search_path : m_SearchPathsUtf8) {
+        hashCombine(seed, search_path);
+    }
+
+    // The source and everything it includes, by content
+    std::vector<std::filesystem::path> closure;
+    std::set<std::string>              unresolved;
+    collectSlangDependencies(std::filesystem::weakly_canonical(source_file), m_SearchPaths, closure, unresolved);
+    for (const auto& file_path : closure) {
+        const std::string content = vk_test::loadFile(file_path);
+        hashCombine(seed, vk_test::utf8FromPath(file_path.filename()));
+        seed = hashData(content.data(), content.size(), seed);
+    }
+    for (const auto& name : unresolved) {
+        hashCombine(seed, name);
+    }
+
+    return seed;
+}
+
+// Written to a temporary file first, then renamed: a crash or a concurrent run never leaves
+// a truncated module behind, which would pass the checks of loadCachedSpirv under the same key
+void vk_test::SlangCompiler::writeCachedSpirv(const std::filesystem::path& cache_file) const {
+    std::filesystem::path temp_path = cache_file;
+    temp_path += ".tmp";
+    {
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            VK_TEST_SAY("Failed to open file for writing : " << vk_test::utf8FromPath(temp_path).c_str());
+            return;
+        }
+        file.write(reinterpret_cast<const char*>(getSpirv()), std::streamsize(getSpirvSize()));
+        if (!file) {
+            VK_TEST_SAY("Failed to write SPIR-V data to file : " << vk_test::utf8FromPath(temp_path).c_str());
+            file.close();
+            std::error_code ec;
+            std::filesystem::remove(temp_path, ec);
+            return;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(temp_path, cache_file, ec);
+    if (ec) {
+        VK_TEST_SAY("Failed to write the SPIR-V cache : " << vk_test::utf8FromPath(cache_file).c_str() << " : " << ec.message().c_str());
+        std::filesystem::remove(temp_path, ec);
+    }
+}
+
+bool vk_test::SlangCompiler::loadCachedSpirv(const std::filesystem::path& cache_file) {
+    constexpr uint32_t spirv_magic = 0x07230203;
+
+    if (!std::filesystem::exists(cache_file)) {
+        return false;
+    }
+    const std::string content = vk_test::loadFile(cache_file);
+    if (content.size() < sizeof(uint32_t) || content.size() % sizeof(uint32_t) != 0) {
+        return false;
+    }
+
+    std::vector<uint32_t> spirv(content.size() / sizeof(uint32_t));
+    memcpy(spirv.data(), content.data(), content.size());
+    if (spirv[0] != spirv_magic) {
+        return false;
+    }
+
+    // Nothing from a previous Slang compilation is valid anymore
+    m_Spirv         = nullptr;
+    m_Module        = nullptr;
+    m_LinkedProgram = nullptr;
+    m_LastDiagnosticMessage.clear();
+    m_CachedSpirv = std::move(spirv);
+    return true;
+}
+
 void vk_test::SlangCompiler::logAndAppendDiagnostics(slang::IBlob* diagnostics) {
     if (diagnostics != nullptr) {
         const char* message = reinterpret_cast<const char*>(diagnostics->getBufferPointer());
@@ -123,6 +326,7 @@ bool vk_test::SlangCompiler::loadFromSourceString(const std::string& module_name
 
     // Clear any previous compilation
     m_Spirv = nullptr;
+    m_CachedSpirv.clear();
     m_LastDiagnosticMessage.clear();
 
     Slang::ComPtr<slang::IBlob> diagnostics;
@@ -168,9 +372,18 @@ bool vk_test::SlangCompiler::loadFromSourceString(const std::string& module_name
 void vk_test::SlangCompiler::createSession() {
     m_Session = {};
 
+    // The targets keep their unknown profile, it is part of the cache key
+    slang::IGlobalSession*         global_session = getGlobalSession();
+    std::vector<slang::TargetDesc> targets        = m_Targets;
+    for (slang::TargetDesc& target : targets) {
+        if (target.profile == SLANG_PROFILE_UNKNOWN && !m_DefaultProfileName.empty()) {
+            target.profile = global_session->findProfile(m_DefaultProfileName.c_str());
+        }
+    }
+
     slang::SessionDesc desc{
-        .targets                  = m_Targets.data(),
-        .targetCount              = SlangInt(m_Targets.size()),
+        .targets                  = targets.data(),
+        .targetCount              = SlangInt(targets.size()),
         .searchPaths              = m_SearchPathsUtf8Pointers.data(),
         .searchPathCount          = SlangInt(m_SearchPathsUtf8Pointers.size()),
         .preprocessorMacros       = m_Macros.data(),
@@ -179,7 +392,7 @@ void vk_test::SlangCompiler::createSession() {
         .compilerOptionEntries    = m_Options.data(),
         .compilerOptionEntryCount = uint32_t(m_Options.size()),
     };
-    m_GlobalSession->createSession(desc, m_Session.writeRef());
+    global_session->createSession(desc, m_Session.writeRef());
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -197,6 +410,9 @@ static void usage_SlangCompiler() {
                                { slang::CompilerOptionValueKind::Int, SLANG_DEBUG_INFO_LEVEL_MAXIMAL } });
     slang_compiler.addMacro({ "MY_DEFINE", "1" });
 
+    // Optional : keep the SPIR-V on disk, next launches skip Slang when nothing changed
+    slang_compiler.setCacheDirectory(vk_test::getExecutablePath() / "ShaderCache");
+
     // Compile a shader file
     bool success = slang_compiler.compileFile("shader.slang");
 
@@ -217,4 +433,6 @@ static void usage_SlangCompiler() {
             VK_TEST_SAY("Compilation succeeded with warnings : " << warning_messages.c_str());
         }
     }
+
+    VK_TEST_SAY("Shader cache hits : " << slang_compiler.getCacheHits() << ", misses : " << slang_compiler.getCacheMisses());
 }
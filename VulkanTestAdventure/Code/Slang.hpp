@@ -51,7 +51,7 @@ namespace vk_test {
     // A class responsible for compiling Slang source code.
     class SlangCompiler {
     public:
-        SlangCompiler();
+        SlangCompiler()  = default;
         ~SlangCompiler() = default;
 
         void defaultTarget();  // Default target is SPIR-V
@@ -98,11 +98,26 @@ namespace vk_test {
         // Multiple diagnostics are each separated by a single newline.
         const std::string& getLastDiagnosticMessage() const { return m_LastDiagnosticMessage; }
 
-    private:
-        void createSession();
-        void logAndAppendDiagnostics(slang::IBlob* diagnostic);
+        // Persistent SPIR-V cache used by compileFile(), disabled while the directory is empty.
+        // The key hashes the source and its transitive #include/import closure, the macros, targets, options,
+        // search paths and the Slang version. On a hit, the SPIR-V is read from disk without creating a Slang session,
+        // in that case getSlangProgram() and getSlangModule() return nullptr.
+        void                         setCacheDirectory(const std::filesystem::path& cache_directory) { m_CacheDirectory = cache_directory; }
+        const std::filesystem::path& getCacheDirectory() const { return m_CacheDirectory; }
+        uint32_t                     getCacheHits() const { return m_CacheHits; }
+        uint32_t                     getCacheMisses() const { return m_CacheMisses; }
+        void                         resetCacheStats() { m_CacheHits = m_CacheMisses = 0; }
 
-        Slang::ComPtr<slang::IGlobalSession>      m_GlobalSession;
+    private:
+        slang::IGlobalSession* getGlobalSession();
+        void                   createSession();
+        void                   logAndAppendDiagnostics(slang::IBlob* diagnostic);
+        std::size_t            computeCacheKey(const std::filesystem::path& source_file) const;
+        bool                   loadCachedSpirv(const std::filesystem::path& cache_file);
+        void                   writeCachedSpirv(const std::filesystem::path& cache_file) const;
+
+        Slang::ComPtr<slang::IGlobalSession>      m_GlobalSession; // Created by the first compilation
+        std::string                               m_DefaultProfileName;
         std::vector<slang::TargetDesc>            m_Targets;
         std::vector<slang::CompilerOptionEntry>   m_Options;
         std::vector<std::filesystem::path>        m_SearchPaths;
@@ -114,6 +129,11 @@ namespace vk_test {
         Slang::ComPtr<ISlangBlob>                 m_Spirv;
         std::vector<slang::PreprocessorMacroDesc> m_Macros;
 
+        std::filesystem::path m_CacheDirectory;  // Where the cached SPIR-V are stored
+        std::vector<uint32_t> m_CachedSpirv;     // SPIR-V of the last compilation, when it came from the cache
+        uint32_t              m_CacheHits   = 0; // Number of compileFile() served from the cache
+        uint32_t              m_CacheMisses = 0; // Number of compileFile() that had to invoke Slang
+
         std::function<void(const std::filesystem::path& source_file, const uint32_t* spirv_code, size_t spirv_size)> m_Callback;
 
         // Store the last diagnostic message
@@ -54,8 +54,9 @@ VkResult vk_test::Swapchain::InitializeResources(VkExtent2D& out_window_size, bo
     if (capabilities2.surfaceCapabilities.maxImageCount > 0) {
         m_MaxFramesInFlight = std::min(m_MaxFramesInFlight, capabilities2.surfaceCapabilities.maxImageCount);
     }
-    // Store the chosen image format
+    // Store the chosen image format and present mode
     m_ImageFormat = surface_format2.surfaceFormat.format;
+    m_PresentMode = present_mode;
 
     // Create the swapchain itself
     const VkSwapchainCreateInfoKHR swapchain_create_info{
@@ -270,6 +271,10 @@ VkPresentModeKHR vk_test::Swapchain::selectSwapPresentMode(const std::vector<VkP
         return VK_PRESENT_MODE_IMMEDIATE_KHR; // Best mode for low latency
     }
 
+    if (v_sync && m_PreferredVsyncOnMode == VK_PRESENT_MODE_FIFO_RELAXED_KHR) {
+        return VK_PRESENT_MODE_FIFO_KHR; // Closest to relaxed, still paced by the display
+    }
+
     if (mailbox_supported) {
         return VK_PRESENT_MODE_MAILBOX_KHR;
     }
@@ -57,6 +57,12 @@ namespace vk_test {
         void requestRebuild() { m_NeedRebuild = true; }
         bool needRebuilding() const { return m_NeedRebuild; }
 
+        // Preferred mode for the given vSync state, used from the next (re)initialization of the resources
+        void setPreferredPresentMode(VkPresentModeKHR present_mode, bool v_sync) { (v_sync ? m_PreferredVsyncOnMode : m_PreferredVsyncOffMode) = present_mode; }
+
+        // The mode actually selected, see selectSwapPresentMode()
+        VkPresentModeKHR getPresentMode() const { return m_PresentMode; }
+
         VkImage     getImage() const { return m_Images[m_FrameImageIndex].image; }
         VkImageView getImageView() const { return m_Images[m_FrameImageIndex].image_view; }
         VkFormat    getImageFormat() const { return m_ImageFormat; }
@@ -90,9 +96,10 @@ namespace vk_test {
          * The `preferredVsyncOffMode` is used when vSync is disabled and the mode is supported.
          * Otherwise, from most preferred to least:
          *   1. IMMEDIATE mode, when vSync is disabled (tearing allowed), since it's lowest-latency.
-         *   2. MAILBOX mode, since it's the lowest-latency mode without tearing. Note that frame pacing is needed
+         *   2. FIFO mode, when FIFO_RELAXED was preferred, to keep the same pacing by the display.
+         *   3. MAILBOX mode, since it's the lowest-latency mode without tearing. Note that frame pacing is needed
                 when vSync is on.
-         *   3. FIFO mode, since all swapchains must support it.
+         *   4. FIFO mode, since all swapchains must support it.
         -*/
         VkPresentModeKHR selectSwapPresentMode(const std::vector<VkPresentModeKHR>& available_present_modes, bool v_sync = true);
 
@@ -116,6 +123,7 @@ namespace vk_test {
 
         VkPresentModeKHR m_PreferredVsyncOffMode = VK_PRESENT_MODE_IMMEDIATE_KHR; // used if available
         VkPresentModeKHR m_PreferredVsyncOnMode  = VK_PRESENT_MODE_FIFO_KHR;      // used if available
+        VkPresentModeKHR m_PresentMode           = VK_PRESENT_MODE_FIFO_KHR;      // the mode of the current swapchain
 
         // Triple buffering allows us to pipeline CPU and GPU work, which gives us
         // good throughput if their sum takes more than a frame.
@@ -1,5 +1,7 @@
 #include "pch.h"
 #include "VKTest_RenderMesh.h"
+#include "vertex_welder.hpp"
+#include "parallel_work.hpp"
 
 // NOLINTNEXTLINE(readability-identifier-naming)
 #define STB_IMAGE_IMPLEMENTATION
@@ -253,7 +255,7 @@ void VKTest::RenderMesh::loadModel() {
         throw std::runtime_error(err);
     }
 
-    std::unordered_map<Vertex, uint32_t> unique_vertices{};
+    std::vector<Vertex> corners;
 
     for (const auto& shape : shapes) {
         for (const auto& index : shape.mesh.indices) {
@@ -272,14 +274,19 @@ void VKTest::RenderMesh::loadModel() {
 
             vertex.color = { 1.0F, 1.0F, 1.0F };
 
-            if (!unique_vertices.contains(vertex)) {
-                unique_vertices[vertex] = static_cast<uint32_t>(m_Vertices.size());
-                m_Vertices.push_back(vertex);
-            }
-
-            m_Indices.push_back(unique_vertices[vertex]);
+            corners.push_back(vertex);
         }
     }
+
+    // One index per corner, into the unique vertices in the order of their first corner
+    vk_test::VertexWeldSettings weld_settings;
+    weld_settings.threadCount = vk_test::getThreadPoolSize();
+
+    m_Indices.resize(corners.size());
+    const uint32_t vertex_count = vk_test::weldVertices(corners.data(), corners.size(), sizeof(Vertex), m_Indices.data(), weld_settings);
+
+    m_Vertices.resize(vertex_count);
+    vk_test::compactWeldedVertices(corners.data(), corners.size(), sizeof(Vertex), m_Indices.data(), m_Vertices.data());
 }
 
 void VKTest::RenderMesh::createVertexBuffer() {
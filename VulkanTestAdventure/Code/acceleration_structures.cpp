@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2024-2025, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2024-2025, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+* Modified by Farrakh
+* 2025
+*/
+
+#include "pch.h"
+
+#include "acceleration_structures.hpp"
+#include "barriers.hpp"
+
+namespace vk_test {
+
+    static VkDeviceSize alignUp(VkDeviceSize value, VkDeviceSize alignment) {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    void AccelerationStructureBuildData::addGeometry(const VkAccelerationStructureGeometryKHR& geometry, const VkAccelerationStructureBuildRangeInfoKHR& range_info) {
+        as_geometry.push_back(geometry);
+        as_build_range_info.push_back(range_info);
+    }
+
+    VkAccelerationStructureBuildSizesInfoKHR AccelerationStructureBuildData::finalizeGeometry(VkDevice device, VkBuildAccelerationStructureFlagsKHR flags) {
+        assert(as_type != VK_ACCELERATION_STRUCTURE_TYPE_MAX_ENUM_KHR && "Acceleration structure type not set");
+        assert(!as_geometry.empty() && "No geometry added to the acceleration structure");
+
+        build_info.type                      = as_type;
+        build_info.flags                     = flags;
+        build_info.mode                      = VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR;
+        build_info.srcAccelerationStructure  = VK_NULL_HANDLE;
+        build_info.dstAccelerationStructure  = VK_NULL_HANDLE;
+        build_info.geometryCount             = static_cast<uint32_t>(as_geometry.size());
+        build_info.pGeometries               = as_geometry.data();
+        build_info.ppGeometries              = nullptr;
+        build_info.scratchData.deviceAddress = 0;
+
+        std::vector<uint32_t> max_prim_count(as_build_range_info.size());
+        for (size_t i = 0; i < as_build_range_info.size(); i++) {
+            max_prim_count[i] = as_build_range_info[i].primitiveCount;
+        }
+
+        vkGetAccelerationStructureBuildSizesKHR(device, VK_ACCELERATION_STRUCTURE_BUILD_TYPE_DEVICE_KHR, &build_info, max_prim_count.data(), &size_info);
+        return size_info;
+    }
+
+    VkAccelerationStructureCreateInfoKHR AccelerationStructureBuildData::makeCreateInfo() const {
+        assert(size_info.accelerationStructureSize > 0 && "Missing finalizeGeometry()");
+        return VkAccelerationStructureCreateInfoKHR{
+            .sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR,
+            .size  = size_info.accelerationStructureSize,
+            .type  = as_type,
+        };
+    }
+
+    void AccelerationStructureBuildData::cmdBuildAccelerationStructure(VkCommandBuffer cmd, VkAccelerationStructureKHR acceleration_structure, VkDeviceAddress scratch_address) {
+        assert(as_geometry.size() == as_build_range_info.size());
+
+        build_info.mode                      = VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR;
+        build_info.srcAccelerationStructure  = VK_NULL_HANDLE;
+        build_info.dstAccelerationStructure  = acceleration_structure;
+        build_info.scratchData.deviceAddress = scratch_address;
+        build_info.pGeometries               = as_geometry.data(); // The vector may have moved since finalizeGeometry
+
+        const VkAccelerationStructureBuildRangeInfoKHR* p_build_range_info = as_build_range_info.data();
+        vkCmdBuildAccelerationStructuresKHR(cmd, 1, &build_info, &p_build_range_info);
+    }
+
+    void AccelerationStructureBuildData::cmdUpdateAccelerationStructure(VkCommandBuffer cmd, VkAccelerationStructureKHR acceleration_structure, VkDeviceAddress scratch_address) {
+        assert(as_geometry.size() == as_build_range_info.size());
+        assert((build_info.flags & VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR) && "Missing VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR");
+
+        build_info.mode                      = VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
+        build_info.srcAccelerationStructure  = acceleration_structure;
+        build_info.dstAccelerationStructure  = acceleration_structure;
+        build_info.scratchData.deviceAddress = scratch_address;
+        build_info.pGeometries               = as_geometry.data();
+
+        const VkAccelerationStructureBuildRangeInfoKHR* p_build_range_info = as_build_range_info.data();
+        vkCmdBuildAccelerationStructuresKHR(cmd, 1, &build_info, &p_build_range_info);
+    }
+
+    //-----------------------------------------------------------------------------
+
+    void AccelerationStructureBuilder::init(ResourceAllocator* resource_allocator) {
+        assert(m_ResourceAllocator == nullptr);
+        m_ResourceAllocator = resource_allocator;
+        m_CurrentBlasIdx    = 0;
+        m_Stats             = {};
+    }
+
+    void AccelerationStructureBuilder::deinit() {
+        if (m_ResourceAllocator == nullptr) {
+            return;
+        }
+        destroyNonCompactedBlas();
+        destroyQueryPool();
+        m_QueryBlasIndices.clear();
+        m_ResourceAllocator = nullptr;
+    }
+
+    AccelerationStructureBuilder::ScratchSizeInfo
+    AccelerationStructureBuilder::getScratchSize(VkDeviceSize hint_max_budget, std::span<const AccelerationStructureBuildData> blas_build_data, uint32_t min_alignment) const {
+        ScratchSizeInfo size_info{};
+        for (const AccelerationStructureBuildData& build_data : blas_build_data) {
+            const VkDeviceSize scratch_size = alignUp(build_data.size_info.buildScratchSize, min_alignment);
+            size_info.max_scratch           = std::max(size_info.max_scratch, scratch_size);
+            size_info.total_scratch += scratch_size;
+        }
+
+        // Never allocate more than needed to build everything at once, nor less than the biggest build
+        size_info.total_scratch = std::max(size_info.max_scratch, std::min(size_info.total_scratch, hint_max_budget));
+        return size_info;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Each BLAS of the chunk gets its own range of the scratch buffer, so all builds
+    // of the chunk can run concurrently on the GPU without barriers in between.
+    // The chunk ends when the scratch buffer is full.
+    //
+    VkResult AccelerationStructureBuilder::cmdCreateBlas(VkCommandBuffer                           cmd,
+                                                         std::span<AccelerationStructureBuildData> blas_build_data,
+                                                         std::span<AccelerationStructure>          blas_accel,
+                                                         VkDeviceAddress                           scratch_address,
+                                                         VkDeviceSize                              scratch_size,
+                                                         uint32_t                                  min_alignment) {
+        assert(m_ResourceAllocator && "Missing init()");
+        assert(blas_build_data.size() == blas_accel.size());
+        assert(m_QueryBlasIndices.empty() && "Missing cmdCompactBlas() for the previous chunk");
+
+        VkDevice device = m_ResourceAllocator->getDevice();
+
+        const auto                              num_blas     = static_cast<uint32_t>(blas_build_data.size());
+        const uint32_t                          first_blas   = m_CurrentBlasIdx;
+        VkDeviceSize                            scratch_used = 0;
+        std::vector<VkAccelerationStructureKHR> query_accel; // BLAS of this chunk to query the compacted size of
+
+        while (m_CurrentBlasIdx < num_blas) {
+            AccelerationStructureBuildData& build_data = blas_build_data[m_CurrentBlasIdx];
+            const VkDeviceSize              required   = alignUp(build_data.size_info.buildScratchSize, min_alignment);
+            assert(required <= scratch_size && "Scratch buffer smaller than a single build, see getScratchSize()");
+
+            // Stop the chunk when the scratch is full, but always build at least one
+            if (scratch_used + required > scratch_size && m_CurrentBlasIdx != first_blas) {
+                break;
+            }
+
+            VkResult result = m_ResourceAllocator->createAcceleration(blas_accel[m_CurrentBlasIdx], build_data.makeCreateInfo());
+            if (result != VK_SUCCESS) {
+                return result;
+            }
+            build_data.cmdBuildAccelerationStructure(cmd, blas_accel[m_CurrentBlasIdx].accel, scratch_address + scratch_used);
+            scratch_used += required;
+
+            m_Stats.total_original_size += build_data.size_info.accelerationStructureSize;
+            if (build_data.hasCompactFlag()) {
+                m_QueryBlasIndices.push_back(m_CurrentBlasIdx);
+                query_accel.push_back(blas_accel[m_CurrentBlasIdx].accel);
+            }
+            else {
+                m_Stats.total_compact_size += build_data.size_info.accelerationStructureSize;
+            }
+            m_CurrentBlasIdx++;
+        }
+        m_Stats.num_builds++;
+
+        if (!query_accel.empty()) {
+            const auto num_queries = static_cast<uint32_t>(query_accel.size());
+            if (num_queries > m_QueryPoolSize) {
+                destroyQueryPool();
+                const VkQueryPoolCreateInfo query_pool_info{
+                    .sType      = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+                    .queryType  = VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR,
+                    .queryCount = num_queries,
+                };
+                VkResult result = vkCreateQueryPool(device, &query_pool_info, nullptr, &m_QueryPool);
+                if (result != VK_SUCCESS) {
+                    return result;
+                }
+                m_QueryPoolSize = num_queries;
+            }
+
+            // The builds must be finished before their compacted size can be read
+            cmdMemoryBarrier(cmd,
+                             VK_PIPELINE_STAGE_2_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
+                             VK_PIPELINE_STAGE_2_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
+                             VK_ACCESS_2_ACCELERATION_STRUCTURE_WRITE_BIT_KHR,
+                             VK_ACCESS_2_ACCELERATION_STRUCTURE_READ_BIT_KHR);
+
+            vkCmdResetQueryPool(cmd, m_QueryPool, 0, num_queries);
+            vkCmdWriteAccelerationStructuresPropertiesKHR(cmd, num_queries, query_accel.data(), VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR, m_QueryPool, 0);
+        }
+
+        return m_CurrentBlasIdx < num_blas ? VK_INCOMPLETE : VK_SUCCESS;
+    }
+
+    VkResult AccelerationStructureBuilder::cmdCompactBlas(VkCommandBuffer cmd, std::span<AccelerationStructureBuildData> blas_build_data, std::span<AccelerationStructure> blas_accel) {
+        assert(m_ResourceAllocator && "Missing init()");
+        if (m_QueryBlasIndices.empty()) {
+            return VK_SUCCESS;
+        }
+
+        VkDevice device = m_ResourceAllocator->getDevice();
+
+        const auto                num_queries = static_cast<uint32_t>(m_QueryBlasIndices.size());
+        std::vector<VkDeviceSize> compact_sizes(num_queries);
+        VkResult                  result = vkGetQueryPoolResults(device,
+                                                                 m_QueryPool,
+                                                                 0,
+                                                                 num_queries,
+                                                                 compact_sizes.size() * sizeof(VkDeviceSize),
+                                                                 compact_sizes.data(),
+                                                                 sizeof(VkDeviceSize),
+                                                                 VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+
+        for (uint32_t i = 0; i < num_queries; i++) {
+            const uint32_t     blas_idx      = m_QueryBlasIndices[i];
+            const VkDeviceSize original_size = blas_build_data[blas_idx].size_info.accelerationStructureSize;
+            const VkDeviceSize compact_size  = compact_sizes[i];
+
+            // Nothing to gain, keep the original
+            if (compact_size == 0 || compact_size >= original_size) {
+                m_Stats.total_compact_size += original_size;
+                continue;
+            }
+
+            VkAccelerationStructureCreateInfoKHR create_info = blas_build_data[blas_idx].makeCreateInfo();
+            create_info.size                                 = compact_size;
+
+            AccelerationStructure compact_blas;
+            result = m_ResourceAllocator->createAcceleration(compact_blas, create_info);
+            if (result != VK_SUCCESS) {
+                return result;
+            }
+
+            const VkCopyAccelerationStructureInfoKHR copy_info{
+                .sType = VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_INFO_KHR,
+                .src   = blas_accel[blas_idx].accel,
+                .dst   = compact_blas.accel,
+                .mode  = VK_COPY_ACCELERATION_STRUCTURE_MODE_COMPACT_KHR,
+            };
+            vkCmdCopyAccelerationStructureKHR(cmd, &copy_info);
+
+            m_CleanupBlasAccel.push_back(blas_accel[blas_idx]);
+            blas_accel[blas_idx] = compact_blas;
+            m_Stats.total_compact_size += compact_size;
+        }
+        m_QueryBlasIndices.clear();
+
+        return VK_SUCCESS;
+    }
+
+    void AccelerationStructureBuilder::destroyNonCompactedBlas() {
+        for (AccelerationStructure& blas : m_CleanupBlasAccel) {
+            m_ResourceAllocator->destroyAcceleration(blas);
+        }
+        m_CleanupBlasAccel.clear();
+    }
+
+    void AccelerationStructureBuilder::destroyQueryPool() {
+        if (m_QueryPool) {
+            vkDestroyQueryPool(m_ResourceAllocator->getDevice(), m_QueryPool, nullptr);
+        }
+        m_QueryPool     = VK_NULL_HANDLE;
+        m_QueryPoolSize = 0;
+    }
+
+} // namespace vk_test
+
+//--------------------------------------------------------------------------------------------------
+// Usage example
+//--------------------------------------------------------------------------------------------------
+[[maybe_unused]] static void usage_AccelerationStructureBuilder() {
+    vk_test::ResourceAllocator allocator;         // Initialized allocator
+    VkDevice                   device{};          // The Vulkan device
+    VkCommandBuffer            cmd{};             // A command buffer, submitted and waited on after each step
+    uint32_t                   num_meshes = 1000; // Number of meshes
+    const uint32_t             alignment  = 128;  // minAccelerationStructureScratchOffsetAlignment
+
+    // One build data per mesh, with its geometry
+    std::vector<vk_test::AccelerationStructureBuildData> blas_build_data(num_meshes);
+    std::vector<vk_test::AccelerationStructure>          blas_accel(num_meshes);
+    for (auto& build_data : blas_build_data) {
+        build_data.as_type = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR;
+        // build_data.addGeometry(geometry, range_info);
+        build_data.finalizeGeometry(device, VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR | VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR);
+    }
+
+    vk_test::AccelerationStructureBuilder builder;
+    builder.init(&allocator);
+
+    // A single scratch buffer, limited to 256 MB
+    auto            scratch_size = builder.getScratchSize(256ULL << 20, blas_build_data, alignment);
+    vk_test::Buffer scratch_buffer;
+    allocator.createBuffer(scratch_buffer,
+                           scratch_size.total_scratch,
+                           VK_BUFFER_USAGE_2_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_2_SHADER_DEVICE_ADDRESS_BIT,
+                           VMA_MEMORY_USAGE_AUTO,
+                           {},
+                           alignment);
+
+    VkResult result = VK_INCOMPLETE;
+    while (result == VK_INCOMPLETE) {
+        result = builder.cmdCreateBlas(cmd, blas_build_data, blas_accel, scratch_buffer.address, scratch_buffer.bufferSize, alignment);
+        // submit and wait `cmd`, begin a new one
+        builder.cmdCompactBlas(cmd, blas_build_data, blas_accel);
+        // submit and wait `cmd`
+        builder.destroyNonCompactedBlas();
+    }
+
+    allocator.destroyBuffer(scratch_buffer);
+    builder.deinit();
+}
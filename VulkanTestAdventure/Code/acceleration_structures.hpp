@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2024-2025, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2024-2025, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+* Modified by Farrakh
+* 2025
+*/
+
+#pragma once
+
+#include "resource_allocator.hpp"
+
+//-----------------------------------------------------------------
+// AccelerationStructureBuildData holds the geometry and sizes of
+// one acceleration structure (BLAS or TLAS) to build.
+//
+// AccelerationStructureBuilder builds many BLAS in budgeted chunks
+// sharing a single scratch buffer, and compacts them afterwards.
+//
+// Usage:
+//      see usage_AccelerationStructureBuilder in acceleration_structures.cpp
+//-----------------------------------------------------------------
+
+namespace vk_test {
+
+    struct AccelerationStructureBuildData {
+        VkAccelerationStructureTypeKHR as_type = VK_ACCELERATION_STRUCTURE_TYPE_MAX_ENUM_KHR; // Mandatory to set
+
+        std::vector<VkAccelerationStructureGeometryKHR>       as_geometry;
+        std::vector<VkAccelerationStructureBuildRangeInfoKHR> as_build_range_info;
+
+        VkAccelerationStructureBuildGeometryInfoKHR build_info{ VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR };
+        VkAccelerationStructureBuildSizesInfoKHR    size_info{ VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_SIZES_INFO_KHR };
+
+        void addGeometry(const VkAccelerationStructureGeometryKHR& geometry, const VkAccelerationStructureBuildRangeInfoKHR& range_info);
+
+        // Fills `build_info` and queries the sizes, must be called after all geometries were added
+        VkAccelerationStructureBuildSizesInfoKHR finalizeGeometry(VkDevice device, VkBuildAccelerationStructureFlagsKHR flags);
+
+        // Create info for the destination acceleration structure, using the finalized sizes
+        VkAccelerationStructureCreateInfoKHR makeCreateInfo() const;
+
+        // Records the build, `scratch_address` must provide `size_info.buildScratchSize` bytes
+        void cmdBuildAccelerationStructure(VkCommandBuffer cmd, VkAccelerationStructureKHR acceleration_structure, VkDeviceAddress scratch_address);
+
+        // Records an in-place refit, requires VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR
+        // and `size_info.updateScratchSize` bytes of scratch
+        void cmdUpdateAccelerationStructure(VkCommandBuffer cmd, VkAccelerationStructureKHR acceleration_structure, VkDeviceAddress scratch_address);
+
+        bool hasCompactFlag() const { return (build_info.flags & VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR) != 0; }
+    };
+
+    class AccelerationStructureBuilder {
+    public:
+        struct Stats {
+            VkDeviceSize total_original_size = 0;
+            VkDeviceSize total_compact_size  = 0;
+            uint32_t     num_builds          = 0; // Number of chunks (one submit each)
+
+            VkDeviceSize getSavings() const { return total_original_size - total_compact_size; }
+        };
+
+        struct ScratchSizeInfo {
+            VkDeviceSize max_scratch   = 0; // Largest single build, the minimum scratch buffer size
+            VkDeviceSize total_scratch = 0; // Sum of all builds clamped to the budget, the size to allocate
+        };
+
+        AccelerationStructureBuilder()                                               = default;
+        AccelerationStructureBuilder(const AccelerationStructureBuilder&)            = delete;
+        AccelerationStructureBuilder& operator=(const AccelerationStructureBuilder&) = delete;
+        ~AccelerationStructureBuilder() { assert(m_ResourceAllocator == nullptr && "Missing deinit()"); }
+
+        void init(ResourceAllocator* resource_allocator);
+        void deinit();
+
+        // Scratch size to allocate for the given budget: at least the biggest build, at most the total
+        ScratchSizeInfo getScratchSize(VkDeviceSize hint_max_budget, std::span<const AccelerationStructureBuildData> blas_build_data, uint32_t min_alignment = 128) const;
+
+        // Records as many BLAS builds as fit in the scratch buffer, starting where the previous call stopped.
+        // Compacted sizes are queried for BLAS that allow compaction.
+        // Returns VK_INCOMPLETE while more BLAS remain: submit `cmd`, call cmdCompactBlas, then call again.
+        VkResult cmdCreateBlas(VkCommandBuffer                           cmd,
+                               std::span<AccelerationStructureBuildData> blas_build_data,
+                               std::span<AccelerationStructure>          blas_accel,
+                               VkDeviceAddress                           scratch_address,
+                               VkDeviceSize                              scratch_size,
+                               uint32_t                                  min_alignment = 128);
+
+        // Must be called once the command buffer of the last cmdCreateBlas has completed.
+        // Replaces the BLAS of the last chunk by compacted copies, the originals are kept
+        // until destroyNonCompactedBlas, which must be called once `cmd` has completed.
+        VkResult cmdCompactBlas(VkCommandBuffer cmd, std::span<AccelerationStructureBuildData> blas_build_data, std::span<AccelerationStructure> blas_accel);
+
+        void destroyNonCompactedBlas();
+
+        const Stats& getStatistics() const { return m_Stats; }
+
+    private:
+        void destroyQueryPool();
+
+        ResourceAllocator*                 m_ResourceAllocator = nullptr;
+        VkQueryPool                        m_QueryPool{};
+        uint32_t                           m_QueryPoolSize  = 0;
+        uint32_t                           m_CurrentBlasIdx = 0; // Next BLAS to build
+        std::vector<uint32_t>              m_QueryBlasIndices;   // BLAS of the last chunk with a pending compacted size query
+        std::vector<AccelerationStructure> m_CleanupBlasAccel;   // Originals replaced by their compacted copy
+        Stats                              m_Stats;
+    };
+
+} // namespace vk_test
@@ -0,0 +1,423 @@
+#include "pch.h"
+#include "batch_transform.hpp"
+#include "bounding_box.hpp"
+#include "primitives.hpp"
+#include "timers.hpp"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define BATCH_TRANSFORM_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define BATCH_TRANSFORM_AVX2_TARGET
+#else
+#include <cpuid.h>
+#define BATCH_TRANSFORM_AVX2_TARGET __attribute__((target("avx2,fma")))
+#endif
+#endif
+
+namespace {
+    // Columns of the upper 3x3 (w is 0) of the inverse transpose, up to a positive scale removed by the normalization
+    std::array<glm::vec4, 3> normalColumns(const glm::mat4& mat) {
+        const glm::vec3 a(mat[0]);
+        const glm::vec3 b(mat[1]);
+        const glm::vec3 c(mat[2]);
+        const float     sign = glm::dot(a, glm::cross(b, c)) < 0.0F ? -1.0F : 1.0F; // Mirrors flip the normals back
+        return { glm::vec4(glm::cross(b, c) * sign, 0.0F), glm::vec4(glm::cross(c, a) * sign, 0.0F), glm::vec4(glm::cross(a, b) * sign, 0.0F) };
+    }
+
+    //--------------------------------------------------------------------------------------------------
+    // Scalar
+    //
+    void transformPointsScalar(const glm::mat4& mat, const uint8_t* src, size_t src_stride, uint8_t* dst, size_t dst_stride, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            glm::vec3 p;
+            memcpy(&p, src + i * src_stride, sizeof(p));
+            p = glm::vec3(mat[0]) * p.x + glm::vec3(mat[1]) * p.y + glm::vec3(mat[2]) * p.z + glm::vec3(mat[3]);
+            memcpy(dst + i * dst_stride, &p, sizeof(p));
+        }
+    }
+
+    void transformNormalsScalar(const glm::mat4& mat, const uint8_t* src, size_t src_stride, uint8_t* dst, size_t dst_stride, size_t count) {
+        const std::array<glm::vec4, 3> columns = normalColumns(mat);
+        for (size_t i = 0; i < count; i++) {
+            glm::vec3 n;
+            memcpy(&n, src + i * src_stride, sizeof(n));
+            n                   = glm::vec3(columns[0]) * n.x + glm::vec3(columns[1]) * n.y + glm::vec3(columns[2]) * n.z;
+            const float length2 = glm::dot(n, n);
+            if (length2 > 0.0F) {
+                n /= std::sqrt(length2);
+            }
+            memcpy(dst + i * dst_stride, &n, sizeof(n));
+        }
+    }
+
+    void toTransformMatricesScalar(const uint8_t* src, size_t src_stride, uint8_t* dst, size_t dst_stride, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            float m[16];
+            float t[12];
+            memcpy(m, src + i * src_stride, sizeof(m));
+            for (int row = 0; row < 3; row++) {
+                for (int column = 0; column < 4; column++) {
+                    t[row * 4 + column] = m[column * 4 + row];
+                }
+            }
+            memcpy(dst + i * dst_stride, t, sizeof(t));
+        }
+    }
+
+#ifdef BATCH_TRANSFORM_X86
+    //--------------------------------------------------------------------------------------------------
+    // SSE, one element per register. SSE2 is always there on x64, and the default of MSVC on x86.
+    // The vec3 are read and written as 3 floats, the bytes after them belong to the next member.
+    //
+    void transformPointsSse(const glm::mat4& mat, const uint8_t* src, size_t src_stride, uint8_t* dst, size_t dst_stride, size_t count) {
+        const __m128 c0 = _mm_loadu_ps(&mat[0][0]);
+        const __m128 c1 = _mm_loadu_ps(&mat[1][0]);
+        const __m128 c2 = _mm_loadu_ps(&mat[2][0]);
+        const __m128 c3 = _mm_loadu_ps(&mat[3][0]);
+        for (size_t i = 0; i < count; i++) {
+            float p[3];
+            memcpy(p, src + i * src_stride, sizeof(p));
+            const __m128 xy = _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(p[0])), _mm_mul_ps(c1, _mm_set1_ps(p[1])));
+            const __m128 zw = _mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(p[2])), c3);
+
+            alignas(16) float result[4];
+            _mm_store_ps(result, _mm_add_ps(xy, zw));
+            memcpy(dst + i * dst_stride, result, sizeof(float) * 3);
+        }
+    }
+
+    void transformNormalsSse(const glm::mat4& mat, const uint8_t* src, size_t src_stride, uint8_t* dst, size_t dst_stride, size_t count) {
+        const std::array<glm::vec4, 3> columns = normalColumns(mat);
+        const __m128                   c0      = _mm_loadu_ps(&columns[0].x);
+        const __m128                   c1      = _mm_loadu_ps(&columns[1].x);
+        const __m128                   c2      = _mm_loadu_ps(&columns[2].x);
+        for (size_t i = 0; i < count; i++) {
+            float n[3];
+            memcpy(n, src + i * src_stride, sizeof(n));
+            const __m128 v = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(n[0])), _mm_mul_ps(c1, _mm_set1_ps(n[1]))), _mm_mul_ps(c2, _mm_set1_ps(n[2])));
+
+            // Squared length in all the lanes, w is 0
+            __m128 length2 = _mm_mul_ps(v, v);
+            length2        = _mm_add_ps(length2, _mm_shuffle_ps(length2, length2, _MM_SHUFFLE(2, 3, 0, 1)));
+            length2        = _mm_add_ps(length2, _mm_shuffle_ps(length2, length2, _MM_SHUFFLE(1, 0, 3, 2)));
+
+            const __m128 non_zero = _mm_cmpgt_ps(length2, _mm_setzero_ps());
+            const __m128 unit     = _mm_div_ps(v, _mm_sqrt_ps(length2));
+
+            alignas(16) float result[4];
+            _mm_store_ps(result, _mm_or_ps(_mm_and_ps(non_zero, unit), _mm_andnot_ps(non_zero, v)));
+            memcpy(dst + i * dst_stride, result, sizeof(float) * 3);
+        }
+    }
+
+    void toTransformMatricesSse(const uint8_t* src, size_t src_stride, uint8_t* dst, size_t dst_stride, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            const float* m  = reinterpret_cast<const float*>(src + i * src_stride);
+            __m128       r0 = _mm_loadu_ps(m);
+            __m128       r1 = _mm_loadu_ps(m + 4);
+            __m128       r2 = _mm_loadu_ps(m + 8);
+            __m128       r3 = _mm_loadu_ps(m + 12);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+            float* t = reinterpret_cast<float*>(dst + i * dst_stride);
+            _mm_storeu_ps(t, r0);
+            _mm_storeu_ps(t + 4, r1);
+            _mm_storeu_ps(t + 8, r2);
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------
+    // AVX2 and FMA, two elements per register (one per 128-bit lane), the last odd one goes through SSE
+    //
+    // `a` in the low lane, `b` in the high one
+    BATCH_TRANSFORM_AVX2_TARGET inline __m256 broadcastPair(float a, float b) {
+        return _mm256_setr_ps(a, a, a, a, b, b, b, b);
+    }
+
+    BATCH_TRANSFORM_AVX2_TARGET void transformPointsAvx2(const glm::mat4& mat, const uint8_t* src, size_t src_stride, uint8_t* dst, size_t dst_stride, size_t count) {
+        const __m256 c0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&mat[0][0]));
+        const __m256 c1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&mat[1][0]));
+        const __m256 c2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&mat[2][0]));
+        const __m256 c3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&mat[3][0]));
+
+        size_t i = 0;
+        for (; i + 1 < count; i += 2) {
+            float p[6];
+            memcpy(p, src + i * src_stride, sizeof(float) * 3);
+            memcpy(p + 3, src + (i + 1) * src_stride, sizeof(float) * 3);
+            const __m256 r = _mm256_fmadd_ps(c0, broadcastPair(p[0], p[3]), _mm256_fmadd_ps(c1, broadcastPair(p[1], p[4]), _mm256_fmadd_ps(c2, broadcastPair(p[2], p[5]), c3)));
+
+            alignas(32) float result[8];
+            _mm256_store_ps(result, r);
+            memcpy(dst + i * dst_stride, result, sizeof(float) * 3);
+            memcpy(dst + (i + 1) * dst_stride, result + 4, sizeof(float) * 3);
+        }
+        transformPointsSse(mat, src + i * src_stride, src_stride, dst + i * dst_stride, dst_stride, count - i);
+    }
+
+    BATCH_TRANSFORM_AVX2_TARGET void transformNormalsAvx2(const glm::mat4& mat, const uint8_t* src, size_t src_stride, uint8_t* dst, size_t dst_stride, size_t count) {
+        const std::array<glm::vec4, 3> columns = normalColumns(mat);
+        const __m256                   c0      = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&columns[0].x));
+        const __m256                   c1      = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&columns[1].x));
+        const __m256                   c2      = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&columns[2].x));
+
+        size_t i = 0;
+        for (; i + 1 < count; i += 2) {
+            float n[6];
+            memcpy(n, src + i * src_stride, sizeof(float) * 3);
+            memcpy(n + 3, src + (i + 1) * src_stride, sizeof(float) * 3);
+            const __m256 v = _mm256_fmadd_ps(c0, broadcastPair(n[0], n[3]), _mm256_fmadd_ps(c1, broadcastPair(n[1], n[4]), _mm256_mul_ps(c2, broadcastPair(n[2], n[5]))));
+
+            // Squared length in all the lanes of each half, w is 0
+            __m256 length2 = _mm256_mul_ps(v, v);
+            length2        = _mm256_add_ps(length2, _mm256_shuffle_ps(length2, length2, _MM_SHUFFLE(2, 3, 0, 1)));
+            length2        = _mm256_add_ps(length2, _mm256_shuffle_ps(length2, length2, _MM_SHUFFLE(1, 0, 3, 2)));
+
+            const __m256 non_zero = _mm256_cmp_ps(length2, _mm256_setzero_ps(), _CMP_GT_OQ);
+            const __m256 unit     = _mm256_div_ps(v, _mm256_sqrt_ps(length2));
+
+            alignas(32) float result[8];
+            _mm256_store_ps(result, _mm256_blendv_ps(v, unit, non_zero));
+            memcpy(dst + i * dst_stride, result, sizeof(float) * 3);
+            memcpy(dst + (i + 1) * dst_stride, result + 4, sizeof(float) * 3);
+        }
+        transformNormalsSse(mat, src + i * src_stride, src_stride, dst + i * dst_stride, dst_stride, count - i);
+    }
+
+    bool cpuHasAvx2() {
+#if defined(_MSC_VER)
+        int info[4] = {};
+        __cpuid(info, 0);
+        if (info[0] < 7) {
+            return false;
+        }
+        __cpuid(info, 1);
+        const bool fma     = (info[2] & (1 << 12)) != 0;
+        const bool osxsave = (info[2] & (1 << 27)) != 0;
+        const bool avx     = (info[2] & (1 << 28)) != 0;
+        if (!fma || !osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) { // The OS saves the YMM registers
+            return false;
+        }
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#else
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+    }
+#endif
+
+    vk_test::BatchTransformSimd supportedSimd() {
+#ifdef BATCH_TRANSFORM_X86
+        static const vk_test::BatchTransformSimd supported = cpuHasAvx2() ? vk_test::BatchTransformSimd::eAvx2 : vk_test::BatchTransformSimd::eSse;
+        return supported;
+#else
+        return vk_test::BatchTransformSimd::eScalar;
+#endif
+    }
+
+    std::atomic<vk_test::BatchTransformSimd> s_Simd{ supportedSimd() };
+} // namespace
+
+vk_test::BatchTransformSimd vk_test::getBatchTransformSimd() {
+    return s_Simd.load(std::memory_order_relaxed);
+}
+
+const char* vk_test::getBatchTransformSimdName(BatchTransformSimd simd) {
+    switch (simd) {
+        case BatchTransformSimd::eAvx2:
+            return "AVX2";
+        case BatchTransformSimd::eSse:
+            return "SSE";
+        default:
+            return "scalar";
+    }
+}
+
+void vk_test::setBatchTransformSimd(BatchTransformSimd simd) {
+    s_Simd.store(std::min(simd, supportedSimd()), std::memory_order_relaxed);
+}
+
+void vk_test::transformPoints(const glm::mat4& mat, const void* src, size_t src_stride, void* dst, size_t dst_stride, size_t count) {
+    const uint8_t* in  = static_cast<const uint8_t*>(src);
+    uint8_t*       out = static_cast<uint8_t*>(dst);
+    switch (getBatchTransformSimd()) {
+#ifdef BATCH_TRANSFORM_X86
+        case BatchTransformSimd::eAvx2:
+            transformPointsAvx2(mat, in, src_stride, out, dst_stride, count);
+            break;
+        case BatchTransformSimd::eSse:
+            transformPointsSse(mat, in, src_stride, out, dst_stride, count);
+            break;
+#endif
+        default:
+            transformPointsScalar(mat, in, src_stride, out, dst_stride, count);
+            break;
+    }
+}
+
+void vk_test::transformNormals(const glm::mat4& mat, const void* src, size_t src_stride, void* dst, size_t dst_stride, size_t count) {
+    const uint8_t* in  = static_cast<const uint8_t*>(src);
+    uint8_t*       out = static_cast<uint8_t*>(dst);
+    switch (getBatchTransformSimd()) {
+#ifdef BATCH_TRANSFORM_X86
+        case BatchTransformSimd::eAvx2:
+            transformNormalsAvx2(mat, in, src_stride, out, dst_stride, count);
+            break;
+        case BatchTransformSimd::eSse:
+            transformNormalsSse(mat, in, src_stride, out, dst_stride, count);
+            break;
+#endif
+        default:
+            transformNormalsScalar(mat, in, src_stride, out, dst_stride, count);
+            break;
+    }
+}
+
+void vk_test::toTransformMatricesKHR(const glm::mat4* src, size_t src_stride, VkTransformMatrixKHR* dst, size_t dst_stride, size_t count) {
+    const uint8_t* in  = reinterpret_cast<const uint8_t*>(src);
+    uint8_t*       out = reinterpret_cast<uint8_t*>(dst);
+
+    // A transpose is only shuffles, the AVX2 version would not be faster
+#ifdef BATCH_TRANSFORM_X86
+    if (getBatchTransformSimd() != BatchTransformSimd::eScalar) {
+        toTransformMatricesSse(in, src_stride, out, dst_stride, count);
+        return;
+    }
+#endif
+    toTransformMatricesScalar(in, src_stride, out, dst_stride, count);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Micro-benchmark
+//--------------------------------------------------------------------------------------------------
+namespace {
+    // Bbox::transform before it used the center and extents, 8 corners in a std::vector
+    vk_test::Bbox transformBboxReference(const vk_test::Bbox& box, const glm::mat4& mat) {
+        std::vector<glm::vec3> corners(8);
+        for (int c = 0; c < 8; c++) {
+            const glm::vec3 corner((c & 4) != 0 ? box.max().x : box.min().x, (c & 2) != 0 ? box.max().y : box.min().y, (c & 1) != 0 ? box.max().z : box.min().z);
+            corners[c] = glm::vec3(mat * glm::vec4(corner, 1.F));
+        }
+        return vk_test::Bbox(corners);
+    }
+
+    std::vector<glm::mat4> randomTransforms(size_t count, std::mt19937& gen) {
+        std::uniform_real_distribution<float> unit(-1.0F, 1.0F);
+        std::vector<glm::mat4>                transforms(count);
+        for (glm::mat4& transform : transforms) {
+            const glm::quat rotation = glm::normalize(glm::quat(unit(gen), unit(gen), unit(gen), unit(gen)));
+            transform = glm::translate(glm::mat4(1.0F), glm::vec3(unit(gen), unit(gen), unit(gen)) * 100.0F) * glm::mat4_cast(rotation) * glm::scale(glm::mat4(1.0F), glm::vec3(1.0F + unit(gen) * 0.5F));
+        }
+        return transforms;
+    }
+} // namespace
+
+void vk_test::benchmarkBatchTransforms() {
+    const BatchTransformSimd supported = getBatchTransformSimd();
+    std::mt19937             gen(1);
+    VK_TEST_SAY("Batch transforms, " << getBatchTransformSimdName(supported) << " supported");
+
+    // 10M vertices, a sphere of about 1K vertices per node, as transformed by mergeNodes. Every instruction set
+    // transforms the positions and normals of the same copy of the vertices, on this thread, compared with the scalar kernels
+    {
+        const PrimitiveMesh          sphere = createSphereUv(0.5F, 40, 24);
+        const size_t                 size   = sphere.vertices.size();
+        const size_t                 count  = (10'000'000 + size - 1) / size;
+        const std::vector<glm::mat4> random = randomTransforms(count, gen);
+
+        std::vector<PrimitiveVertex> source;
+        source.reserve(count * size);
+        for (size_t i = 0; i < count; i++) {
+            source.insert(source.end(), sphere.vertices.begin(), sphere.vertices.end());
+        }
+
+        std::vector<PrimitiveVertex> reference;
+        std::vector<PrimitiveVertex> vertices;
+        double                       scalar_ms = 0.0;
+        for (int simd = int(BatchTransformSimd::eScalar); simd <= int(supported); simd++) {
+            setBatchTransformSimd(BatchTransformSimd(simd));
+            vertices = source;
+
+            PerformanceTimer timer;
+            for (size_t i = 0; i < count; i++) {
+                PrimitiveVertex* node_vertices = vertices.data() + i * size;
+                transformPoints(random[i], &node_vertices->pos, sizeof(PrimitiveVertex), &node_vertices->pos, sizeof(PrimitiveVertex), size);
+                transformNormals(random[i], &node_vertices->nrm, sizeof(PrimitiveVertex), &node_vertices->nrm, sizeof(PrimitiveVertex), size);
+            }
+            const double ms = timer.getMilliseconds();
+
+            if (simd == int(BatchTransformSimd::eScalar)) {
+                reference = vertices;
+                scalar_ms = ms;
+                VK_TEST_SAY("  Vertex transforms " << vertices.size() << " positions and normals, 1 thread, scalar : " << ms << " ms");
+                continue;
+            }
+            float max_error = 0.0F;
+            for (size_t v = 0; v < vertices.size(); v++) {
+                max_error = std::max({ max_error, glm::length(vertices[v].pos - reference[v].pos), glm::length(vertices[v].nrm - reference[v].nrm) });
+            }
+            VK_TEST_SAY("  Vertex transforms " << getBatchTransformSimdName(BatchTransformSimd(simd)) << " : " << ms << " ms, x" << scalar_ms / ms << ", max difference " << max_error);
+        }
+    }
+
+    // 1M TLAS instances and their bounds
+    {
+        const size_t                                    count      = 1'000'000;
+        const std::vector<glm::mat4>                    transforms = randomTransforms(count, gen);
+        std::vector<VkAccelerationStructureInstanceKHR> instances(count);
+
+        PerformanceTimer timer;
+        for (size_t i = 0; i < count; i++) {
+            memcpy(&instances[i].transform, glm::value_ptr(glm::transpose(transforms[i])), sizeof(VkTransformMatrixKHR));
+        }
+        const double reference_ms = timer.getMilliseconds();
+        VK_TEST_SAY("  TLAS transforms " << count << ", glm::transpose and memcpy : " << reference_ms << " ms");
+
+        for (int simd = int(BatchTransformSimd::eScalar); simd <= int(supported); simd++) {
+            setBatchTransformSimd(BatchTransformSimd(simd));
+            timer.reset();
+            toTransformMatricesKHR(transforms.data(), sizeof(glm::mat4), &instances[0].transform, sizeof(VkAccelerationStructureInstanceKHR), count);
+            const double ms = timer.getMilliseconds();
+            VK_TEST_SAY("  TLAS transforms " << getBatchTransformSimdName(BatchTransformSimd(simd)) << " : " << ms << " ms, x" << reference_ms / ms);
+        }
+
+        const Bbox        box(glm::vec3(-1.0F, -2.0F, -0.5F), glm::vec3(1.0F, 0.5F, 3.0F));
+        std::vector<Bbox> bounds(count);
+        timer.reset();
+        for (size_t i = 0; i < count; i++) {
+            bounds[i] = transformBboxReference(box, transforms[i]);
+        }
+        const double bbox_reference_ms = timer.getMilliseconds();
+
+        float max_error = 0.0F;
+        timer.reset();
+        for (size_t i = 0; i < count; i++) {
+            const Bbox transformed = box.transform(transforms[i]);
+            max_error              = std::max({ max_error, glm::length(transformed.min() - bounds[i].min()), glm::length(transformed.max() - bounds[i].max()) });
+        }
+        const double bbox_ms = timer.getMilliseconds();
+        VK_TEST_SAY("  Bbox::transform " << count << ", 8 corners : " << bbox_reference_ms << " ms, center and extents : " << bbox_ms << " ms, x" << bbox_reference_ms / bbox_ms
+                                         << ", max difference " << max_error);
+    }
+
+    setBatchTransformSimd(supported);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Usage example
+//--------------------------------------------------------------------------------------------------
+[[maybe_unused]] static void usage_BatchTransform() {
+    std::vector<vk_test::PrimitiveVertex> vertices; // Interleaved
+    std::vector<glm::vec3>                points;   // Separate
+    const glm::mat4                       mat = glm::translate(glm::mat4(1.0F), glm::vec3(1.0F, 0.0F, 0.0F));
+
+    // In place, the positions and normals are 32 bytes apart
+    vk_test::transformPoints(mat, &vertices[0].pos, sizeof(vk_test::PrimitiveVertex), &vertices[0].pos, sizeof(vk_test::PrimitiveVertex), vertices.size());
+    vk_test::transformNormals(mat, &vertices[0].nrm, sizeof(vk_test::PrimitiveVertex), &vertices[0].nrm, sizeof(vk_test::PrimitiveVertex), vertices.size());
+
+    // From one array to the other
+    std::vector<glm::vec3> transformed(points.size());
+    vk_test::transformPoints(mat, points.data(), sizeof(glm::vec3), transformed.data(), sizeof(glm::vec3), points.size());
+}
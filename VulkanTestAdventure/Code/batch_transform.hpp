@@ -0,0 +1,50 @@
+#pragma once
+
+//-----------------------------------------------------------------
+// Transforms of many points, normals and matrices at once, for the
+// CPU side of the scene setup: mergeNodes(), the TLAS instances.
+//
+// The streams are strided (in bytes), so the positions of interleaved
+// vertices (PrimitiveVertex) and of separate arrays (glm::vec3) go
+// through the same kernels. Reading and writing the same stream is
+// allowed, the elements are transformed in place.
+//
+// Each kernel has a scalar version, an SSE one and an AVX2 one (two
+// elements per register); the widest the CPU runs is picked at the first
+// call. setBatchTransformSimd() forces a narrower one, to compare them.
+// Only x86 has the SIMD versions, the other targets use the scalar ones.
+//
+// Usage:
+//      see usage_BatchTransform in batch_transform.cpp
+//-----------------------------------------------------------------
+
+namespace vk_test {
+
+    enum class BatchTransformSimd {
+        eScalar,
+        eSse,
+        eAvx2,
+    };
+
+    // Widest instruction set used by the kernels
+    BatchTransformSimd getBatchTransformSimd();
+    const char*        getBatchTransformSimdName(BatchTransformSimd simd);
+
+    // Clamped to what the CPU supports, for benchmarks. Not thread safe with running kernels
+    void setBatchTransformSimd(BatchTransformSimd simd);
+
+    // dst = mat * (src, 1), `count` glm::vec3 read `src_stride` bytes apart and written `dst_stride` bytes apart
+    void transformPoints(const glm::mat4& mat, const void* src, size_t src_stride, void* dst, size_t dst_stride, size_t count);
+
+    // dst = normalize(inverse transpose of the upper 3x3 of mat * src), null normals stay null
+    void transformNormals(const glm::mat4& mat, const void* src, size_t src_stride, void* dst, size_t dst_stride, size_t count);
+
+    // Column-major glm::mat4 to row-major VkTransformMatrixKHR (the last row is dropped), `count` matrices read
+    // `src_stride` bytes apart (ex. GltfInstance::transform) and written `dst_stride` bytes apart (ex. VkAccelerationStructureInstanceKHR::transform)
+    void toTransformMatricesKHR(const glm::mat4* src, size_t src_stride, VkTransformMatrixKHR* dst, size_t dst_stride, size_t count);
+
+    // Single-threaded timings of the SIMD kernels against the scalar ones, and of Bbox::transform against the loop it replaced,
+    // printed with VK_TEST_SAY (main --micro-benchmark transforms)
+    void benchmarkBatchTransforms();
+
+} // namespace vk_test
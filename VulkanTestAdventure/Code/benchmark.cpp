@@ -0,0 +1,216 @@
+#include "pch.h"
+#include "benchmark.hpp"
+
+#include <Application.hpp>
+#include <file_operations.hpp>
+#include <staging.hpp>
+
+#include <json.hpp>
+
+bool vk_test::Benchmark::loadCameraPath(const std::filesystem::path& filename, std::vector<CameraManipulator::Camera>& camera_path) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        VK_TEST_SAY("Benchmark : could not open the camera path " << utf8FromPath(filename).c_str());
+        return false;
+    }
+
+    camera_path.clear();
+    std::string line;
+    for (uint32_t line_number = 1; std::getline(file, line); line_number++) {
+        const size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#') {
+            continue;
+        }
+
+        // Keyframes without FOV or clip planes keep the defaults
+        CameraManipulator::Camera camera;
+        if (!camera.setFromString(line.substr(first))) {
+            VK_TEST_SAY("Benchmark : " << utf8FromPath(filename).c_str() << "(" << line_number << ") is not a camera");
+            return false;
+        }
+        camera_path.push_back(camera);
+    }
+    return !camera_path.empty();
+}
+
+vk_test::Benchmark::Percentiles vk_test::Benchmark::computePercentiles(std::vector<double> samples) {
+    if (samples.empty()) {
+        return {};
+    }
+    std::ranges::sort(samples);
+
+    auto percentile = [&](double p) {
+        const size_t rank = size_t(std::ceil(p * 0.01 * double(samples.size())));
+        return samples[std::clamp<size_t>(rank, 1, samples.size()) - 1];
+    };
+    return {
+        .sample_count = uint32_t(samples.size()),
+        .min_ms       = samples.front(),
+        .avg_ms       = std::accumulate(samples.begin(), samples.end(), 0.0) / double(samples.size()),
+        .p50_ms       = percentile(50.0),
+        .p90_ms       = percentile(90.0),
+        .p95_ms       = percentile(95.0),
+        .p99_ms       = percentile(99.0),
+        .max_ms       = samples.back(),
+    };
+}
+
+void vk_test::Benchmark::addCounter(const std::string& name, std::function<double()>&& function) {
+    m_Counters.push_back({ .name = name, .function = std::move(function) });
+}
+
+void vk_test::Benchmark::begin(const Settings& settings, uint32_t measured_frame_count, VkExtent2D resolution, const std::string& device_name) {
+    m_Settings           = settings;
+    m_MeasuredFrameCount = measured_frame_count;
+    m_Resolution         = resolution;
+    m_DeviceName         = device_name;
+    m_FrameIndex         = 0;
+    m_IsRunning          = true;
+
+    m_CpuTimes.clear();
+    m_GpuTimes.clear();
+    m_Results.clear();
+    m_Failures.clear();
+    m_CpuTimes.reserve(measured_frame_count);
+    m_GpuTimes.reserve(measured_frame_count);
+}
+
+void vk_test::Benchmark::beginFrame(uint32_t frame_index) {
+    m_FrameIndex = frame_index;
+
+    if (frame_index == m_Settings.warmup_frame_count) {
+        for (Counter& counter : m_Counters) {
+            counter.start = counter.function();
+            counter.last  = counter.start;
+            counter.max   = counter.start;
+        }
+    }
+}
+
+void vk_test::Benchmark::endFrame(double cpu_milliseconds) {
+    if (!isMeasured(m_FrameIndex)) {
+        return;
+    }
+
+    m_CpuTimes.push_back(cpu_milliseconds);
+    for (Counter& counter : m_Counters) {
+        counter.last = counter.function();
+        counter.max  = std::max(counter.max, counter.last);
+    }
+}
+
+void vk_test::Benchmark::addGpuFrameTime(uint64_t frame_index, double milliseconds) {
+    if (isMeasured(frame_index)) {
+        m_GpuTimes.push_back(milliseconds);
+    }
+}
+
+bool vk_test::Benchmark::getCamera(CameraManipulator::Camera& camera) const {
+    const std::vector<CameraManipulator::Camera>& path = m_Settings.camera_path;
+    if (path.empty()) {
+        return false;
+    }
+
+    // Position on the path from the frame index alone, no clock involved
+    double position = 0.0;
+    if (m_FrameIndex >= m_Settings.warmup_frame_count && m_MeasuredFrameCount > 1) {
+        const double measured_index = double(std::min(m_FrameIndex - m_Settings.warmup_frame_count, m_MeasuredFrameCount - 1));
+        position                    = measured_index * double(path.size() - 1) / double(m_MeasuredFrameCount - 1);
+    }
+
+    const size_t key = std::min(size_t(position), path.size() - 1);
+    if (key + 1 == path.size()) {
+        camera = path[key];
+        return true;
+    }
+
+    const CameraManipulator::Camera& a = path[key];
+    const CameraManipulator::Camera& b = path[key + 1];
+    const float                      t = float(position - double(key));
+
+    camera.eye  = glm::mix(a.eye, b.eye, t);
+    camera.ctr  = glm::mix(a.ctr, b.ctr, t);
+    camera.up   = glm::normalize(glm::mix(a.up, b.up, t));
+    camera.fov  = glm::mix(a.fov, b.fov, t);
+    camera.clip = glm::mix(a.clip, b.clip, t);
+    return true;
+}
+
+bool vk_test::Benchmark::writeReport(const std::filesystem::path& filename) const {
+    auto to_json = [](const Percentiles& percentiles) {
+        return nlohmann::json{
+            { "samples", percentiles.sample_count },
+            { "min", percentiles.min_ms },
+            { "avg", percentiles.avg_ms },
+            { "p50", percentiles.p50_ms },
+            { "p90", percentiles.p90_ms },
+            { "p95", percentiles.p95_ms },
+            { "p99", percentiles.p99_ms },
+            { "max", percentiles.max_ms },
+        };
+    };
+
+    nlohmann::json camera_path = nlohmann::json::array();
+    for (const CameraManipulator::Camera& camera : m_Settings.camera_path) {
+        camera_path.push_back(camera.getString());
+    }
+
+    nlohmann::json counters = nlohmann::json::object();
+    for (const Counter& counter : m_Counters) {
+        counters[counter.name] = { { "start", counter.start }, { "end", counter.last }, { "delta", counter.last - counter.start }, { "max", counter.max } };
+    }
+
+    const nlohmann::json report{
+        { "scene", m_Settings.scene },
+        { "device", m_DeviceName },
+        { "resolution", { m_Resolution.width, m_Resolution.height } },
+        { "warmup_frames", m_Settings.warmup_frame_count },
+        { "measured_frames", m_MeasuredFrameCount },
+        { "camera_path", std::move(camera_path) },
+        { "cpu_frame_ms", to_json(getCpuPercentiles()) },
+        { "gpu_frame_ms", to_json(getGpuPercentiles()) },
+        { "counters", std::move(counters) },
+        { "results", m_Results },
+        { "passed", hasPassed() },
+        { "failures", m_Failures },
+        { "cpu_frame_times_ms", m_CpuTimes },
+        { "gpu_frame_times_ms", m_GpuTimes },
+    };
+
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        VK_TEST_SAY("Benchmark : could not write " << utf8FromPath(filename).c_str());
+        return false;
+    }
+    file << report.dump(2);
+    return file.good();
+}
+
+//--------------------------------------------------------------------------------------------------
+// Usage example
+//--------------------------------------------------------------------------------------------------
+[[maybe_unused]] static void usage_Benchmark() {
+    vk_test::ApplicationCreateInfo                  application_create_info{};
+    vk_test::Application*                           app{};              // The application, running the benchmark
+    vk_test::StagingRingUploader*                   staging_uploader{}; // Of an element
+    std::vector<vk_test::CameraManipulator::Camera> camera_path;
+
+    // benchmark.txt :
+    //      {0, 0.5, 5}, {0, 0, 0}, {0, 1, 0}, {60}, {0.01, 100}
+    //      {5, 2, 0}, {0, 0, 0}, {0, 1, 0}, {60}, {0.01, 100}
+    vk_test::Benchmark::loadCameraPath("benchmark.txt", camera_path);
+
+    // The run replaces Application::Loop()
+    application_create_info.headless             = true;
+    application_create_info.window_size          = { 1280, 720 };
+    application_create_info.headless_frame_count = 500; // Measured
+    application_create_info.benchmark            = {
+        .warmup_frame_count = 50,
+        .camera_path        = camera_path,
+        .scene              = "teapot",
+        .report_file        = "benchmark.json",
+    };
+
+    // From IAppElement::onAttach, sampled around the measured frames
+    app->getBenchmark().addCounter("uploaded_bytes", [=] { return double(staging_uploader->getRingStats().uploaded_bytes); });
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "camera_manipulator.hpp"
+
+//-----------------------------------------------------------------
+// Benchmark collects the frame times of a headless run of the
+// Application, and writes them as a JSON report.
+//
+// The run renders warmup frames, then measured frames. The camera is
+// driven by a scripted path: keyframes in the Camera::getString()
+// format, spread evenly over the measured frames and linearly
+// interpolated, the warmup frames stay on the first one. The camera of
+// a frame only depends on its index, so two runs render the same images.
+//
+// The CPU time of a frame goes from the start of its recording to its
+// submit, the wait for a free frame slot is not counted. The GPU time is
+// the whole frame command buffer, see GpuProfiler. The report gives
+// their percentiles over the measured frames.
+//
+// Counters added by the elements (ex. bytes uploaded, memory in use)
+// are sampled before the first measured frame and after each of them.
+//
+// Checks of the run (ex. a golden image comparison) add their results
+// and failures to the report, hasPassed() gives the exit status.
+//
+// Usage:
+//      see usage_Benchmark in benchmark.cpp
+//-----------------------------------------------------------------
+
+namespace vk_test {
+
+    class Benchmark {
+    public:
+        struct Settings {
+            uint32_t                               warmup_frame_count = 0;
+            std::vector<CameraManipulator::Camera> camera_path; // Keyframes over the measured frames, empty keeps the camera of the scene
+            std::string                            scene;       // Name of the scene in the report
+            std::filesystem::path                  report_file; // Nothing is written when empty
+        };
+
+        // Milliseconds, nearest rank
+        struct Percentiles {
+            uint32_t sample_count = 0;
+            double   min_ms       = 0.0;
+            double   avg_ms       = 0.0;
+            double   p50_ms       = 0.0;
+            double   p90_ms       = 0.0;
+            double   p95_ms       = 0.0;
+            double   p99_ms       = 0.0;
+            double   max_ms       = 0.0;
+        };
+
+        Benchmark()                            = default;
+        Benchmark(const Benchmark&)            = delete;
+        Benchmark& operator=(const Benchmark&) = delete;
+
+        // One keyframe per line, in the Camera::getString() format, empty lines and lines starting with '#' are skipped
+        static bool loadCameraPath(const std::filesystem::path& filename, std::vector<CameraManipulator::Camera>& camera_path);
+
+        static Percentiles computePercentiles(std::vector<double> samples);
+
+        // `function` is called on the thread of the run, between the frames
+        void addCounter(const std::string& name, std::function<double()>&& function);
+
+        void begin(const Settings& settings, uint32_t measured_frame_count, VkExtent2D resolution, const std::string& device_name);
+        void end() { m_IsRunning = false; }
+
+        bool     isRunning() const { return m_IsRunning; }
+        bool     isMeasured(uint64_t frame_index) const { return frame_index >= m_Settings.warmup_frame_count && frame_index < getFrameCount(); }
+        uint32_t getFrameCount() const { return m_Settings.warmup_frame_count + m_MeasuredFrameCount; }
+        bool     isLastFrame() const { return m_IsRunning && m_FrameIndex + 1 == getFrameCount(); }
+
+        // Frames are numbered from 0, the warmup frames first
+        void beginFrame(uint32_t frame_index);
+        void endFrame(double cpu_milliseconds);
+        void addGpuFrameTime(uint64_t frame_index, double milliseconds);
+
+        // The camera of the current frame, false when there is no camera path
+        bool getCamera(CameraManipulator::Camera& camera) const;
+
+        Percentiles getCpuPercentiles() const { return computePercentiles(m_CpuTimes); }
+        Percentiles getGpuPercentiles() const { return computePercentiles(m_GpuTimes); }
+
+        // Written in the report, "results" and "failures"
+        void addResult(const std::string& name, double value) { m_Results[name] = value; }
+        void addFailure(const std::string& message) { m_Failures.push_back(message); }
+        bool hasPassed() const { return m_Failures.empty(); }
+
+        bool writeReport(const std::filesystem::path& filename) const;
+
+    private:
+        struct Counter {
+            std::string             name;
+            std::function<double()> function;
+            double                  start = 0.0; // Before the first measured frame
+            double                  last  = 0.0;
+            double                  max   = 0.0;
+        };
+
+        Settings    m_Settings;
+        uint32_t    m_MeasuredFrameCount = 0;
+        VkExtent2D  m_Resolution{};
+        std::string m_DeviceName;
+        uint32_t    m_FrameIndex = 0;
+        bool        m_IsRunning  = false;
+
+        std::vector<double>  m_CpuTimes; // Measured frames, in the order of the frames
+        std::vector<double>  m_GpuTimes; // Measured frames, in the order of their readback
+        std::vector<Counter> m_Counters;
+
+        std::map<std::string, double> m_Results;
+        std::vector<std::string>      m_Failures;
+    };
+
+} // namespace vk_test
@@ -0,0 +1,175 @@
+#include "pch.h"
+#include "bindless_textures.hpp"
+
+#include <Application.hpp>
+
+VkResult vk_test::BindlessTextureTable::init(VkDevice device, VkPhysicalDevice physical_device, uint32_t binding, uint32_t capacity, VkShaderStageFlags stage_flags) {
+    assert(!m_Device);
+
+    // A combined image sampler counts as a sampled image and as a sampler
+    VkPhysicalDeviceVulkan12Properties properties12{ VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES };
+    VkPhysicalDeviceProperties2        properties{ .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2, .pNext = &properties12 };
+    vkGetPhysicalDeviceProperties2(physical_device, &properties);
+    const uint32_t max_capacity = std::min({ properties12.maxDescriptorSetUpdateAfterBindSampledImages,
+                                             properties12.maxDescriptorSetUpdateAfterBindSamplers,
+                                             properties12.maxPerStageDescriptorUpdateAfterBindSampledImages,
+                                             properties12.maxPerStageDescriptorUpdateAfterBindSamplers });
+    if (capacity > max_capacity) {
+        VK_TEST_SAY("Bindless texture table : " << capacity << " slots requested, the device allows " << max_capacity);
+        capacity = max_capacity;
+    }
+
+    m_Device     = device;
+    m_Binding    = binding;
+    m_Capacity   = capacity;
+    m_NextSlot   = 1;
+    m_WriteCount = 0;
+
+    // The set is allocated with all slots, the layout only gives the upper bound
+    DescriptorBindings bindings;
+    bindings.addBinding({ .binding         = binding,
+                          .descriptorType  = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                          .descriptorCount = capacity,
+                          .stageFlags      = stage_flags },
+                        VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT | VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT);
+    return m_DescPack.init(bindings,
+                           device,
+                           1,
+                           VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT,
+                           VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT,
+                           capacity,
+                           &capacity);
+}
+
+void vk_test::BindlessTextureTable::deinit() {
+    if (m_Device == VK_NULL_HANDLE) {
+        return;
+    }
+
+    m_DescPack.deinit();
+    m_ImageInfos.clear();
+    m_FreeSlots.clear();
+    m_RetiredSlots.clear();
+    m_DirtySlots.clear();
+    m_IsDirty.clear();
+    m_Device = VK_NULL_HANDLE;
+}
+
+uint32_t vk_test::BindlessTextureTable::allocateSlot(const VkDescriptorImageInfo& image_info) {
+    releaseRetired();
+
+    uint32_t slot = NULL_SLOT;
+    if (!m_FreeSlots.empty()) {
+        slot = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+    }
+    else if (m_NextSlot < m_Capacity) {
+        slot = m_NextSlot++;
+        m_ImageInfos.resize(m_NextSlot);
+        m_IsDirty.resize(m_NextSlot, false);
+    }
+    else {
+        VK_TEST_SAY("Bindless texture table : all " << m_Capacity << " slots are used");
+        return NULL_SLOT;
+    }
+
+    updateSlot(slot, image_info);
+    return slot;
+}
+
+void vk_test::BindlessTextureTable::updateSlot(uint32_t slot, const VkDescriptorImageInfo& image_info) {
+    assert(slot != NULL_SLOT && slot < m_NextSlot);
+
+    m_ImageInfos[slot] = image_info;
+    if (!m_IsDirty[slot]) {
+        m_IsDirty[slot] = true;
+        m_DirtySlots.push_back(slot);
+    }
+}
+
+void vk_test::BindlessTextureTable::freeSlot(uint32_t slot, const SemaphoreState& semaphore_state) {
+    if (slot == NULL_SLOT) {
+        return;
+    }
+    assert(slot < m_NextSlot);
+
+    // The descriptor stays as is, nothing indexes it anymore
+    m_RetiredSlots.push_back({ .slot = slot, .semaphore_state = semaphore_state });
+}
+
+void vk_test::BindlessTextureTable::releaseRetired() {
+    std::erase_if(m_RetiredSlots, [&](const RetiredSlot& retired) {
+        if (retired.semaphore_state.isValid() && !retired.semaphore_state.testSignaled(m_Device)) {
+            return false;
+        }
+        m_FreeSlots.push_back(retired.slot);
+        return true;
+    });
+}
+
+uint32_t vk_test::BindlessTextureTable::flush() {
+    if (m_DirtySlots.empty()) {
+        return 0;
+    }
+
+    // Consecutive slots share one write, as when a scene adds its textures at once
+    std::ranges::sort(m_DirtySlots);
+
+    WriteSetContainer write{};
+    size_t            first = 0;
+    while (first < m_DirtySlots.size()) {
+        size_t last = first + 1;
+        while (last < m_DirtySlots.size() && m_DirtySlots[last] == m_DirtySlots[last - 1] + 1) {
+            last++;
+        }
+
+        const uint32_t slot  = m_DirtySlots[first];
+        const uint32_t count = uint32_t(last - first);
+        write.append(m_DescPack.makeWrite(m_Binding, 0, slot, count), &m_ImageInfos[slot]);
+        first = last;
+    }
+    vkUpdateDescriptorSets(m_Device, write.size(), write.data(), 0, nullptr);
+
+    for (uint32_t slot : m_DirtySlots) {
+        m_IsDirty[slot] = false;
+    }
+    const uint32_t written = uint32_t(m_DirtySlots.size());
+    m_DirtySlots.clear();
+    m_WriteCount += written;
+    return written;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Usage example
+//--------------------------------------------------------------------------------------------------
+[[maybe_unused]] static void usage_BindlessTextureTable() {
+    vk_test::Application*         app{};     // The application
+    std::vector<vk_test::Image>   textures;  // Loaded textures, with their sampler
+    std::vector<int>              materials; // Texture slot per material, as in GltfMetallicRoughness::baseColorTextureIndex
+    VkCommandBuffer               cmd{};
+    VkPipelineLayout              pipeline_layout{}; // Created with texture_table.getLayout() as set 0
+    vk_test::BindlessTextureTable texture_table;
+
+    // Shader side : [[vk::binding(0)]] Sampler2D textures[];
+    texture_table.init(app->getDevice(), app->getPhysicalDevice(), 0);
+
+    for (const vk_test::Image& texture : textures) {
+        materials.push_back(int(texture_table.allocateSlot(texture)));
+    }
+
+    // Once per frame, before recording : only the new or changed slots are written
+    texture_table.flush();
+
+    const VkBindDescriptorSetsInfo bind_info{ .sType              = VK_STRUCTURE_TYPE_BIND_DESCRIPTOR_SETS_INFO,
+                                              .stageFlags         = VK_SHADER_STAGE_ALL,
+                                              .layout             = pipeline_layout,
+                                              .firstSet           = 0,
+                                              .descriptorSetCount = 1,
+                                              .pDescriptorSets    = texture_table.getSetPtr() };
+    vkCmdBindDescriptorSets2(cmd, &bind_info);
+
+    // A texture going away, its slot is reused once the current frame has completed
+    texture_table.freeSlot(uint32_t(materials[0]), app->getFrameSemaphoreState());
+
+    texture_table.deinit();
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "descriptors.hpp"
+#include "semaphore.hpp"
+
+//-----------------------------------------------------------------
+// BindlessTextureTable is one descriptor set with a single, large,
+// variable count array of combined image samplers (`Sampler2D textures[]`
+// in the shaders), indexed directly by the materials.
+//
+// Slots are allocated and recycled through a free list. A freed slot is
+// only handed out again once the SemaphoreState given to freeSlot() is
+// signaled, so frames in flight never see it change under them.
+//
+// allocateSlot() and updateSlot() only record the descriptor, flush()
+// writes the changed slots with one write per run of consecutive slots.
+// The binding is PARTIALLY_BOUND and UPDATE_AFTER_BIND, so the set can
+// stay bound and unused slots can stay unwritten. It is also
+// UPDATE_UNUSED_WHILE_PENDING: a slot a frame in flight may sample must
+// not be rewritten, a new image goes to a new slot and the old one is
+// freed with the frame's SemaphoreState.
+//
+// Slot 0 is never allocated, materials use it for "no texture".
+//
+// Usage:
+//      see usage_BindlessTextureTable in bindless_textures.cpp
+//-----------------------------------------------------------------
+
+namespace vk_test {
+
+    class BindlessTextureTable {
+    public:
+        static constexpr uint32_t DEFAULT_CAPACITY = 65536;
+        static constexpr uint32_t NULL_SLOT        = 0;
+
+        BindlessTextureTable()                                       = default;
+        BindlessTextureTable(const BindlessTextureTable&)            = delete;
+        BindlessTextureTable& operator=(const BindlessTextureTable&) = delete;
+        ~BindlessTextureTable() { assert(m_Device == VK_NULL_HANDLE && "Missing deinit()"); }
+
+        // `capacity` is clamped to the update after bind limits of the device
+        VkResult init(VkDevice           device,
+                      VkPhysicalDevice   physical_device,
+                      uint32_t           binding,
+                      uint32_t           capacity    = DEFAULT_CAPACITY,
+                      VkShaderStageFlags stage_flags = VK_SHADER_STAGE_ALL);
+
+        // the device must be idle
+        void deinit();
+
+        // Returns NULL_SLOT when the table is full
+        uint32_t allocateSlot(const VkDescriptorImageInfo& image_info);
+        uint32_t allocateSlot(const Image& image) { return allocateSlot(image.descriptor); }
+
+        // The new descriptor is written by the next flush(), the slot must not be used by a pending command buffer
+        void updateSlot(uint32_t slot, const VkDescriptorImageInfo& image_info);
+        void updateSlot(uint32_t slot, const Image& image) { updateSlot(slot, image.descriptor); }
+
+        // The slot is recycled once `semaphore_state` is signaled, immediately when it is not valid
+        void freeSlot(uint32_t slot, const SemaphoreState& semaphore_state = {});
+
+        // Writes the slots changed since the last call, returns the number of descriptors written.
+        // Only slots no pending (submitted, not completed) command buffer uses may change: freshly allocated ones,
+        // or recycled ones, retired through freeSlot() until their SemaphoreState was signaled. Recording may go on.
+        uint32_t flush();
+
+        VkDescriptorSetLayout        getLayout() const { return m_DescPack.getLayout(); }
+        const VkDescriptorSetLayout* getLayoutPtr() const { return m_DescPack.getLayoutPtr(); }
+        VkDescriptorSet              getSet() const { return m_DescPack.getSet(0); }
+        const VkDescriptorSet*       getSetPtr() const { return m_DescPack.getSetPtr(0); }
+
+        uint32_t getCapacity() const { return m_Capacity; }
+        uint32_t getUsedCount() const { return m_NextSlot - 1 - uint32_t(m_FreeSlots.size() + m_RetiredSlots.size()); }
+        uint64_t getWriteCount() const { return m_WriteCount; }
+
+    private:
+        struct RetiredSlot {
+            uint32_t       slot = 0;
+            SemaphoreState semaphore_state;
+        };
+
+        void releaseRetired();
+
+        VkDevice       m_Device{};
+        DescriptorPack m_DescPack;
+        uint32_t       m_Binding  = 0;
+        uint32_t       m_Capacity = 0;
+        uint32_t       m_NextSlot = 1; // Slots below were allocated at least once
+
+        std::vector<VkDescriptorImageInfo> m_ImageInfos; // Per slot below m_NextSlot
+        std::vector<uint32_t>              m_FreeSlots;
+        std::vector<RetiredSlot>           m_RetiredSlots;
+
+        std::vector<uint32_t> m_DirtySlots;
+        std::vector<bool>     m_IsDirty;
+        uint64_t              m_WriteCount = 0;
+    };
+
+} // namespace vk_test
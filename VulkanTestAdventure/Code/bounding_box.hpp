@@ -91,18 +91,19 @@ namespace vk_test {
             const float epsilon = 1e-6F;
             assert(fabs(r.x) < epsilon && fabs(r.y) < epsilon && fabs(r.z) < epsilon && fabs(r.w - 1.0F) < epsilon);
 
-            std::vector<glm::vec3> corners(8);
-            corners[0] = glm::vec3(mat * glm::vec4(m_min.x, m_min.y, m_min.z, 1.F));
-            corners[1] = glm::vec3(mat * glm::vec4(m_min.x, m_min.y, m_max.z, 1.F));
-            corners[2] = glm::vec3(mat * glm::vec4(m_min.x, m_max.y, m_min.z, 1.F));
-            corners[3] = glm::vec3(mat * glm::vec4(m_min.x, m_max.y, m_max.z, 1.F));
-            corners[4] = glm::vec3(mat * glm::vec4(m_max.x, m_min.y, m_min.z, 1.F));
-            corners[5] = glm::vec3(mat * glm::vec4(m_max.x, m_min.y, m_max.z, 1.F));
-            corners[6] = glm::vec3(mat * glm::vec4(m_max.x, m_max.y, m_min.z, 1.F));
-            corners[7] = glm::vec3(mat * glm::vec4(m_max.x, m_max.y, m_max.z, 1.F));
-
-            Bbox result(corners);
-            return result;
+            if (isEmpty()) {
+                return *this;
+            }
+
+            // Center and half extents, each axis of the result gets the absolute contribution of the 3 axes (Arvo)
+            const glm::vec3 center  = glm::vec3(mat * glm::vec4(this->center(), 1.F));
+            const glm::vec3 extents = (m_max - m_min) * 0.5F;
+            glm::vec3       half{ 0.F };
+            for (int column = 0; column < 3; column++) {
+                half += glm::abs(glm::vec3(mat[column])) * extents[column];
+            }
+
+            return Bbox(center - half, center + half);
         }
 
     private:
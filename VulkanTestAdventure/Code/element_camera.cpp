@@ -99,10 +99,20 @@
 
 void vk_test::ElementCamera::onAttach(vk_test::Application* app) {
     VK_TEST_SAY("Adding Camera Manipulator");
+    m_App = app;
 }
 
 void vk_test::ElementCamera::onUIRender() {
     assert(m_CameraManipulator && "Missing setCamera");
+
+    // During a benchmark, the camera follows its path, set without animation so it only depends on the frame
+    const Benchmark&          benchmark = m_App->getBenchmark();
+    CameraManipulator::Camera camera;
+    if (benchmark.isRunning() && benchmark.getCamera(camera)) {
+        m_CameraManipulator->setCamera(camera, true);
+        return;
+    }
+
     //updateCamera(m_CameraManipulator, ImGui::FindWindowByName("Viewport"));
 }
 
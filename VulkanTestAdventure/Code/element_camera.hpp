@@ -54,6 +54,7 @@ namespace vk_test {
         //static void updateCamera(std::shared_ptr<CameraManipulator> m_CameraManipulator, ImGuiWindow* viewportWindow);
 
     private:
+        Application*                       m_App{};
         std::shared_ptr<CameraManipulator> m_CameraManipulator{};
     };
 
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2023-2025, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2025, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+* Modified by Farrakh
+* 2025
+*/
+
+#include "pch.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>    // open
+#include <sys/mman.h> // mmap
+#include <sys/stat.h> // fstat
+#include <unistd.h>   // close
+#endif
+
+#include "file_mapping.hpp"
+#include "file_operations.hpp"
+
+namespace vk_test {
+
+    FileReadMapping::FileReadMapping(FileReadMapping&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    FileReadMapping& FileReadMapping::operator=(FileReadMapping&& other) noexcept {
+        if (this != &other) {
+            close();
+            std::swap(m_Data, other.m_Data);
+            std::swap(m_Size, other.m_Size);
+#ifdef _WIN32
+            std::swap(m_FileHandle, other.m_FileHandle);
+            std::swap(m_MappingHandle, other.m_MappingHandle);
+#else
+            std::swap(m_FileDescriptor, other.m_FileDescriptor);
+#endif
+        }
+        return *this;
+    }
+
+    bool FileReadMapping::open(const std::filesystem::path& file_path) {
+        close();
+
+#ifdef _WIN32
+        HANDLE file = CreateFileW(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+
+        LARGE_INTEGER file_size{};
+        if (GetFileSizeEx(file, &file_size) == FALSE || file_size.QuadPart == 0) {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr) {
+            CloseHandle(file);
+            return false;
+        }
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (view == nullptr) {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        m_FileHandle    = file;
+        m_MappingHandle = mapping;
+        m_Data          = static_cast<const uint8_t*>(view);
+        m_Size          = size_t(file_size.QuadPart);
+#else
+        int fd = ::open(utf8FromPath(file_path).c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+
+        struct stat file_stat{};
+        if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+            ::close(fd);
+            return false;
+        }
+
+        void* view = mmap(nullptr, size_t(file_stat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view == MAP_FAILED) {
+            ::close(fd);
+            return false;
+        }
+
+        m_FileDescriptor = fd;
+        m_Data           = static_cast<const uint8_t*>(view);
+        m_Size           = size_t(file_stat.st_size);
+#endif
+        return true;
+    }
+
+    void FileReadMapping::close() {
+#ifdef _WIN32
+        if (m_Data != nullptr) {
+            UnmapViewOfFile(m_Data);
+        }
+        if (m_MappingHandle != nullptr) {
+            CloseHandle(m_MappingHandle);
+        }
+        if (m_FileHandle != nullptr) {
+            CloseHandle(m_FileHandle);
+        }
+        m_FileHandle    = nullptr;
+        m_MappingHandle = nullptr;
+#else
+        if (m_Data != nullptr) {
+            munmap(const_cast<uint8_t*>(m_Data), m_Size);
+        }
+        if (m_FileDescriptor >= 0) {
+            ::close(m_FileDescriptor);
+        }
+        m_FileDescriptor = -1;
+#endif
+        m_Data = nullptr;
+        m_Size = 0;
+    }
+
+} // namespace vk_test
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2023-2025, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2025, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+* Modified by Farrakh
+* 2025
+*/
+
+#pragma once
+
+namespace vk_test {
+
+    //-----------------------------------------------------------------------------
+    // Read-only memory mapping of a whole file.
+    // The content is paged in on access by the OS, so large files do not need
+    // an intermediate copy into a std::vector / std::string.
+    //
+    // Usage:
+    //      FileReadMapping mapping;
+    //      if (mapping.open(path)) {
+    //          const uint8_t* bytes = mapping.data();
+    //          ... use bytes[0 .. mapping.size()) ...
+    //      }
+    //      mapping.close(); // also done by the destructor
+    //-----------------------------------------------------------------------------
+    class FileReadMapping {
+    public:
+        FileReadMapping() = default;
+        ~FileReadMapping() { close(); }
+
+        FileReadMapping(const FileReadMapping&)            = delete;
+        FileReadMapping& operator=(const FileReadMapping&) = delete;
+        FileReadMapping(FileReadMapping&& other) noexcept;
+        FileReadMapping& operator=(FileReadMapping&& other) noexcept;
+
+        // Returns false if the file doesn't exist, is empty or cannot be mapped
+        bool open(const std::filesystem::path& file_path);
+        void close();
+
+        bool           isValid() const { return m_Data != nullptr; }
+        const uint8_t* data() const { return m_Data; }
+        size_t         size() const { return m_Size; }
+
+    private:
+        const uint8_t* m_Data = nullptr;
+        size_t         m_Size = 0;
+
+#ifdef _WIN32
+        void* m_FileHandle    = nullptr;
+        void* m_MappingHandle = nullptr;
+#else
+        int m_FileDescriptor = -1;
+#endif
+    };
+
+} // namespace vk_test
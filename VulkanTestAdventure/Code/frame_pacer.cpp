@@ -0,0 +1,191 @@
+#include "pch.h"
+#include "frame_pacer.hpp"
+
+// Rises at once to a longer sample, decays slowly to a shorter one
+static void predict(double& prediction, double sample) {
+    prediction = sample > prediction ? sample : prediction + (sample - prediction) * 0.05;
+}
+
+void vk_test::FramePacer::init(VkDevice device, VkSemaphore timeline_semaphore, const Settings& settings) {
+    assert(!m_Device);
+    m_Device            = device;
+    m_TimelineSemaphore = timeline_semaphore;
+    m_Settings          = settings;
+
+    m_Timings        = {};
+    m_LastCompleted  = {};
+    m_FirstPending   = 0;
+    m_LastSubmitted  = 0;
+    m_GpuFrameTime   = 0.0;
+    m_CpuFrameTime   = 0.0;
+    m_AverageLatency = 0.0;
+    m_AverageSleep   = 0.0;
+    m_CompletedCount = 0;
+    m_Clock.reset();
+}
+
+void vk_test::FramePacer::deinit() {
+    m_Device            = VK_NULL_HANDLE;
+    m_TimelineSemaphore = VK_NULL_HANDLE;
+}
+
+void vk_test::FramePacer::pace() {
+    assert(m_Device != VK_NULL_HANDLE && "Missing init()");
+    m_SleepTime = 0.0;
+
+    const uint64_t previous = m_LastSubmitted - 1;
+    if (!m_Settings.low_latency || m_LastSubmitted == 0 || getTiming(previous).timeline_value != previous) {
+        observeCompletions(0);
+        m_InputTime = m_Clock.getSeconds();
+        return;
+    }
+
+    // The frame before the last submitted one must be done, so at most one frame waits in the queue
+    observeCompletions(previous);
+
+    if (m_FirstPending <= m_LastSubmitted) {
+        // Sampling the input so the next submit lands just before the last submitted frame completes
+        const FrameTiming& last                 = getTiming(m_LastSubmitted);
+        const double       predicted_completion = std::max(getTiming(previous).completion_time, last.submit_time) + m_GpuFrameTime;
+        const double       input_time           = predicted_completion - m_CpuFrameTime - m_Settings.margin_ms * 1e-3;
+
+        const double now = m_Clock.getSeconds();
+        if (input_time > now) {
+            sleepUntil(std::min(input_time, now + m_Settings.max_sleep_ms * 1e-3));
+            m_SleepTime = m_Clock.getSeconds() - now;
+        }
+    }
+    m_InputTime = m_Clock.getSeconds();
+}
+
+void vk_test::FramePacer::frameSubmitted(uint64_t timeline_value) {
+    assert(timeline_value > m_LastSubmitted && "The frames must signal increasing values");
+
+    getTiming(timeline_value) = {
+        .timeline_value = timeline_value,
+        .input_time     = m_InputTime,
+        .submit_time    = m_Clock.getSeconds(),
+        .sleep_time     = m_SleepTime,
+    };
+    const FrameTiming& timing = getTiming(timeline_value);
+    predict(m_CpuFrameTime, timing.submit_time - timing.input_time);
+
+    if (m_LastSubmitted == 0) {
+        m_FirstPending = timeline_value;
+    }
+    m_LastSubmitted = timeline_value;
+    assert(m_LastSubmitted - m_FirstPending < HISTORY_SIZE && "More frames in flight than HISTORY_SIZE");
+}
+
+vk_test::FramePacer::Stats vk_test::FramePacer::getStats() const {
+    Stats stats{
+        .latency_ms   = m_AverageLatency * 1e3,
+        .gpu_frame_ms = m_GpuFrameTime * 1e3,
+        .cpu_frame_ms = m_CpuFrameTime * 1e3,
+        .sleep_ms     = m_AverageSleep * 1e3,
+        .frame_count  = m_CompletedCount,
+    };
+    for (const FrameTiming& timing : m_Timings) {
+        if (timing.timeline_value != 0 && timing.timeline_value < m_FirstPending) {
+            stats.max_latency_ms = std::max(stats.max_latency_ms, timing.getLatency() * 1e3);
+        }
+    }
+    return stats;
+}
+
+void vk_test::FramePacer::observeCompletions(uint64_t wait_value) {
+    if (m_LastSubmitted == 0) {
+        return;
+    }
+
+    uint64_t completed = 0;
+    vkGetSemaphoreCounterValue(m_Device, m_TimelineSemaphore, &completed);
+
+    // Only a frame we had to wait for gets its actual completion time
+    bool waited = false;
+    if (wait_value > completed) {
+        const VkSemaphoreWaitInfo wait_info{
+            .sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+            .semaphoreCount = 1,
+            .pSemaphores    = &m_TimelineSemaphore,
+            .pValues        = &wait_value,
+        };
+        vkWaitSemaphores(m_Device, &wait_info, std::numeric_limits<uint64_t>::max());
+        completed = wait_value;
+        waited    = true;
+    }
+
+    const double now = m_Clock.getSeconds();
+    for (; m_FirstPending <= std::min(completed, m_LastSubmitted); m_FirstPending++) {
+        FrameTiming& timing    = getTiming(m_FirstPending);
+        timing.completion_time = now;
+        timing.is_precise      = waited && m_FirstPending == wait_value;
+        frameCompleted(timing);
+    }
+}
+
+void vk_test::FramePacer::frameCompleted(FrameTiming& timing) {
+    // The GPU started the frame at the previous completion, or at the submit if it was idle in between.
+    // An upper bound on the previous completion would give a too short frame.
+    const FrameTiming& previous = getTiming(timing.timeline_value - 1);
+    if (timing.is_precise) {
+        if (previous.timeline_value != timing.timeline_value - 1) {
+            predict(m_GpuFrameTime, timing.completion_time - timing.submit_time);
+        }
+        else if (previous.is_precise || timing.submit_time >= previous.completion_time) {
+            predict(m_GpuFrameTime, timing.completion_time - std::max(previous.completion_time, timing.submit_time));
+        }
+    }
+
+    m_AverageLatency = m_CompletedCount == 0 ? timing.getLatency() : m_AverageLatency + (timing.getLatency() - m_AverageLatency) * 0.1;
+    m_AverageSleep   = m_CompletedCount == 0 ? timing.sleep_time : m_AverageSleep + (timing.sleep_time - m_AverageSleep) * 0.1;
+    m_CompletedCount++;
+    m_LastCompleted = timing;
+}
+
+void vk_test::FramePacer::sleepUntil(double time) {
+    // sleep_for() can overshoot by a scheduler period, the end is spent yielding
+    while (true) {
+        const double now = m_Clock.getSeconds();
+        if (now >= time) {
+            return;
+        }
+        if (time - now > m_SleepGranularity) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            predict(m_SleepGranularity, m_Clock.getSeconds() - now);
+        }
+        else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+// Usage example
+//--------------------------------------------------------------------------------------------------
+[[maybe_unused]] static void usage_FramePacer() {
+    VkDevice    device{};
+    VkSemaphore frame_timeline_semaphore{}; // Signaled by each frame submit
+    GLFWwindow* window{};
+    uint64_t    frame_number = 0;
+
+    vk_test::FramePacer frame_pacer;
+    frame_pacer.init(device, frame_timeline_semaphore);
+
+    while (!glfwWindowShouldClose(window)) {
+        frame_pacer.pace(); // Sleeps until the input is needed
+        glfwPollEvents();
+
+        // ... record the frame, submit it signaling ++frame_number, present
+        frame_pacer.frameSubmitted(frame_number);
+
+        const vk_test::FramePacer::FrameTiming& timing = frame_pacer.getLastFrameTiming();
+        VK_TEST_SAY("Frame " << timing.timeline_value << " : " << timing.getLatency() * 1e3 << " ms from the input to the GPU completion");
+    }
+
+    // Averages, and the predictions used for the sleep
+    const vk_test::FramePacer::Stats stats = frame_pacer.getStats();
+    VK_TEST_SAY("Latency " << stats.latency_ms << " ms, GPU frame " << stats.gpu_frame_ms << " ms, slept " << stats.sleep_ms << " ms");
+
+    frame_pacer.deinit();
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "timers.hpp"
+
+//-----------------------------------------------------------------
+// FramePacer delays the input sampling of the Application loop so a
+// frame is recorded just in time, instead of queuing behind the frames
+// already in flight.
+//
+// The completion of each frame is observed on the frame timeline
+// semaphore. pace() waits for the frame before the last submitted one,
+// then sleeps until the last submitted one is predicted to complete,
+// minus the time the CPU needs from the input to the submit and a
+// margin. The GPU is then never left without a frame, while at most one
+// frame waits in the queue.
+//
+// The GPU frame time is predicted from the completion timestamps (the
+// spacing of completions, or completion minus submit when the GPU went
+// idle), so it includes the wait for the swapchain image with FIFO.
+// Both predictions rise at once and decay slowly, a spike does not drop
+// the next frames.
+//
+// The latency reported per frame goes from the input sampling to the
+// observed GPU completion, the presentation engine adds its own queue
+// on top (at most one refresh with MAILBOX or IMMEDIATE). Completions
+// are only timed precisely when pace() had to wait for them, otherwise
+// the latency is an upper bound (see FrameTiming::is_precise).
+//
+// With low latency off, pace() never waits and only collects the timings.
+//
+// Usage:
+//      see usage_FramePacer in frame_pacer.cpp
+//-----------------------------------------------------------------
+
+namespace vk_test {
+
+    class FramePacer {
+    public:
+        struct Settings {
+            bool   low_latency  = true;
+            double margin_ms    = 1.0;   // Kept between the predicted completion and the next submit
+            double max_sleep_ms = 100.0; // Bound of a single pace(), for a wrong prediction
+        };
+
+        // All times in seconds since init()
+        struct FrameTiming {
+            uint64_t timeline_value  = 0;
+            double   input_time      = 0.0;   // pace() returned, the input is sampled after
+            double   submit_time     = 0.0;
+            double   completion_time = 0.0;   // Observed on the timeline semaphore
+            double   sleep_time      = 0.0;   // Slept by pace() before the input
+            bool     is_precise      = false; // completion_time was measured by waiting on it
+
+            double getLatency() const { return completion_time - input_time; }
+        };
+
+        struct Stats {
+            double   latency_ms     = 0.0; // Average input to GPU completion
+            double   max_latency_ms = 0.0; // Over the last HISTORY_SIZE frames
+            double   gpu_frame_ms   = 0.0; // Predicted
+            double   cpu_frame_ms   = 0.0; // Predicted, input to submit
+            double   sleep_ms       = 0.0; // Average
+            uint64_t frame_count    = 0;   // Frames seen completed
+        };
+
+        static constexpr uint32_t HISTORY_SIZE = 64;
+
+        FramePacer()                             = default;
+        FramePacer(const FramePacer&)            = delete;
+        FramePacer& operator=(const FramePacer&) = delete;
+        ~FramePacer() { assert(m_Device == VK_NULL_HANDLE && "Missing deinit()"); }
+
+        // `timeline_semaphore` is signaled with one increasing value per frame
+        void init(VkDevice device, VkSemaphore timeline_semaphore, const Settings& settings = {});
+        void deinit();
+
+        void            setSettings(const Settings& settings) { m_Settings = settings; }
+        const Settings& getSettings() const { return m_Settings; }
+
+        // Call before polling the input of a frame
+        void pace();
+
+        // Call after the submit signaling `timeline_value`
+        void frameSubmitted(uint64_t timeline_value);
+
+        // The most recently completed frame, timeline_value is 0 until then
+        const FrameTiming& getLastFrameTiming() const { return m_LastCompleted; }
+        Stats              getStats() const;
+
+    private:
+        FrameTiming& getTiming(uint64_t timeline_value) { return m_Timings[timeline_value % HISTORY_SIZE]; }
+
+        // Marks the submitted frames up to the semaphore value as completed, waits for `wait_value` first
+        void observeCompletions(uint64_t wait_value);
+        void frameCompleted(FrameTiming& timing);
+        void sleepUntil(double time);
+
+        VkDevice         m_Device{};
+        VkSemaphore      m_TimelineSemaphore{};
+        Settings         m_Settings;
+        PerformanceTimer m_Clock;
+
+        std::array<FrameTiming, HISTORY_SIZE> m_Timings{};
+        FrameTiming                           m_LastCompleted;
+        uint64_t                              m_FirstPending  = 0; // Oldest submitted frame not seen completed
+        uint64_t                              m_LastSubmitted = 0;
+        double                                m_InputTime     = 0.0;
+        double                                m_SleepTime     = 0.0;
+
+        double   m_GpuFrameTime     = 0.0; // Predictions, in seconds
+        double   m_CpuFrameTime     = 0.0;
+        double   m_SleepGranularity = 0.002; // Longest observed sleep_for(1ms), below it pace() spins
+        double   m_AverageLatency   = 0.0;
+        double   m_AverageSleep     = 0.0;
+        uint64_t m_CompletedCount   = 0;
+    };
+
+} // namespace vk_test
@@ -0,0 +1,405 @@
+#include "pch.h"
+#include "gpu_draws.hpp"
+
+#include <barriers.hpp>
+#include <compute_pipeline.hpp>
+
+static_assert(sizeof(shaderio::DrawIndexedCommand) == sizeof(VkDrawIndexedIndirectCommand));
+
+// Empty bounds (min > max) are kept as is, the shader treats them as always visible
+static shaderio::InstanceBounds toInstanceBounds(const vk_test::Bbox& bbox) {
+    return { .bboxMin = glm::vec4(bbox.min(), 0.0F), .bboxMax = glm::vec4(bbox.max(), 0.0F) };
+}
+
+VkResult vk_test::GpuDrawBuilder::init(ResourceAllocator* alloc, std::span<const uint32_t> spirv, uint32_t frame_cycle_size) {
+    assert(!m_Device);
+    m_Alloc  = alloc;
+    m_Device = alloc->getDevice();
+
+    // Counters and their readback slots
+    alloc->createBuffer(m_CullingStatsBuffer, sizeof(shaderio::CullingStats), VK_BUFFER_USAGE_2_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_2_TRANSFER_SRC_BIT);
+    alloc->createBuffer(m_CullingStatsReadback,
+                        sizeof(shaderio::CullingStats) * frame_cycle_size,
+                        VK_BUFFER_USAGE_2_TRANSFER_DST_BIT,
+                        VMA_MEMORY_USAGE_AUTO_PREFER_HOST,
+                        VMA_ALLOCATION_CREATE_MAPPED_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT);
+    m_ReadbackPending.assign(frame_cycle_size, false);
+
+    // The Hi-Z images are pushed, everything else is accessed through buffer addresses
+    DescriptorBindings bindings;
+    bindings.addBinding(shaderio::HizBinding::eHizInput, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 1, VK_SHADER_STAGE_COMPUTE_BIT);
+    bindings.addBinding(shaderio::HizBinding::eHizOutput, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1, VK_SHADER_STAGE_COMPUTE_BIT);
+    m_HizDescriptorPack.init(bindings, m_Device, 0, VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR);
+
+    const VkPushConstantRange push_constant_range{
+        .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+        .size       = sizeof(shaderio::DrawBuildPushConstant),
+    };
+    VkPipelineLayoutCreateInfo pipeline_layout_info{
+        .sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+        .setLayoutCount         = 1,
+        .pSetLayouts            = m_HizDescriptorPack.getLayoutPtr(),
+        .pushConstantRangeCount = 1,
+        .pPushConstantRanges    = &push_constant_range,
+    };
+    VkResult result = vkCreatePipelineLayout(m_Device, &pipeline_layout_info, nullptr, &m_PipelineLayout);
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+
+    // The Hi-Z reduction reads its sizes from the views
+    pipeline_layout_info.pushConstantRangeCount = 0;
+    pipeline_layout_info.pPushConstantRanges    = nullptr;
+    result                                      = vkCreatePipelineLayout(m_Device, &pipeline_layout_info, nullptr, &m_HizPipelineLayout);
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+
+    VkComputePipelineCreateInfo comp_info   = { VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO };
+    VkShaderModuleCreateInfo    shader_info = { VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO };
+    comp_info.stage                         = { VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO };
+    comp_info.stage.stage                   = VK_SHADER_STAGE_COMPUTE_BIT;
+    comp_info.stage.pNext                   = &shader_info;
+
+    shader_info.codeSize = spirv.size_bytes();
+    shader_info.pCode    = spirv.data();
+
+    comp_info.stage.pName = "buildDraws";
+    comp_info.layout      = m_PipelineLayout;
+    result                = vkCreateComputePipelines(m_Device, nullptr, 1, &comp_info, nullptr, &m_BuildDrawsPipeline);
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+
+    comp_info.stage.pName = "buildHiz";
+    comp_info.layout      = m_HizPipelineLayout;
+    return vkCreateComputePipelines(m_Device, nullptr, 1, &comp_info, nullptr, &m_BuildHizPipeline);
+}
+
+void vk_test::GpuDrawBuilder::deinit() {
+    if (m_Device == nullptr) {
+        return;
+    }
+
+    destroyBuffers();
+    destroyHiz();
+    m_Alloc->destroyBuffer(m_CullingStatsBuffer);
+    m_Alloc->destroyBuffer(m_CullingStatsReadback);
+    m_ReadbackPending.clear();
+
+    vkDestroyPipeline(m_Device, m_BuildDrawsPipeline, nullptr);
+    vkDestroyPipeline(m_Device, m_BuildHizPipeline, nullptr);
+    vkDestroyPipelineLayout(m_Device, m_PipelineLayout, nullptr);
+    vkDestroyPipelineLayout(m_Device, m_HizPipelineLayout, nullptr);
+    m_HizDescriptorPack.deinit();
+
+    m_BuildDrawsPipeline = VK_NULL_HANDLE;
+    m_BuildHizPipeline   = VK_NULL_HANDLE;
+    m_PipelineLayout     = VK_NULL_HANDLE;
+    m_HizPipelineLayout  = VK_NULL_HANDLE;
+    m_Device             = VK_NULL_HANDLE;
+}
+
+void vk_test::GpuDrawBuilder::destroyBuffers() {
+    m_Alloc->destroyBuffer(m_MeshDrawGroups);
+    m_Alloc->destroyBuffer(m_DrawCommands);
+    m_Alloc->destroyBuffer(m_DrawCounts);
+    m_Alloc->destroyBuffer(m_InstanceBounds);
+    m_Alloc->destroyBuffer(m_VisibleInstances);
+    m_DrawGroups.clear();
+    m_InstanceCount = 0;
+}
+
+void vk_test::GpuDrawBuilder::destroyHiz() {
+    for (VkImageView view : m_HizMipViews) {
+        vkDestroyImageView(m_Device, view, nullptr);
+    }
+    m_HizMipViews.clear();
+    m_Alloc->destroyImage(m_Hiz);
+    m_HizValid = false;
+}
+
+//----------------------------------
+// A draw group can only use one index buffer binding, so meshes are grouped by
+// (glTF buffer, index type). Each group reserves one command slot per instance
+// of its meshes, the compute pass fills them in any order.
+//
+void vk_test::GpuDrawBuilder::setScene(const GltfSceneResource& scene, StagingUploader& staging_uploader) {
+    destroyBuffers();
+    if (scene.instances.empty()) {
+        return;
+    }
+
+    std::vector<shaderio::MeshDrawGroup>         mesh_draw_groups(scene.meshes.size());
+    std::map<std::pair<uint32_t, int>, uint32_t> group_lookup; // (buffer index, index type) -> draw group
+    for (size_t mesh_id = 0; mesh_id < scene.meshes.size(); mesh_id++) {
+        const uint32_t buffer_index = scene.mesh_to_buffer_index[mesh_id];
+        const int      index_type   = scene.meshes[mesh_id].indexType;
+
+        auto [it, inserted] = group_lookup.try_emplace({ buffer_index, index_type }, uint32_t(m_DrawGroups.size()));
+        if (inserted) {
+            m_DrawGroups.push_back({ .index_buffer = scene.b_gltf_datas[buffer_index].buffer, .index_type = VkIndexType(index_type) });
+        }
+        mesh_draw_groups[mesh_id].group = it->second;
+    }
+
+    // Size each group by the number of instances referencing its meshes
+    for (const shaderio::GltfInstance& instance : scene.instances) {
+        m_DrawGroups[mesh_draw_groups[instance.meshIndex].group].max_draws++;
+    }
+    uint32_t first_command = 0;
+    for (DrawGroup& group : m_DrawGroups) {
+        group.first_command = first_command;
+        first_command += group.max_draws;
+    }
+    for (shaderio::MeshDrawGroup& mesh_draw_group : mesh_draw_groups) {
+        mesh_draw_group.firstCommand = m_DrawGroups[mesh_draw_group.group].first_command;
+    }
+    m_InstanceCount = uint32_t(scene.instances.size());
+
+    // Instances without bounds are never culled
+    assert(scene.instance_bounds.size() == scene.instances.size() && "Missing updateInstanceBounds()");
+    std::vector<shaderio::InstanceBounds> instance_bounds(m_InstanceCount);
+    for (uint32_t i = 0; i < m_InstanceCount && i < scene.instance_bounds.size(); i++) {
+        instance_bounds[i] = toInstanceBounds(scene.instance_bounds[i]);
+    }
+
+    m_Alloc->createBuffer(m_MeshDrawGroups, std::span(mesh_draw_groups).size_bytes(), VK_BUFFER_USAGE_2_STORAGE_BUFFER_BIT);
+    m_Alloc->createBuffer(m_DrawCommands,
+                          sizeof(shaderio::DrawIndexedCommand) * m_InstanceCount,
+                          VK_BUFFER_USAGE_2_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_2_INDIRECT_BUFFER_BIT);
+    m_Alloc->createBuffer(m_DrawCounts,
+                          sizeof(uint32_t) * m_DrawGroups.size(),
+                          VK_BUFFER_USAGE_2_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_2_INDIRECT_BUFFER_BIT);
+    m_Alloc->createBuffer(m_InstanceBounds, std::span(instance_bounds).size_bytes(), VK_BUFFER_USAGE_2_STORAGE_BUFFER_BIT);
+    m_Alloc->createBuffer(m_VisibleInstances, sizeof(uint32_t) * m_InstanceCount, VK_BUFFER_USAGE_2_STORAGE_BUFFER_BIT);
+    staging_uploader.appendBuffer(m_MeshDrawGroups, 0, std::span(mesh_draw_groups));
+    staging_uploader.appendBuffer(m_InstanceBounds, 0, std::span(instance_bounds));
+}
+
+void vk_test::GpuDrawBuilder::cmdUpdateInstanceBounds(VkCommandBuffer cmd, const GltfSceneResource& scene, uint32_t first, uint32_t count) {
+    assert(first + count <= m_InstanceCount);
+    std::vector<shaderio::InstanceBounds> instance_bounds(count);
+    for (uint32_t i = 0; i < count; i++) {
+        instance_bounds[i] = toInstanceBounds(scene.instance_bounds[first + i]);
+    }
+    vkCmdUpdateBuffer(cmd, m_InstanceBounds.buffer, first * sizeof(shaderio::InstanceBounds), std::span(instance_bounds).size_bytes(), instance_bounds.data());
+}
+
+//----------------------------------
+// The pyramid has a full mip chain, mip 0 is the size of the depth buffer.
+// Each mip has its own view to be written as a storage image, the full view is read by the culling.
+//
+void vk_test::GpuDrawBuilder::setHizSize(VkCommandBuffer cmd, const VkExtent2D& size) {
+    destroyHiz();
+
+    const uint32_t          mip_levels = uint32_t(std::floor(std::log2(std::max(size.width, size.height)))) + 1;
+    const VkImageCreateInfo create_info{
+        .sType       = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+        .imageType   = VK_IMAGE_TYPE_2D,
+        .format      = VK_FORMAT_R32_SFLOAT,
+        .extent      = { size.width, size.height, 1 },
+        .mipLevels   = mip_levels,
+        .arrayLayers = 1,
+        .samples     = VK_SAMPLE_COUNT_1_BIT,
+        .usage       = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_STORAGE_BIT,
+    };
+    VkImageViewCreateInfo view_info{
+        .sType            = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+        .viewType         = VK_IMAGE_VIEW_TYPE_2D,
+        .format           = VK_FORMAT_R32_SFLOAT,
+        .subresourceRange = { .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT, .levelCount = mip_levels, .layerCount = 1 },
+    };
+    m_Alloc->createImage(m_Hiz, create_info, view_info);
+    m_Hiz.descriptor.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+
+    view_info.image                       = m_Hiz.image;
+    view_info.subresourceRange.levelCount = 1;
+    m_HizMipViews.resize(mip_levels);
+    for (uint32_t mip = 0; mip < mip_levels; mip++) {
+        view_info.subresourceRange.baseMipLevel = mip;
+        vkCreateImageView(m_Device, &view_info, nullptr, &m_HizMipViews[mip]);
+    }
+
+    cmdImageMemoryBarrier(cmd, { m_Hiz.image, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL });
+}
+
+void vk_test::GpuDrawBuilder::cmdBuildDraws(VkCommandBuffer cmd, const GltfSceneResource& scene, uint32_t frame_index) {
+    // This frame slot is done, its counters can be read
+    if (m_ReadbackPending[frame_index]) {
+        m_Alloc->autoInvalidateBuffer(m_CullingStatsReadback, frame_index * sizeof(shaderio::CullingStats), sizeof(shaderio::CullingStats));
+        memcpy(&m_CullingStats, m_CullingStatsReadback.mapping + frame_index * sizeof(shaderio::CullingStats), sizeof(shaderio::CullingStats));
+        m_ReadbackPending[frame_index] = false;
+    }
+
+    if (m_InstanceCount == 0) {
+        return;
+    }
+
+    // The previous frame must be done reading the commands before they are reset
+    cmdMemoryBarrier(cmd, VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_ACCESS_2_NONE, VK_ACCESS_2_NONE);
+    vkCmdFillBuffer(cmd, m_DrawCounts.buffer, 0, VK_WHOLE_SIZE, 0);
+    vkCmdFillBuffer(cmd, m_CullingStatsBuffer.buffer, 0, VK_WHOLE_SIZE, 0);
+
+    // Also covers the scene, instance and bounds updates recorded before
+    cmdMemoryBarrier(cmd,
+                     VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+                     VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                     VK_ACCESS_2_TRANSFER_WRITE_BIT,
+                     VK_ACCESS_2_SHADER_STORAGE_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT);
+
+    // Without a pyramid yet, only the frustum can cull
+    uint32_t culling_flags = m_CullingFlags;
+    if (!m_HizValid) {
+        culling_flags &= ~uint32_t(CULLING_OCCLUSION);
+    }
+
+    const shaderio::DrawBuildPushConstant push_values{
+        .hizViewProjMatrix = m_HizViewProj,
+        .sceneInfoAddress  = (shaderio::GltfSceneInfo*) scene.b_scene_info.address,
+        .meshDrawGroups    = (shaderio::MeshDrawGroup*) m_MeshDrawGroups.address,
+        .drawCommands      = (shaderio::DrawIndexedCommand*) m_DrawCommands.address,
+        .drawCounts        = (uint32_t*) m_DrawCounts.address,
+        .instanceBounds    = (shaderio::InstanceBounds*) m_InstanceBounds.address,
+        .visibleInstances  = (uint32_t*) m_VisibleInstances.address,
+        .stats             = (shaderio::CullingStats*) m_CullingStatsBuffer.address,
+        .instanceCount     = m_InstanceCount,
+        .cullingFlags      = culling_flags,
+        .hizSize           = glm::ivec2(m_Hiz.extent.width, m_Hiz.extent.height),
+        .hizMipCount       = m_Hiz.mip_levels,
+        .lodScale          = m_LodScale,
+    };
+    vkCmdPushConstants(cmd, m_PipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(shaderio::DrawBuildPushConstant), &push_values);
+
+    // The pyramid is bound even when occlusion is off, a descriptor must be valid
+    if (m_Hiz.image != VK_NULL_HANDLE) {
+        WriteSetContainer write_set_container;
+        write_set_container.append(m_HizDescriptorPack.makeWrite(shaderio::HizBinding::eHizInput), m_Hiz);
+        vkCmdPushDescriptorSetKHR(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, m_PipelineLayout, 0, write_set_container.size(), write_set_container.data());
+    }
+
+    vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, m_BuildDrawsPipeline);
+    vkCmdDispatch(cmd, getGroupCounts(m_InstanceCount, GPU_DRAWS_WORKGROUP_SIZE), 1, 1);
+
+    cmdMemoryBarrier(cmd,
+                     VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                     VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+                     VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT,
+                     VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_2_TRANSFER_READ_BIT);
+
+    // Read back once the frame slot comes back
+    const VkBufferCopy region{ .srcOffset = 0, .dstOffset = frame_index * sizeof(shaderio::CullingStats), .size = sizeof(shaderio::CullingStats) };
+    vkCmdCopyBuffer(cmd, m_CullingStatsBuffer.buffer, m_CullingStatsReadback.buffer, 1, &region);
+    cmdMemoryBarrier(cmd, VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_PIPELINE_STAGE_2_HOST_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT, VK_ACCESS_2_HOST_READ_BIT);
+    m_ReadbackPending[frame_index] = true;
+}
+
+void vk_test::GpuDrawBuilder::cmdDraw(VkCommandBuffer cmd) const {
+    for (uint32_t group_id = 0; group_id < uint32_t(m_DrawGroups.size()); group_id++) {
+        const DrawGroup& group = m_DrawGroups[group_id];
+
+        vkCmdBindIndexBuffer(cmd, group.index_buffer, 0, group.index_type);
+        vkCmdDrawIndexedIndirectCount(cmd,
+                                      m_DrawCommands.buffer,
+                                      group.first_command * sizeof(shaderio::DrawIndexedCommand),
+                                      m_DrawCounts.buffer,
+                                      group_id * sizeof(uint32_t),
+                                      group.max_draws,
+                                      sizeof(shaderio::DrawIndexedCommand));
+    }
+}
+
+//----------------------------------
+// Mip 0 takes the farthest depth of the depth buffer, each next mip the farthest of the previous one
+//
+void vk_test::GpuDrawBuilder::cmdBuildHiz(VkCommandBuffer cmd, VkImage depth_image, VkImageView depth_view, const glm::mat4& view_proj) {
+    if (m_Hiz.image == VK_NULL_HANDLE) {
+        return;
+    }
+
+    const VkImageSubresourceRange depth_range{ VK_IMAGE_ASPECT_DEPTH_BIT, 0, 1, 0, 1 };
+
+    // The culling of this frame is done reading the pyramid, and the depth is written
+    cmdMemoryBarrier(cmd, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_NONE, VK_ACCESS_2_NONE);
+    cmdImageMemoryBarrier(cmd,
+                          { .image            = depth_image,
+                            .oldLayout        = VK_IMAGE_LAYOUT_ATTACHMENT_OPTIMAL,
+                            .newLayout        = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                            .subresourceRange = depth_range,
+                            .srcStageMask     = VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT,
+                            .dstStageMask     = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                            .srcAccessMask    = VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+                            .dstAccessMask    = VK_ACCESS_2_SHADER_SAMPLED_READ_BIT });
+
+    vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, m_BuildHizPipeline);
+    for (uint32_t mip = 0; mip < m_Hiz.mip_levels; mip++) {
+        WriteSetContainer write_set_container;
+        if (mip == 0) {
+            write_set_container.append(m_HizDescriptorPack.makeWrite(shaderio::HizBinding::eHizInput), depth_view, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+        }
+        else {
+            write_set_container.append(m_HizDescriptorPack.makeWrite(shaderio::HizBinding::eHizInput), m_HizMipViews[mip - 1], VK_IMAGE_LAYOUT_GENERAL);
+        }
+        write_set_container.append(m_HizDescriptorPack.makeWrite(shaderio::HizBinding::eHizOutput), m_HizMipViews[mip], VK_IMAGE_LAYOUT_GENERAL);
+        vkCmdPushDescriptorSetKHR(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, m_HizPipelineLayout, 0, write_set_container.size(), write_set_container.data());
+
+        const VkExtent2D mip_size{ std::max(m_Hiz.extent.width >> mip, 1U), std::max(m_Hiz.extent.height >> mip, 1U) };
+        const VkExtent2D group_counts = getGroupCounts(mip_size, HIZ_WORKGROUP_SIZE);
+        vkCmdDispatch(cmd, group_counts.width, group_counts.height, 1);
+
+        // Next mip, or next frame culling
+        cmdMemoryBarrier(cmd,
+                         VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                         VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                         VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT,
+                         VK_ACCESS_2_SHADER_SAMPLED_READ_BIT);
+    }
+
+    // Back to the layout used by rendering
+    cmdImageMemoryBarrier(cmd,
+                          { .image            = depth_image,
+                            .oldLayout        = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                            .newLayout        = VK_IMAGE_LAYOUT_ATTACHMENT_OPTIMAL,
+                            .subresourceRange = depth_range,
+                            .srcStageMask     = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                            .dstStageMask     = VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT,
+                            .srcAccessMask    = VK_ACCESS_2_NONE,
+                            .dstAccessMask    = VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT });
+
+    m_HizViewProj = view_proj;
+    m_HizValid    = true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Usage example
+//--------------------------------------------------------------------------------------------------
+[[maybe_unused]] static void usage_GpuDrawBuilder() {
+    vk_test::ResourceAllocator allocator;        // Initialized allocator
+    vk_test::StagingUploader   staging_uploader; // Initialized uploader
+    vk_test::GltfSceneResource scene;            // Loaded scene, with its scene info buffer
+    std::span<const uint32_t>  spirv;            // gpu_draws.slang compiled
+    VkExtent2D                 size{};           // Size of the depth buffer
+    VkImage                    depth_image{};    // Depth buffer
+    VkImageView                depth_view{};     // Depth aspect view of the depth buffer
+    uint32_t                   frame_index = 0;  // Frame slot being recorded
+    VkCommandBuffer            cmd{};
+
+    vk_test::GpuDrawBuilder draw_builder;
+    draw_builder.init(&allocator, spirv, 3);
+    draw_builder.setScene(scene, staging_uploader);
+    draw_builder.setHizSize(cmd, size);
+    staging_uploader.cmdUploadAppended(cmd);
+
+    // Each frame
+    draw_builder.cmdBuildDraws(cmd, scene, frame_index);
+    // vkCmdBeginRendering, bind shaders, push constants
+    draw_builder.cmdDraw(cmd);
+    // vkCmdEndRendering
+    draw_builder.cmdBuildHiz(cmd, depth_image, depth_view, scene.scene_info.viewProjMatrix);
+
+    // Counters of a previous frame
+    const shaderio::CullingStats& stats = draw_builder.getCullingStats();
+    VK_TEST_SAY("Visible " << stats.visible << ", frustum culled " << stats.frustumCulled << ", occlusion culled " << stats.occlusionCulled);
+
+    draw_builder.deinit();
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "resource_allocator.hpp"
+#include "staging.hpp"
+#include "descriptors.hpp"
+#include "../Common/gltf_utils.hpp"
+#include "../../Files/Shaders/gpu_draws_io.h.slang"
+
+//-----------------------------------------------------------------
+// GpuDrawBuilder records the scene draws without a CPU loop over
+// the instances: a compute pass writes one VkDrawIndexedIndirectCommand
+// per visible instance, and each draw group (meshes sharing an index buffer
+// and index type) is drawn by a single vkCmdDrawIndexedIndirectCount.
+//
+// The instance index is passed as `firstInstance`, shaders read it
+// with SV_VulkanInstanceID.
+//
+// Culling uses the world space bounds of the instances:
+//  - frustum : against the current view projection
+//  - occlusion : against a hierarchical-Z pyramid (farthest depth per texel)
+//    built from the depth buffer of the previous frame, with the view
+//    projection of that frame. An object becoming visible is drawn one
+//    frame late.
+// The counters of a frame are read back when its frame slot comes back,
+// see getCullingStats().
+//
+// With levels of detail (GltfMesh::lods), each draw takes the indices of
+// the level selected for its instance, see setLodScale().
+//
+// Usage:
+//      see usage_GpuDrawBuilder in gpu_draws.cpp
+//-----------------------------------------------------------------
+
+namespace vk_test {
+
+    class GpuDrawBuilder {
+    public:
+        GpuDrawBuilder()                                 = default;
+        GpuDrawBuilder(const GpuDrawBuilder&)            = delete;
+        GpuDrawBuilder& operator=(const GpuDrawBuilder&) = delete;
+        ~GpuDrawBuilder() { assert(m_Device == VK_NULL_HANDLE && "Missing deinit()"); }
+
+        // `spirv` must contain the `buildDraws` and `buildHiz` entry points of gpu_draws.slang.
+        // `frame_cycle_size` is the number of frames in flight, one readback slot each.
+        VkResult init(ResourceAllocator* alloc, std::span<const uint32_t> spirv, uint32_t frame_cycle_size);
+        void     deinit();
+
+        // Groups the meshes by index buffer and sizes the command buffers for the scene.
+        // Must be called again when meshes or instances are added or removed (not when they move).
+        void setScene(const GltfSceneResource& scene, StagingUploader& staging_uploader);
+
+        // Uploads the bounds of moved instances [first, first + count), outside of rendering
+        void cmdUpdateInstanceBounds(VkCommandBuffer cmd, const GltfSceneResource& scene, uint32_t first, uint32_t count);
+
+        // (Re)creates the pyramid for a depth buffer of `size`, the device must be idle
+        void setHizSize(VkCommandBuffer cmd, const VkExtent2D& size);
+
+        // CULLING_FRUSTUM | CULLING_OCCLUSION
+        void     setCullingFlags(uint32_t flags) { m_CullingFlags = flags; }
+        uint32_t getCullingFlags() const { return m_CullingFlags; }
+
+        // Level of detail of each draw, see meshLodScale(). 0 draws the full resolution
+        void setLodScale(float lod_scale) { m_LodScale = lod_scale; }
+
+        // Culls and writes the draw commands, must be recorded outside of rendering.
+        // `frame_index` is the frame slot being recorded, its previous counters are read back.
+        void cmdBuildDraws(VkCommandBuffer cmd, const GltfSceneResource& scene, uint32_t frame_index);
+
+        // Issues the draws, inside rendering with the shaders and push constants already bound
+        void cmdDraw(VkCommandBuffer cmd) const;
+
+        // Builds the pyramid from the depth just rendered with `view_proj`, used by the next cmdBuildDraws.
+        // The depth image goes from and back to VK_IMAGE_LAYOUT_ATTACHMENT_OPTIMAL.
+        void cmdBuildHiz(VkCommandBuffer cmd, VkImage depth_image, VkImageView depth_view, const glm::mat4& view_proj);
+
+        // Counters of the last frame read back
+        const shaderio::CullingStats& getCullingStats() const { return m_CullingStats; }
+        uint32_t                      getDrawGroupCount() const { return uint32_t(m_DrawGroups.size()); }
+        const Buffer&                 getVisibleInstances() const { return m_VisibleInstances; }
+
+    private:
+        void destroyBuffers();
+        void destroyHiz();
+
+        struct DrawGroup {
+            VkBuffer    index_buffer{};
+            VkIndexType index_type{ VK_INDEX_TYPE_UINT32 };
+            uint32_t    first_command = 0;
+            uint32_t    max_draws     = 0;
+        };
+
+        ResourceAllocator* m_Alloc{};
+        VkDevice           m_Device{};
+        DescriptorPack     m_HizDescriptorPack; // Push descriptors of the Hi-Z input and output
+        VkPipelineLayout   m_PipelineLayout{};
+        VkPipelineLayout   m_HizPipelineLayout{};
+        VkPipeline         m_BuildDrawsPipeline{};
+        VkPipeline         m_BuildHizPipeline{};
+
+        std::vector<DrawGroup> m_DrawGroups;
+        uint32_t               m_InstanceCount = 0;
+        uint32_t               m_CullingFlags  = CULLING_FRUSTUM | CULLING_OCCLUSION;
+        float                  m_LodScale      = 0.0F;
+
+        Buffer m_MeshDrawGroups;   // shaderio::MeshDrawGroup per mesh
+        Buffer m_DrawCommands;     // shaderio::DrawIndexedCommand per instance
+        Buffer m_DrawCounts;       // uint32_t per draw group
+        Buffer m_InstanceBounds;   // shaderio::InstanceBounds per instance
+        Buffer m_VisibleInstances; // uint32_t per instance, compacted
+
+        // Counters, copied to a host visible slot per frame in flight
+        Buffer                 m_CullingStatsBuffer;
+        Buffer                 m_CullingStatsReadback;
+        std::vector<bool>      m_ReadbackPending;
+        shaderio::CullingStats m_CullingStats{};
+
+        // Hierarchical-Z pyramid, always in VK_IMAGE_LAYOUT_GENERAL
+        Image                    m_Hiz;
+        std::vector<VkImageView> m_HizMipViews;
+        glm::mat4                m_HizViewProj{ 1.0F };
+        bool                     m_HizValid = false; // False until a depth buffer was reduced
+    };
+
+} // namespace vk_test
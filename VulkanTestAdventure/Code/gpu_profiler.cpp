@@ -0,0 +1,453 @@
+#include "pch.h"
+#include "gpu_profiler.hpp"
+
+#include <Application.hpp>
+#include <file_operations.hpp>
+
+#include <json.hpp>
+
+// The statistics of the core queries, in the order of their values in the results
+static constexpr std::pair<VkQueryPipelineStatisticFlagBits, const char*> STATISTIC_NAMES[] = {
+    { VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT, "input-vertices" },
+    { VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT, "input-primitives" },
+    { VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT, "vertex-invocations" },
+    { VK_QUERY_PIPELINE_STATISTIC_GEOMETRY_SHADER_INVOCATIONS_BIT, "geometry-invocations" },
+    { VK_QUERY_PIPELINE_STATISTIC_GEOMETRY_SHADER_PRIMITIVES_BIT, "geometry-primitives" },
+    { VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT, "clipping-invocations" },
+    { VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT, "clipping-primitives" },
+    { VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT, "fragment-invocations" },
+    { VK_QUERY_PIPELINE_STATISTIC_TESSELLATION_CONTROL_SHADER_PATCHES_BIT, "tessellation-patches" },
+    { VK_QUERY_PIPELINE_STATISTIC_TESSELLATION_EVALUATION_SHADER_INVOCATIONS_BIT, "tessellation-invocations" },
+    { VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT, "compute-invocations" },
+};
+
+VkResult vk_test::GpuProfiler::init(VkDevice                      device,
+                                    VkPhysicalDevice              physical_device,
+                                    uint32_t                      queue_family_index,
+                                    uint32_t                      frame_cycle_size,
+                                    uint32_t                      max_sections,
+                                    VkQueryPipelineStatisticFlags statistics) {
+    assert(!m_Device);
+    m_Device          = device;
+    m_MaxSections     = max_sections;
+    m_TimestampPeriod = 0.0;
+
+    uint32_t family_count = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(physical_device, &family_count, nullptr);
+    std::vector<VkQueueFamilyProperties> families(family_count);
+    vkGetPhysicalDeviceQueueFamilyProperties(physical_device, &family_count, families.data());
+
+    const uint32_t valid_bits = families[queue_family_index].timestampValidBits;
+    if (valid_bits == 0) {
+        VK_TEST_SAY("GPU profiler : the queue family " << queue_family_index << " has no timestamps, nothing is measured");
+        return VK_SUCCESS;
+    }
+
+    VkPhysicalDeviceProperties properties{};
+    vkGetPhysicalDeviceProperties(physical_device, &properties);
+    m_TimestampPeriod = properties.limits.timestampPeriod;
+    m_TimestampMask   = valid_bits >= 64 ? ~0ULL : (1ULL << valid_bits) - 1;
+
+    if (statistics != 0) {
+        VkPhysicalDeviceFeatures features{};
+        vkGetPhysicalDeviceFeatures(physical_device, &features);
+        if (features.pipelineStatisticsQuery == VK_FALSE) {
+            VK_TEST_SAY("GPU profiler : pipeline statistics are not supported");
+            statistics = 0;
+        }
+    }
+    m_StatisticFlags = statistics;
+    m_StatisticCount = uint32_t(std::popcount(statistics));
+
+    // The device clock can be read next to the CPU one with VK_KHR_calibrated_timestamps
+    m_HasCalibration = false;
+    if (vkGetPhysicalDeviceCalibrateableTimeDomainsKHR != nullptr && vkGetCalibratedTimestampsKHR != nullptr) {
+        uint32_t domain_count = 0;
+        vkGetPhysicalDeviceCalibrateableTimeDomainsKHR(physical_device, &domain_count, nullptr);
+        std::vector<VkTimeDomainKHR> domains(domain_count);
+        vkGetPhysicalDeviceCalibrateableTimeDomainsKHR(physical_device, &domain_count, domains.data());
+        m_HasCalibration = std::ranges::find(domains, VK_TIME_DOMAIN_DEVICE_KHR) != domains.end();
+    }
+
+    m_Frames.resize(frame_cycle_size);
+    for (FrameSlot& frame : m_Frames) {
+        const VkQueryPoolCreateInfo timestamp_info{
+            .sType      = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+            .queryType  = VK_QUERY_TYPE_TIMESTAMP,
+            .queryCount = 2 + 2 * max_sections,
+        };
+        VkResult result = vkCreateQueryPool(m_Device, &timestamp_info, nullptr, &frame.timestamp_pool);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+
+        if (m_StatisticFlags != 0) {
+            const VkQueryPoolCreateInfo statistics_info{
+                .sType              = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+                .queryType          = VK_QUERY_TYPE_PIPELINE_STATISTICS,
+                .queryCount         = max_sections,
+                .pipelineStatistics = m_StatisticFlags,
+            };
+            result = vkCreateQueryPool(m_Device, &statistics_info, nullptr, &frame.statistics_pool);
+            if (result != VK_SUCCESS) {
+                return result;
+            }
+        }
+    }
+
+    m_FrameTimer = { .name = "Frame" };
+    m_FrameCount = 0;
+    return VK_SUCCESS;
+}
+
+void vk_test::GpuProfiler::deinit() {
+    if (m_Device == VK_NULL_HANDLE) {
+        return;
+    }
+
+    for (FrameSlot& frame : m_Frames) {
+        vkDestroyQueryPool(m_Device, frame.timestamp_pool, nullptr);
+        vkDestroyQueryPool(m_Device, frame.statistics_pool, nullptr);
+    }
+    m_Frames.clear();
+    m_Timers.clear();
+    m_TimerIndices.clear();
+    m_TraceFrames.clear();
+    m_CurrentFrame = nullptr;
+    m_Device       = VK_NULL_HANDLE;
+}
+
+void vk_test::GpuProfiler::beginFrame(VkCommandBuffer cmd, uint32_t frame_index) {
+    if (!isEnabled()) {
+        return;
+    }
+
+    FrameSlot& frame = m_Frames[frame_index];
+    readback(frame);
+
+    frame.sections.clear();
+    frame.statistic_count = 0;
+    frame.cpu_begin       = ScopedTimer::getTraceTime();
+    frame.frame_number    = m_FrameCount++;
+
+    vkCmdResetQueryPool(cmd, frame.timestamp_pool, 0, 2 + 2 * m_MaxSections);
+    if (frame.statistics_pool != VK_NULL_HANDLE) {
+        vkCmdResetQueryPool(cmd, frame.statistics_pool, 0, m_MaxSections);
+    }
+    vkCmdWriteTimestamp2(cmd, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, frame.timestamp_pool, 0);
+
+    m_CurrentFrame = &frame;
+    m_OpenSections.clear();
+    m_StatisticOpen = false;
+}
+
+void vk_test::GpuProfiler::cmdEndFrame(VkCommandBuffer cmd) {
+    if (m_CurrentFrame == nullptr) {
+        return;
+    }
+    assert(m_OpenSections.empty() && "Missing cmdEndSection()");
+
+    vkCmdWriteTimestamp2(cmd, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, m_CurrentFrame->timestamp_pool, 1);
+    m_CurrentFrame->is_recorded = true;
+    m_CurrentFrame              = nullptr;
+}
+
+void vk_test::GpuProfiler::readbackAll() {
+    std::vector<FrameSlot*> recorded;
+    for (FrameSlot& frame : m_Frames) {
+        if (frame.is_recorded) {
+            recorded.push_back(&frame);
+        }
+    }
+    std::ranges::sort(recorded, {}, &FrameSlot::frame_number);
+
+    for (FrameSlot* frame : recorded) {
+        readback(*frame);
+    }
+}
+
+uint32_t vk_test::GpuProfiler::cmdBeginSection(VkCommandBuffer cmd, const char* name) {
+    if (m_CurrentFrame == nullptr || m_CurrentFrame->sections.size() == m_MaxSections) {
+        return INVALID_SECTION;
+    }
+    FrameSlot& frame = *m_CurrentFrame;
+
+    const uint32_t section_index = uint32_t(frame.sections.size());
+    const uint32_t depth         = uint32_t(m_OpenSections.size());
+    Section&       section       = frame.sections.emplace_back(Section{ .timer_index = getTimerIndex(name, depth), .depth = depth });
+
+    // Waiting for the previous commands, the sections do not overlap
+    vkCmdWriteTimestamp2(cmd, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, frame.timestamp_pool, 2 + 2 * section_index);
+
+    if (m_StatisticFlags != 0 && !m_StatisticOpen) {
+        section.statistic_query = frame.statistic_count++;
+        vkCmdBeginQuery(cmd, frame.statistics_pool, section.statistic_query, 0);
+        m_StatisticOpen = true;
+    }
+
+    m_OpenSections.push_back(section_index);
+    return section_index;
+}
+
+void vk_test::GpuProfiler::cmdEndSection(VkCommandBuffer cmd, uint32_t section_index) {
+    if (section_index == INVALID_SECTION) {
+        return;
+    }
+    assert(!m_OpenSections.empty() && m_OpenSections.back() == section_index && "Sections must be closed in the reverse order");
+    m_OpenSections.pop_back();
+
+    FrameSlot&     frame   = *m_CurrentFrame;
+    const Section& section = frame.sections[section_index];
+    if (section.statistic_query != INVALID_SECTION) {
+        vkCmdEndQuery(cmd, frame.statistics_pool, section.statistic_query);
+        m_StatisticOpen = false;
+    }
+    vkCmdWriteTimestamp2(cmd, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, frame.timestamp_pool, 3 + 2 * section_index);
+}
+
+std::vector<vk_test::GpuProfiler::SectionStats> vk_test::GpuProfiler::getSectionStats() const {
+    std::vector<SectionStats> stats;
+    stats.reserve(m_Timers.size());
+    for (const Timer& timer : m_Timers) {
+        stats.push_back(makeStats(timer));
+    }
+    return stats;
+}
+
+bool vk_test::GpuProfiler::writeChromeTrace(const std::filesystem::path& filename) const {
+    // Process 1 is the CPU, with one track per thread, process 2 the GPU
+    constexpr int CPU_PID = 1;
+    constexpr int GPU_PID = 2;
+
+    nlohmann::json events = nlohmann::json::array();
+    events.push_back({ { "name", "process_name" }, { "ph", "M" }, { "pid", CPU_PID }, { "args", { { "name", "CPU" } } } });
+    events.push_back({ { "name", "process_name" }, { "ph", "M" }, { "pid", GPU_PID }, { "args", { { "name", "GPU" } } } });
+
+    std::unordered_map<uint64_t, uint32_t> thread_indices;
+    for (const ScopedTimer::TraceEvent& event : ScopedTimer::getTraceEvents()) {
+        const uint32_t thread_index = thread_indices.try_emplace(event.thread_id, uint32_t(thread_indices.size())).first->second;
+        events.push_back({ { "name", event.name },
+                           { "cat", "cpu" },
+                           { "ph", "X" },
+                           { "ts", event.begin * 1e6 },
+                           { "dur", event.duration * 1e6 },
+                           { "pid", CPU_PID },
+                           { "tid", thread_index } });
+    }
+
+    for (const TraceFrame& frame : m_TraceFrames) {
+        events.push_back({ { "name", m_FrameTimer.name }, { "cat", "gpu" }, { "ph", "X" }, { "ts", frame.begin * 1e6 }, { "dur", frame.duration * 1e6 }, { "pid", GPU_PID }, { "tid", 0 } });
+        for (const TraceFrame::Event& event : frame.events) {
+            events.push_back({ { "name", m_Timers[event.timer_index].name },
+                               { "cat", "gpu" },
+                               { "ph", "X" },
+                               { "ts", event.begin * 1e6 },
+                               { "dur", event.duration * 1e6 },
+                               { "pid", GPU_PID },
+                               { "tid", 0 },
+                               { "args", { { "depth", event.depth } } } });
+        }
+    }
+
+    std::ofstream file(filename);
+    if (!file) {
+        VK_TEST_SAY("GPU profiler : could not write " << utf8FromPath(filename).c_str());
+        return false;
+    }
+    file << nlohmann::json{ { "traceEvents", std::move(events) }, { "displayTimeUnit", "ms" } }.dump();
+    return file.good();
+}
+
+void vk_test::GpuProfiler::readback(FrameSlot& frame) {
+    if (!frame.is_recorded) {
+        return;
+    }
+    frame.is_recorded = false;
+
+    // The submit has completed, a query is still unavailable when it was not written (ex. the frame was abandoned)
+    const VkQueryResultFlags flags           = VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT;
+    const uint32_t           timestamp_count = 2 + 2 * uint32_t(frame.sections.size());
+    std::vector<uint64_t>    timestamps(2 * size_t(timestamp_count)); // Value, availability
+
+    VkResult result = vkGetQueryPoolResults(m_Device, frame.timestamp_pool, 0, timestamp_count, std::span(timestamps).size_bytes(), timestamps.data(), 2 * sizeof(uint64_t), flags);
+    if (result != VK_SUCCESS && result != VK_NOT_READY) {
+        return;
+    }
+
+    auto get_timestamp = [&](uint32_t query) { return timestamps[2 * size_t(query)]; };
+    auto is_available  = [&](uint32_t query) { return timestamps[2 * size_t(query) + 1] != 0; };
+    auto get_seconds   = [&](uint64_t begin, uint64_t end) { return double((end - begin) & m_TimestampMask) * m_TimestampPeriod * 1e-9; };
+
+    if (!is_available(0) || !is_available(1)) {
+        return;
+    }
+
+    const size_t          statistic_stride = m_StatisticCount + 1;
+    std::vector<uint64_t> statistics(frame.statistic_count * statistic_stride);
+    if (frame.statistic_count != 0) {
+        result = vkGetQueryPoolResults(m_Device, frame.statistics_pool, 0, frame.statistic_count, std::span(statistics).size_bytes(), statistics.data(), statistic_stride * sizeof(uint64_t), flags);
+        if (result != VK_SUCCESS && result != VK_NOT_READY) {
+            statistics.clear();
+        }
+    }
+
+    const uint64_t frame_begin = get_timestamp(0);
+    TraceFrame     trace_frame{ .begin = getTraceTime(frame, frame_begin), .duration = get_seconds(frame_begin, get_timestamp(1)) };
+    addSample(m_FrameTimer, trace_frame.duration * 1e3);
+    if (m_FrameCallback) {
+        m_FrameCallback(frame.frame_number, trace_frame.duration * 1e3);
+    }
+
+    // A name seen several times in the frame counts once, with the sum of its sections
+    std::vector<double> frame_times(m_Timers.size(), -1.0);
+    for (uint32_t i = 0; i < uint32_t(frame.sections.size()); i++) {
+        const Section& section = frame.sections[i];
+        if (!is_available(2 + 2 * i) || !is_available(3 + 2 * i)) {
+            continue;
+        }
+        const uint64_t begin   = get_timestamp(2 + 2 * i);
+        const double   seconds = get_seconds(begin, get_timestamp(3 + 2 * i));
+
+        double& frame_time = frame_times[section.timer_index];
+        frame_time         = std::max(frame_time, 0.0) + seconds * 1e3;
+
+        if (section.statistic_query != INVALID_SECTION && !statistics.empty()) {
+            const uint64_t* values = &statistics[section.statistic_query * statistic_stride];
+            if (values[m_StatisticCount] != 0) { // Availability after the values
+                m_Timers[section.timer_index].statistics.assign(values, values + m_StatisticCount);
+            }
+        }
+
+        trace_frame.events.push_back({ .timer_index = section.timer_index,
+                                       .depth       = section.depth,
+                                       .begin       = trace_frame.begin + get_seconds(frame_begin, begin),
+                                       .duration    = seconds });
+    }
+    for (uint32_t i = 0; i < uint32_t(frame_times.size()); i++) {
+        if (frame_times[i] >= 0.0) {
+            addSample(m_Timers[i], frame_times[i]);
+        }
+    }
+
+    if (m_TraceFrames.size() == HISTORY_SIZE) {
+        m_TraceFrames.pop_front();
+    }
+    m_TraceFrames.push_back(std::move(trace_frame));
+}
+
+void vk_test::GpuProfiler::addSample(Timer& timer, double milliseconds) {
+    if (timer.history.size() < HISTORY_SIZE) {
+        timer.history.push_back(milliseconds);
+    }
+    else {
+        timer.history[timer.history_index] = milliseconds;
+    }
+    timer.history_index = (timer.history_index + 1) % HISTORY_SIZE;
+    timer.last          = milliseconds;
+}
+
+uint32_t vk_test::GpuProfiler::getTimerIndex(const char* name, uint32_t depth) {
+    const auto [it, inserted] = m_TimerIndices.try_emplace(std::to_string(depth) + "/" + name, uint32_t(m_Timers.size()));
+    if (inserted) {
+        m_Timers.push_back({ .name = name, .depth = depth });
+    }
+    return it->second;
+}
+
+vk_test::GpuProfiler::SectionStats vk_test::GpuProfiler::makeStats(const Timer& timer) const {
+    SectionStats stats{
+        .name         = timer.name,
+        .depth        = timer.depth,
+        .sample_count = uint32_t(timer.history.size()),
+        .last_ms      = timer.last,
+        .statistics   = timer.statistics,
+    };
+    if (!timer.history.empty()) {
+        const auto [min_it, max_it] = std::ranges::minmax_element(timer.history);
+
+        stats.min_ms = *min_it;
+        stats.max_ms = *max_it;
+        stats.avg_ms = std::accumulate(timer.history.begin(), timer.history.end(), 0.0) / double(timer.history.size());
+    }
+    return stats;
+}
+
+double vk_test::GpuProfiler::getTraceTime(const FrameSlot& frame, uint64_t frame_timestamp) const {
+    if (!m_HasCalibration) {
+        return frame.cpu_begin; // Lower bound, the frame was submitted after its recording
+    }
+
+    // The CPU clock is read around the device one, the middle is within the call time
+    const VkCalibratedTimestampInfoKHR timestamp_info{ .sType = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_KHR, .timeDomain = VK_TIME_DOMAIN_DEVICE_KHR };
+    uint64_t                           device_now    = 0;
+    uint64_t                           max_deviation = 0;
+
+    const double before = ScopedTimer::getTraceTime();
+    vkGetCalibratedTimestampsKHR(m_Device, 1, &timestamp_info, &device_now, &max_deviation);
+    const double after = ScopedTimer::getTraceTime();
+
+    const double elapsed = double((device_now - frame_timestamp) & m_TimestampMask) * m_TimestampPeriod * 1e-9;
+    return (before + after) * 0.5 - elapsed;
+}
+
+const char* vk_test::GpuProfiler::getStatisticName(VkQueryPipelineStatisticFlagBits statistic) {
+    for (const auto& [bit, name] : STATISTIC_NAMES) {
+        if (bit == statistic) {
+            return name;
+        }
+    }
+    return nullptr;
+}
+
+bool vk_test::GpuProfiler::parseStatistics(std::string_view names, VkQueryPipelineStatisticFlags& statistics) {
+    statistics = 0;
+    while (!names.empty()) {
+        const size_t           separator = names.find(',');
+        const std::string_view name      = names.substr(0, separator);
+        names                            = separator == std::string_view::npos ? std::string_view() : names.substr(separator + 1);
+
+        auto it = std::ranges::find_if(STATISTIC_NAMES, [&](const auto& statistic) { return name == statistic.second; });
+        if (name == "all") {
+            for (const auto& [bit, statistic_name] : STATISTIC_NAMES) {
+                statistics |= bit;
+            }
+        }
+        else if (it != std::end(STATISTIC_NAMES)) {
+            statistics |= it->first;
+        }
+        else {
+            return false;
+        }
+    }
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Usage example
+//--------------------------------------------------------------------------------------------------
+[[maybe_unused]] static void usage_GpuProfiler() {
+    vk_test::Application* app{}; // The application, owning the profiler
+    VkCommandBuffer       cmd{};  // Frame command buffer, given to IAppElement::onRender
+
+    vk_test::GpuProfiler& profiler = app->getGpuProfiler();
+
+    {
+        // Closed at the end of the scope, nested sections show up below it
+        vk_test::GpuProfiler::Scope scope(profiler, cmd, "Sky");
+        // ... vkCmdDispatch
+    }
+
+    const uint32_t section = profiler.cmdBeginSection(cmd, "Tonemapper");
+    // ... vkCmdDispatch
+    profiler.cmdEndSection(cmd, section);
+
+    // Results of the frames completed so far
+    for (const vk_test::GpuProfiler::SectionStats& stats : profiler.getSectionStats()) {
+        VK_TEST_SAY(std::string(stats.depth * 2, ' ').c_str() << stats.name.c_str() << " : " << stats.avg_ms << " ms [" << stats.min_ms << ", " << stats.max_ms << "]");
+    }
+
+    // With the scopes of SCOPED_TIMER on the CPU
+    vk_test::ScopedTimer::setTraceEnabled(true);
+    // ... more frames
+    profiler.writeChromeTrace("trace.json");
+}
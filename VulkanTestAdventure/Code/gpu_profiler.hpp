@@ -0,0 +1,186 @@
+#pragma once
+
+#include "timers.hpp"
+
+//-----------------------------------------------------------------
+// GpuProfiler measures named, nested sections of the frame command
+// buffer on the GPU, with vkCmdWriteTimestamp2 around each section and
+// optionally pipeline statistics queries.
+//
+// Each frame in flight has its own query pools. beginFrame() reads back
+// the results of the previous use of the frame slot, which has completed
+// since the Application waited for it, so the readback never blocks, and
+// resets the queries in the command buffer. The Application owns one
+// (getGpuProfiler()), calls beginFrame() and cmdEndFrame() itself, and
+// measures the whole frame.
+//
+// The sections are aggregated per name into rolling min/avg/max over the
+// last HISTORY_SIZE frames. Pipeline statistics are only recorded for the
+// outermost section, as queries of the same type cannot be nested.
+//
+// writeChromeTrace() exports the kept frames, with the scopes of the
+// ScopedTimer when its trace is enabled, as a Chrome trace JSON
+// (chrome://tracing, ui.perfetto.dev). The GPU times are placed on the
+// CPU clock with VK_KHR_calibrated_timestamps when the device has it,
+// otherwise each GPU frame starts when its recording started.
+//
+// Usage:
+//      see usage_GpuProfiler in gpu_profiler.cpp
+//-----------------------------------------------------------------
+
+namespace vk_test {
+
+    class GpuProfiler {
+    public:
+        static constexpr uint32_t DEFAULT_MAX_SECTIONS = 128; // Per frame
+        static constexpr uint32_t HISTORY_SIZE         = 128; // Frames in the rolling stats and the trace
+        static constexpr uint32_t INVALID_SECTION      = ~0U;
+
+        struct SectionStats {
+            std::string           name;
+            uint32_t              depth        = 0; // 0 for the sections directly in the frame
+            uint32_t              sample_count = 0; // Frames in the rolling window
+            double                last_ms      = 0.0;
+            double                min_ms       = 0.0;
+            double                avg_ms       = 0.0;
+            double                max_ms       = 0.0;
+            std::vector<uint64_t> statistics; // Last frame, one value per bit of the statistics flags, empty if none
+        };
+
+        // Closes the section when going out of scope
+        class Scope {
+        public:
+            Scope(GpuProfiler& profiler, VkCommandBuffer cmd, const char* name)
+                : m_Profiler(profiler), m_Cmd(cmd), m_Section(profiler.cmdBeginSection(cmd, name)) {}
+            ~Scope() { m_Profiler.cmdEndSection(m_Cmd, m_Section); }
+
+            Scope(const Scope&)            = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            GpuProfiler&    m_Profiler;
+            VkCommandBuffer m_Cmd;
+            uint32_t        m_Section;
+        };
+
+        GpuProfiler()                              = default;
+        GpuProfiler(const GpuProfiler&)            = delete;
+        GpuProfiler& operator=(const GpuProfiler&) = delete;
+        ~GpuProfiler() { assert(m_Device == VK_NULL_HANDLE && "Missing deinit()"); }
+
+        // The sections are only recorded on `queue_family_index`. `statistics` requires the pipelineStatisticsQuery feature.
+        VkResult init(VkDevice                      device,
+                      VkPhysicalDevice              physical_device,
+                      uint32_t                      queue_family_index,
+                      uint32_t                      frame_cycle_size,
+                      uint32_t                      max_sections = DEFAULT_MAX_SECTIONS,
+                      VkQueryPipelineStatisticFlags statistics   = 0);
+
+        // the device must be idle
+        void deinit();
+
+        // Reads back the previous results of `frame_index`, its submit must have completed, and starts measuring the frame
+        void beginFrame(VkCommandBuffer cmd, uint32_t frame_index);
+        void cmdEndFrame(VkCommandBuffer cmd);
+
+        // Sections must be closed in the reverse order, within the frame, and inside or outside of the same rendering.
+        // Secondaries executed in a section with statistics must inherit them (VkCommandBufferInheritanceInfo::pipelineStatistics).
+        // Returns INVALID_SECTION when the frame has no query left, cmdEndSection() ignores it.
+        uint32_t cmdBeginSection(VkCommandBuffer cmd, const char* name);
+        void     cmdEndSection(VkCommandBuffer cmd, uint32_t section);
+
+        // Flags of the statistics query active in the frame command buffer, 0 when none
+        VkQueryPipelineStatisticFlags getActiveStatistics() const { return m_StatisticOpen ? m_StatisticFlags : 0; }
+
+        // Reads back all the frames recorded and not read yet, in their order, the device must be idle (ex. at the end of a run)
+        void readbackAll();
+
+        // Called for each frame read back, with the number of the frame (beginFrame() calls since init) and its GPU time
+        void setFrameCallback(std::function<void(uint64_t frame_number, double milliseconds)> callback) { m_FrameCallback = std::move(callback); }
+
+        // Timestamps are not supported on the queue
+        bool isEnabled() const { return m_TimestampPeriod != 0.0; }
+
+        // The whole frame, then the sections in the order they were first seen
+        SectionStats              getFrameStats() const { return makeStats(m_FrameTimer); }
+        std::vector<SectionStats> getSectionStats() const;
+
+        bool writeChromeTrace(const std::filesystem::path& filename) const;
+
+        // Flags given to init(), 0 when not supported
+        VkQueryPipelineStatisticFlags getStatisticFlags() const { return m_StatisticFlags; }
+
+        // Name of a statistic, ex. "fragment-invocations", nullptr for the bits not handled
+        static const char* getStatisticName(VkQueryPipelineStatisticFlagBits statistic);
+
+        // Parses a comma separated list of statistic names, or "all", returns false on an unknown name
+        static bool parseStatistics(std::string_view names, VkQueryPipelineStatisticFlags& statistics);
+
+    private:
+        struct Timer {
+            std::string           name;
+            uint32_t              depth = 0;
+            std::vector<double>   history; // Milliseconds, ring of HISTORY_SIZE
+            uint32_t              history_index = 0;
+            double                last          = 0.0;
+            std::vector<uint64_t> statistics;
+        };
+
+        struct Section {
+            uint32_t timer_index     = 0;
+            uint32_t depth           = 0;
+            uint32_t statistic_query = INVALID_SECTION;
+        };
+
+        struct FrameSlot {
+            VkQueryPool          timestamp_pool{};
+            VkQueryPool          statistics_pool{};
+            std::vector<Section> sections; // Timestamps 2 + 2 * i and 3 + 2 * i, the frame has 0 and 1
+            uint32_t             statistic_count = 0;
+            double               cpu_begin       = 0.0; // Trace time of beginFrame()
+            uint64_t             frame_number    = 0;
+            bool                 is_recorded     = false;
+        };
+
+        // A frame read back, kept for the trace
+        struct TraceFrame {
+            struct Event {
+                uint32_t timer_index = 0;
+                uint32_t depth       = 0;
+                double   begin       = 0.0; // Trace time
+                double   duration    = 0.0;
+            };
+            double             begin    = 0.0;
+            double             duration = 0.0;
+            std::vector<Event> events;
+        };
+
+        void         readback(FrameSlot& frame);
+        void         addSample(Timer& timer, double milliseconds);
+        uint32_t     getTimerIndex(const char* name, uint32_t depth);
+        SectionStats makeStats(const Timer& timer) const;
+        double       getTraceTime(const FrameSlot& frame, uint64_t frame_timestamp) const;
+
+        VkDevice                      m_Device{};
+        double                        m_TimestampPeriod = 0.0; // Nanoseconds per tick, 0 when not supported
+        uint64_t                      m_TimestampMask   = 0;
+        uint32_t                      m_MaxSections     = 0;
+        VkQueryPipelineStatisticFlags m_StatisticFlags  = 0;
+        uint32_t                      m_StatisticCount  = 0; // Values per statistics query
+        bool                          m_HasCalibration  = false;
+
+        std::vector<FrameSlot> m_Frames;
+        FrameSlot*             m_CurrentFrame  = nullptr;
+        uint64_t               m_FrameCount    = 0;     // beginFrame() calls since init
+        std::vector<uint32_t>  m_OpenSections;          // Stack of the sections being recorded
+        bool                   m_StatisticOpen = false; // A section with statistics is open
+
+        Timer                                     m_FrameTimer;
+        std::vector<Timer>                        m_Timers;
+        std::unordered_map<std::string, uint32_t> m_TimerIndices; // Per "depth/name"
+        std::deque<TraceFrame>                    m_TraceFrames;
+
+        std::function<void(uint64_t frame_number, double milliseconds)> m_FrameCallback;
+    };
+
+} // namespace vk_test
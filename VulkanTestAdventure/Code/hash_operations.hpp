@@ -49,4 +49,19 @@ namespace vk_test {
         return seed;
     }
 
+    // Hash a block of raw memory, 8 bytes at a time
+    inline std::size_t hashData(const void* data, size_t data_size, std::size_t seed = 0) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        size_t         i     = 0;
+        for (; i + sizeof(uint64_t) <= data_size; i += sizeof(uint64_t)) {
+            uint64_t word = 0;
+            memcpy(&word, bytes + i, sizeof(uint64_t));
+            hashCombine(seed, word);
+        }
+        for (; i < data_size; ++i) {
+            hashCombine(seed, bytes[i]);
+        }
+        return seed;
+    }
+
 } // namespace vk_test
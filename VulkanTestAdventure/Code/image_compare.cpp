@@ -0,0 +1,219 @@
+#include "pch.h"
+#include "image_compare.hpp"
+
+#include <file_operations.hpp>
+
+#include <stb_image.h>
+#include <stb_image_write.h>
+
+namespace {
+    // CIELAB planes of an image
+    struct LabImage {
+        std::vector<glm::vec3> texels;
+    };
+
+    float srgbToLinear(float c) {
+        return c <= 0.04045F ? c / 12.92F : std::pow((c + 0.055F) / 1.055F, 2.4F);
+    }
+
+    glm::vec3 linearToLab(const glm::vec3& rgb) {
+        // D65, normalized by the white point
+        const glm::vec3 xyz = glm::vec3(0.4124564F * rgb.r + 0.3575761F * rgb.g + 0.1804375F * rgb.b,
+                                        0.2126729F * rgb.r + 0.7151522F * rgb.g + 0.0721750F * rgb.b,
+                                        0.0193339F * rgb.r + 0.1191920F * rgb.g + 0.9503041F * rgb.b) /
+                              glm::vec3(0.95047F, 1.0F, 1.08883F);
+
+        auto f = [](float t) { return t > 0.008856F ? std::cbrt(t) : 7.787F * t + 16.0F / 116.0F; };
+        const glm::vec3 fxyz(f(xyz.x), f(xyz.y), f(xyz.z));
+        return { 116.0F * fxyz.y - 16.0F, 500.0F * (fxyz.x - fxyz.y), 200.0F * (fxyz.y - fxyz.z) };
+    }
+
+    float hyab(const glm::vec3& a, const glm::vec3& b) {
+        const glm::vec3 d = a - b;
+        return std::abs(d.x) + std::sqrt(d.y * d.y + d.z * d.z);
+    }
+
+    // Blurred with [1 2 1] x [1 2 1] / 16, edges clamped
+    LabImage toBlurredLab(const vk_test::ImageRgba8& image) {
+        static const std::array<float, 256> s_linear = [] {
+            std::array<float, 256> table{};
+            for (uint32_t i = 0; i < 256; i++) {
+                table[i] = srgbToLinear(float(i) / 255.0F);
+            }
+            return table;
+        }();
+
+        const int32_t          w = int32_t(image.width);
+        const int32_t          h = int32_t(image.height);
+        std::vector<glm::vec3> lab(size_t(w) * h);
+        for (size_t i = 0; i < lab.size(); i++) {
+            const uint8_t* p = &image.pixels[i * 4];
+            lab[i]           = linearToLab({ s_linear[p[0]], s_linear[p[1]], s_linear[p[2]] });
+        }
+
+        LabImage                      result{ .texels = std::vector<glm::vec3>(lab.size()) };
+        constexpr std::array<float, 3> weights = { 0.25F, 0.5F, 0.25F };
+        for (int32_t y = 0; y < h; y++) {
+            for (int32_t x = 0; x < w; x++) {
+                glm::vec3 sum(0.0F);
+                for (int32_t j = -1; j <= 1; j++) {
+                    const int32_t sy = std::clamp(y + j, 0, h - 1);
+                    for (int32_t i = -1; i <= 1; i++) {
+                        const int32_t sx = std::clamp(x + i, 0, w - 1);
+                        sum += lab[size_t(sy) * w + sx] * (weights[j + 1] * weights[i + 1]);
+                    }
+                }
+                result.texels[size_t(y) * w + x] = sum;
+            }
+        }
+        return result;
+    }
+
+    std::filesystem::path appendToStem(const std::filesystem::path& filename, const char* suffix) {
+        return filename.parent_path() / (filename.stem().string() + suffix + filename.extension().string());
+    }
+} // namespace
+
+namespace vk_test {
+
+    bool loadImageRgba8(const std::filesystem::path& filename, ImageRgba8& image) {
+        int            w = 0, h = 0, comp = 0;
+        const stbi_uc* data = stbi_load(utf8FromPath(filename).c_str(), &w, &h, &comp, 4);
+        if (data == nullptr) {
+            return false;
+        }
+
+        image.width  = uint32_t(w);
+        image.height = uint32_t(h);
+        image.pixels.assign(data, data + size_t(w) * h * 4);
+        stbi_image_free((void*) data);
+        return true;
+    }
+
+    bool writeImageRgba8(const std::filesystem::path& filename, const ImageRgba8& image) {
+        std::error_code ec;
+        if (filename.has_parent_path()) {
+            std::filesystem::create_directories(filename.parent_path(), ec);
+        }
+
+        const int result = stbi_write_png(utf8FromPath(filename).c_str(), int(image.width), int(image.height), 4, image.pixels.data(), int(image.width * 4));
+        if (result == 0) {
+            VK_TEST_SAY("Could not write the image " << utf8FromPath(filename).c_str());
+        }
+        return result != 0;
+    }
+
+    ImageCompareResult compareImages(const ImageRgba8& image, const ImageRgba8& reference, const ImageCompareSettings& settings, ImageRgba8* error_map) {
+        ImageCompareResult result;
+        result.same_size = image.width == reference.width && image.height == reference.height && image.width * image.height != 0;
+        if (!result.same_size) {
+            return result;
+        }
+
+        // PSNR, of the 8 bits values
+        const size_t texel_count  = size_t(image.width) * image.height;
+        double       squared_sum = 0.0;
+        for (size_t i = 0; i < texel_count; i++) {
+            for (size_t c = 0; c < 3; c++) {
+                const double d = double(image.pixels[i * 4 + c]) - double(reference.pixels[i * 4 + c]);
+                squared_sum += d * d;
+            }
+        }
+        const double mse = squared_sum / double(texel_count * 3);
+        result.psnr_db   = mse == 0.0 ? std::numeric_limits<double>::infinity() : 10.0 * std::log10(255.0 * 255.0 / mse);
+
+        // Perceptual error, normalized by the distance of the primaries furthest apart in HyAB
+        static const float s_max_error = std::pow(hyab(linearToLab({ 0.0F, 1.0F, 0.0F }), linearToLab({ 0.0F, 0.0F, 1.0F })), 0.7F);
+
+        const LabImage lab_image     = toBlurredLab(image);
+        const LabImage lab_reference = toBlurredLab(reference);
+
+        if (error_map != nullptr) {
+            error_map->width  = image.width;
+            error_map->height = image.height;
+            error_map->pixels.assign(texel_count * 4, 255);
+        }
+
+        double   error_sum       = 0.0;
+        uint64_t different_count = 0;
+        for (size_t i = 0; i < texel_count; i++) {
+            const float error = std::min(std::pow(hyab(lab_image.texels[i], lab_reference.texels[i]), 0.7F) / s_max_error, 1.0F);
+            error_sum += error;
+            result.max_error = std::max(result.max_error, double(error));
+            different_count += error > settings.pixel_tolerance ? 1 : 0;
+
+            // Black, red, yellow, white
+            if (error_map != nullptr) {
+                uint8_t* pixel = &error_map->pixels[i * 4];
+                pixel[0]       = uint8_t(std::clamp(error * 3.0F, 0.0F, 1.0F) * 255.0F);
+                pixel[1]       = uint8_t(std::clamp(error * 3.0F - 1.0F, 0.0F, 1.0F) * 255.0F);
+                pixel[2]       = uint8_t(std::clamp(error * 3.0F - 2.0F, 0.0F, 1.0F) * 255.0F);
+            }
+        }
+        result.mean_error     = error_sum / double(texel_count);
+        result.different_rate = double(different_count) / double(texel_count);
+
+        result.passed = result.psnr_db >= settings.min_psnr_db && result.different_rate <= settings.max_different_rate && result.mean_error <= settings.max_mean_error;
+        return result;
+    }
+
+    ImageCompareResult checkGoldenImage(const ImageRgba8& image, const GoldenImageSettings& settings) {
+        if (!settings.output_file.empty()) {
+            writeImageRgba8(settings.output_file, image);
+        }
+
+        // The reference is only written when asked for, a missing one is a failure
+        if (settings.update_golden) {
+            VK_TEST_SAY("Golden image : " << utf8FromPath(settings.golden_file).c_str() << " is written from this run");
+            if (!writeImageRgba8(settings.golden_file, image)) {
+                return {};
+            }
+            return { .same_size = true, .passed = true, .psnr_db = std::numeric_limits<double>::infinity() };
+        }
+        if (!std::filesystem::exists(settings.golden_file)) {
+            VK_TEST_SAY("Golden image : " << utf8FromPath(settings.golden_file).c_str() << " does not exist, run with --update-golden to create it");
+            return {};
+        }
+
+        ImageRgba8 golden;
+        if (!loadImageRgba8(settings.golden_file, golden)) {
+            VK_TEST_SAY("Golden image : could not read " << utf8FromPath(settings.golden_file).c_str());
+            return {};
+        }
+
+        ImageRgba8               error_map;
+        const ImageCompareResult result = compareImages(image, golden, settings.thresholds, &error_map);
+        if (!result.same_size) {
+            VK_TEST_SAY("Golden image : " << image.width << "x" << image.height << " rendered, " << golden.width << "x" << golden.height << " expected");
+        }
+        else if (!result.passed) {
+            VK_TEST_SAY("Golden image : PSNR " << result.psnr_db << " dB, mean error " << result.mean_error << ", " << result.different_rate * 100.0 << "% of the pixels differ");
+
+            const std::filesystem::path output_file = settings.output_file.empty() ? appendToStem(settings.golden_file, "_output") : settings.output_file;
+            if (settings.output_file.empty()) {
+                writeImageRgba8(output_file, image);
+            }
+            writeImageRgba8(appendToStem(output_file, "_diff"), error_map);
+        }
+        return result;
+    }
+
+} // namespace vk_test
+
+//--------------------------------------------------------------------------------------------------
+// Usage example
+//--------------------------------------------------------------------------------------------------
+[[maybe_unused]] static void usage_ImageCompare() {
+    vk_test::ImageRgba8 rendered; // From ImageReadback
+
+    const vk_test::GoldenImageSettings settings{
+        .golden_file = "golden/teapot.png",
+        .output_file = "output/teapot.png",
+        .thresholds  = { .min_psnr_db = 35.0, .pixel_tolerance = 0.1F },
+    };
+
+    const vk_test::ImageCompareResult result = vk_test::checkGoldenImage(rendered, settings);
+    if (!result.passed) {
+        VK_TEST_SAY("The rendering changed, see output/teapot_diff.png");
+    }
+}
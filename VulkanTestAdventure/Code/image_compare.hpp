@@ -0,0 +1,63 @@
+#pragma once
+
+#include "image_readback.hpp"
+
+//-----------------------------------------------------------------
+// Comparison of rendered images with golden images, to check that an
+// optimization did not change the output.
+//
+// Two metrics are computed over the RGB channels:
+// - PSNR, catches any change, including noise below what is visible.
+// - A perceptual error per pixel in [0, 1], in the spirit of the color
+//   term of FLIP: both images go to CIELAB, are lightly blurred (a 3x3
+//   stand-in for the contrast sensitivity filter), and the HyAB
+//   distance of each pixel is normalized by the largest one in gamut
+//   and raised to 0.7. The feature (edge and point) term of FLIP is
+//   not computed.
+//
+// The check fails when the PSNR is below its threshold, or when too
+// many pixels, or the mean, are above their perceptual tolerances.
+//
+// checkGoldenImage() fails when the golden image does not exist, it is
+// only written when asked with `update_golden` (the reference of a new
+// test, or an intended change of the output). On failure, the rendered
+// image and a heat map of the error are written next to the output file.
+//
+// Usage:
+//      see usage_ImageCompare in image_compare.cpp
+//-----------------------------------------------------------------
+
+namespace vk_test {
+
+    struct ImageCompareSettings {
+        double min_psnr_db        = 40.0;  // Below it, the images differ
+        float  pixel_tolerance    = 0.05F; // Perceptual error of a pixel counted as different
+        double max_different_rate = 0.001; // Part of the pixels that can be different
+        double max_mean_error     = 0.01;  // Mean perceptual error (HyAB color distance)
+    };
+
+    struct ImageCompareResult {
+        bool   same_size      = false;
+        bool   passed         = false;
+        double psnr_db        = 0.0; // Infinite when identical
+        double mean_error     = 0.0; // Perceptual, in [0, 1]
+        double max_error      = 0.0;
+        double different_rate = 0.0; // Part of the pixels above pixel_tolerance
+    };
+
+    struct GoldenImageSettings {
+        std::filesystem::path golden_file;           // PNG, the check fails when it does not exist
+        std::filesystem::path output_file;           // The rendered image, always written when set, with "_diff" next to it on failure
+        bool                  update_golden = false; // Writes the golden image from this run instead of comparing
+        ImageCompareSettings  thresholds;
+    };
+
+    bool loadImageRgba8(const std::filesystem::path& filename, ImageRgba8& image);
+    bool writeImageRgba8(const std::filesystem::path& filename, const ImageRgba8& image);
+
+    // `error_map`, when given, gets a heat map of the perceptual error
+    ImageCompareResult compareImages(const ImageRgba8& image, const ImageRgba8& reference, const ImageCompareSettings& settings, ImageRgba8* error_map = nullptr);
+
+    ImageCompareResult checkGoldenImage(const ImageRgba8& image, const GoldenImageSettings& settings);
+
+} // namespace vk_test
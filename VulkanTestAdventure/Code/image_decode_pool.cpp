@@ -0,0 +1,170 @@
+#include "pch.h"
+#include "image_decode_pool.hpp"
+
+#include <staging.hpp>
+#include <default_structs.hpp>
+#include <file_operations.hpp>
+#include <Application.hpp>
+
+#include <stb_image.h>
+
+void vk_test::ImageDecodePool::init(uint32_t thread_count) {
+    assert(m_Threads.empty());
+    m_StopRequested = false;
+    m_FailedCount   = 0;
+
+    for (uint32_t i = 0; i < std::max(1U, thread_count); i++) {
+        m_Threads.emplace_back(&ImageDecodePool::workerThread, this);
+    }
+}
+
+void vk_test::ImageDecodePool::deinit() {
+    if (m_Threads.empty()) {
+        return;
+    }
+
+    // The staging space of the queued images may already be part of a recorded upload
+    waitDecoded();
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_StopRequested = true;
+    }
+    m_JobAdded.notify_all();
+
+    for (std::thread& thread : m_Threads) {
+        thread.join();
+    }
+    m_Threads.clear();
+}
+
+vk_test::Image vk_test::ImageDecodePool::appendImage(StagingUploader&             staging,
+                                                     const std::filesystem::path& filename,
+                                                     bool                         s_rgb,
+                                                     VkImageLayout                new_layout,
+                                                     const SemaphoreState&        semaphore_state) {
+    assert(!m_Threads.empty() && "Missing init()");
+
+    // Only the header is read here, the size of the staging space comes from it
+    Job job{ .filename_utf8 = utf8FromPath(filename) };
+    int comp = 0;
+    if (stbi_info(job.filename_utf8.c_str(), &job.width, &job.height, &comp) == 0) {
+        VK_TEST_SAY("Could not read the image " << job.filename_utf8.c_str() << " : " << stbi_failure_reason());
+        return {};
+    }
+    job.data_size = size_t(job.width) * size_t(job.height) * 4;
+
+    VkImageCreateInfo image_info = DEFAULT_VkImageCreateInfo;
+    image_info.format            = s_rgb ? VK_FORMAT_R8G8B8A8_SRGB : VK_FORMAT_R8G8B8A8_UNORM;
+    image_info.usage             = VK_IMAGE_USAGE_SAMPLED_BIT;
+    image_info.extent            = { uint32_t(job.width), uint32_t(job.height), 1 };
+
+    ResourceAllocator* allocator = staging.getResourceAllocator();
+
+    Image texture;
+    if (allocator->createImage(texture, image_info, DEFAULT_VkImageViewCreateInfo) != VK_SUCCESS) {
+        return {};
+    }
+    if (staging.appendImageMapping(texture, job.data_size, job.upload_mapping, new_layout, semaphore_state) != VK_SUCCESS) {
+        allocator->destroyImage(texture);
+        return {};
+    }
+
+    m_PendingCount++;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Jobs.push_back(std::move(job));
+    }
+    m_JobAdded.notify_one();
+
+    return texture;
+}
+
+uint32_t vk_test::ImageDecodePool::waitDecoded() {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_JobsDone.wait(lock, [&] { return m_PendingCount == 0; });
+
+    const uint32_t failed_count = m_FailedCount;
+    m_FailedCount               = 0;
+    return failed_count;
+}
+
+void vk_test::ImageDecodePool::workerThread() {
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_JobAdded.wait(lock, [&] { return m_StopRequested || !m_Jobs.empty(); });
+            if (m_Jobs.empty()) {
+                return; // Stop requested, and nothing left
+            }
+            job = std::move(m_Jobs.front());
+            m_Jobs.pop_front();
+        }
+
+        const bool decoded = decode(job);
+        m_DecodedCount++;
+
+        // Decremented under the lock, so waitDecoded() cannot miss the notification
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_FailedCount += decoded ? 0 : 1;
+            m_PendingCount--;
+        }
+        m_JobsDone.notify_all();
+    }
+}
+
+bool vk_test::ImageDecodePool::decode(const Job& job) const {
+    // stb_image always allocates its result, it is copied once into the staging space
+    int            w    = 0;
+    int            h    = 0;
+    int            comp = 0;
+    const stbi_uc* data = stbi_load(job.filename_utf8.c_str(), &w, &h, &comp, 4);
+    if (data == nullptr || w != job.width || h != job.height) {
+        VK_TEST_SAY("Could not decode the image " << job.filename_utf8.c_str());
+        memset(job.upload_mapping, 0, job.data_size);
+        stbi_image_free(const_cast<stbi_uc*>(data));
+        return false;
+    }
+
+    memcpy(job.upload_mapping, data, job.data_size);
+    stbi_image_free(const_cast<stbi_uc*>(data));
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Usage example
+//--------------------------------------------------------------------------------------------------
+[[maybe_unused]] static void usage_ImageDecodePool() {
+    vk_test::Application*              app{};     // The application
+    vk_test::ResourceAllocator         allocator; // Initialized allocator
+    vk_test::StagingUploader           staging;   // Initialized uploader, with layout barriers
+    std::vector<std::filesystem::path> filenames; // Images to load
+    std::vector<vk_test::Image>        textures;
+    vk_test::ImageDecodePool           decode_pool;
+
+    decode_pool.init();
+
+    VkCommandBuffer cmd = app->createTempCmdBuffer();
+
+    // Returns as soon as the headers are read, the workers decode in the meantime
+    for (const std::filesystem::path& filename : filenames) {
+        textures.push_back(decode_pool.appendImage(staging, filename));
+    }
+    staging.cmdUploadAppended(cmd);
+
+    // ... record or load anything else
+
+    // The staging space must be written before the copies are submitted
+    if (decode_pool.waitDecoded() != 0) {
+        VK_TEST_SAY("Some images could not be decoded");
+    }
+    app->submitAndWaitTempCmdBuffer(cmd);
+    staging.releaseStaging();
+
+    decode_pool.deinit();
+
+    for (vk_test::Image& texture : textures) {
+        allocator.destroyImage(texture);
+    }
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "resources.hpp"
+#include "semaphore.hpp"
+#include "parallel_work.hpp"
+
+//-----------------------------------------------------------------
+// ImageDecodePool loads PNG/JPG/... images on worker threads, so that
+// N textures cost about N / thread count decodes instead of N.
+//
+// appendImage() only reads the header of the file on the calling
+// thread, creates the image and appends its upload to a StagingUploader
+// with appendImageMapping(). A worker then decodes the pixels straight
+// into that staging space, the calling thread never touches them.
+// The copy can be recorded right away with cmdUploadAppended(), but
+// waitDecoded() must return before its command buffer is submitted.
+//
+// The image is ready to be sampled once the `semaphore_state` given
+// to appendImage() is signaled, as for any other staging upload.
+//
+// Usage:
+//      see usage_ImageDecodePool in image_decode_pool.cpp
+//-----------------------------------------------------------------
+
+namespace vk_test {
+
+    class StagingUploader;
+
+    class ImageDecodePool {
+    public:
+        ImageDecodePool()                                  = default;
+        ImageDecodePool(const ImageDecodePool&)            = delete;
+        ImageDecodePool& operator=(const ImageDecodePool&) = delete;
+        ~ImageDecodePool() { assert(m_Threads.empty() && "Missing deinit()"); }
+
+        void init(uint32_t thread_count = getThreadPoolSize());
+
+        // Finishes the queued decodes, then joins the workers
+        void deinit();
+
+        // Creates the RGBA8 image of `filename` and queues the decode of its pixels.
+        // Returns an empty image when the file cannot be read as an image.
+        Image appendImage(StagingUploader&             staging,
+                          const std::filesystem::path& filename,
+                          bool                         s_rgb           = true,
+                          VkImageLayout                new_layout      = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                          const SemaphoreState&        semaphore_state = {});
+
+        // Blocks until all queued images are written to the staging space.
+        // Returns the number of decodes that failed since the last call, their images stay black.
+        uint32_t waitDecoded();
+
+        // True when nothing is queued or being decoded
+        bool isDecoded() const { return m_PendingCount == 0; }
+
+        uint32_t getThreadCount() const { return uint32_t(m_Threads.size()); }
+        uint64_t getDecodedCount() const { return m_DecodedCount; }
+
+    private:
+        struct Job {
+            std::string filename_utf8;
+            void*       upload_mapping = nullptr; // Staging space of `data_size` bytes
+            size_t      data_size      = 0;
+            int         width          = 0; // From the header, the decode must match
+            int         height         = 0;
+        };
+
+        void workerThread();
+        bool decode(const Job& job) const;
+
+        std::vector<std::thread> m_Threads;
+
+        std::mutex              m_Mutex;
+        std::condition_variable m_JobAdded;
+        std::condition_variable m_JobsDone;
+        std::deque<Job>         m_Jobs;
+        bool                    m_StopRequested = false;
+        uint32_t                m_FailedCount   = 0;
+
+        std::atomic_uint     m_PendingCount{ 0 }; // Queued or being decoded
+        std::atomic_uint64_t m_DecodedCount{ 0 };
+    };
+
+} // namespace vk_test
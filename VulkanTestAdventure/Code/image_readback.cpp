@@ -0,0 +1,164 @@
+#include "pch.h"
+#include "image_readback.hpp"
+
+#include <barriers.hpp>
+#include <Application.hpp>
+
+static uint32_t getTexelSize(VkFormat format) {
+    return format == VK_FORMAT_R32G32B32A32_SFLOAT ? 16 : 4;
+}
+
+void vk_test::ImageReadback::init(ResourceAllocator* alloc) {
+    assert(!m_Alloc);
+    m_Alloc = alloc;
+}
+
+void vk_test::ImageReadback::deinit() {
+    if (m_Alloc == nullptr) {
+        return;
+    }
+
+    for (Request& request : m_Pending) {
+        m_Alloc->destroyBuffer(request.buffer);
+    }
+    m_Pending.clear();
+    m_Alloc = nullptr;
+}
+
+bool vk_test::ImageReadback::isFormatSupported(VkFormat format) {
+    switch (format) {
+        case VK_FORMAT_R8G8B8A8_UNORM:
+        case VK_FORMAT_R8G8B8A8_SRGB:
+        case VK_FORMAT_B8G8R8A8_UNORM:
+        case VK_FORMAT_B8G8R8A8_SRGB:
+        case VK_FORMAT_R32G32B32A32_SFLOAT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+VkResult vk_test::ImageReadback::cmdReadback(VkCommandBuffer       cmd,
+                                             VkImage               image,
+                                             VkImageLayout         layout,
+                                             VkFormat              format,
+                                             VkExtent2D            size,
+                                             const SemaphoreState& semaphore_state,
+                                             Callback&&            callback) {
+    assert(m_Alloc != nullptr && "Missing init()");
+    assert((layout == VK_IMAGE_LAYOUT_GENERAL || layout == VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL) && "The image is copied in its layout");
+    if (!isFormatSupported(format)) {
+        return VK_ERROR_FORMAT_NOT_SUPPORTED;
+    }
+
+    Request request{ .format = format, .size = size, .semaphore_state = semaphore_state, .callback = std::move(callback) };
+
+    VkResult result = m_Alloc->createBuffer(request.buffer,
+                                            VkDeviceSize(size.width) * size.height * getTexelSize(format),
+                                            VK_BUFFER_USAGE_2_TRANSFER_DST_BIT,
+                                            VMA_MEMORY_USAGE_AUTO_PREFER_HOST,
+                                            VMA_ALLOCATION_CREATE_MAPPED_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT);
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+
+    // Whatever wrote the image is done, the copy must be done before the next writes and the host read
+    cmdMemoryBarrier(cmd, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_ACCESS_2_MEMORY_WRITE_BIT, VK_ACCESS_2_TRANSFER_READ_BIT);
+
+    const VkBufferImageCopy region{
+        .imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 },
+        .imageExtent      = { size.width, size.height, 1 },
+    };
+    vkCmdCopyImageToBuffer(cmd, image, layout, request.buffer.buffer, 1, &region);
+
+    cmdMemoryBarrier(cmd, VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_PIPELINE_STAGE_2_HOST_BIT | VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT, VK_ACCESS_2_HOST_READ_BIT);
+
+    m_Pending.push_back(std::move(request));
+    return VK_SUCCESS;
+}
+
+void vk_test::ImageReadback::poll(bool wait) {
+    const VkDevice device = m_Alloc->getDevice();
+
+    // In order, a later readback is never done before an earlier one of the same queue
+    while (!m_Pending.empty()) {
+        Request& request = m_Pending.front();
+        if (wait) {
+            request.semaphore_state.wait(device, std::numeric_limits<uint64_t>::max());
+        }
+        else if (!request.semaphore_state.testSignaled(device)) {
+            return;
+        }
+
+        m_Alloc->invalidateBuffer(request.buffer);
+        ImageRgba8 image;
+        convert(request, image);
+
+        // The callback can record a new readback
+        Callback callback = std::move(request.callback);
+        m_Alloc->destroyBuffer(request.buffer);
+        m_Pending.pop_front();
+        callback(image);
+    }
+}
+
+void vk_test::ImageReadback::convert(const Request& request, ImageRgba8& image) {
+    image.width  = request.size.width;
+    image.height = request.size.height;
+    image.pixels.resize(size_t(image.width) * image.height * 4);
+
+    const size_t texel_count = size_t(image.width) * image.height;
+    switch (request.format) {
+        case VK_FORMAT_R8G8B8A8_UNORM:
+        case VK_FORMAT_R8G8B8A8_SRGB:
+            memcpy(image.pixels.data(), request.buffer.mapping, image.pixels.size());
+            break;
+        case VK_FORMAT_B8G8R8A8_UNORM:
+        case VK_FORMAT_B8G8R8A8_SRGB:
+            for (size_t i = 0; i < texel_count; i++) {
+                const uint8_t* texel = request.buffer.mapping + i * 4;
+                uint8_t*       pixel = &image.pixels[i * 4];
+
+                pixel[0] = texel[2];
+                pixel[1] = texel[1];
+                pixel[2] = texel[0];
+                pixel[3] = texel[3];
+            }
+            break;
+        case VK_FORMAT_R32G32B32A32_SFLOAT:
+            for (size_t i = 0; i < texel_count * 4; i++) {
+                float value;
+                memcpy(&value, request.buffer.mapping + i * sizeof(float), sizeof(float));
+                image.pixels[i] = uint8_t(std::clamp(value, 0.0F, 1.0F) * 255.0F + 0.5F);
+            }
+            break;
+        default:
+            assert(false && "Checked by cmdReadback()");
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+// Usage example
+//--------------------------------------------------------------------------------------------------
+[[maybe_unused]] static void usage_ImageReadback() {
+    vk_test::Application*       app{};       // The application, giving the frame semaphore state
+    vk_test::ResourceAllocator* allocator{}; // Of the element
+    VkCommandBuffer             cmd{};       // Frame command buffer, given to IAppElement::onRender
+    VkImage                     color_image{};
+    VkExtent2D                  size{};
+
+    vk_test::ImageReadback readback;
+    readback.init(allocator);
+
+    // After the image was written, in the frame command buffer
+    readback.cmdReadback(cmd, color_image, VK_IMAGE_LAYOUT_GENERAL, VK_FORMAT_R8G8B8A8_UNORM, size, app->getFrameSemaphoreState(), [](const vk_test::ImageRgba8& image) {
+        VK_TEST_SAY("Read back " << image.width << "x" << image.height);
+    });
+
+    // Once per frame, the callback is called a few frames later
+    readback.poll();
+
+    // At the end, waits for the copies left
+    readback.poll(true);
+    readback.deinit();
+}
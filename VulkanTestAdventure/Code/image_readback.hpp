@@ -0,0 +1,75 @@
+#pragma once
+
+#include "resource_allocator.hpp"
+#include "semaphore.hpp"
+
+//-----------------------------------------------------------------
+// ImageReadback copies images to host memory without stalling the
+// recording: cmdReadback() records the copy to a host visible buffer
+// in the given command buffer, and poll() hands the pixels to a callback
+// once the semaphore state of that command buffer is signaled.
+//
+// The pixels are converted to 8 bits RGBA, rows packed, as written by
+// stb_image_write (see image_compare.hpp). Float images are clamped to
+// [0, 1], they are not tonemapped.
+//
+// Usage:
+//      see usage_ImageReadback in image_readback.cpp
+//-----------------------------------------------------------------
+
+namespace vk_test {
+
+    struct ImageRgba8 {
+        uint32_t             width  = 0;
+        uint32_t             height = 0;
+        std::vector<uint8_t> pixels; // width * height * 4
+    };
+
+    class ImageReadback {
+    public:
+        using Callback = std::function<void(const ImageRgba8& image)>;
+
+        ImageReadback()                                = default;
+        ImageReadback(const ImageReadback&)            = delete;
+        ImageReadback& operator=(const ImageReadback&) = delete;
+        ~ImageReadback() { assert(m_Alloc == nullptr && "Missing deinit()"); }
+
+        void init(ResourceAllocator* alloc);
+
+        // the device must be idle, the pending callbacks are not called
+        void deinit();
+
+        // R8G8B8A8, B8G8R8A8 and R32G32B32A32_SFLOAT
+        static bool isFormatSupported(VkFormat format);
+
+        // Recorded outside of rendering, after the image was written. `layout` is GENERAL or TRANSFER_SRC_OPTIMAL,
+        // and is kept. `semaphore_state` is signaled when `cmd` has completed.
+        VkResult cmdReadback(VkCommandBuffer       cmd,
+                             VkImage               image,
+                             VkImageLayout         layout,
+                             VkFormat              format,
+                             VkExtent2D            size,
+                             const SemaphoreState& semaphore_state,
+                             Callback&&            callback);
+
+        // Calls the callbacks of the completed readbacks, in their order. With `wait`, waits for all of them.
+        void poll(bool wait = false);
+
+        size_t getPendingCount() const { return m_Pending.size(); }
+
+    private:
+        struct Request {
+            Buffer         buffer;
+            VkFormat       format = VK_FORMAT_UNDEFINED;
+            VkExtent2D     size{};
+            SemaphoreState semaphore_state;
+            Callback       callback;
+        };
+
+        static void convert(const Request& request, ImageRgba8& image);
+
+        ResourceAllocator*  m_Alloc{};
+        std::deque<Request> m_Pending;
+    };
+
+} // namespace vk_test
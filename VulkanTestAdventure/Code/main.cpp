@@ -5,6 +5,8 @@
 #include "element_camera.hpp"
 #include "element_default_title.hpp"
 #include "element_default_menu.hpp"
+#include "batch_transform.hpp"
+#include "vertex_welder.hpp"
 
 constexpr inline static glm::vec2        WINDOW_RESOLUTION = glm::vec2(1920, 1080);
 constexpr inline static std::string_view WINDOW_TITLE      = "VKTest";
@@ -13,6 +15,137 @@ constexpr inline static int              WINDOW_MONITOR    = -1; // not fullscre
 constexpr inline static int SUCCESSFUL_EXIT = 0;
 constexpr inline static int FAILED_EXIT     = -1;
 
+//-----------------------------------------------------------------------
+// Headless benchmark, ex. :
+//      VKTest --benchmark report.json --scene sponza.gltf --resolution 1920x1080 --warmup 60 --frames 600 --camera-path path.txt
+// --benchmark is required for the others, the camera path has one Camera::getString() per line (see Benchmark)
+// --vertex-format float keeps the vertices as in the glTF, to compare with the quantized ones
+// --mesh-optimization off keeps the triangle and vertex order of the glTF, the ACMR/ATVR of both are printed at import
+// --mesh-shaders on draws the culled meshlets with the task and mesh shaders on a device with VK_EXT_mesh_shader,
+//      the Hi-Z occlusion culling and the parallel recording of the vertex shader path are then not used
+// --lod-error 0 draws the full resolution meshes, otherwise the largest error in pixels of their levels of detail (1 by default)
+// --shadow-lod 2 traces the shadow rays against the level 2 of the meshes, 0 (the default) against the full resolution
+// --profiler-statistics vertex-invocations,fragment-invocations (or all) prints the pipeline statistics of the outermost GPU sections
+// --profiler-trace trace.json writes the CPU and GPU sections of the last frames as a Chrome trace (see GpuProfiler)
+//
+// The last frame can be checked against a golden image, the exit code is then FAILED_EXIT when it differs :
+//      VKTest --benchmark report.json --frames 1 --golden golden/teapot.png --output-image output/teapot.png --min-psnr 40 --max-color-error 0.01
+// --max-color-error is the largest mean perceptual (HyAB) color distance, in [0, 1]. A missing golden image fails the check,
+// --update-golden (without value) writes it from this run instead.
+//
+// CPU micro-benchmarks run alone, without a window or a device :
+//      VKTest --micro-benchmark transforms
+//      VKTest --micro-benchmark welding
+//
+static void parseBenchmarkArguments(int                             argc,
+                                    char*                           argv[],
+                                    vk_test::ApplicationCreateInfo& info,
+                                    std::filesystem::path&          scene_file,
+                                    vk_test::GoldenImageSettings&   golden_image,
+                                    bool&                           quantize_vertices,
+                                    bool&                           optimize_meshes,
+                                    bool&                           use_mesh_shaders,
+                                    float&                          lod_error,
+                                    uint32_t&                       shadow_lod) {
+    for (int i = 1; i < argc; i++) {
+        const std::string_view argument = argv[i];
+        if (argument == "--update-golden") { // The only argument without a value
+            golden_image.update_golden = true;
+            continue;
+        }
+        if (i + 1 == argc) {
+            VK_TEST_RUNTIME_ERROR("ERROR : Missing value of the argument " + std::string(argument));
+        }
+        const std::string value = argv[++i];
+
+        if (argument == "--benchmark") {
+            info.headless              = true;
+            info.benchmark.report_file = value;
+        }
+        else if (argument == "--scene") {
+            scene_file = value;
+        }
+        else if (argument == "--resolution") {
+            const size_t separator = value.find('x');
+            if (separator == std::string::npos) {
+                VK_TEST_RUNTIME_ERROR("ERROR : The resolution must be <width>x<height>, not " + value);
+            }
+            info.window_size = { uint32_t(std::stoul(value.substr(0, separator))), uint32_t(std::stoul(value.substr(separator + 1))) };
+        }
+        else if (argument == "--frames") {
+            info.headless_frame_count = uint32_t(std::stoul(value));
+        }
+        else if (argument == "--warmup") {
+            info.benchmark.warmup_frame_count = uint32_t(std::stoul(value));
+        }
+        else if (argument == "--camera-path") {
+            if (!vk_test::Benchmark::loadCameraPath(value, info.benchmark.camera_path)) {
+                VK_TEST_RUNTIME_ERROR("ERROR : Could not load the camera path " + value);
+            }
+        }
+        else if (argument == "--golden") {
+            golden_image.golden_file = value;
+        }
+        else if (argument == "--output-image") {
+            golden_image.output_file = value;
+        }
+        else if (argument == "--min-psnr") {
+            golden_image.thresholds.min_psnr_db = std::stod(value);
+        }
+        else if (argument == "--max-color-error") {
+            golden_image.thresholds.max_mean_error = std::stod(value);
+        }
+        else if (argument == "--vertex-format") {
+            if (value != "float" && value != "quantized") {
+                VK_TEST_RUNTIME_ERROR("ERROR : The vertex format must be float or quantized, not " + value);
+            }
+            quantize_vertices = value == "quantized";
+        }
+        else if (argument == "--mesh-optimization") {
+            if (value != "on" && value != "off") {
+                VK_TEST_RUNTIME_ERROR("ERROR : The mesh optimization must be on or off, not " + value);
+            }
+            optimize_meshes = value == "on";
+        }
+        else if (argument == "--mesh-shaders") {
+            if (value != "on" && value != "off") {
+                VK_TEST_RUNTIME_ERROR("ERROR : The mesh shaders must be on or off, not " + value);
+            }
+            use_mesh_shaders = value == "on";
+        }
+        else if (argument == "--lod-error") {
+            lod_error = std::stof(value);
+        }
+        else if (argument == "--shadow-lod") {
+            shadow_lod = uint32_t(std::stoul(value));
+        }
+        else if (argument == "--profiler-statistics") {
+            if (!vk_test::GpuProfiler::parseStatistics(value, info.profiler_statistics)) {
+                VK_TEST_RUNTIME_ERROR("ERROR : Unknown pipeline statistic in " + value);
+            }
+        }
+        else if (argument == "--profiler-trace") {
+            info.profiler_trace_file = value;
+        }
+        else {
+            VK_TEST_RUNTIME_ERROR("ERROR : Unknown argument " + std::string(argument));
+        }
+    }
+
+    if (!info.headless && argc > 1) {
+        VK_TEST_RUNTIME_ERROR("ERROR : The benchmark arguments need --benchmark <report.json>");
+    }
+    if (golden_image.update_golden && golden_image.golden_file.empty()) {
+        VK_TEST_RUNTIME_ERROR("ERROR : --update-golden needs --golden <image.png>");
+    }
+    info.benchmark.scene = scene_file.empty() ? "teapot" : scene_file.filename().string();
+
+    // Not from the monitor, the same on every machine
+    if (info.headless && (info.window_size.x == 0 || info.window_size.y == 0)) {
+        info.window_size = WINDOW_RESOLUTION;
+    }
+}
+
 int main(int argc, char* argv[]) {
     try {
         vk_test::PATH.init(argv[0], true); // instance of the PathManager
@@ -27,16 +160,39 @@ int main(int argc, char* argv[]) {
         return FAILED_EXIT;
     }
 
+    if (argc == 3 && std::string_view(argv[1]) == "--micro-benchmark") {
+        const std::string_view name = argv[2];
+        if (name == "transforms") {
+            vk_test::benchmarkBatchTransforms();
+            return SUCCESSFUL_EXIT;
+        }
+        if (name == "welding") {
+            vk_test::benchmarkVertexWelding();
+            return SUCCESSFUL_EXIT;
+        }
+        VK_TEST_SAY("ERROR : Unknown micro-benchmark " << std::string(name).c_str());
+        return FAILED_EXIT;
+    }
+
     std::unique_ptr<vk_test::Application> app     = std::make_unique<vk_test::Application>(WINDOW_RESOLUTION, WINDOW_TITLE.data(), WINDOW_MONITOR);
     std::unique_ptr<vk_test::Context>     context = std::make_unique<vk_test::Context>();
 
     try {
         vk_test::ApplicationCreateInfo application_create_info{};
+        std::filesystem::path          scene_file;
+        vk_test::GoldenImageSettings   golden_image;
+        bool                           quantize_vertices = true;
+        bool                           optimize_meshes   = true;
+        bool                           use_mesh_shaders  = false; // Opt-in, see --mesh-shaders
+        float                          lod_error         = 1.0F;
+        uint32_t                       shadow_lod        = 0;
+        parseBenchmarkArguments(argc, argv, application_create_info, scene_file, golden_image, quantize_vertices, optimize_meshes, use_mesh_shaders, lod_error, shadow_lod);
 
         // Setting up the Vulkan context, instance and device extensions
         VkPhysicalDeviceShaderObjectFeaturesEXT          shader_object_features{ .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_OBJECT_FEATURES_EXT };
         VkPhysicalDeviceAccelerationStructureFeaturesKHR accel_feature{ VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_FEATURES_KHR };
         VkPhysicalDeviceRayTracingPipelineFeaturesKHR    rt_pipeline_feature{ VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_FEATURES_KHR };
+        VkPhysicalDeviceMeshShaderFeaturesEXT            mesh_shader_features{ VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT };
 
         vk_test::ContextInitInfo vk_setup{
             .instance_extensions = { VK_EXT_DEBUG_UTILS_EXTENSION_NAME },
@@ -46,7 +202,10 @@ int main(int argc, char* argv[]) {
                 { VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME, &accel_feature },     // To build acceleration structures
                 { VK_KHR_RAY_TRACING_PIPELINE_EXTENSION_NAME, &rt_pipeline_feature }, // To use vkCmdTraceRaysKHR
                 { VK_KHR_DEFERRED_HOST_OPERATIONS_EXTENSION_NAME },                   // Required by ray tracing pipeline
+                { VK_KHR_CALIBRATED_TIMESTAMPS_EXTENSION_NAME, nullptr, false },      // GPU profiler trace on the CPU clock, optional
+                { VK_EXT_MESH_SHADER_EXTENSION_NAME, &mesh_shader_features, false },  // Meshlets culled by the task shader, optional
             },
+            .queues = { VK_QUEUE_GRAPHICS_BIT, VK_QUEUE_TRANSFER_BIT }, // Rendering, uploads (see UploadScheduler)
         };
 
         uint32_t     count{};
@@ -74,6 +233,13 @@ int main(int argc, char* argv[]) {
         auto window_menu        = std::make_shared<vk_test::ElementDefaultMenu>();
         auto camera_manipulator = tutorial->getCameraManipulator();
         element_camera->setCameraManipulator(camera_manipulator);
+        tutorial->setSceneFile(scene_file);
+        tutorial->setGoldenImage(golden_image);
+        tutorial->setQuantizeVertices(quantize_vertices);
+        tutorial->setOptimizeMeshes(optimize_meshes);
+        tutorial->setLodThreshold(lod_error);
+        tutorial->setShadowRayLod(shadow_lod);
+        tutorial->setMeshShaders(mesh_shader_features.taskShader == VK_TRUE && mesh_shader_features.meshShader == VK_TRUE, use_mesh_shaders);
 
         app->Initialize(application_create_info);
 
@@ -84,9 +250,14 @@ int main(int argc, char* argv[]) {
         app->addElement(tutorial);
 
         app->Loop();
+        const bool passed = app->getBenchmark().hasPassed(); // Checks of a headless run
         app->Release();
 
         context->Release();
+
+        if (!passed) {
+            return FAILED_EXIT;
+        }
     }
     catch (const std::exception& e) {
         VK_TEST_SAY(e.what());
@@ -0,0 +1,360 @@
+#include "pch.h"
+#include "mesh_optimizer.hpp"
+
+namespace {
+    // Forsyth scoring, with his published constants
+    constexpr int32_t FORSYTH_CACHE_SIZE          = 32;
+    constexpr float   FORSYTH_CACHE_DECAY_POWER   = 1.5F;
+    constexpr float   FORSYTH_LAST_TRIANGLE_SCORE = 0.75F;
+    constexpr float   FORSYTH_VALENCE_BOOST_SCALE = 2.0F;
+    constexpr float   FORSYTH_VALENCE_BOOST_POWER = 0.5F;
+
+    // Cache used to find the cluster boundaries of optimizeOverdraw()
+    constexpr uint32_t OVERDRAW_CACHE_SIZE = 16;
+
+    float vertexScore(int32_t cache_position, uint32_t remaining_valence) {
+        if (remaining_valence == 0) {
+            return -1.0F; // No triangle left to emit
+        }
+
+        float score = 0.0F;
+        if (cache_position >= 0) {
+            // The last triangle's vertices get a fixed score, so that strips are not favored
+            if (cache_position < 3) {
+                score = FORSYTH_LAST_TRIANGLE_SCORE;
+            }
+            else {
+                const float scaler = 1.0F / float(FORSYTH_CACHE_SIZE - 3);
+                score              = std::pow(1.0F - float(cache_position - 3) * scaler, FORSYTH_CACHE_DECAY_POWER);
+            }
+        }
+
+        // Vertices with few triangles left are finished first, not to leave lone triangles behind
+        score += FORSYTH_VALENCE_BOOST_SCALE * std::pow(float(remaining_valence), -FORSYTH_VALENCE_BOOST_POWER);
+        return score;
+    }
+
+    // FIFO cache, a vertex is a hit when it was transformed less than `cache_size` misses ago
+    class FifoCache {
+    public:
+        FifoCache(uint32_t vertex_count, uint32_t cache_size)
+            : m_Timestamps(vertex_count, 0), m_CacheSize(cache_size), m_Time(cache_size + 1) {}
+
+        // Returns true on a miss
+        bool access(uint32_t vertex) {
+            if (m_Time - m_Timestamps[vertex] > m_CacheSize) {
+                m_Timestamps[vertex] = m_Time++;
+                return true;
+            }
+            return false;
+        }
+
+        void flush() { m_Time += m_CacheSize + 1; }
+
+    private:
+        std::vector<uint32_t> m_Timestamps;
+        uint32_t              m_CacheSize = 0;
+        uint32_t              m_Time      = 0;
+    };
+} // namespace
+
+vk_test::VertexCacheStats vk_test::analyzeVertexCache(std::span<const uint32_t> indices, uint32_t vertex_count, uint32_t cache_size) {
+    assert(indices.size() % 3 == 0);
+    if (indices.empty()) {
+        return {};
+    }
+
+    FifoCache         cache(vertex_count, cache_size);
+    std::vector<bool> used(vertex_count, false);
+
+    VertexCacheStats stats{ .triangle_count = uint32_t(indices.size() / 3) };
+    for (uint32_t index : indices) {
+        stats.transformed_count += cache.access(index) ? 1 : 0;
+        if (!used[index]) {
+            used[index] = true;
+            stats.vertex_count++;
+        }
+    }
+
+    stats.acmr = float(stats.transformed_count) / float(stats.triangle_count);
+    stats.atvr = float(stats.transformed_count) / float(stats.vertex_count);
+    return stats;
+}
+
+vk_test::VertexCacheStats& vk_test::VertexCacheStats::operator+=(const VertexCacheStats& other) {
+    triangle_count += other.triangle_count;
+    vertex_count += other.vertex_count;
+    transformed_count += other.transformed_count;
+    acmr = triangle_count != 0 ? float(transformed_count) / float(triangle_count) : 0.0F;
+    atvr = vertex_count != 0 ? float(transformed_count) / float(vertex_count) : 0.0F;
+    return *this;
+}
+
+void vk_test::optimizeVertexCache(std::span<uint32_t> indices, uint32_t vertex_count) {
+    assert(indices.size() % 3 == 0);
+    const uint32_t triangle_count = uint32_t(indices.size() / 3);
+    if (triangle_count == 0) {
+        return;
+    }
+
+    // Triangles of each vertex, packed (CSR), the remaining ones first
+    std::vector<uint32_t> valence(vertex_count, 0);
+    for (uint32_t index : indices) {
+        valence[index]++;
+    }
+    std::vector<uint32_t> adjacency_offsets(vertex_count + 1, 0);
+    for (uint32_t v = 0; v < vertex_count; v++) {
+        adjacency_offsets[v + 1] = adjacency_offsets[v] + valence[v];
+    }
+    std::vector<uint32_t> adjacency(indices.size());
+    {
+        std::vector<uint32_t> fill(adjacency_offsets.begin(), adjacency_offsets.end() - 1);
+        for (uint32_t t = 0; t < triangle_count; t++) {
+            for (uint32_t c = 0; c < 3; c++) {
+                adjacency[fill[indices[t * 3 + c]]++] = t;
+            }
+        }
+    }
+
+    std::vector<float> vertex_scores(vertex_count);
+    for (uint32_t v = 0; v < vertex_count; v++) {
+        vertex_scores[v] = vertexScore(-1, valence[v]);
+    }
+
+    std::vector<float> triangle_scores(triangle_count);
+    std::vector<bool>  emitted(triangle_count, false);
+    for (uint32_t t = 0; t < triangle_count; t++) {
+        triangle_scores[t] = vertex_scores[indices[t * 3 + 0]] + vertex_scores[indices[t * 3 + 1]] + vertex_scores[indices[t * 3 + 2]];
+    }
+
+    std::vector<uint32_t> result;
+    result.reserve(indices.size());
+
+    // LRU cache of the scoring, with room for the 3 vertices pushed by a triangle
+    std::vector<uint32_t> cache;
+    std::vector<uint32_t> next_cache;
+    cache.reserve(FORSYTH_CACHE_SIZE + 3);
+    next_cache.reserve(FORSYTH_CACHE_SIZE + 3);
+
+    uint32_t best_triangle = 0;
+    uint32_t input_cursor  = 0; // Triangles before it are all emitted
+    for (uint32_t emitted_count = 0; emitted_count < triangle_count; emitted_count++) {
+        // Nothing in the cache is connected to a triangle left, take the next one of the input order
+        if (best_triangle == ~0U) {
+            while (emitted[input_cursor]) {
+                input_cursor++;
+            }
+            best_triangle = input_cursor;
+        }
+
+        const uint32_t* triangle = &indices[best_triangle * 3];
+        result.insert(result.end(), triangle, triangle + 3);
+        emitted[best_triangle] = true;
+
+        // The triangle is removed from the adjacency of its vertices
+        for (uint32_t c = 0; c < 3; c++) {
+            const uint32_t v     = triangle[c];
+            uint32_t*      first = &adjacency[adjacency_offsets[v]];
+            uint32_t*      last  = first + valence[v];
+            std::swap(*std::find(first, last, best_triangle), *(last - 1));
+            valence[v]--;
+        }
+
+        // The vertices of the triangle go in front of the cache
+        next_cache.assign(triangle, triangle + 3);
+        for (uint32_t v : cache) {
+            if (v != triangle[0] && v != triangle[1] && v != triangle[2]) {
+                next_cache.push_back(v);
+            }
+        }
+        std::swap(cache, next_cache);
+
+        // Update the scores of the vertices in the cache and the ones pushed out, and of their triangles
+        for (size_t i = 0; i < cache.size(); i++) {
+            const uint32_t v        = cache[i];
+            const int32_t  position = i < FORSYTH_CACHE_SIZE ? int32_t(i) : -1;
+
+            const float score_delta = vertexScore(position, valence[v]) - vertex_scores[v];
+            vertex_scores[v] += score_delta;
+            for (uint32_t a = 0; a < valence[v]; a++) {
+                triangle_scores[adjacency[adjacency_offsets[v] + a]] += score_delta;
+            }
+        }
+        cache.resize(std::min<size_t>(cache.size(), FORSYTH_CACHE_SIZE));
+
+        // The next triangle is the best one using a vertex of the cache
+        best_triangle    = ~0U;
+        float best_score = -1.0F;
+        for (uint32_t v : cache) {
+            for (uint32_t a = 0; a < valence[v]; a++) {
+                const uint32_t t = adjacency[adjacency_offsets[v] + a];
+                if (triangle_scores[t] > best_score) {
+                    best_score    = triangle_scores[t];
+                    best_triangle = t;
+                }
+            }
+        }
+    }
+
+    std::ranges::copy(result, indices.begin());
+}
+
+void vk_test::optimizeOverdraw(std::span<uint32_t> indices, std::span<const glm::vec3> positions, float threshold) {
+    assert(indices.size() % 3 == 0);
+    const uint32_t triangle_count = uint32_t(indices.size() / 3);
+    const uint32_t vertex_count   = uint32_t(positions.size());
+    if (triangle_count == 0) {
+        return;
+    }
+
+    // Hard boundaries, where all the vertices of a triangle miss: the cache is not shared with what comes before
+    std::vector<uint32_t> hard_boundaries;
+    {
+        FifoCache cache(vertex_count, OVERDRAW_CACHE_SIZE);
+        for (uint32_t t = 0; t < triangle_count; t++) {
+            uint32_t misses = 0;
+            for (uint32_t c = 0; c < 3; c++) {
+                misses += cache.access(indices[t * 3 + c]) ? 1 : 0;
+            }
+            if (t == 0 || misses == 3) {
+                hard_boundaries.push_back(t);
+            }
+        }
+        hard_boundaries.push_back(triangle_count);
+    }
+
+    // Soft boundaries, a hard cluster is cut when the part since the last cut keeps its ACMR within the threshold
+    std::vector<uint32_t> clusters;
+    for (size_t h = 0; h + 1 < hard_boundaries.size(); h++) {
+        const uint32_t first = hard_boundaries[h];
+        const uint32_t last  = hard_boundaries[h + 1];
+
+        const float cluster_acmr = analyzeVertexCache(indices.subspan(first * 3, (last - first) * 3), vertex_count, OVERDRAW_CACHE_SIZE).acmr;
+
+        FifoCache cache(vertex_count, OVERDRAW_CACHE_SIZE);
+        uint32_t  start  = first;
+        uint32_t  misses = 0;
+        clusters.push_back(first);
+        for (uint32_t t = first; t < last; t++) {
+            for (uint32_t c = 0; c < 3; c++) {
+                misses += cache.access(indices[t * 3 + c]) ? 1 : 0;
+            }
+
+            // At least a few triangles, the order inside a cluster is kept
+            const uint32_t count = t + 1 - start;
+            if (count >= 8 && t + 1 < last && float(misses) / float(count) <= cluster_acmr * threshold) {
+                clusters.push_back(t + 1);
+                start  = t + 1;
+                misses = 0;
+                cache.flush(); // The next cluster may be drawn anywhere
+            }
+        }
+    }
+    clusters.push_back(triangle_count);
+
+    // Centroid of the mesh, weighted by area
+    glm::vec3 mesh_centroid(0.0F);
+    float     mesh_area = 0.0F;
+    for (uint32_t t = 0; t < triangle_count; t++) {
+        const glm::vec3& a    = positions[indices[t * 3 + 0]];
+        const glm::vec3& b    = positions[indices[t * 3 + 1]];
+        const glm::vec3& c    = positions[indices[t * 3 + 2]];
+        const float      area = glm::length(glm::cross(b - a, c - a));
+        mesh_centroid += (a + b + c) * (area / 3.0F);
+        mesh_area += area;
+    }
+    mesh_centroid /= std::max(mesh_area, 1e-20F);
+
+    // Clusters facing away from the center are likely in front, drawn first
+    struct Cluster {
+        uint32_t first = 0;
+        uint32_t last  = 0;
+        float    sort  = 0.0F;
+    };
+    std::vector<Cluster> sorted(clusters.size() - 1);
+    for (size_t i = 0; i + 1 < clusters.size(); i++) {
+        glm::vec3 centroid(0.0F);
+        glm::vec3 normal(0.0F);
+        float     area_sum = 0.0F;
+        for (uint32_t t = clusters[i]; t < clusters[i + 1]; t++) {
+            const glm::vec3& a     = positions[indices[t * 3 + 0]];
+            const glm::vec3& b     = positions[indices[t * 3 + 1]];
+            const glm::vec3& c     = positions[indices[t * 3 + 2]];
+            const glm::vec3  cross = glm::cross(b - a, c - a); // Length is twice the area
+            const float      area  = glm::length(cross);
+            centroid += (a + b + c) * (area / 3.0F);
+            normal += cross;
+            area_sum += area;
+        }
+        centroid /= std::max(area_sum, 1e-20F);
+        const float normal_length = glm::length(normal);
+
+        sorted[i] = {
+            .first = clusters[i],
+            .last  = clusters[i + 1],
+            .sort  = normal_length > 0.0F ? glm::dot(centroid - mesh_centroid, normal / normal_length) : 0.0F,
+        };
+    }
+    std::ranges::stable_sort(sorted, std::greater<float>(), &Cluster::sort);
+
+    std::vector<uint32_t> result;
+    result.reserve(indices.size());
+    for (const Cluster& cluster : sorted) {
+        result.insert(result.end(), indices.begin() + cluster.first * 3, indices.begin() + cluster.last * 3);
+    }
+    std::ranges::copy(result, indices.begin());
+}
+
+uint32_t vk_test::optimizeVertexFetchRemap(std::span<uint32_t> indices, uint32_t vertex_count, std::vector<uint32_t>& remap) {
+    remap.assign(vertex_count, ~0U);
+
+    uint32_t next = 0;
+    for (uint32_t& index : indices) {
+        if (remap[index] == ~0U) {
+            remap[index] = next++;
+        }
+        index = remap[index];
+    }
+
+    const uint32_t used_count = next;
+    for (uint32_t& new_index : remap) {
+        if (new_index == ~0U) {
+            new_index = next++;
+        }
+    }
+    return used_count;
+}
+
+void vk_test::remapVertexData(uint8_t* data, uint32_t vertex_count, size_t stride, size_t element_size, std::span<const uint32_t> remap) {
+    assert(remap.size() == vertex_count);
+
+    std::vector<uint8_t> original(size_t(vertex_count) * element_size);
+    for (uint32_t v = 0; v < vertex_count; v++) {
+        memcpy(&original[v * element_size], data + v * stride, element_size);
+    }
+    for (uint32_t v = 0; v < vertex_count; v++) {
+        memcpy(data + remap[v] * stride, &original[v * element_size], element_size);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+// Usage example
+//--------------------------------------------------------------------------------------------------
+[[maybe_unused]] static void usage_MeshOptimizer() {
+    std::vector<glm::vec3> positions; // Of the mesh
+    std::vector<uint32_t>  indices;   // 3 per triangle
+    const uint32_t         vertex_count = uint32_t(positions.size());
+
+    const vk_test::VertexCacheStats before = vk_test::analyzeVertexCache(indices, vertex_count);
+
+    vk_test::optimizeVertexCache(indices, vertex_count);
+    vk_test::optimizeOverdraw(indices, positions);
+
+    // The vertex data follows the new numbering
+    std::vector<uint32_t> remap;
+    vk_test::optimizeVertexFetchRemap(indices, vertex_count, remap);
+    vk_test::remapVertexData(reinterpret_cast<uint8_t*>(positions.data()), vertex_count, sizeof(glm::vec3), sizeof(glm::vec3), remap);
+
+    const vk_test::VertexCacheStats after = vk_test::analyzeVertexCache(indices, vertex_count);
+    VK_TEST_SAY("ACMR " << before.acmr << " -> " << after.acmr << ", ATVR " << before.atvr << " -> " << after.atvr);
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+//-----------------------------------------------------------------
+// Reordering of indexed triangle lists for the raster pipeline,
+// done once when a mesh is imported or created.
+//
+// The passes are run in this order:
+// - optimizeVertexCache() : triangles reordered for the post-transform
+//   vertex cache (Forsyth, "Linear-Speed Vertex Cache Optimisation").
+// - optimizeOverdraw() : the cache friendly order is cut in clusters,
+//   which are sorted to draw the outward facing ones first (Sander et
+//   al., "Fast Triangle Reordering for Vertex Locality and Reduced
+//   Overdraw"). A cluster is only cut where the cache stays within
+//   `threshold` of its ACMR.
+// - optimizeVertexFetchRemap() : vertices renumbered in the order of
+//   their first use, so the vertex fetch reads memory forward.
+//
+// analyzeVertexCache() simulates a FIFO cache to measure the gain:
+// ACMR is the number of vertex shader invocations per triangle (3 at
+// worst, about 0.5 for a regular grid), ATVR per vertex (1 at best).
+//
+// Usage:
+//      see usage_MeshOptimizer in mesh_optimizer.cpp
+//-----------------------------------------------------------------
+
+namespace vk_test {
+
+    struct VertexCacheStats {
+        uint32_t triangle_count    = 0;
+        uint32_t vertex_count      = 0;    // Vertices used by the triangles
+        uint32_t transformed_count = 0;    // Vertex shader invocations
+        float    acmr              = 0.0F; // Average cache miss ratio, transformed vertices per triangle
+        float    atvr              = 0.0F; // Average transformed vertex ratio, transformed vertices per vertex used
+
+        // Sums the counts of several meshes, the ratios are of the total
+        VertexCacheStats& operator+=(const VertexCacheStats& other);
+    };
+
+    // FIFO cache of `cache_size` entries, like most hardware
+    VertexCacheStats analyzeVertexCache(std::span<const uint32_t> indices, uint32_t vertex_count, uint32_t cache_size = 16);
+
+    // Reorders the triangles of `indices`, each one keeps its winding
+    void optimizeVertexCache(std::span<uint32_t> indices, uint32_t vertex_count);
+
+    // Reorders the clusters of triangles of `indices`, ordered by optimizeVertexCache() first.
+    // `threshold` is the ACMR increase allowed, 1.05 lets it grow by 5%.
+    void optimizeOverdraw(std::span<uint32_t> indices, std::span<const glm::vec3> positions, float threshold = 1.05F);
+
+    // Fills `remap` with the new index of each vertex, in the order of first use, and rewrites `indices`.
+    // Unused vertices go after the used ones, so `remap` is always a permutation. Returns the number of used vertices.
+    uint32_t optimizeVertexFetchRemap(std::span<uint32_t> indices, uint32_t vertex_count, std::vector<uint32_t>& remap);
+
+    // Moves the elements of `data` (`stride` bytes apart, `element_size` bytes each) to their index in `remap`
+    void remapVertexData(uint8_t* data, uint32_t vertex_count, size_t stride, size_t element_size, std::span<const uint32_t> remap);
+
+} // namespace vk_test
@@ -0,0 +1,336 @@
+#include "pch.h"
+#include "mesh_simplifier.hpp"
+#include "mesh_optimizer.hpp"
+
+namespace {
+    // Levels under this many triangles are not worth an index buffer
+    constexpr size_t MESH_LOD_MIN_TRIANGLES = 8;
+
+    // Sum of the squared distances to planes, weighted by the area of their triangles
+    struct Quadric {
+        double a2 = 0.0, b2 = 0.0, c2 = 0.0, d2 = 0.0;
+        double ab = 0.0, ac = 0.0, ad = 0.0, bc = 0.0, bd = 0.0, cd = 0.0;
+        double weight = 0.0;
+
+        // Plane of unit `normal`, dot(normal, p) + d = 0
+        void addPlane(const glm::dvec3& normal, double d, double w) {
+            a2 += w * normal.x * normal.x;
+            b2 += w * normal.y * normal.y;
+            c2 += w * normal.z * normal.z;
+            d2 += w * d * d;
+            ab += w * normal.x * normal.y;
+            ac += w * normal.x * normal.z;
+            ad += w * normal.x * d;
+            bc += w * normal.y * normal.z;
+            bd += w * normal.y * d;
+            cd += w * normal.z * d;
+            weight += w;
+        }
+
+        Quadric& operator+=(const Quadric& other) {
+            a2 += other.a2, b2 += other.b2, c2 += other.c2, d2 += other.d2;
+            ab += other.ab, ac += other.ac, ad += other.ad, bc += other.bc, bd += other.bd, cd += other.cd;
+            weight += other.weight;
+            return *this;
+        }
+
+        // Mean squared distance of `p` to the planes
+        double error(const glm::vec3& p) const {
+            const double x = p.x;
+            const double y = p.y;
+            const double z = p.z;
+            const double e = a2 * x * x + b2 * y * y + c2 * z * z + 2.0 * (ab * x * y + ac * x * z + bc * y * z) + 2.0 * (ad * x + bd * y + cd * z) + d2;
+            return weight > 0.0 ? std::max(e, 0.0) / weight : 0.0;
+        }
+    };
+
+    struct Collapse {
+        uint32_t from = 0; // Welded vertex moved
+        uint32_t to   = 0; // Welded vertex kept
+        double   cost = 0.0;
+    };
+
+    // First vertex at the same position, for each vertex
+    std::vector<uint32_t> weldPositions(std::span<const glm::vec3> positions) {
+        struct Key {
+            uint32_t x, y, z;
+            bool     operator==(const Key&) const = default;
+        };
+        struct KeyHash {
+            size_t operator()(const Key& key) const { return (size_t(key.x) * 73856093U) ^ (size_t(key.y) * 19349663U) ^ (size_t(key.z) * 83492791U); }
+        };
+
+        std::unordered_map<Key, uint32_t, KeyHash> first_vertex;
+        first_vertex.reserve(positions.size());
+
+        std::vector<uint32_t> weld(positions.size());
+        for (uint32_t v = 0; v < uint32_t(positions.size()); v++) {
+            // + 0.0F makes -0 and 0 the same key
+            const Key key{ std::bit_cast<uint32_t>(positions[v].x + 0.0F), std::bit_cast<uint32_t>(positions[v].y + 0.0F), std::bit_cast<uint32_t>(positions[v].z + 0.0F) };
+            weld[v] = first_vertex.try_emplace(key, v).first->second;
+        }
+        return weld;
+    }
+
+    bool isWeldedDegenerate(const uint32_t* triangle, const std::vector<uint32_t>& weld) {
+        const uint32_t a = weld[triangle[0]];
+        const uint32_t b = weld[triangle[1]];
+        const uint32_t c = weld[triangle[2]];
+        return a == b || b == c || c == a;
+    }
+} // namespace
+
+std::vector<uint32_t> vk_test::simplifyMesh(std::span<const uint32_t>  indices,
+                                            std::span<const glm::vec3> positions,
+                                            size_t                     target_index_count,
+                                            float                      target_error,
+                                            float*                     result_error) {
+    assert(indices.size() % 3 == 0);
+    const uint32_t              vertex_count = uint32_t(positions.size());
+    const std::vector<uint32_t> weld         = weldPositions(positions);
+
+    // Triangles collapsed by the welding are dropped from the start
+    std::vector<uint32_t> result;
+    result.reserve(indices.size());
+    for (size_t t = 0; t < indices.size(); t += 3) {
+        if (!isWeldedDegenerate(&indices[t], weld)) {
+            result.insert(result.end(), { indices[t], indices[t + 1], indices[t + 2] });
+        }
+    }
+
+    // Planes of the triangles around each welded vertex
+    std::vector<Quadric> quadrics(vertex_count);
+    for (size_t t = 0; t < result.size(); t += 3) {
+        const glm::dvec3 p0(positions[result[t]]);
+        const glm::dvec3 normal = glm::cross(glm::dvec3(positions[result[t + 1]]) - p0, glm::dvec3(positions[result[t + 2]]) - p0);
+        const double     length = glm::length(normal);
+        if (length > 0.0) {
+            Quadric quadric;
+            quadric.addPlane(normal / length, -glm::dot(normal / length, p0), length * 0.5);
+            for (uint32_t c = 0; c < 3; c++) {
+                quadrics[weld[result[t + c]]] += quadric;
+            }
+        }
+    }
+
+    const double max_cost = target_error >= std::numeric_limits<float>::max() ? std::numeric_limits<double>::max() : double(target_error) * double(target_error);
+    double       error    = 0.0;
+
+    std::vector<uint8_t>  locked(vertex_count);
+    std::vector<uint8_t>  touched(vertex_count);
+    std::vector<uint32_t> copy_target(vertex_count, ~0U); // Vertex replacing each copy of a moved vertex
+    std::vector<uint32_t> copies_set;
+    std::vector<uint32_t> triangle_offsets(vertex_count + 1);
+    std::vector<uint32_t> vertex_triangles;
+    std::vector<uint64_t> edges;
+    std::vector<Collapse> collapses;
+
+    // One pass collapses each vertex at most once, so the flip checks see the triangles as they will be
+    while (result.size() > target_index_count) {
+        const uint32_t triangle_count = uint32_t(result.size() / 3);
+
+        // Welded edges, those not shared by exactly two triangles are open borders or non-manifold
+        edges.clear();
+        for (uint32_t t = 0; t < triangle_count; t++) {
+            for (uint32_t c = 0; c < 3; c++) {
+                const uint32_t a = weld[result[t * 3 + c]];
+                const uint32_t b = weld[result[t * 3 + (c + 1) % 3]];
+                edges.push_back((uint64_t(std::min(a, b)) << 32) | std::max(a, b));
+            }
+        }
+        std::ranges::sort(edges);
+
+        std::ranges::fill(locked, uint8_t(0));
+        size_t unique_count = 0;
+        for (size_t e = 0; e < edges.size();) {
+            size_t count = 1;
+            while (e + count < edges.size() && edges[e + count] == edges[e]) {
+                count++;
+            }
+            if (count != 2) {
+                locked[uint32_t(edges[e] >> 32)] = 1;
+                locked[uint32_t(edges[e])]       = 1;
+            }
+            edges[unique_count++] = edges[e];
+            e += count;
+        }
+        edges.resize(unique_count);
+
+        // Triangles around each welded vertex
+        std::ranges::fill(triangle_offsets, 0U);
+        for (uint32_t index : result) {
+            triangle_offsets[weld[index] + 1]++;
+        }
+        for (uint32_t v = 0; v < vertex_count; v++) {
+            triangle_offsets[v + 1] += triangle_offsets[v];
+        }
+        vertex_triangles.resize(result.size());
+        {
+            std::vector<uint32_t> fill(triangle_offsets.begin(), triangle_offsets.end() - 1);
+            for (uint32_t i = 0; i < uint32_t(result.size()); i++) {
+                vertex_triangles[fill[weld[result[i]]]++] = i / 3;
+            }
+        }
+
+        // Both directions of each edge, the cheapest first
+        collapses.clear();
+        for (uint64_t edge : edges) {
+            const uint32_t a = uint32_t(edge >> 32);
+            const uint32_t b = uint32_t(edge);
+            for (const auto& [from, to] : { std::pair{ a, b }, std::pair{ b, a } }) {
+                if (locked[from] == 0) {
+                    Quadric quadric = quadrics[from];
+                    quadric += quadrics[to];
+                    collapses.push_back({ .from = from, .to = to, .cost = quadric.error(positions[to]) });
+                }
+            }
+        }
+        std::ranges::sort(collapses, {}, &Collapse::cost);
+
+        std::ranges::fill(touched, uint8_t(0));
+        const size_t triangles_to_remove = (result.size() - target_index_count + 2) / 3;
+        size_t       removed             = 0;
+        for (const Collapse& collapse : collapses) {
+            if (removed >= triangles_to_remove || collapse.cost > max_cost) {
+                break;
+            }
+            if (touched[collapse.from] != 0 || touched[collapse.to] != 0) {
+                continue;
+            }
+
+            const std::span<const uint32_t> around(vertex_triangles.data() + triangle_offsets[collapse.from], triangle_offsets[collapse.from + 1] - triangle_offsets[collapse.from]);
+
+            // Each copy of `from` goes to the copy of `to` across the same edge
+            const size_t first_copy = copies_set.size();
+            uint32_t     collapsed  = 0;
+            for (uint32_t t : around) {
+                uint32_t from_vertex = ~0U;
+                uint32_t to_vertex   = ~0U;
+                for (uint32_t c = 0; c < 3; c++) {
+                    const uint32_t v = result[t * 3 + c];
+                    from_vertex      = weld[v] == collapse.from ? v : from_vertex;
+                    to_vertex        = weld[v] == collapse.to ? v : to_vertex;
+                }
+                if (to_vertex != ~0U) {
+                    collapsed++;
+                    if (copy_target[from_vertex] == ~0U) {
+                        copy_target[from_vertex] = to_vertex;
+                        copies_set.push_back(from_vertex);
+                    }
+                }
+            }
+
+            // A copy without an edge to `to` would open the seam, a triangle turning by more than 75 degrees would fold the surface
+            bool valid = true;
+            for (uint32_t t : around) {
+                glm::vec3 before[3];
+                glm::vec3 after[3];
+                bool      has_to = false;
+                for (uint32_t c = 0; c < 3; c++) {
+                    const uint32_t v = result[t * 3 + c];
+                    before[c]        = positions[v];
+                    after[c]         = weld[v] == collapse.from ? positions[collapse.to] : positions[v];
+                    has_to           = has_to || weld[v] == collapse.to;
+                    valid            = valid && (weld[v] != collapse.from || copy_target[v] != ~0U);
+                }
+                if (!has_to && valid) {
+                    const glm::vec3 normal_before = glm::cross(before[1] - before[0], before[2] - before[0]);
+                    const glm::vec3 normal_after  = glm::cross(after[1] - after[0], after[2] - after[0]);
+                    valid                         = glm::dot(normal_before, normal_after) > 0.25F * glm::length(normal_before) * glm::length(normal_after);
+                }
+                if (!valid) {
+                    break;
+                }
+            }
+            if (!valid) {
+                for (size_t i = first_copy; i < copies_set.size(); i++) {
+                    copy_target[copies_set[i]] = ~0U;
+                }
+                copies_set.resize(first_copy);
+                continue;
+            }
+
+            for (uint32_t t : around) {
+                for (uint32_t c = 0; c < 3; c++) {
+                    touched[weld[result[t * 3 + c]]] = 1;
+                }
+            }
+            quadrics[collapse.to] += quadrics[collapse.from];
+            error = std::max(error, collapse.cost);
+            removed += collapsed;
+        }
+        if (copies_set.empty()) {
+            break; // Nothing left under the error, or everything locked
+        }
+
+        // Move the copies and drop the triangles collapsed to an edge
+        size_t write = 0;
+        for (size_t t = 0; t < result.size(); t += 3) {
+            uint32_t triangle[3];
+            for (uint32_t c = 0; c < 3; c++) {
+                const uint32_t v = result[t + c];
+                triangle[c]      = copy_target[v] != ~0U ? copy_target[v] : v;
+            }
+            if (!isWeldedDegenerate(triangle, weld)) {
+                result[write++] = triangle[0];
+                result[write++] = triangle[1];
+                result[write++] = triangle[2];
+            }
+        }
+        result.resize(write);
+
+        for (uint32_t v : copies_set) {
+            copy_target[v] = ~0U;
+        }
+        copies_set.clear();
+    }
+
+    if (result_error != nullptr) {
+        *result_error = float(std::sqrt(error));
+    }
+    return result;
+}
+
+std::vector<vk_test::MeshLod> vk_test::buildMeshLods(std::span<const uint32_t> indices, std::span<const glm::vec3> positions, uint32_t max_levels, float ratio) {
+    std::vector<MeshLod> lods;
+
+    std::span<const uint32_t> previous       = indices;
+    float                     previous_error = 0.0F;
+    for (uint32_t level = 0; level < max_levels; level++) {
+        const size_t target_triangles = size_t(float(previous.size() / 3) * ratio);
+        if (target_triangles < MESH_LOD_MIN_TRIANGLES) {
+            break;
+        }
+
+        MeshLod lod;
+        lod.indices = simplifyMesh(previous, positions, target_triangles * 3, std::numeric_limits<float>::max(), &lod.error);
+        if (lod.indices.size() * 10 > previous.size() * 9) {
+            break;
+        }
+        lod.error += previous_error;
+        optimizeVertexCache(lod.indices, uint32_t(positions.size()));
+
+        lods.push_back(std::move(lod));
+        previous       = lods.back().indices;
+        previous_error = lods.back().error;
+    }
+    return lods;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Usage example
+//--------------------------------------------------------------------------------------------------
+[[maybe_unused]] static void usage_MeshSimplifier() {
+    std::vector<glm::vec3> positions; // Of the mesh
+    std::vector<uint32_t>  indices;   // 3 per triangle
+
+    // Half of the triangles, or fewer as long as no vertex moves more than 0.01 from the surface
+    float                       error      = 0.0F;
+    const std::vector<uint32_t> simplified = vk_test::simplifyMesh(indices, positions, indices.size() / 2, 0.01F, &error);
+    VK_TEST_SAY(simplified.size() / 3 << " triangles, error " << error);
+
+    // Chain of levels, stored after the full resolution indices (see GltfMesh::lods)
+    for (const vk_test::MeshLod& lod : vk_test::buildMeshLods(indices, positions, 4)) {
+        VK_TEST_SAY(lod.indices.size() / 3 << " triangles, error " << lod.error);
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+//-----------------------------------------------------------------
+// Levels of detail of an indexed triangle list, made of edge collapses
+// ordered by their quadric error (Garland and Heckbert, "Surface
+// Simplification Using Quadric Error Metrics").
+//
+// A vertex is only ever moved onto one of its neighbors, so every
+// level indexes the vertices of the full resolution mesh: a level is
+// just another index buffer, drawn and traced with the same vertex
+// streams.
+// - Vertices at the same position (the attribute seams of a glTF) move
+//   together, each copy onto the copy across the same edge, so the
+//   seams stay closed and only slide along themselves.
+// - Vertices of open borders and of non-manifold edges do not move.
+// - A collapse turning a triangle by more than 75 degrees is rejected.
+//
+// The error of a level is the distance between the moved vertices and
+// the planes of the triangles they were merged into, in the units of
+// the positions. Projected at the distance of an instance, it gives the
+// screen space error used to pick a level (see selectMeshLod).
+//
+// Usage:
+//      see usage_MeshSimplifier in mesh_simplifier.cpp
+//-----------------------------------------------------------------
+
+namespace vk_test {
+
+    // Collapses edges until the triangles fit in `target_index_count`, or until the next collapse is over `target_error`.
+    // Returns the new indices, on the same vertices, and their error in `result_error`.
+    std::vector<uint32_t> simplifyMesh(std::span<const uint32_t>  indices,
+                                       std::span<const glm::vec3> positions,
+                                       size_t                     target_index_count,
+                                       float                      target_error = std::numeric_limits<float>::max(),
+                                       float*                     result_error = nullptr);
+
+    struct MeshLod {
+        std::vector<uint32_t> indices; // Reordered for the vertex cache
+        float                 error = 0.0F;
+    };
+
+    // Levels after the full resolution one, each with about `ratio` of the triangles of the previous one.
+    // A level is simplified from the previous one, its error is the sum of the errors down the chain.
+    // The chain stops early when a level would remove less than a tenth of the triangles.
+    std::vector<MeshLod> buildMeshLods(std::span<const uint32_t> indices, std::span<const glm::vec3> positions, uint32_t max_levels, float ratio = 0.4F);
+
+} // namespace vk_test
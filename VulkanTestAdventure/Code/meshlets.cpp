@@ -0,0 +1,139 @@
+#include "pch.h"
+#include "meshlets.hpp"
+
+namespace {
+    // Normals spreading more than this (cosine of the angle to the axis) are not culled
+    constexpr float MESHLET_CONE_MIN_DOT = 0.1F;
+
+    void computeMeshletBounds(shaderio::GltfMeshlet& meshlet, const vk_test::MeshletData& data, std::span<const glm::vec3> positions) {
+        const std::span<const uint32_t> vertices(data.vertices.data() + meshlet.vertexOffset, meshlet.vertexCount);
+        const std::span<const uint32_t> triangles(data.triangles.data() + meshlet.triangleOffset, meshlet.triangleCount);
+
+        // Sphere around the center of the box, not the smallest but close for the small clusters of a meshlet
+        glm::vec3 min(std::numeric_limits<float>::max());
+        glm::vec3 max(-std::numeric_limits<float>::max());
+        for (uint32_t v : vertices) {
+            min = glm::min(min, positions[v]);
+            max = glm::max(max, positions[v]);
+        }
+        meshlet.center = (min + max) * 0.5F;
+        meshlet.radius = 0.0F;
+        for (uint32_t v : vertices) {
+            meshlet.radius = std::max(meshlet.radius, glm::length(positions[v] - meshlet.center));
+        }
+
+        // Normal cone, degenerate triangles face nowhere
+        std::array<glm::vec3, MESHLET_MAX_TRIANGLES> normals{};
+        uint32_t                                     normal_count = 0;
+        glm::vec3                                    axis(0.0F);
+        for (uint32_t triangle : triangles) {
+            const glm::vec3& a      = positions[vertices[triangle & 0xFF]];
+            const glm::vec3& b      = positions[vertices[(triangle >> 8) & 0xFF]];
+            const glm::vec3& c      = positions[vertices[(triangle >> 16) & 0xFF]];
+            const glm::vec3  normal = glm::cross(b - a, c - a);
+            const float      length = glm::length(normal);
+            if (length > 0.0F && normal_count < normals.size()) {
+                normals[normal_count] = normal / length;
+                axis += normals[normal_count];
+                normal_count++;
+            }
+        }
+
+        const float axis_length = glm::length(axis);
+        meshlet.coneAxis        = axis_length > 0.0F ? axis / axis_length : glm::vec3(0.0F, 0.0F, 1.0F);
+        meshlet.coneCutoff      = 1.0F;
+        if (axis_length > 0.0F) {
+            float min_dot = 1.0F;
+            for (uint32_t i = 0; i < normal_count; i++) {
+                min_dot = std::min(min_dot, glm::dot(normals[i], meshlet.coneAxis));
+            }
+            if (min_dot > MESHLET_CONE_MIN_DOT) {
+                meshlet.coneCutoff = std::sqrt(1.0F - min_dot * min_dot);
+            }
+        }
+    }
+} // namespace
+
+vk_test::MeshletData vk_test::buildMeshlets(std::span<const uint32_t> indices, std::span<const glm::vec3> positions, uint32_t max_vertices, uint32_t max_triangles) {
+    assert(indices.size() % 3 == 0);
+    assert(max_vertices <= 256 && max_triangles <= MESHLET_MAX_TRIANGLES && "Local indices are 8 bits, the cone is computed on the stack");
+
+    MeshletData data;
+    data.meshlets.reserve(indices.size() / 3 / max_triangles + 1);
+    data.vertices.reserve(indices.size() / 2);
+    data.triangles.reserve(indices.size() / 3);
+
+    // Local index of the vertices in the current meshlet, valid when the stamp is the meshlet's
+    std::vector<uint32_t> local_index(positions.size(), 0);
+    std::vector<uint32_t> stamps(positions.size(), ~0U);
+
+    shaderio::GltfMeshlet meshlet{};
+    auto                  close_meshlet = [&]() {
+        if (meshlet.triangleCount != 0) {
+            data.meshlets.push_back(meshlet);
+        }
+        meshlet                = {};
+        meshlet.vertexOffset   = uint32_t(data.vertices.size());
+        meshlet.triangleOffset = uint32_t(data.triangles.size());
+    };
+
+    for (size_t t = 0; t < indices.size(); t += 3) {
+        const uint32_t stamp     = uint32_t(data.meshlets.size());
+        uint32_t       new_count = 0;
+        for (uint32_t c = 0; c < 3; c++) {
+            const uint32_t v = indices[t + c];
+            new_count += (stamps[v] != stamp && (c < 1 || v != indices[t]) && (c < 2 || v != indices[t + 1])) ? 1 : 0;
+        }
+
+        if (meshlet.vertexCount + new_count > max_vertices || meshlet.triangleCount + 1 > max_triangles) {
+            close_meshlet();
+        }
+
+        const uint32_t current = uint32_t(data.meshlets.size());
+        uint32_t       packed  = 0;
+        for (uint32_t c = 0; c < 3; c++) {
+            const uint32_t v = indices[t + c];
+            if (stamps[v] != current) {
+                stamps[v]      = current;
+                local_index[v] = meshlet.vertexCount++;
+                data.vertices.push_back(v);
+            }
+            packed |= local_index[v] << (c * 8);
+        }
+        data.triangles.push_back(packed);
+        meshlet.triangleCount++;
+    }
+    close_meshlet();
+
+    for (shaderio::GltfMeshlet& m : data.meshlets) {
+        computeMeshletBounds(m, data, positions);
+    }
+    return data;
+}
+
+vk_test::MeshletData vk_test::buildMeshlets(const PrimitiveMesh& mesh) {
+    std::vector<uint32_t> indices;
+    indices.reserve(mesh.triangles.size() * 3);
+    for (const PrimitiveTriangle& triangle : mesh.triangles) {
+        indices.insert(indices.end(), { triangle.indices.x, triangle.indices.y, triangle.indices.z });
+    }
+
+    std::vector<glm::vec3> positions(mesh.vertices.size());
+    for (size_t v = 0; v < positions.size(); v++) {
+        positions[v] = mesh.vertices[v].pos;
+    }
+    return buildMeshlets(indices, positions);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Usage example
+//--------------------------------------------------------------------------------------------------
+[[maybe_unused]] static void usage_Meshlets() {
+    // The triangle order decides what ends up in the same meshlet
+    const vk_test::PrimitiveMesh mesh = vk_test::optimizeMesh(vk_test::createSphereMesh(0.5F, 5));
+
+    const vk_test::MeshletData data = vk_test::buildMeshlets(mesh);
+    VK_TEST_SAY(data.meshlets.size() << " meshlets for " << mesh.triangles.size() << " triangles");
+
+    // Uploaded next to the mesh, see GltfMesh::meshlets, meshletVertices and meshletTriangles
+}
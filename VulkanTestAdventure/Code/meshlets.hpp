@@ -0,0 +1,42 @@
+#pragma once
+
+#include "io_gltf.h"
+#include "primitives.hpp"
+
+//-----------------------------------------------------------------
+// Splits an indexed triangle list in meshlets, for the mesh shader
+// raster path (see meshlets.slang).
+//
+// The triangles are taken in the order of the index buffer, a meshlet
+// is closed when the next triangle would go over MESHLET_MAX_VERTICES
+// or MESHLET_MAX_TRIANGLES. The order should be made cache friendly
+// first (optimizeVertexCache), so that neighbor triangles end up in the
+// same meshlet.
+//
+// Each meshlet gets its bounds, to be culled by the task shader:
+// - a bounding sphere, for the frustum
+// - a normal cone, for the back faces, the way of meshoptimizer: the
+//   meshlet is skipped when the eye is behind all its triangles. The
+//   cone is disabled (coneCutoff of 1) when the normals spread over
+//   more than about 84 degrees from their average.
+//
+// Usage:
+//      see usage_Meshlets in meshlets.cpp
+//-----------------------------------------------------------------
+
+namespace vk_test {
+
+    struct MeshletData {
+        std::vector<shaderio::GltfMeshlet> meshlets;
+        std::vector<uint32_t>              vertices;  // Vertex of the mesh, from `vertexOffset` of each meshlet
+        std::vector<uint32_t>              triangles; // 3 vertices of the meshlet in the low 24 bits, from `triangleOffset` of each meshlet
+    };
+
+    MeshletData buildMeshlets(std::span<const uint32_t>  indices,
+                              std::span<const glm::vec3> positions,
+                              uint32_t                   max_vertices  = MESHLET_MAX_VERTICES,
+                              uint32_t                   max_triangles = MESHLET_MAX_TRIANGLES);
+
+    MeshletData buildMeshlets(const PrimitiveMesh& mesh);
+
+} // namespace vk_test
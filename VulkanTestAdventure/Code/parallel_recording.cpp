@@ -0,0 +1,196 @@
+#include "pch.h"
+#include "parallel_recording.hpp"
+
+#include <Application.hpp>
+
+VkResult vk_test::ParallelCommandRecorder::init(VkDevice device, VkPhysicalDevice physical_device, uint32_t queue_family_index, uint32_t frame_cycle_size, uint32_t thread_count) {
+    assert(!m_Device);
+    m_Device     = device;
+    m_FrameIndex = ~0U;
+    m_ThreadCmds.assign(std::max(1U, thread_count), VK_NULL_HANDLE);
+
+    VkPhysicalDeviceFeatures features{};
+    vkGetPhysicalDeviceFeatures(physical_device, &features);
+    m_CanInheritQueries = features.inheritedQueries == VK_TRUE;
+
+    m_StopRequested = false;
+    m_JobGeneration = 0;
+    for (uint32_t thread_index = 1; thread_index < uint32_t(m_ThreadCmds.size()); thread_index++) {
+        m_Workers.emplace_back(&ParallelCommandRecorder::workerThread, this, thread_index);
+    }
+
+    // Transient, the whole pool of a frame is reset at once
+    const VkCommandPoolCreateInfo command_pool_create_info{
+        .sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+        .flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+        .queueFamilyIndex = queue_family_index,
+    };
+
+    m_FramePools.resize(frame_cycle_size);
+    for (std::vector<ThreadPool>& thread_pools : m_FramePools) {
+        thread_pools.resize(m_ThreadCmds.size());
+        for (ThreadPool& thread_pool : thread_pools) {
+            VkResult result = vkCreateCommandPool(m_Device, &command_pool_create_info, nullptr, &thread_pool.command_pool);
+            if (result != VK_SUCCESS) {
+                return result;
+            }
+        }
+    }
+    return VK_SUCCESS;
+}
+
+void vk_test::ParallelCommandRecorder::deinit() {
+    if (m_Device == VK_NULL_HANDLE) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_JobMutex);
+        m_StopRequested = true;
+    }
+    m_JobStarted.notify_all();
+    for (std::thread& worker : m_Workers) {
+        worker.join();
+    }
+    m_Workers.clear();
+
+    for (std::vector<ThreadPool>& thread_pools : m_FramePools) {
+        for (ThreadPool& thread_pool : thread_pools) {
+            vkDestroyCommandPool(m_Device, thread_pool.command_pool, nullptr); // Frees the command buffers
+        }
+    }
+    m_FramePools.clear();
+    m_ThreadCmds.clear();
+    m_Device = VK_NULL_HANDLE;
+}
+
+void vk_test::ParallelCommandRecorder::beginFrame(uint32_t frame_index) {
+    m_FrameIndex     = frame_index;
+    m_SecondaryCount = 0;
+
+    for (ThreadPool& thread_pool : m_FramePools[frame_index]) {
+        if (thread_pool.used_count != 0) {
+            vkResetCommandPool(m_Device, thread_pool.command_pool, 0);
+            thread_pool.used_count = 0;
+        }
+    }
+}
+
+VkCommandBuffer vk_test::ParallelCommandRecorder::beginSecondary(uint32_t                                       thread_index,
+                                                                 const VkCommandBufferInheritanceRenderingInfo* rendering,
+                                                                 VkQueryPipelineStatisticFlags                  pipeline_statistics) {
+    ThreadPool& thread_pool = m_FramePools[m_FrameIndex][thread_index];
+
+    if (thread_pool.used_count == thread_pool.command_buffers.size()) {
+        const VkCommandBufferAllocateInfo alloc_info{
+            .sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+            .commandPool        = thread_pool.command_pool,
+            .level              = VK_COMMAND_BUFFER_LEVEL_SECONDARY,
+            .commandBufferCount = 1,
+        };
+        vkAllocateCommandBuffers(m_Device, &alloc_info, &thread_pool.command_buffers.emplace_back());
+    }
+    VkCommandBuffer cmd = thread_pool.command_buffers[thread_pool.used_count++];
+
+    const VkCommandBufferInheritanceInfo inheritance_info{
+        .sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+        .pNext              = rendering,
+        .pipelineStatistics = pipeline_statistics,
+    };
+    const VkCommandBufferBeginInfo begin_info{
+        .sType            = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        .flags            = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | (rendering != nullptr ? VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT : 0),
+        .pInheritanceInfo = &inheritance_info,
+    };
+    vkBeginCommandBuffer(cmd, &begin_info);
+    return cmd;
+}
+
+void vk_test::ParallelCommandRecorder::cmdExecuteSecondaries(VkCommandBuffer cmd) {
+    // Only the threads that got items have a secondary
+    uint32_t count = 0;
+    for (VkCommandBuffer thread_cmd : m_ThreadCmds) {
+        if (thread_cmd != VK_NULL_HANDLE) {
+            vkEndCommandBuffer(thread_cmd);
+            m_ThreadCmds[count++] = thread_cmd;
+        }
+    }
+    if (count != 0) {
+        vkCmdExecuteCommands(cmd, count, m_ThreadCmds.data());
+    }
+    m_SecondaryCount += count;
+}
+
+void vk_test::ParallelCommandRecorder::runJob(JobFunction function, void* context) {
+    {
+        std::lock_guard<std::mutex> lock(m_JobMutex);
+        m_JobFunction    = function;
+        m_JobContext     = context;
+        m_RunningWorkers = uint32_t(m_Workers.size());
+        m_JobGeneration++;
+    }
+    m_JobStarted.notify_all();
+
+    function(context, 0);
+
+    std::unique_lock<std::mutex> lock(m_JobMutex);
+    m_JobDone.wait(lock, [this] { return m_RunningWorkers == 0; });
+}
+
+void vk_test::ParallelCommandRecorder::workerThread(uint32_t thread_index) {
+    uint64_t generation = 0;
+
+    std::unique_lock<std::mutex> lock(m_JobMutex);
+    while (true) {
+        m_JobStarted.wait(lock, [&] { return m_StopRequested || m_JobGeneration != generation; });
+        if (m_StopRequested) {
+            return;
+        }
+        generation = m_JobGeneration;
+
+        lock.unlock();
+        m_JobFunction(m_JobContext, thread_index);
+        lock.lock();
+
+        if (--m_RunningWorkers == 0) {
+            m_JobDone.notify_one();
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+// Usage example
+//--------------------------------------------------------------------------------------------------
+[[maybe_unused]] static void usage_ParallelCommandRecorder() {
+    vk_test::Application* app{}; // The application, owning the recorder
+    VkCommandBuffer       cmd{}; // Frame command buffer, given to IAppElement::onRender
+    VkRenderingInfo       rendering_info{};
+    VkFormat              color_format{};
+    VkFormat              depth_format{};
+    uint32_t              draw_count = 100000;
+
+    vk_test::ParallelCommandRecorder& recorder = app->getParallelRecorder();
+
+    // The draws can only be executed from secondaries in this rendering
+    rendering_info.flags = VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT;
+    vkCmdBeginRendering(cmd, &rendering_info);
+
+    const VkCommandBufferInheritanceRenderingInfo inheritance{
+        .sType                   = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO,
+        .colorAttachmentCount    = 1,
+        .pColorAttachmentFormats = &color_format,
+        .depthAttachmentFormat   = depth_format,
+        .rasterizationSamples    = VK_SAMPLE_COUNT_1_BIT,
+    };
+    recorder.cmdExecuteParallel(
+        cmd,
+        &inheritance,
+        app->getGpuProfiler().getActiveStatistics(), // The draws are counted by the enclosing profiler section
+        draw_count,
+        [&](VkCommandBuffer draw_cmd) {
+            // Shaders, descriptor sets, push constants, dynamic states, ...
+        },
+        [&](VkCommandBuffer draw_cmd, uint64_t draw_index) { vkCmdDraw(draw_cmd, 3, 1, 0, uint32_t(draw_index)); });
+
+    vkCmdEndRendering(cmd);
+}
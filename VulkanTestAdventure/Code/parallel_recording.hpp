@@ -0,0 +1,144 @@
+#pragma once
+
+#include "parallel_work.hpp"
+
+//-----------------------------------------------------------------
+// ParallelCommandRecorder records long command loops (ex. one draw per
+// instance) on several threads, into secondary command buffers that
+// are then executed by the frame command buffer.
+//
+// Each frame in flight has one command pool per thread, reset as a
+// whole by beginFrame() once the frame slot is free again, so threads
+// never share a pool. The Application owns one (getParallelRecorder())
+// and calls beginFrame() itself.
+//
+// Inside dynamic rendering, the primary must begin rendering with
+// VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT, and the
+// secondaries inherit the attachment formats through
+// VkCommandBufferInheritanceRenderingInfo. No state is inherited:
+// `set_state` is called at the start of every secondary to bind the
+// shaders, descriptor sets, push constants and dynamic states.
+//
+// Items are fetched in batches by the threads, so their order across
+// secondaries is not kept, which suits depth tested opaque draws.
+// The worker threads are started once by init() and sleep between the
+// calls, the calling thread records as the thread 0.
+//
+// Secondaries executed while a pipeline statistics query is active
+// must inherit its flags, which needs the inheritedQueries feature
+// (see canInheritQueries() and GpuProfiler::getActiveStatistics()).
+//
+// Usage:
+//      see usage_ParallelCommandRecorder in parallel_recording.cpp
+//-----------------------------------------------------------------
+
+namespace vk_test {
+
+    class ParallelCommandRecorder {
+    public:
+        ParallelCommandRecorder()                                          = default;
+        ParallelCommandRecorder(const ParallelCommandRecorder&)            = delete;
+        ParallelCommandRecorder& operator=(const ParallelCommandRecorder&) = delete;
+        ~ParallelCommandRecorder() { assert(m_Device == VK_NULL_HANDLE && "Missing deinit()"); }
+
+        VkResult init(VkDevice device, VkPhysicalDevice physical_device, uint32_t queue_family_index, uint32_t frame_cycle_size, uint32_t thread_count = getThreadPoolSize());
+
+        // the device must be idle
+        void deinit();
+
+        // Resets the command pools of `frame_index`, its previous submit must have completed
+        void beginFrame(uint32_t frame_index);
+
+        // Records `num_items` on the worker threads, `record_item(VkCommandBuffer, uint64_t item_index)`,
+        // and executes the secondaries in `cmd`. `rendering` is null outside of dynamic rendering.
+        // `pipeline_statistics` are the flags of the statistics query active in `cmd`, if any.
+        template <uint64_t BATCHSIZE = 256, typename FSetState, typename FRecordItem>
+        void cmdExecuteParallel(VkCommandBuffer                                cmd,
+                                const VkCommandBufferInheritanceRenderingInfo* rendering,
+                                VkQueryPipelineStatisticFlags                  pipeline_statistics,
+                                uint64_t                                       num_items,
+                                FSetState&&                                    set_state,
+                                FRecordItem&&                                  record_item) {
+            assert(m_FrameIndex != ~0U && "Missing beginFrame()");
+            assert((pipeline_statistics == 0 || m_CanInheritQueries) && "The inheritedQueries feature is not supported");
+            std::fill(m_ThreadCmds.begin(), m_ThreadCmds.end(), VkCommandBuffer(VK_NULL_HANDLE));
+
+            std::atomic_uint64_t counter = 0;
+
+            auto worker = [&](uint32_t thread_index) {
+                uint64_t idx = 0;
+                while ((idx = counter.fetch_add(BATCHSIZE)) < num_items) {
+                    VkCommandBuffer& thread_cmd = m_ThreadCmds[thread_index];
+                    if (thread_cmd == VK_NULL_HANDLE) {
+                        thread_cmd = beginSecondary(thread_index, rendering, pipeline_statistics);
+                        set_state(thread_cmd);
+                    }
+
+                    const uint64_t last = std::min(num_items, idx + BATCHSIZE);
+                    for (uint64_t i = idx; i < last; i++) {
+                        record_item(thread_cmd, i);
+                    }
+                }
+            };
+
+            // A single batch is not worth waking the workers
+            if (num_items <= BATCHSIZE || m_Workers.empty()) {
+                worker(0);
+            }
+            else {
+                runOnAllThreads(worker);
+            }
+
+            cmdExecuteSecondaries(cmd);
+        }
+
+        uint32_t getThreadCount() const { return uint32_t(m_ThreadCmds.size()); }
+
+        // The secondaries can be executed while a query is active (VkPhysicalDeviceFeatures::inheritedQueries)
+        bool canInheritQueries() const { return m_CanInheritQueries; }
+
+        // Secondaries recorded since the last beginFrame()
+        uint32_t getSecondaryCount() const { return m_SecondaryCount; }
+
+    private:
+        struct ThreadPool {
+            VkCommandPool                command_pool{};
+            std::vector<VkCommandBuffer> command_buffers; // Allocated once, reused after the pool reset
+            uint32_t                     used_count = 0;
+        };
+
+        using JobFunction = void (*)(void* context, uint32_t thread_index);
+
+        // Called on the worker `thread_index` only
+        VkCommandBuffer beginSecondary(uint32_t thread_index, const VkCommandBufferInheritanceRenderingInfo* rendering, VkQueryPipelineStatisticFlags pipeline_statistics);
+        void            cmdExecuteSecondaries(VkCommandBuffer cmd);
+
+        // Runs `fn(uint32_t thread_index)` once on each thread, the calling one included, and waits for all
+        template <typename F>
+        void runOnAllThreads(F& fn) {
+            runJob([](void* context, uint32_t thread_index) { (*static_cast<F*>(context))(thread_index); }, &fn);
+        }
+        void runJob(JobFunction function, void* context);
+        void workerThread(uint32_t thread_index);
+
+        VkDevice m_Device{};
+        uint32_t m_FrameIndex        = ~0U;
+        uint32_t m_SecondaryCount    = 0;
+        bool     m_CanInheritQueries = false;
+
+        std::vector<std::vector<ThreadPool>> m_FramePools; // [frame][thread]
+        std::vector<VkCommandBuffer>         m_ThreadCmds; // Secondary being recorded by each thread
+
+        // Threads 1 to thread count - 1, waiting for the next job
+        std::vector<std::thread> m_Workers;
+        std::mutex               m_JobMutex;
+        std::condition_variable  m_JobStarted;
+        std::condition_variable  m_JobDone;
+        JobFunction              m_JobFunction{};
+        void*                    m_JobContext{};
+        uint64_t                 m_JobGeneration  = 0; // Incremented by each job, the workers run it once
+        uint32_t                 m_RunningWorkers = 0;
+        bool                     m_StopRequested  = false;
+    };
+
+} // namespace vk_test
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+* Modified by Farrakh
+* 2025
+*/
+
+#pragma once
+
+namespace vk_test {
+
+    // Returns the number of worker threads to use by default, never 0
+    inline uint32_t getThreadPoolSize() {
+        return std::max(1U, std::thread::hardware_concurrency());
+    }
+
+    //-----------------------------------------------------------------------------
+    // Distributes `num_items` across `num_threads` workers in batches of `BATCHSIZE`.
+    // Each worker fetches the next batch from a shared atomic counter, so uneven
+    // per-item costs are balanced automatically.
+    // `fn(uint64_t item_index)` must be thread safe for distinct indices.
+    // Falls back to a serial loop when there is not enough work to split.
+    //
+    // Usage:
+    //      parallel_batches<64>(meshes.size(), [&](uint64_t i) { process(meshes[i]); });
+    //-----------------------------------------------------------------------------
+    template <uint64_t BATCHSIZE = 128, typename F>
+    inline void parallel_batches(uint64_t num_items, F&& fn, uint32_t num_threads = getThreadPoolSize()) {
+        if (num_threads <= 1 || num_items < num_threads || num_items < BATCHSIZE) {
+            for (uint64_t idx = 0; idx < num_items; idx++) {
+                fn(idx);
+            }
+            return;
+        }
+
+        std::atomic_uint64_t counter = 0;
+
+        auto worker = [&]() {
+            uint64_t idx = 0;
+            while ((idx = counter.fetch_add(BATCHSIZE)) < num_items) {
+                const uint64_t last = std::min(num_items, idx + BATCHSIZE);
+                for (uint64_t i = idx; i < last; i++) {
+                    fn(i);
+                }
+            }
+        };
+
+        std::vector<std::thread> threads(num_threads);
+        for (uint32_t i = 0; i < num_threads; i++) {
+            threads[i] = std::thread(worker);
+        }
+        for (uint32_t i = 0; i < num_threads; i++) {
+            threads[i].join();
+        }
+    }
+
+    // Same as above, but `fn(uint64_t item_index, uint32_t thread_index)` also receives
+    // the worker index, which allows using per-thread scratch data without locking.
+    template <uint64_t BATCHSIZE = 128, typename F>
+    inline void parallel_batches_indexed(uint64_t num_items, F&& fn, uint32_t num_threads = getThreadPoolSize()) {
+        if (num_threads <= 1 || num_items < num_threads || num_items < BATCHSIZE) {
+            for (uint64_t idx = 0; idx < num_items; idx++) {
+                fn(idx, 0U);
+            }
+            return;
+        }
+
+        std::atomic_uint64_t counter = 0;
+
+        auto worker = [&](uint32_t thread_index) {
+            uint64_t idx = 0;
+            while ((idx = counter.fetch_add(BATCHSIZE)) < num_items) {
+                const uint64_t last = std::min(num_items, idx + BATCHSIZE);
+                for (uint64_t i = idx; i < last; i++) {
+                    fn(i, thread_index);
+                }
+            }
+        };
+
+        std::vector<std::thread> threads(num_threads);
+        for (uint32_t i = 0; i < num_threads; i++) {
+            threads[i] = std::thread(worker, i);
+        }
+        for (uint32_t i = 0; i < num_threads; i++) {
+            threads[i].join();
+        }
+    }
+
+} // namespace vk_test
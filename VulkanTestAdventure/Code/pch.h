@@ -4,6 +4,7 @@
 #include <iostream>
 #include <stdexcept>
 #include <vector>
+#include <deque>
 #include <cstring>
 #include <cstdlib>
 #include <map>
@@ -15,6 +16,7 @@
 #include <filesystem>
 #include <fstream>
 #include <ranges>
+#include <bit>
 #include <thread>
 #include <streambuf>
 #include <span>
@@ -23,12 +25,14 @@
 #include <tuple>
 #include <memory>
 #include <mutex>
+#include <condition_variable>
 #include <atomic>
 #include <chrono>
 #include <cmath>
 #include <array>
 #include <unordered_set>
 #include <random>
+#include <numeric>
 // NOLINTNEXTLINE(readability-identifier-naming)
 #define _USE_MATH_DEFINES
 #include <math.h>
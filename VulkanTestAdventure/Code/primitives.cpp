@@ -25,7 +25,9 @@
 #include "pch.h"
 #include "primitives.hpp"
 
-#include "hash_operations.hpp"
+#include "parallel_work.hpp"
+#include "batch_transform.hpp"
+#include "vertex_welder.hpp"
 
 namespace vk_test {
     static uint32_t addPos(PrimitiveMesh& mesh, glm::vec3 p) {
@@ -611,35 +613,38 @@ namespace vk_test {
     // Merge all nodes meshes into a single one
     // - nodes: the nodes to merge
     // - meshes: the mesh array that the nodes is referring to
-    vk_test::PrimitiveMesh mergeNodes(const std::vector<vk_test::Node>& nodes, const std::vector<vk_test::PrimitiveMesh> meshes) {
+    // The positions and the normals are moved by the local matrix of their node
+    vk_test::PrimitiveMesh mergeNodes(const std::vector<vk_test::Node>& nodes, const std::vector<vk_test::PrimitiveMesh>& meshes) {
         vk_test::PrimitiveMesh result_mesh;
 
-        // Find how many triangles and vertices the merged mesh will have
-        size_t nb_triangles = 0;
-        size_t nb_vertices  = 0;
-        for (const auto& n : nodes) {
-            nb_triangles += meshes[n.mesh].triangles.size();
-            nb_vertices += meshes[n.mesh].vertices.size();
+        // Where the vertices and triangles of each node start in the merged mesh
+        std::vector<size_t> first_vertex(nodes.size() + 1, 0);
+        std::vector<size_t> first_triangle(nodes.size() + 1, 0);
+        for (size_t i = 0; i < nodes.size(); i++) {
+            first_vertex[i + 1]   = first_vertex[i] + meshes[nodes[i].mesh].vertices.size();
+            first_triangle[i + 1] = first_triangle[i] + meshes[nodes[i].mesh].triangles.size();
         }
-        result_mesh.triangles.reserve(nb_triangles);
-        result_mesh.vertices.reserve(nb_vertices);
-
-        // Merge all nodes meshes into a single one
-        for (const auto& n : nodes) {
-            const glm::mat4 mat = n.localMatrix();
+        result_mesh.vertices.resize(first_vertex.back());
+        result_mesh.triangles.resize(first_triangle.back());
+
+        // Each node writes its own range, the positions and normals are transformed in batches
+        parallel_batches<16>(nodes.size(), [&](uint64_t i) {
+            const vk_test::PrimitiveMesh& mesh = meshes[nodes[i].mesh];
+            if (mesh.vertices.empty()) {
+                return;
+            }
+            const glm::mat4 mat = nodes[i].localMatrix();
 
-            uint32_t                      t_index = static_cast<uint32_t>(result_mesh.vertices.size());
-            const vk_test::PrimitiveMesh& mesh    = meshes[n.mesh];
+            vk_test::PrimitiveVertex* vertices = &result_mesh.vertices[first_vertex[i]];
+            std::copy(mesh.vertices.begin(), mesh.vertices.end(), vertices);
+            transformPoints(mat, &vertices->pos, sizeof(vk_test::PrimitiveVertex), &vertices->pos, sizeof(vk_test::PrimitiveVertex), mesh.vertices.size());
+            transformNormals(mat, &vertices->nrm, sizeof(vk_test::PrimitiveVertex), &vertices->nrm, sizeof(vk_test::PrimitiveVertex), mesh.vertices.size());
 
-            for (auto v : mesh.vertices) {
-                v.pos = glm::vec3(mat * glm::vec4(v.pos, 1));
-                result_mesh.vertices.push_back(v);
+            const glm::uvec3 t_index(static_cast<uint32_t>(first_vertex[i]));
+            for (size_t t = 0; t < mesh.triangles.size(); t++) {
+                result_mesh.triangles[first_triangle[i] + t].indices = mesh.triangles[t].indices + t_index;
             }
-            for (auto t : mesh.triangles) {
-                t.indices += t_index;
-                result_mesh.triangles.push_back(t);
-            }
-        }
+        });
 
         return result_mesh;
     }
@@ -673,56 +678,79 @@ namespace vk_test {
     }
 
     // Takes a 3D mesh as input and returns a new mesh with duplicate vertices removed.
-    // This function iterates through each triangle in the original PrimitiveMesh,
-    // compares its vertices, and creates a new set of unique vertices in uniqueVertices.
-    // We use an unordered_map called vertexIndexMap to keep track of the mapping between
-    // the original vertices and their corresponding indices in the uniqueVertices vector.
-    PrimitiveMesh removeDuplicateVertices(const PrimitiveMesh& mesh, bool test_normal, bool test_uv) {
-        auto hash = [&](const PrimitiveVertex& v) {
-            if (test_normal) {
-                if (test_uv) {
-                    return vk_test::hashVal(v.pos.x, v.pos.y, v.pos.z, v.nrm.x, v.nrm.y, v.nrm.z, v.tex.x, v.tex.y);
-                }
-                return vk_test::hashVal(v.pos.x, v.pos.y, v.pos.z, v.nrm.x, v.nrm.y, v.nrm.z);
-            }
-            if (test_uv) {
-                return vk_test::hashVal(v.pos.x, v.pos.y, v.pos.z, v.tex.x, v.tex.y);
-            }
-            return vk_test::hashVal(v.pos.x, v.pos.y, v.pos.z);
-        };
-        auto equal = [&](const PrimitiveVertex& l, const PrimitiveVertex& r) {
-            return (l.pos == r.pos) && (test_normal ? l.nrm == r.nrm : true) && (test_uv ? l.tex == r.tex : true);
-        };
-        std::unordered_map<PrimitiveVertex, uint32_t, decltype(hash), decltype(equal)> vertex_index_map(0, hash, equal);
-
+    // The vertices are welded by weldVertices (see vertex_welder.hpp), on the position and optionally the
+    // normal and the texture coordinates, snapped to `epsilon` when it is not 0. The unique vertices are
+    // then numbered in the order the triangles use them.
+    PrimitiveMesh removeDuplicateVertices(const PrimitiveMesh& mesh, bool test_normal, bool test_uv, float epsilon) {
+        // Floats of PrimitiveVertex : pos 0-2, nrm 3-5, tex 6-7
+        VertexWeldSettings settings;
+        settings.compareMask = 0x7U | (test_normal ? 0x38U : 0U) | (test_uv ? 0xC0U : 0U);
+        settings.epsilon     = epsilon;
+        settings.threadCount = getThreadPoolSize();
+
+        std::vector<uint32_t> remap(mesh.vertices.size());
+        const uint32_t        weld_count = weldVertices(mesh.vertices.data(), mesh.vertices.size(), sizeof(PrimitiveVertex), remap.data(), settings);
+
+        // Numbered in the order the triangles use them, the vertices no triangle uses are dropped
+        std::vector<uint32_t>          unique_index(weld_count, ~0U);
         std::vector<PrimitiveVertex>   unique_vertices;
-        std::vector<PrimitiveTriangle> unique_triangles;
+        std::vector<PrimitiveTriangle> unique_triangles(mesh.triangles.size());
+        unique_vertices.reserve(weld_count);
 
-        for (const auto& triangle : mesh.triangles) {
-            PrimitiveTriangle unique_triangle = {};
+        for (size_t t = 0; t < mesh.triangles.size(); t++) {
             for (int i = 0; i < 3; i++) {
-                const PrimitiveVertex& vertex = mesh.vertices[triangle.indices[i]];
-
-                // Check if the vertex is already in the uniqueVertices list
-                auto it = vertex_index_map.find(vertex);
-                if (it == vertex_index_map.end()) {
-                    // Vertex not found, add it to uniqueVertices and update the index map
-                    uint32_t new_index       = static_cast<uint32_t>(unique_vertices.size());
-                    vertex_index_map[vertex] = new_index;
-                    unique_vertices.push_back(vertex);
-                    unique_triangle.indices[i] = new_index;
-                }
-                else {
-                    // Vertex found, use its index in uniqueVertices
-                    unique_triangle.indices[i] = it->second;
+                const uint32_t vertex = mesh.triangles[t].indices[i];
+                uint32_t&      index  = unique_index[remap[vertex]];
+                if (index == ~0U) {
+                    index = static_cast<uint32_t>(unique_vertices.size());
+                    unique_vertices.push_back(mesh.vertices[vertex]);
                 }
+                unique_triangles[t].indices[i] = index;
             }
-            unique_triangles.push_back(unique_triangle);
         }
 
-        // nvprintf("Before: %d vertex, %d triangles\n", mesh.vertices.size(), mesh.triangles.size());
-        // nvprintf("After: %d vertex, %d triangles\n", uniqueVertices.size(), uniqueTriangles.size());
-
         return { std::move(unique_vertices), std::move(unique_triangles) };
     }
+
+    // Reorders the triangles for the vertex cache and the overdraw, then the vertices in the order they are used.
+    // See mesh_optimizer.hpp. Call it last, after removeDuplicateVertices, as merging vertices changes the order.
+    PrimitiveMesh optimizeMesh(const PrimitiveMesh& mesh, VertexCacheStats* stats_before, VertexCacheStats* stats_after) {
+        const uint32_t vertex_count = static_cast<uint32_t>(mesh.vertices.size());
+
+        std::vector<uint32_t> indices;
+        indices.reserve(mesh.triangles.size() * 3);
+        for (const auto& triangle : mesh.triangles) {
+            indices.insert(indices.end(), { triangle.indices.x, triangle.indices.y, triangle.indices.z });
+        }
+
+        std::vector<glm::vec3> positions(vertex_count);
+        for (uint32_t v = 0; v < vertex_count; v++) {
+            positions[v] = mesh.vertices[v].pos;
+        }
+
+        if (stats_before != nullptr) {
+            *stats_before = analyzeVertexCache(indices, vertex_count);
+        }
+
+        optimizeVertexCache(indices, vertex_count);
+        optimizeOverdraw(indices, positions);
+
+        std::vector<uint32_t> remap;
+        optimizeVertexFetchRemap(indices, vertex_count, remap);
+
+        if (stats_after != nullptr) {
+            *stats_after = analyzeVertexCache(indices, vertex_count);
+        }
+
+        PrimitiveMesh result;
+        result.vertices.resize(vertex_count);
+        for (uint32_t v = 0; v < vertex_count; v++) {
+            result.vertices[remap[v]] = mesh.vertices[v];
+        }
+        result.triangles.resize(mesh.triangles.size());
+        for (size_t t = 0; t < result.triangles.size(); t++) {
+            result.triangles[t].indices = { indices[t * 3 + 0], indices[t * 3 + 1], indices[t * 3 + 2] };
+        }
+        return result;
+    }
 } // namespace vk_test
@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include "mesh_optimizer.hpp"
+
 /*-------------------------------------------------------------------------------------------------
 # struct `vk_test::PrimitiveMesh`
   - Common primitive type, made of vertices: position, normal and texture coordinates.
@@ -51,6 +53,7 @@ Other utilities
 * mergeNodes
 * removeDuplicateVertices
 * wobblePrimitive
+* optimizeMesh
 
 -------------------------------------------------------------------------------------------------*/
 
@@ -101,8 +104,9 @@ namespace vk_test {
     std::vector<Node> sunflower(int seeds = 3000);
 
     // Utilities
-    PrimitiveMesh mergeNodes(const std::vector<Node>& nodes, std::vector<PrimitiveMesh> meshes);
-    PrimitiveMesh removeDuplicateVertices(const PrimitiveMesh& mesh, bool test_normal = true, bool test_uv = true);
+    PrimitiveMesh mergeNodes(const std::vector<Node>& nodes, const std::vector<PrimitiveMesh>& meshes);
+    PrimitiveMesh removeDuplicateVertices(const PrimitiveMesh& mesh, bool test_normal = true, bool test_uv = true, float epsilon = 0.0F);
     PrimitiveMesh wobblePrimitive(const PrimitiveMesh& mesh, float amplitude = 0.05F);
+    PrimitiveMesh optimizeMesh(const PrimitiveMesh& mesh, VertexCacheStats* stats_before = nullptr, VertexCacheStats* stats_after = nullptr);
 
 } // namespace vk_test
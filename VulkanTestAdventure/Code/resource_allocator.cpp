@@ -532,6 +532,29 @@ VkDeviceMemory vk_test::ResourceAllocator::getDeviceMemory(VmaAllocation allocat
     return allocation_info.deviceMemory;
 }
 
+VkDeviceSize vk_test::ResourceAllocator::getAllocationSize(VmaAllocation allocation) const {
+    VmaAllocationInfo allocation_info;
+    vmaGetAllocationInfo(*this, allocation, &allocation_info);
+    return allocation_info.size;
+}
+
+void vk_test::ResourceAllocator::getDeviceLocalBudget(VkDeviceSize& budget, VkDeviceSize& usage) const {
+    const VkPhysicalDeviceMemoryProperties* memory_properties = nullptr;
+    vmaGetMemoryProperties(m_Allocator, &memory_properties);
+
+    std::array<VmaBudget, VK_MAX_MEMORY_HEAPS> heap_budgets{};
+    vmaGetHeapBudgets(m_Allocator, heap_budgets.data());
+
+    budget = 0;
+    usage  = 0;
+    for (uint32_t heap_index = 0; heap_index < memory_properties->memoryHeapCount; heap_index++) {
+        if ((memory_properties->memoryHeaps[heap_index].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0) {
+            budget += heap_budgets[heap_index].budget;
+            usage += heap_budgets[heap_index].usage;
+        }
+    }
+}
+
 VkResult vk_test::ResourceAllocator::flushBuffer(const vk_test::Buffer& buffer, VkDeviceSize offset /*= 0*/, VkDeviceSize size /*= VK_WHOLE_SIZE*/) {
     assert(buffer.mapping);
     return vmaFlushAllocation(m_Allocator, buffer.allocation, offset, size);
@@ -143,6 +143,13 @@ namespace vk_test {
         // Returns the device memory of the VMA allocation
         VkDeviceMemory getDeviceMemory(VmaAllocation allocation) const;
 
+        // Returns the size of the VMA allocation
+        VkDeviceSize getAllocationSize(VmaAllocation allocation) const;
+
+        // Sums the VMA budgets and usages of the device local heaps.
+        // Without VK_EXT_memory_budget, VMA estimates the budget as 80% of the heap sizes.
+        void getDeviceLocalBudget(VkDeviceSize& budget, VkDeviceSize& usage) const;
+
         //////////////////////////////////////////////////////////////////////////
 
         // Calls `vkFlushMappedMemoryRanges` via VMA for the provided buffer's memory.
@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2023-2025, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2025, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+* Modified by Farrakh
+* 2025
+*/
+
+#include "pch.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <poll.h>          // poll
+#include <sys/inotify.h>   // inotify_init1, inotify_add_watch
+#include <unistd.h>        // read, close
+#endif
+
+#include "shader_hot_reload.hpp"
+#include "Application.hpp"
+#include "timers.hpp"
+
+namespace vk_test {
+
+    // Time to let an editor finish writing all files before compiling
+    static constexpr uint32_t RELOAD_DEBOUNCE_MS = 50;
+    // Upper bound of the worker sleep, also bounds the latency of deinit()
+    static constexpr uint32_t RELOAD_WAIT_MS = 100;
+
+    void ShaderHotReload::addProgram(const std::filesystem::path& filename, BuildCallback&& build) {
+        assert(!m_Thread.joinable() && "Programs must be added before init()");
+        m_Programs.push_back({ .filename = filename, .build = std::move(build) });
+    }
+
+    void ShaderHotReload::init(const std::filesystem::path& watch_directory, ConfigureCallback&& configure) {
+        assert(!m_Thread.joinable());
+
+        m_WatchDirectory = watch_directory;
+        m_Configure      = std::move(configure);
+        m_StopRequested  = false;
+        m_FileTimes      = scanDirectory();
+
+#ifdef _WIN32
+        HANDLE handle = FindFirstChangeNotificationW(m_WatchDirectory.c_str(), TRUE, FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME);
+        m_WatchHandle = (handle == INVALID_HANDLE_VALUE) ? nullptr : handle;
+#elif defined(__linux__)
+        m_WatchDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (m_WatchDescriptor >= 0 && !addWatches(m_WatchDirectory)) {
+            close(m_WatchDescriptor);
+            m_WatchDescriptor = -1;
+            m_WatchedDirectories.clear();
+        }
+#endif
+        if (m_WatchHandle == nullptr && m_WatchDescriptor < 0) {
+            VK_TEST_SAY("Shader hot reload : no file notification for " << m_WatchDirectory.string().c_str() << ", polling instead");
+        }
+
+        m_Thread = std::thread(&ShaderHotReload::workerThread, this);
+    }
+
+    void ShaderHotReload::deinit() {
+        if (!m_Thread.joinable()) {
+            return;
+        }
+
+        m_StopRequested = true;
+        m_Thread.join();
+
+#ifdef _WIN32
+        if (m_WatchHandle) {
+            FindCloseChangeNotification(m_WatchHandle);
+        }
+#elif defined(__linux__)
+        if (m_WatchDescriptor >= 0) {
+            close(m_WatchDescriptor);
+        }
+#endif
+        m_WatchHandle     = nullptr;
+        m_WatchDescriptor = -1;
+        m_WatchedDirectories.clear();
+    }
+
+    uint32_t ShaderHotReload::applyPending() {
+        std::vector<std::function<void()>> pending;
+        {
+            std::lock_guard<std::mutex> lock(m_PendingMutex);
+            if (m_Pending.empty()) {
+                return 0;
+            }
+            pending.swap(m_Pending);
+        }
+
+        for (auto& apply : pending) {
+            apply();
+        }
+        return uint32_t(pending.size());
+    }
+
+    //-----------------------------------------------------------------------------
+    // The worker sleeps on the OS notification, then compares the modification
+    // times of the watched files to filter out events that did not change anything
+    // (e.g. an editor touching a backup file). The compiler is created here so that
+    // the Slang global session lives and dies on this thread.
+    //
+    void ShaderHotReload::workerThread() {
+        SlangCompiler compiler;
+        if (m_Configure) {
+            m_Configure(compiler);
+        }
+
+        while (!m_StopRequested) {
+            if (!waitForChange(RELOAD_WAIT_MS)) {
+                continue;
+            }
+
+            // Coalesce the burst of events produced by a single save
+            std::this_thread::sleep_for(std::chrono::milliseconds(RELOAD_DEBOUNCE_MS));
+            waitForChange(0);
+
+            FileTimes file_times = scanDirectory();
+            if (file_times == m_FileTimes) {
+                continue;
+            }
+            m_FileTimes = std::move(file_times);
+
+            recompilePrograms(compiler);
+        }
+    }
+
+    bool ShaderHotReload::waitForChange(uint32_t timeout_ms) {
+#ifdef _WIN32
+        if (m_WatchHandle) {
+            if (WaitForSingleObject(m_WatchHandle, timeout_ms) != WAIT_OBJECT_0) {
+                return false;
+            }
+            FindNextChangeNotification(m_WatchHandle);
+            return true;
+        }
+#elif defined(__linux__)
+        if (m_WatchDescriptor >= 0) {
+            pollfd poll_fd{ .fd = m_WatchDescriptor, .events = POLLIN, .revents = 0 };
+            if (poll(&poll_fd, 1, int(timeout_ms)) <= 0) {
+                return false;
+            }
+
+            // Drain the events, only the fact that something changed matters,
+            // except for new directories which need a watch of their own
+            alignas(inotify_event) char buffer[4096];
+            bool                        changed = false;
+            ssize_t                     size    = 0;
+            while ((size = read(m_WatchDescriptor, buffer, sizeof(buffer))) > 0) {
+                changed = true;
+                for (ssize_t offset = 0; offset < size;) {
+                    const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                    offset += ssize_t(sizeof(inotify_event) + event->len);
+
+                    if (event->mask & IN_IGNORED) {
+                        m_WatchedDirectories.erase(event->wd);
+                    }
+                    else if ((event->mask & IN_ISDIR) && (event->mask & (IN_CREATE | IN_MOVED_TO)) && event->len > 0) {
+                        auto parent = m_WatchedDirectories.find(event->wd);
+                        if (parent != m_WatchedDirectories.end()) {
+                            addWatches(parent->second / event->name);
+                        }
+                    }
+                }
+            }
+            return changed;
+        }
+#endif
+        // No notification available, poll the modification times at a slower rate
+        if (timeout_ms == 0) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms * 4));
+        return true;
+    }
+
+#ifdef __linux__
+    // inotify is not recursive, every directory of the tree needs its own watch
+    bool ShaderHotReload::addWatches(const std::filesystem::path& directory) {
+        constexpr uint32_t WATCH_MASK = IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE | IN_ONLYDIR;
+
+        int wd = inotify_add_watch(m_WatchDescriptor, directory.c_str(), WATCH_MASK);
+        if (wd < 0) {
+            return false;
+        }
+        m_WatchedDirectories[wd] = directory;
+
+        std::error_code ec;
+        for (auto it = std::filesystem::recursive_directory_iterator(directory, ec); !ec && it != std::filesystem::recursive_directory_iterator();
+             it.increment(ec)) {
+            if (it->is_directory(ec)) {
+                wd = inotify_add_watch(m_WatchDescriptor, it->path().c_str(), WATCH_MASK);
+                if (wd >= 0) {
+                    m_WatchedDirectories[wd] = it->path();
+                }
+            }
+        }
+        return true;
+    }
+#endif
+
+    ShaderHotReload::FileTimes ShaderHotReload::scanDirectory() const {
+        FileTimes       file_times;
+        std::error_code ec;
+        for (auto it = std::filesystem::recursive_directory_iterator(m_WatchDirectory, ec); !ec && it != std::filesystem::recursive_directory_iterator();
+             it.increment(ec)) {
+            if (it->is_regular_file(ec)) {
+                file_times[it->path()] = it->last_write_time(ec);
+            }
+        }
+        return file_times;
+    }
+
+    void ShaderHotReload::recompilePrograms(SlangCompiler& compiler) {
+        for (Program& program : m_Programs) {
+            if (m_StopRequested) {
+                return;
+            }
+
+            SCOPED_TIMER("Shader hot reload");
+
+            std::filesystem::path shader_source = findFile(program.filename, { m_WatchDirectory });
+            if (!compiler.compileFile(shader_source)) {
+                VK_TEST_SAY("Error compiling shaders : " << shader_source.string().c_str() << '\n'
+                                                         << compiler.getLastDiagnosticMessage().c_str());
+                continue;
+            }
+
+            std::span<const uint32_t> spirv(compiler.getSpirv(), compiler.getSpirvSize() / sizeof(uint32_t));
+            std::function<void()>     apply = program.build(spirv);
+            if (!apply) {
+                continue;
+            }
+
+            std::lock_guard<std::mutex> lock(m_PendingMutex);
+            m_Pending.push_back(std::move(apply));
+            m_ReloadCount++;
+        }
+    }
+
+} // namespace vk_test
+
+//--------------------------------------------------------------------------------------------------
+// Usage example
+//--------------------------------------------------------------------------------------------------
+[[maybe_unused]] static void usage_ShaderHotReload() {
+    vk_test::Application*    app = nullptr; // The application
+    VkDevice                 device{};      // The Vulkan device
+    VkShaderEXT              shader{};      // The shader in use by the render thread
+    vk_test::ShaderHotReload hot_reload;
+
+    // Called on the worker thread: create the new object, return the swap
+    hot_reload.addProgram("shader.slang", [&](std::span<const uint32_t> spirv) -> std::function<void()> {
+        VkShaderEXT           new_shader{};
+        VkShaderCreateInfoEXT info{
+            .sType    = VK_STRUCTURE_TYPE_SHADER_CREATE_INFO_EXT,
+            .stage    = VK_SHADER_STAGE_COMPUTE_BIT,
+            .codeType = VK_SHADER_CODE_TYPE_SPIRV_EXT,
+            .codeSize = spirv.size_bytes(),
+            .pCode    = spirv.data(),
+            .pName    = "main",
+        };
+        if (vkCreateShadersEXT(device, 1, &info, nullptr, &new_shader) != VK_SUCCESS) {
+            return {};
+        }
+        // Called on the render thread: swap, and destroy the old one once no frame uses it
+        return [&, new_shader]() {
+            VkShaderEXT old_shader = shader;
+            shader                 = new_shader;
+            app->submitResourceFree([device, old_shader]() { vkDestroyShaderEXT(device, old_shader, nullptr); });
+        };
+    });
+
+    hot_reload.init(PATH.getShadersPath(), [](vk_test::SlangCompiler& compiler) {
+        compiler.addSearchPaths({ PATH.getShadersPath() });
+        compiler.defaultTarget();
+        compiler.defaultOptions();
+    });
+
+    // Each frame, before recording
+    hot_reload.applyPending();
+
+    // On exit
+    hot_reload.deinit();
+    hot_reload.applyPending();
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Slang.hpp"
+
+//-----------------------------------------------------------------
+// ShaderHotReload watches a shader directory and recompiles the
+// registered programs on a background thread when a file changes.
+//
+// The worker owns its own SlangCompiler (and Slang global session),
+// so compilation never touches the compiler used by the render thread.
+// For each successful compilation the `BuildCallback` is invoked on the
+// worker thread with the SPIR-V, it creates the new Vulkan objects and
+// returns a small closure which swaps them in. These closures are run
+// by `applyPending()`, which must be called on the render thread at a
+// frame boundary (e.g. from `onPreRender`).
+//
+// Usage:
+//      see usage_ShaderHotReload in shader_hot_reload.cpp
+//-----------------------------------------------------------------
+
+namespace vk_test {
+
+    class ShaderHotReload {
+    public:
+        // Called on the worker thread, returns the closure applied on the render thread (or empty on failure)
+        using BuildCallback = std::function<std::function<void()>(std::span<const uint32_t> spirv)>;
+        // Called once on the worker thread to set up its compiler (targets, options, search paths)
+        using ConfigureCallback = std::function<void(SlangCompiler& compiler)>;
+
+        ShaderHotReload()                                  = default;
+        ShaderHotReload(const ShaderHotReload&)            = delete;
+        ShaderHotReload& operator=(const ShaderHotReload&) = delete;
+        ~ShaderHotReload() { assert(!m_Thread.joinable() && "Missing deinit()"); }
+
+        // Programs must be added before init()
+        void addProgram(const std::filesystem::path& filename, BuildCallback&& build);
+
+        void init(const std::filesystem::path& watch_directory, ConfigureCallback&& configure);
+
+        // Stops and joins the worker, results that are not applied yet stay pending
+        void deinit();
+
+        // Runs the swap closures produced since the last call, returns the number applied
+        uint32_t applyPending();
+
+        uint32_t getReloadCount() const { return m_ReloadCount; }
+
+    private:
+        using FileTimes = std::map<std::filesystem::path, std::filesystem::file_time_type>;
+
+        void      workerThread();
+        bool      waitForChange(uint32_t timeout_ms);
+        FileTimes scanDirectory() const;
+#ifdef __linux__
+        bool addWatches(const std::filesystem::path& directory);
+#endif
+        void      recompilePrograms(SlangCompiler& compiler);
+
+        struct Program {
+            std::filesystem::path filename;
+            BuildCallback         build;
+        };
+
+        std::filesystem::path m_WatchDirectory;
+        ConfigureCallback     m_Configure;
+        std::vector<Program>  m_Programs;
+
+        std::thread                          m_Thread;
+        std::atomic_bool                     m_StopRequested{ false };
+        std::atomic_uint                     m_ReloadCount{ 0 };
+        FileTimes                            m_FileTimes;              // Only accessed by the worker once started
+        void*                                m_WatchHandle{ nullptr }; // Change notification handle (Windows)
+        int                                  m_WatchDescriptor{ -1 };  // inotify descriptor (Linux)
+        std::map<int, std::filesystem::path> m_WatchedDirectories;     // Directory of each inotify watch, one per subdirectory (Linux)
+
+        std::mutex                         m_PendingMutex;
+        std::vector<std::function<void()>> m_Pending;
+    };
+
+} // namespace vk_test
@@ -34,11 +34,39 @@ enum BindingPoints {
     eTlas,         // Top-level acceleration structure
 };
 
+// Highest resolution (log2) a shader can ask the texture streamer for.
+// The feedback holds log2 + 1, so that 0 stays for the textures that were not sampled.
+#define TEXTURE_FEEDBACK_MAX_LOG2 15
+
+// Mesh shader path (meshlets.slang): each task workgroup culls this many meshlets of an instance
+#define MESHLET_TASK_WORKGROUP_SIZE 32
+#define MESHLET_MESH_WORKGROUP_SIZE 32
+
+// Bits of TutoPushConstant::meshletCulling
+#define MESHLET_CULLING_FRUSTUM (1 << 0)
+#define MESHLET_CULLING_CONE (1 << 1)
+
+// Instance masks of the TLAS. With a shadow level of detail, the shadow rays see
+// their own instances, built from a coarse level of the meshes (see RtBase::setShadowRayLod)
+#define TLAS_MASK_PRIMARY 0x01
+#define TLAS_MASK_SHADOW 0x02
+
+// One task workgroup, the meshlets from `firstMeshlet` of the mesh of the instance
+struct MeshletTaskGroup {
+    uint32_t instanceIndex;
+    uint32_t firstMeshlet;
+};
+
 struct TutoPushConstant {
-    float3x3       normalMatrix;
-    int            instanceIndex;             // Instance index for the current draw call
-    GltfSceneInfo* sceneInfoAddress;          // Address of the scene information buffer
-    float2         metallicRoughnessOverride; // Metallic and roughness override values
+    float4x4*         normalMatrices;            // Per instance normal matrix, indexed by the instance index of the draw
+    GltfSceneInfo*    sceneInfoAddress;          // Address of the scene information buffer
+    float2            metallicRoughnessOverride; // Metallic and roughness override values
+    uint32_t*         textureFeedback;           // Per texture descriptor, resolution (log2) wanted by the shaders, see TextureStreamer
+    MeshletTaskGroup* meshletTaskGroups;         // Mesh shader path, the task workgroups of all the instances
+    uint32_t          meshletTaskGroupOffset;    // First task workgroup of the draw, the draws are split by maxTaskWorkGroupCount
+    uint32_t          meshletCulling;            // MESHLET_CULLING_FRUSTUM | MESHLET_CULLING_CONE
+    float             lodScale;                  // Mesh shader path, level of detail of the instances (see selectMeshLod), 0 for the full resolution
+    uint32_t          _pad;
 };
 
 NAMESPACE_SHADERIO_END()
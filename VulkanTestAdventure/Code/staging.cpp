@@ -67,10 +67,8 @@ namespace vk_test {
         return m_ResourceAllocator;
     }
 
-    VkResult StagingUploader::acquireStagingSpace(BufferRange& staging_space, size_t data_size, const void* data, const SemaphoreState& semaphore_state) {
-        StagingResource staging_resource;
-        staging_resource.semaphore_state = semaphore_state;
-
+    // Host visible buffer the staging space is taken from
+    static VkResult createStagingBuffer(ResourceAllocator& resource_allocator, vk_test::Buffer& buffer, VkDeviceSize size) {
         // VMA_MEMORY_USAGE_AUTO_PREFER_HOST staging memory is meant to not cost additional device memory
         //
         // VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT staging memory is filled sequentially
@@ -95,19 +93,34 @@ namespace vk_test {
         const VkBufferCreateInfo buffer_info{
             .sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
             .pNext       = &buffer_usage_flags2_create_info,
-            .size        = data_size,
+            .size        = size,
             .usage       = 0,
             .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
         };
 
-        // Create a staging buffer
-        m_ResourceAllocator->createBuffer(staging_resource.buffer, buffer_info, alloc_info);
+        VkResult result = resource_allocator.createBuffer(buffer, buffer_info, alloc_info);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
 
-        if (staging_resource.buffer.mapping == nullptr) {
-            m_ResourceAllocator->destroyBuffer(staging_resource.buffer);
+        if (buffer.mapping == nullptr) {
+            resource_allocator.destroyBuffer(buffer);
             return VK_ERROR_MEMORY_MAP_FAILED;
         }
 
+        return VK_SUCCESS;
+    }
+
+    VkResult StagingUploader::acquireStagingSpace(BufferRange& staging_space, size_t data_size, const void* data, const SemaphoreState& semaphore_state) {
+        StagingResource staging_resource;
+        staging_resource.semaphore_state = semaphore_state;
+
+        // Create a staging buffer
+        VkResult result = createStagingBuffer(*m_ResourceAllocator, staging_resource.buffer, data_size);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+
         if (data != nullptr) {
             memcpy(staging_resource.buffer.mapping, data, data_size);
         }
@@ -394,8 +407,30 @@ namespace vk_test {
                                              const void*                     data,
                                              VkImageLayout                   new_layout /*= VK_IMAGE_LAYOUT_UNDEFINED*/,
                                              const SemaphoreState&           semaphore_state /*= {}*/) {
+        void*    upload_mapping = nullptr;
+        VkResult result         = appendImageSubMapping(image, offset, extent, subresource, data_size, upload_mapping, new_layout, semaphore_state);
+        if (result == VK_SUCCESS) {
+            memcpy(upload_mapping, data, data_size);
+        }
+        return result;
+    }
+
+    VkResult StagingUploader::appendImageSubMapping(vk_test::Image&                 image,
+                                                    const VkOffset3D&               offset,
+                                                    const VkExtent3D&               extent,
+                                                    const VkImageSubresourceLayers& subresource,
+                                                    size_t                          data_size,
+                                                    void*&                          upload_mapping,
+                                                    VkImageLayout                   new_layout /*= VK_IMAGE_LAYOUT_UNDEFINED*/,
+                                                    const SemaphoreState&           semaphore_state /*= {}*/) {
+        upload_mapping = nullptr;
+
         BufferRange staging_space;
-        acquireStagingSpace(staging_space, data_size, data, semaphore_state);
+        VkResult    result = acquireStagingSpace(staging_space, data_size, nullptr, semaphore_state);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+        upload_mapping = staging_space.mapping;
 
         bool layout_allows_copy = image.descriptor.imageLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL || image.descriptor.imageLayout == VK_IMAGE_LAYOUT_GENERAL || image.descriptor.imageLayout == VK_IMAGE_LAYOUT_SHARED_PRESENT_KHR;
 
@@ -480,11 +515,13 @@ namespace vk_test {
 
     void StagingUploader::modifyImageBarrier(VkImageMemoryBarrier2& barrier) const {
         if (m_Batch.transfer_only) {
+            // Only the transfer stages exist on a transfer queue, either side can end up empty
+            // (ex. from VK_IMAGE_LAYOUT_UNDEFINED, or to a layout only read by shaders later on)
             barrier.dstAccessMask &= (VK_ACCESS_2_TRANSFER_WRITE_BIT | VK_ACCESS_2_TRANSFER_READ_BIT);
             barrier.srcAccessMask &= (VK_ACCESS_2_TRANSFER_WRITE_BIT | VK_ACCESS_2_TRANSFER_READ_BIT);
             barrier.dstStageMask &= VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
             barrier.srcStageMask &= VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
-            assert(barrier.dstAccessMask && barrier.srcStageMask);
+            assert(barrier.dstStageMask || barrier.srcStageMask);
         }
     }
 
@@ -523,6 +560,191 @@ namespace vk_test {
         m_StagingResources.resize(write_idx);
     }
 
+    //--------------------------------------------------------------------------------------------------
+    // StagingRingUploader
+    //--------------------------------------------------------------------------------------------------
+
+    // Keeps the offsets valid for copies of up to 16 byte texels
+    static constexpr VkDeviceSize RING_ALIGNMENT = 16;
+
+    // How long an allocation waits for the oldest uploads before falling back to a dedicated buffer
+    static constexpr uint64_t RING_STALL_TIMEOUT = 1'000'000'000; // 1 s
+
+    static bool isSameSemaphoreState(const SemaphoreState& a, const SemaphoreState& b) {
+        // dynamic states can't be compared before their submit, they are never merged
+        if (!a.isValid() && !b.isValid()) {
+            return true;
+        }
+        return a.isFixed() && b.isFixed() && a.getSemaphore() == b.getSemaphore() && a.getTimelineValue() == b.getTimelineValue();
+    }
+
+    VkResult StagingRingUploader::init(ResourceAllocator* resource_allocator, bool enable_layout_barriers, VkDeviceSize ring_size) {
+        StagingUploader::init(resource_allocator, enable_layout_barriers);
+
+        ring_size       = (ring_size + RING_ALIGNMENT - 1) & ~(RING_ALIGNMENT - 1);
+        VkResult result = createStagingBuffer(*resource_allocator, m_Ring, ring_size);
+        if (result != VK_SUCCESS) {
+            StagingUploader::deinit();
+            return result;
+        }
+
+        m_RingHead            = 0;
+        m_RingTail            = 0;
+        m_BatchIndex          = 0;
+        m_RingStats           = {};
+        m_RingStats.ring_size = ring_size;
+
+        return VK_SUCCESS;
+    }
+
+    void StagingRingUploader::deinit() {
+        if (m_ResourceAllocator != nullptr) {
+            releaseStaging(true);
+            assert(m_RingRanges.empty() && m_RingStats.used_size == 0);
+            m_ResourceAllocator->destroyBuffer(m_Ring);
+        }
+        StagingUploader::deinit();
+    }
+
+    void StagingRingUploader::resetRingStats() {
+        m_RingStats = { .ring_size = m_RingStats.ring_size, .used_size = m_RingStats.used_size, .high_water = m_RingStats.used_size };
+    }
+
+    bool StagingRingUploader::tryAllocate(VkDeviceSize size, VkDeviceSize& offset, VkDeviceSize& consumed) {
+        const VkDeviceSize ring_size = m_Ring.bufferSize;
+
+        if (m_RingStats.used_size == 0) {
+            // restart from the beginning, avoids wrapping
+            m_RingHead = 0;
+            m_RingTail = 0;
+        }
+        if (m_RingStats.used_size + size > ring_size) {
+            return false;
+        }
+
+        if (m_RingHead >= m_RingTail) {
+            // free space is [head, ring_size) and [0, tail)
+            if (ring_size - m_RingHead >= size) {
+                offset   = m_RingHead;
+                consumed = size;
+            }
+            else if (m_RingTail >= size) {
+                // the end of the ring is skipped, and given back with this allocation
+                offset   = 0;
+                consumed = (ring_size - m_RingHead) + size;
+                m_RingStats.wraps++;
+            }
+            else {
+                return false;
+            }
+        }
+        else {
+            // free space is [head, tail)
+            if (m_RingTail - m_RingHead < size) {
+                return false;
+            }
+            offset   = m_RingHead;
+            consumed = size;
+        }
+
+        m_RingHead = offset + size;
+        m_RingStats.used_size += consumed;
+        m_RingStats.high_water = std::max(m_RingStats.high_water, m_RingStats.used_size);
+
+        return true;
+    }
+
+    bool StagingRingUploader::releaseRanges(bool force_all, bool release_untracked) {
+        VkDevice device   = m_ResourceAllocator->getDevice();
+        bool     released = false;
+
+        // in order, the ring can only give back its oldest allocations
+        while (!m_RingRanges.empty()) {
+            RingRange& range = m_RingRanges.front();
+
+            bool can_release = force_all || (range.semaphore_state.isValid() ? range.semaphore_state.testSignaled(device) : release_untracked);
+            if (!can_release) {
+                break;
+            }
+
+            m_RingTail = range.end;
+            m_RingStats.used_size -= range.size;
+            m_RingRanges.pop_front();
+            released = true;
+        }
+
+        return released;
+    }
+
+    void StagingRingUploader::releaseStaging(bool force_all) {
+        releaseRanges(force_all, true);
+
+        // dedicated buffers of the fallbacks
+        StagingUploader::releaseStaging(force_all);
+    }
+
+    VkResult StagingRingUploader::acquireStagingSpace(BufferRange& staging_space, size_t data_size, const void* data, const SemaphoreState& semaphore_state) {
+        assert(m_Ring.buffer && "Missing init()");
+
+        // first upload since the last `cmdUploadAppended`
+        if (isAppendedEmpty()) {
+            m_BatchIndex++;
+        }
+
+        const VkDeviceSize size = (VkDeviceSize(data_size) + RING_ALIGNMENT - 1) & ~(RING_ALIGNMENT - 1);
+
+        VkDeviceSize offset   = 0;
+        VkDeviceSize consumed = 0;
+        bool         acquired = size <= m_Ring.bufferSize / 2;
+        while (acquired && !tryAllocate(size, offset, consumed)) {
+            // ranges already signaled, then waiting on the oldest one.
+            // The ranges of the batch being appended were not submitted yet,
+            // and untracked ranges are only known complete in `releaseStaging`
+            if (releaseRanges(false, false)) {
+                continue;
+            }
+
+            assert(!m_RingRanges.empty());
+            RingRange& oldest = m_RingRanges.front();
+            if (oldest.batch_index == m_BatchIndex || !oldest.semaphore_state.canWait()) {
+                acquired = false;
+            }
+            else {
+                acquired = oldest.semaphore_state.wait(m_ResourceAllocator->getDevice(), RING_STALL_TIMEOUT) == VK_SUCCESS;
+                m_RingStats.stalls++;
+            }
+        }
+
+        if (!acquired) {
+            m_RingStats.fallbacks++;
+            return StagingUploader::acquireStagingSpace(staging_space, data_size, data, semaphore_state);
+        }
+
+        // extend the last range when it can be released together
+        if (!m_RingRanges.empty() && m_RingRanges.back().batch_index == m_BatchIndex &&
+            isSameSemaphoreState(m_RingRanges.back().semaphore_state, semaphore_state)) {
+            m_RingRanges.back().end = m_RingHead;
+            m_RingRanges.back().size += consumed;
+        }
+        else {
+            m_RingRanges.push_back({ .end = m_RingHead, .size = consumed, .batch_index = m_BatchIndex, .semaphore_state = semaphore_state });
+        }
+
+        if (data != nullptr) {
+            memcpy(m_Ring.mapping + offset, data, data_size);
+        }
+
+        m_RingStats.uploaded_bytes += data_size;
+
+        staging_space.buffer  = m_Ring.buffer;
+        staging_space.offset  = offset;
+        staging_space.range   = data_size;
+        staging_space.address = m_Ring.address + offset;
+        staging_space.mapping = m_Ring.mapping + offset;
+
+        return VK_SUCCESS;
+    }
+
 } // namespace vk_test
 
 //--------------------------------------------------------------------------------------------------
@@ -660,3 +882,40 @@ static void usage_StagingUploader() {
         }
     }
 }
+
+static void usage_StagingRingUploader() {
+    vk_test::ResourceAllocator resource_allocator{};
+
+    // streaming uploads every frame, without creating staging buffers on the way
+    vk_test::StagingRingUploader staging_uploader;
+    staging_uploader.init(&resource_allocator, true, 256 * 1024 * 1024);
+
+    vk_test::Buffer    my_buffer;
+    std::vector<float> my_data;
+
+    // the frames are tracked by a timeline semaphore, signaled with `timeline_value` once the frame completed
+    VkSemaphore timeline_semaphore{};
+    uint64_t    timeline_value = 1;
+
+    // frame loop
+    while (true) {
+        // gives back the ring space of the completed frames
+        staging_uploader.releaseStaging();
+
+        VkCommandBuffer cmd{};
+
+        // same as StagingUploader, the ring is waited for only when full
+        staging_uploader.appendBuffer(my_buffer, 0, std::span(my_data), vk_test::SemaphoreState::makeFixed(timeline_semaphore, timeline_value));
+        staging_uploader.cmdUploadAppended(cmd);
+
+        // submit cmd buffer to queue signaling the timelineValue
+        cmd;
+        timeline_value++;
+
+        // high water mark and stalls tell if the ring is large enough
+        const vk_test::StagingRingUploader::RingStats& stats = staging_uploader.getRingStats();
+        if (stats.stalls != 0 || stats.fallbacks != 0) {
+            // the ring is too small for this amount of streaming
+        }
+    }
+}
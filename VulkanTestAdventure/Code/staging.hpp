@@ -31,8 +31,12 @@
 //-----------------------------------------------------------------
 // StagingUploader is a class that allows to upload data to the GPU.
 //
+// StagingRingUploader is the same, but sub-allocates the staging space
+// from one persistently mapped ring buffer instead of creating a buffer
+// per upload, for streaming.
+//
 // Usage:
-//      see usage_StagingUploader in staging.cpp
+//      see usage_StagingUploader and usage_StagingRingUploader in staging.cpp
 //-----------------------------------------------------------------
 
 namespace vk_test {
@@ -193,6 +197,28 @@ namespace vk_test {
             return appendImageSub(image, offset, extent, subresource, data.size_bytes(), data.data(), new_layout, semaphore_state);
         }
 
+        // same as appendImageSub, but the staging space is returned in `upload_mapping` instead of
+        // being filled from data. It must be written before the command buffer of `cmdUploadAppended`
+        // is submitted, possibly from another thread.
+        // `upload_mapping` is nullptr on failure
+        VkResult appendImageSubMapping(vk_test::Image&                 image,
+                                       const VkOffset3D&               offset,
+                                       const VkExtent3D&               extent,
+                                       const VkImageSubresourceLayers& subresource,
+                                       size_t                          data_size,
+                                       void*&                          upload_mapping,
+                                       VkImageLayout                   new_layout      = VK_IMAGE_LAYOUT_UNDEFINED,
+                                       const SemaphoreState&           semaphore_state = {});
+
+        // mip 0/layer 0 variant
+        VkResult appendImageMapping(vk_test::Image&       image,
+                                    size_t                data_size,
+                                    void*&                upload_mapping,
+                                    VkImageLayout         new_layout      = VK_IMAGE_LAYOUT_UNDEFINED,
+                                    const SemaphoreState& semaphore_state = {}) {
+            return appendImageSubMapping(image, { 0, 0, 0 }, image.extent, { .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT, .layerCount = 1 }, data_size, upload_mapping, new_layout, semaphore_state);
+        }
+
         // returns true if the sum of staging resources used in pending operations
         // and the added size is beyond the limit
         bool checkAppendedSize(size_t limit_in_bytes, size_t added_size = 0) const;
@@ -229,4 +255,71 @@ namespace vk_test {
         Batch                        m_Batch{};
     };
 
+    // The staging space is carved out of a single ring buffer, created once in `init`.
+    //
+    // Every sub-allocation keeps its SemaphoreState, `releaseStaging` frees them
+    // in order once signaled and the ring wraps around. Consecutive uploads of the
+    // same batch with the same fixed SemaphoreState share one entry.
+    //
+    // When the ring is full, the oldest uploads of a previous batch are waited for
+    // (a stall), as long as their timeline value is known. Otherwise, or when a
+    // single upload is larger than half the ring, a dedicated staging buffer is
+    // created like StagingUploader does.
+    //
+    // Uploads without a valid SemaphoreState only go away in `releaseStaging`,
+    // the caller ensures their completion as with StagingUploader.
+    class StagingRingUploader : public StagingUploader {
+    public:
+        static constexpr VkDeviceSize DEFAULT_RING_SIZE = 64 * 1024 * 1024;
+
+        struct RingStats {
+            VkDeviceSize ring_size      = 0;
+            VkDeviceSize used_size      = 0; // Bytes not yet released, including the alignment and wrap padding
+            VkDeviceSize high_water     = 0; // Maximum of `used_size`
+            uint64_t     uploaded_bytes = 0;
+            uint32_t     wraps          = 0;
+            uint32_t     stalls         = 0; // Waits on the GPU because the ring was full
+            uint32_t     fallbacks      = 0; // Uploads that needed a dedicated staging buffer
+        };
+
+        StagingRingUploader() = default;
+        ~StagingRingUploader() override { assert(m_Ring.buffer == VK_NULL_HANDLE && "Missing deinit()"); }
+
+        // explicit lifetime of resourceAllocator must be ensured externally
+        VkResult init(ResourceAllocator* resource_allocator, bool enable_layout_barriers = false, VkDeviceSize ring_size = DEFAULT_RING_SIZE);
+
+        // deinit implicitly calls `releaseStaging(true)`
+        void deinit();
+
+        void releaseStaging(bool force_all = false) override;
+
+        VkResult acquireStagingSpace(BufferRange& staging_space, size_t data_size, const void* data, const SemaphoreState& semaphore_state = {}) override;
+
+        const RingStats& getRingStats() const { return m_RingStats; }
+
+        // restarts the counters, the high water mark starts again from the current usage
+        void resetRingStats();
+
+    private:
+        struct RingRange {
+            VkDeviceSize   end         = 0; // The tail moves here once released
+            VkDeviceSize   size        = 0; // Bytes given back once released
+            uint64_t       batch_index = 0;
+            SemaphoreState semaphore_state;
+        };
+
+        bool tryAllocate(VkDeviceSize size, VkDeviceSize& offset, VkDeviceSize& consumed);
+
+        // releases from the oldest, returns true if anything was released.
+        // `release_untracked` also releases ranges without valid SemaphoreState
+        bool releaseRanges(bool force_all, bool release_untracked);
+
+        vk_test::Buffer       m_Ring;
+        VkDeviceSize          m_RingHead = 0; // Next allocation
+        VkDeviceSize          m_RingTail = 0; // Oldest allocation still in use
+        std::deque<RingRange> m_RingRanges;
+        uint64_t              m_BatchIndex = 0; // Incremented on the first upload after `cmdUploadAppended`
+        RingStats             m_RingStats;
+    };
+
 } // namespace vk_test
@@ -0,0 +1,609 @@
+#include "pch.h"
+#include "texture_streamer.hpp"
+
+#include <utils.hpp>
+#include <default_structs.hpp>
+#include <Application.hpp>
+#include <bindless_textures.hpp>
+
+#include <ktx.h>
+
+static VkExtent3D getLevelExtent(const VkExtent2D& base_extent, uint32_t level) {
+    return { std::max(1U, base_extent.width >> level), std::max(1U, base_extent.height >> level), 1 };
+}
+
+VkResult vk_test::TextureStreamer::init(ResourceAllocator* alloc, StagingUploader* staging, uint32_t frame_cycle_size, uint32_t feedback_size, VkDeviceSize budget) {
+    assert(!m_Alloc);
+    m_Alloc            = alloc;
+    m_Staging          = staging;
+    m_PhysicalDevice   = alloc->getPhysicalDevice();
+    m_FeedbackSize     = feedback_size;
+    m_Budget           = budget;
+    m_UpdateIndex      = 0;
+    m_ResidentBytes    = 0;
+    m_FallbackUploaded = false;
+    m_Stats            = {};
+    m_StopLoading      = false;
+    m_LoaderThread     = std::thread(&TextureStreamer::loaderThread, this);
+
+    // Feedback and its readback slots
+    VkResult result = alloc->createBuffer(m_Feedback,
+                                          feedback_size * sizeof(uint32_t),
+                                          VK_BUFFER_USAGE_2_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_2_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_2_TRANSFER_DST_BIT);
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+    result = alloc->createBuffer(m_FeedbackReadback,
+                                 feedback_size * sizeof(uint32_t) * frame_cycle_size,
+                                 VK_BUFFER_USAGE_2_TRANSFER_DST_BIT,
+                                 VMA_MEMORY_USAGE_AUTO_PREFER_HOST,
+                                 VMA_ALLOCATION_CREATE_MAPPED_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT);
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+    m_ReadbackPending.assign(frame_cycle_size, false);
+
+    // Its content is uploaded by the first update, the descriptors can already point to it
+    VkImageCreateInfo image_info = DEFAULT_VkImageCreateInfo;
+    image_info.format            = VK_FORMAT_R8G8B8A8_UNORM;
+    image_info.usage             = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    result                       = alloc->createImage(m_Fallback, image_info, DEFAULT_VkImageViewCreateInfo);
+    m_Fallback.descriptor.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    return result;
+}
+
+void vk_test::TextureStreamer::deinit() {
+    if (m_Alloc == nullptr) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_LoadMutex);
+        m_StopLoading = true;
+    }
+    m_LoadRequested.notify_one();
+    m_LoaderThread.join();
+    for (const LoadedSource& loaded : m_LoadedSources) {
+        if (loaded.source != nullptr) {
+            ktxTexture_Destroy(ktxTexture(loaded.source));
+        }
+    }
+    m_LoadedSources.clear();
+    m_LoadJobs.clear();
+
+    for (StreamedTexture& texture : m_Textures) {
+        m_Alloc->destroyImage(texture.image);
+        if (texture.source != nullptr) {
+            ktxTexture_Destroy(ktxTexture(texture.source));
+        }
+    }
+    m_Textures.clear();
+    releaseRetired(true);
+
+    m_Alloc->destroyImage(m_Fallback);
+    m_Alloc->destroyBuffer(m_Feedback);
+    m_Alloc->destroyBuffer(m_FeedbackReadback);
+    m_ReadbackPending.clear();
+    m_PreBarriers.clear();
+    m_PostBarriers.clear();
+    m_ImageCopies.clear();
+
+    m_Staging = nullptr;
+    m_Alloc   = nullptr;
+}
+
+uint32_t vk_test::TextureStreamer::addTexture(const std::filesystem::path& filename, VkSampler sampler, uint32_t feedback_index) {
+    assert(feedback_index < m_FeedbackSize);
+
+    StreamedTexture& texture = m_Textures.emplace_back();
+    texture.filename         = filename;
+    texture.sampler          = sampler;
+    texture.feedback_index   = feedback_index;
+    return uint32_t(m_Textures.size() - 1);
+}
+
+VkDescriptorImageInfo vk_test::TextureStreamer::getDescriptorImageInfo(uint32_t texture_id) const {
+    const StreamedTexture& texture = m_Textures[texture_id];
+    const Image&           image   = texture.image.image != VK_NULL_HANDLE ? texture.image : m_Fallback;
+    return {
+        .sampler     = texture.sampler,
+        .imageView   = image.descriptor.imageView,
+        .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+    };
+}
+
+vk_test::TextureStreamer::TextureStats vk_test::TextureStreamer::getTextureStats(uint32_t texture_id) const {
+    const StreamedTexture& texture = m_Textures[texture_id];
+    return {
+        .level_count    = texture.level_count,
+        .resident_level = texture.image.image != VK_NULL_HANDLE ? texture.resident_level : texture.level_count,
+        .wanted_level   = texture.level_count != 0 ? getWantedLevel(texture) : 0,
+        .resident_bytes = texture.resident_bytes,
+        .source_loaded  = texture.source != nullptr,
+    };
+}
+
+void vk_test::TextureStreamer::loaderThread() {
+    std::unique_lock<std::mutex> lock(m_LoadMutex);
+    while (true) {
+        m_LoadRequested.wait(lock, [this] { return m_StopLoading || !m_LoadJobs.empty(); });
+        if (m_StopLoading) {
+            return;
+        }
+        LoadJob job = std::move(m_LoadJobs.front());
+        m_LoadJobs.pop_front();
+
+        // Reading and transcoding the file is the slow part, the render thread can queue more meanwhile
+        lock.unlock();
+        ktxTexture2* source = loadKtxTexture(m_PhysicalDevice, job.filename);
+        lock.lock();
+
+        m_LoadedSources.push_back({ .texture_id = job.texture_id, .source = source });
+    }
+}
+
+void vk_test::TextureStreamer::requestLoad(uint32_t texture_id) {
+    StreamedTexture& texture = m_Textures[texture_id];
+    assert(!texture.loading && texture.source == nullptr);
+    texture.loading = true;
+    {
+        std::lock_guard<std::mutex> lock(m_LoadMutex);
+        m_LoadJobs.push_back({ .texture_id = texture_id, .filename = texture.filename });
+    }
+    m_LoadRequested.notify_one();
+}
+
+void vk_test::TextureStreamer::collectLoaded() {
+    std::vector<LoadedSource> loaded_sources;
+    {
+        std::lock_guard<std::mutex> lock(m_LoadMutex);
+        loaded_sources.swap(m_LoadedSources);
+    }
+    for (const LoadedSource& loaded : loaded_sources) {
+        StreamedTexture& texture = m_Textures[loaded.texture_id];
+        texture.loading          = false;
+        setSource(texture, loaded.source);
+    }
+}
+
+void vk_test::TextureStreamer::setSource(StreamedTexture& texture, ktxTexture2* source) const {
+    texture.source = source;
+    if (texture.source == nullptr) {
+        texture.failed = true; // Already reported, not tried again
+        return;
+    }
+    if (texture.level_count != 0) {
+        return; // Loaded again for levels evicted after the source was released
+    }
+
+    if (source->baseDepth > 1) {
+        VK_TEST_SAY("3D KTX2 textures are not streamed : " << utf8FromPath(texture.filename).c_str());
+        ktxTexture_Destroy(ktxTexture(source));
+        texture.source = nullptr;
+        texture.failed = true;
+        return;
+    }
+
+    // Cube faces are stored as array layers
+    texture.format       = VkFormat(source->vkFormat);
+    texture.create_flags = source->isCubemap ? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT : 0;
+    texture.base_extent  = { source->baseWidth, source->baseHeight };
+    texture.layer_count  = source->numLayers * source->numFaces;
+    texture.level_count  = std::max(1U, source->numLevels);
+    if (source->isCubemap) {
+        texture.view_type = source->isArray ? VK_IMAGE_VIEW_TYPE_CUBE_ARRAY : VK_IMAGE_VIEW_TYPE_CUBE;
+    }
+    else if (source->isArray) {
+        texture.view_type = VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+    }
+
+    texture.level_sizes.resize(texture.level_count);
+    texture.tail_level = texture.level_count - 1;
+    for (uint32_t level = texture.level_count; level-- > 0;) {
+        texture.level_sizes[level] = ktxTexture_GetImageSize(ktxTexture(source), level) * texture.layer_count;
+
+        const VkExtent3D extent = getLevelExtent(texture.base_extent, level);
+        if (std::max(extent.width, extent.height) <= MIP_TAIL_SIZE) {
+            texture.tail_level = level;
+        }
+    }
+}
+
+void vk_test::TextureStreamer::readFeedback(uint32_t frame_index) {
+    if (!m_ReadbackPending[frame_index]) {
+        return;
+    }
+    m_ReadbackPending[frame_index] = false;
+
+    const VkDeviceSize slot_size   = m_FeedbackSize * sizeof(uint32_t);
+    const VkDeviceSize slot_offset = frame_index * slot_size;
+    m_Alloc->autoInvalidateBuffer(m_FeedbackReadback, slot_offset, slot_size);
+
+    const uint32_t* feedback = reinterpret_cast<const uint32_t*>(m_FeedbackReadback.mapping + slot_offset);
+    for (StreamedTexture& texture : m_Textures) {
+        const uint32_t wanted_log2_plus_one = feedback[texture.feedback_index];
+        if (wanted_log2_plus_one != 0) {
+            texture.wanted_log2 = wanted_log2_plus_one - 1;
+            texture.last_seen   = m_UpdateIndex;
+        }
+    }
+}
+
+uint32_t vk_test::TextureStreamer::getWantedLevel(const StreamedTexture& texture) const {
+    if (texture.wanted_log2 == UNSEEN_LOG2) {
+        return texture.tail_level;
+    }
+
+    // The level whose largest dimension is the wanted resolution
+    const uint32_t base_log2 = uint32_t(std::bit_width(std::max(texture.base_extent.width, texture.base_extent.height))) - 1;
+    const uint32_t level     = texture.wanted_log2 < base_log2 ? base_log2 - texture.wanted_log2 : 0;
+    return std::min(level, texture.tail_level);
+}
+
+VkDeviceSize vk_test::TextureStreamer::getEffectiveBudget() const {
+    VkDeviceSize heap_budget = 0;
+    VkDeviceSize heap_usage  = 0;
+    m_Alloc->getDeviceLocalBudget(heap_budget, heap_usage);
+
+    // The textures can have what they use plus what is left
+    const VkDeviceSize other_usage = heap_usage > m_ResidentBytes ? heap_usage - m_ResidentBytes : 0;
+    const VkDeviceSize available   = heap_budget > other_usage ? heap_budget - other_usage : 0;
+    return m_Budget != 0 ? std::min(m_Budget, available) : available;
+}
+
+bool vk_test::TextureStreamer::changeResidency(StreamedTexture& texture, uint32_t new_level, const SemaphoreState& frame_state) {
+    const bool     has_image = texture.image.image != VK_NULL_HANDLE;
+    const uint32_t old_level = has_image ? texture.resident_level : texture.level_count;
+    assert(new_level != old_level);
+    assert((new_level > old_level || texture.source != nullptr) && "Finer levels come from the file");
+
+    VkImageCreateInfo image_info = DEFAULT_VkImageCreateInfo;
+    image_info.flags             = texture.create_flags;
+    image_info.format            = texture.format;
+    image_info.usage             = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    image_info.extent            = getLevelExtent(texture.base_extent, new_level);
+    image_info.mipLevels         = texture.level_count - new_level;
+    image_info.arrayLayers       = texture.layer_count;
+
+    VkImageViewCreateInfo view_info = DEFAULT_VkImageViewCreateInfo;
+    view_info.viewType              = texture.view_type;
+
+    Image image;
+    if (m_Alloc->createImage(image, image_info, view_info) != VK_SUCCESS) {
+        return false;
+    }
+    image.descriptor.sampler = texture.sampler;
+
+    // Already in TRANSFER_DST_OPTIMAL for the staging uploader, which then adds no barrier
+    m_PreBarriers.imageBarriers.push_back(makeImageMemoryBarrier({ .image = image.image, .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED, .newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL }));
+    image.descriptor.imageLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+
+    // Levels kept from the previous image
+    if (has_image) {
+        m_PreBarriers.imageBarriers.push_back(makeImageMemoryBarrier({
+            .image         = texture.image.image,
+            .oldLayout     = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+            .newLayout     = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            .srcStageMask  = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, // Sampled by the previous frames in any stage
+            .srcAccessMask = VK_ACCESS_2_NONE,
+        }));
+
+        ImageCopy& image_copy = m_ImageCopies.emplace_back();
+        image_copy.src_image  = texture.image.image;
+        image_copy.dst_image  = image.image;
+        for (uint32_t level = std::max(new_level, old_level); level < texture.level_count; level++) {
+            image_copy.regions.push_back({
+                .srcSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, level - old_level, 0, texture.layer_count },
+                .srcOffset      = { 0, 0, 0 },
+                .dstSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, level - new_level, 0, texture.layer_count },
+                .dstOffset      = { 0, 0, 0 },
+                .extent         = getLevelExtent(texture.base_extent, level),
+            });
+        }
+
+        m_RetiredImages.push_back({ .image = texture.image, .semaphore_state = frame_state });
+        m_ResidentBytes -= texture.resident_bytes;
+    }
+
+    // Levels coming from the file, one copy per layer and face
+    for (uint32_t level = new_level; level < old_level; level++) {
+        ktxTexture*        source     = ktxTexture(texture.source);
+        const ktx_uint8_t* data       = ktxTexture_GetData(source);
+        const size_t       image_size = ktxTexture_GetImageSize(source, level);
+        const VkExtent3D   extent     = getLevelExtent(texture.base_extent, level);
+
+        for (uint32_t layer = 0; layer < source->numLayers; layer++) {
+            for (uint32_t face = 0; face < source->numFaces; face++) {
+                ktx_size_t offset = 0;
+                ktxTexture_GetImageOffset(source, level, layer, face, &offset);
+
+                const VkImageSubresourceLayers subresource{
+                    .aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT,
+                    .mipLevel       = level - new_level,
+                    .baseArrayLayer = layer * source->numFaces + face,
+                    .layerCount     = 1,
+                };
+                m_Staging->appendImageSub(image, { 0, 0, 0 }, extent, subresource, image_size, data + offset, VK_IMAGE_LAYOUT_UNDEFINED, frame_state);
+            }
+        }
+        m_Stats.uploaded_bytes += texture.level_sizes[level];
+    }
+
+    m_PostBarriers.imageBarriers.push_back(makeImageMemoryBarrier({
+        .image         = image.image,
+        .oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        .newLayout     = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+        .dstStageMask  = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, // Sampled in any stage
+        .dstAccessMask = VK_ACCESS_2_SHADER_READ_BIT,
+    }));
+    image.descriptor.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+    texture.image          = image;
+    texture.resident_level = new_level;
+    texture.resident_bytes = m_Alloc->getAllocationSize(image.allocation);
+    texture.last_changed   = m_UpdateIndex;
+    m_ResidentBytes += texture.resident_bytes;
+    return true;
+}
+
+bool vk_test::TextureStreamer::makeRoom(VkDeviceSize size, VkDeviceSize budget, uint64_t last_seen, const SemaphoreState& frame_state) {
+    if (m_ResidentBytes + size <= budget) {
+        return true;
+    }
+
+    // Levels nobody asks for anymore
+    for (StreamedTexture& texture : m_Textures) {
+        if (texture.image.image == VK_NULL_HANDLE || texture.last_changed == m_UpdateIndex) {
+            continue;
+        }
+        const uint32_t wanted_level = getWantedLevel(texture);
+        const uint32_t old_level    = texture.resident_level;
+        if (old_level < wanted_level && changeResidency(texture, wanted_level, frame_state)) {
+            m_Stats.evicted_levels += wanted_level - old_level;
+            if (m_ResidentBytes + size <= budget) {
+                return true;
+            }
+        }
+    }
+
+    // Then the textures seen the longest time ago
+    std::vector<uint32_t> victims;
+    for (uint32_t texture_id = 0; texture_id < uint32_t(m_Textures.size()); texture_id++) {
+        const StreamedTexture& texture = m_Textures[texture_id];
+        if (texture.image.image != VK_NULL_HANDLE && texture.last_changed != m_UpdateIndex && texture.last_seen < last_seen && texture.resident_level < texture.tail_level) {
+            victims.push_back(texture_id);
+        }
+    }
+    std::ranges::sort(victims, [&](uint32_t a, uint32_t b) { return m_Textures[a].last_seen < m_Textures[b].last_seen; });
+
+    for (uint32_t texture_id : victims) {
+        StreamedTexture& texture     = m_Textures[texture_id];
+        const uint32_t   level_count = texture.tail_level - texture.resident_level;
+        if (changeResidency(texture, texture.tail_level, frame_state)) {
+            m_Stats.evicted_levels += level_count;
+            if (m_ResidentBytes + size <= budget) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void vk_test::TextureStreamer::releaseRetired(bool force_all) {
+    const VkDevice device = m_Alloc->getDevice();
+    std::erase_if(m_RetiredImages, [&](RetiredImage& retired) {
+        if (!force_all && retired.semaphore_state.isValid() && !retired.semaphore_state.testSignaled(device)) {
+            return false;
+        }
+        m_Alloc->destroyImage(retired.image);
+        return true;
+    });
+}
+
+bool vk_test::TextureStreamer::update(VkCommandBuffer cmd, uint32_t frame_index, const SemaphoreState& frame_state) {
+    m_UpdateIndex++;
+    releaseRetired(false);
+    collectLoaded();
+    readFeedback(frame_index);
+
+    // The feedback of the previous frame goes to this frame slot, then starts again from 0.
+    // Nothing was written before the first update.
+    const VkDeviceSize feedback_bytes = m_FeedbackSize * sizeof(uint32_t);
+    cmdMemoryBarrier(cmd,
+                     VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+                     VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+                     VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT,
+                     VK_ACCESS_2_TRANSFER_READ_BIT | VK_ACCESS_2_TRANSFER_WRITE_BIT);
+    if (m_UpdateIndex > 1) {
+        const VkBufferCopy region{ .srcOffset = 0, .dstOffset = frame_index * feedback_bytes, .size = feedback_bytes };
+        vkCmdCopyBuffer(cmd, m_Feedback.buffer, m_FeedbackReadback.buffer, 1, &region);
+        m_ReadbackPending[frame_index] = true;
+    }
+    vkCmdFillBuffer(cmd, m_Feedback.buffer, 0, VK_WHOLE_SIZE, 0);
+    // The readback slot is read by the host once the frame slot comes back
+    cmdMemoryBarrier(cmd,
+                     VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+                     VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT | VK_PIPELINE_STAGE_2_HOST_BIT,
+                     VK_ACCESS_2_TRANSFER_WRITE_BIT,
+                     VK_ACCESS_2_SHADER_STORAGE_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT | VK_ACCESS_2_HOST_READ_BIT);
+
+    if (!m_FallbackUploaded) {
+        const uint32_t white = 0xFFFFFFFF;
+        m_PreBarriers.imageBarriers.push_back(makeImageMemoryBarrier({ .image = m_Fallback.image, .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED, .newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL }));
+        m_Fallback.descriptor.imageLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        m_Staging->appendImage(m_Fallback, sizeof(white), &white, VK_IMAGE_LAYOUT_UNDEFINED, frame_state);
+        m_PostBarriers.imageBarriers.push_back(makeImageMemoryBarrier({ .image = m_Fallback.image, .oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, .newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL }));
+        m_Fallback.descriptor.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        m_FallbackUploaded                = true;
+    }
+
+    const VkDeviceSize budget        = getEffectiveBudget();
+    VkDeviceSize       upload_budget = m_UploadBudget;
+    uint32_t           loads         = m_LoadsPerUpdate;
+    bool               changed       = false;
+
+    // Not seen for a while, only the tail is wanted
+    for (StreamedTexture& texture : m_Textures) {
+        if (m_UpdateIndex - texture.last_seen > UNSEEN_UPDATES_TO_DECAY) {
+            texture.wanted_log2 = UNSEEN_LOG2;
+        }
+    }
+
+    // The budget may have shrunk
+    if (m_ResidentBytes > budget) {
+        makeRoom(0, budget, m_UpdateIndex, frame_state);
+        changed = true;
+    }
+
+    // Mip tails first, so every texture shows up before any gets sharper.
+    // Each update uploads at least one tail or level, even beyond the upload budget.
+    for (uint32_t texture_id = 0; texture_id < uint32_t(m_Textures.size()); texture_id++) {
+        StreamedTexture& texture = m_Textures[texture_id];
+        if (texture.failed || texture.image.image != VK_NULL_HANDLE) {
+            continue;
+        }
+        if (texture.source == nullptr) {
+            if (!texture.loading && loads != 0) {
+                loads--;
+                requestLoad(texture_id);
+            }
+            continue; // Uploaded by an update after the file is decoded
+        }
+
+        VkDeviceSize tail_size = 0;
+        for (uint32_t level = texture.tail_level; level < texture.level_count; level++) {
+            tail_size += texture.level_sizes[level];
+        }
+        if (tail_size > upload_budget && upload_budget != m_UploadBudget) {
+            break;
+        }
+        if (changeResidency(texture, texture.tail_level, frame_state)) {
+            upload_budget -= std::min(upload_budget, tail_size);
+            changed = true;
+        }
+    }
+
+    // Then one level at a time, the textures furthest from their wanted level first
+    std::vector<uint32_t> candidates;
+    for (uint32_t texture_id = 0; texture_id < uint32_t(m_Textures.size()); texture_id++) {
+        const StreamedTexture& texture = m_Textures[texture_id];
+        if (!texture.failed && texture.image.image != VK_NULL_HANDLE && texture.resident_level > getWantedLevel(texture)) {
+            candidates.push_back(texture_id);
+        }
+    }
+    std::ranges::sort(candidates, [&](uint32_t a, uint32_t b) {
+        const uint32_t missing_a = m_Textures[a].resident_level - getWantedLevel(m_Textures[a]);
+        const uint32_t missing_b = m_Textures[b].resident_level - getWantedLevel(m_Textures[b]);
+        return missing_a != missing_b ? missing_a > missing_b : m_Textures[a].last_seen > m_Textures[b].last_seen;
+    });
+
+    for (uint32_t texture_id : candidates) {
+        StreamedTexture& texture = m_Textures[texture_id];
+        if (texture.last_changed == m_UpdateIndex) {
+            continue; // Already changed by this update, possibly evicted to make room
+        }
+
+        const uint32_t     new_level  = texture.resident_level - 1;
+        const VkDeviceSize level_size = texture.level_sizes[new_level];
+        if (level_size > upload_budget && upload_budget != m_UploadBudget) {
+            break;
+        }
+        if (texture.source == nullptr) {
+            if (!texture.loading && loads != 0) {
+                loads--;
+                requestLoad(texture_id);
+            }
+            continue;
+        }
+        if (!makeRoom(level_size, budget, texture.last_seen, frame_state)) {
+            continue;
+        }
+        if (changeResidency(texture, new_level, frame_state)) {
+            upload_budget -= std::min(upload_budget, level_size);
+            m_Stats.streamed_levels++;
+            changed = true;
+        }
+    }
+
+    // Nothing left to upload, the decoded file is loaded again if levels get evicted and wanted back
+    for (StreamedTexture& texture : m_Textures) {
+        if (texture.source != nullptr && texture.image.image != VK_NULL_HANDLE && texture.resident_level == 0) {
+            ktxTexture_Destroy(ktxTexture(texture.source));
+            texture.source = nullptr;
+        }
+    }
+
+    // Previous images to copy from, new images to fill, then to sample
+    if (!m_PreBarriers.imageBarriers.empty()) {
+        m_PreBarriers.cmdPipelineBarrier(cmd, 0);
+        for (const ImageCopy& image_copy : m_ImageCopies) {
+            vkCmdCopyImage(cmd,
+                           image_copy.src_image,
+                           VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                           image_copy.dst_image,
+                           VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                           uint32_t(image_copy.regions.size()),
+                           image_copy.regions.data());
+        }
+        m_Staging->cmdUploadAppended(cmd);
+        m_PostBarriers.cmdPipelineBarrier(cmd, 0);
+
+        m_PreBarriers.clear();
+        m_PostBarriers.clear();
+        m_ImageCopies.clear();
+    }
+
+    m_Stats.budget          = budget;
+    m_Stats.resident_bytes  = m_ResidentBytes;
+    m_Stats.texture_count   = uint32_t(m_Textures.size());
+    m_Stats.resident_count  = 0;
+    m_Stats.converged_count = 0;
+    for (const StreamedTexture& texture : m_Textures) {
+        if (texture.image.image != VK_NULL_HANDLE) {
+            m_Stats.resident_count++;
+            m_Stats.converged_count += texture.resident_level <= getWantedLevel(texture) ? 1 : 0;
+        }
+    }
+
+    return changed;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Usage example
+//--------------------------------------------------------------------------------------------------
+[[maybe_unused]] static void usage_TextureStreamer() {
+    vk_test::Application*        app{};           // The application
+    vk_test::ResourceAllocator   allocator;       // Initialized allocator
+    vk_test::StagingRingUploader staging;         // Initialized uploader
+    VkSampler                    sampler{};       // From the SamplerPool
+    vk_test::BindlessTextureTable texture_table;  // Initialized, Sampler2D textures[] of the shaders
+    vk_test::TextureStreamer      texture_streamer;
+
+    // 0.5 GiB for the textures, the shaders index the feedback with the slots of the table
+    texture_streamer.init(&allocator, &staging, app->getFrameCycleSize(), texture_table.getCapacity(), 512ULL << 20);
+
+    // Loads nothing yet, the slot shows the fallback
+    const uint32_t slot       = texture_table.allocateSlot(VkDescriptorImageInfo{});
+    uint32_t       texture_id = texture_streamer.addTexture("albedo.ktx2", sampler, slot);
+    texture_table.updateSlot(slot, texture_streamer.getDescriptorImageInfo(texture_id));
+
+    // In IAppElement::onRender, before the textures are used
+    {
+        VkCommandBuffer cmd{};
+        staging.releaseStaging();
+        if (texture_streamer.update(cmd, app->getFrameCycleIndex(), app->getFrameSemaphoreState()) && texture_streamer.hasChanged(texture_id)) {
+            // The frames in flight still sample the previous image through the previous slot
+            const uint32_t new_slot = texture_table.allocateSlot(texture_streamer.getDescriptorImageInfo(texture_id));
+            texture_table.freeSlot(texture_streamer.getFeedbackIndex(texture_id), app->getFrameSemaphoreState());
+            texture_streamer.setFeedbackIndex(texture_id, new_slot); // And the materials sampling the texture
+        }
+        texture_table.flush();
+
+        // The shaders get `texture_streamer.getFeedbackBuffer().address` (TutoPushConstant::textureFeedback)
+    }
+
+    vk_test::TextureStreamer::TextureStats stats = texture_streamer.getTextureStats(texture_id);
+    VK_TEST_SAY("Level " << stats.resident_level << " of " << stats.level_count << ", wanted " << stats.wanted_level);
+
+    texture_streamer.deinit();
+}
@@ -0,0 +1,225 @@
+#pragma once
+
+#include "resource_allocator.hpp"
+#include "staging.hpp"
+#include "semaphore.hpp"
+#include "barriers.hpp"
+
+struct ktxTexture2;
+
+//-----------------------------------------------------------------
+// TextureStreamer keeps the KTX2 textures of a scene in video memory
+// from their mip tail up to the resolution the shaders ask for,
+// within a memory budget.
+//
+// Adding a texture loads nothing, its descriptor shows a 1x1 white
+// fallback until update() has uploaded its mip tail (the levels of
+// MIP_TAIL_SIZE texels or less). The tails of all textures go before
+// any finer level, so the scene shows up within a few frames.
+//
+// The files are read and transcoded on a worker thread, update() only
+// queues them and picks up the ones decoded since the previous update.
+//
+// Shaders write, per texture descriptor, the resolution (log2 + 1) at
+// which a texel covers a pixel into getFeedbackBuffer() with
+// InterlockedMax (see writeTextureFeedback in foundation.slang), 0 is
+// left for the textures that were not sampled. The buffer is read
+// back when its frame slot comes back, then finer levels are streamed
+// in, one level per texture and update, the textures furthest from
+// their wanted level first, within an upload budget per update.
+//
+// A texture changes resolution by getting a new image: the levels it
+// keeps are copied from the previous image, which is destroyed once the
+// frame of the copy has completed. The frames in flight still sample the
+// previous image, so the new one goes to a new descriptor, given back
+// with setFeedbackIndex(), see update().
+//
+// Levels are only evicted beyond the budget: first those finer than
+// wanted, then those of the textures seen the longest time ago, never
+// below the mip tail. The budget follows what VMA reports as available.
+//
+// Usage:
+//      see usage_TextureStreamer in texture_streamer.cpp
+//-----------------------------------------------------------------
+
+namespace vk_test {
+
+    class TextureStreamer {
+    public:
+        static constexpr uint32_t     MIP_TAIL_SIZE            = 128;              // Largest dimension of the levels always resident
+        static constexpr VkDeviceSize DEFAULT_UPLOAD_BUDGET    = 16 * 1024 * 1024; // Bytes uploaded per update
+        static constexpr uint32_t     DEFAULT_LOADS_PER_UPDATE = 2;                // Files queued for decoding per update
+        static constexpr uint64_t     UNSEEN_UPDATES_TO_DECAY  = 120;              // Not seen for this many updates, a texture only wants its tail
+
+        struct TextureStats {
+            uint32_t     level_count    = 0;     // 0 until the file is loaded
+            uint32_t     resident_level = 0;     // Finest level in video memory, `level_count` when none
+            uint32_t     wanted_level   = 0;     // Finest level asked for by the shaders
+            VkDeviceSize resident_bytes = 0;     // Size of the image
+            bool         source_loaded  = false; // The decoded file is kept for the next levels
+        };
+
+        struct Stats {
+            VkDeviceSize budget          = 0; // Budget of the last update
+            VkDeviceSize resident_bytes  = 0;
+            uint32_t     texture_count   = 0;
+            uint32_t     resident_count  = 0; // Textures with at least their mip tail
+            uint32_t     converged_count = 0; // Textures at their wanted level
+            uint64_t     streamed_levels = 0;
+            uint64_t     evicted_levels  = 0;
+            uint64_t     uploaded_bytes  = 0;
+        };
+
+        TextureStreamer()                                  = default;
+        TextureStreamer(const TextureStreamer&)            = delete;
+        TextureStreamer& operator=(const TextureStreamer&) = delete;
+        ~TextureStreamer() { assert(m_Alloc == nullptr && "Missing deinit()"); }
+
+        // `feedback_size` is the number of texture descriptors the shaders index the feedback with.
+        // `budget` is the video memory given to the textures, 0 for all VMA reports as available.
+        VkResult init(ResourceAllocator* alloc, StagingUploader* staging, uint32_t frame_cycle_size, uint32_t feedback_size, VkDeviceSize budget = 0);
+
+        // the device must be idle
+        void deinit();
+
+        // Adds a KTX2 file, shown by the texture descriptor `feedback_index`, returns its id
+        uint32_t addTexture(const std::filesystem::path& filename, VkSampler sampler, uint32_t feedback_index);
+
+        void setBudget(VkDeviceSize budget) { m_Budget = budget; }
+        void setUploadBudget(VkDeviceSize upload_budget) { m_UploadBudget = upload_budget; }
+        void setLoadsPerUpdate(uint32_t loads_per_update) { m_LoadsPerUpdate = loads_per_update; }
+
+        // Reads back the feedback of the frame slot `frame_index`, then streams levels in and out.
+        // Recorded outside of rendering, before the textures are used. `frame_state` is signaled
+        // when `cmd` has completed. Returns true when textures got a new image (hasChanged), each needs a new
+        // descriptor slot: the frames in flight still use the previous one until `frame_state` is signaled.
+        bool update(VkCommandBuffer cmd, uint32_t frame_index, const SemaphoreState& frame_state);
+
+        uint32_t getTextureCount() const { return uint32_t(m_Textures.size()); }
+        uint32_t getFeedbackIndex(uint32_t texture_id) const { return m_Textures[texture_id].feedback_index; }
+
+        // The texture descriptor now showing the texture, after it got a new image
+        void setFeedbackIndex(uint32_t texture_id, uint32_t feedback_index) {
+            assert(feedback_index < m_FeedbackSize);
+            m_Textures[texture_id].feedback_index = feedback_index;
+        }
+
+        // True when the last update gave the texture a new image, to put in a new descriptor slot
+        bool hasChanged(uint32_t texture_id) const { return m_Textures[texture_id].last_changed == m_UpdateIndex; }
+
+        // The image of the texture, or the fallback while its mip tail is not resident
+        VkDescriptorImageInfo getDescriptorImageInfo(uint32_t texture_id) const;
+
+        // uint32_t per texture descriptor, cleared by every update
+        const Buffer& getFeedbackBuffer() const { return m_Feedback; }
+
+        TextureStats getTextureStats(uint32_t texture_id) const;
+        const Stats& getStats() const { return m_Stats; }
+
+    private:
+        static constexpr uint32_t UNSEEN_LOG2 = ~0U; // wanted_log2 of a texture the shaders did not sample lately
+
+        struct StreamedTexture {
+            std::filesystem::path filename;
+            VkSampler             sampler{};
+            uint32_t              feedback_index = 0;
+
+            Image        image;            // Levels [resident_level, level_count) of the file
+            ktxTexture2* source = nullptr; // Decoded file, released once fully resident
+
+            // Known once the file is loaded
+            VkFormat                  format       = VK_FORMAT_UNDEFINED;
+            VkImageCreateFlags        create_flags = 0;
+            VkImageViewType           view_type    = VK_IMAGE_VIEW_TYPE_2D;
+            VkExtent2D                base_extent{};
+            uint32_t                  layer_count = 0;
+            uint32_t                  level_count = 0;
+            uint32_t                  tail_level  = 0;
+            std::vector<VkDeviceSize> level_sizes; // All layers of each level
+
+            uint32_t     resident_level = 0;
+            uint32_t     wanted_log2    = UNSEEN_LOG2; // Resolution asked for by the feedback
+            uint64_t     last_seen      = 0;           // Update of the last feedback
+            uint64_t     last_changed   = 0;           // Update of the last new image
+            VkDeviceSize resident_bytes = 0;
+            bool         loading        = false;       // Queued or being decoded by the loader thread
+            bool         failed         = false;
+        };
+
+        struct LoadJob {
+            uint32_t              texture_id = 0;
+            std::filesystem::path filename;
+        };
+
+        struct LoadedSource {
+            uint32_t     texture_id = 0;
+            ktxTexture2* source     = nullptr; // nullptr when the file could not be loaded
+        };
+
+        struct ImageCopy {
+            VkImage                  src_image{};
+            VkImage                  dst_image{};
+            std::vector<VkImageCopy> regions;
+        };
+
+        struct RetiredImage {
+            Image          image;
+            SemaphoreState semaphore_state;
+        };
+
+        void         loaderThread();
+        void         requestLoad(uint32_t texture_id);
+        void         collectLoaded();
+        void         setSource(StreamedTexture& texture, ktxTexture2* source) const;
+        void         readFeedback(uint32_t frame_index);
+        uint32_t     getWantedLevel(const StreamedTexture& texture) const;
+        VkDeviceSize getEffectiveBudget() const;
+
+        // Appends the switch of `texture` to the levels [new_level, level_count), recorded by update()
+        bool changeResidency(StreamedTexture& texture, uint32_t new_level, const SemaphoreState& frame_state);
+
+        // Evicts until `size` more bytes fit: the levels finer than wanted,
+        // then the textures seen before `last_seen` down to their tail
+        bool makeRoom(VkDeviceSize size, VkDeviceSize budget, uint64_t last_seen, const SemaphoreState& frame_state);
+
+        void releaseRetired(bool force_all);
+
+        ResourceAllocator* m_Alloc{};
+        StagingUploader*   m_Staging{};
+        VkPhysicalDevice   m_PhysicalDevice{};
+        VkDeviceSize       m_Budget         = 0;
+        VkDeviceSize       m_UploadBudget   = DEFAULT_UPLOAD_BUDGET;
+        uint32_t           m_LoadsPerUpdate = DEFAULT_LOADS_PER_UPDATE;
+        uint64_t           m_UpdateIndex    = 0;
+
+        std::vector<StreamedTexture> m_Textures;
+        VkDeviceSize                 m_ResidentBytes = 0;
+        Stats                        m_Stats;
+
+        // White 1x1 texture shown until the mip tail is resident
+        Image m_Fallback;
+        bool  m_FallbackUploaded = false;
+
+        // Feedback written by the shaders, copied to a host visible slot per frame in flight
+        uint32_t          m_FeedbackSize = 0;
+        Buffer            m_Feedback;
+        Buffer            m_FeedbackReadback;
+        std::vector<bool> m_ReadbackPending;
+
+        // Work of the current update
+        BarrierContainer       m_PreBarriers;
+        BarrierContainer       m_PostBarriers;
+        std::vector<ImageCopy> m_ImageCopies;
+
+        std::vector<RetiredImage> m_RetiredImages; // Previous images of the textures, until their last use has completed
+
+        // Files decoded on the loader thread
+        std::thread               m_LoaderThread;
+        std::mutex                m_LoadMutex;
+        std::condition_variable   m_LoadRequested;
+        std::deque<LoadJob>       m_LoadJobs;
+        std::vector<LoadedSource> m_LoadedSources; // Picked up by the next update
+        bool                      m_StopLoading = false;
+    };
+
+} // namespace vk_test
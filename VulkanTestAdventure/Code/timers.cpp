@@ -90,6 +90,11 @@ namespace vk_test {
         VK_TEST_SAY(str.c_str());
         s_OpenNewline = str.empty() || str[str.size() - 1] != '\n';
         ++s_Nesting;
+
+        if (s_TraceEnabled) {
+            m_TraceName  = str.empty() || str[str.size() - 1] != '\n' ? str : str.substr(0, str.size() - 1);
+            m_TraceBegin = getTraceTime();
+        }
     }
 
     ScopedTimer::~ScopedTimer() {
@@ -104,6 +109,28 @@ namespace vk_test {
         }
         VK_TEST_SAY(m_Timer.getMilliseconds() << " ms");
         s_OpenNewline = false;
+
+        if (!m_TraceName.empty()) {
+            const double end = getTraceTime();
+
+            std::lock_guard<std::mutex> lock(s_TraceMutex);
+            if (s_TraceEvents.size() < MAX_TRACE_EVENTS) {
+                s_TraceEvents.push_back({ .name      = std::move(m_TraceName),
+                                          .begin     = m_TraceBegin,
+                                          .duration  = end - m_TraceBegin,
+                                          .thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id()) });
+            }
+        }
+    }
+
+    std::vector<ScopedTimer::TraceEvent> ScopedTimer::getTraceEvents() {
+        std::lock_guard<std::mutex> lock(s_TraceMutex);
+        return s_TraceEvents;
+    }
+
+    void ScopedTimer::clearTraceEvents() {
+        std::lock_guard<std::mutex> lock(s_TraceMutex);
+        s_TraceEvents.clear();
     }
 
 } // namespace vk_test
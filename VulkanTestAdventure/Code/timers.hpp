@@ -94,12 +94,32 @@ namespace vk_test {
     //   auto stimer = ScopedTimer("Time for doing X");
     // Nesting timers is handled, but since the time is printed when it goes out of
     // scope, printing anything else will break the output formatting.
+    //
+    // When the trace is enabled, the scopes of all threads are also kept, to be
+    // exported as a Chrome trace with the GPU sections (see GpuProfiler::writeChromeTrace).
     class ScopedTimer {
     public:
+        // Times in seconds on the trace clock, see getTraceTime()
+        struct TraceEvent {
+            std::string name;
+            double      begin     = 0.0;
+            double      duration  = 0.0;
+            uint64_t    thread_id = 0;
+        };
+
+        static constexpr size_t MAX_TRACE_EVENTS = 65536; // Later scopes are dropped
+
         ScopedTimer(const std::string& str);
         ScopedTimer(const char* fmt, ...);
         void init_(const std::string& str);
         ~ScopedTimer();
+
+        static void                    setTraceEnabled(bool enabled) { s_TraceEnabled = enabled; }
+        static std::vector<TraceEvent> getTraceEvents();
+        static void                    clearTraceEvents();
+
+        // Seconds since the start of the application
+        static double getTraceTime() { return s_TraceClock.getSeconds(); }
         static std::string indent() {
             std::string result(static_cast<size_t>(s_Nesting * 2), ' ');
             for (int i = 0; i < s_Nesting * 2; i += 2) {
@@ -113,6 +133,14 @@ namespace vk_test {
         bool                            m_ManualIndent = false;
         static inline thread_local int  s_Nesting      = 0;
         static inline thread_local bool s_OpenNewline  = false;
+
+        std::string m_TraceName; // Empty when the trace was disabled at construction
+        double      m_TraceBegin = 0.0;
+
+        static inline std::atomic<bool>       s_TraceEnabled = false;
+        static inline PerformanceTimer        s_TraceClock;
+        static inline std::mutex              s_TraceMutex;
+        static inline std::vector<TraceEvent> s_TraceEvents;
     };
 
 // Can be used to measure time in a scope i.e. SCOPED_TIMER("Doing something"); will print "Doing something" and the time spent in the scope
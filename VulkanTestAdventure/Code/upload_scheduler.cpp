@@ -0,0 +1,243 @@
+#include "pch.h"
+#include "upload_scheduler.hpp"
+
+#include <staging.hpp>
+#include <Application.hpp>
+
+VkResult vk_test::UploadScheduler::init(VkDevice device, const QueueInfo& transfer_queue, uint32_t graphics_family_index) {
+    assert(!m_Device);
+    m_Device              = device;
+    m_Queue               = transfer_queue;
+    m_GraphicsFamilyIndex = graphics_family_index;
+    m_SubmittedValue      = 0;
+    m_AcquiredValue       = 0;
+
+    // Command buffers are reset one by one, when their upload has completed
+    const VkCommandPoolCreateInfo command_pool_create_info{
+        .sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+        .flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+        .queueFamilyIndex = m_Queue.family_index,
+    };
+    VkResult result = vkCreateCommandPool(m_Device, &command_pool_create_info, nullptr, &m_CommandPool);
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+
+    return createTimelineSemaphore(m_Device, 0, m_Semaphore);
+}
+
+void vk_test::UploadScheduler::deinit() {
+    if (m_Device == VK_NULL_HANDLE) {
+        return;
+    }
+    assert(m_RecordingCmd == VK_NULL_HANDLE && "Missing submitUpload()");
+
+    if (m_Semaphore != VK_NULL_HANDLE) {
+        const VkSemaphoreWaitInfo wait_info{
+            .sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+            .semaphoreCount = 1,
+            .pSemaphores    = &m_Semaphore,
+            .pValues        = &m_SubmittedValue,
+        };
+        vkWaitSemaphores(m_Device, &wait_info, std::numeric_limits<uint64_t>::max());
+        vkDestroySemaphore(m_Device, m_Semaphore, nullptr);
+    }
+    vkDestroyCommandPool(m_Device, m_CommandPool, nullptr); // Frees the command buffers
+
+    m_CommandSlots.clear();
+    m_Release.clear();
+    m_UploadAcquire.clear();
+    m_Acquire.clear();
+    m_Semaphore   = VK_NULL_HANDLE;
+    m_CommandPool = VK_NULL_HANDLE;
+    m_Device      = VK_NULL_HANDLE;
+}
+
+VkCommandBuffer vk_test::UploadScheduler::beginUpload() {
+    assert(m_RecordingCmd == VK_NULL_HANDLE && "Only one upload is recorded at a time");
+
+    uint64_t completed_value = 0;
+    vkGetSemaphoreCounterValue(m_Device, m_Semaphore, &completed_value);
+
+    // Reuse the command buffer of a completed upload, or add one
+    CommandSlot* slot = nullptr;
+    for (CommandSlot& command_slot : m_CommandSlots) {
+        if (command_slot.timeline_value <= completed_value) {
+            slot = &command_slot;
+            break;
+        }
+    }
+    if (slot == nullptr) {
+        const VkCommandBufferAllocateInfo alloc_info{
+            .sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+            .commandPool        = m_CommandPool,
+            .level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+            .commandBufferCount = 1,
+        };
+        slot = &m_CommandSlots.emplace_back();
+        vkAllocateCommandBuffers(m_Device, &alloc_info, &slot->cmd);
+    }
+    else {
+        vkResetCommandBuffer(slot->cmd, 0);
+    }
+    slot->timeline_value = m_SubmittedValue + 1;
+
+    const VkCommandBufferBeginInfo begin_info{ .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+                                               .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT };
+    vkBeginCommandBuffer(slot->cmd, &begin_info);
+
+    m_RecordingCmd = slot->cmd;
+    return m_RecordingCmd;
+}
+
+void vk_test::UploadScheduler::cmdReleaseBuffer(VkCommandBuffer cmd, const Buffer& buffer) {
+    assert(cmd == m_RecordingCmd);
+    if (isSameFamily()) {
+        return; // The semaphore is enough
+    }
+
+    // The release only needs the source scope, the acquire only the destination one
+    m_Release.bufferBarriers.push_back(makeBufferMemoryBarrier({
+        .buffer              = buffer.buffer,
+        .srcStageMask        = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT,
+        .dstStageMask        = VK_PIPELINE_STAGE_2_NONE,
+        .srcAccessMask       = VK_ACCESS_2_TRANSFER_WRITE_BIT,
+        .dstAccessMask       = VK_ACCESS_2_NONE,
+        .srcQueueFamilyIndex = m_Queue.family_index,
+        .dstQueueFamilyIndex = m_GraphicsFamilyIndex,
+    }));
+    m_UploadAcquire.bufferBarriers.push_back(makeBufferMemoryBarrier({
+        .buffer              = buffer.buffer,
+        .srcStageMask        = VK_PIPELINE_STAGE_2_NONE,
+        .srcAccessMask       = VK_ACCESS_2_NONE,
+        .srcQueueFamilyIndex = m_Queue.family_index,
+        .dstQueueFamilyIndex = m_GraphicsFamilyIndex,
+    }));
+}
+
+void vk_test::UploadScheduler::cmdReleaseImage(VkCommandBuffer cmd, const Image& image) {
+    assert(cmd == m_RecordingCmd);
+    if (isSameFamily()) {
+        return;
+    }
+
+    const VkImageLayout layout = image.descriptor.imageLayout;
+    m_Release.imageBarriers.push_back(makeImageMemoryBarrier({
+        .image               = image.image,
+        .oldLayout           = layout,
+        .newLayout           = layout,
+        .srcStageMask        = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT,
+        .dstStageMask        = VK_PIPELINE_STAGE_2_NONE,
+        .srcAccessMask       = VK_ACCESS_2_TRANSFER_WRITE_BIT,
+        .dstAccessMask       = VK_ACCESS_2_NONE,
+        .srcQueueFamilyIndex = m_Queue.family_index,
+        .dstQueueFamilyIndex = m_GraphicsFamilyIndex,
+    }));
+    m_UploadAcquire.imageBarriers.push_back(makeImageMemoryBarrier({
+        .image               = image.image,
+        .oldLayout           = layout,
+        .newLayout           = layout,
+        .srcStageMask        = VK_PIPELINE_STAGE_2_NONE,
+        .dstStageMask        = VK_PIPELINE_STAGE_2_NONE, // set in cmdAcquireUploads
+        .srcAccessMask       = VK_ACCESS_2_NONE,
+        .dstAccessMask       = VK_ACCESS_2_NONE,
+        .srcQueueFamilyIndex = m_Queue.family_index,
+        .dstQueueFamilyIndex = m_GraphicsFamilyIndex,
+    }));
+}
+
+void vk_test::UploadScheduler::submitUpload(VkCommandBuffer cmd) {
+    assert(cmd == m_RecordingCmd);
+
+    m_Release.cmdPipelineBarrier(cmd, 0);
+    m_Release.clear();
+    vkEndCommandBuffer(cmd);
+
+    // The graphics queue can acquire the resources from now on
+    m_Acquire.bufferBarriers.insert(m_Acquire.bufferBarriers.end(), m_UploadAcquire.bufferBarriers.begin(), m_UploadAcquire.bufferBarriers.end());
+    m_Acquire.imageBarriers.insert(m_Acquire.imageBarriers.end(), m_UploadAcquire.imageBarriers.begin(), m_UploadAcquire.imageBarriers.end());
+    m_UploadAcquire.clear();
+
+    m_SubmittedValue++;
+
+    const VkCommandBufferSubmitInfo cmd_buffer_info{ .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO, .commandBuffer = cmd };
+    const VkSemaphoreSubmitInfo     signal_info{
+            .sType     = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+            .semaphore = m_Semaphore,
+            .value     = m_SubmittedValue,
+            .stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, // The copies and the queue family releases
+    };
+    const VkSubmitInfo2 submit_info{
+        .sType                    = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
+        .commandBufferInfoCount   = 1,
+        .pCommandBufferInfos      = &cmd_buffer_info,
+        .signalSemaphoreInfoCount = 1,
+        .pSignalSemaphoreInfos    = &signal_info,
+    };
+    vkQueueSubmit2(m_Queue.queue, 1, &submit_info, nullptr);
+
+    m_RecordingCmd = VK_NULL_HANDLE;
+}
+
+VkSemaphoreSubmitInfo vk_test::UploadScheduler::cmdAcquireUploads(VkCommandBuffer cmd, VkPipelineStageFlags2 dst_stage_mask) {
+    if (!m_Acquire.bufferBarriers.empty() || !m_Acquire.imageBarriers.empty()) {
+        for (VkBufferMemoryBarrier2& barrier : m_Acquire.bufferBarriers) {
+            barrier.dstStageMask  = dst_stage_mask;
+            barrier.dstAccessMask = VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT;
+        }
+        for (VkImageMemoryBarrier2& barrier : m_Acquire.imageBarriers) {
+            barrier.dstStageMask  = dst_stage_mask;
+            barrier.dstAccessMask = VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT;
+        }
+        m_Acquire.cmdPipelineBarrier(cmd, 0);
+        m_Acquire.clear();
+    }
+    m_AcquiredValue = m_SubmittedValue;
+
+    // Waiting on an already reached value costs nothing
+    return {
+        .sType     = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+        .semaphore = m_Semaphore,
+        .value     = m_AcquiredValue,
+        .stageMask = dst_stage_mask,
+    };
+}
+
+//--------------------------------------------------------------------------------------------------
+// Usage example
+//--------------------------------------------------------------------------------------------------
+[[maybe_unused]] static void usage_UploadScheduler() {
+    vk_test::Application*    app{};     // With a graphics queue (0) and a transfer queue (1)
+    vk_test::StagingUploader staging{}; // Initialized uploader
+    vk_test::Buffer          my_buffer; // Used by the graphics queue
+    std::vector<float>       my_data;
+    vk_test::UploadScheduler upload_scheduler;
+
+    upload_scheduler.init(app->getDevice(), app->getQueue(1), app->getQueue(0).family_index);
+
+    // Streaming side, anywhere before the frame is recorded
+    {
+        VkCommandBuffer cmd = upload_scheduler.beginUpload();
+
+        // The staging space is kept until the transfer queue has done the copies
+        staging.beginTransferOnly();
+        staging.appendBuffer(my_buffer, 0, std::span(my_data), upload_scheduler.getUploadSemaphoreState());
+        staging.cmdUploadAppended(cmd);
+
+        upload_scheduler.cmdReleaseBuffer(cmd, my_buffer);
+        upload_scheduler.submitUpload(cmd);
+    }
+
+    // Frame side, in IAppElement::onRender before `my_buffer` is used
+    {
+        VkCommandBuffer frame_cmd{};
+        if (upload_scheduler.hasPendingUploads()) {
+            app->addWaitSemaphore(upload_scheduler.cmdAcquireUploads(frame_cmd));
+        }
+    }
+
+    // Later frames
+    staging.releaseStaging();
+
+    upload_scheduler.deinit();
+}
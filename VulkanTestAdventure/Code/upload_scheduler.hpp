@@ -0,0 +1,86 @@
+#pragma once
+
+#include "resources.hpp"
+#include "semaphore.hpp"
+#include "barriers.hpp"
+
+//-----------------------------------------------------------------
+// UploadScheduler submits the uploads on a transfer queue, without
+// waiting for them on the CPU, so that streaming overlaps rendering.
+//
+// Each upload signals a timeline semaphore. The resources it wrote are
+// released to the graphics queue family, the matching acquire barriers
+// and the semaphore wait are handed to the next graphics submit with
+// cmdAcquireUploads() (for a frame: Application::addWaitSemaphore).
+// When both queues are of the same family, only the wait remains.
+//
+// The StagingUploader recording into an upload command buffer should
+// use beginTransferOnly(), and getUploadSemaphoreState() to keep its
+// staging space until the copies are done.
+//
+// Usage:
+//      see usage_UploadScheduler in upload_scheduler.cpp
+//-----------------------------------------------------------------
+
+namespace vk_test {
+
+    class UploadScheduler {
+    public:
+        UploadScheduler()                                  = default;
+        UploadScheduler(const UploadScheduler&)            = delete;
+        UploadScheduler& operator=(const UploadScheduler&) = delete;
+        ~UploadScheduler() { assert(m_Device == VK_NULL_HANDLE && "Missing deinit()"); }
+
+        // `transfer_queue` executes the uploads, `graphics_family_index` is the family using the results
+        VkResult init(VkDevice device, const QueueInfo& transfer_queue, uint32_t graphics_family_index);
+
+        // waits for the submitted uploads
+        void deinit();
+
+        // Starts an upload, only one can be recorded at a time
+        VkCommandBuffer beginUpload();
+
+        // Signaled when the upload being recorded has completed
+        SemaphoreState getUploadSemaphoreState() const { return SemaphoreState::makeFixed(m_Semaphore, m_SubmittedValue + 1); }
+
+        // Hands a resource written by the upload over to the graphics queue family.
+        // Images keep their current `descriptor.imageLayout`, the StagingUploader transitions them.
+        void cmdReleaseBuffer(VkCommandBuffer cmd, const Buffer& buffer);
+        void cmdReleaseImage(VkCommandBuffer cmd, const Image& image);
+
+        // Ends and submits the upload, the CPU does not wait
+        void submitUpload(VkCommandBuffer cmd);
+
+        // True when uploads were submitted since the last cmdAcquireUploads()
+        bool hasPendingUploads() const { return m_AcquiredValue != m_SubmittedValue; }
+
+        // Records the acquire barriers of the submitted uploads in a graphics command buffer.
+        // The submit of `cmd` must wait for the returned semaphore.
+        VkSemaphoreSubmitInfo cmdAcquireUploads(VkCommandBuffer cmd, VkPipelineStageFlags2 dst_stage_mask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
+
+        bool     isSameFamily() const { return m_Queue.family_index == m_GraphicsFamilyIndex; }
+        uint64_t getSubmittedCount() const { return m_SubmittedValue; }
+
+    private:
+        struct CommandSlot {
+            VkCommandBuffer cmd{};
+            uint64_t        timeline_value = 0; // Reusable once reached
+        };
+
+        VkDevice      m_Device{};
+        QueueInfo     m_Queue;
+        uint32_t      m_GraphicsFamilyIndex = ~0U;
+        VkCommandPool m_CommandPool{};
+        VkSemaphore   m_Semaphore{};
+        uint64_t      m_SubmittedValue = 0; // Value of the last submitted upload
+        uint64_t      m_AcquiredValue  = 0; // Value of the last upload handed to the graphics queue
+
+        std::vector<CommandSlot> m_CommandSlots;
+        VkCommandBuffer          m_RecordingCmd{};
+
+        BarrierContainer m_Release;       // Barriers of the upload being recorded
+        BarrierContainer m_UploadAcquire; // Their acquire side, moved to m_Acquire once submitted
+        BarrierContainer m_Acquire;       // Barriers of the submitted uploads, for the graphics queue
+    };
+
+} // namespace vk_test
@@ -31,6 +31,7 @@
 #include <file_operations.hpp>
 
 #include <stb_image.h>
+#include <ktx.h>
 
 namespace vk_test {
 
@@ -58,6 +59,139 @@ namespace vk_test {
         allocator->createImage(texture, image_info, DEFAULT_VkImageViewCreateInfo);
         staging.appendImage(texture, data_span, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 
+        // The data was copied into the staging space
+        stbi_image_free(const_cast<stbi_uc*>(data));
+
+        return texture;
+    }
+
+    static bool isSampledFormatSupported(VkPhysicalDevice physical_device, VkFormat format) {
+        VkFormatProperties properties{};
+        vkGetPhysicalDeviceFormatProperties(physical_device, format, &properties);
+        return (properties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT) != 0;
+    }
+
+    // Block formats in order of preference: BC7 on desktop, ASTC and ETC2 on mobile
+    static ktx_transcode_fmt_e chooseTranscodeFormat(VkPhysicalDevice physical_device) {
+        if (isSampledFormatSupported(physical_device, VK_FORMAT_BC7_UNORM_BLOCK)) {
+            return KTX_TTF_BC7_RGBA;
+        }
+        if (isSampledFormatSupported(physical_device, VK_FORMAT_ASTC_4x4_UNORM_BLOCK)) {
+            return KTX_TTF_ASTC_4x4_RGBA;
+        }
+        if (isSampledFormatSupported(physical_device, VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK)) {
+            return KTX_TTF_ETC2_RGBA;
+        }
+        return KTX_TTF_RGBA32;
+    }
+
+    ktxTexture2* loadKtxTexture(VkPhysicalDevice physical_device, const std::filesystem::path& filename) {
+        const std::string filename_utf8 = utf8FromPath(filename);
+
+        ktxTexture2*   ktx_texture = nullptr;
+        KTX_error_code result      = ktxTexture2_CreateFromNamedFile(filename_utf8.c_str(), KTX_TEXTURE_CREATE_LOAD_IMAGE_DATA_BIT, &ktx_texture);
+        if (result != KTX_SUCCESS) {
+            VK_TEST_SAY("Could not load KTX2 texture " << filename_utf8.c_str() << " : " << ktxErrorString(result));
+            return nullptr;
+        }
+
+        // The transcoded format keeps the color space of the file (sRGB or linear)
+        if (ktxTexture2_NeedsTranscoding(ktx_texture)) {
+            result = ktxTexture2_TranscodeBasis(ktx_texture, chooseTranscodeFormat(physical_device), 0);
+            if (result != KTX_SUCCESS) {
+                VK_TEST_SAY("Could not transcode KTX2 texture " << filename_utf8.c_str() << " : " << ktxErrorString(result));
+                ktxTexture_Destroy(ktxTexture(ktx_texture));
+                return nullptr;
+            }
+        }
+
+        const VkFormat format = VkFormat(ktx_texture->vkFormat);
+        if (format == VK_FORMAT_UNDEFINED || !isSampledFormatSupported(physical_device, format)) {
+            VK_TEST_SAY("KTX2 texture " << filename_utf8.c_str() << " has a format the device cannot sample : " << ktx_texture->vkFormat);
+            ktxTexture_Destroy(ktxTexture(ktx_texture));
+            return nullptr;
+        }
+
+        return ktx_texture;
+    }
+
+    Image loadAndCreateKtxImage(StagingUploader& staging, VkPhysicalDevice physical_device, const std::filesystem::path& filename, VkImageLayout final_layout) {
+        ktxTexture2* ktx_texture = loadKtxTexture(physical_device, filename);
+        if (ktx_texture == nullptr) {
+            return {};
+        }
+        if (ktx_texture->baseDepth > 1) {
+            VK_TEST_SAY("3D KTX2 textures are not supported : " << utf8FromPath(filename).c_str());
+            ktxTexture_Destroy(ktxTexture(ktx_texture));
+            return {};
+        }
+        const VkFormat format = VkFormat(ktx_texture->vkFormat);
+
+        // Cube faces are stored as array layers
+        const uint32_t layer_count = ktx_texture->numLayers * ktx_texture->numFaces;
+
+        VkImageCreateInfo image_info = DEFAULT_VkImageCreateInfo;
+        image_info.flags             = ktx_texture->isCubemap ? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT : 0;
+        image_info.format            = format;
+        image_info.usage             = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+        image_info.extent            = { ktx_texture->baseWidth, ktx_texture->baseHeight, 1 };
+        image_info.mipLevels         = ktx_texture->numLevels;
+        image_info.arrayLayers       = layer_count;
+
+        VkImageViewCreateInfo view_info = DEFAULT_VkImageViewCreateInfo;
+        if (ktx_texture->isCubemap) {
+            view_info.viewType = ktx_texture->isArray ? VK_IMAGE_VIEW_TYPE_CUBE_ARRAY : VK_IMAGE_VIEW_TYPE_CUBE;
+        }
+        else if (ktx_texture->isArray) {
+            view_info.viewType = VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+        }
+
+        ResourceAllocator* allocator = staging.getResourceAllocator();
+
+        Image texture;
+        allocator->createImage(texture, image_info, view_info);
+
+        // One copy per mip level, layer and face, the image stays in TRANSFER_DST_OPTIMAL
+        // between them and goes to `final_layout` with the last one
+        const ktx_uint8_t* ktx_data          = ktxTexture_GetData(ktxTexture(ktx_texture));
+        const uint32_t     subresource_count = ktx_texture->numLevels * layer_count;
+        uint32_t           subresource_index = 0;
+        for (uint32_t level = 0; level < ktx_texture->numLevels; ++level) {
+            const size_t     level_size = ktxTexture_GetImageSize(ktxTexture(ktx_texture), level);
+            const VkExtent3D extent{
+                .width  = std::max(1U, ktx_texture->baseWidth >> level),
+                .height = std::max(1U, ktx_texture->baseHeight >> level),
+                .depth  = 1,
+            };
+
+            for (uint32_t layer = 0; layer < ktx_texture->numLayers; ++layer) {
+                for (uint32_t face = 0; face < ktx_texture->numFaces; ++face) {
+                    ktx_size_t offset = 0;
+                    ktxTexture_GetImageOffset(ktxTexture(ktx_texture), level, layer, face, &offset);
+
+                    const VkImageSubresourceLayers subresource{
+                        .aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT,
+                        .mipLevel       = level,
+                        .baseArrayLayer = layer * ktx_texture->numFaces + face,
+                        .layerCount     = 1,
+                    };
+
+                    VkImageLayout new_layout = VK_IMAGE_LAYOUT_UNDEFINED; // Already TRANSFER_DST_OPTIMAL, no barrier
+                    if (++subresource_index == subresource_count) {
+                        new_layout = final_layout;
+                    }
+                    else if (texture.descriptor.imageLayout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) {
+                        new_layout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+                    }
+
+                    staging.appendImageSub(texture, { 0, 0, 0 }, extent, subresource, level_size, ktx_data + offset, new_layout);
+                }
+            }
+        }
+
+        // The data was copied into the staging space
+        ktxTexture_Destroy(ktxTexture(ktx_texture));
+
         return texture;
     }
 
@@ -27,6 +27,8 @@
 #include "resources.hpp"
 #include "staging.hpp"
 
+struct ktxTexture2;
+
 namespace vk_test {
 
     inline static VkShaderModuleCreateInfo getShaderModuleCreateInfo(const std::span<const uint32_t>& spirv) {
@@ -43,4 +45,17 @@ namespace vk_test {
                              const std::filesystem::path& filename,
                              bool                         s_rgb = true);
 
+    // Loads a KTX2 file with its image data, see loadAndCreateKtxImage for the transcoding.
+    // Returns nullptr on failure, otherwise the texture must be destroyed with ktxTexture_Destroy.
+    ktxTexture2* loadKtxTexture(VkPhysicalDevice physical_device, const std::filesystem::path& filename);
+
+    // Loads a KTX2 texture with all its mip levels, layers and faces.
+    // Basis Universal (ETC1S/UASTC) payloads are transcoded to the first block format
+    // the device can sample: BC7, ASTC 4x4 or ETC2, and RGBA8 otherwise.
+    // Returns an empty image when the file cannot be loaded or its format is not supported.
+    Image loadAndCreateKtxImage(StagingUploader&             staging,
+                                VkPhysicalDevice             physical_device,
+                                const std::filesystem::path& filename,
+                                VkImageLayout                final_layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
 } // namespace vk_test
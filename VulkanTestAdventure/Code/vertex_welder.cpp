@@ -0,0 +1,353 @@
+#include "pch.h"
+#include "vertex_welder.hpp"
+#include "primitives.hpp"
+#include "parallel_work.hpp"
+#include "timers.hpp"
+#include "hash_operations.hpp"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define VERTEX_WELDER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+    constexpr uint32_t WELD_MAX_FLOATS = 32;
+    constexpr uint32_t WELD_EMPTY_SLOT = ~0U;
+
+    // Below this, the partitions cost more than they save
+    constexpr size_t WELD_PARALLEL_MIN_COUNT = 1 << 16;
+
+    // Random 32-bit words xor-ed with the blocks before they are multiplied, one per float
+    alignas(16) constexpr uint32_t WELD_SECRET[WELD_MAX_FLOATS] = {
+        0xbe4ba423, 0x396cfeb8, 0x1cad21f7, 0x2fd2ded5, 0x7f8f1e2c, 0xa48d9ff3, 0x57bb1b8d, 0x4e64c26f, //
+        0xdb979083, 0xe9d6648d, 0x9c6f4cc4, 0x10b4d2b5, 0x2e7a3b19, 0xd1a8b2e1, 0x65c7c3a5, 0x8f1d0a9e, //
+        0xc13a77f2, 0x7b0d9e3c, 0x5a2f6d81, 0xf36e4b17, 0x0c9d58a6, 0xa7e1c2d4, 0x39b6f07d, 0x6d4a1e93, //
+        0x92f3d5b8, 0x1e87a4c6, 0xe45b3f29, 0x4c2d9b7e, 0xb8a16e05, 0x73f0c4da, 0x2a9e8d61, 0xd65c17b3,
+    };
+    alignas(16) constexpr uint64_t WELD_SEED[2] = { 0xc2b2ae3d27d4eb4fULL, 0x9e3779b185ebca87ULL };
+
+    struct WeldSlot {
+        uint32_t hash  = 0;
+        uint32_t index = WELD_EMPTY_SLOT; // First vertex of the group
+    };
+
+    // Canonical form and hash of the vertices, in blocks of 4 floats
+    class WeldKeys {
+    public:
+        WeldKeys(const void* vertices, size_t vertex_size, const vk_test::VertexWeldSettings& settings)
+            : m_Vertices(static_cast<const uint8_t*>(vertices)), m_VertexSize(vertex_size), m_BlockCount(uint32_t((vertex_size / sizeof(float) + 3) / 4)) {
+            assert(vertex_size % sizeof(float) == 0 && vertex_size <= WELD_MAX_FLOATS * sizeof(float));
+            m_InvEpsilon = settings.epsilon > 0.0F ? 1.0F / settings.epsilon : 0.0F;
+            for (uint32_t i = 0; i < WELD_MAX_FLOATS; i++) {
+                m_Mask[i] = i < vertex_size / sizeof(float) && (settings.compareMask & (1U << i)) != 0 ? ~0U : 0U;
+            }
+        }
+
+        uint32_t blockCount() const { return m_BlockCount; }
+
+        // `key` holds blockCount() * 4 words, aligned on 16 bytes
+        void canonical(size_t vertex, uint32_t* key) const {
+            alignas(16) float values[WELD_MAX_FLOATS] = {};
+            memcpy(values, m_Vertices + vertex * m_VertexSize, m_VertexSize);
+
+#ifdef VERTEX_WELDER_SSE2
+            const __m128 inv_epsilon = _mm_set1_ps(m_InvEpsilon);
+            const __m128 sign_bit    = _mm_set1_ps(-0.0F);
+            const __m128 exact_limit = _mm_set1_ps(8388608.0F); // 2^23, the floats above are integers
+            for (uint32_t b = 0; b < m_BlockCount; b++) {
+                __m128 v = _mm_load_ps(values + b * 4);
+                if (m_InvEpsilon > 0.0F) {
+                    // Round to the nearest integer by adding and removing 2^23 with the sign of v
+                    v                   = _mm_mul_ps(v, inv_epsilon);
+                    const __m128 magic  = _mm_or_ps(_mm_and_ps(v, sign_bit), exact_limit);
+                    const __m128 round  = _mm_sub_ps(_mm_add_ps(v, magic), magic);
+                    const __m128 inside = _mm_cmplt_ps(_mm_andnot_ps(sign_bit, v), exact_limit);
+                    v                   = _mm_or_ps(_mm_and_ps(inside, round), _mm_andnot_ps(inside, v));
+                }
+                v = _mm_add_ps(v, _mm_setzero_ps()); // -0 + 0 is +0
+                _mm_store_si128(reinterpret_cast<__m128i*>(key + b * 4), _mm_and_si128(_mm_castps_si128(v), _mm_load_si128(reinterpret_cast<const __m128i*>(m_Mask + b * 4))));
+            }
+#else
+            for (uint32_t i = 0; i < m_BlockCount * 4; i++) {
+                float v = values[i];
+                if (m_InvEpsilon > 0.0F) {
+                    v = std::nearbyint(v * m_InvEpsilon);
+                }
+                v = v == 0.0F ? 0.0F : v;
+                memcpy(&key[i], &v, sizeof(v));
+                key[i] &= m_Mask[i];
+            }
+#endif
+        }
+
+        // Each block is xor-ed with the secret, its pairs of words are multiplied and summed in two 64-bit lanes (like XXH3)
+        uint32_t hash(const uint32_t* key) const {
+            alignas(16) uint64_t acc[2];
+#ifdef VERTEX_WELDER_SSE2
+            __m128i lanes = _mm_load_si128(reinterpret_cast<const __m128i*>(WELD_SEED));
+            for (uint32_t b = 0; b < m_BlockCount; b++) {
+                const __m128i data    = _mm_load_si128(reinterpret_cast<const __m128i*>(key + b * 4));
+                const __m128i keyed   = _mm_xor_si128(data, _mm_load_si128(reinterpret_cast<const __m128i*>(WELD_SECRET + b * 4)));
+                const __m128i product = _mm_mul_epu32(keyed, _mm_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)));
+                lanes                 = _mm_add_epi64(lanes, _mm_add_epi64(product, _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2))));
+            }
+            _mm_store_si128(reinterpret_cast<__m128i*>(acc), lanes);
+#else
+            acc[0] = WELD_SEED[0];
+            acc[1] = WELD_SEED[1];
+            for (uint32_t b = 0; b < m_BlockCount; b++) {
+                const uint32_t* data = key + b * 4;
+                const uint32_t* s    = WELD_SECRET + b * 4;
+                acc[0] += uint64_t(data[0] ^ s[0]) * uint64_t(data[1] ^ s[1]) + (uint64_t(data[3]) << 32 | data[2]);
+                acc[1] += uint64_t(data[2] ^ s[2]) * uint64_t(data[3] ^ s[3]) + (uint64_t(data[1]) << 32 | data[0]);
+            }
+#endif
+            // Avalanche of the two lanes (MurmurHash3 finalizer)
+            uint64_t h = acc[0] ^ (acc[1] * 0x9e3779b97f4a7c15ULL);
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ULL;
+            h ^= h >> 33;
+            return uint32_t(h);
+        }
+
+        bool equal(const uint32_t* key, size_t vertex) const {
+            alignas(16) uint32_t other[WELD_MAX_FLOATS];
+            canonical(vertex, other);
+            return memcmp(key, other, m_BlockCount * 4 * sizeof(uint32_t)) == 0;
+        }
+
+    private:
+        const uint8_t* m_Vertices   = nullptr;
+        size_t         m_VertexSize = 0;
+        uint32_t       m_BlockCount = 0;
+        float          m_InvEpsilon = 0.0F;
+
+        alignas(16) uint32_t m_Mask[WELD_MAX_FLOATS];
+    };
+
+    // Slots for 1.5 times the vertices at least, so the probes stay short
+    void resetTable(std::vector<WeldSlot>& table, size_t vertex_count) {
+        table.assign(std::bit_ceil(std::max<size_t>(16, vertex_count + vertex_count / 2)), WeldSlot{});
+    }
+
+    // Returns the first vertex of the group of `vertex`, `vertex` itself when it is the first
+    uint32_t findOrInsert(std::vector<WeldSlot>& table, const WeldKeys& keys, const uint32_t* key, uint32_t hash, uint32_t vertex) {
+        const size_t mask = table.size() - 1;
+        for (size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+            WeldSlot& entry = table[slot];
+            if (entry.index == WELD_EMPTY_SLOT) {
+                entry = { hash, vertex };
+                return vertex;
+            }
+            if (entry.hash == hash && keys.equal(key, entry.index)) {
+                return entry.index;
+            }
+        }
+    }
+
+    uint32_t weldSerial(const WeldKeys& keys, size_t vertex_count, uint32_t* remap) {
+        std::vector<WeldSlot> table;
+        resetTable(table, vertex_count);
+
+        alignas(16) uint32_t key[WELD_MAX_FLOATS];
+        uint32_t             unique_count = 0;
+        for (uint32_t i = 0; i < vertex_count; i++) {
+            keys.canonical(i, key);
+            const uint32_t first = findOrInsert(table, keys, key, keys.hash(key), i);
+            remap[i]             = first == i ? unique_count++ : remap[first];
+        }
+        return unique_count;
+    }
+
+    uint32_t weldParallel(const WeldKeys& keys, size_t vertex_count, uint32_t* remap, uint32_t thread_count) {
+        // A few partitions per thread, for the balance
+        const uint32_t partition_count = std::min(256U, std::bit_ceil(thread_count * 4));
+        const uint32_t partition_shift = 32 - std::countr_zero(partition_count);
+
+        std::vector<uint32_t> hashes(vertex_count);
+        vk_test::parallel_batches<4096>(
+            vertex_count,
+            [&](uint64_t i) {
+                alignas(16) uint32_t key[WELD_MAX_FLOATS];
+                keys.canonical(i, key);
+                hashes[i] = keys.hash(key);
+            },
+            thread_count);
+
+        // Counting sort of the vertices by partition, each partition keeps the order of the vertices
+        std::vector<uint32_t> partition_start(partition_count + 1, 0);
+        for (uint32_t hash : hashes) {
+            partition_start[(hash >> partition_shift) + 1]++;
+        }
+        std::partial_sum(partition_start.begin(), partition_start.end(), partition_start.begin());
+
+        std::vector<uint32_t> order(vertex_count);
+        std::vector<uint32_t> cursor(partition_start.begin(), partition_start.end() - 1);
+        for (uint32_t i = 0; i < vertex_count; i++) {
+            order[cursor[hashes[i] >> partition_shift]++] = i;
+        }
+
+        // Each partition finds the first vertex of its groups, written in `remap`
+        std::vector<std::vector<WeldSlot>> tables(thread_count);
+        vk_test::parallel_batches_indexed<1>(
+            partition_count,
+            [&](uint64_t partition, uint32_t thread_index) {
+                std::vector<WeldSlot>& table = tables[thread_index];
+                resetTable(table, partition_start[partition + 1] - partition_start[partition]);
+
+                alignas(16) uint32_t key[WELD_MAX_FLOATS];
+                for (uint32_t j = partition_start[partition]; j < partition_start[partition + 1]; j++) {
+                    const uint32_t i = order[j];
+                    keys.canonical(i, key);
+                    remap[i] = findOrInsert(table, keys, key, hashes[i], i);
+                }
+            },
+            thread_count);
+
+        // The first vertex of a group comes before the others, its number is known when they are reached
+        uint32_t unique_count = 0;
+        for (uint32_t i = 0; i < vertex_count; i++) {
+            remap[i] = remap[i] == i ? unique_count++ : remap[remap[i]];
+        }
+        return unique_count;
+    }
+} // namespace
+
+uint32_t vk_test::weldVertices(const void* vertices, size_t vertex_count, size_t vertex_size, uint32_t* remap, const VertexWeldSettings& settings) {
+    assert(vertex_count < WELD_EMPTY_SLOT);
+
+    const WeldKeys keys(vertices, vertex_size, settings);
+    if (settings.threadCount <= 1 || vertex_count < WELD_PARALLEL_MIN_COUNT) {
+        return weldSerial(keys, vertex_count, remap);
+    }
+    return weldParallel(keys, vertex_count, remap, settings.threadCount);
+}
+
+void vk_test::compactWeldedVertices(const void* vertices, size_t vertex_count, size_t vertex_size, const uint32_t* remap, void* dst) {
+    const uint8_t* src          = static_cast<const uint8_t*>(vertices);
+    uint8_t*       out          = static_cast<uint8_t*>(dst);
+    uint32_t       unique_count = 0;
+    for (size_t i = 0; i < vertex_count; i++) {
+        if (remap[i] == unique_count) { // First of its group
+            memcpy(out + size_t(unique_count++) * vertex_size, src + i * vertex_size, vertex_size);
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+// Micro-benchmark
+//--------------------------------------------------------------------------------------------------
+namespace {
+    // removeDuplicateVertices before the welder, a std::unordered_map of the vertices
+    vk_test::PrimitiveMesh removeDuplicateVerticesReference(const vk_test::PrimitiveMesh& mesh) {
+        auto hash  = [](const vk_test::PrimitiveVertex& v) { return vk_test::hashVal(v.pos.x, v.pos.y, v.pos.z, v.nrm.x, v.nrm.y, v.nrm.z, v.tex.x, v.tex.y); };
+        auto equal = [](const vk_test::PrimitiveVertex& l, const vk_test::PrimitiveVertex& r) { return l.pos == r.pos && l.nrm == r.nrm && l.tex == r.tex; };
+        std::unordered_map<vk_test::PrimitiveVertex, uint32_t, decltype(hash), decltype(equal)> vertex_index_map(0, hash, equal);
+
+        vk_test::PrimitiveMesh result;
+        for (const auto& triangle : mesh.triangles) {
+            vk_test::PrimitiveTriangle unique_triangle = {};
+            for (int i = 0; i < 3; i++) {
+                const vk_test::PrimitiveVertex& vertex = mesh.vertices[triangle.indices[i]];
+
+                auto it = vertex_index_map.find(vertex);
+                if (it == vertex_index_map.end()) {
+                    const uint32_t new_index   = static_cast<uint32_t>(result.vertices.size());
+                    vertex_index_map[vertex]   = new_index;
+                    unique_triangle.indices[i] = new_index;
+                    result.vertices.push_back(vertex);
+                }
+                else {
+                    unique_triangle.indices[i] = it->second;
+                }
+            }
+            result.triangles.push_back(unique_triangle);
+        }
+        return result;
+    }
+
+    bool sameTriangles(const vk_test::PrimitiveMesh& a, const vk_test::PrimitiveMesh& b) {
+        return a.vertices.size() == b.vertices.size() && a.triangles.size() == b.triangles.size() &&
+               std::equal(a.triangles.begin(), a.triangles.end(), b.triangles.begin(), [](const auto& l, const auto& r) { return l.indices == r.indices; });
+    }
+} // namespace
+
+void vk_test::benchmarkVertexWelding() {
+    // Spheres merged at random places, then every triangle gets its own 3 vertices, like an OBJ: about 10M corners
+    PrimitiveMesh corners;
+    {
+        const std::vector<PrimitiveMesh> meshes = { createSphereUv(0.5F, 64, 32) };
+        const size_t                     count  = 10'000'000 / (meshes[0].triangles.size() * 3);
+
+        std::mt19937                          gen(1);
+        std::uniform_real_distribution<float> unit(-100.0F, 100.0F);
+        std::vector<Node>                     nodes(count);
+        for (Node& node : nodes) {
+            node.rotation    = glm::quat(1.0F, 0.0F, 0.0F, 0.0F);
+            node.translation = glm::vec3(unit(gen), unit(gen), unit(gen));
+            node.mesh        = 0;
+        }
+        const PrimitiveMesh merged = mergeNodes(nodes, meshes);
+
+        corners.vertices.reserve(merged.triangles.size() * 3);
+        corners.triangles.reserve(merged.triangles.size());
+        for (const PrimitiveTriangle& triangle : merged.triangles) {
+            const uint32_t first = static_cast<uint32_t>(corners.vertices.size());
+            for (int i = 0; i < 3; i++) {
+                corners.vertices.push_back(merged.vertices[triangle.indices[i]]);
+            }
+            corners.triangles.push_back({ glm::uvec3(first, first + 1, first + 2) });
+        }
+    }
+    VK_TEST_SAY("Vertex welding, " << corners.vertices.size() << " corners, " << getThreadPoolSize() << " threads");
+
+    PerformanceTimer    timer;
+    const PrimitiveMesh reference    = removeDuplicateVerticesReference(corners);
+    const double        reference_ms = timer.getMilliseconds();
+    VK_TEST_SAY("  std::unordered_map : " << reference.vertices.size() << " vertices, " << reference_ms << " ms");
+
+    timer.reset();
+    const PrimitiveMesh welded    = removeDuplicateVertices(corners);
+    const double        welded_ms = timer.getMilliseconds();
+    VK_TEST_SAY("  removeDuplicateVertices : " << welded.vertices.size() << " vertices, " << welded_ms << " ms, x" << reference_ms / welded_ms
+                                               << (sameTriangles(reference, welded) ? ", same triangles" : ", DIFFERENT triangles"));
+
+    // The welder alone, without the triangles around it
+    std::vector<uint32_t> remap(corners.vertices.size());
+    for (uint32_t threads : { 1U, std::max(2U, getThreadPoolSize()) }) {
+        VertexWeldSettings settings;
+        settings.threadCount = threads;
+        timer.reset();
+        const uint32_t unique_count = weldVertices(corners.vertices.data(), corners.vertices.size(), sizeof(PrimitiveVertex), remap.data(), settings);
+        VK_TEST_SAY("  weldVertices, " << threads << " threads : " << unique_count << " vertices, " << timer.getMilliseconds() << " ms");
+    }
+
+    VertexWeldSettings positions;
+    positions.compareMask = 0x7;
+    positions.epsilon     = 1e-4F;
+    positions.threadCount = getThreadPoolSize();
+    timer.reset();
+    const uint32_t position_count = weldVertices(corners.vertices.data(), corners.vertices.size(), sizeof(PrimitiveVertex), remap.data(), positions);
+    VK_TEST_SAY("  weldVertices, positions at 1e-4 : " << position_count << " vertices, " << timer.getMilliseconds() << " ms");
+}
+
+//--------------------------------------------------------------------------------------------------
+// Usage example
+//--------------------------------------------------------------------------------------------------
+[[maybe_unused]] static void usage_VertexWelder() {
+    std::vector<vk_test::PrimitiveVertex> corners; // 3 per triangle, ex. from an OBJ
+
+    // Same position and normal within 1e-5, the texture coordinates are not compared
+    vk_test::VertexWeldSettings settings;
+    settings.compareMask = 0x3F;
+    settings.epsilon     = 1e-5F;
+    settings.threadCount = vk_test::getThreadPoolSize();
+
+    std::vector<uint32_t> indices(corners.size());
+    const uint32_t        vertex_count = vk_test::weldVertices(corners.data(), corners.size(), sizeof(vk_test::PrimitiveVertex), indices.data(), settings);
+
+    std::vector<vk_test::PrimitiveVertex> vertices(vertex_count);
+    vk_test::compactWeldedVertices(corners.data(), corners.size(), sizeof(vk_test::PrimitiveVertex), indices.data(), vertices.data());
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+//-----------------------------------------------------------------
+// Welding of duplicated vertices, ex. the corners of an OBJ or of
+// merged meshes, into an index buffer over the unique ones.
+//
+// The vertices are made of 32-bit floats. Each one is first put in a
+// canonical form, 4 floats per SSE2 register: the floats left out of
+// the comparison are zeroed, the others are snapped to the `epsilon`
+// grid and -0 becomes +0. The hash is computed on these blocks, and
+// the vertices with the same hash are compared on them too.
+//
+// The table is open addressing with linear probing, a flat array of
+// (hash, first vertex) slots: no allocation per vertex, and a probe
+// only reads the vertex when the 32 bits of the hash match.
+//
+// With several threads, the hashes are computed in parallel and the
+// vertices are partitioned by the top bits of their hash; duplicates
+// always land in the same partition, so each one is welded alone. A
+// last pass numbers the groups in the order of their first vertex, so
+// the result does not depend on the thread count.
+//
+// Usage:
+//      see usage_VertexWelder in vertex_welder.cpp
+//-----------------------------------------------------------------
+
+namespace vk_test {
+
+    struct VertexWeldSettings {
+        uint32_t compareMask = ~0U;  // Bit i compares the float i of the vertex, the others are ignored (ex. the normals)
+        float    epsilon     = 0.0F; // Grid the floats are snapped to before the comparison, 0 compares them exactly
+        uint32_t threadCount = 1;    // More than 1 welds partitions of the vertices in parallel
+    };
+
+    // Fills `remap` with the index of each vertex (`vertex_size` bytes, 32 floats at most) among the unique ones,
+    // numbered in the order of their first occurrence. Returns the number of unique vertices.
+    uint32_t weldVertices(const void* vertices, size_t vertex_count, size_t vertex_size, uint32_t* remap, const VertexWeldSettings& settings = {});
+
+    // Copies the first vertex of each group of `remap` to `dst`, which holds the unique vertices.
+    // With an epsilon, the kept vertex is the first one as it is, not snapped.
+    void compactWeldedVertices(const void* vertices, size_t vertex_count, size_t vertex_size, const uint32_t* remap, void* dst);
+
+    // Timings of removeDuplicateVertices() against the std::unordered_map it replaces, printed with VK_TEST_SAY (main --micro-benchmark welding)
+    void benchmarkVertexWelding();
+
+} // namespace vk_test
@@ -0,0 +1,431 @@
+/*
+ * Copyright (c) 2024-2025, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2024-2025, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+* Modified by Farrakh
+* 2025
+*/
+
+#include "pch.h"
+#include "gltf_cache.hpp"
+#include "file_mapping.hpp"
+#include "file_operations.hpp"
+#include "hash_operations.hpp"
+#include "timers.hpp"
+
+namespace {
+
+    constexpr uint32_t GLTF_CACHE_MAGIC     = 0x43475456; // "VTGC"
+    constexpr uint32_t GLTF_CACHE_VERSION   = 7;          // Increment when the layout below changes
+    constexpr uint64_t GLTF_CACHE_ALIGNMENT = 16;         // Alignment of every section in the file
+
+    // File layout :
+    //   GltfCacheHeader
+    //   GltfCacheDependency[dependency_count] + names
+    //   GltfMesh[mesh_count] (gltfBuffer is null) + uint32_t[mesh_count] local buffer index + Bbox[mesh_count]
+    //   GltfInstance[instance_count] (meshIndex is local)
+    //   GltfMetallicRoughness[material_count]
+    //   GltfCacheBlob[buffer_count] + raw buffer data, or the buffers rewritten by importGltfData (quantize_vertices, build_meshlets, build_lods)
+    //   (the data is stored after optimizeGltfMeshes() with optimize_meshes)
+    struct GltfCacheHeader {
+        uint32_t magic                = 0;
+        uint32_t version              = 0;
+        uint64_t file_size            = 0;
+        uint32_t mesh_struct_size     = 0;
+        uint32_t instance_struct_size = 0;
+        uint32_t material_struct_size = 0;
+        uint32_t import_instance      = 0;
+        uint32_t dependency_count     = 0;
+        uint32_t mesh_count           = 0;
+        uint32_t instance_count       = 0;
+        uint32_t material_count       = 0;
+        uint32_t buffer_count         = 0;
+        uint32_t quantize_vertices    = 0;
+        uint32_t optimize_meshes      = 0;
+        uint32_t build_meshlets       = 0;
+        uint32_t build_lods           = 0;
+        uint64_t dependencies_offset  = 0;
+        uint64_t names_offset         = 0;
+        uint64_t names_size           = 0;
+        uint64_t meshes_offset        = 0;
+        uint64_t mesh_buffers_offset  = 0;
+        uint64_t mesh_bounds_offset   = 0;
+        uint64_t instances_offset     = 0;
+        uint64_t materials_offset     = 0;
+        uint64_t buffers_offset       = 0;
+    };
+
+    // A file the cache was built from, its name is relative to the source directory
+    struct GltfCacheDependency {
+        uint64_t file_size    = 0;
+        int64_t  write_time   = 0;
+        uint64_t content_hash = 0;
+        uint32_t name_offset  = 0;
+        uint32_t name_size    = 0;
+    };
+
+    struct GltfCacheBlob {
+        uint64_t offset = 0;
+        uint64_t size   = 0;
+    };
+
+    static_assert(std::is_trivially_copyable_v<vk_test::Bbox>, "Bbox is stored as is");
+
+    uint64_t alignUp(uint64_t value) {
+        return (value + GLTF_CACHE_ALIGNMENT - 1) & ~(GLTF_CACHE_ALIGNMENT - 1);
+    }
+
+    bool getFileStamp(const std::filesystem::path& file_path, uint64_t& file_size, int64_t& write_time) {
+        std::error_code ec;
+        file_size = std::filesystem::file_size(file_path, ec);
+        if (ec) {
+            return false;
+        }
+        write_time = std::filesystem::last_write_time(file_path, ec).time_since_epoch().count();
+        return !ec;
+    }
+
+    uint64_t hashFile(const std::filesystem::path& file_path) {
+        vk_test::FileReadMapping mapping;
+        if (!mapping.open(file_path)) {
+            return 0;
+        }
+        return vk_test::hashData(mapping.data(), mapping.size());
+    }
+
+    // The source itself and all external buffers, data URIs and GLB chunks are part of the source
+    std::vector<std::string> collectDependencies(const std::filesystem::path& source_path, const tinygltf::Model& model) {
+        std::vector<std::string> names{ vk_test::utf8FromPath(source_path.filename()) };
+        for (const tinygltf::Buffer& buffer : model.buffers) {
+            if (!buffer.uri.empty() && buffer.uri.rfind("data:", 0) != 0) {
+                names.push_back(buffer.uri);
+            }
+        }
+        return names;
+    }
+
+    // Size and time stamp must match, or if only the time stamp changed, the content hash
+    bool isDependencyValid(const std::filesystem::path& file_path, const GltfCacheDependency& dependency) {
+        uint64_t file_size  = 0;
+        int64_t  write_time = 0;
+        if (!getFileStamp(file_path, file_size, write_time) || file_size != dependency.file_size) {
+            return false;
+        }
+        if (write_time == dependency.write_time) {
+            return true;
+        }
+        return hashFile(file_path) == dependency.content_hash;
+    }
+
+} // namespace
+
+namespace vk_test {
+
+    std::filesystem::path getGltfCachePath(const std::filesystem::path& source_path) {
+        std::filesystem::path cache_path = source_path;
+        cache_path += ".vkcache";
+        return cache_path;
+    }
+
+    bool loadGltfSceneCache(GltfSceneResource&           scene_resource,
+                            const std::filesystem::path& cache_path,
+                            const std::filesystem::path& source_path,
+                            StagingUploader&             staging_uploader,
+                            const GltfImportSettings&    settings /*= {}*/) {
+        FileReadMapping mapping;
+        if (!mapping.open(cache_path) || mapping.size() < sizeof(GltfCacheHeader)) {
+            return false;
+        }
+
+        const uint8_t*  base = mapping.data();
+        GltfCacheHeader header;
+        memcpy(&header, base, sizeof(GltfCacheHeader));
+
+        if (header.magic != GLTF_CACHE_MAGIC || header.version != GLTF_CACHE_VERSION || header.file_size != mapping.size() ||
+            header.mesh_struct_size != sizeof(shaderio::GltfMesh) || header.instance_struct_size != sizeof(shaderio::GltfInstance) ||
+            header.material_struct_size != sizeof(shaderio::GltfMetallicRoughness) || header.import_instance != uint32_t(settings.import_instance) ||
+            header.quantize_vertices != uint32_t(settings.quantize_vertices) || header.optimize_meshes != uint32_t(settings.optimize_meshes) ||
+            header.build_meshlets != uint32_t(settings.build_meshlets) || header.build_lods != uint32_t(settings.build_lods)) {
+            return false;
+        }
+
+        // Every section must be inside the file
+        auto in_range = [&](uint64_t offset, uint64_t size) { return offset <= mapping.size() && size <= mapping.size() - offset; };
+        if (!in_range(header.dependencies_offset, uint64_t(header.dependency_count) * sizeof(GltfCacheDependency)) ||
+            !in_range(header.names_offset, header.names_size) ||
+            !in_range(header.meshes_offset, uint64_t(header.mesh_count) * sizeof(shaderio::GltfMesh)) ||
+            !in_range(header.mesh_buffers_offset, uint64_t(header.mesh_count) * sizeof(uint32_t)) ||
+            !in_range(header.mesh_bounds_offset, uint64_t(header.mesh_count) * sizeof(Bbox)) ||
+            !in_range(header.instances_offset, uint64_t(header.instance_count) * sizeof(shaderio::GltfInstance)) ||
+            !in_range(header.materials_offset, uint64_t(header.material_count) * sizeof(shaderio::GltfMetallicRoughness)) ||
+            !in_range(header.buffers_offset, uint64_t(header.buffer_count) * sizeof(GltfCacheBlob))) {
+            VK_TEST_SAY("Corrupted glTF cache : " << utf8FromPath(cache_path).c_str());
+            return false;
+        }
+
+        // Invalidate when one of the source files changed
+        const std::filesystem::path source_directory = source_path.parent_path();
+        for (uint32_t i = 0; i < header.dependency_count; ++i) {
+            GltfCacheDependency dependency;
+            memcpy(&dependency, base + header.dependencies_offset + i * sizeof(GltfCacheDependency), sizeof(GltfCacheDependency));
+            if (uint64_t(dependency.name_offset) + dependency.name_size > header.names_size) {
+                return false;
+            }
+            const std::string name(reinterpret_cast<const char*>(base + header.names_offset + dependency.name_offset), dependency.name_size);
+            if (!isDependencyValid(source_directory / pathFromUtf8(name), dependency)) {
+                return false;
+            }
+        }
+
+        std::vector<GltfCacheBlob> blobs(header.buffer_count);
+        memcpy(blobs.data(), base + header.buffers_offset, blobs.size() * sizeof(GltfCacheBlob));
+        for (const GltfCacheBlob& blob : blobs) {
+            if (!in_range(blob.offset, blob.size)) {
+                VK_TEST_SAY("Corrupted glTF cache : " << utf8FromPath(cache_path).c_str());
+                return false;
+            }
+        }
+
+        std::vector<uint32_t> mesh_buffers(header.mesh_count);
+        memcpy(mesh_buffers.data(), base + header.mesh_buffers_offset, mesh_buffers.size() * sizeof(uint32_t));
+        for (uint32_t buffer_index : mesh_buffers) {
+            if (buffer_index >= header.buffer_count) {
+                return false;
+            }
+        }
+
+        SCOPED_TIMER("Load glTF cache");
+
+        const uint32_t mesh_offset   = uint32_t(scene_resource.meshes.size());
+        const uint32_t buffer_offset = uint32_t(scene_resource.b_gltf_datas.size());
+
+        // The raw buffers go straight from the mapping to the staging memory
+        ResourceAllocator* allocator = staging_uploader.getResourceAllocator();
+        for (const GltfCacheBlob& blob : blobs) {
+            Buffer b_gltf_data;
+            allocator->createBuffer(b_gltf_data, std::max<size_t>(blob.size, 4), // A buffer without triangles has no quantized data
+                                    VK_BUFFER_USAGE_2_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_2_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_2_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_2_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR); // #RT
+            if (blob.size != 0) {
+                staging_uploader.appendBuffer(b_gltf_data, 0, blob.size, base + blob.offset);
+            }
+            scene_resource.b_gltf_datas.push_back(b_gltf_data);
+        }
+
+        scene_resource.meshes.resize(mesh_offset + header.mesh_count);
+        memcpy(scene_resource.meshes.data() + mesh_offset, base + header.meshes_offset, header.mesh_count * sizeof(shaderio::GltfMesh));
+        for (uint32_t i = 0; i < header.mesh_count; ++i) {
+            const uint32_t buffer_index                       = buffer_offset + mesh_buffers[i];
+            scene_resource.meshes[mesh_offset + i].gltfBuffer = (uint8_t*) scene_resource.b_gltf_datas[buffer_index].address;
+            scene_resource.mesh_to_buffer_index.push_back(buffer_index);
+        }
+        scene_resource.mesh_bounds.resize(mesh_offset + header.mesh_count);
+        memcpy(scene_resource.mesh_bounds.data() + mesh_offset, base + header.mesh_bounds_offset, header.mesh_count * sizeof(Bbox));
+
+        const size_t instance_offset = scene_resource.instances.size();
+        scene_resource.instances.resize(instance_offset + header.instance_count);
+        memcpy(scene_resource.instances.data() + instance_offset, base + header.instances_offset, header.instance_count * sizeof(shaderio::GltfInstance));
+        const size_t material_offset = scene_resource.materials.size();
+        for (size_t i = instance_offset; i < scene_resource.instances.size(); ++i) {
+            scene_resource.instances[i].meshIndex += mesh_offset;
+            scene_resource.instances[i].materialIndex += uint32_t(material_offset);
+        }
+
+        scene_resource.materials.resize(material_offset + header.material_count);
+        memcpy(scene_resource.materials.data() + material_offset, base + header.materials_offset, header.material_count * sizeof(shaderio::GltfMetallicRoughness));
+
+        updateInstanceBounds(scene_resource);
+        return true;
+    }
+
+    bool saveGltfSceneCache(const std::filesystem::path&          cache_path,
+                            const std::filesystem::path&          source_path,
+                            const tinygltf::Model&                model,
+                            const GltfSceneResource&              scene_resource,
+                            uint32_t                              mesh_offset,
+                            uint32_t                              instance_offset,
+                            uint32_t                              material_offset,
+                            uint32_t                              buffer_offset,
+                            const GltfImportSettings&             settings /*= {}*/,
+                            std::span<const std::vector<uint8_t>> rewritten_buffers /*= {}*/) {
+        SCOPED_TIMER("Save glTF cache");
+
+        assert(scene_resource.b_gltf_datas.size() - buffer_offset == model.buffers.size() && "Resource doesn't match the model");
+        assert((rewritten_buffers.empty() || rewritten_buffers.size() == model.buffers.size()) && "Resource doesn't match the model");
+
+        // What was uploaded, the glTF buffers or their quantized streams
+        std::vector<std::span<const uint8_t>> buffer_datas(model.buffers.size());
+        for (size_t i = 0; i < model.buffers.size(); ++i) {
+            buffer_datas[i] = rewritten_buffers.empty() ? std::span<const uint8_t>(model.buffers[i].data) : std::span<const uint8_t>(rewritten_buffers[i]);
+        }
+
+        // Dependencies and their names
+        const std::filesystem::path      source_directory = source_path.parent_path();
+        const std::vector<std::string>   names            = collectDependencies(source_path, model);
+        std::vector<GltfCacheDependency> dependencies(names.size());
+        std::string                      names_data;
+        for (size_t i = 0; i < names.size(); ++i) {
+            const std::filesystem::path file_path = source_directory / pathFromUtf8(names[i]);
+            if (!getFileStamp(file_path, dependencies[i].file_size, dependencies[i].write_time)) {
+                VK_TEST_SAY("Cannot create glTF cache, missing file : " << utf8FromPath(file_path).c_str());
+                return false;
+            }
+            dependencies[i].content_hash = hashFile(file_path);
+            dependencies[i].name_offset  = uint32_t(names_data.size());
+            dependencies[i].name_size    = uint32_t(names[i].size());
+            names_data += names[i];
+        }
+
+        // Local copies, with indices relative to this scene
+        std::vector<shaderio::GltfMesh> meshes(scene_resource.meshes.begin() + mesh_offset, scene_resource.meshes.end());
+        std::vector<uint32_t>           mesh_buffers(meshes.size());
+        for (size_t i = 0; i < meshes.size(); ++i) {
+            meshes[i].gltfBuffer = nullptr;
+            mesh_buffers[i]      = scene_resource.mesh_to_buffer_index[mesh_offset + i] - buffer_offset;
+        }
+        const std::span<const Bbox>         mesh_bounds(scene_resource.mesh_bounds.data() + mesh_offset, meshes.size());
+        std::vector<shaderio::GltfInstance> instances(scene_resource.instances.begin() + instance_offset, scene_resource.instances.end());
+        for (shaderio::GltfInstance& instance : instances) {
+            instance.meshIndex -= mesh_offset;
+            instance.materialIndex -= material_offset;
+        }
+        const std::span<const shaderio::GltfMetallicRoughness> materials(scene_resource.materials.data() + material_offset,
+                                                                         scene_resource.materials.size() - material_offset);
+
+        // Layout
+        GltfCacheHeader header{
+            .magic                = GLTF_CACHE_MAGIC,
+            .version              = GLTF_CACHE_VERSION,
+            .mesh_struct_size     = uint32_t(sizeof(shaderio::GltfMesh)),
+            .instance_struct_size = uint32_t(sizeof(shaderio::GltfInstance)),
+            .material_struct_size = uint32_t(sizeof(shaderio::GltfMetallicRoughness)),
+            .import_instance      = uint32_t(settings.import_instance),
+            .quantize_vertices    = uint32_t(settings.quantize_vertices),
+            .optimize_meshes      = uint32_t(settings.optimize_meshes),
+            .build_meshlets       = uint32_t(settings.build_meshlets),
+            .build_lods           = uint32_t(settings.build_lods),
+            .dependency_count     = uint32_t(dependencies.size()),
+            .mesh_count           = uint32_t(meshes.size()),
+            .instance_count       = uint32_t(instances.size()),
+            .material_count       = uint32_t(materials.size()),
+            .buffer_count         = uint32_t(model.buffers.size()),
+        };
+
+        uint64_t offset            = alignUp(sizeof(GltfCacheHeader));
+        header.dependencies_offset = offset;
+        offset                     = alignUp(offset + std::span(dependencies).size_bytes());
+        header.names_offset        = offset;
+        header.names_size          = names_data.size();
+        offset                     = alignUp(offset + names_data.size());
+        header.meshes_offset       = offset;
+        offset                     = alignUp(offset + std::span(meshes).size_bytes());
+        header.mesh_buffers_offset = offset;
+        offset                     = alignUp(offset + std::span(mesh_buffers).size_bytes());
+        header.mesh_bounds_offset  = offset;
+        offset                     = alignUp(offset + mesh_bounds.size_bytes());
+        header.instances_offset    = offset;
+        offset                     = alignUp(offset + std::span(instances).size_bytes());
+        header.materials_offset    = offset;
+        offset                     = alignUp(offset + materials.size_bytes());
+        header.buffers_offset      = offset;
+        offset                     = alignUp(offset + model.buffers.size() * sizeof(GltfCacheBlob));
+
+        std::vector<GltfCacheBlob> blobs(model.buffers.size());
+        for (size_t i = 0; i < model.buffers.size(); ++i) {
+            blobs[i] = { .offset = offset, .size = buffer_datas[i].size() };
+            offset   = alignUp(offset + blobs[i].size);
+        }
+        header.file_size = offset;
+
+        // Write to a temporary file first, so a crash never leaves a truncated cache behind
+        std::filesystem::path temp_path = cache_path;
+        temp_path += ".tmp";
+        {
+            std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+            if (!file) {
+                VK_TEST_SAY("Failed to open file for writing : " << utf8FromPath(temp_path).c_str());
+                return false;
+            }
+
+            auto write_at = [&](uint64_t at, const void* data, size_t size) {
+                const uint64_t current = uint64_t(file.tellp());
+                assert(at >= current && at - current <= GLTF_CACHE_ALIGNMENT);
+                static constexpr char zeros[GLTF_CACHE_ALIGNMENT]{};
+                file.write(zeros, std::streamsize(at - current));
+                if (size > 0) {
+                    file.write(static_cast<const char*>(data), std::streamsize(size));
+                }
+            };
+
+            write_at(0, &header, sizeof(GltfCacheHeader));
+            write_at(header.dependencies_offset, dependencies.data(), std::span(dependencies).size_bytes());
+            write_at(header.names_offset, names_data.data(), names_data.size());
+            write_at(header.meshes_offset, meshes.data(), std::span(meshes).size_bytes());
+            write_at(header.mesh_buffers_offset, mesh_buffers.data(), std::span(mesh_buffers).size_bytes());
+            write_at(header.mesh_bounds_offset, mesh_bounds.data(), mesh_bounds.size_bytes());
+            write_at(header.instances_offset, instances.data(), std::span(instances).size_bytes());
+            write_at(header.materials_offset, materials.data(), materials.size_bytes());
+            write_at(header.buffers_offset, blobs.data(), std::span(blobs).size_bytes());
+            for (size_t i = 0; i < blobs.size(); ++i) {
+                write_at(blobs[i].offset, buffer_datas[i].data(), blobs[i].size);
+            }
+            write_at(header.file_size, nullptr, 0);
+
+            if (!file) {
+                VK_TEST_SAY("Error writing file : " << utf8FromPath(temp_path).c_str());
+                return false;
+            }
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(temp_path, cache_path, ec);
+        if (ec) {
+            VK_TEST_SAY("Failed to write glTF cache : " << utf8FromPath(cache_path).c_str() << " : " << ec.message().c_str());
+            std::filesystem::remove(temp_path, ec);
+            return false;
+        }
+        return true;
+    }
+
+    void importGltfCached(GltfSceneResource&           scene_resource,
+                          const std::filesystem::path& source_path,
+                          StagingUploader&             staging_uploader,
+                          const GltfImportSettings&    settings /*= {}*/) {
+        SCOPED_TIMER(__FUNCTION__);
+
+        const std::filesystem::path cache_path = getGltfCachePath(source_path);
+        if (loadGltfSceneCache(scene_resource, cache_path, source_path, staging_uploader, settings)) {
+            return;
+        }
+
+        const uint32_t mesh_offset     = uint32_t(scene_resource.meshes.size());
+        const uint32_t instance_offset = uint32_t(scene_resource.instances.size());
+        const uint32_t material_offset = uint32_t(scene_resource.materials.size());
+        const uint32_t buffer_offset   = uint32_t(scene_resource.b_gltf_datas.size());
+
+        tinygltf::Model model = loadGltfResources(source_path);
+        if (settings.optimize_meshes) {
+            optimizeGltfMeshes(model);
+        }
+
+        std::vector<std::vector<uint8_t>> rewritten_buffers;
+        importGltfData(scene_resource, model, staging_uploader, settings, &rewritten_buffers);
+        saveGltfSceneCache(cache_path, source_path, model, scene_resource, mesh_offset, instance_offset, material_offset, buffer_offset, settings, rewritten_buffers);
+    }
+
+} // namespace vk_test
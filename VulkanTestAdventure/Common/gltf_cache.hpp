@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024-2025, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2024-2025, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+* Modified by Farrakh
+* 2025
+*/
+
+#pragma once
+
+#include "gltf_utils.hpp"
+
+//-----------------------------------------------------------------
+// Binary cache of an imported glTF scene.
+//
+// The cache stores what `importGltfData` produces (GltfMesh, mesh bounds, GltfInstance,
+// GltfMetallicRoughness and the raw glTF buffers) in a single file that is
+// memory mapped on load. The raw buffers are handed directly from the mapping
+// to the StagingUploader, so no JSON/base64 parsing nor intermediate copy happens.
+//
+// The cache is invalidated when:
+//  - the file format version or the shaderio struct sizes change
+//  - the source file or one of its external buffers (.bin) changes,
+//    checked by size and time stamp first, then by content hash
+//  - it was created with different GltfImportSettings
+//
+// Usage:
+//      importGltfCached(scene_resource, findFile("teapot.gltf", { PATH.getResourcesPath() }), staging_uploader);
+//-----------------------------------------------------------------
+
+namespace vk_test {
+
+    // Default cache file for a glTF source, next to it : "teapot.gltf" -> "teapot.gltf.vkcache"
+    std::filesystem::path getGltfCachePath(const std::filesystem::path& source_path);
+
+    // Appends the cached scene to `scene_resource` and its buffers to `staging_uploader`.
+    // Returns false, without modifying anything, if the cache is missing, corrupted or out of date.
+    bool loadGltfSceneCache(GltfSceneResource&           scene_resource,
+                            const std::filesystem::path& cache_path,
+                            const std::filesystem::path& source_path,
+                            StagingUploader&             staging_uploader,
+                            const GltfImportSettings&    settings = {});
+
+    // Writes the part of `scene_resource` that was appended by `importGltfData(scene_resource, model, ...)`.
+    // The `*_offset` values are the sizes of the scene resource arrays before that import.
+    // `rewritten_buffers` are the buffers returned by that import, stored instead of the glTF buffers when not empty.
+    bool saveGltfSceneCache(const std::filesystem::path&          cache_path,
+                            const std::filesystem::path&          source_path,
+                            const tinygltf::Model&                model,
+                            const GltfSceneResource&              scene_resource,
+                            uint32_t                              mesh_offset,
+                            uint32_t                              instance_offset,
+                            uint32_t                              material_offset,
+                            uint32_t                              buffer_offset,
+                            const GltfImportSettings&             settings          = {},
+                            std::span<const std::vector<uint8_t>> rewritten_buffers = {});
+
+    // Loads from the cache when valid, otherwise loads the glTF, imports it and writes the cache.
+    // With `optimize_meshes`, the model goes through optimizeGltfMeshes() before the import.
+    void importGltfCached(GltfSceneResource&           scene_resource,
+                          const std::filesystem::path& source_path,
+                          StagingUploader&             staging_uploader,
+                          const GltfImportSettings&    settings = {});
+
+} // namespace vk_test
@@ -24,17 +24,405 @@
 
 #include "pch.h"
 #include "gltf_utils.hpp"
+#include "timers.hpp"
+#include "parallel_work.hpp"
+#include "meshlets.hpp"
+#include "mesh_simplifier.hpp"
 
 #define TINYGLTF_IMPLEMENTATION
 #define STB_IMAGE_IMPLEMENTATION
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #include "tiny_gltf.h"
 
+namespace {
+    // Bytes per vertex of the quantized streams, see shaderio::GltfVertexFormat
+    constexpr uint32_t QUANTIZED_POSITION_STRIDE = 8; // snorm16 x, y, z and 0, read as R16G16B16A16_SNORM by the BLAS build
+    constexpr uint32_t QUANTIZED_VECTOR_STRIDE   = 4; // Octahedral normal or tangent, half texture coordinates, unorm8 color
+    constexpr uint32_t QUANTIZED_ALIGNMENT       = 16;
+
+    uint32_t alignUp(uint32_t value) {
+        return (value + QUANTIZED_ALIGNMENT - 1) & ~(QUANTIZED_ALIGNMENT - 1);
+    }
+
+    template <typename T>
+    T readAttribute(const tinygltf::Buffer& buffer, const shaderio::BufferView& view, uint32_t index) {
+        T value;
+        memcpy(&value, buffer.data.data() + view.offset + size_t(index) * view.byteStride, sizeof(T));
+        return value;
+    }
+
+    // Layout of a glTF vertex stream, TINYGLTF_TYPE_* of TINYGLTF_COMPONENT_TYPE_*
+    struct AttributeFormat {
+        int type           = TINYGLTF_TYPE_VEC4;
+        int component_type = TINYGLTF_COMPONENT_TYPE_FLOAT;
+    };
+
+    // The streams quantizeMesh converts from the layout of the glTF, the others are floats of the type the shaders read
+    struct MeshAttributeFormats {
+        AttributeFormat colors{ .type = TINYGLTF_TYPE_VEC4 };     // VEC3 or VEC4
+        AttributeFormat tex_coords{ .type = TINYGLTF_TYPE_VEC2 }; // VEC2
+    };
+
+    // Float or normalized unsigned byte or short components, `fill` gives the ones missing in `format`
+    glm::vec4 readNormalized(const tinygltf::Buffer& buffer, const shaderio::BufferView& view, uint32_t index, const AttributeFormat& format, glm::vec4 fill) {
+        const uint8_t* data            = buffer.data.data() + view.offset + size_t(index) * view.byteStride;
+        const int      component_count = std::min(tinygltf::GetNumComponentsInType(uint32_t(format.type)), 4);
+        for (int c = 0; c < component_count; c++) {
+            switch (format.component_type) {
+            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+                fill[c] = float(data[c]) / 255.0F;
+                break;
+            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT: {
+                uint16_t value;
+                memcpy(&value, data + c * sizeof(uint16_t), sizeof(value));
+                fill[c] = float(value) / 65535.0F;
+                break;
+            }
+            default:
+                memcpy(&fill[c], data + c * sizeof(float), sizeof(float));
+                break;
+            }
+        }
+        return fill;
+    }
+
+    // Unit vector to the [-1, 1] square, the lower hemisphere folded on the corners
+    glm::vec2 octahedralEncode(glm::vec3 n) {
+        n /= std::max(std::abs(n.x) + std::abs(n.y) + std::abs(n.z), 1e-20F);
+        glm::vec2 p(n.x, n.y);
+        if (n.z < 0.0F) {
+            const glm::vec2 sign(p.x >= 0.0F ? 1.0F : -1.0F, p.y >= 0.0F ? 1.0F : -1.0F);
+            p = (1.0F - glm::abs(glm::vec2(p.y, p.x))) * sign;
+        }
+        return p;
+    }
+
+    // Writes the quantized streams of one mesh at `offset` in `data`, the views of `mesh` are rewritten to match.
+    // Returns the bytes used, nothing is written when `data` is null (to compute the layout).
+    uint32_t quantizeMesh(shaderio::GltfMesh& mesh, const MeshAttributeFormats& formats, const tinygltf::Buffer& buffer, uint32_t offset, uint8_t* data) {
+        shaderio::TriangleMesh& tri_mesh     = mesh.triMesh;
+        const uint32_t          vertex_count = tri_mesh.positions.count;
+        const uint32_t          start        = offset;
+
+        auto place = [&](shaderio::BufferView& view, uint32_t stride) -> uint8_t* {
+            view.offset     = offset;
+            view.byteStride = stride;
+            offset          = alignUp(offset + view.count * stride);
+            return data != nullptr ? data + view.offset : nullptr;
+        };
+
+        // Indices are copied as they are, the whole mesh lives in one buffer
+        const shaderio::BufferView source_indices = tri_mesh.indices;
+        if (uint8_t* indices = place(tri_mesh.indices, source_indices.byteStride)) {
+            memcpy(indices, buffer.data.data() + source_indices.offset, size_t(source_indices.count) * source_indices.byteStride);
+        }
+
+        // Positions relative to the bounds of the vertices
+        const shaderio::BufferView source_positions = tri_mesh.positions;
+        if (data != nullptr) {
+            glm::vec3 min(std::numeric_limits<float>::max());
+            glm::vec3 max(-std::numeric_limits<float>::max());
+            for (uint32_t v = 0; v < vertex_count; v++) {
+                const glm::vec3 position = readAttribute<glm::vec3>(buffer, source_positions, v);
+                min                      = glm::min(min, position);
+                max                      = glm::max(max, position);
+            }
+            mesh.positionCenter     = (min + max) * 0.5F;
+            mesh.positionHalfExtent = glm::max((max - min) * 0.5F, glm::vec3(1e-20F)); // Flat meshes
+        }
+        if (uint8_t* positions = place(tri_mesh.positions, QUANTIZED_POSITION_STRIDE)) {
+            for (uint32_t v = 0; v < vertex_count; v++) {
+                const glm::vec3 position = (readAttribute<glm::vec3>(buffer, source_positions, v) - mesh.positionCenter) / mesh.positionHalfExtent;
+                const uint32_t  packed[2] = { glm::packSnorm2x16(glm::vec2(position.x, position.y)), glm::packSnorm2x16(glm::vec2(position.z, 0.0F)) };
+                memcpy(positions + size_t(v) * QUANTIZED_POSITION_STRIDE, packed, sizeof(packed));
+            }
+        }
+
+        // Missing attributes keep their empty view
+        auto quantize_attribute = [&](shaderio::BufferView& view, auto&& encode) {
+            if (view.count == 0) {
+                return;
+            }
+            const shaderio::BufferView source = view;
+            if (uint8_t* target = place(view, QUANTIZED_VECTOR_STRIDE)) {
+                for (uint32_t v = 0; v < view.count; v++) {
+                    const uint32_t packed = encode(buffer, source, v);
+                    memcpy(target + size_t(v) * QUANTIZED_VECTOR_STRIDE, &packed, sizeof(packed));
+                }
+            }
+        };
+
+        quantize_attribute(tri_mesh.normals, [](const tinygltf::Buffer& b, const shaderio::BufferView& view, uint32_t v) {
+            return glm::packSnorm2x16(octahedralEncode(readAttribute<glm::vec3>(b, view, v)));
+        });
+        // Colors without alpha are opaque
+        quantize_attribute(tri_mesh.colorVert, [&](const tinygltf::Buffer& b, const shaderio::BufferView& view, uint32_t v) {
+            return glm::packUnorm4x8(readNormalized(b, view, v, formats.colors, glm::vec4(1.0F)));
+        });
+        quantize_attribute(tri_mesh.texCoords, [&](const tinygltf::Buffer& b, const shaderio::BufferView& view, uint32_t v) {
+            return glm::packHalf2x16(glm::vec2(readNormalized(b, view, v, formats.tex_coords, glm::vec4(0.0F))));
+        });
+        // The sign of the bitangent takes the lowest bit of y
+        quantize_attribute(tri_mesh.tangents, [](const tinygltf::Buffer& b, const shaderio::BufferView& view, uint32_t v) {
+            const glm::vec4 tangent = readAttribute<glm::vec4>(b, view, v);
+            return (glm::packSnorm2x16(octahedralEncode(glm::vec3(tangent))) & ~0x10000U) | (tangent.w < 0.0F ? 0x10000U : 0U);
+        });
+
+        mesh.vertexFormat = shaderio::eVertexQuantized;
+        return offset - start;
+    }
+
+    // One buffer per glTF buffer, holding the indices and quantized streams of the meshes using it.
+    // `mesh_buffers` are the indices of the glTF buffers of `meshes`, `mesh_formats` the layouts of their converted streams.
+    std::vector<std::vector<uint8_t>> quantizeMeshes(std::span<shaderio::GltfMesh>         meshes,
+                                                     std::span<const uint32_t>             mesh_buffers,
+                                                     std::span<const MeshAttributeFormats> mesh_formats,
+                                                     const std::vector<tinygltf::Buffer>&  buffers) {
+        SCOPED_TIMER(__FUNCTION__);
+
+        // Layout first, the meshes are then written in parallel
+        std::vector<uint32_t> buffer_sizes(buffers.size(), 0);
+        std::vector<uint32_t> mesh_offsets(meshes.size());
+        for (size_t i = 0; i < meshes.size(); i++) {
+            shaderio::GltfMesh layout_mesh = meshes[i];
+            mesh_offsets[i]                = buffer_sizes[mesh_buffers[i]];
+            buffer_sizes[mesh_buffers[i]] += quantizeMesh(layout_mesh, mesh_formats[i], buffers[mesh_buffers[i]], 0, nullptr);
+        }
+
+        std::vector<std::vector<uint8_t>> quantized(buffers.size());
+        for (size_t b = 0; b < buffers.size(); b++) {
+            quantized[b].resize(buffer_sizes[b]);
+        }
+
+        vk_test::parallel_batches<4>(meshes.size(), [&](uint64_t i) {
+            const uint32_t buffer_index = mesh_buffers[i];
+            quantizeMesh(meshes[i], mesh_formats[i], buffers[buffer_index], mesh_offsets[i], quantized[buffer_index].data());
+        });
+        return quantized;
+    }
+
+    // Reorders the triangles of a primitive in place, and its vertices with `remap_vertices`.
+    // Returns false when its indices or positions are not in a form that can be rewritten.
+    bool optimizePrimitive(tinygltf::Model& model, const tinygltf::Primitive& primitive, bool remap_vertices, vk_test::VertexCacheStats& stats_before, vk_test::VertexCacheStats& stats_after) {
+        const auto position = primitive.attributes.find("POSITION");
+        if (position == primitive.attributes.end()) {
+            return false;
+        }
+
+        const tinygltf::Accessor& index_accessor    = model.accessors[primitive.indices];
+        const tinygltf::Accessor& position_accessor = model.accessors[position->second];
+        if (index_accessor.sparse.isSparse || index_accessor.bufferView < 0 || position_accessor.bufferView < 0 || position_accessor.componentType != TINYGLTF_COMPONENT_TYPE_FLOAT) {
+            return false;
+        }
+
+        const tinygltf::BufferView& index_view   = model.bufferViews[index_accessor.bufferView];
+        const int                   index_size   = tinygltf::GetComponentSizeInBytes(uint32_t(index_accessor.componentType));
+        const int                   index_stride = index_accessor.ByteStride(index_view);
+        if (index_size != 1 && index_size != 2 && index_size != 4) {
+            return false;
+        }
+        uint8_t* index_data = model.buffers[index_view.buffer].data.data() + index_view.byteOffset + index_accessor.byteOffset;
+
+        const tinygltf::BufferView& position_view   = model.bufferViews[position_accessor.bufferView];
+        const int                   position_stride = position_accessor.ByteStride(position_view);
+        const uint8_t*              position_data   = model.buffers[position_view.buffer].data.data() + position_view.byteOffset + position_accessor.byteOffset;
+        const uint32_t              vertex_count    = uint32_t(position_accessor.count);
+
+        std::vector<uint32_t> indices(index_accessor.count);
+        for (size_t i = 0; i < indices.size(); i++) {
+            const uint8_t* src = index_data + i * index_stride;
+            indices[i]         = index_size == 1 ? *src : index_size == 2 ? *reinterpret_cast<const uint16_t*>(src) : *reinterpret_cast<const uint32_t*>(src);
+            if (indices[i] >= vertex_count) {
+                return false;
+            }
+        }
+
+        std::vector<glm::vec3> positions(vertex_count);
+        for (uint32_t v = 0; v < vertex_count; v++) {
+            memcpy(&positions[v], position_data + size_t(v) * position_stride, sizeof(glm::vec3));
+        }
+
+        stats_before = vk_test::analyzeVertexCache(indices, vertex_count);
+        vk_test::optimizeVertexCache(indices, vertex_count);
+        vk_test::optimizeOverdraw(indices, positions);
+
+        if (remap_vertices) {
+            std::vector<uint32_t> remap;
+            vk_test::optimizeVertexFetchRemap(indices, vertex_count, remap);
+
+            for (const auto& [name, accessor_index] : primitive.attributes) {
+                const tinygltf::Accessor&   accessor     = model.accessors[accessor_index];
+                const tinygltf::BufferView& view         = model.bufferViews[accessor.bufferView];
+                const size_t                element_size = size_t(tinygltf::GetComponentSizeInBytes(uint32_t(accessor.componentType))) * tinygltf::GetNumComponentsInType(uint32_t(accessor.type));
+                uint8_t*                    data         = model.buffers[view.buffer].data.data() + view.byteOffset + accessor.byteOffset;
+                vk_test::remapVertexData(data, vertex_count, accessor.ByteStride(view), element_size, remap);
+            }
+        }
+        stats_after = vk_test::analyzeVertexCache(indices, vertex_count);
+
+        // Written back in the type they were read
+        for (size_t i = 0; i < indices.size(); i++) {
+            uint8_t* dst = index_data + i * index_stride;
+            if (index_size == 1) {
+                *dst = uint8_t(indices[i]);
+            }
+            else if (index_size == 2) {
+                *reinterpret_cast<uint16_t*>(dst) = uint16_t(indices[i]);
+            }
+            else {
+                *reinterpret_cast<uint32_t*>(dst) = indices[i];
+            }
+        }
+        return true;
+    }
+
+    // Indices of `view`, one of the index buffers of a mesh, read from the data of its buffer in the indexType of the mesh
+    void readMeshIndices(const shaderio::GltfMesh& mesh, const shaderio::BufferView& view, std::span<const uint8_t> data, std::vector<uint32_t>& indices) {
+        indices.resize(view.count);
+        for (uint32_t i = 0; i < view.count; i++) {
+            const uint8_t* src = data.data() + view.offset + size_t(i) * view.byteStride;
+            if (mesh.indexType == VK_INDEX_TYPE_UINT16) {
+                uint16_t index = 0;
+                memcpy(&index, src, sizeof(index));
+                indices[i] = index;
+            }
+            else {
+                memcpy(&indices[i], src, sizeof(uint32_t));
+            }
+        }
+    }
+
+    // Positions of a mesh, read from the data of its buffer in its GltfVertexFormat
+    void readMeshPositions(const shaderio::GltfMesh& mesh, std::span<const uint8_t> data, std::vector<glm::vec3>& positions) {
+        const shaderio::TriangleMesh& tri_mesh = mesh.triMesh;
+
+        positions.resize(tri_mesh.positions.count);
+        for (uint32_t v = 0; v < tri_mesh.positions.count; v++) {
+            const uint8_t* src = data.data() + tri_mesh.positions.offset + size_t(v) * tri_mesh.positions.byteStride;
+            if (mesh.vertexFormat == shaderio::eVertexQuantized) {
+                uint32_t packed[2] = {};
+                memcpy(packed, src, sizeof(packed));
+                const glm::vec3 position(glm::unpackSnorm2x16(packed[0]), glm::unpackSnorm2x16(packed[1]).x);
+                positions[v] = mesh.positionCenter + position * mesh.positionHalfExtent;
+            }
+            else {
+                memcpy(&positions[v], src, sizeof(glm::vec3));
+            }
+        }
+    }
+
+    // Appends `elements` to `buffer` at the next aligned offset, `view` is set to match
+    template <typename T>
+    void appendToBuffer(std::vector<uint8_t>& buffer, shaderio::BufferView& view, const std::vector<T>& elements) {
+        const std::span bytes = std::as_bytes(std::span(elements));
+        view = {
+            .offset     = alignUp(uint32_t(buffer.size())),
+            .count      = uint32_t(elements.size()),
+            .byteStride = uint32_t(sizeof(T)),
+        };
+        buffer.resize(view.offset + bytes.size());
+        memcpy(buffer.data() + view.offset, bytes.data(), bytes.size());
+    }
+
+    // Builds the levels of detail of the meshes and appends their indices to the data of their buffer, the lods of `meshes` are set to match.
+    // The bounding sphere of each mesh is set as well, it is what the level selection projects on the screen.
+    void appendMeshLods(std::span<shaderio::GltfMesh> meshes, std::span<const uint32_t> mesh_buffers, std::vector<std::vector<uint8_t>>& buffers) {
+        SCOPED_TIMER(__FUNCTION__);
+
+        std::vector<std::vector<vk_test::MeshLod>> lods(meshes.size());
+        vk_test::parallel_batches<1>(meshes.size(), [&](uint64_t i) {
+            shaderio::GltfMesh&    mesh = meshes[i];
+            std::vector<uint32_t>  indices;
+            std::vector<glm::vec3> positions;
+            readMeshIndices(mesh, mesh.triMesh.indices, buffers[mesh_buffers[i]], indices);
+            readMeshPositions(mesh, buffers[mesh_buffers[i]], positions);
+
+            glm::vec3 min(std::numeric_limits<float>::max());
+            glm::vec3 max(-std::numeric_limits<float>::max());
+            for (const glm::vec3& position : positions) {
+                min = glm::min(min, position);
+                max = glm::max(max, position);
+            }
+            mesh.boundsCenter = positions.empty() ? glm::vec3(0.0F) : (min + max) * 0.5F;
+            mesh.boundsRadius = 0.0F;
+            for (const glm::vec3& position : positions) {
+                mesh.boundsRadius = std::max(mesh.boundsRadius, glm::length(position - mesh.boundsCenter));
+            }
+
+            lods[i] = vk_test::buildMeshLods(indices, positions, MESH_LOD_MAX_COUNT - 1);
+        });
+
+        for (size_t i = 0; i < meshes.size(); i++) {
+            shaderio::GltfMesh& mesh = meshes[i];
+            mesh.lods[0]             = { .indices = mesh.triMesh.indices, .error = 0.0F };
+            mesh.lodCount            = 1;
+
+            // Stored in the type of the full resolution, a single index buffer binding serves all levels
+            for (const vk_test::MeshLod& lod : lods[i]) {
+                shaderio::GltfMeshLod& level = mesh.lods[mesh.lodCount++];
+                level                        = { .error = lod.error };
+                if (mesh.indexType == VK_INDEX_TYPE_UINT16) {
+                    appendToBuffer(buffers[mesh_buffers[i]], level.indices, std::vector<uint16_t>(lod.indices.begin(), lod.indices.end()));
+                }
+                else {
+                    appendToBuffer(buffers[mesh_buffers[i]], level.indices, lod.indices);
+                }
+            }
+        }
+    }
+
+    // Builds the meshlets of the meshes and appends them to the data of their buffer, the meshlet views of `meshes` are set to match.
+    // With levels of detail, the meshlets of each level follow the previous ones, see GltfMeshLod::firstMeshlet.
+    // The meshlets are built from the dequantized positions, their bounds are in mesh space either way.
+    void appendMeshlets(std::span<shaderio::GltfMesh> meshes, std::span<const uint32_t> mesh_buffers, std::vector<std::vector<uint8_t>>& buffers) {
+        SCOPED_TIMER(__FUNCTION__);
+
+        std::vector<vk_test::MeshletData> meshlets(meshes.size());
+        vk_test::parallel_batches<1>(meshes.size(), [&](uint64_t i) {
+            shaderio::GltfMesh&    mesh = meshes[i];
+            std::vector<uint32_t>  indices;
+            std::vector<glm::vec3> positions;
+            readMeshPositions(mesh, buffers[mesh_buffers[i]], positions);
+
+            if (mesh.lodCount == 0) {
+                readMeshIndices(mesh, mesh.triMesh.indices, buffers[mesh_buffers[i]], indices);
+                meshlets[i] = vk_test::buildMeshlets(indices, positions);
+                return;
+            }
+
+            vk_test::MeshletData& data = meshlets[i];
+            for (uint32_t l = 0; l < mesh.lodCount; l++) {
+                readMeshIndices(mesh, mesh.lods[l].indices, buffers[mesh_buffers[i]], indices);
+                vk_test::MeshletData level = vk_test::buildMeshlets(indices, positions);
+
+                mesh.lods[l].firstMeshlet = uint32_t(data.meshlets.size());
+                mesh.lods[l].meshletCount = uint32_t(level.meshlets.size());
+                for (shaderio::GltfMeshlet& meshlet : level.meshlets) {
+                    meshlet.vertexOffset += uint32_t(data.vertices.size());
+                    meshlet.triangleOffset += uint32_t(data.triangles.size());
+                }
+                data.meshlets.insert(data.meshlets.end(), level.meshlets.begin(), level.meshlets.end());
+                data.vertices.insert(data.vertices.end(), level.vertices.begin(), level.vertices.end());
+                data.triangles.insert(data.triangles.end(), level.triangles.begin(), level.triangles.end());
+            }
+        });
+
+        for (size_t i = 0; i < meshes.size(); i++) {
+            std::vector<uint8_t>& buffer = buffers[mesh_buffers[i]];
+            appendToBuffer(buffer, meshes[i].meshlets, meshlets[i].meshlets);
+            appendToBuffer(buffer, meshes[i].meshletVertices, meshlets[i].vertices);
+            appendToBuffer(buffer, meshes[i].meshletTriangles, meshlets[i].triangles);
+        }
+    }
+} // namespace
+
 namespace vk_test {
     // This is a utility function to convert a primitive mesh to a GltfMeshResource.
+    // With `build_meshlets`, the meshlets are stored after the triangles.
     void primitiveMeshToResource(GltfSceneResource&   scene_resource,
                                  StagingUploader&     staging_uploader,
-                                 const PrimitiveMesh& prim_mesh) {
+                                 const PrimitiveMesh& prim_mesh,
+                                 bool                 build_meshlets /*= false*/) {
 
         ResourceAllocator* allocator = staging_uploader.getResourceAllocator();
 
@@ -42,9 +430,18 @@ namespace vk_test {
         size_t vertices_size  = std::span(prim_mesh.vertices).size_bytes();
         size_t triangles_size = std::span(prim_mesh.triangles).size_bytes();
 
-        // Create buffer for the geometry data (vertices + triangles)
+        MeshletData meshlets;
+        if (build_meshlets) {
+            meshlets = buildMeshlets(prim_mesh);
+        }
+        const size_t meshlets_offset          = vertices_size + triangles_size; // All elements are 4 bytes aligned
+        const size_t meshlet_vertices_offset  = meshlets_offset + std::span(meshlets.meshlets).size_bytes();
+        const size_t meshlet_triangles_offset = meshlet_vertices_offset + std::span(meshlets.vertices).size_bytes();
+        const size_t buffer_size              = meshlet_triangles_offset + std::span(meshlets.triangles).size_bytes();
+
+        // Create buffer for the geometry data (vertices + triangles + meshlets)
         Buffer gltf_data;
-        allocator->createBuffer(gltf_data, vertices_size + triangles_size, VK_BUFFER_USAGE_2_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_2_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_2_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_2_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR);
+        allocator->createBuffer(gltf_data, buffer_size, VK_BUFFER_USAGE_2_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_2_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_2_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_2_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR);
         uint32_t buffer_index = static_cast<uint32_t>(scene_resource.b_gltf_datas.size());
         scene_resource.b_gltf_datas.push_back(gltf_data);
 
@@ -54,6 +451,12 @@ namespace vk_test {
         // Upload triangles after vertices
         staging_uploader.appendBuffer(gltf_data, vertices_size, std::span(prim_mesh.triangles));
 
+        if (build_meshlets) {
+            staging_uploader.appendBuffer(gltf_data, meshlets_offset, std::span(meshlets.meshlets));
+            staging_uploader.appendBuffer(gltf_data, meshlet_vertices_offset, std::span(meshlets.vertices));
+            staging_uploader.appendBuffer(gltf_data, meshlet_triangles_offset, std::span(meshlets.triangles));
+        }
+
         // Set up the TriangleMesh structure with proper BufferView offsets
         shaderio::GltfMesh mesh;
         mesh.triMesh.positions = { .offset     = 0,
@@ -73,11 +476,28 @@ namespace vk_test {
                                  .byteStride = sizeof(uint32_t) };
         mesh.indexType       = VK_INDEX_TYPE_UINT32; // Assuming uint32_t indices
 
+        mesh.meshlets         = { .offset     = static_cast<uint32_t>(meshlets_offset),
+                                  .count      = static_cast<uint32_t>(meshlets.meshlets.size()),
+                                  .byteStride = sizeof(shaderio::GltfMeshlet) };
+        mesh.meshletVertices  = { .offset     = static_cast<uint32_t>(meshlet_vertices_offset),
+                                  .count      = static_cast<uint32_t>(meshlets.vertices.size()),
+                                  .byteStride = sizeof(uint32_t) };
+        mesh.meshletTriangles = { .offset     = static_cast<uint32_t>(meshlet_triangles_offset),
+                                  .count      = static_cast<uint32_t>(meshlets.triangles.size()),
+                                  .byteStride = sizeof(uint32_t) };
+
         // Set the buffer address and index type
         mesh.gltfBuffer = (uint8_t*) gltf_data.address;
         mesh.indexType  = VK_INDEX_TYPE_UINT32; // Assuming uint32_t indices
         scene_resource.meshes.push_back(mesh);
 
+        // Object space bounds of the mesh
+        Bbox bounds;
+        for (const PrimitiveVertex& vertex : prim_mesh.vertices) {
+            bounds.insert(vertex.pos);
+        }
+        scene_resource.mesh_bounds.push_back(bounds);
+
         // Update the mapping from mesh index to buffer index
         scene_resource.mesh_to_buffer_index.push_back(buffer_index);
     }
@@ -109,15 +529,86 @@ namespace vk_test {
         return model;
     }
 
+    // Optimizes the indexed triangle primitives of the model in place, see mesh_optimizer.hpp.
+    // An index accessor used by several primitives is left as it is. The vertices are only renumbered
+    // when every attribute accessor of the primitive is its own, not sparse, and there are no morph targets,
+    // the vertices of the other primitives would otherwise move with them.
+    VertexCacheOptimization optimizeGltfMeshes(tinygltf::Model& model) {
+        SCOPED_TIMER(__FUNCTION__);
+
+        std::vector<const tinygltf::Primitive*> primitives;
+        std::vector<uint32_t>                   accessor_users(model.accessors.size(), 0);
+        for (const tinygltf::Mesh& mesh : model.meshes) {
+            for (const tinygltf::Primitive& primitive : mesh.primitives) {
+                if (primitive.indices >= 0) {
+                    accessor_users[primitive.indices]++;
+                }
+                for (const auto& [name, accessor_index] : primitive.attributes) {
+                    accessor_users[accessor_index]++;
+                }
+                for (const auto& target : primitive.targets) {
+                    for (const auto& [name, accessor_index] : target) {
+                        accessor_users[accessor_index]++;
+                    }
+                }
+                if (primitive.mode == TINYGLTF_MODE_TRIANGLES && primitive.indices >= 0) {
+                    primitives.push_back(&primitive);
+                }
+            }
+        }
+
+        auto is_own = [&](int accessor_index) {
+            const tinygltf::Accessor& accessor = model.accessors[accessor_index];
+            return accessor_users[accessor_index] == 1 && accessor.bufferView >= 0 && !accessor.sparse.isSparse;
+        };
+
+        std::vector<VertexCacheStats> stats_before(primitives.size());
+        std::vector<VertexCacheStats> stats_after(primitives.size());
+        std::vector<uint8_t>          optimized(primitives.size(), 0);
+        parallel_batches<4>(primitives.size(), [&](uint64_t i) {
+            const tinygltf::Primitive& primitive = *primitives[i];
+            const auto                 position  = primitive.attributes.find("POSITION");
+            if (!is_own(primitive.indices) || position == primitive.attributes.end()) {
+                return;
+            }
+
+            const size_t vertex_count   = model.accessors[position->second].count;
+            bool         remap_vertices = primitive.targets.empty();
+            for (const auto& [name, accessor_index] : primitive.attributes) {
+                remap_vertices = remap_vertices && is_own(accessor_index) && model.accessors[accessor_index].count == vertex_count;
+            }
+            optimized[i] = optimizePrimitive(model, primitive, remap_vertices, stats_before[i], stats_after[i]) ? 1 : 0;
+        });
+
+        VertexCacheOptimization result;
+        for (size_t i = 0; i < primitives.size(); i++) {
+            if (optimized[i] != 0) {
+                result.before += stats_before[i];
+                result.after += stats_after[i];
+                result.primitive_count++;
+            }
+        }
+        VK_TEST_SAY("Mesh optimization : " << result.primitive_count << " of " << primitives.size() << " primitives, ACMR " << result.before.acmr << " -> " << result.after.acmr
+                                           << ", ATVR " << result.before.atvr << " -> " << result.after.atvr);
+        return result;
+    }
+
     // This is a utility function to import the GLTF data into the scene resource.
-    // It is a very simple function that just imports the GLTF data into the scene resource.
-    // It has strong limitations, like the mesh must have only one primitive, and the primitive must be a triangle primitive.
-    // But it allow to import the GLTF data into the scene resource with a single function call, and call it again to import another scene.
-    void importGltfData(GltfSceneResource&     scene_resource,
-                        const tinygltf::Model& model,
-                        StagingUploader&       staging_uploader,
-                        bool                   import_instance /*= false*/) {
-        const uint32_t mesh_offset = uint32_t(scene_resource.meshes.size());
+    // Every triangle primitive of every mesh becomes one GltfMesh, each glTF buffer becomes one entry of bGltfDatas.
+    // The primitive extraction and the node transforms are computed on a pool of worker threads,
+    // the staging uploads stay on the calling thread since the StagingUploader is not thread safe.
+    // It can be called again to import another scene, meshes and instances are appended.
+    // With `quantize_vertices`, the streams of each glTF buffer are rewritten (see quantizeMeshes) and uploaded instead of it.
+    // With `build_meshlets`, the meshlets of its meshes are appended to each buffer (see appendMeshlets).
+    void importGltfData(GltfSceneResource&                 scene_resource,
+                        const tinygltf::Model&             model,
+                        StagingUploader&                   staging_uploader,
+                        const GltfImportSettings&          settings /*= {}*/,
+                        std::vector<std::vector<uint8_t>>* rewritten_buffers /*= nullptr*/) {
+        SCOPED_TIMER(__FUNCTION__);
+
+        const uint32_t mesh_offset   = uint32_t(scene_resource.meshes.size());
+        const uint32_t buffer_offset = uint32_t(scene_resource.b_gltf_datas.size());
 
         // Lambda for element byte size calculation
         auto get_element_byte_size = [](int type) -> uint32_t {
@@ -136,141 +627,392 @@ namespace vk_test {
                                                                                 : 0U;
         };
 
+        // Why an accessor cannot be read in place by the shaders, null when it can: floats of `type`,
+        // in the glTF buffer `buffer` (the one of the indices), without sparse values
+        auto unsupported_accessor = [&](const tinygltf::Accessor& acc, int type, int buffer) -> const char* {
+            if (acc.bufferView < 0 || acc.sparse.isSparse) {
+                return "no buffer view or sparse values";
+            }
+            if (acc.componentType != TINYGLTF_COMPONENT_TYPE_FLOAT || acc.type != type) {
+                return "unsupported type, the shaders read floats";
+            }
+            if (model.bufferViews[acc.bufferView].buffer != buffer) {
+                return "not in the buffer of the indices";
+            }
+            return nullptr;
+        };
+
         // Lambda for extracting attributes, like positions, normals, colors, etc.
-        auto extract_attribute = [&](const std::string& name, shaderio::BufferView& attr, const tinygltf::Primitive& primitive) {
+        // An attribute the shaders cannot read is left out with a message, its view stays empty.
+        auto extract_attribute = [&](const std::string& name, int type, shaderio::BufferView& attr, const tinygltf::Primitive& primitive, int buffer) {
             if (!primitive.attributes.contains(name)) {
                 attr.offset = -1;
                 return;
             }
-            const tinygltf::Accessor&   acc = model.accessors[primitive.attributes.at(name)];
-            const tinygltf::BufferView& bv  = model.bufferViews[acc.bufferView];
-            assert((acc.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT) && "Should be floats");
-            attr = {
+            const tinygltf::Accessor& acc = model.accessors[primitive.attributes.at(name)];
+            if (const char* reason = unsupported_accessor(acc, type, buffer)) {
+                VK_TEST_SAY("Skipping the attribute " << name.c_str() << " of a primitive : " << reason);
+                attr.offset = -1;
+                return;
+            }
+            const tinygltf::BufferView& bv = model.bufferViews[acc.bufferView];
+            attr                           = {
                 .offset     = uint32_t(bv.byteOffset + acc.byteOffset),
                 .count      = uint32_t(acc.count),
                 .byteStride = (bv.byteStride ? uint32_t(bv.byteStride) : get_type_size(acc.type) * get_element_byte_size(acc.componentType)),
             };
         };
 
-        // Upload the scene resource to the GPU
-        Buffer   b_gltf_data;
-        uint32_t buffer_index{};
-        {
-            ResourceAllocator* allocator = staging_uploader.getResourceAllocator();
+        // The colors and texture coordinates are converted when the vertices are quantized: floats, or normalized unsigned
+        // bytes or shorts, of one of `types`. `format` gets the layout of the accessor. Otherwise as extract_attribute.
+        auto extract_converted_attribute = [&](const std::string& name, std::initializer_list<int> types, shaderio::BufferView& attr, AttributeFormat& format,
+                                               const tinygltf::Primitive& primitive, int buffer) {
+            if (!settings.quantize_vertices) {
+                extract_attribute(name, format.type, attr, primitive, buffer);
+                return;
+            }
+            if (!primitive.attributes.contains(name)) {
+                attr.offset = -1;
+                return;
+            }
+            const tinygltf::Accessor& acc                = model.accessors[primitive.attributes.at(name)];
+            const bool                normalized_integer = acc.normalized && (acc.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE || acc.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT);
+            const char*               reason             = nullptr;
+            if (acc.bufferView < 0 || acc.sparse.isSparse) {
+                reason = "no buffer view or sparse values";
+            }
+            else if (std::find(types.begin(), types.end(), acc.type) == types.end() || (acc.componentType != TINYGLTF_COMPONENT_TYPE_FLOAT && !normalized_integer)) {
+                reason = "unsupported type, floats or normalized unsigned bytes and shorts are converted";
+            }
+            else if (model.bufferViews[acc.bufferView].buffer != buffer) {
+                reason = "not in the buffer of the indices";
+            }
+            if (reason != nullptr) {
+                VK_TEST_SAY("Skipping the attribute " << name.c_str() << " of a primitive : " << reason);
+                attr.offset = -1;
+                return;
+            }
+            const tinygltf::BufferView& bv = model.bufferViews[acc.bufferView];
+            attr                           = {
+                .offset     = uint32_t(bv.byteOffset + acc.byteOffset),
+                .count      = uint32_t(acc.count),
+                .byteStride = uint32_t(acc.ByteStride(bv)),
+            };
+            format = { .type = acc.type, .component_type = acc.componentType };
+        };
 
-            // The GLTF buffer is used to store the geometry data (indices, positions, normals, etc.)
-            // The flags are set to allow the buffer to be used as a vertex buffer, index buffer, storage buffer, and for acceleration structure build input read-only.
-            allocator->createBuffer(b_gltf_data, std::span<const unsigned char>(model.buffers[0].data).size_bytes(),
-                                    VK_BUFFER_USAGE_2_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_2_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_2_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_2_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR); // #RT
-            staging_uploader.appendBuffer(b_gltf_data, 0, std::span<const unsigned char>(model.buffers[0].data));
+        // Why a primitive cannot be imported, null when it can: 16 or 32-bit triangle indices and float positions in the same buffer
+        auto unsupported_primitive = [&](const tinygltf::Primitive& primitive) -> const char* {
+            if (primitive.mode != TINYGLTF_MODE_TRIANGLES || primitive.indices < 0) {
+                return "non-indexed or non-triangle";
+            }
+            const tinygltf::Accessor& indices = model.accessors[primitive.indices];
+            if (indices.bufferView < 0 || indices.sparse.isSparse || indices.count % 3 != 0) {
+                return "indices without buffer view, sparse or not a multiple of 3";
+            }
+            if (indices.componentType != TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT && indices.componentType != TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT) {
+                return "8-bit indices";
+            }
+            const auto position = primitive.attributes.find("POSITION");
+            if (position == primitive.attributes.end()) {
+                return "no positions";
+            }
+            if (const char* reason = unsupported_accessor(model.accessors[position->second], TINYGLTF_TYPE_VEC3, model.bufferViews[indices.bufferView].buffer)) {
+                return reason;
+            }
+            return nullptr;
+        };
+
+        // Flatten all triangle primitives into a linear job list.
+        // mesh_first_primitive[i] is the first imported mesh of the glTF mesh i, mesh_primitive_count[i] how many were imported.
+        struct PrimitiveJob {
+            uint32_t mesh_idx      = 0;
+            uint32_t primitive_idx = 0;
+        };
+        std::vector<PrimitiveJob>         jobs;
+        std::vector<uint32_t>             mesh_first_primitive(model.meshes.size(), 0);
+        std::vector<uint32_t>             mesh_primitive_count(model.meshes.size(), 0);
+        std::vector<MeshAttributeFormats> mesh_formats; // Layouts of the streams converted by quantizeMeshes, per job
+        {
+            SCOPED_TIMER("Flatten primitives");
+            for (size_t mesh_idx = 0; mesh_idx < model.meshes.size(); ++mesh_idx) {
+                const tinygltf::Mesh& tiny_mesh = model.meshes[mesh_idx];
+                mesh_first_primitive[mesh_idx]  = uint32_t(jobs.size());
+                for (size_t prim_idx = 0; prim_idx < tiny_mesh.primitives.size(); ++prim_idx) {
+                    const tinygltf::Primitive& primitive = tiny_mesh.primitives[prim_idx];
+                    if (const char* reason = unsupported_primitive(primitive)) {
+                        VK_TEST_SAY("Skipping the primitive " << prim_idx << " of mesh " << tiny_mesh.name.c_str() << " : " << reason);
+                        continue;
+                    }
+                    jobs.push_back({ uint32_t(mesh_idx), uint32_t(prim_idx) });
+                }
+                mesh_primitive_count[mesh_idx] = uint32_t(jobs.size()) - mesh_first_primitive[mesh_idx];
+            }
 
-            buffer_index = static_cast<uint32_t>(scene_resource.b_gltf_datas.size());
-            scene_resource.b_gltf_datas.push_back(b_gltf_data);
+            mesh_formats.resize(jobs.size());
+            scene_resource.meshes.resize(mesh_offset + jobs.size());
+            scene_resource.mesh_bounds.resize(mesh_offset + jobs.size());
+            scene_resource.mesh_to_buffer_index.resize(mesh_offset + jobs.size());
         }
 
-        for (size_t mesh_idx = 0; mesh_idx < model.meshes.size(); ++mesh_idx) {
-            shaderio::GltfMesh mesh{};
+        // Extract all primitives in parallel, each job writes only its own slot
+        {
+            SCOPED_TIMER("Extract primitives");
+            parallel_batches<64>(jobs.size(), [&](uint64_t job_idx) {
+                const PrimitiveJob&        job       = jobs[job_idx];
+                const tinygltf::Primitive& primitive = model.meshes[job.mesh_idx].primitives[job.primitive_idx];
+                shaderio::GltfMesh         mesh{};
 
-            const tinygltf::Mesh&      tiny_mesh = model.meshes[mesh_idx];
-            const tinygltf::Primitive& primitive = tiny_mesh.primitives.front();
-            assert((tiny_mesh.primitives.size() == 1 && primitive.mode == TINYGLTF_MODE_TRIANGLES) && "Must have one triangle primitive");
+                // Extract indices
+                const auto& accessor    = model.accessors[primitive.indices];
+                const auto& buffer_view = model.bufferViews[accessor.bufferView];
+                mesh.triMesh.indices = {
+                    .offset     = uint32_t(buffer_view.byteOffset + accessor.byteOffset),
+                    .count      = uint32_t(accessor.count),
+                    .byteStride = uint32_t((buffer_view.byteStride != 0U) ? buffer_view.byteStride : get_element_byte_size(accessor.componentType)),
+                };
+                mesh.indexType = accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
 
-            // Extract indices
-            const auto& accessor    = model.accessors[primitive.indices];
-            const auto& buffer_view = model.bufferViews[accessor.bufferView];
-            assert((accessor.count % 3 == 0) && "Should be a multiple of 3");
-            mesh.triMesh.indices = {
-                .offset     = uint32_t(buffer_view.byteOffset + accessor.byteOffset),
-                .count      = uint32_t(accessor.count),
-                .byteStride = uint32_t((buffer_view.byteStride != 0U) ? buffer_view.byteStride : get_element_byte_size(accessor.componentType)),
-            };
-            mesh.indexType = accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+                // Extract attributes
+                extract_attribute("POSITION", TINYGLTF_TYPE_VEC3, mesh.triMesh.positions, primitive, buffer_view.buffer);
+                extract_attribute("NORMAL", TINYGLTF_TYPE_VEC3, mesh.triMesh.normals, primitive, buffer_view.buffer);
+                extract_converted_attribute("COLOR_0", { TINYGLTF_TYPE_VEC3, TINYGLTF_TYPE_VEC4 }, mesh.triMesh.colorVert, mesh_formats[job_idx].colors, primitive, buffer_view.buffer);
+                extract_converted_attribute("TEXCOORD_0", { TINYGLTF_TYPE_VEC2 }, mesh.triMesh.texCoords, mesh_formats[job_idx].tex_coords, primitive, buffer_view.buffer);
+                extract_attribute("TANGENT", TINYGLTF_TYPE_VEC4, mesh.triMesh.tangents, primitive, buffer_view.buffer);
 
-            // Set the buffer address
-            mesh.gltfBuffer = (uint8_t*) b_gltf_data.address;
+                scene_resource.meshes[mesh_offset + job_idx] = mesh;
 
-            // Extract attributes
-            extract_attribute("POSITION", mesh.triMesh.positions, primitive);
-            extract_attribute("NORMAL", mesh.triMesh.normals, primitive);
-            extract_attribute("COLOR_0", mesh.triMesh.colorVert, primitive);
-            extract_attribute("TEXCOORD_0", mesh.triMesh.texCoords, primitive);
-            extract_attribute("TANGENT", mesh.triMesh.tangents, primitive);
+                // The POSITION accessor is required to have its min and max, no need to read the vertices
+                const auto position = primitive.attributes.find("POSITION");
+                if (position != primitive.attributes.end()) {
+                    const tinygltf::Accessor& acc = model.accessors[position->second];
+                    if (acc.minValues.size() == 3 && acc.maxValues.size() == 3) {
+                        scene_resource.mesh_bounds[mesh_offset + job_idx] = Bbox(glm::vec3(acc.minValues[0], acc.minValues[1], acc.minValues[2]),
+                                                                                 glm::vec3(acc.maxValues[0], acc.maxValues[1], acc.maxValues[2]));
+                    }
+                }
 
-            scene_resource.meshes.emplace_back(mesh);
+                // Update the mapping from mesh index to buffer index
+                scene_resource.mesh_to_buffer_index[mesh_offset + job_idx] = buffer_offset + uint32_t(buffer_view.buffer);
+            });
+        }
 
-            // Update the mapping from mesh index to buffer index
-            scene_resource.mesh_to_buffer_index.push_back(buffer_index);
+        // The buffers as uploaded, when they are not the glTF ones
+        std::vector<std::vector<uint8_t>> rewritten;
+        std::vector<uint32_t>             mesh_buffers(jobs.size());
+        for (size_t i = 0; i < jobs.size(); i++) {
+            mesh_buffers[i] = scene_resource.mesh_to_buffer_index[mesh_offset + i] - buffer_offset;
         }
+        if (settings.quantize_vertices) {
+            rewritten = quantizeMeshes(std::span(scene_resource.meshes).subspan(mesh_offset), mesh_buffers, mesh_formats, model.buffers);
+        }
+        if ((settings.build_lods || settings.build_meshlets) && rewritten.empty()) {
+            rewritten.reserve(model.buffers.size());
+            for (const tinygltf::Buffer& buffer : model.buffers) {
+                rewritten.emplace_back(buffer.data.begin(), buffer.data.end());
+            }
+        }
+        if (settings.build_lods) {
+            appendMeshLods(std::span(scene_resource.meshes).subspan(mesh_offset), mesh_buffers, rewritten);
+        }
+        if (settings.build_meshlets) {
+            appendMeshlets(std::span(scene_resource.meshes).subspan(mesh_offset), mesh_buffers, rewritten);
+        }
+
+        // Upload the scene resource to the GPU, one device buffer per glTF buffer
+        {
+            SCOPED_TIMER("Upload glTF buffers");
+            ResourceAllocator* allocator = staging_uploader.getResourceAllocator();
 
-        if (import_instance) {
-            // Extract instances with proper hierarchical transformation handling
-            std::function<void(const tinygltf::Node&, const glm::mat4&)> process_node = [&](const tinygltf::Node& node,
-                                                                                            const glm::mat4&      parent_transform) {
-                glm::mat4 node_transform = parent_transform;
+            for (size_t i = 0; i < model.buffers.size(); i++) {
+                const std::span<const unsigned char> data = rewritten.empty() ? std::span<const unsigned char>(model.buffers[i].data) : std::span<const unsigned char>(rewritten[i]);
 
-                // Apply node transform
-                if (!node.matrix.empty()) {
-                    // Use matrix if available
-                    glm::mat4 matrix = glm::make_mat4(node.matrix.data());
-                    node_transform   = parent_transform * matrix;
+                // The GLTF buffer is used to store the geometry data (indices, positions, normals, etc.)
+                // The flags are set to allow the buffer to be used as a vertex buffer, index buffer, storage buffer, and for acceleration structure build input read-only.
+                Buffer b_gltf_data;
+                allocator->createBuffer(b_gltf_data, std::max<size_t>(data.size_bytes(), 4), // A buffer without triangles has no quantized data
+                                        VK_BUFFER_USAGE_2_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_2_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_2_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_2_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR); // #RT
+                if (!data.empty()) {
+                    staging_uploader.appendBuffer(b_gltf_data, 0, data);
                 }
-                else {
-                    // Apply TRS if matrix is not available
-                    if (!node.translation.empty()) {
-                        glm::vec3 translation = glm::make_vec3(node.translation.data());
-                        node_transform        = glm::translate(node_transform, translation);
-                    }
-                    if (!node.rotation.empty()) {
-                        glm::quat rotation = glm::make_quat(node.rotation.data());
-                        node_transform     = node_transform * glm::mat4_cast(rotation);
-                    }
-                    if (!node.scale.empty()) {
-                        glm::vec3 scale = glm::make_vec3(node.scale.data());
-                        node_transform  = glm::scale(node_transform, scale);
+                scene_resource.b_gltf_datas.push_back(b_gltf_data);
+            }
+
+            // Set the buffer addresses
+            for (size_t i = mesh_offset; i < scene_resource.meshes.size(); i++) {
+                scene_resource.meshes[i].gltfBuffer = (uint8_t*) scene_resource.b_gltf_datas[scene_resource.mesh_to_buffer_index[i]].address;
+            }
+        }
+
+        if (rewritten_buffers != nullptr) {
+            *rewritten_buffers = std::move(rewritten);
+        }
+
+        // Materials, appended in the order of the glTF. Its textures are not loaded, only the factors are kept
+        // (baseColorTextureIndex 0 is no texture). The primitives without material get the default one of the glTF spec.
+        const uint32_t material_offset = uint32_t(scene_resource.materials.size());
+        for (const tinygltf::Material& tiny_material : model.materials) {
+            const tinygltf::PbrMetallicRoughness& pbr = tiny_material.pbrMetallicRoughness;
+            scene_resource.materials.push_back({ .baseColorFactor       = glm::vec4(glm::make_vec4(pbr.baseColorFactor.data())),
+                                                 .metallicFactor        = float(pbr.metallicFactor),
+                                                 .roughnessFactor       = float(pbr.roughnessFactor),
+                                                 .baseColorTextureIndex = 0 });
+        }
+        uint32_t default_material = ~0U; // Appended when a primitive needs it
+        auto     material_index   = [&](const tinygltf::Primitive& primitive) -> uint32_t {
+            if (primitive.material >= 0 && primitive.material < static_cast<int>(model.materials.size())) {
+                return material_offset + uint32_t(primitive.material);
+            }
+            if (default_material == ~0U) {
+                default_material = uint32_t(scene_resource.materials.size());
+                scene_resource.materials.push_back({ .baseColorFactor = glm::vec4(1.0F), .metallicFactor = 1.0F, .roughnessFactor = 1.0F, .baseColorTextureIndex = 0 });
+            }
+            return default_material;
+        };
+
+        if (settings.import_instance) {
+            const size_t node_count = model.nodes.size();
+
+            // Parent of each node, built in one pass over the children lists (-1 for root nodes)
+            std::vector<int> parents(node_count, -1);
+            // Nodes sorted so that a parent always comes before its children
+            std::vector<int> order;
+            order.reserve(node_count);
+            {
+                SCOPED_TIMER("Build node hierarchy");
+                for (size_t node_idx = 0; node_idx < node_count; ++node_idx) {
+                    for (int child_idx : model.nodes[node_idx].children) {
+                        if (child_idx >= 0 && child_idx < static_cast<int>(node_count)) {
+                            parents[child_idx] = static_cast<int>(node_idx);
+                        }
                     }
                 }
 
-                // Create instance for this node if it has a mesh
-                if (node.mesh != -1) {
-                    const tinygltf::Mesh&      tiny_mesh = model.meshes[node.mesh];
-                    const tinygltf::Primitive& primitive = tiny_mesh.primitives.front();
-                    assert((tiny_mesh.primitives.size() == 1 && primitive.mode == TINYGLTF_MODE_TRIANGLES) && "Must have one triangle primitive");
-                    shaderio::GltfInstance instance{};
-                    instance.meshIndex = node.mesh + mesh_offset;
-                    instance.transform  = node_transform;
-                    scene_resource.instances.push_back(instance);
+                // Breadth first from all root nodes
+                for (size_t node_idx = 0; node_idx < node_count; ++node_idx) {
+                    if (parents[node_idx] == -1) {
+                        order.push_back(static_cast<int>(node_idx));
+                    }
                 }
-
-                // Process children
-                for (int child_idx : node.children) {
-                    if (child_idx >= 0 && child_idx < static_cast<int>(model.nodes.size())) {
-                        process_node(model.nodes[child_idx], node_transform);
+                for (size_t i = 0; i < order.size(); ++i) {
+                    for (int child_idx : model.nodes[order[i]].children) {
+                        if (child_idx >= 0 && child_idx < static_cast<int>(node_count) && parents[child_idx] == order[i]) {
+                            order.push_back(child_idx);
+                        }
                     }
                 }
-            };
+            }
+
+            std::vector<glm::mat4> world_matrices(node_count, glm::mat4(1.0F));
+            {
+                SCOPED_TIMER("Node transforms");
 
-            // Process all root nodes (nodes with no parent)
-            for (size_t node_idx = 0; node_idx < model.nodes.size(); ++node_idx) {
-                const tinygltf::Node& node = model.nodes[node_idx];
-                // Check if this is a root node (not referenced as a child)
-                bool is_root_node = true;
-                for (const auto& other_node : model.nodes) {
-                    for (int child_idx : other_node.children) {
-                        if (child_idx == static_cast<int>(node_idx)) {
-                            is_root_node = false;
-                            break;
+                // Local transforms are independent, compute them in parallel
+                parallel_batches<256>(node_count, [&](uint64_t node_idx) {
+                    const tinygltf::Node& node           = model.nodes[node_idx];
+                    glm::mat4             node_transform = glm::mat4(1.0F);
+
+                    if (!node.matrix.empty()) {
+                        // Use matrix if available
+                        node_transform = glm::make_mat4(node.matrix.data());
+                    }
+                    else {
+                        // Apply TRS if matrix is not available
+                        if (!node.translation.empty()) {
+                            glm::vec3 translation = glm::make_vec3(node.translation.data());
+                            node_transform        = glm::translate(node_transform, translation);
+                        }
+                        if (!node.rotation.empty()) {
+                            glm::quat rotation = glm::make_quat(node.rotation.data());
+                            node_transform     = node_transform * glm::mat4_cast(rotation);
+                        }
+                        if (!node.scale.empty()) {
+                            glm::vec3 scale = glm::make_vec3(node.scale.data());
+                            node_transform  = glm::scale(node_transform, scale);
                         }
                     }
-                    if (!is_root_node) {
-                        break;
+                    world_matrices[node_idx] = node_transform;
+                });
+
+                // Parents are resolved before their children, so a single pass concatenates the hierarchy
+                for (int node_idx : order) {
+                    if (parents[node_idx] != -1) {
+                        world_matrices[node_idx] = world_matrices[parents[node_idx]] * world_matrices[node_idx];
                     }
                 }
+            }
 
-                if (is_root_node) {
-                    process_node(node, glm::mat4(1.0F)); // Start with identity matrix
+            {
+                SCOPED_TIMER("Create instances");
+                // Create one instance per imported primitive of each node having a mesh
+                for (int node_idx : order) {
+                    const tinygltf::Node& node = model.nodes[node_idx];
+                    if (node.mesh == -1) {
+                        continue;
+                    }
+                    for (uint32_t p = 0; p < mesh_primitive_count[node.mesh]; ++p) {
+                        const uint32_t             job_idx   = mesh_first_primitive[node.mesh] + p;
+                        const tinygltf::Primitive& primitive = model.meshes[node.mesh].primitives[jobs[job_idx].primitive_idx];
+                        shaderio::GltfInstance     instance{};
+                        instance.meshIndex     = mesh_offset + job_idx;
+                        instance.materialIndex = material_index(primitive);
+                        instance.transform     = world_matrices[node_idx];
+                        scene_resource.instances.push_back(instance);
+                    }
                 }
             }
         }
+
+        updateInstanceBounds(scene_resource);
+    }
+
+    float meshLodScale(float viewport_height, const glm::mat4& proj, float threshold_pixels) {
+        if (threshold_pixels <= 0.0F) {
+            return 0.0F;
+        }
+        return viewport_height * 0.5F * std::abs(proj[1][1]) / threshold_pixels;
+    }
+
+    uint32_t selectMeshLod(const shaderio::GltfMesh& mesh, const glm::mat4& transform, const glm::vec3& eye, float lod_scale) {
+        if (mesh.lodCount <= 1 || lod_scale <= 0.0F) {
+            return 0;
+        }
+
+        // The error grows with the largest scale of the instance
+        const float     scale_max = std::max({ glm::length(glm::vec3(transform[0])), glm::length(glm::vec3(transform[1])), glm::length(glm::vec3(transform[2])) });
+        const glm::vec3 center    = glm::vec3(transform * glm::vec4(mesh.boundsCenter, 1.0F));
+        const float     distance  = std::max(glm::length(center - eye) - mesh.boundsRadius * scale_max, 0.0F);
+
+        uint32_t lod = 0;
+        for (uint32_t i = 1; i < mesh.lodCount; i++) {
+            if (mesh.lods[i].error * scale_max * lod_scale > distance) {
+                break;
+            }
+            lod = i;
+        }
+        return lod;
+    }
+
+    shaderio::BufferView meshLodIndices(const shaderio::GltfMesh& mesh, uint32_t lod) {
+        return lod == 0 ? mesh.triMesh.indices : mesh.lods[lod].indices;
+    }
+
+    // Instances without mesh bounds keep an empty box, culling treats them as always visible
+    void updateInstanceBounds(GltfSceneResource& scene_resource) {
+        const size_t first = scene_resource.instance_bounds.size();
+        if (first >= scene_resource.instances.size()) {
+            return;
+        }
+
+        SCOPED_TIMER(__FUNCTION__);
+        scene_resource.instance_bounds.resize(scene_resource.instances.size());
+        parallel_batches<256>(scene_resource.instances.size() - first, [&](uint64_t i) {
+            const shaderio::GltfInstance& instance = scene_resource.instances[first + i];
+            const Bbox&                   bounds   = scene_resource.mesh_bounds[instance.meshIndex];
+            if (!bounds.isEmpty()) {
+                scene_resource.instance_bounds[first + i] = bounds.transform(instance.transform);
+            }
+        });
     }
 
     // This function creates the scene info buffer
@@ -283,6 +1025,9 @@ namespace vk_test {
     void createGltfSceneInfoBuffer(GltfSceneResource& scene_resource, StagingUploader& staging_uploader) {
         ResourceAllocator* allocator = staging_uploader.getResourceAllocator();
 
+        // Instances may have been added by hand after the import
+        updateInstanceBounds(scene_resource);
+
         // Create all mesh buffers
         allocator->createBuffer(scene_resource.b_meshes, std::span(scene_resource.meshes).size_bytes(), VK_BUFFER_USAGE_2_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_2_TRANSFER_DST_BIT | VK_BUFFER_USAGE_2_TRANSFER_SRC_BIT);
         staging_uploader.appendBuffer(scene_resource.b_meshes, 0, std::span<const shaderio::GltfMesh>(scene_resource.meshes));
@@ -46,6 +46,10 @@ namespace vk_test {
         std::vector<shaderio::GltfMetallicRoughness> materials;    // All materials in the scene
         shaderio::GltfSceneInfo                      scene_info{}; // Scene information (camera matrices, meshes, instances, materials, etc.)
 
+        // Bounds, used for culling
+        std::vector<Bbox> mesh_bounds;     // Object space bounds of each mesh
+        std::vector<Bbox> instance_bounds; // World space bounds of each instance, see updateInstanceBounds()
+
         // GPU buffers for the scene data
         std::vector<Buffer> b_gltf_datas; // Buffers containing the GLTF binary data for each loaded scene
         Buffer              b_meshes;     // Buffer containing all GltfMesh data
@@ -62,16 +66,56 @@ namespace vk_test {
     // This is a utility function to load a GLTF file and return the model data.
     tinygltf::Model loadGltfResources(const std::filesystem::path& filename);
 
+    // Vertex cache statistics of the primitives optimized by optimizeGltfMeshes()
+    struct VertexCacheOptimization {
+        VertexCacheStats before;
+        VertexCacheStats after;
+        uint32_t         primitive_count = 0;
+    };
+
+    // Reorders the triangles and vertices of the model for the vertex cache, the overdraw and the vertex fetch,
+    // to call before importGltfData(). See mesh_optimizer.hpp.
+    VertexCacheOptimization optimizeGltfMeshes(tinygltf::Model& model);
+
+    // How a glTF is turned into GltfMesh, also the key of its cache (see gltf_cache.hpp)
+    struct GltfImportSettings {
+        bool import_instance   = false; // One GltfInstance per primitive of each node having a mesh
+        bool quantize_vertices = false; // Meshes stored as shaderio::eVertexQuantized, about half the vertex memory
+        bool optimize_meshes   = false; // optimizeGltfMeshes() before the import, done by importGltfCached
+        bool build_meshlets    = false; // GltfMesh::meshlets filled, for the mesh shader raster path (see meshlets.hpp)
+        bool build_lods        = false; // GltfMesh::lods filled, coarser index buffers on the same vertices (see mesh_simplifier.hpp)
+    };
+
     // This is a utility function to import the GLTF data into the scene resource.
-    void importGltfData(GltfSceneResource&     scene_resource,
-                        const tinygltf::Model& model,
-                        StagingUploader&       staging_uploader,
-                        bool                   import_instance = false);
+    // All triangle primitives are imported (one GltfMesh each), work is spread over a worker pool.
+    // The materials are appended to scene_resource.materials, the instances reference them.
+    // When the settings change the data of the glTF buffers (vertex quantization, meshlets),
+    // the uploaded buffers are returned in `rewritten_buffers` when given (see saveGltfSceneCache).
+    void importGltfData(GltfSceneResource&                 scene_resource,
+                        const tinygltf::Model&             model,
+                        StagingUploader&                   staging_uploader,
+                        const GltfImportSettings&          settings          = {},
+                        std::vector<std::vector<uint8_t>>* rewritten_buffers = nullptr);
+
+    // Computes the world space bounds of the instances added since the last call.
+    // The bounds of an instance must be recomputed by the caller when its transform changes.
+    void updateInstanceBounds(GltfSceneResource& scene_resource);
+
+    // Distance factor of the level selection: an error projecting to `threshold_pixels` on a viewport of `viewport_height`
+    // is at its error times this factor from the eye. 0 (no threshold) keeps the full resolution.
+    float meshLodScale(float viewport_height, const glm::mat4& proj, float threshold_pixels);
+
+    // Coarsest level of `mesh` whose error projects under the threshold of `lod_scale`, from the nearest point of its bounding sphere.
+    // Same selection as lod_functions.h.slang.
+    uint32_t selectMeshLod(const shaderio::GltfMesh& mesh, const glm::mat4& transform, const glm::vec3& eye, float lod_scale);
+
+    // Indices of a level of `mesh`, the first one is triMesh.indices
+    shaderio::BufferView meshLodIndices(const shaderio::GltfMesh& mesh, uint32_t lod);
 
     // This is a utility function to create the scene info buffer.
     void createGltfSceneInfoBuffer(GltfSceneResource& scene_resource, StagingUploader& staging_uploader);
 
     // This is a utility function to convert a primitive mesh to a GltfMeshResource.
-    void primitiveMeshToResource(GltfSceneResource& scene_resource, StagingUploader& staging_uploader, const PrimitiveMesh& prim_mesh);
+    void primitiveMeshToResource(GltfSceneResource& scene_resource, StagingUploader& staging_uploader, const PrimitiveMesh& prim_mesh, bool build_meshlets = false);
 
 } // namespace vk_test
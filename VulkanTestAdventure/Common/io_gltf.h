@@ -71,12 +71,60 @@ struct GltfMetallicRoughness
   int    baseColorTextureIndex;  // Index of the base color texture in the GLTF file (optional)
 };
 
+// How the vertex streams of a GltfMesh are stored
+enum GltfVertexFormat
+{
+  eVertexFloat     = 0,  // As in the glTF : float positions, normals, texture coordinates, tangents and colors
+  eVertexQuantized = 1   // snorm16 positions in the mesh bounds (8 bytes), octahedral snorm16 normals and tangents (4 bytes),
+                         // half texture coordinates (4 bytes), unorm8 colors (4 bytes)
+};
+
+// Limits of a meshlet, the mesh shader has one output per vertex and triangle
+#define MESHLET_MAX_VERTICES 64
+#define MESHLET_MAX_TRIANGLES 124
+
+// A cluster of triangles of a GltfMesh, culled as a whole by the task shader
+struct GltfMeshlet
+{
+  float3   center;          // Bounding sphere, in mesh space
+  float    radius;
+  float3   coneAxis;        // Average normal. The meshlet faces away from the eye when
+  float    coneCutoff;      //   dot(center - eye, coneAxis) >= coneCutoff * length(center - eye) + radius, never when coneCutoff is 1
+  uint32_t vertexOffset;    // First element of GltfMesh::meshletVertices
+  uint32_t triangleOffset;  // First element of GltfMesh::meshletTriangles
+  uint32_t vertexCount;     // At most MESHLET_MAX_VERTICES
+  uint32_t triangleCount;   // At most MESHLET_MAX_TRIANGLES
+};
+
+// Levels of detail of a GltfMesh, the full resolution one included
+#define MESH_LOD_MAX_COUNT 5
+
+// A level of detail of a GltfMesh, on the vertices of the full resolution and with its indexType
+struct GltfMeshLod
+{
+  BufferView indices;       // The first level is triMesh.indices
+  float      error;         // Distance to the full resolution surface, in mesh space
+  uint32_t   firstMeshlet;  // Meshlets of the level in GltfMesh::meshlets, when built
+  uint32_t   meshletCount;
+};
+
 struct GltfMesh
 {
   uint8_t*     gltfBuffer = nullptr;  // Buffer to the data (index, position, normal, ...)
   TriangleMesh triMesh;               // Mesh data
   int          indexType;             // Index type (uint16_t or uint32_t)
+  int          vertexFormat = 0;      // GltfVertexFormat of the positions, normals, colorVert, texCoords and tangents
+  float3       positionCenter;        // Quantized positions : positionCenter + snorm16 * positionHalfExtent
+  float3       positionHalfExtent;
+  BufferView   meshlets;              // GltfMeshlet, empty when the meshlets were not built
+  BufferView   meshletVertices;       // uint32_t, vertex of the mesh
+  BufferView   meshletTriangles;      // uint32_t, 3 vertices of the meshlet in the low 24 bits
+  uint32_t     lodCount = 0;          // Levels in `lods`, 0 when they were not built
+  GltfMeshLod  lods[MESH_LOD_MAX_COUNT];
+  float3       boundsCenter;          // Bounding sphere in mesh space, for the level selection
+  float        boundsRadius;
 };
+CHECK_STRUCT_ALIGNMENT(GltfMesh)
 
 enum GltfLightType
 {
@@ -1,6678 +0,0 @@
-#pragma once
-
-const uint32_t rtbasic_slang[] = 
-{
-    0x07230203, 0x00010600, 0x00280000, 0x00000d28, 0x00000000, 0x00020011, 0x000014e3, 0x00020011, 0x0000117f, 
-    0x00020011, 0x00000037, 0x00020011, 0x00000038, 0x00020011, 0x00000027, 0x00020011, 0x00000016, 0x00020011, 
-    0x0000000b, 0x00020011, 0x000014b6, 0x00020011, 0x00000001, 0x0008000a, 0x5f565053, 0x5f52484b, 0x5f6e6f6e, 
-    0x616d6573, 0x6369746e, 0x666e695f, 0x0000006f, 0x0009000a, 0x5f565053, 0x5f52484b, 0x73796870, 0x6c616369, 
-    0x6f74735f, 0x65676172, 0x6675625f, 0x00726566, 0x0006000a, 0x5f565053, 0x5f52484b, 0x5f796172, 0x63617274, 
-    0x00676e69, 0x000b000b, 0x00000002, 0x536e6f4e, 0x6e616d65, 0x2e636974, 0x64616853, 0x442e7265, 0x67756265, 
-    0x6f666e49, 0x3030312e, 0x00000000, 0x0006000b, 0x0000027d, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 
-    0x0003000e, 0x000014e4, 0x00000001, 0x000c000f, 0x000014c1, 0x0000002f, 0x6e656772, 0x6e69614d, 0x00000000, 
-    0x000002ba, 0x00000081, 0x00000076, 0x00000142, 0x000002c5, 0x000002df, 0x0012000f, 0x000014c4, 0x000002e7, 
-    0x69686372, 0x69614d74, 0x0000006e, 0x000002ba, 0x00000787, 0x00000653, 0x0000064a, 0x0000035e, 0x00000356, 
-    0x0000034e, 0x00000142, 0x000002c5, 0x0000067a, 0x0000032e, 0x00000334, 0x0009000f, 0x000014c5, 0x00000bad, 
-    0x73696d72, 0x69614d73, 0x0000006e, 0x00000787, 0x00000142, 0x00000bc2, 0x043d0007, 0x00000001, 0x0a0d2a2f, 
-    0x43202a20, 0x7279706f, 0x74686769, 0x29632820, 0x32303220, 0x30322d33, 0x202c3532, 0x4449564e, 0x43204149, 
-    0x4f50524f, 0x49544152, 0x202e4e4f, 0x6c6c4120, 0x67697220, 0x20737468, 0x65736572, 0x64657672, 0x200a0d2e, 
-    0x200a0d2a, 0x694c202a, 0x736e6563, 0x75206465, 0x7265646e, 0x65687420, 0x61704120, 0x20656863, 0x6563694c, 
-    0x2c65736e, 0x72655620, 0x6e6f6973, 0x302e3220, 0x68742820, 0x4c222065, 0x6e656369, 0x29226573, 0x200a0d3b, 
-    0x6f79202a, 0x616d2075, 0x6f6e2079, 0x73752074, 0x68742065, 0x66207369, 0x20656c69, 0x65637865, 0x69207470, 
-    0x6f63206e, 0x696c706d, 0x65636e61, 0x74697720, 0x68742068, 0x694c2065, 0x736e6563, 0x0a0d2e65, 0x59202a20, 
-    0x6d20756f, 0x6f207961, 0x69617462, 0x2061206e, 0x79706f63, 0x20666f20, 0x20656874, 0x6563694c, 0x2065736e, 
-    0x0a0d7461, 0x0a0d2a20, 0x20202a20, 0x68202020, 0x3a707474, 0x77772f2f, 0x70612e77, 0x65686361, 0x67726f2e, 
-    0x63696c2f, 0x65736e65, 0x494c2f73, 0x534e4543, 0x2e322d45, 0x200a0d30, 0x200a0d2a, 0x6e55202a, 0x7373656c, 
-    0x71657220, 0x65726975, 0x79622064, 0x70706120, 0x6163696c, 0x20656c62, 0x2077616c, 0x6120726f, 0x65657267, 
-    0x6f742064, 0x206e6920, 0x74697277, 0x2c676e69, 0x666f7320, 0x72617774, 0x200a0d65, 0x6964202a, 0x69727473, 
-    0x65747562, 0x6e752064, 0x20726564, 0x20656874, 0x6563694c, 0x2065736e, 0x64207369, 0x72747369, 0x74756269, 
-    0x6f206465, 0x6e61206e, 0x53412220, 0x22534920, 0x53414220, 0x0d2c5349, 0x202a200a, 0x48544957, 0x2054554f, 
-    0x52524157, 0x49544e41, 0x4f205345, 0x4f432052, 0x5449444e, 0x534e4f49, 0x20464f20, 0x20594e41, 0x444e494b, 
-    0x6965202c, 0x72656874, 0x70786520, 0x73736572, 0x20726f20, 0x6c706d69, 0x2e646569, 0x2a200a0d, 0x65655320, 
-    0x65687420, 0x63694c20, 0x65736e65, 0x726f6620, 0x65687420, 0x65707320, 0x69666963, 0x616c2063, 0x6175676e, 
-    0x67206567, 0x7265766f, 0x676e696e, 0x72657020, 0x7373696d, 0x736e6f69, 0x646e6120, 0x2a200a0d, 0x6d696c20, 
-    0x74617469, 0x736e6f69, 0x646e7520, 0x74207265, 0x4c206568, 0x6e656369, 0x0d2e6573, 0x0d2a200a, 0x202a200a, 
-    0x58445053, 0x6c69462d, 0x706f4365, 0x67697279, 0x65547468, 0x203a7478, 0x79706f43, 0x68676972, 0x63282074, 
-    0x30322029, 0x322d3332, 0x2c353230, 0x49564e20, 0x20414944, 0x50524f43, 0x5441524f, 0x2e4e4f49, 0x2a200a0d, 
-    0x44505320, 0x694c2d58, 0x736e6563, 0x64492d65, 0x69746e65, 0x72656966, 0x7041203a, 0x65686361, 0x302e322d, 
-    0x2a200a0d, 0x0d0a0d2f, 0x6669230a, 0x6665646e, 0x414c5320, 0x545f474e, 0x53455059, 0x0a0d485f, 0x66656423, 
-    0x20656e69, 0x4e414c53, 0x59545f47, 0x5f534550, 0x0d0a0d48, 0x202f2f0a, 0x73696854, 0x61656820, 0x20726564, 
-    0x766f7270, 0x73656469, 0x70797420, 0x65642065, 0x696e6966, 0x6e6f6974, 0x6e612073, 0x6c612064, 0x65736169, 
-    0x6f742073, 0x69726220, 0x20656764, 0x77746562, 0x206e6565, 0x6e616c53, 0x68732067, 0x72656461, 0x70797420, 
-    0x202c7365, 0x202b2b43, 0x204d4c47, 0x65707974, 0x61202c73, 0x4720646e, 0x204c534c, 0x65707974, 0x0a0d2e73, 
-    0x49202f2f, 0x6e652074, 0x656c6261, 0x65732073, 0x656c6d61, 0x64207373, 0x20617461, 0x72616873, 0x20676e69, 
-    0x77746562, 0x206e6565, 0x64616873, 0x63207265, 0x2065646f, 0x20646e61, 0x74736f68, 0x646f6320, 0x68772065, 
-    0x20656c69, 0x6e69616d, 0x6e696174, 0x20676e69, 0x65707974, 0x66617320, 0x2e797465, 0x0a0d0a0d, 0x64666923, 
-    0x5f206665, 0x6c70635f, 0x6c707375, 0x0a0d7375, 0x636e6923, 0x6564756c, 0x6c673c20, 0x6c672f6d, 0x70682e6d, 
-    0x0a0d3e70, 0x2f2f0a0d, 0x206e4920, 0x2c2b2b43, 0x20657720, 0x20747570, 0x206c6c61, 0x7420666f, 0x73206568, 
-    0x65726168, 0x79742064, 0x20736570, 0x20646e61, 0x636e7566, 0x6e6f6974, 0x6e692073, 0x74206f74, 0x27206568, 
-    0x64616873, 0x6f697265, 0x616e2027, 0x7073656d, 0x2e656361, 0x2f2f0a0d, 0x20655720, 0x766f7270, 0x20656469, 
-    0x20656874, 0x6f6c6562, 0x616d2077, 0x736f7263, 0x206f7420, 0x6c616564, 0x74697720, 0x68742068, 0x61662065, 
-    0x74207463, 0x20746168, 0x20746f6e, 0x206c6c61, 0x676e616c, 0x65676175, 0x69232073, 0x756c636e, 0x69276564, 
-    0x7420676e, 0x20736968, 0x64616568, 0x61207265, 0x61757463, 0x20796c6c, 0x70707573, 0x2074726f, 0x656d616e, 
-    0x63617073, 0x0d2e7365, 0x6564230a, 0x656e6966, 0x4d414e20, 0x41505345, 0x535f4543, 0x45444148, 0x5f4f4952, 
-    0x49474542, 0x2029284e, 0x656d616e, 0x63617073, 0x68732065, 0x72656461, 0x7b206f69, 0x64230a0d, 0x6e696665, 
-    0x414e2065, 0x5053454d, 0x5f454341, 0x44414853, 0x4f495245, 0x444e455f, 0x7d202928, 0x2f2f2020, 0x6d616e20, 
-    0x61707365, 0x73206563, 0x65646168, 0x0d6f6972, 0x4e0a0d0a, 0x53454d41, 0x45434150, 0x4148535f, 0x49524544, 
-    0x45425f4f, 0x284e4947, 0x0d0a0d29, 0x6973750a, 0x6e20676e, 0x73656d61, 0x65636170, 0x6d6c6720, 0x2f20203b, 
-    0x6d69202f, 0x74726f70, 0x6c6c6120, 0x20666f20, 0x206d6c67, 0x6f746e69, 0x65687420, 0x61687320, 0x69726564, 
-    0x616e206f, 0x7073656d, 0x0d656361, 0x2f0a0d0a, 0x7954202f, 0x61206570, 0x7361696c, 0x74207365, 0x616d206f, 
-    0x20686374, 0x6e616c53, 0x68732067, 0x72656461, 0x70797420, 0x77207365, 0x20687469, 0x202b2b43, 0x204d4c47, 
-    0x65707974, 0x750a0d73, 0x676e6973, 0x6f6c6620, 0x78347461, 0x203d2034, 0x3a6d6c67, 0x74616d3a, 0x0a0d3b34, 
-    0x6e697375, 0x6c662067, 0x3474616f, 0x3d203378, 0x6d6c6720, 0x616d3a3a, 0x33783474, 0x750a0d3b, 0x676e6973, 
-    0x6f6c6620, 0x78337461, 0x203d2034, 0x3a6d6c67, 0x74616d3a, 0x3b347833, 0x73750a0d, 0x20676e69, 0x616f6c66, 
-    0x33783374, 0x67203d20, 0x3a3a6d6c, 0x3374616d, 0x750a0d3b, 0x676e6973, 0x6f6c6620, 0x78327461, 0x203d2032, 
-    0x3a6d6c67, 0x74616d3a, 0x0a0d3b32, 0x6e697375, 0x6c662067, 0x3274616f, 0x3d203378, 0x6d6c6720, 0x616d3a3a, 
-    0x33783274, 0x750a0d3b, 0x676e6973, 0x6f6c6620, 0x78337461, 0x203d2032, 0x3a6d6c67, 0x74616d3a, 0x3b327833, 
-    0x0a0d0a0d, 0x6e697375, 0x6c662067, 0x3274616f, 0x67203d20, 0x3a3a6d6c, 0x32636576, 0x750a0d3b, 0x676e6973, 
-    0x6f6c6620, 0x20347461, 0x6c67203d, 0x763a3a6d, 0x3b346365, 0x73750a0d, 0x20676e69, 0x616f6c66, 0x3d203374, 
-    0x6d6c6720, 0x65763a3a, 0x0d3b3363, 0x750a0d0a, 0x676e6973, 0x746e6920, 0x203d2032, 0x3a6d6c67, 0x6576693a, 
-    0x0d3b3263, 0x6973750a, 0x6920676e, 0x2033746e, 0x6c67203d, 0x693a3a6d, 0x33636576, 0x750a0d3b, 0x676e6973, 
-    0x746e6920, 0x203d2034, 0x3a6d6c67, 0x6576693a, 0x0d3b3463, 0x750a0d0a, 0x676e6973, 0x6e697520, 0x3d202074, 
-    0x736e7520, 0x656e6769, 0x6e692064, 0x0a0d3b74, 0x6e697375, 0x69752067, 0x2032746e, 0x6c67203d, 0x753a3a6d, 
-    0x32636576, 0x750a0d3b, 0x676e6973, 0x6e697520, 0x3d203374, 0x6d6c6720, 0x76753a3a, 0x3b336365, 0x73750a0d, 
-    0x20676e69, 0x746e6975, 0x203d2034, 0x3a6d6c67, 0x6576753a, 0x0d3b3463, 0x750a0d0a, 0x676e6973, 0x6f6f6220, 
-    0x3d20326c, 0x6d6c6720, 0x76623a3a, 0x3b326365, 0x73750a0d, 0x20676e69, 0x6c6f6f62, 0x203d2033, 0x3a6d6c67, 
-    0x6576623a, 0x0d3b3363, 0x6973750a, 0x6220676e, 0x346c6f6f, 0x67203d20, 0x3a3a6d6c, 0x63657662, 0x0a0d3b34, 
-    0x2f2f0a0d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2f2f0a0d, 0x6e754620, 0x6f697463, 0x0a0d736e, 0x2d2d2f2f, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d2d2d, 0x2f2f0a0d, 0x6e694c20, 0x20726165, 0x65746e69, 0x6c6f7072, 
-    0x6f697461, 0x6562206e, 0x65657774, 0x7774206e, 0x6176206f, 0x7365756c, 0x61206120, 0x6220646e, 0x69737520, 
-    0x7020676e, 0x6d617261, 0x72657465, 0x69207420, 0x305b206e, 0x0d5d312c, 0x6d65740a, 0x74616c70, 0x743c2065, 
-    0x6e657079, 0x20656d61, 0x0a0d3e54, 0x656c2054, 0x54287072, 0x202c6120, 0x2c622054, 0x74205420, 0x7b0a0d29, 
-    0x20200a0d, 0x75746572, 0x67206e72, 0x3a3a6d6c, 0x2878696d, 0x62202c61, 0x2974202c, 0x7d0a0d3b, 0x0a0d0a0d, 
-    0x706d6574, 0x6574616c, 0x6c673c20, 0x6c3a3a6d, 0x74676e65, 0x20745f68, 0x74202c4e, 0x6e657079, 0x20656d61, 
-    0x6c616353, 0x79547261, 0x202c6570, 0x3a6d6c67, 0x6175713a, 0x6966696c, 0x50207265, 0x69636572, 0x6e6f6973, 
-    0x670a0d3e, 0x3a3a6d6c, 0x3c636576, 0x53202c4e, 0x616c6163, 0x70795472, 0x50202c65, 0x69636572, 0x6e6f6973, 
-    0x756d203e, 0x6c67286c, 0x763a3a6d, 0x4e3c6365, 0x6353202c, 0x72616c61, 0x65707954, 0x7250202c, 0x73696365, 
-    0x3e6e6f69, 0x202c7620, 0x3a6d6c67, 0x74616d3a, 0x202c4e3c, 0x53202c4e, 0x616c6163, 0x70795472, 0x50202c65, 
-    0x69636572, 0x6e6f6973, 0x294d203e, 0x0d7b0a0d, 0x7220200a, 0x72757465, 0x204d206e, 0x3b76202a, 0x0d7d0a0d, 
-    0x740a0d0a, 0x6c706d65, 0x20657461, 0x6d6c673c, 0x656c3a3a, 0x6874676e, 0x4e20745f, 0x7974202c, 0x616e6570, 
-    0x5320656d, 0x616c6163, 0x70795472, 0x67202c65, 0x3a3a6d6c, 0x6c617571, 0x65696669, 0x72502072, 0x73696365, 
-    0x3e6e6f69, 0x6c670a0d, 0x763a3a6d, 0x4e3c6365, 0x6353202c, 0x72616c61, 0x65707954, 0x7250202c, 0x73696365, 
-    0x3e6e6f69, 0x6c756d20, 0x6d6c6728, 0x616d3a3a, 0x2c4e3c74, 0x202c4e20, 0x6c616353, 0x79547261, 0x202c6570, 
-    0x63657250, 0x6f697369, 0x4d203e6e, 0x6c67202c, 0x763a3a6d, 0x4e3c6365, 0x6353202c, 0x72616c61, 0x65707954, 
-    0x7250202c, 0x73696365, 0x3e6e6f69, 0x0d297620, 0x0a0d7b0a, 0x65722020, 0x6e727574, 0x2a207620, 0x0d3b4d20, 
-    0x0a0d7d0a, 0x65740a0d, 0x616c706d, 0x3c206574, 0x3a6d6c67, 0x6e656c3a, 0x5f687467, 0x2c4e2074, 0x70797420, 
-    0x6d616e65, 0x63532065, 0x72616c61, 0x65707954, 0x6c67202c, 0x713a3a6d, 0x696c6175, 0x72656966, 0x65725020, 
-    0x69736963, 0x0d3e6e6f, 0x6d6c670a, 0x616d3a3a, 0x2c4e3c74, 0x202c4e20, 0x6c616353, 0x79547261, 0x202c6570, 
-    0x63657250, 0x6f697369, 0x6d203e6e, 0x67286c75, 0x3a3a6d6c, 0x3c74616d, 0x4e202c4e, 0x6353202c, 0x72616c61, 
-    0x65707954, 0x7250202c, 0x73696365, 0x3e6e6f69, 0x202c4120, 0x3a6d6c67, 0x74616d3a, 0x202c4e3c, 0x53202c4e, 
-    0x616c6163, 0x70795472, 0x50202c65, 0x69636572, 0x6e6f6973, 0x2942203e, 0x0d7b0a0d, 0x7220200a, 0x72757465, 
-    0x2042206e, 0x3b41202a, 0x0d7d0a0d, 0x230a0d0a, 0x69666564, 0x5320656e, 0x474e414c, 0x4645445f, 0x544c5541, 
-    0x20297828, 0x7828203d, 0x0d0a0d29, 0x4d414e0a, 0x41505345, 0x535f4543, 0x45444148, 0x5f4f4952, 0x28444e45, 
-    0x0d0a0d29, 0x6c65230a, 0x64206669, 0x6e696665, 0x47286465, 0x6f635f4c, 0x705f6572, 0x69666f72, 0x2029656c, 
-    0x202f2f20, 0x4c534c47, 0x0a0d0a0d, 0x66656423, 0x20656e69, 0x454d414e, 0x43415053, 0x48535f45, 0x52454441, 
-    0x425f4f49, 0x4e494745, 0x0a0d2928, 0x66656423, 0x20656e69, 0x454d414e, 0x43415053, 0x48535f45, 0x52454441, 
-    0x455f4f49, 0x2928444e, 0x0a0d0a0d, 0x47202f2f, 0x204c534c, 0x65707974, 0x66656420, 0x74696e69, 0x736e6f69, 
-    0x64230a0d, 0x6e696665, 0x6c662065, 0x3474616f, 0x6d203478, 0x0d347461, 0x6564230a, 0x656e6966, 0x6f6c6620, 
-    0x78347461, 0x616d2033, 0x33783474, 0x64230a0d, 0x6e696665, 0x6c662065, 0x3374616f, 0x6d203478, 0x78337461, 
-    0x230a0d34, 0x69666564, 0x6620656e, 0x74616f6c, 0x20337833, 0x3374616d, 0x64230a0d, 0x6e696665, 0x6c662065, 
-    0x3274616f, 0x6d203278, 0x0d327461, 0x6564230a, 0x656e6966, 0x6f6c6620, 0x78327461, 0x616d2033, 0x33783274, 
-    0x64230a0d, 0x6e696665, 0x6c662065, 0x3374616f, 0x6d203278, 0x78337461, 0x0d0a0d32, 0x6564230a, 0x656e6966, 
-    0x6f6c6620, 0x20327461, 0x32636576, 0x64230a0d, 0x6e696665, 0x6c662065, 0x3374616f, 0x63657620, 0x230a0d33, 
-    0x69666564, 0x6620656e, 0x74616f6c, 0x65762034, 0x0a0d3463, 0x64230a0d, 0x6e696665, 0x6e692065, 0x69203274, 
-    0x32636576, 0x64230a0d, 0x6e696665, 0x6e692065, 0x69203374, 0x33636576, 0x64230a0d, 0x6e696665, 0x6e692065, 
-    0x69203474, 0x34636576, 0x0a0d0a0d, 0x66656423, 0x20656e69, 0x746e6975, 0x76752032, 0x0d326365, 0x6564230a, 
-    0x656e6966, 0x6e697520, 0x75203374, 0x33636576, 0x64230a0d, 0x6e696665, 0x69752065, 0x2034746e, 0x63657675, 
-    0x0d0a0d34, 0x6564230a, 0x656e6966, 0x6f6f6220, 0x6220326c, 0x32636576, 0x64230a0d, 0x6e696665, 0x6f622065, 
-    0x20336c6f, 0x63657662, 0x230a0d33, 0x69666564, 0x6220656e, 0x346c6f6f, 0x65766220, 0x0a0d3463, 0x2f2f0a0d, 
-    0x6e754620, 0x6f697463, 0x0a0d736e, 0x66656423, 0x20656e69, 0x7072656c, 0x78696d20, 0x64230a0d, 0x6e696665, 
-    0x74612065, 0x20326e61, 0x6e617461, 0x64230a0d, 0x6e696665, 0x73612065, 0x746e6975, 0x6f6c6620, 0x69427461, 
-    0x6f547374, 0x746e6955, 0x64230a0d, 0x6e696665, 0x73612065, 0x616f6c66, 0x69752074, 0x6942746e, 0x6f547374, 
-    0x616f6c46, 0x0d0a0d74, 0x6564230a, 0x656e6966, 0x61747320, 0x0d636974, 0x6564230a, 0x656e6966, 0x6c6e6920, 
-    0x0d656e69, 0x230a0d0a, 0x69666564, 0x5320656e, 0x474e414c, 0x4645445f, 0x544c5541, 0x0d297828, 0x0d0a0d0a, 
-    0x6365760a, 0x756d2033, 0x6576286c, 0x61203363, 0x616d202c, 0x62203374, 0x7b0a0d29, 0x20200a0d, 0x75746572, 
-    0x62206e72, 0x61202a20, 0x7d0a0d3b, 0x0a0d0a0d, 0x3374616d, 0x6c756d20, 0x74616d28, 0x2c612033, 0x74616d20, 
-    0x29622033, 0x0d7b0a0d, 0x7220200a, 0x72757465, 0x2062206e, 0x3b61202a, 0x0d7d0a0d, 0x230a0d0a, 0x66696c65, 
-    0x535f5f20, 0x474e414c, 0x0a0d5f5f, 0x64230a0d, 0x6e696665, 0x414e2065, 0x5053454d, 0x5f454341, 0x44414853, 
-    0x4f495245, 0x4745425f, 0x29284e49, 0x64230a0d, 0x6e696665, 0x414e2065, 0x5053454d, 0x5f454341, 0x44414853, 
-    0x4f495245, 0x444e455f, 0x0a0d2928, 0x64230a0d, 0x6e696665, 0x4c532065, 0x5f474e41, 0x41464544, 0x28544c55, 
-    0x3d202978, 0x29782820, 0x5f5f0a0d, 0x72746e69, 0x69736e69, 0x706f5f63, 0x706d6328, 0x20295447, 0x6c627570, 
-    0x76206369, 0x6f746365, 0x6f623c72, 0x202c6c6f, 0x67203e4e, 0x74616572, 0x68547265, 0x543c6e61, 0x656c202c, 
-    0x204e2074, 0x6e69203a, 0x76283e74, 0x6f746365, 0x2c543c72, 0x203e4e20, 0x76202c78, 0x6f746365, 0x2c543c72, 
-    0x203e4e20, 0x0d3b2979, 0x230a0d0a, 0x65736c65, 0x0a0d0a0d, 0x72726523, 0x2220726f, 0x6e6b6e55, 0x206e776f, 
-    0x676e616c, 0x65676175, 0x766e6520, 0x6e6f7269, 0x746e656d, 0x0d0a0d22, 0x6e65230a, 0x20666964, 0x202f2f20, 
-    0x70635f5f, 0x7073756c, 0x0d73756c, 0x230a0d0a, 0x69646e65, 0x2f202066, 0x4c53202f, 0x5f474e41, 0x45505954, 
-    0x0d485f53, 0x0000000a, 0x00100007, 0x00000005, 0x575c3a46, 0x6f646e69, 0x445c7377, 0x746b7365, 0x6e5c706f, 
-    0x6f727076, 0x726f635f, 0x6e5c3265, 0x61687376, 0x73726564, 0x616c735c, 0x745f676e, 0x73657079, 0x0000682e, 
-    0x01b80007, 0x0000000b, 0x0a0d2a2f, 0x43202a20, 0x7279706f, 0x74686769, 0x29632820, 0x32303220, 0x30322d34, 
-    0x202c3532, 0x4449564e, 0x43204149, 0x4f50524f, 0x49544152, 0x202e4e4f, 0x6c6c4120, 0x67697220, 0x20737468, 
-    0x65736572, 0x64657672, 0x200a0d2e, 0x200a0d2a, 0x694c202a, 0x736e6563, 0x75206465, 0x7265646e, 0x65687420, 
-    0x61704120, 0x20656863, 0x6563694c, 0x2c65736e, 0x72655620, 0x6e6f6973, 0x302e3220, 0x68742820, 0x4c222065, 
-    0x6e656369, 0x29226573, 0x200a0d3b, 0x6f79202a, 0x616d2075, 0x6f6e2079, 0x73752074, 0x68742065, 0x66207369, 
-    0x20656c69, 0x65637865, 0x69207470, 0x6f63206e, 0x696c706d, 0x65636e61, 0x74697720, 0x68742068, 0x694c2065, 
-    0x736e6563, 0x0a0d2e65, 0x59202a20, 0x6d20756f, 0x6f207961, 0x69617462, 0x2061206e, 0x79706f63, 0x20666f20, 
-    0x20656874, 0x6563694c, 0x2065736e, 0x0a0d7461, 0x0a0d2a20, 0x20202a20, 0x68202020, 0x3a707474, 0x77772f2f, 
-    0x70612e77, 0x65686361, 0x67726f2e, 0x63696c2f, 0x65736e65, 0x494c2f73, 0x534e4543, 0x2e322d45, 0x200a0d30, 
-    0x200a0d2a, 0x6e55202a, 0x7373656c, 0x71657220, 0x65726975, 0x79622064, 0x70706120, 0x6163696c, 0x20656c62, 
-    0x2077616c, 0x6120726f, 0x65657267, 0x6f742064, 0x206e6920, 0x74697277, 0x2c676e69, 0x666f7320, 0x72617774, 
-    0x200a0d65, 0x6964202a, 0x69727473, 0x65747562, 0x6e752064, 0x20726564, 0x20656874, 0x6563694c, 0x2065736e, 
-    0x64207369, 0x72747369, 0x74756269, 0x6f206465, 0x6e61206e, 0x53412220, 0x22534920, 0x53414220, 0x0d2c5349, 
-    0x202a200a, 0x48544957, 0x2054554f, 0x52524157, 0x49544e41, 0x4f205345, 0x4f432052, 0x5449444e, 0x534e4f49, 
-    0x20464f20, 0x20594e41, 0x444e494b, 0x6965202c, 0x72656874, 0x70786520, 0x73736572, 0x20726f20, 0x6c706d69, 
-    0x2e646569, 0x2a200a0d, 0x65655320, 0x65687420, 0x63694c20, 0x65736e65, 0x726f6620, 0x65687420, 0x65707320, 
-    0x69666963, 0x616c2063, 0x6175676e, 0x67206567, 0x7265766f, 0x676e696e, 0x72657020, 0x7373696d, 0x736e6f69, 
-    0x646e6120, 0x2a200a0d, 0x6d696c20, 0x74617469, 0x736e6f69, 0x646e7520, 0x74207265, 0x4c206568, 0x6e656369, 
-    0x0d2e6573, 0x0d2a200a, 0x202a200a, 0x58445053, 0x6c69462d, 0x706f4365, 0x67697279, 0x65547468, 0x203a7478, 
-    0x79706f43, 0x68676972, 0x63282074, 0x30322029, 0x322d3432, 0x2c353230, 0x49564e20, 0x20414944, 0x50524f43, 
-    0x5441524f, 0x2e4e4f49, 0x2a200a0d, 0x44505320, 0x694c2d58, 0x736e6563, 0x64492d65, 0x69746e65, 0x72656966, 
-    0x7041203a, 0x65686361, 0x302e322d, 0x2a200a0d, 0x0d0a0d2f, 0x230a0d0a, 0x646e6669, 0x43206665, 0x54534e4f, 
-    0x53544e41, 0x414c535f, 0x0a0d474e, 0x66656423, 0x20656e69, 0x534e4f43, 0x544e4154, 0x4c535f53, 0x0d474e41, 
-    0x230a0d0a, 0x6c636e69, 0x20656475, 0x616c7322, 0x745f676e, 0x73657079, 0x0d22682e, 0x4e0a0d0a, 0x53454d41, 
-    0x45434150, 0x4148535f, 0x49524544, 0x45425f4f, 0x284e4947, 0x0d0a0d29, 0x6669230a, 0x6665646e, 0x505f4d20, 
-    0x730a0d49, 0x69746174, 0x6f632063, 0x2074736e, 0x616f6c66, 0x5f4d2074, 0x3d204950, 0x312e3320, 0x39353134, 
-    0x33353632, 0x37393835, 0x20203b46, 0x50202f2f, 0x230a0d49, 0x69646e65, 0x0d0a0d66, 0x6669230a, 0x6665646e, 
-    0x545f4d20, 0x505f4f57, 0x730a0d49, 0x69746174, 0x6f632063, 0x2074736e, 0x616f6c66, 0x5f4d2074, 0x5f4f5754, 
-    0x3d204950, 0x322e3620, 0x38313338, 0x37303335, 0x35393731, 0x20203b46, 0x32202f2f, 0x0d49502a, 0x6e65230a, 
-    0x0d666964, 0x230a0d0a, 0x646e6669, 0x4d206665, 0x5f49505f, 0x730a0d32, 0x69746174, 0x6f632063, 0x2074736e, 
-    0x616f6c66, 0x5f4d2074, 0x325f4950, 0x31203d20, 0x3037352e, 0x33363937, 0x39373632, 0x3b463834, 0x2f2f2020, 
-    0x2f495020, 0x230a0d32, 0x69646e65, 0x0d0a0d66, 0x6669230a, 0x6665646e, 0x505f4d20, 0x0d345f49, 0x6174730a, 
-    0x20636974, 0x736e6f63, 0x6c662074, 0x2074616f, 0x49505f4d, 0x3d20345f, 0x372e3020, 0x39333538, 0x33363138, 
-    0x34373933, 0x20203b46, 0x50202f2f, 0x0d342f49, 0x6e65230a, 0x0d666964, 0x230a0d0a, 0x646e6669, 0x4d206665, 
-    0x4f5f315f, 0x5f524556, 0x0a0d4950, 0x74617473, 0x63206369, 0x74736e6f, 0x6f6c6620, 0x4d207461, 0x4f5f315f, 
-    0x5f524556, 0x3d204950, 0x332e3020, 0x30333831, 0x36383839, 0x37333831, 0x20203b46, 0x31202f2f, 0x0d49502f, 
-    0x6e65230a, 0x0d666964, 0x230a0d0a, 0x646e6669, 0x4d206665, 0x4f5f325f, 0x5f524556, 0x0a0d4950, 0x74617473, 
-    0x63206369, 0x74736e6f, 0x6f6c6620, 0x4d207461, 0x4f5f325f, 0x5f524556, 0x3d204950, 0x362e3020, 0x31363633, 
-    0x32373739, 0x35373633, 0x20203b46, 0x32202f2f, 0x0d49502f, 0x6e65230a, 0x0d666964, 0x230a0d0a, 0x646e6669, 
-    0x4d206665, 0x505f315f, 0x730a0d49, 0x69746174, 0x6f632063, 0x2074736e, 0x616f6c66, 0x5f4d2074, 0x49505f31, 
-    0x30203d20, 0x3831332e, 0x38393033, 0x38313638, 0x3b463733, 0x2f2f2020, 0x502f3120, 0x230a0d49, 0x69646e65, 
-    0x0d0a0d66, 0x6669230a, 0x6665646e, 0x464e4920, 0x54494e49, 0x730a0d45, 0x69746174, 0x6f632063, 0x2074736e, 
-    0x616f6c66, 0x4e492074, 0x494e4946, 0x3d204554, 0x33653120, 0x0d3b4632, 0x6e65230a, 0x0d666964, 0x2f0a0d0a, 
-    0x7053202f, 0x61696365, 0x4450206c, 0x61762046, 0x2065756c, 0x75746572, 0x64656e72, 0x20796220, 0x64736260, 
-    0x6d615366, 0x28656c70, 0x74206029, 0x6572206f, 0x73657270, 0x20746e65, 0x69206e61, 0x6e69666e, 0x20657469, 
-    0x75706d69, 0x2065736c, 0x7320726f, 0x75676e69, 0x6972616c, 0x0d2e7974, 0x6669230a, 0x6665646e, 0x52494420, 
-    0x0a0d4341, 0x74617473, 0x63206369, 0x74736e6f, 0x6f6c6620, 0x44207461, 0x43415249, 0x2d203d20, 0x46302e31, 
-    0x230a0d3b, 0x69646e65, 0x0d0a0d66, 0x4d414e0a, 0x41505345, 0x535f4543, 0x45444148, 0x5f4f4952, 0x28444e45, 
-    0x0d0a0d29, 0x6e65230a, 0x20666964, 0x202f2f20, 0x534e4f43, 0x544e4154, 0x4c475f53, 0x00004c53, 0x00110007, 
-    0x0000000d, 0x575c3a46, 0x6f646e69, 0x445c7377, 0x746b7365, 0x6e5c706f, 0x6f727076, 0x726f635f, 0x6e5c3265, 
-    0x61687376, 0x73726564, 0x6e6f635c, 0x6e617473, 0x682e7374, 0x616c732e, 0x0000676e, 0x045f0007, 0x0000000e, 
-    0x0a0d2a2f, 0x43202a20, 0x7279706f, 0x74686769, 0x29632820, 0x32303220, 0x30322d32, 0x202c3532, 0x4449564e, 
-    0x43204149, 0x4f50524f, 0x49544152, 0x202e4e4f, 0x6c6c4120, 0x67697220, 0x20737468, 0x65736572, 0x64657672, 
-    0x200a0d2e, 0x200a0d2a, 0x694c202a, 0x736e6563, 0x75206465, 0x7265646e, 0x65687420, 0x61704120, 0x20656863, 
-    0x6563694c, 0x2c65736e, 0x72655620, 0x6e6f6973, 0x302e3220, 0x68742820, 0x4c222065, 0x6e656369, 0x29226573, 
-    0x200a0d3b, 0x6f79202a, 0x616d2075, 0x6f6e2079, 0x73752074, 0x68742065, 0x66207369, 0x20656c69, 0x65637865, 
-    0x69207470, 0x6f63206e, 0x696c706d, 0x65636e61, 0x74697720, 0x68742068, 0x694c2065, 0x736e6563, 0x0a0d2e65, 
-    0x59202a20, 0x6d20756f, 0x6f207961, 0x69617462, 0x2061206e, 0x79706f63, 0x20666f20, 0x20656874, 0x6563694c, 
-    0x2065736e, 0x0a0d7461, 0x0a0d2a20, 0x20202a20, 0x68202020, 0x3a707474, 0x77772f2f, 0x70612e77, 0x65686361, 
-    0x67726f2e, 0x63696c2f, 0x65736e65, 0x494c2f73, 0x534e4543, 0x2e322d45, 0x200a0d30, 0x200a0d2a, 0x6e55202a, 
-    0x7373656c, 0x71657220, 0x65726975, 0x79622064, 0x70706120, 0x6163696c, 0x20656c62, 0x2077616c, 0x6120726f, 
-    0x65657267, 0x6f742064, 0x206e6920, 0x74697277, 0x2c676e69, 0x666f7320, 0x72617774, 0x200a0d65, 0x6964202a, 
-    0x69727473, 0x65747562, 0x6e752064, 0x20726564, 0x20656874, 0x6563694c, 0x2065736e, 0x64207369, 0x72747369, 
-    0x74756269, 0x6f206465, 0x6e61206e, 0x53412220, 0x22534920, 0x53414220, 0x0d2c5349, 0x202a200a, 0x48544957, 
-    0x2054554f, 0x52524157, 0x49544e41, 0x4f205345, 0x4f432052, 0x5449444e, 0x534e4f49, 0x20464f20, 0x20594e41, 
-    0x444e494b, 0x6965202c, 0x72656874, 0x70786520, 0x73736572, 0x20726f20, 0x6c706d69, 0x2e646569, 0x2a200a0d, 
-    0x65655320, 0x65687420, 0x63694c20, 0x65736e65, 0x726f6620, 0x65687420, 0x65707320, 0x69666963, 0x616c2063, 
-    0x6175676e, 0x67206567, 0x7265766f, 0x676e696e, 0x72657020, 0x7373696d, 0x736e6f69, 0x646e6120, 0x2a200a0d, 
-    0x6d696c20, 0x74617469, 0x736e6f69, 0x646e7520, 0x74207265, 0x4c206568, 0x6e656369, 0x0d2e6573, 0x0d2a200a, 
-    0x202a200a, 0x58445053, 0x6c69462d, 0x706f4365, 0x67697279, 0x65547468, 0x203a7478, 0x79706f43, 0x68676972, 
-    0x63282074, 0x30322029, 0x322d3232, 0x2c353230, 0x49564e20, 0x20414944, 0x50524f43, 0x5441524f, 0x2e4e4f49, 
-    0x2a200a0d, 0x44505320, 0x694c2d58, 0x736e6563, 0x64492d65, 0x69746e65, 0x72656966, 0x7041203a, 0x65686361, 
-    0x302e322d, 0x2a200a0d, 0x0d0a0d2f, 0x6669230a, 0x6665646e, 0x56564e20, 0x5f4c484b, 0x5f524250, 0x5f54414d, 
-    0x55525453, 0x485f5443, 0x64230a0d, 0x6e696665, 0x564e2065, 0x4c484b56, 0x5242505f, 0x54414d5f, 0x5254535f, 
-    0x5f544355, 0x0d312048, 0x230a0d0a, 0x6c636e69, 0x20656475, 0x6e756622, 0x6f697463, 0x682e736e, 0x616c732e, 
-    0x0d22676e, 0x2f0a0d0a, 0x0a0d202a, 0x6c617645, 0x65746175, 0x42502064, 0x616d2052, 0x69726574, 0x63206c61, 
-    0x61746e6f, 0x6e696e69, 0x6c612067, 0x7270206c, 0x7265706f, 0x73656974, 0x65656e20, 0x20646564, 0x20726f66, 
-    0x73796870, 0x6c616369, 0x6220796c, 0x64657361, 0x61687320, 0x676e6964, 0x646e6120, 0x6d617320, 0x6e696c70, 
-    0x0a0d2e67, 0x73696854, 0x20736920, 0x20656874, 0x75736572, 0x6f20746c, 0x76652066, 0x61756c61, 0x676e6974, 
-    0x67206120, 0x2046546c, 0x6574616d, 0x6c616972, 0x74697720, 0x74692068, 0x65742073, 0x72757478, 0x61207365, 
-    0x7020646e, 0x6d617261, 0x72657465, 0x72202c73, 0x79646165, 0x206f7420, 0x75206562, 0x0d646573, 0x2079620a, 
-    0x20656874, 0x646e6572, 0x6e697265, 0x61722f67, 0x72742079, 0x6e696361, 0x79732067, 0x6d657473, 0x726f6620, 
-    0x63636120, 0x74617275, 0x616d2065, 0x69726574, 0x72206c61, 0x6f707365, 0x2065736e, 0x756d6973, 0x6974616c, 
-    0x0d2e6e6f, 0x0d2f2a0a, 0x730a0d0a, 0x63757274, 0x62502074, 0x74614d72, 0x61697265, 0x7b0a0d6c, 0x20200a0d, 
-    0x616f6c66, 0x62203374, 0x43657361, 0x726f6c6f, 0x2f20203b, 0x6162202f, 0x63206573, 0x726f6c6f, 0x20200a0d, 
-    0x616f6c66, 0x6f202074, 0x69636170, 0x203b7974, 0x2f202020, 0x2031202f, 0x706f203d, 0x65757161, 0x2030202c, 
-    0x7566203d, 0x20796c6c, 0x6e617274, 0x72617073, 0x0d746e65, 0x6620200a, 0x74616f6c, 0x6f722032, 0x6e686775, 
-    0x3b737365, 0x2f2f2020, 0x3d203020, 0x6f6d7320, 0x2c68746f, 0x3d203120, 0x756f7220, 0x28206867, 0x73696e61, 
-    0x6f72746f, 0x3a636970, 0x3d207820, 0x202c5520, 0x203d2079, 0x0a0d2956, 0x6c662020, 0x2074616f, 0x74656d20, 
-    0x696c6c61, 0x20203b63, 0x202f2f20, 0x203d2030, 0x6c656964, 0x72746365, 0x202c6369, 0x203d2031, 0x6174656d, 
-    0x63696c6c, 0x20200a0d, 0x616f6c66, 0x65203374, 0x7373696d, 0x3b657669, 0x2f202020, 0x6d65202f, 0x69737369, 
-    0x63206576, 0x726f6c6f, 0x20200a0d, 0x616f6c66, 0x6f202074, 0x756c6363, 0x6e6f6973, 0x2f20203b, 0x636f202f, 
-    0x73756c63, 0x206e6f69, 0x74636166, 0x0a0d726f, 0x20200a0d, 0x616f6c66, 0x4e203374, 0x2020203b, 0x73202f2f, 
-    0x69646168, 0x6e20676e, 0x616d726f, 0x200a0d6c, 0x6f6c6620, 0x20337461, 0x20203b54, 0x202f2f20, 0x676e6174, 
-    0x0d746e65, 0x6620200a, 0x74616f6c, 0x3b422033, 0x2f202020, 0x6962202f, 0x676e6174, 0x0d746e65, 0x6620200a, 
-    0x74616f6c, 0x674e2033, 0x2f20203b, 0x6567202f, 0x74656d6f, 0x20636972, 0x6d726f6e, 0x0a0d6c61, 0x0a0d0a0d, 
-    0x6c662020, 0x2074616f, 0x31726f69, 0x2020203b, 0x20202020, 0x202f2f20, 0x65646e69, 0x666f2078, 0x66657220, 
-    0x74636172, 0x206e6f69, 0x7563203a, 0x6e657272, 0x656d2074, 0x6d756964, 0x2e692820, 0x61202e65, 0x0d297269, 
-    0x6620200a, 0x74616f6c, 0x726f6920, 0x20203b32, 0x20202020, 0x2f2f2020, 0x646e6920, 0x6f207865, 0x65722066, 
-    0x63617266, 0x6e6f6974, 0x74203a20, 0x6f206568, 0x72656874, 0x64697320, 0x69282065, 0x202e652e, 0x73616c67, 
-    0x0a0d2973, 0x6c662020, 0x2074616f, 0x70736964, 0x69737265, 0x203b6e6f, 0x202f2f20, 0x5f52484b, 0x6574616d, 
-    0x6c616972, 0x70735f73, 0x6c756365, 0x0a0d7261, 0x20200a0d, 0x616f6c66, 0x73202074, 0x75636570, 0x3b72616c, 
-    0x20202020, 0x2f202020, 0x6577202f, 0x74686769, 0x20666f20, 0x20656874, 0x6c656964, 0x72746365, 0x73206369, 
-    0x75636570, 0x2072616c, 0x6579616c, 0x200a0d72, 0x6f6c6620, 0x20337461, 0x63657073, 0x72616c75, 0x6f6c6f43, 
-    0x20203b72, 0x63202f2f, 0x726f6c6f, 0x20666f20, 0x20656874, 0x6c656964, 0x72746365, 0x73206369, 0x75636570, 
-    0x2072616c, 0x6579616c, 0x200a0d72, 0x6f6c6620, 0x20207461, 0x6e617274, 0x73696d73, 0x6e6f6973, 0x2020203b, 
-    0x4b202f2f, 0x6d5f5248, 0x72657461, 0x736c6169, 0x6172745f, 0x696d736e, 0x6f697373, 0x0d0a0d6e, 0x6620200a, 
-    0x74616f6c, 0x74612033, 0x756e6574, 0x6f697461, 0x6c6f436e, 0x203b726f, 0x20202020, 0x4b202f2f, 0x6d5f5248, 
-    0x72657461, 0x736c6169, 0x6c6f765f, 0x0d656d75, 0x6620200a, 0x74616f6c, 0x74612020, 0x756e6574, 0x6f697461, 
-    0x7369446e, 0x636e6174, 0x20203b65, 0x0a0d2f2f, 0x6f622020, 0x20206c6f, 0x54736920, 0x576e6968, 0x656c6c61, 
-    0x20203b64, 0x20202020, 0x2f202020, 0x6552202f, 0x63616c70, 0x6f662065, 0x73692072, 0x6e696854, 0x6c6c6157, 
-    0x0d3f6465, 0x200a0d0a, 0x6f6c6620, 0x20207461, 0x61656c63, 0x616f6372, 0x20203b74, 0x20202020, 0x20202020, 
-    0x202f2f20, 0x5f52484b, 0x6574616d, 0x6c616972, 0x6c635f73, 0x63726165, 0x0d74616f, 0x6620200a, 0x74616f6c, 
-    0x6c632020, 0x63726165, 0x5274616f, 0x6867756f, 0x7373656e, 0x2f20203b, 0x200a0d2f, 0x6f6c6620, 0x20337461, 
-    0x203b634e, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x202f2f20, 0x61656c63, 0x616f6372, 0x6f6e2074, 
-    0x6c616d72, 0x0a0d0a0d, 0x6c662020, 0x2074616f, 0x64697269, 0x65637365, 0x3b65636e, 0x2f2f2020, 0x52484b20, 
-    0x74616d5f, 0x61697265, 0x695f736c, 0x65646972, 0x6e656373, 0x0a0d6563, 0x6c662020, 0x2074616f, 0x64697269, 
-    0x65637365, 0x4965636e, 0x0d3b726f, 0x6620200a, 0x74616f6c, 0x69726920, 0x63736564, 0x65636e65, 0x63696854, 
-    0x73656e6b, 0x0a0d3b73, 0x20200a0d, 0x616f6c66, 0x73203374, 0x6e656568, 0x6f6c6f43, 0x20203b72, 0x4b202f2f, 
-    0x6d5f5248, 0x72657461, 0x736c6169, 0x6568735f, 0x0a0d6e65, 0x6c662020, 0x2074616f, 0x65687320, 0x6f526e65, 
-    0x6e686775, 0x3b737365, 0x0a0d0a0d, 0x6c662020, 0x2074616f, 0x66696420, 0x65737566, 0x6e617254, 0x73696d73, 
-    0x6e6f6973, 0x74636146, 0x203b726f, 0x202f2f20, 0x5f52484b, 0x6574616d, 0x6c616972, 0x69645f73, 0x73756666, 
-    0x72745f65, 0x6d736e61, 0x69737369, 0x0a0d6e6f, 0x6c662020, 0x3374616f, 0x66696420, 0x65737566, 0x6e617254, 
-    0x73696d73, 0x6e6f6973, 0x6f6c6f43, 0x0a0d3b72, 0x0a0d3b7d, 0x2a2f0a0d, 0x440a0d20, 0x75616665, 0x5020746c, 
-    0x6d205242, 0x72657461, 0x206c6169, 0x68746977, 0x6c6c6120, 0x6f727020, 0x74726570, 0x20736569, 0x20746573, 
-    0x64206f74, 0x75616665, 0x7620746c, 0x65756c61, 0x0a0d2e73, 0x73696854, 0x6e756620, 0x6f697463, 0x6e69206e, 
-    0x61697469, 0x657a696c, 0x20612073, 0x4d726250, 0x72657461, 0x206c6169, 0x75727473, 0x72757463, 0x69772065, 
-    0x74206874, 0x63697079, 0x76206c61, 0x65756c61, 0x6f662073, 0x20612072, 0x66666964, 0x20657375, 0x6574616d, 
-    0x6c616972, 0x2a0a0d2e, 0x500a0d2f, 0x614d7262, 0x69726574, 0x64206c61, 0x75616665, 0x6250746c, 0x74614d72, 
-    0x61697265, 0x0d29286c, 0x0a0d7b0a, 0x62502020, 0x74614d72, 0x61697265, 0x616d206c, 0x0a0d3b74, 0x616d2020, 
-    0x61622e74, 0x6f436573, 0x20726f6c, 0x6c66203d, 0x3374616f, 0x302e3128, 0x0d3b2946, 0x6d20200a, 0x6f2e7461, 
-    0x69636170, 0x20207974, 0x31203d20, 0x3b46302e, 0x20200a0d, 0x2e74616d, 0x67756f72, 0x73656e68, 0x203d2073, 
-    0x616f6c66, 0x31283274, 0x2946302e, 0x200a0d3b, 0x74616d20, 0x74656d2e, 0x696c6c61, 0x3d202063, 0x302e3120, 
-    0x0a0d3b46, 0x616d2020, 0x6d652e74, 0x69737369, 0x20206576, 0x6c66203d, 0x3374616f, 0x302e3028, 0x0d3b2946, 
-    0x200a0d0a, 0x74616d20, 0x20204e2e, 0x6c66203d, 0x3374616f, 0x302e3028, 0x30202c46, 0x2c46302e, 0x302e3120, 
-    0x0d3b2946, 0x6d20200a, 0x4e2e7461, 0x203d2067, 0x616f6c66, 0x30283374, 0x2c46302e, 0x302e3020, 0x31202c46, 
-    0x2946302e, 0x200a0d3b, 0x74616d20, 0x2020542e, 0x6c66203d, 0x3374616f, 0x302e3128, 0x30202c46, 0x2c46302e, 
-    0x302e3020, 0x0d3b2946, 0x6d20200a, 0x422e7461, 0x203d2020, 0x616f6c66, 0x30283374, 0x2c46302e, 0x302e3120, 
-    0x30202c46, 0x2946302e, 0x0d0a0d3b, 0x6d20200a, 0x692e7461, 0x2031726f, 0x20202020, 0x203d2020, 0x46302e31, 
-    0x200a0d3b, 0x74616d20, 0x726f692e, 0x20202032, 0x20202020, 0x2e31203d, 0x0d3b4635, 0x6d20200a, 0x642e7461, 
-    0x65707369, 0x6f697372, 0x203d206e, 0x46302e30, 0x0d0a0d3b, 0x6d20200a, 0x732e7461, 0x75636570, 0x2072616c, 
-    0x20202020, 0x31203d20, 0x3b46302e, 0x20200a0d, 0x2e74616d, 0x63657073, 0x72616c75, 0x6f6c6f43, 0x203d2072, 
-    0x616f6c66, 0x31283374, 0x2946302e, 0x200a0d3b, 0x74616d20, 0x6172742e, 0x696d736e, 0x6f697373, 0x3d20206e, 
-    0x302e3020, 0x0a0d3b46, 0x20200a0d, 0x2e74616d, 0x65747461, 0x7461756e, 0x436e6f69, 0x726f6c6f, 0x20202020, 
-    0x6c66203d, 0x3374616f, 0x302e3128, 0x0d3b2946, 0x6d20200a, 0x612e7461, 0x6e657474, 0x69746175, 0x69446e6f, 
-    0x6e617473, 0x3d206563, 0x302e3120, 0x0a0d3b46, 0x616d2020, 0x73692e74, 0x6e696854, 0x6c6c6157, 0x20206465, 
-    0x20202020, 0x203d2020, 0x65757274, 0x0d0a0d3b, 0x6d20200a, 0x632e7461, 0x7261656c, 0x74616f63, 0x20202020, 
-    0x20202020, 0x203d2020, 0x46302e30, 0x200a0d3b, 0x74616d20, 0x656c632e, 0x6f637261, 0x6f527461, 0x6e686775, 
-    0x20737365, 0x2e30203d, 0x3b463130, 0x20200a0d, 0x2e74616d, 0x2020634e, 0x20202020, 0x20202020, 0x20202020, 
-    0x3d202020, 0x6f6c6620, 0x28337461, 0x46302e30, 0x2e30202c, 0x202c4630, 0x46302e31, 0x0a0d3b29, 0x20200a0d, 
-    0x2e74616d, 0x64697269, 0x65637365, 0x2065636e, 0x20202020, 0x20202020, 0x30203d20, 0x3b46302e, 0x20200a0d, 
-    0x2e74616d, 0x64697269, 0x65637365, 0x4965636e, 0x2020726f, 0x20202020, 0x31203d20, 0x3b46352e, 0x20200a0d, 
-    0x2e74616d, 0x64697269, 0x65637365, 0x5465636e, 0x6b636968, 0x7373656e, 0x30203d20, 0x3b46312e, 0x0a0d0a0d, 
-    0x616d2020, 0x68732e74, 0x436e6565, 0x726f6c6f, 0x20202020, 0x66203d20, 0x74616f6c, 0x2e302833, 0x3b294630, 
-    0x20200a0d, 0x2e74616d, 0x65656873, 0x756f526e, 0x656e6867, 0x3d207373, 0x302e3020, 0x0a0d3b46, 0x616d2020, 
-    0x636f2e74, 0x73756c63, 0x206e6f69, 0x20202020, 0x31203d20, 0x3b46302e, 0x0a0d0a0d, 0x616d2020, 0x69642e74, 
-    0x73756666, 0x61725465, 0x696d736e, 0x6f697373, 0x6361466e, 0x20726f74, 0x2e30203d, 0x0d3b4630, 0x6d20200a, 
-    0x642e7461, 0x75666669, 0x72546573, 0x6d736e61, 0x69737369, 0x6f436e6f, 0x20726f6c, 0x66203d20, 0x74616f6c, 
-    0x2e312833, 0x3b294630, 0x0a0d0a0d, 0x65722020, 0x6e727574, 0x74616d20, 0x7d0a0d3b, 0x0a0d0a0d, 0x0d202a2f, 
-    0x6665440a, 0x746c7561, 0x52425020, 0x74616d20, 0x61697265, 0x6977206c, 0x61206874, 0x70206c6c, 0x65706f72, 
-    0x65697472, 0x65732073, 0x6f742074, 0x66656420, 0x746c7561, 0x6c617620, 0x2e736575, 0x68540a0d, 0x66207369, 
-    0x74636e75, 0x206e6f69, 0x74696e69, 0x696c6169, 0x2073657a, 0x62502061, 0x74614d72, 0x61697265, 0x7473206c, 
-    0x74637572, 0x20657275, 0x68746977, 0x70797420, 0x6c616369, 0x6c617620, 0x20736575, 0x20726f66, 0x69642061, 
-    0x73756666, 0x616d2065, 0x69726574, 0x0d2e6c61, 0x0d2f2a0a, 0x7262500a, 0x6574614d, 0x6c616972, 0x66656420, 
-    0x746c7561, 0x4d726250, 0x72657461, 0x286c6169, 0x616f6c66, 0x62203374, 0x43657361, 0x726f6c6f, 0x6c66202c, 
-    0x2074616f, 0x6174656d, 0x63696c6c, 0x6c66202c, 0x2074616f, 0x67756f72, 0x73656e68, 0x66202c73, 0x74616f6c, 
-    0x2c4e2033, 0x6f6c6620, 0x20337461, 0x0d29674e, 0x0a0d7b0a, 0x62502020, 0x74614d72, 0x61697265, 0x616d206c, 
-    0x203d2074, 0x61666564, 0x50746c75, 0x614d7262, 0x69726574, 0x29286c61, 0x200a0d3b, 0x74616d20, 0x7361622e, 
-    0x6c6f4365, 0x2020726f, 0x62203d20, 0x43657361, 0x726f6c6f, 0x200a0d3b, 0x74616d20, 0x74656d2e, 0x696c6c61, 
-    0x20202063, 0x6d203d20, 0x6c617465, 0x3b63696c, 0x20200a0d, 0x2e74616d, 0x67756f72, 0x73656e68, 0x20202073, 
-    0x6c66203d, 0x3274616f, 0x756f7228, 0x656e6867, 0x2a207373, 0x756f7220, 0x656e6867, 0x3b297373, 0x20200a0d, 
-    0x2e74616d, 0x2020674e, 0x20202020, 0x20202020, 0x674e203d, 0x200a0d3b, 0x74616d20, 0x20204e2e, 0x20202020, 
-    0x20202020, 0x4e203d20, 0x200a0d3b, 0x74726f20, 0x6f6e6f68, 0x6c616d72, 0x69736142, 0x616d2873, 0x2c4e2e74, 
-    0x74616d20, 0x202c542e, 0x2e74616d, 0x0d3b2942, 0x200a0d0a, 0x74657220, 0x206e7275, 0x3b74616d, 0x0d7d0a0d, 
-    0x6e65230a, 0x20666964, 0x202f2f20, 0x4b56564e, 0x505f4c48, 0x4d5f5242, 0x535f5441, 0x43555254, 0x0d485f54, 
-    0x0000000a, 0x00130007, 0x00000010, 0x575c3a46, 0x6f646e69, 0x445c7377, 0x746b7365, 0x6e5c706f, 0x6f727076, 
-    0x726f635f, 0x6e5c3265, 0x61687376, 0x73726564, 0x7262705c, 0x74616d5f, 0x61697265, 0x79745f6c, 0x2e736570, 
-    0x6c732e68, 0x00676e61, 0x18ac0007, 0x00000011, 0x0a0d2a2f, 0x43202a20, 0x7279706f, 0x74686769, 0x29632820, 
-    0x32303220, 0x30322d32, 0x202c3532, 0x4449564e, 0x43204149, 0x4f50524f, 0x49544152, 0x202e4e4f, 0x6c6c4120, 
-    0x67697220, 0x20737468, 0x65736572, 0x64657672, 0x200a0d2e, 0x200a0d2a, 0x694c202a, 0x736e6563, 0x75206465, 
-    0x7265646e, 0x65687420, 0x61704120, 0x20656863, 0x6563694c, 0x2c65736e, 0x72655620, 0x6e6f6973, 0x302e3220, 
-    0x68742820, 0x4c222065, 0x6e656369, 0x29226573, 0x200a0d3b, 0x6f79202a, 0x616d2075, 0x6f6e2079, 0x73752074, 
-    0x68742065, 0x66207369, 0x20656c69, 0x65637865, 0x69207470, 0x6f63206e, 0x696c706d, 0x65636e61, 0x74697720, 
-    0x68742068, 0x694c2065, 0x736e6563, 0x0a0d2e65, 0x59202a20, 0x6d20756f, 0x6f207961, 0x69617462, 0x2061206e, 
-    0x79706f63, 0x20666f20, 0x20656874, 0x6563694c, 0x2065736e, 0x0a0d7461, 0x0a0d2a20, 0x20202a20, 0x68202020, 
-    0x3a707474, 0x77772f2f, 0x70612e77, 0x65686361, 0x67726f2e, 0x63696c2f, 0x65736e65, 0x494c2f73, 0x534e4543, 
-    0x2e322d45, 0x200a0d30, 0x200a0d2a, 0x6e55202a, 0x7373656c, 0x71657220, 0x65726975, 0x79622064, 0x70706120, 
-    0x6163696c, 0x20656c62, 0x2077616c, 0x6120726f, 0x65657267, 0x6f742064, 0x206e6920, 0x74697277, 0x2c676e69, 
-    0x666f7320, 0x72617774, 0x200a0d65, 0x6964202a, 0x69727473, 0x65747562, 0x6e752064, 0x20726564, 0x20656874, 
-    0x6563694c, 0x2065736e, 0x64207369, 0x72747369, 0x74756269, 0x6f206465, 0x6e61206e, 0x53412220, 0x22534920, 
-    0x53414220, 0x0d2c5349, 0x202a200a, 0x48544957, 0x2054554f, 0x52524157, 0x49544e41, 0x4f205345, 0x4f432052, 
-    0x5449444e, 0x534e4f49, 0x20464f20, 0x20594e41, 0x444e494b, 0x6965202c, 0x72656874, 0x70786520, 0x73736572, 
-    0x20726f20, 0x6c706d69, 0x2e646569, 0x2a200a0d, 0x65655320, 0x65687420, 0x63694c20, 0x65736e65, 0x726f6620, 
-    0x65687420, 0x65707320, 0x69666963, 0x616c2063, 0x6175676e, 0x67206567, 0x7265766f, 0x676e696e, 0x72657020, 
-    0x7373696d, 0x736e6f69, 0x646e6120, 0x2a200a0d, 0x6d696c20, 0x74617469, 0x736e6f69, 0x646e7520, 0x74207265, 
-    0x4c206568, 0x6e656369, 0x0d2e6573, 0x0d2a200a, 0x202a200a, 0x58445053, 0x6c69462d, 0x706f4365, 0x67697279, 
-    0x65547468, 0x203a7478, 0x79706f43, 0x68676972, 0x63282074, 0x30322029, 0x322d3232, 0x2c353230, 0x49564e20, 
-    0x20414944, 0x50524f43, 0x5441524f, 0x2e4e4f49, 0x2a200a0d, 0x44505320, 0x694c2d58, 0x736e6563, 0x64492d65, 
-    0x69746e65, 0x72656966, 0x7041203a, 0x65686361, 0x302e322d, 0x2a200a0d, 0x0d0a0d2f, 0x6669230a, 0x6665646e, 
-    0x594b5320, 0x4e55465f, 0x4f495443, 0x485f534e, 0x64230a0d, 0x6e696665, 0x4b532065, 0x55465f59, 0x4954434e, 
-    0x5f534e4f, 0x0d312048, 0x230a0d0a, 0x6c636e69, 0x20656475, 0x6e6f6322, 0x6e617473, 0x682e7374, 0x616c732e, 
-    0x0d22676e, 0x6e69230a, 0x64756c63, 0x73222065, 0x695f796b, 0x2e682e6f, 0x6e616c73, 0x0a0d2267, 0x2a2f0a0d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x230a0d2d, 0x6e754620, 0x6f697463, 
-    0x6560206e, 0x536c6176, 0x6c706d69, 0x796b5365, 0x3e0a0d60, 0x74655220, 0x736e7275, 0x65687420, 0x64617220, 
-    0x636e6169, 0x666f2065, 0x65687420, 0x6d697320, 0x20656c70, 0x20796b73, 0x65646f6d, 0x6e69206c, 0x67206120, 
-    0x6e657669, 0x65697620, 0x69642077, 0x74636572, 0x2e6e6f69, 0x2d2d0a0d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2a2d2d2d, 0x690a0d2f, 0x6e696c6e, 0x6c662065, 0x3374616f, 0x61766520, 0x6d69536c, 
-    0x53656c70, 0x5328796b, 0x6953796b, 0x656c706d, 0x61726150, 0x6574656d, 0x70207372, 0x6d617261, 0x66202c73, 
-    0x74616f6c, 0x69642033, 0x74636572, 0x296e6f69, 0x0d7b0a0d, 0x6620200a, 0x74616f6c, 0x6b732033, 0x6c6f4379, 
-    0x2020726f, 0x3d202020, 0x72617020, 0x2e736d61, 0x43796b73, 0x726f6c6f, 0x70202a20, 0x6d617261, 0x72622e73, 
-    0x74686769, 0x7373656e, 0x200a0d3b, 0x6f6c6620, 0x20337461, 0x69726f68, 0x436e6f7a, 0x726f6c6f, 0x70203d20, 
-    0x6d617261, 0x6f682e73, 0x6f7a6972, 0x6c6f436e, 0x2a20726f, 0x72617020, 0x2e736d61, 0x67697262, 0x656e7468, 
-    0x0d3b7373, 0x6620200a, 0x74616f6c, 0x72672033, 0x646e756f, 0x6f6c6f43, 0x3d202072, 0x72617020, 0x2e736d61, 
-    0x756f7267, 0x6f43646e, 0x20726f6c, 0x6170202a, 0x736d6172, 0x6972622e, 0x6e746867, 0x3b737365, 0x0a0d0a0d, 
-    0x2f2f2020, 0x796b5320, 0x20200a0d, 0x616f6c66, 0x65202074, 0x6176656c, 0x6e6f6974, 0x3d202020, 0x69736120, 
-    0x6c63286e, 0x28706d61, 0x28746f64, 0x65726964, 0x6f697463, 0x70202c6e, 0x6d617261, 0x69642e73, 0x74636572, 
-    0x556e6f69, 0x202c2970, 0x302e312d, 0x31202c46, 0x2946302e, 0x0a0d3b29, 0x6c662020, 0x2074616f, 0x706f7420, 
-    0x20202020, 0x20202020, 0x73203d20, 0x746f6f6d, 0x65747368, 0x2e302870, 0x70202c46, 0x6d617261, 0x6f682e73, 
-    0x6f7a6972, 0x7a69536e, 0x65202c65, 0x6176656c, 0x6e6f6974, 0x0a0d3b29, 0x6c662020, 0x2074616f, 0x746f6220, 
-    0x206d6f74, 0x20202020, 0x73203d20, 0x746f6f6d, 0x65747368, 0x2e302870, 0x70202c46, 0x6d617261, 0x6f682e73, 
-    0x6f7a6972, 0x7a69536e, 0x2d202c65, 0x76656c65, 0x6f697461, 0x0d3b296e, 0x6620200a, 0x74616f6c, 0x6e652033, 
-    0x6f726976, 0x6e656d6e, 0x203d2074, 0x7072656c, 0x72656c28, 0x6f682870, 0x6f7a6972, 0x6c6f436e, 0x202c726f, 
-    0x756f7267, 0x6f43646e, 0x2c726f6c, 0x746f6220, 0x296d6f74, 0x6b73202c, 0x6c6f4379, 0x202c726f, 0x29706f74, 
-    0x0d0a0d3b, 0x2f20200a, 0x7553202f, 0x200a0d6e, 0x6f6c6620, 0x61207461, 0x656c676e, 0x694c6f54, 0x20746867, 
-    0x3d202020, 0x6f636120, 0x6c632873, 0x28706d61, 0x28746f64, 0x65726964, 0x6f697463, 0x70202c6e, 0x6d617261, 
-    0x75732e73, 0x7269446e, 0x69746365, 0x2c296e6f, 0x302e3020, 0x31202c46, 0x2946302e, 0x0a0d3b29, 0x6c662020, 
-    0x2074616f, 0x666c6168, 0x75676e41, 0x5372616c, 0x20657a69, 0x6170203d, 0x736d6172, 0x676e612e, 0x72616c75, 
-    0x657a6953, 0x694c664f, 0x20746867, 0x2e30202a, 0x0d3b4635, 0x6620200a, 0x74616f6c, 0x6f6c6720, 0x706e4977, 
-    0x3d207475, 0x20200a0d, 0x20202020, 0x6d616c63, 0x2e322870, 0x2a204630, 0x2e312820, 0x2d204630, 0x6f6d7320, 
-    0x7368746f, 0x28706574, 0x666c6168, 0x75676e41, 0x5372616c, 0x20657a69, 0x6170202d, 0x736d6172, 0x6f6c672e, 
-    0x7a695377, 0x68202c65, 0x41666c61, 0x6c75676e, 0x69537261, 0x2b20657a, 0x72617020, 0x2e736d61, 0x776f6c67, 
-    0x657a6953, 0x6e61202c, 0x54656c67, 0x67694c6f, 0x29297468, 0x200a0d2c, 0x20202020, 0x20202020, 0x30202020, 
-    0x2c46302e, 0x302e3120, 0x0d3b2946, 0x6620200a, 0x74616f6c, 0x6c672020, 0x6e49776f, 0x736e6574, 0x20797469, 
-    0x6170203d, 0x736d6172, 0x6f6c672e, 0x746e4977, 0x69736e65, 0x2a207974, 0x776f7020, 0x6f6c6728, 0x706e4977, 
-    0x202c7475, 0x61726170, 0x672e736d, 0x53776f6c, 0x70726168, 0x7373656e, 0x0a0d3b29, 0x6c662020, 0x3374616f, 
-    0x6e757320, 0x6867694c, 0x20202074, 0x3d202020, 0x6f6c6720, 0x746e4977, 0x69736e65, 0x2a207974, 0x72617020, 
-    0x2e736d61, 0x6867696c, 0x64615274, 0x636e6169, 0x0a0d3b65, 0x20200a0d, 0x75746572, 0x65206e72, 0x7269766e, 
-    0x656d6e6f, 0x2b20746e, 0x6e757320, 0x6867694c, 0x0a0d3b74, 0x0d0a0d7d, 0x2d2a2f0a, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x20230a0d, 0x636e7546, 0x6e6f6974, 0x61736020, 0x656c706d, 
-    0x706d6953, 0x6b53656c, 0x0a0d6079, 0x6153203e, 0x656c706d, 0x68742073, 0x69732065, 0x656c706d, 0x796b7320, 
-    0x646f6d20, 0x75206c65, 0x676e6973, 0x6f777420, 0x6e617220, 0x206d6f64, 0x756c6176, 0x202c7365, 0x75746572, 
-    0x6e696e72, 0x20612067, 0x796b5360, 0x706d6153, 0x676e696c, 0x75736552, 0x2e60746c, 0x2d2d0a0d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2a2d2d2d, 0x690a0d2f, 0x6e696c6e, 0x6b532065, 0x6d615379, 
-    0x6e696c70, 0x73655267, 0x20746c75, 0x706d6173, 0x6953656c, 0x656c706d, 0x28796b53, 0x53796b53, 0x6c706d69, 
-    0x72615065, 0x74656d61, 0x20737265, 0x61726170, 0x202c736d, 0x616f6c66, 0x72203274, 0x56646e61, 0x0d296c61, 
-    0x0a0d7b0a, 0x6b532020, 0x6d615379, 0x6e696c70, 0x73655267, 0x20746c75, 0x75736572, 0x0d3b746c, 0x200a0d0a, 
-    0x202f2f20, 0x736e6f43, 0x746e6174, 0x200a0d73, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x6e757320, 0x67696557, 
-    0x3d207468, 0x392e3020, 0x203b6635, 0x202f2f20, 0x302e3539, 0x65772025, 0x74686769, 0x726f6620, 0x65687420, 
-    0x6e757320, 0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x57796b73, 0x68676965, 0x203d2074, 0x66302e31, 
-    0x73202d20, 0x65576e75, 0x74686769, 0x0d0a0d3b, 0x2f20200a, 0x6544202f, 0x65646963, 0x65687720, 0x72656874, 
-    0x206f7420, 0x706d6173, 0x7420656c, 0x73206568, 0x6f206e75, 0x68742072, 0x6b732065, 0x200a0d79, 0x28666920, 
-    0x646e6172, 0x2e6c6156, 0x203c2078, 0x576e7573, 0x68676965, 0x0a0d2974, 0x0d7b2020, 0x2020200a, 0x6f6c6620, 
-    0x73207461, 0x6e416e75, 0x616c7567, 0x64615272, 0x20737569, 0x6170203d, 0x736d6172, 0x676e612e, 0x72616c75, 
-    0x657a6953, 0x694c664f, 0x20746867, 0x2e30202a, 0x0d3b6635, 0x200a0d0a, 0x2f202020, 0x6153202f, 0x656c706d, 
-    0x65687420, 0x6e757320, 0x20200a0d, 0x6c662020, 0x2074616f, 0x74656874, 0x203d2061, 0x416e7573, 0x6c75676e, 
-    0x61527261, 0x73756964, 0x73202a20, 0x28747271, 0x646e6172, 0x2e6c6156, 0x0d3b2979, 0x2020200a, 0x6f6c6620, 
-    0x70207461, 0x20206968, 0x32203d20, 0x2066302e, 0x5f4d202a, 0x2a204950, 0x6e617220, 0x6c615664, 0x0d3b782e, 
-    0x200a0d0a, 0x66202020, 0x74616f6c, 0x75732033, 0x636f4c6e, 0x69446c61, 0x0a0d3b72, 0x20202020, 0x616f6c66, 
-    0x73202074, 0x68546e69, 0x20617465, 0x6973203d, 0x6874286e, 0x29617465, 0x200a0d3b, 0x73202020, 0x6f4c6e75, 
-    0x446c6163, 0x782e7269, 0x3d202020, 0x6e697320, 0x74656854, 0x202a2061, 0x28736f63, 0x29696870, 0x200a0d3b, 
-    0x73202020, 0x6f4c6e75, 0x446c6163, 0x792e7269, 0x3d202020, 0x6e697320, 0x74656854, 0x202a2061, 0x286e6973, 
-    0x29696870, 0x200a0d3b, 0x73202020, 0x6f4c6e75, 0x446c6163, 0x7a2e7269, 0x3d202020, 0x736f6320, 0x65687428, 
-    0x3b296174, 0x0a0d0a0d, 0x20202020, 0x54202f2f, 0x736e6172, 0x6d726f66, 0x6e757320, 0x636f6c5f, 0x645f6c61, 
-    0x74207269, 0x6f77206f, 0x20646c72, 0x63617073, 0x200a0d65, 0x66202020, 0x74616f6c, 0x70752033, 0x20202020, 
-    0x6c66203d, 0x3374616f, 0x202c3028, 0x31202c30, 0x0a0d3b29, 0x20202020, 0x616f6c66, 0x72203374, 0x74686769, 
-    0x63203d20, 0x73736f72, 0x2c707528, 0x72617020, 0x2e736d61, 0x446e7573, 0x63657269, 0x6e6f6974, 0x0a0d3b29, 
-    0x20202020, 0x20207075, 0x20202020, 0x20202020, 0x63203d20, 0x73736f72, 0x72617028, 0x2e736d61, 0x446e7573, 
-    0x63657269, 0x6e6f6974, 0x6972202c, 0x29746867, 0x0d0a0d3b, 0x2020200a, 0x73657220, 0x2e746c75, 0x65726964, 
-    0x6f697463, 0x203d206e, 0x4c6e7573, 0x6c61636f, 0x2e726944, 0x202a2078, 0x68676972, 0x202b2074, 0x4c6e7573, 
-    0x6c61636f, 0x2e726944, 0x202a2079, 0x2b207075, 0x6e757320, 0x61636f4c, 0x7269446c, 0x2a207a2e, 0x72617020, 
-    0x2e736d61, 0x446e7573, 0x63657269, 0x6e6f6974, 0x0d0a0d3b, 0x2020200a, 0x202f2f20, 0x706d6f43, 0x20657475, 
-    0x20656874, 0x0d464450, 0x2020200a, 0x73657220, 0x2e746c75, 0x20666470, 0x7573203d, 0x6965576e, 0x3b746867, 
-    0x2f2f2020, 0x28202f20, 0x57545f4d, 0x49505f4f, 0x28202a20, 0x66302e31, 0x63202d20, 0x6128736f, 0x6c75676e, 
-    0x735f7261, 0x29657a69, 0x0d3b2929, 0x200a0d0a, 0x2f202020, 0x6f43202f, 0x7475706d, 0x68742065, 0x696c2065, 
-    0x20746867, 0x65746e69, 0x7469736e, 0x61282079, 0x6d757373, 0x20676e69, 0x66696e75, 0x206d726f, 0x206e7573, 
-    0x6b736964, 0x200a0d29, 0x72202020, 0x6c757365, 0x61722e74, 0x6e616964, 0x3d206563, 0x72617020, 0x2e736d61, 
-    0x6867696c, 0x64615274, 0x636e6169, 0x0a0d3b65, 0x0d7d2020, 0x6520200a, 0x0d65736c, 0x7b20200a, 0x20200a0d, 
-    0x2f2f2020, 0x6d615320, 0x20656c70, 0x20656874, 0x20796b73, 0x6d697328, 0x20656c70, 0x66696e75, 0x206d726f, 
-    0x706d6173, 0x676e696c, 0x20666f20, 0x20656874, 0x65707075, 0x65682072, 0x7073696d, 0x65726568, 0x200a0d29, 
-    0x66202020, 0x74616f6c, 0x736f6320, 0x74656854, 0x203d2061, 0x74727173, 0x302e3128, 0x202d2066, 0x646e6172, 
-    0x2e6c6156, 0x0d3b2979, 0x2020200a, 0x6f6c6620, 0x73207461, 0x68546e69, 0x20617465, 0x7173203d, 0x72287472, 
-    0x56646e61, 0x792e6c61, 0x0a0d3b29, 0x20202020, 0x616f6c66, 0x68702074, 0x20202069, 0x3d202020, 0x302e3220, 
-    0x202a2066, 0x49505f4d, 0x72202a20, 0x56646e61, 0x782e6c61, 0x0d0a0d3b, 0x2020200a, 0x73657220, 0x2e746c75, 
-    0x65726964, 0x6f697463, 0x203d206e, 0x616f6c66, 0x73283374, 0x68546e69, 0x20617465, 0x6f63202a, 0x68702873, 
-    0x202c2969, 0x54736f63, 0x61746568, 0x6973202c, 0x6568546e, 0x2a206174, 0x6e697320, 0x69687028, 0x0d3b2929, 
-    0x200a0d0a, 0x2f202020, 0x6e45202f, 0x65727573, 0x65687420, 0x6d617320, 0x64656c70, 0x72696420, 0x69746365, 
-    0x69206e6f, 0x6e692073, 0x65687420, 0x70707520, 0x68207265, 0x73696d65, 0x72656870, 0x200a0d65, 0x69202020, 
-    0x6f642866, 0x65722874, 0x746c7573, 0x7269642e, 0x69746365, 0x202c6e6f, 0x61726170, 0x642e736d, 0x63657269, 
-    0x6e6f6974, 0x20297055, 0x2e30203c, 0x0d296630, 0x2020200a, 0x0a0d7b20, 0x20202020, 0x65722020, 0x746c7573, 
-    0x7269642e, 0x69746365, 0x792e6e6f, 0x2d203d20, 0x75736572, 0x642e746c, 0x63657269, 0x6e6f6974, 0x0d3b792e, 
-    0x2020200a, 0x0a0d7d20, 0x20200a0d, 0x2f2f2020, 0x6d6f4320, 0x65747570, 0x65687420, 0x46445020, 0x6e752820, 
-    0x726f6669, 0x6173206d, 0x696c706d, 0x6f20676e, 0x65682066, 0x7073696d, 0x65726568, 0x200a0d29, 0x72202020, 
-    0x6c757365, 0x64702e74, 0x203d2066, 0x57796b73, 0x68676965, 0x20203b74, 0x2f202f2f, 0x545f4d20, 0x505f4f57, 
-    0x0a0d3b49, 0x20200a0d, 0x2f2f2020, 0x6d6f4320, 0x65747570, 0x796b7320, 0x6c6f6320, 0x2820726f, 0x706d6973, 
-    0x6966696c, 0x76206465, 0x69737265, 0x6f206e6f, 0x72702066, 0x6465636f, 0x6c617275, 0x20796b53, 0x636e7566, 
-    0x6e6f6974, 0x200a0d29, 0x66202020, 0x74616f6c, 0x656c6520, 0x69746176, 0x3d206e6f, 0x69736120, 0x6c63286e, 
-    0x28706d61, 0x28746f64, 0x75736572, 0x642e746c, 0x63657269, 0x6e6f6974, 0x6170202c, 0x736d6172, 0x7269642e, 
-    0x69746365, 0x70556e6f, 0x2d202c29, 0x66302e31, 0x2e31202c, 0x29296630, 0x200a0d3b, 0x66202020, 0x74616f6c, 
-    0x20207420, 0x20202020, 0x3d202020, 0x6f6d7320, 0x7368746f, 0x28706574, 0x66302e30, 0x6170202c, 0x736d6172, 
-    0x726f682e, 0x6e6f7a69, 0x657a6953, 0x6c65202c, 0x74617665, 0x296e6f69, 0x200a0d3b, 0x72202020, 0x6c757365, 
-    0x61722e74, 0x6e616964, 0x3d206563, 0x72656c20, 0x61702870, 0x736d6172, 0x726f682e, 0x6e6f7a69, 0x6f6c6f43, 
-    0x70202c72, 0x6d617261, 0x6b732e73, 0x6c6f4379, 0x202c726f, 0x0d3b2974, 0x7d20200a, 0x0a0d0a0d, 0x65722020, 
-    0x6e727574, 0x73657220, 0x3b746c75, 0x0d7d0a0d, 0x0d0a0d0a, 0x2f2f2f0a, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 
-    0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 
-    0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f0a0d2f, 0x6850202f, 0x63697379, 0x53206c61, 
-    0x0a0d796b, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 
-    0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 
-    0x2f2f2f2f, 0x0a0d0a0d, 0x65682a2f, 0x7265706c, 0x6e756620, 0x6f697463, 0x6620736e, 0x7320726f, 0x615f6e75, 
-    0x735f646e, 0x2f2a796b, 0x0a0d0a0d, 0x46202f2f, 0x74636e75, 0x206e6f69, 0x63206f74, 0x75636c61, 0x6574616c, 
-    0x65687420, 0x6d756c20, 0x6e616e69, 0x6f206563, 0x6e612066, 0x42475220, 0x6c6f6320, 0x0a0d726f, 0x696c6e69, 
-    0x6620656e, 0x74616f6c, 0x62677220, 0x696d754c, 0x636e616e, 0x6c662865, 0x3374616f, 0x62677220, 0x7b0a0d29, 
-    0x20200a0d, 0x75746572, 0x30206e72, 0x3231322e, 0x2a206636, 0x62677220, 0x2b20782e, 0x372e3020, 0x66323531, 
-    0x72202a20, 0x792e6267, 0x30202b20, 0x3237302e, 0x2a206632, 0x62677220, 0x203b7a2e, 0x202f2f20, 0x2e636552, 
-    0x39303720, 0x6d756c20, 0x6e616e69, 0x63206563, 0x6666656f, 0x65696369, 0x0d73746e, 0x0a0d7d0a, 0x2f2f0a0d, 
-    0x6e754620, 0x6f697463, 0x6f74206e, 0x61727420, 0x6f66736e, 0x6c206d72, 0x6c61636f, 0x6f6f6320, 0x6e696472, 
-    0x73657461, 0x2c782820, 0x202c7920, 0x7420297a, 0x2061206f, 0x65726964, 0x6f697463, 0x6576206e, 0x726f7463, 
-    0x696c6120, 0x64656e67, 0x74697720, 0x6e692068, 0x69616d5f, 0x690a0d6e, 0x6e696c6e, 0x6c662065, 0x3374616f, 
-    0x636f6c20, 0x6f436c61, 0x7364726f, 0x69446f54, 0x6c662872, 0x3374616f, 0x69616d20, 0x6365566e, 0x6c66202c, 
-    0x2074616f, 0x66202c78, 0x74616f6c, 0x202c7920, 0x616f6c66, 0x297a2074, 0x0d7b0a0d, 0x6620200a, 0x74616f6c, 
-    0x20752033, 0x200a0d3d, 0x20202020, 0x726f6e20, 0x696c616d, 0x6128657a, 0x6d287362, 0x566e6961, 0x782e6365, 
-    0x203c2029, 0x28736261, 0x6e69616d, 0x2e636556, 0x3f202979, 0x6f6c6620, 0x28337461, 0x66302e30, 0x6d2d202c, 
-    0x566e6961, 0x7a2e6365, 0x616d202c, 0x65566e69, 0x29792e63, 0x66203a20, 0x74616f6c, 0x616d2833, 0x65566e69, 
-    0x2c7a2e63, 0x302e3020, 0x2d202c66, 0x6e69616d, 0x2e636556, 0x3b292978, 0x20200a0d, 0x616f6c66, 0x76203374, 
-    0x63203d20, 0x73736f72, 0x69616d28, 0x6365566e, 0x2975202c, 0x200a0d3b, 0x74657220, 0x206e7275, 0x202a2078, 
-    0x202b2075, 0x202a2079, 0x202b2076, 0x202a207a, 0x6e69616d, 0x3b636556, 0x0d7d0a0d, 0x2f0a0d0a, 0x7145202f, 
-    0x2d6c6175, 0x61657261, 0x61727420, 0x6f66736e, 0x74616d72, 0x206e6f69, 0x7420666f, 0x73206568, 0x72617571, 
-    0x305b2065, 0x5e5d312c, 0x6f742032, 0x65687420, 0x73696420, 0x2f0a0d6b, 0x287b202f, 0x79202c78, 0x207c2029, 
-    0x20325e78, 0x5e79202b, 0x3d3c2032, 0x2e7d3120, 0x6e690a0d, 0x656e696c, 0x6f6c6620, 0x20327461, 0x61757173, 
-    0x6f546572, 0x6b736944, 0x6f6c6628, 0x69207461, 0x202c586e, 0x616f6c66, 0x6e692074, 0x0a0d2959, 0x200a0d7b, 
-    0x6f6c6620, 0x6c207461, 0x6c61636f, 0x203d2058, 0x66302e32, 0x69202a20, 0x2d20586e, 0x302e3120, 0x0a0d3b66, 
-    0x6c662020, 0x2074616f, 0x61636f6c, 0x3d20596c, 0x302e3220, 0x202a2066, 0x20596e69, 0x2e31202d, 0x0d3b6630, 
-    0x6920200a, 0x6f6c2866, 0x586c6163, 0x203d3d20, 0x66302e30, 0x20262620, 0x61636f6c, 0x3d20596c, 0x2e30203d, 
-    0x0d296630, 0x2020200a, 0x74657220, 0x206e7275, 0x616f6c66, 0x30283274, 0x2966302e, 0x0d0a0d3b, 0x6620200a, 
-    0x74616f6c, 0x202c7220, 0x3b696870, 0x20200a0d, 0x6c286669, 0x6c61636f, 0x203e2058, 0x636f6c2d, 0x29596c61, 
-    0x20200a0d, 0x200a0d7b, 0x69202020, 0x6f6c2866, 0x586c6163, 0x6c203e20, 0x6c61636f, 0x0a0d2959, 0x20202020, 
-    0x200a0d7b, 0x20202020, 0x20207220, 0x6c203d20, 0x6c61636f, 0x0a0d3b58, 0x20202020, 0x68702020, 0x203d2069, 
-    0x505f4d28, 0x202f2049, 0x66302e34, 0x202a2029, 0x302e3128, 0x202b2066, 0x61636f6c, 0x2f20596c, 0x636f6c20, 
-    0x29586c61, 0x200a0d3b, 0x7d202020, 0x20200a0d, 0x6c652020, 0x0a0d6573, 0x20202020, 0x200a0d7b, 0x20202020, 
-    0x20207220, 0x6c203d20, 0x6c61636f, 0x0a0d3b59, 0x20202020, 0x68702020, 0x203d2069, 0x505f4d28, 0x202f2049, 
-    0x66302e34, 0x202a2029, 0x302e3328, 0x202d2066, 0x61636f6c, 0x2f20586c, 0x636f6c20, 0x29596c61, 0x200a0d3b, 
-    0x7d202020, 0x20200a0d, 0x200a0d7d, 0x736c6520, 0x200a0d65, 0x0a0d7b20, 0x20202020, 0x6c286669, 0x6c61636f, 
-    0x203c2058, 0x61636f6c, 0x0d29596c, 0x2020200a, 0x0a0d7b20, 0x20202020, 0x20722020, 0x203d2020, 0x636f6c2d, 
-    0x3b586c61, 0x20200a0d, 0x20202020, 0x20696870, 0x4d28203d, 0x2049505f, 0x2e34202f, 0x20296630, 0x3528202a, 
-    0x2066302e, 0x6f6c202b, 0x596c6163, 0x6c202f20, 0x6c61636f, 0x0d3b2958, 0x2020200a, 0x0a0d7d20, 0x20202020, 
-    0x65736c65, 0x20200a0d, 0x0d7b2020, 0x2020200a, 0x72202020, 0x3d202020, 0x6f6c2d20, 0x596c6163, 0x200a0d3b, 
-    0x20202020, 0x69687020, 0x28203d20, 0x49505f4d, 0x34202f20, 0x2966302e, 0x28202a20, 0x66302e37, 0x6c202d20, 
-    0x6c61636f, 0x202f2058, 0x61636f6c, 0x3b29596c, 0x20200a0d, 0x0d7d2020, 0x7d20200a, 0x20200a0d, 0x75746572, 
-    0x66206e72, 0x74616f6c, 0x2c722832, 0x69687020, 0x0a0d3b29, 0x0d0a0d7d, 0x202f2f0a, 0x636e7546, 0x6e6f6974, 
-    0x206f7420, 0x636c6163, 0x74616c75, 0x20612065, 0x66666964, 0x20657375, 0x6c666572, 0x69746365, 0x64206e6f, 
-    0x63657269, 0x6e6f6974, 0x73616220, 0x6f206465, 0x6e61206e, 0x706e6920, 0x6e207475, 0x616d726f, 0x6e61206c, 
-    0x61732064, 0x656c706d, 0x6e690a0d, 0x656e696c, 0x6f6c6620, 0x20337461, 0x6c666572, 0x69746365, 0x69446e6f, 
-    0x66694472, 0x65737566, 0x6c662858, 0x3374616f, 0x4e6e6920, 0x616d726f, 0x66202c6c, 0x74616f6c, 0x6e692032, 
-    0x706d6153, 0x0d29656c, 0x0a0d7b0a, 0x6c662020, 0x3274616f, 0x68507220, 0x203d2069, 0x61757173, 0x6f546572, 
-    0x6b736944, 0x536e6928, 0x6c706d61, 0x2c782e65, 0x536e6920, 0x6c706d61, 0x29792e65, 0x2020203b, 0x4d202f2f, 
-    0x74207061, 0x32206568, 0x61732044, 0x656c706d, 0x696f7020, 0x7420746e, 0x2061206f, 0x6b736964, 0x20200a0d, 
-    0x616f6c66, 0x78202074, 0x20202020, 0x5072203d, 0x782e6968, 0x63202a20, 0x7228736f, 0x2e696850, 0x203b2979, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x2f2f2020, 0x6c614320, 0x616c7563, 0x74206574, 0x78206568, 
-    0x6d6f6320, 0x656e6f70, 0x6f20746e, 0x68742066, 0x65722065, 0x63656c66, 0x6e6f6974, 0x72696420, 0x69746365, 
-    0x0a0d6e6f, 0x6c662020, 0x2074616f, 0x20207920, 0x203d2020, 0x69685072, 0x2a20782e, 0x6e697320, 0x68507228, 
-    0x29792e69, 0x2020203b, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x43202f2f, 0x75636c61, 0x6574616c, 
-    0x65687420, 0x63207920, 0x6f706d6f, 0x746e656e, 0x20666f20, 0x20656874, 0x6c666572, 0x69746365, 0x64206e6f, 
-    0x63657269, 0x6e6f6974, 0x20200a0d, 0x616f6c66, 0x7a202074, 0x20202020, 0x7173203d, 0x6d287472, 0x30287861, 
-    0x2c66302e, 0x302e3120, 0x202d2066, 0x202a2078, 0x202d2078, 0x202a2079, 0x3b292979, 0x2f2f2020, 0x6c614320, 
-    0x616c7563, 0x74206574, 0x7a206568, 0x6d6f6320, 0x656e6f70, 0x202c746e, 0x75736e65, 0x676e6972, 0x20746920, 
-    0x6e207369, 0x6e2d6e6f, 0x74616765, 0x0d657669, 0x7220200a, 0x72757465, 0x6f6c206e, 0x436c6163, 0x64726f6f, 
-    0x446f5473, 0x69287269, 0x726f4e6e, 0x2c6c616d, 0x202c7820, 0x7a202c79, 0x20203b29, 0x43202f2f, 0x65766e6f, 
-    0x74207472, 0x6c206568, 0x6c61636f, 0x72696420, 0x69746365, 0x74206e6f, 0x6874206f, 0x6f772065, 0x20646c72, 
-    0x63617073, 0x69642065, 0x74636572, 0x206e6f69, 0x6e697375, 0x68742067, 0x6f6e2065, 0x6c616d72, 0x0d7d0a0d, 
-    0x2f0a0d0a, 0x7546202f, 0x6974636e, 0x74206e6f, 0x6163206f, 0x6c75636c, 0x20657461, 0x20656874, 0x6f6c6f63, 
-    0x666f2072, 0x65687420, 0x6e757320, 0x73616220, 0x6f206465, 0x7469206e, 0x69642073, 0x74636572, 0x206e6f69, 
-    0x20646e61, 0x6f6d7461, 0x65687073, 0x20636972, 0x62727574, 0x74696469, 0x690a0d79, 0x6e696c6e, 0x6c662065, 
-    0x3374616f, 0x6c616320, 0x6e755363, 0x6f6c6f43, 0x6c662872, 0x3374616f, 0x6e757320, 0x2c726944, 0x6f6c6620, 
-    0x74207461, 0x69627275, 0x79746964, 0x7b0a0d29, 0x20200a0d, 0x73286669, 0x69446e75, 0x207a2e72, 0x30203d3c, 
-    0x2966302e, 0x20200a0d, 0x65722020, 0x6e727574, 0x6f6c6620, 0x28337461, 0x66302e30, 0x0a0d3b29, 0x20200a0d, 
-    0x616f6c66, 0x6b203374, 0x2020206f, 0x20202020, 0x203d2020, 0x616f6c66, 0x31283374, 0x66302e32, 0x2e38202c, 
-    0x202c6635, 0x66392e30, 0x20203b29, 0x20202020, 0x202f2f20, 0x6974704f, 0x206c6163, 0x74706564, 0x6f632068, 
-    0x6174736e, 0x2073746e, 0x20726f66, 0x6e6f7a6f, 0x200a0d65, 0x6f6c6620, 0x20337461, 0x65766177, 0x676e656c, 
-    0x3d206874, 0x6f6c6620, 0x28337461, 0x31362e30, 0x202c6630, 0x35352e30, 0x202c6630, 0x37342e30, 0x3b296630, 
-    0x2f2f2020, 0x76615720, 0x6e656c65, 0x20687467, 0x6c20666f, 0x74686769, 0x6e692820, 0x63696d20, 0x656d6f72, 
-    0x73726574, 0x6f662029, 0x47522072, 0x68632042, 0x656e6e61, 0x0a0d736c, 0x6c662020, 0x3374616f, 0x6c6f7320, 
-    0x20646152, 0x6c66203d, 0x3374616f, 0x302e3128, 0x30202c66, 0x3239392e, 0x30202c66, 0x3131392e, 0x2a202966, 
-    0x32312820, 0x30303537, 0x2066302e, 0x2e30202f, 0x38373839, 0x203b2966, 0x202f2f20, 0x616c6f53, 0x61722072, 
-    0x6e616964, 0x61206563, 0x73756a64, 0x20646574, 0x20726f66, 0x6f6d7461, 0x65687073, 0x20636972, 0x65666665, 
-    0x0d737463, 0x200a0d0a, 0x6f6c6620, 0x6d207461, 0x31203d20, 0x2066302e, 0x7328202f, 0x69446e75, 0x207a2e72, 
-    0x2e30202b, 0x20663531, 0x6f70202a, 0x33392877, 0x3538382e, 0x202d2066, 0x72676564, 0x28736565, 0x736f6361, 
-    0x6e757328, 0x2e726944, 0x2c29297a, 0x2e312d20, 0x66333532, 0x203b2929, 0x202f2f20, 0x6974704f, 0x206c6163, 
-    0x20726961, 0x7373616d, 0x6c616320, 0x616c7563, 0x6e6f6974, 0x69732820, 0x696c706d, 0x64656966, 0x6c657220, 
-    0x76697461, 0x69612065, 0x616d2072, 0x66207373, 0x756d726f, 0x0d29616c, 0x6620200a, 0x74616f6c, 0x65622020, 
-    0x3d206174, 0x302e3020, 0x38303634, 0x202a2066, 0x62727574, 0x74696469, 0x202d2079, 0x34302e30, 0x66363835, 
-    0x2f20203b, 0x6542202f, 0x63206174, 0x6666656f, 0x65696369, 0x6620746e, 0x5220726f, 0x656c7961, 0x20686769, 
-    0x74616373, 0x69726574, 0x6220676e, 0x64657361, 0x206e6f20, 0x62727574, 0x74696469, 0x200a0d79, 0x6f6c6620, 
-    0x20337461, 0x20206174, 0x65203d20, 0x2d287078, 0x202a206d, 0x61746562, 0x70202a20, 0x7728776f, 0x6c657661, 
-    0x74676e65, 0x66202c68, 0x74616f6c, 0x312d2833, 0x2966332e, 0x203b2929, 0x202f2f20, 0x65747441, 0x7461756e, 
-    0x206e6f69, 0x20657564, 0x61206f74, 0x736f7265, 0x28206c6f, 0x6c796152, 0x68676965, 0x63732029, 0x65747461, 
-    0x676e6972, 0x20200a0d, 0x616f6c66, 0x74203374, 0x2020206f, 0x7865203d, 0x6d2d2870, 0x6b202a20, 0x202a206f, 
-    0x30302e30, 0x29663533, 0x2020203b, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x41202f2f, 0x6e657474, 0x69746175, 0x64206e6f, 0x74206575, 0x7a6f206f, 0x20656e6f, 0x6f736261, 0x69747072, 
-    0x0a0d6e6f, 0x6c662020, 0x3374616f, 0x20727420, 0x203d2020, 0x28707865, 0x2a206d2d, 0x302e3020, 0x33373830, 
-    0x2a206635, 0x776f7020, 0x76617728, 0x6e656c65, 0x2c687467, 0x6f6c6620, 0x28337461, 0x302e342d, 0x29296638, 
-    0x20203b29, 0x41202f2f, 0x6e657474, 0x69746175, 0x64206e6f, 0x74206575, 0x6152206f, 0x69656c79, 0x73206867, 
-    0x74746163, 0x6e697265, 0x0d0a0d67, 0x7220200a, 0x72757465, 0x7274206e, 0x74202a20, 0x202a2061, 0x2a206f74, 
-    0x6c6f7320, 0x3b646152, 0x2f2f2020, 0x6c614320, 0x616c7563, 0x74206574, 0x66206568, 0x6c616e69, 0x6e757320, 
-    0x6c6f6320, 0x6220726f, 0x64657361, 0x206e6f20, 0x20656874, 0x626d6f63, 0x64656e69, 0x66666520, 0x73746365, 
-    0x0d7d0a0d, 0x2f0a0d0a, 0x7546202f, 0x6974636e, 0x74206e6f, 0x6163206f, 0x6c75636c, 0x20657461, 0x20656874, 
-    0x6f6c6f63, 0x666f2072, 0x65687420, 0x796b7320, 0x73616220, 0x6f206465, 0x6874206e, 0x75732065, 0x2073276e, 
-    0x65726964, 0x6f697463, 0x6e61206e, 0x74612064, 0x70736f6d, 0x69726568, 0x75742063, 0x64696272, 0x0d797469, 
-    0x6c6e690a, 0x20656e69, 0x616f6c66, 0x73203374, 0x6f43796b, 0x58726f6c, 0x66287a79, 0x74616f6c, 0x6e692033, 
-    0x2c726944, 0x6f6c6620, 0x20337461, 0x75536e69, 0x736f506e, 0x6c66202c, 0x2074616f, 0x75546e69, 0x64696272, 
-    0x2c797469, 0x6f6c6620, 0x69207461, 0x6d754c6e, 0x6e616e69, 0x0d296563, 0x0a0d7b0a, 0x6c662020, 0x3374616f, 
-    0x7a797820, 0x200a0d3b, 0x6f6c6620, 0x20207461, 0x42202c41, 0x2c43202c, 0x202c4420, 0x0a0d3b45, 0x6c662020, 
-    0x2074616f, 0x736f6320, 0x6d6d6147, 0x203d2061, 0x28746f64, 0x75536e69, 0x736f506e, 0x6e69202c, 0x29726944, 
-    0x200a0d3b, 0x28666920, 0x47736f63, 0x616d6d61, 0x31203e20, 0x2966302e, 0x20200a0d, 0x200a0d7b, 0x63202020, 
-    0x6147736f, 0x20616d6d, 0x2e32203d, 0x2d206630, 0x736f6320, 0x6d6d6147, 0x0a0d3b61, 0x0d7d2020, 0x6620200a, 
-    0x74616f6c, 0x6d616720, 0x2020616d, 0x20202020, 0x61203d20, 0x28736f63, 0x47736f63, 0x616d6d61, 0x0a0d3b29, 
-    0x6c662020, 0x2074616f, 0x54736f63, 0x61746568, 0x20202020, 0x6e69203d, 0x2e726944, 0x0a0d3b7a, 0x6c662020, 
-    0x2074616f, 0x54736f63, 0x61746568, 0x206e7553, 0x6e69203d, 0x506e7553, 0x7a2e736f, 0x200a0d3b, 0x6f6c6620, 
-    0x74207461, 0x61746568, 0x206e7553, 0x3d202020, 0x6f636120, 0x6f632873, 0x65685473, 0x75536174, 0x0d3b296e, 
-    0x6620200a, 0x74616f6c, 0x20327420, 0x20202020, 0x20202020, 0x69203d20, 0x7275546e, 0x69646962, 0x2a207974, 
-    0x546e6920, 0x69627275, 0x79746964, 0x200a0d3b, 0x6f6c6620, 0x74207461, 0x20203273, 0x20202020, 0x3d202020, 
-    0x65687420, 0x75536174, 0x202a206e, 0x74656874, 0x6e755361, 0x200a0d3b, 0x6f6c6620, 0x74207461, 0x20203373, 
-    0x20202020, 0x3d202020, 0x32737420, 0x74202a20, 0x61746568, 0x3b6e7553, 0x20200a0d, 0x64202f2f, 0x72657465, 
-    0x656e696d, 0x61207820, 0x7920646e, 0x20746120, 0x696e657a, 0x0a0d6874, 0x6c662020, 0x2074616f, 0x696e657a, 
-    0x20586874, 0x2828203d, 0x302e302b, 0x35363130, 0x2a206630, 0x33737420, 0x30202d20, 0x3330302e, 0x66323437, 
-    0x74202a20, 0x2b203273, 0x302e3020, 0x38303230, 0x2a206638, 0x65687420, 0x75536174, 0x202b206e, 0x2a202930, 
-    0x0d327420, 0x2020200a, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x2d28202b, 0x32302e30, 0x38323039, 
-    0x202a2066, 0x20337374, 0x2e30202b, 0x37333630, 0x20663337, 0x7374202a, 0x202d2032, 0x33302e30, 0x30323032, 
-    0x202a2066, 0x74656874, 0x6e755361, 0x30202b20, 0x3330302e, 0x66383439, 0x202a2029, 0x75546e69, 0x64696272, 
-    0x0d797469, 0x2020200a, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x2b28202b, 0x31312e30, 0x36333936, 
-    0x202a2066, 0x20337374, 0x2e30202d, 0x39313132, 0x20663036, 0x7374202a, 0x202b2032, 0x36302e30, 0x33323530, 
-    0x202a2066, 0x74656874, 0x6e755361, 0x30202b20, 0x3835322e, 0x66323538, 0x0d3b2929, 0x6620200a, 0x74616f6c, 
-    0x6e657a20, 0x59687469, 0x28203d20, 0x2e302b28, 0x37323030, 0x20663935, 0x7374202a, 0x202d2033, 0x30302e30, 
-    0x35303136, 0x202a2066, 0x20327374, 0x2e30202b, 0x31333030, 0x20663236, 0x6874202a, 0x53617465, 0x2b206e75, 
-    0x20293020, 0x3274202a, 0x20200a0d, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x28202b20, 0x302e302d, 
-    0x34313234, 0x2a206639, 0x33737420, 0x30202b20, 0x3938302e, 0x66313037, 0x74202a20, 0x2d203273, 0x302e3020, 
-    0x33353134, 0x2a206636, 0x65687420, 0x75536174, 0x202b206e, 0x30302e30, 0x38353135, 0x2a202966, 0x546e6920, 
-    0x69627275, 0x79746964, 0x20200a0d, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x28202b20, 0x312e302b, 
-    0x36343335, 0x2a206637, 0x33737420, 0x30202d20, 0x3736322e, 0x66383635, 0x74202a20, 0x2b203273, 0x302e3020, 
-    0x39363636, 0x2a206638, 0x65687420, 0x75536174, 0x202b206e, 0x36322e30, 0x31383836, 0x3b292966, 0x20200a0d, 
-    0x2e7a7978, 0x20202079, 0x20202020, 0x203d2020, 0x754c6e69, 0x616e696d, 0x3b65636e, 0x20200a0d, 0x54202f2f, 
-    0x3a4f444f, 0x65725020, 0x61687465, 0x74552f6d, 0x0a0d6861, 0x20200a0d, 0x50202f2f, 0x6f636572, 0x7475706d, 
-    0x6f632065, 0x6e6f6d6d, 0x72657420, 0x0a0d736d, 0x6c662020, 0x2074616f, 0x43766e69, 0x6854736f, 0x20617465, 
-    0x2e31203d, 0x2f206630, 0x78616d20, 0x736f6328, 0x74656854, 0x30202c61, 0x3130302e, 0x203b2966, 0x202f2f20, 
-    0x696f7641, 0x69642064, 0x69736976, 0x62206e6f, 0x657a2079, 0x0a0d6f72, 0x20200a0d, 0x75202f2f, 0x66206573, 
-    0x7367616c, 0x65732820, 0x62612065, 0x2965766f, 0x20200a0d, 0x203d2041, 0x302e302d, 0x35323931, 0x2a206637, 
-    0x546e6920, 0x69627275, 0x79746964, 0x28202d20, 0x39322e30, 0x202d2066, 0x74727173, 0x736f6328, 0x74656854, 
-    0x6e755361, 0x202a2029, 0x39302e30, 0x0d3b2966, 0x4220200a, 0x2d203d20, 0x36302e30, 0x33313536, 0x202a2066, 
-    0x75546e69, 0x64696272, 0x20797469, 0x2e30202b, 0x38303030, 0x3b663831, 0x20200a0d, 0x203d2043, 0x302e302d, 
-    0x31343030, 0x2a206637, 0x546e6920, 0x69627275, 0x79746964, 0x30202b20, 0x3231322e, 0x66393734, 0x200a0d3b, 
-    0x3d204420, 0x2e302d20, 0x30343630, 0x20663739, 0x6e69202a, 0x62727554, 0x74696469, 0x202d2079, 0x39382e30, 
-    0x35373838, 0x0a0d3b66, 0x20452020, 0x302d203d, 0x3330302e, 0x66313532, 0x69202a20, 0x7275546e, 0x69646962, 
-    0x2b207974, 0x302e3020, 0x37313534, 0x0d3b6638, 0x200a0d0a, 0x6f6c6620, 0x65207461, 0x49427078, 0x6f43766e, 
-    0x65685473, 0x3d206174, 0x70786520, 0x2a204228, 0x766e6920, 0x54736f43, 0x61746568, 0x0a0d3b29, 0x6c662020, 
-    0x2074616f, 0x42707865, 0x20202020, 0x20202020, 0x20202020, 0x7865203d, 0x29422870, 0x200a0d3b, 0x6f6c6620, 
-    0x65207461, 0x47447078, 0x616d6d61, 0x20202020, 0x3d202020, 0x70786520, 0x2a204428, 0x6d616720, 0x3b29616d, 
-    0x20200a0d, 0x616f6c66, 0x78652074, 0x68544470, 0x53617465, 0x20206e75, 0x203d2020, 0x28707865, 0x202a2044, 
-    0x74656874, 0x6e755361, 0x0a0d3b29, 0x20200a0d, 0x616f6c66, 0x20782074, 0x2828203d, 0x662e3128, 0x41202b20, 
-    0x65202a20, 0x49427078, 0x6f43766e, 0x65685473, 0x20296174, 0x3128202a, 0x2b20662e, 0x2a204320, 0x70786520, 
-    0x6d614744, 0x2b20616d, 0x2a204520, 0x736f6320, 0x6d6d6147, 0x202a2061, 0x47736f63, 0x616d6d61, 0x0a0d2929, 
-    0x20202020, 0x20202020, 0x20202020, 0x28202f20, 0x2b203128, 0x2a204120, 0x70786520, 0x2a202942, 0x20312820, 
-    0x2043202b, 0x7865202a, 0x68544470, 0x53617465, 0x2b206e75, 0x2a204520, 0x736f6320, 0x74656854, 0x6e755361, 
-    0x63202a20, 0x6854736f, 0x53617465, 0x29296e75, 0x0a0d3b29, 0x20200a0d, 0x203d2041, 0x302e302d, 0x39363631, 
-    0x2a206638, 0x546e6920, 0x69627275, 0x79746964, 0x30202d20, 0x3036322e, 0x66373837, 0x200a0d3b, 0x3d204220, 
-    0x2e302d20, 0x39343930, 0x20663835, 0x6e69202a, 0x62727554, 0x74696469, 0x202b2079, 0x30302e30, 0x33313239, 
-    0x0a0d3b66, 0x20432020, 0x302d203d, 0x3730302e, 0x66383239, 0x69202a20, 0x7275546e, 0x69646962, 0x2b207974, 
-    0x322e3020, 0x33323031, 0x0d3b6630, 0x4420200a, 0x2d203d20, 0x34302e30, 0x30353034, 0x202a2066, 0x75546e69, 
-    0x64696272, 0x20797469, 0x2e31202d, 0x36333536, 0x3b663439, 0x20200a0d, 0x203d2045, 0x302e302d, 0x32393031, 
-    0x2a206632, 0x546e6920, 0x69627275, 0x79746964, 0x30202b20, 0x3235302e, 0x66393139, 0x0d0a0d3b, 0x2f20200a, 
-    0x6552202f, 0x706d6f63, 0x20657475, 0x20726f66, 0x61632079, 0x6c75636c, 0x6f697461, 0x200a0d6e, 0x70786520, 
-    0x766e4942, 0x54736f43, 0x61746568, 0x65203d20, 0x42287078, 0x69202a20, 0x6f43766e, 0x65685473, 0x3b296174, 
-    0x20200a0d, 0x42707865, 0x20202020, 0x20202020, 0x20202020, 0x7865203d, 0x29422870, 0x200a0d3b, 0x70786520, 
-    0x6d614744, 0x2020616d, 0x20202020, 0x65203d20, 0x44287078, 0x67202a20, 0x616d6d61, 0x0a0d3b29, 0x78652020, 
-    0x68544470, 0x53617465, 0x20206e75, 0x203d2020, 0x28707865, 0x202a2044, 0x74656874, 0x6e755361, 0x0a0d3b29, 
-    0x20200a0d, 0x616f6c66, 0x20792074, 0x2828203d, 0x2b203128, 0x2a204120, 0x70786520, 0x766e4942, 0x54736f43, 
-    0x61746568, 0x202a2029, 0x2b203128, 0x2a204320, 0x70786520, 0x6d614744, 0x2b20616d, 0x2a204520, 0x736f6320, 
-    0x6d6d6147, 0x202a2061, 0x47736f63, 0x616d6d61, 0x0a0d2929, 0x20202020, 0x20202020, 0x20202020, 0x28202f20, 
-    0x2b203128, 0x2a204120, 0x70786520, 0x2a202942, 0x20312820, 0x2043202b, 0x7865202a, 0x68544470, 0x53617465, 
-    0x2b206e75, 0x2a204520, 0x736f6320, 0x74656854, 0x6e755361, 0x63202a20, 0x6854736f, 0x53617465, 0x29296e75, 
-    0x0a0d3b29, 0x20200a0d, 0x616f6c66, 0x6f6c2074, 0x536c6163, 0x72757461, 0x6f697461, 0x203d206e, 0x66302e31, 
-    0x0d0a0d3b, 0x7820200a, 0x7a203d20, 0x74696e65, 0x2a205868, 0x78282820, 0x6c202a20, 0x6c61636f, 0x75746153, 
-    0x69746172, 0x20296e6f, 0x3128202b, 0x2066302e, 0x6f6c202d, 0x536c6163, 0x72757461, 0x6f697461, 0x3b29296e, 
-    0x20200a0d, 0x203d2079, 0x696e657a, 0x20596874, 0x2828202a, 0x202a2079, 0x61636f6c, 0x7461536c, 0x74617275, 
-    0x296e6f69, 0x28202b20, 0x66302e31, 0x6c202d20, 0x6c61636f, 0x75746153, 0x69746172, 0x29296e6f, 0x0d0a0d3b, 
-    0x2f20200a, 0x6f63202f, 0x7265766e, 0x68632074, 0x616d6f72, 0x69636974, 0x73656974, 0x61207820, 0x7920646e, 
-    0x206f7420, 0x0d454943, 0x7820200a, 0x782e7a79, 0x28203d20, 0x202f2078, 0x2a202979, 0x7a797820, 0x0d3b792e, 
-    0x7820200a, 0x7a2e7a79, 0x28203d20, 0x302e3128, 0x202d2066, 0x202d2078, 0x2f202979, 0x20297920, 0x7978202a, 
-    0x3b792e7a, 0x20200a0d, 0x75746572, 0x78206e72, 0x0d3b7a79, 0x0a0d7d0a, 0x6e690a0d, 0x656e696c, 0x6f6c6620, 
-    0x73207461, 0x754c796b, 0x616e696d, 0x2865636e, 0x616f6c66, 0x69203374, 0x7269446e, 0x6c66202c, 0x3374616f, 
-    0x536e6920, 0x6f506e75, 0x66202c73, 0x74616f6c, 0x546e6920, 0x69627275, 0x79746964, 0x7b0a0d29, 0x20200a0d, 
-    0x616f6c66, 0x6f632074, 0x6d614773, 0x2020616d, 0x203d2020, 0x6d616c63, 0x6f642870, 0x6e692874, 0x506e7553, 
-    0x202c736f, 0x69446e69, 0x202c2972, 0x66302e30, 0x2e31202c, 0x3b296630, 0x20200a0d, 0x616f6c66, 0x61672074, 
-    0x20616d6d, 0x20202020, 0x203d2020, 0x736f6361, 0x736f6328, 0x6d6d6147, 0x0d3b2961, 0x6620200a, 0x74616f6c, 
-    0x736f6320, 0x74656854, 0x20202061, 0x69203d20, 0x7269446e, 0x0d3b7a2e, 0x6620200a, 0x74616f6c, 0x736f6320, 
-    0x74656854, 0x6e755361, 0x69203d20, 0x6e75536e, 0x2e736f50, 0x0a0d3b7a, 0x6c662020, 0x2074616f, 0x74656874, 
-    0x6e755361, 0x20202020, 0x6361203d, 0x6328736f, 0x6854736f, 0x53617465, 0x3b296e75, 0x0a0d0a0d, 0x6c662020, 
-    0x2074616f, 0x203d2041, 0x37312e30, 0x31323738, 0x202a2066, 0x75546e69, 0x64696272, 0x20797469, 0x2e31202d, 
-    0x30333634, 0x3b663733, 0x20200a0d, 0x616f6c66, 0x20422074, 0x302d203d, 0x3535332e, 0x66323034, 0x69202a20, 
-    0x7275546e, 0x69646962, 0x2b207974, 0x342e3020, 0x39343732, 0x0d3b6634, 0x6620200a, 0x74616f6c, 0x3d204320, 
-    0x2e302d20, 0x36323230, 0x20663936, 0x6e69202a, 0x62727554, 0x74696469, 0x202b2079, 0x32332e35, 0x36353035, 
-    0x0a0d3b66, 0x6c662020, 0x2074616f, 0x203d2044, 0x32312e30, 0x37343630, 0x202a2066, 0x75546e69, 0x64696272, 
-    0x20797469, 0x2e32202d, 0x30373735, 0x3b663235, 0x20200a0d, 0x616f6c66, 0x20452074, 0x302d203d, 0x3636302e, 
-    0x66373639, 0x69202a20, 0x7275546e, 0x69646962, 0x2b207974, 0x332e3020, 0x37323037, 0x0d3b6635, 0x200a0d0a, 
-    0x202f2f20, 0x63657250, 0x75706d6f, 0x65206574, 0x74207078, 0x736d7265, 0x206f7420, 0x75646572, 0x66206563, 
-    0x74636e75, 0x206e6f69, 0x6c6c6163, 0x200a0d73, 0x6f6c6620, 0x69207461, 0x6f43766e, 0x65685473, 0x20206174, 
-    0x3d202020, 0x302e3120, 0x202f2066, 0x2878616d, 0x54736f63, 0x61746568, 0x2e30202c, 0x66313030, 0x0a0d3b29, 
-    0x6c662020, 0x2074616f, 0x42707865, 0x43766e49, 0x6854736f, 0x20617465, 0x7865203d, 0x20422870, 0x6e69202a, 
-    0x736f4376, 0x74656854, 0x0d3b2961, 0x6620200a, 0x74616f6c, 0x70786520, 0x20202042, 0x20202020, 0x20202020, 
-    0x65203d20, 0x42287078, 0x0a0d3b29, 0x6c662020, 0x2074616f, 0x44707865, 0x6d6d6147, 0x20202061, 0x20202020, 
-    0x7865203d, 0x20442870, 0x6167202a, 0x29616d6d, 0x200a0d3b, 0x6f6c6620, 0x65207461, 0x54447078, 0x61746568, 
-    0x206e7553, 0x3d202020, 0x70786520, 0x2a204428, 0x65687420, 0x75536174, 0x0d3b296e, 0x200a0d0a, 0x74657220, 
-    0x206e7275, 0x31282828, 0x41202b20, 0x65202a20, 0x49427078, 0x6f43766e, 0x65685473, 0x20296174, 0x3128202a, 
-    0x43202b20, 0x65202a20, 0x47447078, 0x616d6d61, 0x45202b20, 0x63202a20, 0x6147736f, 0x20616d6d, 0x6f63202a, 
-    0x6d614773, 0x2929616d, 0x20200a0d, 0x20202020, 0x20202020, 0x2828202f, 0x202b2031, 0x202a2041, 0x42707865, 
-    0x202a2029, 0x2b203128, 0x2a204320, 0x70786520, 0x65685444, 0x75536174, 0x202b206e, 0x202a2045, 0x54736f63, 
-    0x61746568, 0x206e7553, 0x6f63202a, 0x65685473, 0x75536174, 0x2929296e, 0x7d0a0d3b, 0x0a0d0a0d, 0x696c6e69, 
-    0x6620656e, 0x74616f6c, 0x61632033, 0x6b53636c, 0x6c6f4379, 0x6628726f, 0x74616f6c, 0x6e692033, 0x446e7553, 
-    0x202c7269, 0x616f6c66, 0x69203374, 0x7269446e, 0x6c66202c, 0x2074616f, 0x75546e69, 0x64696272, 0x29797469, 
-    0x0d7b0a0d, 0x6620200a, 0x74616f6c, 0x65687420, 0x75536174, 0x3d20206e, 0x6f636120, 0x6e692873, 0x446e7553, 
-    0x7a2e7269, 0x0a0d3b29, 0x6c662020, 0x2074616f, 0x20696863, 0x20202020, 0x203d2020, 0x302e3428, 0x202f2066, 
-    0x66302e39, 0x69202d20, 0x7275546e, 0x69646962, 0x2f207974, 0x30323120, 0x2966302e, 0x28202a20, 0x49505f4d, 
-    0x32202d20, 0x2066302e, 0x6874202a, 0x53617465, 0x3b296e75, 0x20200a0d, 0x616f6c66, 0x756c2074, 0x616e696d, 
-    0x2065636e, 0x3031203d, 0x302e3030, 0x202a2066, 0x2e342828, 0x33353430, 0x202a2066, 0x75546e69, 0x64696272, 
-    0x20797469, 0x2e34202d, 0x30313739, 0x2a202966, 0x6e617420, 0x69686328, 0x202d2029, 0x31322e30, 0x20663535, 
-    0x6e69202a, 0x62727554, 0x74696469, 0x202b2079, 0x31342e32, 0x29663239, 0x200a0d3b, 0x6d756c20, 0x6e616e69, 
-    0x2a206563, 0x6b73203d, 0x6d754c79, 0x6e616e69, 0x69286563, 0x7269446e, 0x6e69202c, 0x446e7553, 0x202c7269, 
-    0x75546e69, 0x64696272, 0x29797469, 0x0d0a0d3b, 0x6620200a, 0x74616f6c, 0x79782033, 0x203d207a, 0x43796b73, 
-    0x726f6c6f, 0x287a7958, 0x69446e69, 0x69202c72, 0x6e75536e, 0x2c726944, 0x546e6920, 0x69627275, 0x79746964, 
-    0x756c202c, 0x616e696d, 0x2965636e, 0x200a0d3b, 0x6f6c6620, 0x20337461, 0x43766e65, 0x726f6c6f, 0x66203d20, 
-    0x74616f6c, 0x2e332833, 0x66313432, 0x78202a20, 0x782e7a79, 0x31202d20, 0x3733352e, 0x202a2066, 0x2e7a7978, 
-    0x202d2079, 0x39342e30, 0x2a206639, 0x7a797820, 0x202c7a2e, 0x392e302d, 0x20663936, 0x7978202a, 0x20782e7a, 
-    0x2e31202b, 0x66363738, 0x78202a20, 0x792e7a79, 0x30202b20, 0x3234302e, 0x202a2066, 0x2e7a7978, 0x0a0d2c7a, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x30202020, 0x3635302e, 0x202a2066, 
-    0x2e7a7978, 0x202d2078, 0x30322e30, 0x2a206634, 0x7a797820, 0x2b20792e, 0x302e3120, 0x20663735, 0x7978202a, 
-    0x297a2e7a, 0x200a0d3b, 0x74657220, 0x206e7275, 0x43766e65, 0x726f6c6f, 0x4d202a20, 0x3b49505f, 0x0d7d0a0d, 
-    0x690a0d0a, 0x6e696c6e, 0x6c662065, 0x3374616f, 0x6c616320, 0x796b5363, 0x61727249, 0x6e616964, 0x66286563, 
-    0x74616f6c, 0x6e692033, 0x61746144, 0x446e7553, 0x202c7269, 0x616f6c66, 0x6e692074, 0x61746144, 0x446e7553, 
-    0x61487269, 0x0d29657a, 0x0a0d7b0a, 0x6c662020, 0x3374616f, 0x6c6f6320, 0x206d7553, 0x20202020, 0x3d202020, 
-    0x6f6c6620, 0x28337461, 0x66302e30, 0x0a0d3b29, 0x6c662020, 0x3374616f, 0x53756e20, 0x65746174, 0x6d726f4e, 
-    0x3d206c61, 0x6f6c6620, 0x28337461, 0x66302e30, 0x2e30202c, 0x202c6630, 0x66302e31, 0x0a0d3b29, 0x20200a0d, 
-    0x28726f66, 0x616f6c66, 0x20752074, 0x2e30203d, 0x66353231, 0x2075203b, 0x2e31203c, 0x203b6630, 0x3d2b2075, 
-    0x322e3020, 0x0d296635, 0x7b20200a, 0x20200a0d, 0x6f662020, 0x6c662872, 0x2074616f, 0x203d2076, 0x32312e30, 
-    0x203b6635, 0x203c2076, 0x66302e31, 0x2076203b, 0x30203d2b, 0x6635322e, 0x200a0d29, 0x7b202020, 0x20200a0d, 
-    0x20202020, 0x616f6c66, 0x64203374, 0x20666669, 0x6572203d, 0x63656c66, 0x6e6f6974, 0x44726944, 0x75666669, 
-    0x28586573, 0x7453756e, 0x4e657461, 0x616d726f, 0x66202c6c, 0x74616f6c, 0x2c752832, 0x29297620, 0x200a0d3b, 
-    0x20202020, 0x6c6f6320, 0x206d7553, 0x63203d2b, 0x53636c61, 0x6f43796b, 0x28726f6c, 0x61446e69, 0x75536174, 
-    0x7269446e, 0x6964202c, 0x202c6666, 0x61446e69, 0x75536174, 0x7269446e, 0x657a6148, 0x0a0d3b29, 0x20202020, 
-    0x200a0d7d, 0x0a0d7d20, 0x65722020, 0x6e727574, 0x6c6f6320, 0x206d7553, 0x3631202f, 0x3b66302e, 0x0d7d0a0d, 
-    0x690a0d0a, 0x6e696c6e, 0x6c662065, 0x2074616f, 0x61657774, 0x7461536b, 0x74617275, 0x286e6f69, 0x616f6c66, 
-    0x6e692074, 0x75746153, 0x69746172, 0x202c6e6f, 0x616f6c66, 0x6e692074, 0x657a6148, 0x7b0a0d29, 0x20200a0d, 
-    0x69286669, 0x7461536e, 0x74617275, 0x206e6f69, 0x2e31203e, 0x0d296630, 0x2020200a, 0x74657220, 0x206e7275, 
-    0x66302e31, 0x0d0a0d3b, 0x6620200a, 0x74616f6c, 0x776f6c20, 0x20746153, 0x3d202020, 0x536e6920, 0x72757461, 
-    0x6f697461, 0x202a206e, 0x61536e69, 0x61727574, 0x6e6f6974, 0x69202a20, 0x7461536e, 0x74617275, 0x3b6e6f69, 
-    0x2f2f2020, 0x6d6f4320, 0x65747570, 0x65687420, 0x776f6c20, 0x74617320, 0x74617275, 0x206e6f69, 0x756c6176, 
-    0x200a0d65, 0x6f6c6620, 0x6c207461, 0x6c61636f, 0x657a6148, 0x63203d20, 0x706d616c, 0x6e692828, 0x657a6148, 
-    0x32202d20, 0x2966302e, 0x31202f20, 0x66302e35, 0x2e30202c, 0x202c6630, 0x66302e31, 0x20203b29, 0x4e202f2f, 
-    0x616d726f, 0x657a696c, 0x65687420, 0x636f6c20, 0x68206c61, 0x20657a61, 0x756c6176, 0x200a0d65, 0x636f6c20, 
-    0x61486c61, 0x2a20657a, 0x6f6c203d, 0x486c6163, 0x20657a61, 0x6f6c202a, 0x486c6163, 0x3b657a61, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x41202f2f, 0x73756a64, 0x61682074, 
-    0x7420657a, 0x6874206f, 0x6f702065, 0x20726577, 0x3320666f, 0x20200a0d, 0x75746572, 0x6c206e72, 0x28707265, 
-    0x61536e69, 0x61727574, 0x6e6f6974, 0x6f6c202c, 0x74615377, 0x6f6c202c, 0x486c6163, 0x29657a61, 0x2f20203b, 
-    0x6c42202f, 0x20646e65, 0x20656874, 0x75706e69, 0x61732074, 0x61727574, 0x6e6f6974, 0x74697720, 0x68742068, 
-    0x6f6c2065, 0x61732077, 0x61727574, 0x6e6f6974, 0x6c617620, 0x62206575, 0x64657361, 0x206e6f20, 0x61636f6c, 
-    0x6168206c, 0x0a0d657a, 0x0d0a0d7d, 0x690a0d0a, 0x6e696c6e, 0x6c662065, 0x3374616f, 0x65777420, 0x65566b61, 
-    0x726f7463, 0x6f6c6628, 0x20337461, 0x2c726964, 0x746e6920, 0x73497920, 0x202c7055, 0x616f6c66, 0x6f682074, 
-    0x487a6972, 0x68676965, 0x0a0d2974, 0x200a0d7b, 0x6f6c6620, 0x20337461, 0x4474756f, 0x3d207269, 0x72696420, 
-    0x200a0d3b, 0x28666920, 0x55734979, 0x3d3d2070, 0x0d293120, 0x7b20200a, 0x20200a0d, 0x756f2020, 0x72694474, 
-    0x66203d20, 0x74616f6c, 0x69642833, 0x2c782e72, 0x72696420, 0x202c7a2e, 0x2e726964, 0x0d3b2979, 0x7d20200a, 
-    0x20200a0d, 0x68286669, 0x7a69726f, 0x67696548, 0x21207468, 0x2930203d, 0x20200a0d, 0x200a0d7b, 0x6f202020, 
-    0x69447475, 0x207a2e72, 0x68203d2d, 0x7a69726f, 0x67696548, 0x0d3b7468, 0x2020200a, 0x74756f20, 0x20726944, 
-    0x6f6e203d, 0x6c616d72, 0x28657a69, 0x4474756f, 0x3b297269, 0x20200a0d, 0x200a0d7d, 0x74657220, 0x206e7275, 
-    0x4474756f, 0x0d3b7269, 0x0a0d7d0a, 0x6e690a0d, 0x656e696c, 0x6f6c6620, 0x20337461, 0x61657774, 0x6c6f436b, 
-    0x6628726f, 0x74616f6c, 0x69742033, 0x202c746e, 0x616f6c66, 0x61732074, 0x61727574, 0x6e6f6974, 0x6c66202c, 
-    0x2074616f, 0x6e646572, 0x29737365, 0x0d7b0a0d, 0x6620200a, 0x74616f6c, 0x6e692020, 0x736e6574, 0x20797469, 
-    0x6772203d, 0x6d754c62, 0x6e616e69, 0x74286563, 0x29746e69, 0x200a0d3b, 0x6f6c6620, 0x20337461, 0x5474756f, 
-    0x20746e69, 0x203d2020, 0x74617328, 0x74617275, 0x206e6f69, 0x30203d3c, 0x2966302e, 0x66203f20, 0x74616f6c, 
-    0x6e692833, 0x736e6574, 0x29797469, 0x6c203a20, 0x28707265, 0x616f6c66, 0x69283374, 0x6e65746e, 0x79746973, 
-    0x74202c29, 0x2c746e69, 0x74617320, 0x74617275, 0x296e6f69, 0x200a0d3b, 0x74756f20, 0x746e6954, 0x203d2a20, 
-    0x616f6c66, 0x31283374, 0x2066302e, 0x6572202b, 0x73656e64, 0x31202c73, 0x2c66302e, 0x302e3120, 0x202d2066, 
-    0x6e646572, 0x29737365, 0x200a0d3b, 0x74657220, 0x206e7275, 0x2878616d, 0x5474756f, 0x2c746e69, 0x6f6c6620, 
-    0x28337461, 0x66302e30, 0x0d3b2929, 0x0a0d7d0a, 0x6e690a0d, 0x656e696c, 0x6f6c6620, 0x20327461, 0x636c6163, 
-    0x73796850, 0x6c616369, 0x6c616353, 0x6c662865, 0x2074616f, 0x446e7573, 0x536b7369, 0x656c6163, 0x6c66202c, 
-    0x2074616f, 0x476e7573, 0x49776f6c, 0x6e65746e, 0x79746973, 0x6c66202c, 0x2074616f, 0x446e7573, 0x496b7369, 
-    0x6e65746e, 0x79746973, 0x7b0a0d29, 0x20200a0d, 0x616f6c66, 0x75732074, 0x676e416e, 0x72616c75, 0x69646152, 
-    0x3d207375, 0x302e3020, 0x35363430, 0x0a0d3b66, 0x6c662020, 0x2074616f, 0x446e7573, 0x526b7369, 0x75696461, 
-    0x20202073, 0x73203d20, 0x6e416e75, 0x616c7567, 0x64615272, 0x20737569, 0x7573202a, 0x7369446e, 0x6163536b, 
-    0x0d3b656c, 0x6620200a, 0x74616f6c, 0x6e757320, 0x776f6c47, 0x69646152, 0x20207375, 0x203d2020, 0x446e7573, 
-    0x526b7369, 0x75696461, 0x202a2073, 0x302e3031, 0x0a0d3b66, 0x20200a0d, 0x50202f2f, 0x6f636572, 0x7475706d, 
-    0x6f632065, 0x6174736e, 0x2073746e, 0x72206f74, 0x63756465, 0x65722065, 0x646e7564, 0x20746e61, 0x636c6163, 
-    0x74616c75, 0x736e6f69, 0x20200a0d, 0x616f6c66, 0x75732074, 0x6f6c476e, 0x64615277, 0x53737569, 0x20202071, 
-    0x73203d20, 0x6c476e75, 0x6152776f, 0x73756964, 0x73202a20, 0x6c476e75, 0x6152776f, 0x73756964, 0x200a0d3b, 
-    0x6f6c6620, 0x73207461, 0x6c476e75, 0x6152776f, 0x73756964, 0x65627543, 0x203d2064, 0x476e7573, 0x52776f6c, 
-    0x75696461, 0x20715373, 0x7573202a, 0x6f6c476e, 0x64615277, 0x3b737569, 0x0a0d0a0d, 0x2a2f2020, 0x20655720, 
-    0x636c6163, 0x74616c75, 0x68742065, 0x6e692065, 0x72676574, 0x6f206c61, 0x68742066, 0x6c672065, 0x6920776f, 
-    0x6e65746e, 0x79746973, 0x6e756620, 0x6f697463, 0x2f2a206e, 0x20200a0d, 0x616f6c66, 0x6c672074, 0x7546776f, 
-    0x6e49636e, 0x72676574, 0x3d206c61, 0x20200a0d, 0x20202020, 0x476e7573, 0x49776f6c, 0x6e65746e, 0x79746973, 
-    0x28202a20, 0x302e3428, 0x202a2066, 0x49505f4d, 0x202d2029, 0x2e343228, 0x2a206630, 0x505f4d20, 0x2f202949, 
-    0x6e757320, 0x776f6c47, 0x69646152, 0x71537375, 0x28202b20, 0x302e3432, 0x202a2066, 0x49505f4d, 0x202a2029, 
-    0x286e6973, 0x476e7573, 0x52776f6c, 0x75696461, 0x2f202973, 0x6e757320, 0x776f6c47, 0x69646152, 0x75437375, 
-    0x29646562, 0x0d0a0d3b, 0x200a0d0a, 0x202a2f20, 0x636c6143, 0x74616c75, 0x68742065, 0x61742065, 0x74656772, 
-    0x6e757320, 0x73696420, 0x6e69206b, 0x736e6574, 0x20797469, 0x65746e69, 0x6c617267, 0x68742820, 0x61762065, 
-    0x2065756c, 0x61776f74, 0x20736472, 0x63696877, 0x200a0d68, 0x77202020, 0x756d2065, 0x73207473, 0x656c6163, 
-    0x206f7420, 0x61747461, 0x61206e69, 0x79687020, 0x61636973, 0x2d796c6c, 0x6c616373, 0x73206465, 0x69206e75, 
-    0x6e65746e, 0x79746973, 0x0d2f2a20, 0x6620200a, 0x74616f6c, 0x72617420, 0x53746567, 0x69646e75, 0x6e496b73, 
-    0x72676574, 0x3d206c61, 0x6e757320, 0x6b736944, 0x65746e49, 0x7469736e, 0x202a2079, 0x49505f4d, 0x0d0a0d3b, 
-    0x2f20200a, 0x7553202a, 0x61727462, 0x74207463, 0x67206568, 0x20776f6c, 0x65746e69, 0x6c617267, 0x6f726620, 
-    0x6874206d, 0x61742065, 0x74656772, 0x73696420, 0x6e69206b, 0x72676574, 0x0d2c6c61, 0x2020200a, 0x6d696c20, 
-    0x6e697469, 0x68742067, 0x6c672065, 0x7020776f, 0x7265776f, 0x206f7420, 0x20253035, 0x7420666f, 0x73206568, 
-    0x64206e75, 0x206b7369, 0x0a0d2f2a, 0x6c662020, 0x2074616f, 0x53796b73, 0x6c676e75, 0x6353776f, 0x20656c61, 
-    0x2e31203d, 0x0d3b6630, 0x6620200a, 0x74616f6c, 0x78616d20, 0x776f6c47, 0x65746e49, 0x6c617267, 0x30203d20, 
-    0x2066352e, 0x6174202a, 0x74656772, 0x646e7553, 0x496b7369, 0x6765746e, 0x3b6c6172, 0x20200a0d, 0x67286669, 
-    0x46776f6c, 0x49636e75, 0x6765746e, 0x206c6172, 0x616d203e, 0x6f6c4778, 0x746e4977, 0x61726765, 0x0a0d296c, 
-    0x0d7b2020, 0x2020200a, 0x796b7320, 0x676e7553, 0x53776f6c, 0x656c6163, 0x203d2a20, 0x4778616d, 0x49776f6c, 
-    0x6765746e, 0x206c6172, 0x6c67202f, 0x7546776f, 0x6e49636e, 0x72676574, 0x0d3b6c61, 0x2020200a, 0x72617420, 
-    0x53746567, 0x69646e75, 0x6e496b73, 0x72676574, 0x2d206c61, 0x616d203d, 0x6f6c4778, 0x746e4977, 0x61726765, 
-    0x0a0d3b6c, 0x0d7d2020, 0x6520200a, 0x0d65736c, 0x7b20200a, 0x20200a0d, 0x61742020, 0x74656772, 0x646e7553, 
-    0x496b7369, 0x6765746e, 0x206c6172, 0x67203d2d, 0x46776f6c, 0x49636e75, 0x6765746e, 0x3b6c6172, 0x20200a0d, 
-    0x0d0a0d7d, 0x6620200a, 0x74616f6c, 0x736f6320, 0x446e7553, 0x526b7369, 0x75696461, 0x20202073, 0x20202020, 
-    0x6f63203d, 0x75732873, 0x7369446e, 0x6461526b, 0x29737569, 0x200a0d3b, 0x6f6c6620, 0x73207461, 0x69646e75, 
-    0x72416b73, 0x20206165, 0x20202020, 0x20202020, 0x203d2020, 0x202a2032, 0x49505f4d, 0x28202a20, 0x202d2031, 
-    0x53736f63, 0x69446e75, 0x61526b73, 0x73756964, 0x0a0d3b29, 0x6c662020, 0x2074616f, 0x67726174, 0x75537465, 
-    0x7369646e, 0x746e496b, 0x69736e65, 0x3d207974, 0x72617420, 0x53746567, 0x69646e75, 0x6e496b73, 0x72676574, 
-    0x2f206c61, 0x6e757320, 0x6b736964, 0x61657241, 0x0d0a0d3b, 0x2f20200a, 0x6143202a, 0x6c75636c, 0x20657461, 
-    0x20656874, 0x75746361, 0x73206c61, 0x64206e75, 0x206b7369, 0x65746e69, 0x7469736e, 0x62202c79, 0x726f6665, 
-    0x63732065, 0x6e696c61, 0x73692067, 0x70706120, 0x6465696c, 0x0d2f2a20, 0x6620200a, 0x74616f6c, 0x74636120, 
-    0x536c6175, 0x69646e75, 0x6e496b73, 0x72676574, 0x3d206c61, 0x302e3120, 0x202a2066, 0x646e7573, 0x416b7369, 
-    0x3b616572, 0x20200a0d, 0x61202a2f, 0x6f727070, 0x616d6978, 0x6e6f6974, 0x656e2021, 0x20736465, 0x62206f74, 
-    0x65722065, 0x6c61632d, 0x616c7563, 0x20646574, 0x6d6f7266, 0x65687420, 0x746e6920, 0x61726765, 0x666f206c, 
-    0x65687420, 0x6e756620, 0x6f697463, 0x2f2a206e, 0x20200a0d, 0x616f6c66, 0x63612074, 0x6c617574, 0x646e7553, 
-    0x496b7369, 0x6e65746e, 0x79746973, 0x73203d20, 0x69446e75, 0x6e496b73, 0x736e6574, 0x20797469, 0x3031202a, 
-    0x66302e30, 0x61202a20, 0x61757463, 0x6e75536c, 0x6b736964, 0x65746e49, 0x6c617267, 0x73202f20, 0x69646e75, 
-    0x72416b73, 0x0d3b6165, 0x2f20200a, 0x7041202a, 0x20796c70, 0x20656874, 0x706f7270, 0x73207265, 0x696c6163, 
-    0x7420676e, 0x6567206f, 0x6f742074, 0x65687420, 0x72617420, 0x20746567, 0x756c6176, 0x2f2a2065, 0x20200a0d, 
-    0x75746572, 0x66206e72, 0x74616f6c, 0x74282832, 0x65677261, 0x6e755374, 0x6b736964, 0x65746e49, 0x7469736e, 
-    0x3d3d2079, 0x302e3020, 0x3f202966, 0x302e3020, 0x203a2066, 0x67726174, 0x75537465, 0x7369646e, 0x746e496b, 
-    0x69736e65, 0x2f207974, 0x74636120, 0x536c6175, 0x69646e75, 0x6e496b73, 0x736e6574, 0x2c797469, 0x796b7320, 
-    0x676e7553, 0x53776f6c, 0x656c6163, 0x0a0d3b29, 0x0d0a0d7d, 0x6c6e690a, 0x20656e69, 0x616f6c66, 0x696e2074, 
-    0x42746867, 0x68676972, 0x73656e74, 0x6a644173, 0x6d747375, 0x28746e65, 0x616f6c66, 0x73203374, 0x69446e75, 
-    0x0a0d2972, 0x200a0d7b, 0x6f6c6620, 0x6c207461, 0x3d20746d, 0x332e3020, 0x31303930, 0x34393936, 0x39343733, 
-    0x32343734, 0x32303134, 0x34333932, 0x38313731, 0x66323832, 0x2f20203b, 0x207e202f, 0x28736f63, 0xb0c23237, 
-    0x726f2029, 0xc2383120, 0x656220b0, 0x20776f6c, 0x20656874, 0x69726f68, 0x0d6e6f7a, 0x6920200a, 0x75732866, 
-    0x7269446e, 0x3c207a2e, 0x6c2d203d, 0x0d29746d, 0x2020200a, 0x74657220, 0x206e7275, 0x66302e30, 0x200a0d3b, 
-    0x6f6c6620, 0x66207461, 0x6f746361, 0x203d2072, 0x6e757328, 0x2e726944, 0x202b207a, 0x29746d6c, 0x6c202f20, 
-    0x0d3b746d, 0x6620200a, 0x6f746361, 0x3d2a2072, 0x63616620, 0x3b726f74, 0x20200a0d, 0x74636166, 0x2a20726f, 
-    0x6166203d, 0x726f7463, 0x200a0d3b, 0x74657220, 0x206e7275, 0x74636166, 0x0d3b726f, 0x0a0d7d0a, 0x2a2f0a0d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x230a0d2d, 0x6e754620, 0x6f697463, 
-    0x6560206e, 0x506c6176, 0x69737968, 0x536c6163, 0x0d60796b, 0x52203e0a, 0x72757465, 0x7420736e, 0x72206568, 
-    0x61696461, 0x2065636e, 0x7420666f, 0x70206568, 0x69737968, 0x206c6163, 0x20796b73, 0x65646f6d, 0x6e69206c, 
-    0x67206120, 0x6e657669, 0x72696420, 0x69746365, 0x0d2e6e6f, 0x2d2d2d0a, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2f2a2d2d, 0x6e690a0d, 0x656e696c, 0x6f6c6620, 0x20337461, 0x6c617665, 0x73796850, 
-    0x6c616369, 0x28796b53, 0x50796b53, 0x69737968, 0x506c6163, 0x6d617261, 0x72657465, 0x73732073, 0x6c66202c, 
-    0x3374616f, 0x446e6920, 0x63657269, 0x6e6f6974, 0x7b0a0d29, 0x20200a0d, 0x73286669, 0x756d2e73, 0x7069746c, 
-    0x7265696c, 0x203d3c20, 0x66302e30, 0x200a0d29, 0x72202020, 0x72757465, 0x6c66206e, 0x3374616f, 0x302e3028, 
-    0x0d3b2966, 0x200a0d0a, 0x6f6c6620, 0x20337461, 0x75736572, 0x2020746c, 0x20202020, 0x20202020, 0x6c66203d, 
-    0x3374616f, 0x302e3028, 0x0d3b2966, 0x6620200a, 0x74616f6c, 0x61662020, 0x726f7463, 0x20202020, 0x20202020, 
-    0x203d2020, 0x66302e31, 0x200a0d3b, 0x6f6c6620, 0x20207461, 0x6867696e, 0x63614674, 0x20726f74, 0x20202020, 
-    0x2e31203d, 0x0d3b6630, 0x6620200a, 0x74616f6c, 0x756f2033, 0x6c6f4374, 0x2020726f, 0x20202020, 0x203d2020, 
-    0x616f6c66, 0x30283374, 0x2966302e, 0x200a0d3b, 0x6f6c6620, 0x20337461, 0x53626772, 0x656c6163, 0x20202020, 
-    0x20202020, 0x7373203d, 0x6267722e, 0x74696e55, 0x766e6f43, 0x69737265, 0x2a206e6f, 0x2e737320, 0x746c756d, 
-    0x696c7069, 0x0d3b7265, 0x6620200a, 0x74616f6c, 0x65682020, 0x74686769, 0x756a6441, 0x64657473, 0x203d2020, 
-    0x2e737328, 0x69726f68, 0x486e6f7a, 0x68676965, 0x202b2074, 0x682e7373, 0x7a69726f, 0x6c426e6f, 0x20297275, 
-    0x3031202f, 0x3b66302e, 0x20200a0d, 0x616f6c66, 0x64203374, 0x20207269, 0x20202020, 0x20202020, 0x3d202020, 
-    0x65777420, 0x65566b61, 0x726f7463, 0x446e6928, 0x63657269, 0x6e6f6974, 0x7373202c, 0x7349792e, 0x202c7055, 
-    0x67696568, 0x64417468, 0x7473756a, 0x3b296465, 0x20200a0d, 0x616f6c66, 0x6c202074, 0x6c61636f, 0x657a6148, 
-    0x20202020, 0x3d202020, 0x78616d20, 0x302e3228, 0x32202c66, 0x2066302e, 0x7373202b, 0x7a61682e, 0x0d3b2965, 
-    0x6620200a, 0x74616f6c, 0x6f6c2020, 0x536c6163, 0x72757461, 0x6f697461, 0x203d206e, 0x61657774, 0x7461536b, 
-    0x74617275, 0x286e6f69, 0x732e7373, 0x72757461, 0x6f697461, 0x6c202c6e, 0x6c61636f, 0x657a6148, 0x0a0d3b29, 
-    0x20200a0d, 0x43202f2f, 0x75636c61, 0x6574616c, 0x65687420, 0x6f642220, 0x656e6e77, 0x20227373, 0x7420666f, 
-    0x64206568, 0x63657269, 0x6e6f6974, 0x6f682820, 0x756d2077, 0x69206863, 0x6f702074, 0x73746e69, 0x776f6420, 
-    0x7261776e, 0x0a0d2964, 0x6c662020, 0x2074616f, 0x776f6420, 0x73656e6e, 0x203d2073, 0x2e726964, 0x0a0d3b7a, 
-    0x6c662020, 0x3374616f, 0x61657220, 0x7269446c, 0x203d2020, 0x3b726964, 0x20200a0d, 0x64286669, 0x7a2e7269, 
-    0x30203c20, 0x3130302e, 0x0a0d2966, 0x0d7b2020, 0x2020200a, 0x72696420, 0x3d207a2e, 0x302e3020, 0x3b663130, 
-    0x20200a0d, 0x69642020, 0x20202072, 0x6f6e203d, 0x6c616d72, 0x28657a69, 0x29726964, 0x200a0d3b, 0x0a0d7d20, 
-    0x20200a0d, 0x41202f2f, 0x73756a64, 0x68742074, 0x75732065, 0x6964206e, 0x74636572, 0x206e6f69, 0x696d6973, 
-    0x6c72616c, 0x6f742079, 0x65687420, 0x706e6920, 0x64207475, 0x63657269, 0x6e6f6974, 0x20200a0d, 0x616f6c66, 
-    0x73203374, 0x69446e75, 0x20202072, 0x203d2020, 0x732e7373, 0x69446e75, 0x74636572, 0x3b6e6f69, 0x20200a0d, 
-    0x446e7573, 0x20207269, 0x20202020, 0x20202020, 0x203d2020, 0x61657774, 0x6365566b, 0x28726f74, 0x446e7573, 
-    0x202c7269, 0x792e7373, 0x70557349, 0x6568202c, 0x74686769, 0x756a6441, 0x64657473, 0x0a0d3b29, 0x6c662020, 
-    0x3374616f, 0x61657220, 0x6e75536c, 0x20726944, 0x7573203d, 0x7269446e, 0x200a0d3b, 0x28666920, 0x446e7573, 
-    0x7a2e7269, 0x30203c20, 0x3130302e, 0x0a0d2966, 0x0d7b2020, 0x2020200a, 0x202f2f20, 0x756a6441, 0x62207473, 
-    0x68676972, 0x73656e74, 0x6f662073, 0x696e2072, 0x20746867, 0x656d6974, 0x20200a0d, 0x61662020, 0x726f7463, 
-    0x3d202020, 0x67696e20, 0x72427468, 0x74686769, 0x7373656e, 0x756a6441, 0x656d7473, 0x7328746e, 0x69446e75, 
-    0x0d3b2972, 0x2020200a, 0x6e757320, 0x2e726944, 0x203d207a, 0x30302e30, 0x0d3b6631, 0x2020200a, 0x6e757320, 
-    0x20726944, 0x203d2020, 0x6d726f6e, 0x7a696c61, 0x75732865, 0x7269446e, 0x0a0d3b29, 0x0d7d2020, 0x200a0d0a, 
-    0x202f2f20, 0x636c6143, 0x74616c75, 0x68742065, 0x75732065, 0x6e61206e, 0x6b732064, 0x6f632079, 0x0d726f6c, 
-    0x6620200a, 0x74616f6c, 0x69742033, 0x2020746e, 0x20202020, 0x3d202020, 0x61662820, 0x726f7463, 0x30203e20, 
-    0x2966302e, 0x63203f20, 0x53636c61, 0x6f43796b, 0x28726f6c, 0x446e7573, 0x202c7269, 0x2c726964, 0x636f6c20, 
-    0x61486c61, 0x2029657a, 0x6166202a, 0x726f7463, 0x66203a20, 0x74616f6c, 0x2e302833, 0x3b296630, 0x20200a0d, 
-    0x616f6c66, 0x64203374, 0x53617461, 0x6f436e75, 0x20726f6c, 0x6163203d, 0x7553636c, 0x6c6f436e, 0x7328726f, 
-    0x69446e75, 0x28202c72, 0x6e776f64, 0x7373656e, 0x30203e20, 0x203f2029, 0x61636f6c, 0x7a61486c, 0x203a2065, 
-    0x66302e32, 0x0a0d3b29, 0x20200a0d, 0x41202f2f, 0x74206464, 0x73206568, 0x64206e75, 0x206b7369, 0x20646e61, 
-    0x776f6c67, 0x20666920, 0x62616e65, 0x0d64656c, 0x6920200a, 0x73732866, 0x6e75732e, 0x6b736944, 0x65746e49, 
-    0x7469736e, 0x203e2079, 0x66302e30, 0x20262620, 0x732e7373, 0x69446e75, 0x63536b73, 0x20656c61, 0x2e30203e, 
-    0x0d296630, 0x7b20200a, 0x20200a0d, 0x6c662020, 0x2074616f, 0x416e7573, 0x656c676e, 0x3d202020, 0x6f636120, 
-    0x6f642873, 0x65722874, 0x69446c61, 0x72202c72, 0x536c6165, 0x69446e75, 0x3b292972, 0x20200a0d, 0x6c662020, 
-    0x2074616f, 0x776f6c67, 0x69646152, 0x3d207375, 0x302e3020, 0x35363430, 0x202a2066, 0x732e7373, 0x69446e75, 
-    0x63536b73, 0x20656c61, 0x3031202a, 0x3b66302e, 0x20200a0d, 0x66692020, 0x6e757328, 0x6c676e41, 0x203c2065, 
-    0x776f6c67, 0x69646152, 0x0d297375, 0x2020200a, 0x0a0d7b20, 0x20202020, 0x6c662020, 0x3274616f, 0x61637320, 
-    0x2073656c, 0x6163203d, 0x6850636c, 0x63697379, 0x63536c61, 0x28656c61, 0x732e7373, 0x69446e75, 0x63536b73, 
-    0x2c656c61, 0x2e737320, 0x476e7573, 0x49776f6c, 0x6e65746e, 0x79746973, 0x7373202c, 0x6e75732e, 0x6b736944, 
-    0x65746e49, 0x7469736e, 0x0d3b2979, 0x2020200a, 0x2f202020, 0x2041202f, 0x756c6176, 0x666f2065, 0x69203020, 
-    0x74612073, 0x65687420, 0x67646520, 0x666f2065, 0x65687420, 0x6f6c6720, 0x69642077, 0x203b6b73, 0x61762061, 
-    0x2065756c, 0x3120666f, 0x20736920, 0x74206e69, 0x0a0d6568, 0x20202020, 0x2f2f2020, 0x6e656320, 0x20726574, 
-    0x7420666f, 0x73206568, 0x0d2e6e75, 0x2020200a, 0x66202020, 0x74616f6c, 0x6e656320, 0x50726574, 0x69786f72, 
-    0x7974696d, 0x20202020, 0x203d2020, 0x302e3128, 0x202d2066, 0x416e7573, 0x656c676e, 0x67202f20, 0x52776f6c, 
-    0x75696461, 0x0d3b2973, 0x2020200a, 0x66202020, 0x74616f6c, 0x6e656320, 0x50726574, 0x69786f72, 0x7974696d, 
-    0x20207153, 0x203d2020, 0x746e6563, 0x72507265, 0x6d69786f, 0x20797469, 0x6563202a, 0x7265746e, 0x786f7250, 
-    0x74696d69, 0x0a0d3b79, 0x20202020, 0x6c662020, 0x2074616f, 0x746e6563, 0x72507265, 0x6d69786f, 0x43797469, 
-    0x64656275, 0x63203d20, 0x65746e65, 0x6f725072, 0x696d6978, 0x71537974, 0x63202a20, 0x65746e65, 0x6f725072, 
-    0x696d6978, 0x0d3b7974, 0x2020200a, 0x66202020, 0x74616f6c, 0x6f6c6720, 0x63614677, 0x20726f74, 0x20202020, 
-    0x20202020, 0x203d2020, 0x746e6563, 0x72507265, 0x6d69786f, 0x43797469, 0x64656275, 0x32202a20, 0x2066302e, 
-    0x7373202a, 0x6e75732e, 0x776f6c47, 0x65746e49, 0x7469736e, 0x202a2079, 0x6c616373, 0x792e7365, 0x200a0d3b, 
-    0x20202020, 0x6f6c6620, 0x64207461, 0x466b7369, 0x6f746361, 0x0d3d2072, 0x2020200a, 0x20202020, 0x73202020, 
-    0x746f6f6d, 0x65747368, 0x2e302870, 0x2c663538, 0x392e3020, 0x2b206635, 0x6f6c2820, 0x486c6163, 0x20657a61, 
-    0x3035202f, 0x66302e30, 0x63202c29, 0x65746e65, 0x6f725072, 0x696d6978, 0x20297974, 0x3031202a, 0x66302e30, 
-    0x73202a20, 0x75732e73, 0x7369446e, 0x746e496b, 0x69736e65, 0x2a207974, 0x61637320, 0x2e73656c, 0x0a0d3b78, 
-    0x20202020, 0x69742020, 0x2b20746e, 0x6164203d, 0x75536174, 0x6c6f436e, 0x2a20726f, 0x6c672820, 0x6146776f, 
-    0x726f7463, 0x64202b20, 0x466b7369, 0x6f746361, 0x0d3b2972, 0x2020200a, 0x0a0d7d20, 0x0d7d2020, 0x6f20200a, 
-    0x6f437475, 0x20726f6c, 0x6974203d, 0x2a20746e, 0x62677220, 0x6c616353, 0x0a0d3b65, 0x20200a0d, 0x41202f2f, 
-    0x67206464, 0x6e756f72, 0x6f632064, 0x20726f6c, 0x74206669, 0x64206568, 0x63657269, 0x6e6f6974, 0x20736920, 
-    0x6e696f70, 0x676e6974, 0x776f6420, 0x7261776e, 0x200a0d64, 0x28666920, 0x6e776f64, 0x7373656e, 0x203d3c20, 
-    0x66302e30, 0x200a0d29, 0x0a0d7b20, 0x20202020, 0x616f6c66, 0x69203374, 0x64617272, 0x20202020, 0x63203d20, 
-    0x53636c61, 0x7249796b, 0x69646172, 0x65636e61, 0x6e757328, 0x2c726944, 0x302e3220, 0x0d3b2966, 0x2020200a, 
-    0x6f6c6620, 0x20337461, 0x6e776f64, 0x6f6c6f43, 0x203d2072, 0x672e7373, 0x6e756f72, 0x6c6f4364, 0x2a20726f, 
-    0x72692820, 0x20646172, 0x6164202b, 0x75536174, 0x6c6f436e, 0x2a20726f, 0x6e757320, 0x2e726944, 0x2a20297a, 
-    0x62677220, 0x6c616353, 0x0a0d3b65, 0x20202020, 0x6e776f64, 0x6f6c6f43, 0x3d2a2072, 0x63616620, 0x3b726f74, 
-    0x20200a0d, 0x6c662020, 0x2074616f, 0x42726f68, 0x2072756c, 0x7373203d, 0x726f682e, 0x6e6f7a69, 0x72756c42, 
-    0x31202f20, 0x66302e30, 0x200a0d3b, 0x69202020, 0x6f682866, 0x756c4272, 0x203e2072, 0x66302e30, 0x200a0d29, 
-    0x7b202020, 0x20200a0d, 0x20202020, 0x42202f2f, 0x646e656c, 0x74656220, 0x6e656577, 0x796b7320, 0x646e6120, 
-    0x6f726720, 0x20646e75, 0x6f6c6f63, 0x74612072, 0x65687420, 0x726f6820, 0x6e6f7a69, 0x20200a0d, 0x20202020, 
-    0x616f6c66, 0x6e642074, 0x20737365, 0x6d73203d, 0x68746f6f, 0x70657473, 0x302e3028, 0x31202c66, 0x2c66302e, 
-    0x6f642d20, 0x656e6e77, 0x2f207373, 0x726f6820, 0x72756c42, 0x0a0d3b29, 0x20202020, 0x756f2020, 0x6c6f4374, 
-    0x2020726f, 0x203d2020, 0x7072656c, 0x74756f28, 0x6f6c6f43, 0x64202c72, 0x436e776f, 0x726f6c6f, 0x6e64202c, 
-    0x29737365, 0x200a0d3b, 0x20202020, 0x67696e20, 0x61467468, 0x726f7463, 0x31203d20, 0x2066302e, 0x6e64202d, 
-    0x3b737365, 0x20200a0d, 0x0d7d2020, 0x2020200a, 0x736c6520, 0x200a0d65, 0x7b202020, 0x20200a0d, 0x20202020, 
-    0x4374756f, 0x726f6c6f, 0x20202020, 0x6f64203d, 0x6f436e77, 0x3b726f6c, 0x20200a0d, 0x20202020, 0x6867696e, 
-    0x63614674, 0x20726f74, 0x2e30203d, 0x0d3b6630, 0x2020200a, 0x0a0d7d20, 0x0d7d2020, 0x200a0d0a, 0x202f2f20, 
-    0x756a6441, 0x6e697473, 0x68742067, 0x6f632065, 0x20726f6c, 0x65736162, 0x6e6f2064, 0x65687420, 0x74617320, 
-    0x74617275, 0x206e6f69, 0x20646e61, 0x2d646572, 0x65756c62, 0x69687320, 0x0a0d7466, 0x756f2020, 0x6c6f4374, 
-    0x3d20726f, 0x65777420, 0x6f436b61, 0x28726f6c, 0x4374756f, 0x726f6c6f, 0x6f6c202c, 0x536c6163, 0x72757461, 
-    0x6f697461, 0x73202c6e, 0x65722e73, 0x756c6264, 0x69687365, 0x3b297466, 0x20200a0d, 0x75736572, 0x2020746c, 
-    0x6f203d20, 0x6f437475, 0x20726f6c, 0x5f4d202a, 0x0d3b4950, 0x200a0d0a, 0x202f2f20, 0x69646441, 0x7420676e, 
-    0x6e206568, 0x74686769, 0x796b7320, 0x6c6f6320, 0x0a0d726f, 0x66692020, 0x67696e28, 0x61467468, 0x726f7463, 
-    0x30203e20, 0x2966302e, 0x20200a0d, 0x200a0d7b, 0x66202020, 0x74616f6c, 0x696e2033, 0x20746867, 0x7373203d, 
-    0x67696e2e, 0x6f437468, 0x20726f6c, 0x696e202a, 0x46746867, 0x6f746361, 0x0a0d3b72, 0x20202020, 0x75736572, 
-    0x2020746c, 0x20202020, 0x6d203d20, 0x72287861, 0x6c757365, 0x6e202c74, 0x74686769, 0x0a0d3b29, 0x0d7d2020, 
-    0x200a0d0a, 0x74657220, 0x206e7275, 0x75736572, 0x0d3b746c, 0x0a0d7d0a, 0x2f2f0a0d, 0x696e5520, 0x6d726f66, 
-    0x7320796c, 0x6c706d61, 0x61207365, 0x68707320, 0x63697265, 0x63206c61, 0x203a7061, 0x20656874, 0x74726170, 
-    0x20666f20, 0x20656874, 0x66727573, 0x20656361, 0x6120666f, 0x68707320, 0x0d657265, 0x202f2f0a, 0x72656877, 
-    0x207a2065, 0x676e6172, 0x66207365, 0x206d6f72, 0x696d5f7a, 0x6f74206e, 0x202e3120, 0x72206649, 0x6f646e61, 
-    0x6d61536d, 0x2e656c70, 0x73692079, 0x6d617320, 0x64656c70, 0x206e6920, 0x20656874, 0x736f6c63, 0x0a0d6465, 
-    0x69202f2f, 0x7265746e, 0x206c6176, 0x312c305b, 0x74202c5d, 0x20736968, 0x706d6173, 0x2073656c, 0x6e69207a, 
-    0x5f7a5b20, 0x2c6e696d, 0x205d3120, 0x20646e61, 0x6c632061, 0x6465736f, 0x70616320, 0x6c697720, 0x6562206c, 
-    0x6d617320, 0x64656c70, 0x2f0a0d3b, 0x6669202f, 0x6e617220, 0x536d6f64, 0x6c706d61, 0x20792e65, 0x73207369, 
-    0x6c706d61, 0x69206465, 0x6874206e, 0x61682065, 0x6f2d666c, 0x206e6570, 0x65746e69, 0x6c617672, 0x2c305b20, 
-    0x202c2931, 0x6e656874, 0x69207a20, 0x6e692073, 0x2f2f0a0d, 0x5f7a2820, 0x2c6e696d, 0x205d3120, 0x20646e61, 
-    0x6f206e61, 0x206e6570, 0x20706163, 0x6c6c6977, 0x20656220, 0x706d6173, 0x2e64656c, 0x6e690a0d, 0x656e696c, 
-    0x6f6c6620, 0x20337461, 0x706d6173, 0x7053656c, 0x69726568, 0x436c6163, 0x66287061, 0x74616f6c, 0x6d5f7a20, 
-    0x202c6e69, 0x616f6c66, 0x78203274, 0x0a0d2969, 0x200a0d7b, 0x6f6c6620, 0x7a207461, 0x3d202020, 0x72656c20, 
-    0x2e312870, 0x7a202c46, 0x6e696d5f, 0x6978202c, 0x3b29792e, 0x20200a0d, 0x616f6c66, 0x20722074, 0x203d2020, 
-    0x74727173, 0x78616d28, 0x462e3028, 0x2e31202c, 0x202d2046, 0x202a207a, 0x3b29297a, 0x20200a0d, 0x616f6c66, 
-    0x68702074, 0x203d2069, 0x66302e32, 0x4d202a20, 0x2049505f, 0x6978202a, 0x0d3b782e, 0x6620200a, 0x74616f6c, 
-    0x20207820, 0x72203d20, 0x63202a20, 0x7028736f, 0x3b296968, 0x20200a0d, 0x616f6c66, 0x20792074, 0x203d2020, 
-    0x202a2072, 0x286e6973, 0x29696870, 0x200a0d3b, 0x74657220, 0x206e7275, 0x616f6c66, 0x78283374, 0x2c79202c, 
-    0x3b297a20, 0x0d7d0a0d, 0x2f0a0d0a, 0x7250202f, 0x6261626f, 0x74696c69, 0x68742079, 0x73207461, 0x6c706d61, 
-    0x79685065, 0x61636973, 0x796b536c, 0x6d617320, 0x73656c70, 0x65687420, 0x6e757320, 0x2f0a0d2e, 0x6649202f, 
-    0x65687420, 0x6e757320, 0x20736920, 0x206f6f74, 0x6c616d73, 0x77202c6c, 0x656e2065, 0x20726576, 0x706d6173, 
-    0x6920656c, 0x0a0d2e74, 0x696c6e69, 0x6620656e, 0x74616f6c, 0x79687020, 0x61636973, 0x796b536c, 0x506e7553, 
-    0x61626f72, 0x696c6962, 0x53287974, 0x6850796b, 0x63697379, 0x61506c61, 0x656d6172, 0x73726574, 0x29737320, 
-    0x0d7b0a0d, 0x6620200a, 0x74616f6c, 0x6e757320, 0x76656c45, 0x6f697461, 0x203d206e, 0x732e7373, 0x69446e75, 
-    0x74636572, 0x2e6e6f69, 0x0a0d3b7a, 0x65722020, 0x6e727574, 0x73732820, 0x6e75732e, 0x6b736944, 0x6c616353, 
-    0x203e2065, 0x352d6531, 0x3f202966, 0x616c6320, 0x7328706d, 0x75732e73, 0x7369446e, 0x746e496b, 0x69736e65, 
-    0x2a207974, 0x6e757320, 0x76656c45, 0x6f697461, 0x202a206e, 0x66352e30, 0x30202b20, 0x2c66352e, 0x312e3020, 
-    0x30202c66, 0x2966392e, 0x30203a20, 0x3b66302e, 0x0d7d0a0d, 0x2f0a0d0a, 0x2d2d2d2a, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d2d2d, 0x75462023, 0x6974636e, 0x60206e6f, 0x706d6173, 0x6850656c, 
-    0x63697379, 0x6b536c61, 0x46445079, 0x3e0a0d60, 0x74655220, 0x736e7275, 0x65687420, 0x6f727020, 0x69626162, 
-    0x7974696c, 0x61687420, 0x73602074, 0x6c706d61, 0x79685065, 0x61636973, 0x796b536c, 0x61732060, 0x656c706d, 
-    0x20612073, 0x74726563, 0x206e6961, 0x65726964, 0x6f697463, 0x0a0d2e6e, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0d2f2a2d, 0x6c6e690a, 0x20656e69, 0x616f6c66, 0x61732074, 0x656c706d, 
-    0x73796850, 0x6c616369, 0x50796b53, 0x53284644, 0x6850796b, 0x63697379, 0x61506c61, 0x656d6172, 0x73726574, 
-    0x2c737320, 0x6f6c6620, 0x20337461, 0x69446e69, 0x74636572, 0x296e6f69, 0x0d7b0a0d, 0x6320200a, 0x74736e6f, 
-    0x6f6c6620, 0x73207461, 0x6e416e75, 0x616c7567, 0x64615272, 0x20737569, 0x2e30203d, 0x36343030, 0x2a206635, 
-    0x2e737320, 0x446e7573, 0x536b7369, 0x656c6163, 0x200a0d3b, 0x202f2f20, 0x77206649, 0x68632065, 0x65736f6f, 
-    0x65687420, 0x796b7320, 0x6874202c, 0x69207369, 0x68742073, 0x72702065, 0x6261626f, 0x74696c69, 0x666f2079, 
-    0x6f686320, 0x6e69736f, 0x20612067, 0x65766967, 0x6964206e, 0x74636572, 0x3a6e6f69, 0x20200a0d, 0x736e6f63, 
-    0x6c662074, 0x2074616f, 0x50796b73, 0x3d206664, 0x302e3120, 0x202f2066, 0x302e3228, 0x202a2066, 0x49505f4d, 
-    0x0a0d3b29, 0x2f2f2020, 0x69685420, 0x61662073, 0x726f7463, 0x20666f20, 0x66352e31, 0x20736920, 0x61636562, 
-    0x20657375, 0x7420666f, 0x6c206568, 0x7265776f, 0x756f6220, 0x6f20646e, 0x6874206e, 0x75732065, 0x0d73276e, 
-    0x2f20200a, 0x6d73202f, 0x68746f6f, 0x70657473, 0x65687720, 0x6f63206e, 0x7475706d, 0x20676e69, 0x73696460, 
-    0x6361466b, 0x60726f74, 0x206e6920, 0x61766560, 0x7968506c, 0x61636973, 0x796b536c, 0x0a0d2e60, 0x6f632020, 
-    0x2074736e, 0x616f6c66, 0x75732074, 0x6d61536e, 0x41656c70, 0x6c75676e, 0x61527261, 0x73756964, 0x20202020, 
-    0x2e31203d, 0x2a206635, 0x6e757320, 0x75676e41, 0x5272616c, 0x75696461, 0x0a0d3b73, 0x6f632020, 0x2074736e, 
-    0x616f6c66, 0x6f632074, 0x6e755373, 0x706d6153, 0x6e41656c, 0x616c7567, 0x64615272, 0x20737569, 0x6f63203d, 
-    0x75732873, 0x6d61536e, 0x41656c70, 0x6c75676e, 0x61527261, 0x73756964, 0x0a0d3b29, 0x20200a0d, 0x55202f2f, 
-    0x66206573, 0x74737269, 0x6765642d, 0x20656572, 0x6c796154, 0x7320726f, 0x65697265, 0x78652073, 0x736e6170, 
-    0x206e6f69, 0x756f7261, 0x3020646e, 0x726f6620, 0x74656220, 0x20726574, 0x63657270, 0x6f697369, 0x200a0d6e, 
-    0x6e6f6320, 0x66207473, 0x74616f6c, 0x6e757320, 0x706d6153, 0x6f53656c, 0x4164696c, 0x656c676e, 0x28203d20, 
-    0x536e7573, 0x6c706d61, 0x676e4165, 0x72616c75, 0x69646152, 0x3c207375, 0x302e3020, 0x29663130, 0x4d203f20, 
-    0x2049505f, 0x7573202a, 0x6d61536e, 0x41656c70, 0x6c75676e, 0x61527261, 0x73756964, 0x73202a20, 0x61536e75, 
-    0x656c706d, 0x75676e41, 0x5272616c, 0x75696461, 0x0d3a2073, 0x2020200a, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x302e3220, 0x202a2066, 0x49505f4d, 0x28202a20, 
-    0x66302e31, 0x63202d20, 0x7553736f, 0x6d61536e, 0x41656c70, 0x6c75676e, 0x61527261, 0x73756964, 0x0a0d3b29, 
-    0x2f2f2020, 0x20664920, 0x63206577, 0x736f6f68, 0x68742065, 0x75732065, 0x74202c6e, 0x20736968, 0x74207369, 
-    0x70206568, 0x61626f72, 0x696c6962, 0x6f207974, 0x68632066, 0x69736f6f, 0x6120676e, 0x76696720, 0x64206e65, 
-    0x63657269, 0x6e6f6974, 0x200a0d3a, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x6e757320, 0x20666450, 0x6428203d, 
-    0x6928746f, 0x7269446e, 0x69746365, 0x202c6e6f, 0x732e7373, 0x69446e75, 0x74636572, 0x296e6f69, 0x203d3e20, 
-    0x53736f63, 0x61536e75, 0x656c706d, 0x75676e41, 0x5272616c, 0x75696461, 0x3f202973, 0x302e3120, 0x202f2066, 
-    0x536e7573, 0x6c706d61, 0x6c6f5365, 0x6e416469, 0x20656c67, 0x2e30203a, 0x0d3b6630, 0x7220200a, 0x72757465, 
-    0x656c206e, 0x73287072, 0x6450796b, 0x73202c66, 0x64506e75, 0x70202c66, 0x69737968, 0x536c6163, 0x7553796b, 
-    0x6f72506e, 0x69626162, 0x7974696c, 0x29737328, 0x0a0d3b29, 0x0d0a0d7d, 0x2d2a2f0a, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x20230a0d, 0x636e7546, 0x6e6f6974, 0x61736020, 0x656c706d, 
-    0x73796850, 0x6c616369, 0x60796b53, 0x203e0a0d, 0x706d6153, 0x2073656c, 0x20656874, 0x73796870, 0x6c616369, 
-    0x796b7320, 0x646f6d20, 0x75206c65, 0x676e6973, 0x6f777420, 0x6e617220, 0x206d6f64, 0x756c6176, 0x202c7365, 
-    0x75746572, 0x6e696e72, 0x20612067, 0x796b5360, 0x706d6153, 0x676e696c, 0x75736552, 0x2e60746c, 0x2d2d0a0d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2a2d2d2d, 0x690a0d2f, 0x6e696c6e, 0x6b532065, 
-    0x6d615379, 0x6e696c70, 0x73655267, 0x20746c75, 0x706d6173, 0x6850656c, 0x63697379, 0x6b536c61, 0x6b532879, 
-    0x79685079, 0x61636973, 0x7261506c, 0x74656d61, 0x20737265, 0x202c7373, 0x616f6c66, 0x72203274, 0x6f646e61, 
-    0x6d61536d, 0x29656c70, 0x0d7b0a0d, 0x5320200a, 0x6153796b, 0x696c706d, 0x6552676e, 0x746c7573, 0x73657220, 
-    0x3b746c75, 0x0a0d0a0d, 0x2f2f2020, 0x63654420, 0x20656469, 0x74656877, 0x20726568, 0x73206f74, 0x6c706d61, 
-    0x75732065, 0x726f206e, 0x796b7320, 0x20200a0d, 0x616f6c66, 0x75732074, 0x6f72506e, 0x20202062, 0x6870203d, 
-    0x63697379, 0x6b536c61, 0x6e755379, 0x626f7250, 0x6c696261, 0x28797469, 0x3b297373, 0x20200a0d, 0x616f6c66, 
-    0x5f7a2074, 0x206e696d, 0x20202020, 0x2e30203d, 0x203b6630, 0x202f2f20, 0x696e694d, 0x206d756d, 0x61762d7a, 
-    0x2065756c, 0x7420666f, 0x73206568, 0x72656870, 0x6c616369, 0x70616320, 0x27657720, 0x73206c6c, 0x6c706d61, 
-    0x200a0d65, 0x6f6f6220, 0x7320206c, 0x6c706d61, 0x6e755365, 0x72203d20, 0x6f646e61, 0x6d61536d, 0x2e656c70, 
-    0x203c2078, 0x506e7573, 0x3b626f72, 0x20200a0d, 0x73286669, 0x6c706d61, 0x6e755365, 0x200a0d29, 0x0a0d7b20, 
-    0x20202020, 0x41202f2f, 0x73756a64, 0x68742074, 0x61722065, 0x2065676e, 0x7420666f, 0x72206568, 0x6f646e61, 
-    0x6176206d, 0x2065756c, 0x77206f73, 0x61632065, 0x7375206e, 0x74692065, 0x61676120, 0x0d3a6e69, 0x2020200a, 
-    0x6e617220, 0x536d6f64, 0x6c706d61, 0x20782e65, 0x6172203d, 0x6d6f646e, 0x706d6153, 0x782e656c, 0x73202f20, 
-    0x72506e75, 0x0d3b626f, 0x2020200a, 0x202f2f20, 0x706d6153, 0x7420656c, 0x73206568, 0x62206e75, 0x6f642079, 
-    0x20676e69, 0x66696e75, 0x206d726f, 0x65687073, 0x61636972, 0x6163206c, 0x61732070, 0x696c706d, 0x6120676e, 
-    0x6e756f72, 0x68742064, 0x7a2b2065, 0x20200a0d, 0x2f2f2020, 0x69786120, 0x74202c73, 0x206e6568, 0x61746f72, 
-    0x676e6974, 0x65687420, 0x207a2b20, 0x73697861, 0x206f7320, 0x74616874, 0x20746920, 0x6e696f70, 0x74207374, 
-    0x7261776f, 0x74207364, 0x73206568, 0x0d2e6e75, 0x2020200a, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x6e757320, 
-    0x706d6153, 0x6e41656c, 0x616c7567, 0x64615272, 0x20737569, 0x2e31203d, 0x2a206635, 0x302e3020, 0x35363430, 
-    0x202a2066, 0x732e7373, 0x69446e75, 0x63536b73, 0x3b656c61, 0x20200a0d, 0x5f7a2020, 0x206e696d, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x63203d20, 0x7328736f, 0x61536e75, 
-    0x656c706d, 0x75676e41, 0x5272616c, 0x75696461, 0x0d3b2973, 0x7d20200a, 0x20200a0d, 0x65736c65, 0x20200a0d, 
-    0x200a0d7b, 0x2f202020, 0x6441202f, 0x7473756a, 0x65687420, 0x6e617220, 0x6f206567, 0x68742066, 0x61722065, 
-    0x6d6f646e, 0x6c617620, 0x73206575, 0x6577206f, 0x6e616320, 0x65737520, 0x20746920, 0x69616761, 0x0a0d3a6e, 
-    0x20202020, 0x646e6172, 0x61536d6f, 0x656c706d, 0x3d20782e, 0x61722820, 0x6d6f646e, 0x706d6153, 0x782e656c, 
-    0x73202d20, 0x72506e75, 0x2029626f, 0x3128202f, 0x2066302e, 0x7573202d, 0x6f72506e, 0x0d3b2962, 0x7d20200a, 
-    0x0a0d0a0d, 0x65722020, 0x746c7573, 0x7269642e, 0x69746365, 0x3d206e6f, 0x6d617320, 0x53656c70, 0x72656870, 
-    0x6c616369, 0x28706143, 0x696d5f7a, 0x72202c6e, 0x6f646e61, 0x6d61536d, 0x29656c70, 0x0d0a0d3b, 0x6920200a, 
-    0x61732866, 0x656c706d, 0x296e7553, 0x20200a0d, 0x200a0d7b, 0x2f202020, 0x7254202f, 0x66736e61, 0x206d726f, 
-    0x20656874, 0x206e7573, 0x6d6f7266, 0x207a2b20, 0x73206f74, 0x75732e73, 0x7269446e, 0x69746365, 0x0a0d6e6f, 
-    0x20202020, 0x616f6c66, 0x75203374, 0x20202070, 0x66203d20, 0x74616f6c, 0x2c302833, 0x202c3020, 0x0d3b2931, 
-    0x2020200a, 0x6f6c6620, 0x20337461, 0x68676972, 0x203d2074, 0x6d726f6e, 0x7a696c61, 0x72632865, 0x2873736f, 
-    0x202c7075, 0x732e7373, 0x69446e75, 0x74636572, 0x296e6f69, 0x0a0d3b29, 0x20202020, 0x20207075, 0x20202020, 
-    0x20202020, 0x63203d20, 0x73736f72, 0x2e737328, 0x446e7573, 0x63657269, 0x6e6f6974, 0x6972202c, 0x29746867, 
-    0x0d0a0d3b, 0x2020200a, 0x73657220, 0x2e746c75, 0x65726964, 0x6f697463, 0x203d206e, 0x75736572, 0x642e746c, 
-    0x63657269, 0x6e6f6974, 0x2a20782e, 0x67697220, 0x20207468, 0x0a0d2f2f, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x2b202020, 0x73657220, 0x2e746c75, 0x65726964, 0x6f697463, 0x20792e6e, 0x7075202a, 
-    0x2f202020, 0x200a0d2f, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x202b2020, 0x75736572, 
-    0x642e746c, 0x63657269, 0x6e6f6974, 0x2a207a2e, 0x2e737320, 0x446e7573, 0x63657269, 0x6e6f6974, 0x200a0d3b, 
-    0x0a0d7d20, 0x20200a0d, 0x45202f2f, 0x756c6176, 0x20657461, 0x20656874, 0x20796b73, 0x65646f6d, 0x200a0d6c, 
-    0x73657220, 0x2e746c75, 0x69646172, 0x65636e61, 0x65203d20, 0x506c6176, 0x69737968, 0x536c6163, 0x7328796b, 
-    0x72202c73, 0x6c757365, 0x69642e74, 0x74636572, 0x296e6f69, 0x200a0d3b, 0x73657220, 0x2e746c75, 0x20666470, 
-    0x20202020, 0x73203d20, 0x6c706d61, 0x79685065, 0x61636973, 0x796b536c, 0x28464450, 0x202c7373, 0x75736572, 
-    0x642e746c, 0x63657269, 0x6e6f6974, 0x0a0d3b29, 0x65722020, 0x6e727574, 0x73657220, 0x3b746c75, 0x0d7d0a0d, 
-    0x0d0a0d0a, 0x6e65230a, 0x20666964, 0x202f2f20, 0x5f594b53, 0x434e5546, 0x4e4f4954, 0x0d485f53, 0x0000000a, 
-    0x00120007, 0x00000013, 0x575c3a46, 0x6f646e69, 0x445c7377, 0x746b7365, 0x6e5c706f, 0x6f727076, 0x726f635f, 
-    0x6e5c3265, 0x61687376, 0x73726564, 0x796b735c, 0x6e75665f, 0x6f697463, 0x682e736e, 0x616c732e, 0x0000676e, 
-    0x2bb40007, 0x00000014, 0x0a0d2a2f, 0x43202a20, 0x7279706f, 0x74686769, 0x29632820, 0x31303220, 0x30322d39, 
-    0x202c3532, 0x4449564e, 0x43204149, 0x4f50524f, 0x49544152, 0x202e4e4f, 0x6c6c4120, 0x67697220, 0x20737468, 
-    0x65736572, 0x64657672, 0x200a0d2e, 0x200a0d2a, 0x694c202a, 0x736e6563, 0x75206465, 0x7265646e, 0x65687420, 
-    0x61704120, 0x20656863, 0x6563694c, 0x2c65736e, 0x72655620, 0x6e6f6973, 0x302e3220, 0x68742820, 0x4c222065, 
-    0x6e656369, 0x29226573, 0x200a0d3b, 0x6f79202a, 0x616d2075, 0x6f6e2079, 0x73752074, 0x68742065, 0x66207369, 
-    0x20656c69, 0x65637865, 0x69207470, 0x6f63206e, 0x696c706d, 0x65636e61, 0x74697720, 0x68742068, 0x694c2065, 
-    0x736e6563, 0x0a0d2e65, 0x59202a20, 0x6d20756f, 0x6f207961, 0x69617462, 0x2061206e, 0x79706f63, 0x20666f20, 
-    0x20656874, 0x6563694c, 0x2065736e, 0x0a0d7461, 0x0a0d2a20, 0x20202a20, 0x68202020, 0x3a707474, 0x77772f2f, 
-    0x70612e77, 0x65686361, 0x67726f2e, 0x63696c2f, 0x65736e65, 0x494c2f73, 0x534e4543, 0x2e322d45, 0x200a0d30, 
-    0x200a0d2a, 0x6e55202a, 0x7373656c, 0x71657220, 0x65726975, 0x79622064, 0x70706120, 0x6163696c, 0x20656c62, 
-    0x2077616c, 0x6120726f, 0x65657267, 0x6f742064, 0x206e6920, 0x74697277, 0x2c676e69, 0x666f7320, 0x72617774, 
-    0x200a0d65, 0x6964202a, 0x69727473, 0x65747562, 0x6e752064, 0x20726564, 0x20656874, 0x6563694c, 0x2065736e, 
-    0x64207369, 0x72747369, 0x74756269, 0x6f206465, 0x6e61206e, 0x53412220, 0x22534920, 0x53414220, 0x0d2c5349, 
-    0x202a200a, 0x48544957, 0x2054554f, 0x52524157, 0x49544e41, 0x4f205345, 0x4f432052, 0x5449444e, 0x534e4f49, 
-    0x20464f20, 0x20594e41, 0x444e494b, 0x6965202c, 0x72656874, 0x70786520, 0x73736572, 0x20726f20, 0x6c706d69, 
-    0x2e646569, 0x2a200a0d, 0x65655320, 0x65687420, 0x63694c20, 0x65736e65, 0x726f6620, 0x65687420, 0x65707320, 
-    0x69666963, 0x616c2063, 0x6175676e, 0x67206567, 0x7265766f, 0x676e696e, 0x72657020, 0x7373696d, 0x736e6f69, 
-    0x646e6120, 0x2a200a0d, 0x6d696c20, 0x74617469, 0x736e6f69, 0x646e7520, 0x74207265, 0x4c206568, 0x6e656369, 
-    0x0d2e6573, 0x0d2a200a, 0x202a200a, 0x58445053, 0x6c69462d, 0x706f4365, 0x67697279, 0x65547468, 0x203a7478, 
-    0x79706f43, 0x68676972, 0x63282074, 0x30322029, 0x322d3931, 0x2c353230, 0x49564e20, 0x20414944, 0x50524f43, 
-    0x5441524f, 0x2e4e4f49, 0x2a200a0d, 0x44505320, 0x694c2d58, 0x736e6563, 0x64492d65, 0x69746e65, 0x72656966, 
-    0x7041203a, 0x65686361, 0x302e322d, 0x2a200a0d, 0x0d0a0d2f, 0x6669230a, 0x6665646e, 0x56564e20, 0x5f4c484b, 
-    0x46445342, 0x4e55465f, 0x4f495443, 0x485f534e, 0x64230a0d, 0x6e696665, 0x564e2065, 0x4c484b56, 0x4453425f, 
-    0x55465f46, 0x4954434e, 0x5f534e4f, 0x0d312048, 0x2f0a0d0a, 0x2d2d2d2a, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d2d2d, 0x6d49203e, 0x6d656c70, 0x73746e65, 0x64696220, 0x63657269, 0x6e6f6974, 
-    0x73206c61, 0x74746163, 0x6e697265, 0x69642067, 0x69727473, 0x69747562, 0x66206e6f, 0x74636e75, 0x736e6f69, 
-    0x53422820, 0x29734644, 0x726f6620, 0x203e0a0d, 0x73796870, 0x6c616369, 0x622d796c, 0x64657361, 0x6e657220, 
-    0x69726564, 0x7320676e, 0x65747379, 0x0d2e736d, 0x540a0d0a, 0x7375206f, 0x68742065, 0x63207369, 0x2c65646f, 
-    0x636e6920, 0x6564756c, 0x73626020, 0x665f6664, 0x74636e75, 0x736e6f69, 0x2e60682e, 0x65685720, 0x2061206e, 
-    0x20796172, 0x73746968, 0x73206120, 0x61667275, 0x0d3a6563, 0x43202a0a, 0x74616572, 0x20612065, 0x72625060, 
-    0x6574614d, 0x6c616972, 0x65642060, 0x69726373, 0x676e6962, 0x65687420, 0x74616d20, 0x61697265, 0x7461206c, 
-    0x61687420, 0x6f702074, 0x0d746e69, 0x43202a0a, 0x206c6c61, 0x64736260, 0x61764566, 0x7461756c, 0x60292865, 
-    0x206f7420, 0x6c617665, 0x65746175, 0x65687420, 0x61637320, 0x72657474, 0x20676e69, 0x6d6f7266, 0x656e6f20, 
-    0x72696420, 0x69746365, 0x74206e6f, 0x200a0d6f, 0x6f6e6120, 0x72656874, 0x726f202c, 0x73626020, 0x61536664, 
-    0x656c706d, 0x20602928, 0x63206f74, 0x736f6f68, 0x68742065, 0x656e2065, 0x72207478, 0x69207961, 0x6874206e, 
-    0x696c2065, 0x20746867, 0x68746170, 0x200a0d2e, 0x65655320, 0x65687420, 0x66206573, 0x74636e75, 0x736e6f69, 
-    0x6f642027, 0x656d7563, 0x7461746e, 0x206e6f69, 0x20726f66, 0x65726f6d, 0x666e6920, 0x616d726f, 0x6e6f6974, 
-    0x206e6f20, 0x69656874, 0x61702072, 0x656d6172, 0x73726574, 0x20200a0d, 0x20646e61, 0x75746572, 0x76206e72, 
-    0x65756c61, 0x0a0d2e73, 0x65530a0d, 0x68742065, 0x6b762065, 0x746c675f, 0x65725f66, 0x7265646e, 0x61207265, 
-    0x7620646e, 0x696d5f6b, 0x735f696e, 0x6c706d61, 0x672f7365, 0x5f66746c, 0x74796172, 0x65636172, 0x6d617320, 
-    0x73656c70, 0x726f6620, 0x61786520, 0x656c706d, 0x770a0d73, 0x65726568, 0x65687420, 0x66206573, 0x74636e75, 
-    0x736e6f69, 0x65726120, 0x65737520, 0x6e692064, 0x4d206120, 0x65746e6f, 0x72614320, 0x70206f6c, 0x20687461, 
-    0x63617274, 0x0d2e7265, 0x540a0d0a, 0x72206568, 0x72757465, 0x2064656e, 0x46445342, 0x6c617620, 0x20736575, 
-    0x20646e61, 0x67696577, 0x20737468, 0x65766168, 0x65687420, 0x736f6320, 0x20656e69, 0x6d726574, 0x6f726620, 
-    0x6874206d, 0x65722065, 0x7265646e, 0x0d676e69, 0x7571650a, 0x6f697461, 0x6e69206e, 0x64756c63, 0x203b6465, 
-    0x2e672e65, 0x65687420, 0x6d614c20, 0x74726562, 0x626f6c20, 0x65722065, 0x6e727574, 0x6d602073, 0x30287861, 
-    0x2c66302e, 0x736f6320, 0x202c4e28, 0x2929316b, 0x70202f20, 0x0d2e6069, 0x410a0d0a, 0x6e617664, 0x20646563, 
-    0x72657375, 0x61632073, 0x7375206e, 0x6f732065, 0x6f20656d, 0x68742066, 0x746f2065, 0x20726568, 0x636e7566, 
-    0x6e6f6974, 0x6e692073, 0x69687420, 0x69662073, 0x7420656c, 0x7665206f, 0x61756c61, 0x0a0d6574, 0x20646e61, 
-    0x706d6173, 0x6920656c, 0x7669646e, 0x61756469, 0x6f6c206c, 0x2c736562, 0x20726f20, 0x73627573, 0x20737465, 
-    0x6c20666f, 0x7365626f, 0x0d0a0d2e, 0x6968540a, 0x69662073, 0x6120656c, 0x206f736c, 0x766f7270, 0x73656469, 
-    0x73626020, 0x76456664, 0x61756c61, 0x69536574, 0x656c706d, 0x20602928, 0x20646e61, 0x64736260, 0x6d615366, 
-    0x53656c70, 0x6c706d69, 0x60292865, 0x6877202c, 0x0d686369, 0x706d690a, 0x656d656c, 0x6120746e, 0x6d697320, 
-    0x72656c70, 0x646e6120, 0x73616620, 0x2c726574, 0x6f687420, 0x20686775, 0x7373656c, 0x6c756620, 0x662d796c, 
-    0x75746165, 0x20646572, 0x46445342, 0x646f6d20, 0x202e6c65, 0x0d656854, 0x6d69730a, 0x20656c70, 0x65646f6d, 
-    0x6e6f206c, 0x6820796c, 0x64207361, 0x75666669, 0x202c6573, 0x63657073, 0x72616c75, 0x6e61202c, 0x656d2064, 
-    0x6c6c6174, 0x6c206369, 0x7365626f, 0x6877202c, 0x20656c69, 0x20656874, 0x6c6c7566, 0x6f6d0a0d, 0x206c6564, 
-    0x6c636e69, 0x73656475, 0x66696420, 0x65737566, 0x7274202c, 0x6d736e61, 0x69737369, 0x202c6e6f, 0x63657073, 
-    0x72616c75, 0x656d202c, 0x2c6c6174, 0x65687320, 0x202c6e65, 0x20646e61, 0x61656c63, 0x616f6372, 0x6c0a0d74, 
-    0x7365626f, 0x6c702820, 0x73207375, 0x6f707075, 0x66207472, 0x6d20726f, 0x2074736f, 0x46546c67, 0x74786520, 
-    0x69736e65, 0x29736e6f, 0x0d0a0d2e, 0x6e69530a, 0x47206563, 0x204c534c, 0x73656f64, 0x2074276e, 0x65766168, 
-    0x64206120, 0x69747369, 0x6974636e, 0x62206e6f, 0x65777465, 0x70206e65, 0x696c6275, 0x6e612063, 0x72702064, 
-    0x74617669, 0x75662065, 0x6974636e, 0x2c736e6f, 0x6e6f0a0d, 0x6620796c, 0x74636e75, 0x736e6f69, 0x61687420, 
-    0x72612074, 0x61702065, 0x6f207472, 0x68742066, 0x70222065, 0x696c6275, 0x50412063, 0x77202249, 0x206c6c69, 
-    0x65766168, 0x6e6e6120, 0x7461746f, 0x736e6f69, 0x0d6f7420, 0x7070610a, 0x20726165, 0x52206e69, 0x4d444145, 
-    0x646d2e45, 0x0d0a0d2e, 0x6968540a, 0x69662073, 0x2820656c, 0x20646e61, 0x656c6966, 0x68742073, 0x69207461, 
-    0x65642074, 0x646e6570, 0x6e6f2073, 0x68732029, 0x646c756f, 0x20656220, 0x4c472061, 0x432f4c53, 0x70202b2b, 
-    0x67796c6f, 0x2c746f6c, 0x646e6120, 0x6f770a0d, 0x73206b72, 0x6f6c206f, 0x6120676e, 0x4c472073, 0x6168204d, 
-    0x65622073, 0x69206e65, 0x756c636e, 0x3a646564, 0x0a0d0a0d, 0x63606060, 0x0a0d7070, 0x646e7523, 0x47206665, 
-    0x465f4d4c, 0x4543524f, 0x5a59585f, 0x4e4f5f57, 0x0a0d594c, 0x66656423, 0x20656e69, 0x5f4d4c47, 0x43524f46, 
-    0x57535f45, 0x4c5a5a49, 0x230a0d45, 0x6c636e69, 0x20656475, 0x6d6c673c, 0x6d6c672f, 0x7070682e, 0x750a0d3e, 
-    0x676e6973, 0x6d616e20, 0x61707365, 0x67206563, 0x0d3b6d6c, 0x230a0d0a, 0x6c636e69, 0x20656475, 0x73766e3c, 
-    0x65646168, 0x622f7372, 0x5f666473, 0x636e7566, 0x6e6f6974, 0x3e682e73, 0x60600a0d, 0x0d0a0d60, 0x2023230a, 
-    0x68636554, 0x6163696e, 0x6f4e206c, 0x0d736574, 0x4e0a0d0a, 0x274b5656, 0x53422073, 0x20734644, 0x20657261, 
-    0x65736162, 0x6e6f2064, 0x68745b20, 0x6c672065, 0x32204654, 0x7320302e, 0x69636570, 0x61636966, 0x6e6f6974, 
-    0x7468285d, 0x3a737074, 0x69672f2f, 0x62756874, 0x6d6f632e, 0x72684b2f, 0x736f6e6f, 0x756f7247, 0x6c672f70, 
-    0x20294654, 0x0d646e61, 0x68745b0a, 0x564e2065, 0x41494449, 0x4c444d20, 0x4b445320, 0x42207327, 0x20464453, 
-    0x6c706d69, 0x6e656d65, 0x69746174, 0x5d736e6f, 0x74746828, 0x2f3a7370, 0x7469672f, 0x2e627568, 0x2f6d6f63, 
-    0x4449564e, 0x4d2f4149, 0x532d4c44, 0x622f4b44, 0x2f626f6c, 0x64333032, 0x30343135, 0x65643162, 0x64393865, 
-    0x62373165, 0x38653632, 0x34633832, 0x35333333, 0x37383137, 0x39323638, 0x6372732f, 0x6c646d2f, 0x74696a2f, 
-    0x62696c2f, 0x66647362, 0x62696c2f, 0x66647362, 0x7070632e, 0x0d202e29, 0x540a0d0a, 0x6c206568, 0x65677261, 
-    0x64207473, 0x72657669, 0x636e6567, 0x72662065, 0x74206d6f, 0x61206568, 0x65766f62, 0x20736920, 0x74616874, 
-    0x56564e20, 0x2073274b, 0x46445342, 0x646f6d20, 0x75206c65, 0x20736573, 0x460a0d61, 0x6e736572, 0x74206c65, 
-    0x206d7265, 0x74616874, 0x70656420, 0x73646e65, 0x6c6e6f20, 0x6e6f2079, 0x65687420, 0x65697620, 0x6e612077, 
-    0x6f6e2064, 0x6c616d72, 0x63657620, 0x73726f74, 0x6e69202c, 0x61657473, 0x666f2064, 0x65687420, 0x61680a0d, 
-    0x7620666c, 0x6f746365, 0x54202e72, 0x20736968, 0x6f6c6c61, 0x69207377, 0x6f742074, 0x6d6f6320, 0x65747570, 
-    0x69657720, 0x73746867, 0x726f6620, 0x626f6c20, 0x69207365, 0x7065646e, 0x65646e65, 0x796c746e, 0x6877202c, 
-    0x0d656c69, 0x4453420a, 0x6f632046, 0x77206564, 0x646c756f, 0x726f6e20, 0x6c6c616d, 0x656e2079, 0x74206465, 
-    0x6173206f, 0x656c706d, 0x68206120, 0x20666c61, 0x74636576, 0x6620726f, 0x6c20726f, 0x72657961, 0x60696020, 
-    0x0d6f7420, 0x7465640a, 0x696d7265, 0x7420656e, 0x46206568, 0x6e736572, 0x77206c65, 0x68676965, 0x6f662074, 
-    0x616c2072, 0x20726579, 0x312b6960, 0x54202e60, 0x20736968, 0x206e6163, 0x75736572, 0x6920746c, 0x6c73206e, 
-    0x74686769, 0x0a0d796c, 0x66666964, 0x6e657265, 0x6c672074, 0x7973736f, 0x6669642f, 0x65737566, 0x656c6220, 
-    0x7720646e, 0x68676965, 0x28207374, 0x2e672e65, 0x696c7320, 0x6c746867, 0x69642079, 0x72656666, 0x6c746e65, 
-    0x68732079, 0x64657061, 0x69680a0d, 0x696c6867, 0x73746867, 0x206e6f20, 0x7461656c, 0x20726568, 0x66727573, 
-    0x73656361, 0x0a0d2e29, 0x6c410a0d, 0x6f6c206c, 0x20736562, 0x20657261, 0x72656e65, 0x63207967, 0x65736e6f, 
-    0x6e697672, 0x74282067, 0x72696568, 0x746e6920, 0x61726765, 0x766f206c, 0x74207265, 0x73206568, 0x72656870, 
-    0x73692065, 0x20746120, 0x74736f6d, 0x0d293120, 0x646e610a, 0x6f727020, 0x69626162, 0x7974696c, 0x73696420, 
-    0x62697274, 0x6f697475, 0x7566206e, 0x6974636e, 0x20736e6f, 0x46445028, 0x69202973, 0x6765746e, 0x65746172, 
-    0x206f7420, 0x65282031, 0x70656378, 0x6f662074, 0x72612072, 0x0d736165, 0x6568770a, 0x74206572, 0x73206568, 
-    0x6c706d61, 0x64206465, 0x63657269, 0x6e6f6974, 0x73657220, 0x73746c75, 0x206e6920, 0x61206e61, 0x726f7362, 
-    0x6f697470, 0x7665206e, 0x29746e65, 0x0d0a0d2e, 0x6c6c410a, 0x626f6c20, 0x75207365, 0x73206573, 0x6c676e69, 
-    0x63732d65, 0x65747461, 0x676e6972, 0x44534220, 0x202e7346, 0x746c754d, 0x656c7069, 0x6163732d, 0x72657474, 
-    0x20676e69, 0x65626f6c, 0x72612073, 0x0d612065, 0x746f700a, 0x69746e65, 0x66206c61, 0x72757475, 0x6d692065, 
-    0x766f7270, 0x6e656d65, 0x0a0d2e74, 0x6f4d0a0d, 0x6c207473, 0x7365626f, 0x65737520, 0x58474720, 0x726f6e20, 
-    0x206c616d, 0x74736964, 0x75626972, 0x6e6f6974, 0x6e756620, 0x6f697463, 0x2820736e, 0x7346444e, 0x6e612029, 
-    0x68742064, 0x6e752065, 0x72726f63, 0x74616c65, 0x0a0d6465, 0x74696d53, 0x68732068, 0x776f6461, 0x2d676e69, 
-    0x6b73616d, 0x676e7569, 0x6e756620, 0x6f697463, 0x65202c6e, 0x70656378, 0x6f662074, 0x68742072, 0x69642065, 
-    0x73756666, 0x6f6c2065, 0x28206562, 0x626d614c, 0x20747265, 0x46445242, 0x610a0d29, 0x7420646e, 0x73206568, 
-    0x6e656568, 0x626f6c20, 0x5b282065, 0x746e6f43, 0x6e612079, 0x754b2064, 0x27616c6c, 0x43222073, 0x6c726168, 
-    0x20226569, 0x65656873, 0x68285d6e, 0x73707474, 0x622f2f3a, 0x2e676f6c, 0x666c6573, 0x64616873, 0x632e776f, 
-    0x702f6d6f, 0x696c6275, 0x69746163, 0x2f736e6f, 0x31303273, 0x68732d37, 0x6e696461, 0x6f632d67, 0x65737275, 
-    0x6f63232f, 0x65737275, 0x6e6f635f, 0x746e6574, 0x610a0d29, 0x6120646e, 0x632d5620, 0x74697661, 0x68732079, 
-    0x776f6461, 0x2d676e69, 0x6b73616d, 0x20676e69, 0x636e7566, 0x6e6f6974, 0x0a0d2e29, 0x2d2d0a0d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2a2d2d2d, 0x0d0a0d2f, 0x230a0d0a, 0x6c636e69, 0x20656475, 
-    0x6e756622, 0x6f697463, 0x682e736e, 0x616c732e, 0x2022676e, 0x202f2f20, 0x69736f63, 0x6153656e, 0x656c706d, 
-    0x696d6548, 0x65687073, 0x0a0d6572, 0x636e6923, 0x6564756c, 0x62702220, 0x67675f72, 0x696d5f78, 0x666f7263, 
-    0x74656361, 0x732e682e, 0x676e616c, 0x20202022, 0x62202f2f, 0x4c666472, 0x65626d61, 0x61697472, 0x2e202c6e, 
-    0x230a0d2e, 0x6c636e69, 0x20656475, 0x64736222, 0x79745f66, 0x2e736570, 0x6c732e68, 0x22676e61, 0x69230a0d, 
-    0x756c636e, 0x22206564, 0x5f726270, 0x6574616d, 0x6c616972, 0x7079745f, 0x682e7365, 0x616c732e, 0x0d22676e, 
-    0x230a0d0a, 0x65646669, 0x5f5f2066, 0x756c7063, 0x756c7073, 0x230a0d73, 0x69666564, 0x4f20656e, 0x545f5455, 
-    0x28455059, 0x54202954, 0x230a0d26, 0x69666564, 0x4920656e, 0x54554f4e, 0x5059545f, 0x29542845, 0x0d265420, 
-    0x6564230a, 0x656e6966, 0x52524120, 0x545f5941, 0x28455059, 0x4e202c54, 0x616e202c, 0x2029656d, 0x3a647473, 
-    0x7272613a, 0x543c7961, 0x3e4e202c, 0x6d616e20, 0x230a0d65, 0x66696c65, 0x66656420, 0x64656e69, 0x534c4728, 
-    0x0a0d294c, 0x66656423, 0x20656e69, 0x5f54554f, 0x45505954, 0x20295428, 0x2074756f, 0x230a0d54, 0x69666564, 
-    0x4920656e, 0x54554f4e, 0x5059545f, 0x29542845, 0x6f6e6920, 0x54207475, 0x64230a0d, 0x6e696665, 0x52412065, 
-    0x5f594152, 0x45505954, 0x202c5428, 0x6e202c4e, 0x29656d61, 0x6e205420, 0x5b656d61, 0x0a0d5d4e, 0x736c6523, 
-    0x230a0d65, 0x646e6669, 0x49206665, 0x54554f4e, 0x5059545f, 0x230a0d45, 0x69666564, 0x4920656e, 0x54554f4e, 
-    0x5059545f, 0x29542845, 0x0a0d5420, 0x646e6523, 0x0a0d6669, 0x6e666923, 0x20666564, 0x5f54554f, 0x45505954, 
-    0x64230a0d, 0x6e696665, 0x554f2065, 0x59545f54, 0x54284550, 0x0d542029, 0x6e65230a, 0x0d666964, 0x6669230a, 
-    0x6665646e, 0x52524120, 0x545f5941, 0x0d455059, 0x6564230a, 0x656e6966, 0x52524120, 0x545f5941, 0x28455059, 
-    0x4e202c54, 0x616e202c, 0x2029656d, 0x616e2054, 0x4e5b656d, 0x230a0d5d, 0x69646e65, 0x230a0d66, 0x69646e65, 
-    0x0d0a0d66, 0x2f0a0d0a, 0x2d2d2d2a, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d2d2d, 
-    0x75462023, 0x6974636e, 0x60206e6f, 0x6f736261, 0x69747072, 0x6f436e6f, 0x69666665, 0x6e656963, 0x0a0d6074, 
-    0x6552203e, 0x6e727574, 0x68742073, 0x62612065, 0x70726f73, 0x6e6f6974, 0x656f6320, 0x63696666, 0x746e6569, 
-    0x20666f20, 0x20656874, 0x6574616d, 0x6c616972, 0x2d0a0d2e, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d2f2a, 0x616f6c66, 0x61203374, 0x726f7362, 0x6f697470, 0x656f436e, 0x63696666, 
-    0x746e6569, 0x72625028, 0x6574614d, 0x6c616972, 0x74616d20, 0x7b0a0d29, 0x20200a0d, 0x75746572, 0x2d206e72, 
-    0x28676f6c, 0x2878616d, 0x2e74616d, 0x65747461, 0x7461756e, 0x436e6f69, 0x726f6c6f, 0x6c66202c, 0x3374616f, 
-    0x302e3028, 0x29293130, 0x202f2029, 0x2878616d, 0x2e74616d, 0x65747461, 0x7461756e, 0x446e6f69, 0x61747369, 
-    0x2c65636e, 0x302e3020, 0x3b293130, 0x0d7d0a0d, 0x2f0a0d0a, 0x2d2d2d2a, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d2d2d, 0x4c602023, 0x5f45424f, 0x4420602a, 0x6e696665, 0x0a0d7365, 0x6e49203e, 
-    0x65636964, 0x6f662073, 0x6f6c2072, 0x77206562, 0x68676965, 0x72207374, 0x72757465, 0x2064656e, 0x60207962, 
-    0x706d6f63, 0x4c657475, 0x5765626f, 0x68676965, 0x29287374, 0x0a0d2e60, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0d2f2a2d, 0x6564230a, 0x656e6966, 0x424f4c20, 0x49445f45, 0x53554646, 
-    0x45525f45, 0x43454c46, 0x4e4f4954, 0x0a0d3020, 0x66656423, 0x20656e69, 0x45424f4c, 0x4550535f, 0x414c5543, 
-    0x52545f52, 0x4d534e41, 0x49535349, 0x31204e4f, 0x64230a0d, 0x6e696665, 0x4f4c2065, 0x535f4542, 0x55434550, 
-    0x5f52414c, 0x4c464552, 0x49544345, 0x32204e4f, 0x64230a0d, 0x6e696665, 0x4f4c2065, 0x4d5f4542, 0x4c415445, 
-    0x4645525f, 0x5443454c, 0x204e4f49, 0x230a0d33, 0x69666564, 0x4c20656e, 0x5f45424f, 0x45454853, 0x45525f4e, 
-    0x43454c46, 0x4e4f4954, 0x0a0d3420, 0x66656423, 0x20656e69, 0x45424f4c, 0x454c435f, 0x4f435241, 0x525f5441, 
-    0x454c4645, 0x4f495443, 0x0d35204e, 0x6564230a, 0x656e6966, 0x424f4c20, 0x49445f45, 0x53554646, 0x52545f45, 
-    0x4d534e41, 0x49535349, 0x36204e4f, 0x64230a0d, 0x6e696665, 0x4f4c2065, 0x435f4542, 0x544e554f, 0x0a0d3720, 
-    0x2f2f0a0d, 0x65685420, 0x65724620, 0x6c656e73, 0x63616620, 0x20726f74, 0x65706564, 0x2073646e, 0x74206e6f, 
-    0x63206568, 0x6e69736f, 0x65622065, 0x65657774, 0x6874206e, 0x69762065, 0x76207765, 0x6f746365, 0x316b2072, 
-    0x646e6120, 0x65687420, 0x2f2f0a0d, 0x6c616820, 0x65762066, 0x726f7463, 0x2048202c, 0x6f6e203d, 0x6c616d72, 
-    0x28657a69, 0x2b20316b, 0x29326b20, 0x7542202e, 0x75642074, 0x676e6972, 0x6d617320, 0x6e696c70, 0x77202c67, 
-    0x6f642065, 0x2074276e, 0x65766168, 0x0d326b20, 0x202f2f0a, 0x69746e75, 0x6577206c, 0x6d617320, 0x20656c70, 
-    0x696d2061, 0x666f7263, 0x74656361, 0x6f53202e, 0x736e6920, 0x64616574, 0x6577202c, 0x70706120, 0x69786f72, 
-    0x6574616d, 0x2e746920, 0x2f2f0a0d, 0x726f4620, 0x6d206120, 0x6f727269, 0x75732072, 0x63616672, 0x77202c65, 
-    0x61682065, 0x48206576, 0x203d3d20, 0x46202e4e, 0x6120726f, 0x72657020, 0x74636566, 0x6420796c, 0x75666669, 
-    0x73206573, 0x61667275, 0x202c6563, 0x0a0d326b, 0x69202f2f, 0x61732073, 0x656c706d, 0x6e692064, 0x63206120, 
-    0x6e69736f, 0x69642065, 0x69727473, 0x69747562, 0x61206e6f, 0x6e756f72, 0x2c4e2064, 0x206f7320, 0x207e2048, 
-    0x6d726f6e, 0x7a696c61, 0x316b2865, 0x4e202b20, 0x0a0d2e29, 0x57202f2f, 0x64612065, 0x636f682d, 0x746e6920, 
-    0x6f707265, 0x6574616c, 0x74656220, 0x6e656577, 0x65687420, 0x7375206d, 0x20676e69, 0x20656874, 0x67756f72, 
-    0x73656e68, 0x0a0d2e73, 0x616f6c66, 0x72662074, 0x656e7365, 0x736f436c, 0x41656e69, 0x6f727070, 0x616d6978, 
-    0x6e6f6974, 0x6f6c6628, 0x56207461, 0x4e746f64, 0x6c66202c, 0x2074616f, 0x67756f72, 0x73656e68, 0x0a0d2973, 
-    0x200a0d7b, 0x74657220, 0x206e7275, 0x7072656c, 0x6f645628, 0x202c4e74, 0x74727173, 0x352e3028, 0x202b2046, 
-    0x46352e30, 0x56202a20, 0x4e746f64, 0x73202c29, 0x28747271, 0x67756f72, 0x73656e68, 0x3b292973, 0x0d7d0a0d, 
-    0x2f0a0d0a, 0x2d2d2d2a, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d2d2d, 0x75462023, 
-    0x6974636e, 0x60206e6f, 0x706d6f63, 0x4c657475, 0x5765626f, 0x68676965, 0x0d607374, 0x61433e0a, 0x6c75636c, 
-    0x73657461, 0x65687420, 0x69657720, 0x73746867, 0x20666f20, 0x20656874, 0x69646e69, 0x75646976, 0x6c206c61, 
-    0x7365626f, 0x736e6920, 0x20656469, 0x20656874, 0x6e617473, 0x64726164, 0x52425020, 0x74616d20, 0x61697265, 
-    0x0a0d2e6c, 0x65520a0d, 0x6e727574, 0x6e612073, 0x72726120, 0x77207961, 0x68636968, 0x6e616320, 0x20656220, 
-    0x65646e69, 0x20646578, 0x6e697375, 0x68742067, 0x4c602065, 0x5f45424f, 0x6420602a, 0x6e696665, 0x202e7365, 
-    0x73696854, 0x6e616320, 0x0d656220, 0x6573750a, 0x6f742064, 0x72657020, 0x6d726f66, 0x756f7920, 0x776f2072, 
-    0x6f6c206e, 0x73206562, 0x6c706d61, 0x2e676e69, 0x0a0d0a0d, 0x65746f4e, 0x61687420, 0x74602074, 0x60746e69, 
-    0x6c697720, 0x6562206c, 0x61686320, 0x6465676e, 0x20666920, 0x20656874, 0x6574616d, 0x6c616972, 0x73616820, 
-    0x69726920, 0x63736564, 0x65636e65, 0x49282021, 0x0d732774, 0x6e6f630a, 0x696e6576, 0x20746e65, 0x63206f74, 
-    0x75706d6f, 0x74206574, 0x69206568, 0x65646972, 0x6e656373, 0x66206563, 0x6f746361, 0x65682072, 0x292e6572, 
-    0x69685420, 0x656d2073, 0x20736e61, 0x20756f79, 0x756f6873, 0x6120646c, 0x64696f76, 0x61700a0d, 0x6e697373, 
-    0x20612067, 0x6574616d, 0x6c616972, 0x72617020, 0x74656d61, 0x74207265, 0x6874206f, 0x74602065, 0x60746e69, 
-    0x65696620, 0x202e646c, 0x656b614d, 0x74206120, 0x6f706d65, 0x79726172, 0x736e6920, 0x64616574, 0x600a0d3a, 
-    0x6c676060, 0x0a0d6c73, 0x616f6c66, 0x74203374, 0x20746e69, 0x616d203d, 0x61622e74, 0x6f436573, 0x3b726f6c, 
-    0x6c660a0d, 0x5b74616f, 0x45424f4c, 0x554f435f, 0x205d544e, 0x67696577, 0x20737468, 0x6f63203d, 0x7475706d, 
-    0x626f4c65, 0x69655765, 0x73746867, 0x74616d28, 0x6f64202c, 0x316b2874, 0x616d202c, 0x294e2e74, 0x6974202c, 
-    0x3b29746e, 0x60600a0d, 0x2d0a0d60, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x0a0d2f2a, 0x41525241, 0x59545f59, 0x66284550, 0x74616f6c, 0x4f4c202c, 0x435f4542, 0x544e554f, 0x2029202c, 
-    0x706d6f63, 0x4c657475, 0x5765626f, 0x68676965, 0x50287374, 0x614d7262, 0x69726574, 0x6d206c61, 0x202c7461, 
-    0x616f6c66, 0x64562074, 0x2c4e746f, 0x4f4e4920, 0x545f5455, 0x28455059, 0x616f6c66, 0x20293374, 0x746e6974, 
-    0x7b0a0d29, 0x20200a0d, 0x616f6c66, 0x72662074, 0x74616f43, 0x30203d20, 0x3b46302e, 0x20200a0d, 0x6d286669, 
-    0x632e7461, 0x7261656c, 0x74616f63, 0x30203e20, 0x2966302e, 0x20200a0d, 0x200a0d7b, 0x66202020, 0x74616f6c, 
-    0x43726620, 0x6e69736f, 0x656c4365, 0x6f637261, 0x3d207461, 0x65726620, 0x6c656e73, 0x69736f43, 0x7041656e, 
-    0x786f7270, 0x74616d69, 0x286e6f69, 0x746f6456, 0x6d202c4e, 0x632e7461, 0x7261656c, 0x74616f63, 0x67756f52, 
-    0x73656e68, 0x0d3b2973, 0x2020200a, 0x43726620, 0x2074616f, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x6d203d20, 0x632e7461, 0x7261656c, 0x74616f63, 0x69202a20, 0x665f726f, 0x6e736572, 0x31286c65, 0x2066352e, 
-    0x616d202f, 0x6f692e74, 0x202c3172, 0x6f437266, 0x656e6973, 0x61656c43, 0x616f6372, 0x0d3b2974, 0x7d20200a, 
-    0x0a0d0a0d, 0x2f2f2020, 0x69685420, 0x72462073, 0x656e7365, 0x6176206c, 0x2065756c, 0x69666564, 0x2073656e, 
-    0x20656874, 0x67696577, 0x6e697468, 0x65622067, 0x65657774, 0x6964206e, 0x63656c65, 0x63697274, 0x65707320, 
-    0x616c7563, 0x65722072, 0x63656c66, 0x6e6f6974, 0x646e6120, 0x20200a0d, 0x74202f2f, 0x62206568, 0x20657361, 
-    0x6c656964, 0x72746365, 0x42206369, 0x73464453, 0x69642820, 0x73756666, 0x65722065, 0x63656c66, 0x6e6f6974, 
-    0x646e6120, 0x65707320, 0x616c7563, 0x72742072, 0x6d736e61, 0x69737369, 0x2e296e6f, 0x20200a0d, 0x616f6c66, 
-    0x72662074, 0x6c656944, 0x72746365, 0x3d206369, 0x0d3b3020, 0x6920200a, 0x616d2866, 0x70732e74, 0x6c756365, 
-    0x3e207261, 0x0d293020, 0x7b20200a, 0x20200a0d, 0x6c662020, 0x2074616f, 0x6f437266, 0x656e6973, 0x6c656944, 
-    0x72746365, 0x3d206369, 0x65726620, 0x6c656e73, 0x69736f43, 0x7041656e, 0x786f7270, 0x74616d69, 0x286e6f69, 
-    0x746f6456, 0x28202c4e, 0x2e74616d, 0x67756f72, 0x73656e68, 0x20782e73, 0x616d202b, 0x6f722e74, 0x6e686775, 
-    0x2e737365, 0x2a202979, 0x352e3020, 0x0d3b2946, 0x2020200a, 0x44726620, 0x656c6569, 0x69727463, 0x20202063, 
-    0x20202020, 0x20202020, 0x203d2020, 0x5f726f69, 0x73657266, 0x286c656e, 0x2e74616d, 0x32726f69, 0x6d202f20, 
-    0x692e7461, 0x2c31726f, 0x43726620, 0x6e69736f, 0x65694465, 0x7463656c, 0x29636972, 0x200a0d3b, 0x66202020, 
-    0x65694472, 0x7463656c, 0x20636972, 0x6d203d2a, 0x732e7461, 0x75636570, 0x3b72616c, 0x20200a0d, 0x0d0a0d7d, 
-    0x2f20200a, 0x7345202f, 0x616d6974, 0x74206574, 0x69206568, 0x65646972, 0x6e656373, 0x46206563, 0x6e736572, 
-    0x66206c65, 0x6f746361, 0x69772072, 0x74206874, 0x61206568, 0x656c676e, 0x206f7420, 0x20656874, 0x6d726f6e, 
-    0x202c6c61, 0x0d646e61, 0x2f20200a, 0x6c62202f, 0x20646e65, 0x69207469, 0x54202e6e, 0x27746168, 0x6f672073, 
-    0x6520646f, 0x67756f6e, 0x6f662068, 0x70732072, 0x6c756365, 0x72207261, 0x656c6665, 0x6f697463, 0x0d2e736e, 
-    0x6920200a, 0x616d2866, 0x72692e74, 0x73656469, 0x636e6563, 0x203e2065, 0x66302e30, 0x200a0d29, 0x0a0d7b20, 
-    0x20202020, 0x57202f2f, 0x206e6568, 0x72656874, 0x73692065, 0x69726920, 0x63736564, 0x65636e65, 0x616e6520, 
-    0x64656c62, 0x7375202c, 0x68742065, 0x616d2065, 0x756d6978, 0x666f206d, 0x65687420, 0x74736520, 0x74616d69, 
-    0x69206465, 0x65646972, 0x6e656373, 0x66206563, 0x6f746361, 0x28202e72, 0x69747345, 0x6574616d, 0x69772064, 
-    0x56206874, 0x4e746f64, 0x6f6e202c, 0x6c616820, 0x65762d66, 0x726f7463, 0x68204820, 0x2e657265, 0x200a0d29, 
-    0x2f202020, 0x6957202f, 0x74206874, 0x74206568, 0x666e6968, 0x206d6c69, 0x69636564, 0x6e6f6973, 0x69687420, 
-    0x61682073, 0x656c646e, 0x68742073, 0x696d2065, 0x65622078, 0x65657774, 0x6f6e206e, 0x72692d6e, 0x73656469, 
-    0x636e6563, 0x6e612065, 0x72692064, 0x73656469, 0x636e6563, 0x74732065, 0x676e6572, 0x61206874, 0x6d6f7475, 
-    0x63697461, 0x796c6c61, 0x200a0d2e, 0x66202020, 0x74616f6c, 0x72662033, 0x64697249, 0x65637365, 0x2065636e, 
-    0x6874203d, 0x665f6e69, 0x5f6d6c69, 0x74636166, 0x6d28726f, 0x692e7461, 0x65646972, 0x6e656373, 0x68546563, 
-    0x6e6b6369, 0x2c737365, 0x74616d20, 0x6972692e, 0x63736564, 0x65636e65, 0x2c726f49, 0x74616d20, 0x726f692e, 
-    0x6d202c32, 0x692e7461, 0x2c31726f, 0x6f645620, 0x3b294e74, 0x20200a0d, 0x72662020, 0x6c656944, 0x72746365, 
-    0x3d206369, 0x72656c20, 0x72662870, 0x6c656944, 0x72746365, 0x202c6369, 0x2878616d, 0x72497266, 0x73656469, 
-    0x636e6563, 0x2c782e65, 0x78616d20, 0x49726628, 0x65646972, 0x6e656373, 0x792e6563, 0x7266202c, 0x64697249, 
-    0x65637365, 0x2e65636e, 0x2c29297a, 0x74616d20, 0x6972692e, 0x63736564, 0x65636e65, 0x0a0d3b29, 0x20202020, 
-    0x4d202f2f, 0x6c75646f, 0x20657461, 0x20656874, 0x6c656964, 0x72746365, 0x62206369, 0x20657361, 0x65626f6c, 
-    0x69642820, 0x73756666, 0x74202c65, 0x736e6172, 0x7373696d, 0x296e6f69, 0x6c6f6320, 0x2073726f, 0x74207962, 
-    0x69206568, 0x7265766e, 0x6f206573, 0x68742066, 0x72692065, 0x73656469, 0x636e6563, 0x61662065, 0x726f7463, 
-    0x200a0d2c, 0x2f202020, 0x6874202f, 0x6867756f, 0x65737520, 0x65687420, 0x78616d20, 0x6d756d69, 0x6d6f6320, 
-    0x656e6f70, 0x7420746e, 0x6f6e206f, 0x63612074, 0x6c617574, 0x6720796c, 0x72656e65, 0x20657461, 0x65766e69, 
-    0x20657372, 0x6f6c6f63, 0x0d2e7372, 0x2020200a, 0x6e697420, 0x203d2074, 0x5f78696d, 0x28626772, 0x746e6974, 
-    0x616d202c, 0x70732e74, 0x6c756365, 0x6f437261, 0x2c726f6c, 0x49726620, 0x65646972, 0x6e656373, 0x2a206563, 
-    0x74616d20, 0x6972692e, 0x63736564, 0x65636e65, 0x0a0d3b29, 0x0d7d2020, 0x200a0d0a, 0x6f6c6620, 0x73207461, 
-    0x6e656568, 0x30203d20, 0x3b66302e, 0x20200a0d, 0x28286669, 0x2e74616d, 0x65656873, 0x6c6f436e, 0x722e726f, 
-    0x203d2120, 0x46302e30, 0x207c7c20, 0x2e74616d, 0x65656873, 0x6c6f436e, 0x672e726f, 0x203d2120, 0x46302e30, 
-    0x207c7c20, 0x2e74616d, 0x65656873, 0x6c6f436e, 0x622e726f, 0x203d2120, 0x46302e30, 0x0a0d2929, 0x0d7b2020, 
-    0x2020200a, 0x65687320, 0x3d206e65, 0x776f7020, 0x302e3128, 0x202d2066, 0x28736261, 0x746f6456, 0x202c294e, 
-    0x2e74616d, 0x65656873, 0x756f526e, 0x656e6867, 0x3b297373, 0x2f2f2020, 0x6c202a20, 0x6e696d75, 0x65636e61, 
-    0x74616d28, 0x6568732e, 0x6f436e65, 0x29726f6c, 0x200a0d3b, 0x73202020, 0x6e656568, 0x73203d20, 0x6e656568, 
-    0x28202f20, 0x65656873, 0x202b206e, 0x46352e30, 0x0a0d3b29, 0x0d7d2020, 0x200a0d0a, 0x0d2a2f20, 0x4f20200a, 
-    0x6d207275, 0x6c65646f, 0x6e6f6320, 0x74736973, 0x666f2073, 0x6c203620, 0x72657961, 0x45202e73, 0x20686361, 
-    0x6579616c, 0x61682072, 0x656c646e, 0x20612073, 0x63617266, 0x6e6f6974, 0x20200a0d, 0x6c20666f, 0x74686769, 
-    0x61687420, 0x69642074, 0x74276e64, 0x74696820, 0x796e6120, 0x79616c20, 0x20737265, 0x766f6261, 0x74692065, 
-    0x0d0a0d3a, 0x2020200a, 0x43202d20, 0x7261656c, 0x74616f63, 0x20202020, 0x3a202020, 0x656c6320, 0x6f637261, 
-    0x2a207461, 0x68637320, 0x6b63696c, 0x73657246, 0x286c656e, 0x2c352e31, 0x6f645620, 0x0d294e74, 0x2020200a, 
-    0x53202d20, 0x6e656568, 0x20202020, 0x20202020, 0x3a202020, 0x65687320, 0x0a0d6e65, 0x20202020, 0x654d202d, 
-    0x206c6174, 0x20202020, 0x20202020, 0x203a2020, 0x6174656d, 0x63696c6c, 0x20200a0d, 0x202d2020, 0x63657053, 
-    0x72616c75, 0x20202020, 0x20202020, 0x7073203a, 0x6c756365, 0x2a207261, 0x68637320, 0x6b63696c, 0x73657246, 
-    0x286c656e, 0x2c726f69, 0x6f645620, 0x0d294e74, 0x2020200a, 0x54202d20, 0x736e6172, 0x7373696d, 0x206e6f69, 
-    0x3a202020, 0x61727420, 0x696d736e, 0x6f697373, 0x0d7d206e, 0x2020200a, 0x44202d20, 0x75666669, 0x20206573, 
-    0x20202020, 0x3a202020, 0x302e3120, 0x20202020, 0x20202020, 0x207d2020, 0x73656854, 0x77742065, 0x7261206f, 
-    0x65742065, 0x696e6863, 0x6c6c6163, 0x61702079, 0x6c6c6172, 0x6c206c65, 0x72657961, 0x200a0d73, 0x0d2f2a20, 
-    0x200a0d0a, 0x52524120, 0x545f5941, 0x28455059, 0x616f6c66, 0x4c202c74, 0x5f45424f, 0x4e554f43, 0x77202c54, 
-    0x68676965, 0x626f4c74, 0x0d3b2965, 0x7720200a, 0x68676965, 0x626f4c74, 0x4f4c5b65, 0x435f4542, 0x5241454c, 
-    0x54414f43, 0x4645525f, 0x5443454c, 0x5d4e4f49, 0x203d2020, 0x0a0d3b30, 0x65772020, 0x74686769, 0x65626f4c, 
-    0x424f4c5b, 0x48535f45, 0x5f4e4545, 0x4c464552, 0x49544345, 0x205d4e4f, 0x20202020, 0x30203d20, 0x200a0d3b, 
-    0x69657720, 0x4c746867, 0x5b65626f, 0x45424f4c, 0x54454d5f, 0x525f4c41, 0x454c4645, 0x4f495443, 0x20205d4e, 
-    0x20202020, 0x3b30203d, 0x20200a0d, 0x67696577, 0x6f4c7468, 0x4c5b6562, 0x5f45424f, 0x43455053, 0x52414c55, 
-    0x4645525f, 0x5443454c, 0x5d4e4f49, 0x3d202020, 0x0d3b3020, 0x7720200a, 0x68676965, 0x626f4c74, 0x4f4c5b65, 
-    0x535f4542, 0x55434550, 0x5f52414c, 0x4e415254, 0x53494d53, 0x4e4f4953, 0x203d205d, 0x0a0d3b30, 0x65772020, 
-    0x74686769, 0x65626f4c, 0x424f4c5b, 0x49445f45, 0x53554646, 0x52545f45, 0x4d534e41, 0x49535349, 0x205d4e4f, 
-    0x30203d20, 0x200a0d3b, 0x69657720, 0x4c746867, 0x5b65626f, 0x45424f4c, 0x4649445f, 0x45535546, 0x4645525f, 
-    0x5443454c, 0x5d4e4f49, 0x20202020, 0x3b30203d, 0x0a0d0a0d, 0x6c662020, 0x2074616f, 0x67696577, 0x61427468, 
-    0x3d206573, 0x302e3120, 0x0a0d3b46, 0x20200a0d, 0x67696577, 0x6f4c7468, 0x4c5b6562, 0x5f45424f, 0x41454c43, 
-    0x414f4352, 0x45525f54, 0x43454c46, 0x4e4f4954, 0x203d205d, 0x6f437266, 0x203b7461, 0x202f2f20, 0x46445242, 
-    0x656c6320, 0x6f637261, 0x72207461, 0x656c6665, 0x6f697463, 0x4728206e, 0x532d5847, 0x6874696d, 0x200a0d29, 
-    0x69657720, 0x42746867, 0x20657361, 0x31203d2a, 0x2066302e, 0x7266202d, 0x74616f43, 0x0d0a0d3b, 0x7720200a, 
-    0x68676965, 0x626f4c74, 0x4f4c5b65, 0x535f4542, 0x4e454548, 0x4645525f, 0x5443454c, 0x5d4e4f49, 0x77203d20, 
-    0x68676965, 0x73614274, 0x202a2065, 0x65656873, 0x20203b6e, 0x42202f2f, 0x20464452, 0x65656873, 0x6572206e, 
-    0x63656c66, 0x6e6f6974, 0x614c2820, 0x7265626d, 0x0a0d2974, 0x65772020, 0x74686769, 0x65736142, 0x203d2a20, 
-    0x66302e31, 0x73202d20, 0x6e656568, 0x0d0a0d3b, 0x7720200a, 0x68676965, 0x626f4c74, 0x4f4c5b65, 0x4d5f4542, 
-    0x4c415445, 0x4645525f, 0x5443454c, 0x5d4e4f49, 0x77203d20, 0x68676965, 0x73614274, 0x202a2065, 0x2e74616d, 
-    0x6174656d, 0x63696c6c, 0x2f20203b, 0x5242202f, 0x6d204644, 0x6c617465, 0x47472820, 0x6d532d58, 0x29687469, 
-    0x20200a0d, 0x67696577, 0x61427468, 0x2a206573, 0x2e31203d, 0x2d206630, 0x74616d20, 0x74656d2e, 0x696c6c61, 
-    0x0a0d3b63, 0x20200a0d, 0x67696577, 0x6f4c7468, 0x4c5b6562, 0x5f45424f, 0x43455053, 0x52414c55, 0x4645525f, 
-    0x5443454c, 0x5d4e4f49, 0x77203d20, 0x68676965, 0x73614274, 0x202a2065, 0x69447266, 0x63656c65, 0x63697274, 
-    0x2f20203b, 0x5242202f, 0x64204644, 0x656c6569, 0x69727463, 0x70732063, 0x6c756365, 0x72207261, 0x656c6665, 
-    0x6f697463, 0x4728206e, 0x532d5847, 0x6874696d, 0x200a0d29, 0x69657720, 0x42746867, 0x20657361, 0x31203d2a, 
-    0x2066302e, 0x7266202d, 0x6c656944, 0x72746365, 0x0d3b6369, 0x200a0d0a, 0x69657720, 0x4c746867, 0x5b65626f, 
-    0x45424f4c, 0x4550535f, 0x414c5543, 0x52545f52, 0x4d534e41, 0x49535349, 0x205d4e4f, 0x6577203d, 0x74686769, 
-    0x65736142, 0x6d202a20, 0x742e7461, 0x736e6172, 0x7373696d, 0x3b6e6f69, 0x2f2f2020, 0x44544220, 0x69642046, 
-    0x63656c65, 0x63697274, 0x65707320, 0x616c7563, 0x72742072, 0x6d736e61, 0x69737369, 0x28206e6f, 0x2d584747, 
-    0x74696d53, 0x0a0d2968, 0x20200a0d, 0x616f6c66, 0x65722074, 0x6e69616d, 0x57676e69, 0x68676965, 0x20202074, 
-    0x20202020, 0x20202020, 0x20202020, 0x203d2020, 0x67696577, 0x61427468, 0x2a206573, 0x2e312820, 0x2d206630, 
-    0x74616d20, 0x6172742e, 0x696d736e, 0x6f697373, 0x0d3b296e, 0x7720200a, 0x68676965, 0x626f4c74, 0x4f4c5b65, 
-    0x445f4542, 0x55464649, 0x545f4553, 0x534e4152, 0x5353494d, 0x5d4e4f49, 0x72203d20, 0x69616d65, 0x676e696e, 
-    0x67696557, 0x2a207468, 0x74616d20, 0x6669642e, 0x65737566, 0x6e617254, 0x73696d73, 0x6e6f6973, 0x74636146, 
-    0x0d3b726f, 0x7720200a, 0x68676965, 0x626f4c74, 0x4f4c5b65, 0x445f4542, 0x55464649, 0x525f4553, 0x454c4645, 
-    0x4f495443, 0x20205d4e, 0x72203d20, 0x69616d65, 0x676e696e, 0x67696557, 0x2a207468, 0x2e312820, 0x2d206630, 
-    0x74616d20, 0x6669642e, 0x65737566, 0x6e617254, 0x73696d73, 0x6e6f6973, 0x74636146, 0x3b29726f, 0x0a0d0a0d, 
-    0x65722020, 0x6e727574, 0x69657720, 0x4c746867, 0x3b65626f, 0x0d7d0a0d, 0x2f0a0d0a, 0x2d2d2d2a, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d2d2d, 0x75462023, 0x6974636e, 0x60206e6f, 0x646e6966, 
-    0x65626f4c, 0x3e0a0d60, 0x6c614320, 0x616c7563, 0x20736574, 0x20656874, 0x67696577, 0x20737468, 0x7420666f, 
-    0x69206568, 0x7669646e, 0x61756469, 0x6f6c206c, 0x20736562, 0x69736e69, 0x74206564, 0x73206568, 0x646e6174, 
-    0x20647261, 0x20524250, 0x6574616d, 0x6c616972, 0x203e0a0d, 0x20646e61, 0x646e6172, 0x796c6d6f, 0x6c657320, 
-    0x73746365, 0x656e6f20, 0x2d0a0d2e, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x0a0d2f2a, 0x20746e69, 0x646e6966, 0x65626f4c, 0x72625028, 0x6574614d, 0x6c616972, 0x74616d20, 0x6c66202c, 
-    0x2074616f, 0x746f6456, 0x66202c4e, 0x74616f6c, 0x646e7220, 0x2c6c6156, 0x4f4e4920, 0x545f5455, 0x28455059, 
-    0x616f6c66, 0x20293374, 0x746e6974, 0x7b0a0d29, 0x20200a0d, 0x41525241, 0x59545f59, 0x66284550, 0x74616f6c, 
-    0x4f4c202c, 0x435f4542, 0x544e554f, 0x6577202c, 0x74686769, 0x65626f4c, 0x203d2029, 0x706d6f63, 0x4c657475, 
-    0x5765626f, 0x68676965, 0x6d287374, 0x202c7461, 0x746f6456, 0x74202c4e, 0x29746e69, 0x0d0a0d3b, 0x6920200a, 
-    0x2020746e, 0x626f6c20, 0x20202065, 0x4f4c203d, 0x435f4542, 0x544e554f, 0x200a0d3b, 0x6f6c6620, 0x77207461, 
-    0x68676965, 0x203d2074, 0x66302e30, 0x200a0d3b, 0x202f2f20, 0x706f7453, 0x68772073, 0x6c206e65, 0x2065626f, 
-    0x63616572, 0x20736568, 0x4e202130, 0x656e206f, 0x74206465, 0x6f6c206f, 0x61206b6f, 0x65772074, 0x74686769, 
-    0x65626f4c, 0x205d305b, 0x636e6973, 0x65772065, 0x6f6e6b20, 0x200a0d77, 0x202f2f20, 0x6867696c, 0x69772074, 
-    0x61206c6c, 0x7961776c, 0x63732073, 0x65747461, 0x6e6f2072, 0x656e6f20, 0x626f6c20, 0x0a0d2e65, 0x68772020, 
-    0x28656c69, 0x6f6c2d2d, 0x3e206562, 0x0d293020, 0x7b20200a, 0x20200a0d, 0x65772020, 0x74686769, 0x203d2b20, 
-    0x67696577, 0x6f4c7468, 0x6c5b6562, 0x5d65626f, 0x200a0d3b, 0x69202020, 0x6e722866, 0x6c615664, 0x77203c20, 
-    0x68676965, 0x0a0d2974, 0x20202020, 0x200a0d7b, 0x20202020, 0x65726220, 0x203b6b61, 0x202f2f20, 0x706d6153, 
-    0x6120656c, 0x6520646e, 0x756c6176, 0x20657461, 0x73696874, 0x626f6c20, 0x0a0d2165, 0x20202020, 0x200a0d7d, 
-    0x0a0d7d20, 0x20200a0d, 0x75746572, 0x6c206e72, 0x3b65626f, 0x0d7d0a0d, 0x2f0a0d0a, 0x7645202f, 0x61756c61, 
-    0x20736574, 0x69642061, 0x73756666, 0x6f6c2065, 0x0d2e6562, 0x696f760a, 0x72622064, 0x645f6664, 0x75666669, 
-    0x655f6573, 0x286c6176, 0x554f4e49, 0x59545f54, 0x42284550, 0x45666473, 0x756c6176, 0x44657461, 0x29617461, 
-    0x74616420, 0x50202c61, 0x614d7262, 0x69726574, 0x6d206c61, 0x202c7461, 0x616f6c66, 0x74203374, 0x29746e69, 
-    0x0d7b0a0d, 0x2f20200a, 0x6649202f, 0x65687420, 0x636e6920, 0x6e696d6f, 0x696c2067, 0x20746867, 0x65726964, 
-    0x6f697463, 0x7369206e, 0x206e6f20, 0x20656874, 0x6b636162, 0x65646973, 0x6874202c, 0x20657265, 0x6e207369, 
-    0x6968746f, 0x7420676e, 0x7665206f, 0x61756c61, 0x66206574, 0x6120726f, 0x44524220, 0x0a0d2e46, 0x2f2f2020, 
-    0x746f4e20, 0x68742065, 0x74207461, 0x73206568, 0x65746174, 0x726f6e20, 0x736c616d, 0x76616820, 0x65622065, 
-    0x66206e65, 0x7070696c, 0x74206465, 0x6874206f, 0x61722065, 0x69732079, 0x62206564, 0x68742079, 0x61632065, 
-    0x72656c6c, 0x200a0d2e, 0x202f2f20, 0x6c636e49, 0x20656475, 0x65676465, 0x206e6f2d, 0x203d3d28, 0x66302e30, 
-    0x73612029, 0x6f6e2220, 0x67696c20, 0x20227468, 0x65736163, 0x200a0d2e, 0x28666920, 0x28746f64, 0x61746164, 
-    0x2c326b2e, 0x74616d20, 0x29674e2e, 0x203d3c20, 0x66302e30, 0x2f202029, 0x6669202f, 0x61622820, 0x69736b63, 
-    0x0d296564, 0x7b20200a, 0x20200a0d, 0x65722020, 0x6e727574, 0x2f20203b, 0x6261202f, 0x62726f73, 0x20200a0d, 
-    0x0d0a0d7d, 0x6420200a, 0x2e617461, 0x20666470, 0x616d203d, 0x2e302878, 0x202c6630, 0x28746f64, 0x61746164, 
-    0x2c326b2e, 0x74616d20, 0x20294e2e, 0x5f4d202a, 0x49505f31, 0x0a0d3b29, 0x20200a0d, 0x46202f2f, 0x6120726f, 
-    0x69687720, 0x4c206574, 0x65626d61, 0x6d207472, 0x72657461, 0x2c6c6169, 0x65687420, 0x64786220, 0x6f632066, 
-    0x6e6f706d, 0x73746e65, 0x74616d20, 0x74206863, 0x65206568, 0x756c6176, 0x6f697461, 0x6470206e, 0x28202e66, 
-    0x20656553, 0x5f4c444d, 0x646e6572, 0x72657265, 0x0a0d292e, 0x61642020, 0x622e6174, 0x5f666473, 0x66666964, 
-    0x20657375, 0x6974203d, 0x2a20746e, 0x74616420, 0x64702e61, 0x0a0d3b66, 0x0d0a0d7d, 0x696f760a, 0x72622064, 
-    0x645f6664, 0x75666669, 0x655f6573, 0x286c6176, 0x554f4e49, 0x59545f54, 0x42284550, 0x45666473, 0x756c6176, 
-    0x44657461, 0x29617461, 0x74616420, 0x50202c61, 0x614d7262, 0x69726574, 0x6d206c61, 0x0d297461, 0x0a0d7b0a, 
-    0x72622020, 0x645f6664, 0x75666669, 0x655f6573, 0x286c6176, 0x61746164, 0x616d202c, 0x6d202c74, 0x622e7461, 
-    0x43657361, 0x726f6c6f, 0x0a0d3b29, 0x0d0a0d7d, 0x202f2f0a, 0x706d6153, 0x2073656c, 0x69642061, 0x73756666, 
-    0x6f6c2065, 0x0d2e6562, 0x696f760a, 0x72622064, 0x645f6664, 0x75666669, 0x735f6573, 0x6c706d61, 0x4e492865, 
-    0x5f54554f, 0x45505954, 0x64734228, 0x6d615366, 0x44656c70, 0x29617461, 0x74616420, 0x50202c61, 0x614d7262, 
-    0x69726574, 0x6d206c61, 0x202c7461, 0x616f6c66, 0x74203374, 0x29746e69, 0x0d7b0a0d, 0x6420200a, 0x2e617461, 
-    0x2020326b, 0x6f63203d, 0x656e6973, 0x706d6153, 0x6548656c, 0x7073696d, 0x65726568, 0x74616428, 0x69782e61, 
-    0x202c782e, 0x61746164, 0x2e69782e, 0x0d3b2979, 0x6420200a, 0x2e617461, 0x2020326b, 0x616d203d, 0x20542e74, 
-    0x6164202a, 0x6b2e6174, 0x20782e32, 0x616d202b, 0x20422e74, 0x6164202a, 0x6b2e6174, 0x20792e32, 0x616d202b, 
-    0x204e2e74, 0x6164202a, 0x6b2e6174, 0x3b7a2e32, 0x20200a0d, 0x61746164, 0x20326b2e, 0x6e203d20, 0x616d726f, 
-    0x657a696c, 0x74616428, 0x326b2e61, 0x0a0d3b29, 0x61642020, 0x702e6174, 0x3d206664, 0x746f6420, 0x74616428, 
-    0x326b2e61, 0x616d202c, 0x294e2e74, 0x4d202a20, 0x505f315f, 0x0a0d3b49, 0x20200a0d, 0x61746164, 0x6473622e, 
-    0x766f5f66, 0x705f7265, 0x3d206664, 0x6e697420, 0x20203b74, 0x62202f2f, 0x20666473, 0x6f64202a, 0x69772874, 
-    0x6f6e202c, 0x6c616d72, 0x202f2029, 0x3b666470, 0x20200a0d, 0x61746164, 0x6576652e, 0x745f746e, 0x20657079, 
-    0x3d202020, 0x2e302820, 0x3c206630, 0x746f6420, 0x74616428, 0x326b2e61, 0x616d202c, 0x674e2e74, 0x3f202929, 
-    0x44534220, 0x56455f46, 0x5f544e45, 0x46464944, 0x5f455355, 0x4c464552, 0x49544345, 0x3a204e4f, 0x44534220, 
-    0x56455f46, 0x5f544e45, 0x4f534241, 0x0d3b4252, 0x0a0d7d0a, 0x6f760a0d, 0x62206469, 0x5f666472, 0x66666964, 
-    0x5f657375, 0x706d6173, 0x4928656c, 0x54554f4e, 0x5059545f, 0x73422845, 0x61536664, 0x656c706d, 0x61746144, 
-    0x61642029, 0x202c6174, 0x4d726250, 0x72657461, 0x206c6169, 0x2974616d, 0x0d7b0a0d, 0x6220200a, 0x5f666472, 
-    0x66666964, 0x5f657375, 0x706d6173, 0x6428656c, 0x2c617461, 0x74616d20, 0x616d202c, 0x61622e74, 0x6f436573, 
-    0x29726f6c, 0x7d0a0d3b, 0x0a0d0a0d, 0x64696f76, 0x64726220, 0x69645f66, 0x73756666, 0x72745f65, 0x6d736e61, 
-    0x69737369, 0x655f6e6f, 0x286c6176, 0x554f4e49, 0x59545f54, 0x42284550, 0x45666473, 0x756c6176, 0x44657461, 
-    0x29617461, 0x74616420, 0x50202c61, 0x614d7262, 0x69726574, 0x6d206c61, 0x202c7461, 0x616f6c66, 0x74203374, 
-    0x29746e69, 0x0d7b0a0d, 0x2f20200a, 0x6649202f, 0x65687420, 0x636e6920, 0x6e696d6f, 0x696c2067, 0x20746867, 
-    0x65726964, 0x6f697463, 0x7369206e, 0x206e6f20, 0x20656874, 0x656d6173, 0x64697320, 0x73612065, 0x65687420, 
-    0x72757320, 0x65636166, 0x726f6e20, 0x2c6c616d, 0x20200a0d, 0x74202f2f, 0x65726568, 0x20736920, 0x64206f6e, 
-    0x75666669, 0x74206573, 0x736e6172, 0x7373696d, 0x206e6f69, 0x65206f74, 0x756c6176, 0x2e657461, 0x73624120, 
-    0x2062726f, 0x6867696c, 0x6e692074, 0x69687420, 0x61632073, 0x0d2e6573, 0x6920200a, 0x6f642866, 0x61642874, 
-    0x6b2e6174, 0x2d202c32, 0x2e74616d, 0x2029674e, 0x30203d3c, 0x2966302e, 0x20200a0d, 0x200a0d7b, 0x72202020, 
-    0x72757465, 0x20203b6e, 0x61202f2f, 0x726f7362, 0x200a0d62, 0x0a0d7d20, 0x20200a0d, 0x61746164, 0x6664702e, 
-    0x6d203d20, 0x30287861, 0x2c66302e, 0x746f6420, 0x74616428, 0x326b2e61, 0x6d2d202c, 0x4e2e7461, 0x202a2029, 
-    0x5f315f4d, 0x3b294950, 0x0a0d0a0d, 0x2f2f2020, 0x726f4620, 0x77206120, 0x65746968, 0x6d614c20, 0x74726562, 
-    0x74616d20, 0x61697265, 0x74202c6c, 0x62206568, 0x20666478, 0x706d6f63, 0x6e656e6f, 0x6d207374, 0x68637461, 
-    0x65687420, 0x61766520, 0x7461756c, 0x206e6f69, 0x2e666470, 0x65532820, 0x444d2065, 0x65725f4c, 0x7265646e, 
-    0x292e7265, 0x20200a0d, 0x61746164, 0x6473622e, 0x69645f66, 0x73756666, 0x203d2065, 0x746e6974, 0x64202a20, 
-    0x2e617461, 0x20666470, 0x616d202a, 0x69642e74, 0x73756666, 0x61725465, 0x696d736e, 0x6f697373, 0x6c6f436e, 
-    0x0d3b726f, 0x0a0d7d0a, 0x6f760a0d, 0x62206469, 0x5f666472, 0x66666964, 0x5f657375, 0x6e617274, 0x73696d73, 
-    0x6e6f6973, 0x6d61735f, 0x28656c70, 0x554f4e49, 0x59545f54, 0x42284550, 0x53666473, 0x6c706d61, 0x74614465, 
-    0x64202961, 0x2c617461, 0x72625020, 0x6574614d, 0x6c616972, 0x74616d20, 0x6c66202c, 0x3374616f, 0x6e697420, 
-    0x0a0d2974, 0x200a0d7b, 0x202f2f20, 0x706d6153, 0x6120656c, 0x72696420, 0x69746365, 0x6f206e6f, 0x6874206e, 
-    0x706f2065, 0x69736f70, 0x68206574, 0x73696d65, 0x72656870, 0x72282065, 0x74616c65, 0x20657669, 0x2d206f74, 
-    0x2e74616d, 0x0d2e294e, 0x6620200a, 0x74616f6c, 0x61732033, 0x656c706d, 0x72694464, 0x63203d20, 0x6e69736f, 
-    0x6d615365, 0x48656c70, 0x73696d65, 0x72656870, 0x61642865, 0x782e6174, 0x2c782e69, 0x74616420, 0x69782e61, 
-    0x3b29792e, 0x20200a0d, 0x61746164, 0x20326b2e, 0x20202020, 0x20202020, 0x203d2020, 0x2e74616d, 0x202a2054, 
-    0x706d6173, 0x4464656c, 0x782e7269, 0x6d202b20, 0x422e7461, 0x73202a20, 0x6c706d61, 0x69446465, 0x20792e72, 
-    0x616d202d, 0x204e2e74, 0x6173202a, 0x656c706d, 0x72694464, 0x203b7a2e, 0x202f2f20, 0x70696c46, 0x65687420, 
-    0x726f6e20, 0x0d6c616d, 0x6420200a, 0x2e617461, 0x2020326b, 0x20202020, 0x20202020, 0x6e203d20, 0x616d726f, 
-    0x657a696c, 0x74616428, 0x326b2e61, 0x0a0d3b29, 0x20200a0d, 0x43202f2f, 0x75706d6f, 0x74206574, 0x50206568, 
-    0x66204644, 0x7420726f, 0x20736968, 0x65726964, 0x6f697463, 0x0a0d2e6e, 0x61642020, 0x702e6174, 0x3d206664, 
-    0x78616d20, 0x302e3028, 0x64202c66, 0x6428746f, 0x2e617461, 0x202c326b, 0x74616d2d, 0x20294e2e, 0x5f4d202a, 
-    0x49505f31, 0x0a0d3b29, 0x20200a0d, 0x45202f2f, 0x7275736e, 0x6e652065, 0x79677265, 0x6e6f6320, 0x76726573, 
-    0x6f697461, 0x7962206e, 0x6e6f6320, 0x65646973, 0x676e6972, 0x65687420, 0x66696420, 0x65737566, 0x61727420, 
-    0x696d736e, 0x6f697373, 0x6974206e, 0x0d2e746e, 0x6420200a, 0x2e617461, 0x66647362, 0x65766f5f, 0x64705f72, 
-    0x203d2066, 0x746e6974, 0x6d202a20, 0x642e7461, 0x75666669, 0x72546573, 0x6d736e61, 0x69737369, 0x6f436e6f, 
-    0x3b726f6c, 0x0a0d0a0d, 0x2f2f2020, 0x74654420, 0x696d7265, 0x7420656e, 0x65206568, 0x746e6576, 0x70797420, 
-    0x61622065, 0x20646573, 0x74206e6f, 0x64206568, 0x63657269, 0x6e6f6974, 0x6c657220, 0x76697461, 0x6f742065, 
-    0x65687420, 0x6f656720, 0x7274656d, 0x6e206369, 0x616d726f, 0x0a0d2e6c, 0x61642020, 0x652e6174, 0x746e6576, 
-    0x7079745f, 0x203d2065, 0x746f6428, 0x74616428, 0x326b2e61, 0x6d2d202c, 0x4e2e7461, 0x3e202967, 0x302e3020, 
-    0x3f202966, 0x44534220, 0x56455f46, 0x5f544e45, 0x46464944, 0x5f455355, 0x4e415254, 0x53494d53, 0x4e4f4953, 
-    0x42203a20, 0x5f464453, 0x4e455645, 0x42415f54, 0x42524f53, 0x7d0a0d3b, 0x0a0d0a0d, 0x2f2f0a0d, 0x61764520, 
-    0x7461756c, 0x61207365, 0x66657220, 0x7463656c, 0x20657669, 0x65626f6c, 0x74697720, 0x20612068, 0x20584747, 
-    0x2046444e, 0x20646e61, 0x75206e61, 0x726f636e, 0x616c6572, 0x20646574, 0x74696d53, 0x2f0a0d68, 0x6373202f, 
-    0x65747461, 0x676e6972, 0x73616d2d, 0x676e696b, 0x6e756620, 0x6f697463, 0x0a0d2e6e, 0x64696f76, 0x64726220, 
-    0x67675f66, 0x6d735f78, 0x5f687469, 0x6c617665, 0x4f4e4928, 0x545f5455, 0x28455059, 0x66647342, 0x6c617645, 
-    0x65746175, 0x61746144, 0x61642029, 0x202c6174, 0x4d726250, 0x72657461, 0x206c6169, 0x2c74616d, 0x6e6f6320, 
-    0x69207473, 0x6c20746e, 0x2c65626f, 0x6f6c6620, 0x20337461, 0x746e6974, 0x7b0a0d29, 0x20200a0d, 0x42202f2f, 
-    0x20464452, 0x4220726f, 0x20464454, 0x6c617665, 0x200a0d3f, 0x202f2f20, 0x74206649, 0x69206568, 0x6d6f636e, 
-    0x20676e69, 0x6867696c, 0x69642074, 0x74636572, 0x206e6f69, 0x6f207369, 0x6874206e, 0x61622065, 0x61666b63, 
-    0x0d2e6563, 0x2f20200a, 0x6e49202f, 0x64756c63, 0x64652065, 0x6f2d6567, 0x3d28206e, 0x2e30203d, 0x20296630, 
-    0x22207361, 0x6c206f6e, 0x74686769, 0x61632022, 0x0d2e6573, 0x6320200a, 0x74736e6f, 0x6f6f6220, 0x6162206c, 
-    0x69736b63, 0x3d206564, 0x6f642820, 0x61642874, 0x6b2e6174, 0x6d202c32, 0x4e2e7461, 0x3c202967, 0x2e30203d, 
-    0x3b296630, 0x20200a0d, 0x4e202f2f, 0x6968746f, 0x7420676e, 0x7665206f, 0x61756c61, 0x66206574, 0x6720726f, 
-    0x6e657669, 0x72696420, 0x69746365, 0x3f736e6f, 0x20200a0d, 0x4d202f2f, 0x75204c44, 0x20736573, 0x20262622, 
-    0x74616373, 0x5f726574, 0x6c666572, 0x22746365, 0x72656820, 0x73203b65, 0x65636e69, 0x69687420, 0x6e6f2073, 
-    0x6820796c, 0x6c646e61, 0x72207365, 0x656c6665, 0x6f697463, 0x60202c6e, 0x74616373, 0x5f726574, 0x6c666572, 
-    0x60746365, 0x20736920, 0x736c6166, 0x0a0d2e65, 0x66692020, 0x63616228, 0x6469736b, 0x26262065, 0x6c616620, 
-    0x0d296573, 0x7b20200a, 0x20200a0d, 0x61642020, 0x702e6174, 0x20206664, 0x20202020, 0x3d202020, 0x302e3020, 
-    0x0a0d3b66, 0x20202020, 0x61746164, 0x6473622e, 0x6c675f66, 0x7973736f, 0x66203d20, 0x74616f6c, 0x2e302833, 
-    0x3b296630, 0x20200a0d, 0x65722020, 0x6e727574, 0x200a0d3b, 0x0a0d7d20, 0x20200a0d, 0x736e6f63, 0x6c662074, 
-    0x2074616f, 0x20316b6e, 0x6261203d, 0x6f642873, 0x61642874, 0x6b2e6174, 0x6d202c31, 0x4e2e7461, 0x0d3b2929, 
-    0x6320200a, 0x74736e6f, 0x6f6c6620, 0x6e207461, 0x3d20326b, 0x73626120, 0x746f6428, 0x74616428, 0x326b2e61, 
-    0x616d202c, 0x294e2e74, 0x0a0d3b29, 0x20200a0d, 0x63202f2f, 0x75706d6f, 0x685f6574, 0x5f666c61, 0x74636576, 
-    0x2928726f, 0x726f6620, 0x61637320, 0x72657474, 0x6665725f, 0x7463656c, 0x200a0d2e, 0x6e6f6320, 0x66207473, 
-    0x74616f6c, 0x20682033, 0x6f6e203d, 0x6c616d72, 0x28657a69, 0x61746164, 0x20316b2e, 0x6164202b, 0x6b2e6174, 
-    0x0d3b2932, 0x200a0d0a, 0x202f2f20, 0x61766e49, 0x2064696c, 0x20726f66, 0x6c666572, 0x69746365, 0x2f206e6f, 
-    0x66657220, 0x74636172, 0x3f6e6f69, 0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x2020686e, 0x6f64203d, 
-    0x616d2874, 0x2c4e2e74, 0x3b296820, 0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x2068316b, 0x6f64203d, 
-    0x61642874, 0x6b2e6174, 0x68202c31, 0x0a0d3b29, 0x6f632020, 0x2074736e, 0x616f6c66, 0x326b2074, 0x203d2068, 
-    0x28746f64, 0x61746164, 0x2c326b2e, 0x3b296820, 0x0a0d0a0d, 0x2f2f2020, 0x316b6e20, 0x646e6120, 0x20686e20, 
-    0x7473756d, 0x746f6e20, 0x20656220, 0x66302e30, 0x20726f20, 0x74617473, 0x64702e65, 0x3d3d2066, 0x4e614e20, 
-    0x200a0d2e, 0x28666920, 0x20316b6e, 0x30203d3c, 0x2066302e, 0x6e207c7c, 0x3d3c2068, 0x302e3020, 0x7c7c2066, 
-    0x68316b20, 0x30203c20, 0x2066302e, 0x6b207c7c, 0x3c206832, 0x302e3020, 0x0a0d2966, 0x0d7b2020, 0x2020200a, 
-    0x74616420, 0x64702e61, 0x20202066, 0x20202020, 0x203d2020, 0x66302e30, 0x200a0d3b, 0x64202020, 0x2e617461, 
-    0x66647362, 0x6f6c675f, 0x20797373, 0x6c66203d, 0x3374616f, 0x302e3028, 0x0d3b2966, 0x2020200a, 0x74657220, 
-    0x3b6e7275, 0x20200a0d, 0x0d0a0d7d, 0x2f20200a, 0x6f43202f, 0x7475706d, 0x53422065, 0x61204644, 0x7020646e, 
-    0x0d2e6664, 0x6320200a, 0x74736e6f, 0x6f6c6620, 0x20337461, 0x3d203068, 0x6f6c6620, 0x28337461, 0x28746f64, 
-    0x2e74616d, 0x68202c54, 0x64202c29, 0x6d28746f, 0x422e7461, 0x2968202c, 0x686e202c, 0x0a0d3b29, 0x20200a0d, 
-    0x61746164, 0x6664702e, 0x68203d20, 0x675f6476, 0x655f7867, 0x286c6176, 0x66302e31, 0x6d202f20, 0x722e7461, 
-    0x6867756f, 0x7373656e, 0x3068202c, 0x0a0d3b29, 0x6c662020, 0x2074616f, 0x0d3b3147, 0x6620200a, 0x74616f6c, 
-    0x3b324720, 0x0a0d0a0d, 0x6c662020, 0x2074616f, 0x3b323147, 0x20200a0d, 0x20323147, 0x6767203d, 0x6d735f78, 
-    0x5f687469, 0x64616873, 0x6d5f776f, 0x286b7361, 0x202c3147, 0x202c3247, 0x616f6c66, 0x64283374, 0x6d28746f, 
-    0x542e7461, 0x6164202c, 0x6b2e6174, 0x202c2931, 0x28746f64, 0x2e74616d, 0x64202c42, 0x2e617461, 0x2c29316b, 
-    0x316b6e20, 0x0a0d2c29, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x6c662020, 0x3374616f, 0x746f6428, 0x74616d28, 0x202c542e, 0x61746164, 0x29326b2e, 0x6f64202c, 0x616d2874, 
-    0x2c422e74, 0x74616420, 0x326b2e61, 0x6e202c29, 0x2c29326b, 0x74616d20, 0x756f722e, 0x656e6867, 0x3b297373, 
-    0x0a0d0a0d, 0x61642020, 0x702e6174, 0x2a206664, 0x2e30203d, 0x20663532, 0x6e28202f, 0x2a20316b, 0x29686e20, 
-    0x0d0a0d3b, 0x6620200a, 0x74616f6c, 0x73622033, 0x3d206664, 0x6f6c6620, 0x28337461, 0x20323147, 0x6164202a, 
-    0x702e6174, 0x3b296664, 0x0a0d0a0d, 0x61642020, 0x702e6174, 0x2a206664, 0x3147203d, 0x0d0a0d3b, 0x6920200a, 
-    0x616d2866, 0x72692e74, 0x73656469, 0x636e6563, 0x203e2065, 0x66302e30, 0x200a0d29, 0x0a0d7b20, 0x20202020, 
-    0x736e6f63, 0x6c662074, 0x3374616f, 0x63616620, 0x20726f74, 0x6874203d, 0x665f6e69, 0x5f6d6c69, 0x74636166, 
-    0x6d28726f, 0x692e7461, 0x65646972, 0x6e656373, 0x68546563, 0x6e6b6369, 0x2c737365, 0x74616d20, 0x6972692e, 
-    0x63736564, 0x65636e65, 0x2c726f49, 0x74616d20, 0x726f692e, 0x6d202c32, 0x692e7461, 0x2c31726f, 0x68316b20, 
-    0x0a0d3b29, 0x20200a0d, 0x77732020, 0x68637469, 0x626f6c28, 0x0a0d2965, 0x20202020, 0x200a0d7b, 0x20202020, 
-    0x73616320, 0x4f4c2065, 0x535f4542, 0x55434550, 0x5f52414c, 0x4c464552, 0x49544345, 0x0d3a4e4f, 0x2020200a, 
-    0x20202020, 0x6e697420, 0x3d2a2074, 0x72656c20, 0x6c662870, 0x3374616f, 0x662e3128, 0x66202c29, 0x6f746361, 
-    0x6d202c72, 0x692e7461, 0x65646972, 0x6e656373, 0x3b296563, 0x20200a0d, 0x20202020, 0x72622020, 0x3b6b6165, 
-    0x0a0d0a0d, 0x20202020, 0x61632020, 0x4c206573, 0x5f45424f, 0x4154454d, 0x45525f4c, 0x43454c46, 0x4e4f4954, 
-    0x200a0d3a, 0x20202020, 0x74202020, 0x20746e69, 0x696d203d, 0x67725f78, 0x69742862, 0x202c746e, 0x2e74616d, 
-    0x63657073, 0x72616c75, 0x6f6c6f43, 0x66202c72, 0x6f746361, 0x202a2072, 0x2e74616d, 0x64697269, 0x65637365, 
-    0x2965636e, 0x200a0d3b, 0x20202020, 0x62202020, 0x6b616572, 0x200a0d3b, 0x7d202020, 0x20200a0d, 0x0d0a0d7d, 
-    0x2f20200a, 0x7665202f, 0x6f206c61, 0x75707475, 0x28203a74, 0x736f6c67, 0x70207973, 0x20747261, 0x7420666f, 
-    0x20296568, 0x66647362, 0x64202a20, 0x6b28746f, 0x6e202c32, 0x616d726f, 0x0a0d296c, 0x61642020, 0x622e6174, 
-    0x5f666473, 0x736f6c67, 0x3d207973, 0x64736220, 0x202a2066, 0x746e6974, 0x7d0a0d3b, 0x0a0d0a0d, 0x53202f2f, 
-    0x6c706d61, 0x61207365, 0x66657220, 0x7463656c, 0x20657669, 0x65626f6c, 0x74697720, 0x20612068, 0x20584747, 
-    0x2046444e, 0x20646e61, 0x75206e61, 0x726f636e, 0x616c6572, 0x20646574, 0x74696d53, 0x2f0a0d68, 0x6373202f, 
-    0x65747461, 0x676e6972, 0x73616d2d, 0x676e696b, 0x6e756620, 0x6f697463, 0x0a0d2e6e, 0x64696f76, 0x64726220, 
-    0x67675f66, 0x6d735f78, 0x5f687469, 0x706d6173, 0x4928656c, 0x54554f4e, 0x5059545f, 0x73422845, 0x61536664, 
-    0x656c706d, 0x61746144, 0x61642029, 0x202c6174, 0x4d726250, 0x72657461, 0x206c6169, 0x2c74616d, 0x6e6f6320, 
-    0x69207473, 0x6c20746e, 0x2c65626f, 0x6f6c6620, 0x20337461, 0x746e6974, 0x7b0a0d29, 0x20200a0d, 0x57202f2f, 
-    0x206e6568, 0x20656874, 0x706d6173, 0x676e696c, 0x74657220, 0x736e7275, 0x65766520, 0x7954746e, 0x3d206570, 
-    0x44534220, 0x56455f46, 0x5f544e45, 0x4f534241, 0x202c4252, 0x20656874, 0x68746170, 0x646e6520, 0x6e692073, 
-    0x65646973, 0x65687420, 0x79617220, 0x6e656720, 0x74617265, 0x206e6f69, 0x676f7270, 0x2e6d6172, 0x20200a0d, 
-    0x4d202f2f, 0x20656b61, 0x65727573, 0x65687420, 0x74657220, 0x656e7275, 0x61762064, 0x7365756c, 0x65726120, 
-    0x6c617620, 0x6e206469, 0x65626d75, 0x77207372, 0x206e6568, 0x696e616d, 0x616c7570, 0x676e6974, 0x65687420, 
-    0x44525020, 0x200a0d2e, 0x74616420, 0x73622e61, 0x6f5f6664, 0x5f726576, 0x20666470, 0x6c66203d, 0x3374616f, 
-    0x302e3028, 0x0d3b2966, 0x6420200a, 0x2e617461, 0x20666470, 0x20202020, 0x20202020, 0x203d2020, 0x66302e30, 
-    0x0d0a0d3b, 0x2f20200a, 0x7254202f, 0x66736e61, 0x206d726f, 0x6c206f74, 0x6c61636f, 0x6f6f6320, 0x6e696472, 
-    0x20657461, 0x74737973, 0x0a0d6d65, 0x6f632020, 0x2074736e, 0x616f6c66, 0x6b6e2074, 0x203d2031, 0x28746f64, 
-    0x61746164, 0x2c316b2e, 0x74616d20, 0x3b294e2e, 0x20200a0d, 0x6e286669, 0x3c20316b, 0x2e30203d, 0x0d296630, 
-    0x7b20200a, 0x20200a0d, 0x61642020, 0x652e6174, 0x746e6576, 0x7079745f, 0x203d2065, 0x46445342, 0x4556455f, 
-    0x415f544e, 0x524f5342, 0x0a0d3b42, 0x20202020, 0x75746572, 0x0d3b6e72, 0x7d20200a, 0x20200a0d, 0x736e6f63, 
-    0x6c662074, 0x3374616f, 0x30316b20, 0x66203d20, 0x74616f6c, 0x6f642833, 0x61642874, 0x6b2e6174, 0x6d202c31, 
-    0x542e7461, 0x64202c29, 0x6428746f, 0x2e617461, 0x202c316b, 0x2e74616d, 0x202c2942, 0x29316b6e, 0x0d0a0d3b, 
-    0x2f20200a, 0x6153202f, 0x656c706d, 0x6c616820, 0x65762d66, 0x726f7463, 0x696d202c, 0x666f7263, 0x74656361, 
-    0x726f6e20, 0x2e6c616d, 0x20200a0d, 0x736e6f63, 0x6c662074, 0x3374616f, 0x20306820, 0x7668203d, 0x67675f64, 
-    0x61735f78, 0x656c706d, 0x646e765f, 0x316b2866, 0x6d202c30, 0x722e7461, 0x6867756f, 0x7373656e, 0x6164202c, 
-    0x782e6174, 0x79782e69, 0x0a0d3b29, 0x66692020, 0x2e306828, 0x3d3d207a, 0x302e3020, 0x0a0d2966, 0x0d7b2020, 
-    0x2020200a, 0x74616420, 0x76652e61, 0x5f746e65, 0x65707974, 0x42203d20, 0x5f464453, 0x4e455645, 0x42415f54, 
-    0x42524f53, 0x200a0d3b, 0x72202020, 0x72757465, 0x0a0d3b6e, 0x0d7d2020, 0x200a0d0a, 0x202f2f20, 0x6e617254, 
-    0x726f6673, 0x6f74206d, 0x726f7720, 0x0a0d646c, 0x6f632020, 0x2074736e, 0x616f6c66, 0x68203374, 0x203d2020, 
-    0x782e3068, 0x6d202a20, 0x542e7461, 0x68202b20, 0x20792e30, 0x616d202a, 0x20422e74, 0x3068202b, 0x2a207a2e, 
-    0x74616d20, 0x0d3b4e2e, 0x6320200a, 0x74736e6f, 0x6f6c6620, 0x20207461, 0x3d20686b, 0x746f6420, 0x74616428, 
-    0x316b2e61, 0x2968202c, 0x0d0a0d3b, 0x6920200a, 0x686b2866, 0x203d3c20, 0x66302e30, 0x200a0d29, 0x0a0d7b20, 
-    0x20202020, 0x61746164, 0x6576652e, 0x745f746e, 0x20657079, 0x5342203d, 0x455f4644, 0x544e4556, 0x5342415f, 
-    0x3b42524f, 0x20200a0d, 0x65722020, 0x6e727574, 0x200a0d3b, 0x0a0d7d20, 0x20200a0d, 0x42202f2f, 0x3a464452, 
-    0x66657220, 0x7463656c, 0x20200a0d, 0x61746164, 0x20326b2e, 0x3228203d, 0x2066302e, 0x686b202a, 0x202a2029, 
-    0x202d2068, 0x61746164, 0x3b316b2e, 0x0a0d0a0d, 0x2f2f2020, 0x65684320, 0x69206b63, 0x68742066, 0x65722065, 
-    0x746c7573, 0x20676e69, 0x65726964, 0x6f697463, 0x7369206e, 0x206e6f20, 0x20656874, 0x72726f63, 0x20746365, 
-    0x65646973, 0x20666f20, 0x20656874, 0x75746361, 0x67206c61, 0x656d6f65, 0x0d797274, 0x6320200a, 0x74736e6f, 
-    0x6f6c6620, 0x67207461, 0x20326b6e, 0x6f64203d, 0x61642874, 0x6b2e6174, 0x6d202c32, 0x4e2e7461, 0x0d3b2967, 
-    0x200a0d0a, 0x28666920, 0x326b6e67, 0x203d3c20, 0x66302e30, 0x200a0d29, 0x0a0d7b20, 0x20202020, 0x61746164, 
-    0x6576652e, 0x745f746e, 0x20657079, 0x5342203d, 0x455f4644, 0x544e4556, 0x5342415f, 0x3b42524f, 0x20200a0d, 
-    0x65722020, 0x6e727574, 0x200a0d3b, 0x0a0d7d20, 0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x20326b6e, 
-    0x6261203d, 0x6f642873, 0x61642874, 0x6b2e6174, 0x6d202c32, 0x4e2e7461, 0x0d3b2929, 0x6320200a, 0x74736e6f, 
-    0x6f6c6620, 0x6b207461, 0x3d206832, 0x73626120, 0x746f6428, 0x74616428, 0x326b2e61, 0x2968202c, 0x0a0d3b29, 
-    0x20200a0d, 0x616f6c66, 0x31472074, 0x200a0d3b, 0x6f6c6620, 0x47207461, 0x0a0d3b32, 0x20200a0d, 0x616f6c66, 
-    0x31472074, 0x203d2032, 0x5f786767, 0x74696d73, 0x68735f68, 0x776f6461, 0x73616d5f, 0x3147286b, 0x3247202c, 
-    0x316b202c, 0x66202c30, 0x74616f6c, 0x6f642833, 0x61642874, 0x6b2e6174, 0x6d202c32, 0x542e7461, 0x64202c29, 
-    0x6428746f, 0x2e617461, 0x202c326b, 0x2e74616d, 0x202c2942, 0x29326b6e, 0x616d202c, 0x6f722e74, 0x6e686775, 
-    0x29737365, 0x0d0a0d3b, 0x6920200a, 0x31472866, 0x3d3c2032, 0x302e3020, 0x0a0d2966, 0x0d7b2020, 0x2020200a, 
-    0x74616420, 0x76652e61, 0x5f746e65, 0x65707974, 0x42203d20, 0x5f464453, 0x4e455645, 0x42415f54, 0x42524f53, 
-    0x200a0d3b, 0x72202020, 0x72757465, 0x0a0d3b6e, 0x0d7d2020, 0x200a0d0a, 0x74616420, 0x73622e61, 0x6f5f6664, 
-    0x5f726576, 0x20666470, 0x6c66203d, 0x3374616f, 0x29324728, 0x200a0d3b, 0x74616420, 0x76652e61, 0x5f746e65, 
-    0x65707974, 0x20202020, 0x5342203d, 0x455f4644, 0x544e4556, 0x4f4c475f, 0x5f595353, 0x4c464552, 0x49544345, 
-    0x0d3b4e4f, 0x200a0d0a, 0x202f2f20, 0x706d6f43, 0x20657475, 0x0d666470, 0x6420200a, 0x2e617461, 0x20666470, 
-    0x7668203d, 0x67675f64, 0x76655f78, 0x31286c61, 0x2066302e, 0x616d202f, 0x6f722e74, 0x6e686775, 0x2c737365, 
-    0x29306820, 0x47202a20, 0x0a0d3b31, 0x61642020, 0x702e6174, 0x2a206664, 0x2e30203d, 0x20663532, 0x6e28202f, 
-    0x2a20316b, 0x2e306820, 0x0d3b297a, 0x200a0d0a, 0x28666920, 0x2e74616d, 0x64697269, 0x65637365, 0x2065636e, 
-    0x2e30203e, 0x0d296630, 0x7b20200a, 0x20200a0d, 0x6f632020, 0x2074736e, 0x616f6c66, 0x66203374, 0x6f746361, 
-    0x203d2072, 0x6e696874, 0x6c69665f, 0x61665f6d, 0x726f7463, 0x74616d28, 0x6972692e, 0x63736564, 0x65636e65, 
-    0x63696854, 0x73656e6b, 0x6d202c73, 0x692e7461, 0x65646972, 0x6e656373, 0x6f496563, 0x6d202c72, 0x692e7461, 
-    0x2c32726f, 0x74616d20, 0x726f692e, 0x6b202c31, 0x0d3b2968, 0x200a0d0a, 0x73202020, 0x63746977, 0x6f6c2868, 
-    0x0d296562, 0x2020200a, 0x0a0d7b20, 0x20202020, 0x61632020, 0x4c206573, 0x5f45424f, 0x43455053, 0x52414c55, 
-    0x4645525f, 0x5443454c, 0x3a4e4f49, 0x20200a0d, 0x20202020, 0x69742020, 0x2a20746e, 0x656c203d, 0x66287072, 
-    0x74616f6c, 0x2e312833, 0x202c2966, 0x74636166, 0x202c726f, 0x2e74616d, 0x64697269, 0x65637365, 0x2965636e, 
-    0x200a0d3b, 0x20202020, 0x62202020, 0x6b616572, 0x0d0a0d3b, 0x2020200a, 0x63202020, 0x20657361, 0x45424f4c, 
-    0x54454d5f, 0x525f4c41, 0x454c4645, 0x4f495443, 0x0a0d3a4e, 0x20202020, 0x20202020, 0x746e6974, 0x6d203d20, 
-    0x725f7869, 0x74286267, 0x2c746e69, 0x74616d20, 0x6570732e, 0x616c7563, 0x6c6f4372, 0x202c726f, 0x74636166, 
-    0x2a20726f, 0x74616d20, 0x6972692e, 0x63736564, 0x65636e65, 0x0a0d3b29, 0x20202020, 0x20202020, 0x61657262, 
-    0x0a0d3b6b, 0x20202020, 0x200a0d7d, 0x0a0d7d20, 0x20200a0d, 0x61746164, 0x6473622e, 0x766f5f66, 0x705f7265, 
-    0x2a206664, 0x6974203d, 0x0d3b746e, 0x0a0d7d0a, 0x2a2f0a0d, 0x2a200a0d, 0x206e4920, 0x65726172, 0x73616320, 
-    0x28207365, 0x6e69616d, 0x6420796c, 0x65707369, 0x6f697372, 0x202c296e, 0x6e206577, 0x20646565, 0x67206f74, 
-    0x61207465, 0x6461206e, 0x69746964, 0x6c616e6f, 0x6e617220, 0x0d6d6f64, 0x202a200a, 0x626d756e, 0x202e7265, 
-    0x73696854, 0x6e756620, 0x6f697463, 0x6174206e, 0x2073656b, 0x61722061, 0x6d6f646e, 0x6d756e20, 0x20726562, 
-    0x20646e61, 0x6c707061, 0x20736569, 0x20656874, 0x68736168, 0x6e756620, 0x6f697463, 0x200a0d6e, 0x7266202a, 
-    0x70206d6f, 0x6f5f6763, 0x75707475, 0x78725f74, 0x5f6d5f73, 0x335f7378, 0x32335f32, 0x206f7420, 0x0d2e7469, 
-    0x202a200a, 0x20737449, 0x6c617571, 0x20797469, 0x6e736168, 0x62207427, 0x206e6565, 0x74736574, 0x61206465, 
-    0x6920646e, 0x20732774, 0x20746f6e, 0x79726576, 0x69727020, 0x7069636e, 0x2c64656c, 0x74756220, 0x27746920, 
-    0x65622073, 0x72657474, 0x2a200a0d, 0x61687420, 0x7375206e, 0x20676e69, 0x61722061, 0x6d6f646e, 0x6d756e20, 
-    0x20726562, 0x74616874, 0x63207327, 0x6572726f, 0x6574616c, 0x69772064, 0x6d206874, 0x72657461, 0x206c6169, 
-    0x706d6173, 0x676e696c, 0x2a0a0d2e, 0x660a0d2f, 0x74616f6c, 0x72657220, 0x6f646e61, 0x657a696d, 0x6f6c6628, 
-    0x76207461, 0x7b0a0d29, 0x20200a0d, 0x746e6975, 0x726f7720, 0x203d2064, 0x69757361, 0x7628746e, 0x0a0d3b29, 
-    0x6f772020, 0x20206472, 0x20202020, 0x2828203d, 0x64726f77, 0x203e3e20, 0x6f772828, 0x3e206472, 0x3832203e, 
-    0x202b2029, 0x20292934, 0x6f77205e, 0x20296472, 0x3732202a, 0x33303837, 0x55373337, 0x200a0d3b, 0x726f7720, 
-    0x20202064, 0x3d202020, 0x6f772820, 0x3e206472, 0x3232203e, 0x205e2029, 0x64726f77, 0x200a0d3b, 0x74657220, 
-    0x206e7275, 0x616f6c66, 0x6f772874, 0x20296472, 0x7361202f, 0x616f6c66, 0x78302874, 0x30386634, 0x30303030, 
-    0x0d3b2955, 0x0a0d7d0a, 0x2a2f0a0d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x230a0d2d, 0x6e754620, 0x6f697463, 0x6360206e, 0x75706d6f, 0x69446574, 0x72657073, 0x49646573, 0x0d60524f, 
-    0x43203e0a, 0x75636c61, 0x6574616c, 0x68742073, 0x4f492065, 0x74612052, 0x67206120, 0x6e657669, 0x76617720, 
-    0x6e656c65, 0x20687467, 0x206e6928, 0x6f6e616e, 0x6574656d, 0x20297372, 0x65766967, 0x6874206e, 0x61622065, 
-    0x49206573, 0x0a0d524f, 0x6e61203e, 0x6c672064, 0x64204654, 0x65707369, 0x6f697372, 0x6166206e, 0x726f7463, 
-    0x0d0a0d2e, 0x6565530a, 0x74746820, 0x2f3a7370, 0x7469672f, 0x2e627568, 0x2f6d6f63, 0x6f72684b, 0x47736f6e, 
-    0x70756f72, 0x546c672f, 0x72742f46, 0x302f6565, 0x63313532, 0x63306335, 0x64386563, 0x36636561, 0x35646239, 
-    0x39326634, 0x31393866, 0x30643365, 0x35626463, 0x2f386332, 0x65747865, 0x6f69736e, 0x322f736e, 0x4b2f302e, 
-    0x6e6f7268, 0x4b2f736f, 0x6d5f5248, 0x72657461, 0x736c6169, 0x7369645f, 0x73726570, 0x2e6e6f69, 0x2d2d0a0d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2a2d2d2d, 0x660a0d2f, 0x74616f6c, 0x6d6f6320, 
-    0x65747570, 0x70736944, 0x65737265, 0x524f4964, 0x6f6c6628, 0x62207461, 0x5f657361, 0x2c726f69, 0x6f6c6620, 
-    0x64207461, 0x65707369, 0x6f697372, 0x66202c6e, 0x74616f6c, 0x76617720, 0x6e656c65, 0x5f687467, 0x0d296d6e, 
-    0x0a0d7b0a, 0x2f2f2020, 0x6e695320, 0x74206563, 0x67206568, 0x2046546c, 0x65747865, 0x6f69736e, 0x7473206e, 
-    0x7365726f, 0x20303220, 0x5f56202f, 0x200a0d64, 0x6f6c6620, 0x61207461, 0x4e656262, 0x65626d75, 0x203d2072, 
-    0x302e3032, 0x202f2046, 0x70736964, 0x69737265, 0x0d3b6e6f, 0x2f20200a, 0x614c202f, 0x65207473, 0x74617571, 
-    0x206e6f69, 0x6820666f, 0x73707474, 0x672f2f3a, 0x75687469, 0x6f632e62, 0x684b2f6d, 0x6f6e6f72, 0x6f724773, 
-    0x672f7075, 0x2f46546c, 0x626f6c62, 0x69616d2f, 0x78652f6e, 0x736e6574, 0x736e6f69, 0x302e322f, 0x72684b2f, 
-    0x736f6e6f, 0x52484b2f, 0x74616d5f, 0x61697265, 0x645f736c, 0x65707369, 0x6f697372, 0x200a0d6e, 0x74657220, 
-    0x206e7275, 0x2878616d, 0x65736162, 0x726f695f, 0x28202b20, 0x65736162, 0x726f695f, 0x31202d20, 0x2946302e, 
-    0x28202a20, 0x36333235, 0x302e3535, 0x202f2046, 0x76617728, 0x6e656c65, 0x5f687467, 0x2a206d6e, 0x76617720, 
-    0x6e656c65, 0x5f687467, 0x20296d6e, 0x2e31202d, 0x38363135, 0x2f202946, 0x62626120, 0x6d754e65, 0x2c726562, 
-    0x302e3120, 0x0d3b2946, 0x0a0d7d0a, 0x2a2f0a0d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x230a0d2d, 0x6e754620, 0x6f697463, 0x7760206e, 0x6c657661, 0x74676e65, 0x526f5468, 0x0d604247, 
-    0x47203e0a, 0x6e657669, 0x77206120, 0x6c657661, 0x74676e65, 0x666f2068, 0x67696c20, 0x202c7468, 0x75746572, 
-    0x20736e72, 0x61206e61, 0x6f727070, 0x616d6978, 0x6e6f6974, 0x206f7420, 0x20656874, 0x656e696c, 0x52207261, 
-    0x0a0d4247, 0x6f63203e, 0x20726f6c, 0x6120666f, 0x35364420, 0x6c6c6920, 0x6e696d75, 0x20746e61, 0x47527328, 
-    0x68772042, 0x70657469, 0x746e696f, 0x61732029, 0x656c706d, 0x74612064, 0x77206120, 0x6c657661, 0x74676e65, 
-    0x666f2068, 0x60786020, 0x203e0a0d, 0x6f6e616e, 0x6574656d, 0x202c7372, 0x6e697375, 0x68742067, 0x49432065, 
-    0x30322045, 0x32203531, 0x6765642d, 0x20656572, 0x6e617453, 0x64726164, 0x73624f20, 0x65767265, 0x6f432072, 
-    0x20726f6c, 0x6374614d, 0x676e6968, 0x6e754620, 0x6f697463, 0x0d2e736e, 0x540a0d0a, 0x20736968, 0x6e207369, 
-    0x616d726f, 0x657a696c, 0x6f732064, 0x61687420, 0x600a0d74, 0x286d7573, 0x65766177, 0x676e656c, 0x6f546874, 
-    0x28424752, 0x202c2969, 0x202c697b, 0x45564157, 0x474e454c, 0x4d5f4854, 0x202c4e49, 0x45564157, 0x474e454c, 
-    0x4d5f4854, 0x297d5841, 0x203d3d20, 0x616f6c66, 0x31283374, 0x2c60292e, 0x68770a0d, 0x20686369, 0x6e61656d, 
-    0x68742073, 0x74207461, 0x76206568, 0x65756c61, 0x74692073, 0x74657220, 0x736e7275, 0x65726120, 0x75737520, 
-    0x796c6c61, 0x776f6c20, 0x6f59202e, 0x6c6c2775, 0x65656e20, 0x6f742064, 0x6c756d20, 0x6c706974, 0x620a0d79, 
-    0x6e612079, 0x70706120, 0x72706f72, 0x65746169, 0x726f6e20, 0x696c616d, 0x6974617a, 0x66206e6f, 0x6f746361, 
-    0x66692072, 0x756f7920, 0x20657227, 0x646e6172, 0x796c6d6f, 0x6d617320, 0x6e696c70, 0x74692067, 0x0d0a0d2e, 
-    0x6568540a, 0x6c6f6320, 0x2073726f, 0x65726568, 0x65726120, 0x616c6320, 0x6465706d, 0x206f7420, 0x796c6e6f, 
-    0x736f7020, 0x76697469, 0x52732065, 0x76204247, 0x65756c61, 0x69202c73, 0x6163206e, 0x72206573, 0x65646e65, 
-    0x73726572, 0x61680a0d, 0x70206576, 0x6c626f72, 0x20736d65, 0x68746977, 0x6c6f6320, 0x2073726f, 0x68746977, 
-    0x67656e20, 0x76697461, 0x52732065, 0x63204247, 0x6f706d6f, 0x746e656e, 0x69282073, 0x202e652e, 0x20657261, 
-    0x696c6176, 0x630a0d64, 0x726f6c6f, 0x75622073, 0x72612074, 0x756f2065, 0x666f2d74, 0x6d61672d, 0x2e297475, 
-    0x2d2d0a0d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2a2d2d2d, 0x230a0d2f, 0x69666564, 
-    0x5720656e, 0x4c455641, 0x54474e45, 0x494d5f48, 0x3933204e, 0x33342e39, 0x38323638, 0x38353035, 0x35363735, 
-    0x230a0d46, 0x69666564, 0x5720656e, 0x4c455641, 0x54474e45, 0x414d5f48, 0x36362058, 0x36362e38, 0x39383731, 
-    0x34333439, 0x46373534, 0x6c660a0d, 0x3374616f, 0x76617720, 0x6e656c65, 0x54687467, 0x4247526f, 0x6f6c6628, 
-    0x78207461, 0x7b0a0d29, 0x20200a0d, 0x54202f2f, 0x20736968, 0x73657375, 0x70206120, 0x65636569, 0x65736977, 
-    0x6e696c2d, 0x20726165, 0x72707061, 0x6d69786f, 0x6f697461, 0x6567206e, 0x6172656e, 0x20646574, 0x6e697375, 
-    0x68742067, 0x49432065, 0x30322045, 0x0a0d3531, 0x2f2f2020, 0x642d3220, 0x65726765, 0x74732065, 0x61646e61, 
-    0x6f206472, 0x72657362, 0x20726576, 0x656d6974, 0x68742073, 0x36442065, 0x6c692035, 0x696d756c, 0x746e616e, 
-    0x696d202c, 0x696d696e, 0x676e697a, 0x65687420, 0x0d324c20, 0x2f20200a, 0x6f6e202f, 0x202c6d72, 0x6e656874, 
-    0x726f6e20, 0x696c616d, 0x2064657a, 0x68206f74, 0x20657661, 0x69206e61, 0x6765746e, 0x206c6172, 0x3120666f, 
-    0x200a0d2e, 0x6f6c6620, 0x20337461, 0x20626772, 0x6c66203d, 0x3374616f, 0x292e3028, 0x200a0d3b, 0x28666920, 
-    0x2e393933, 0x36383334, 0x30353832, 0x37353835, 0x3c203536, 0x0d297820, 0x7b20200a, 0x20200a0d, 0x66692020, 
-    0x3c207828, 0x35333420, 0x3534332e, 0x32353330, 0x35363434, 0x0d293638, 0x2020200a, 0x72202020, 0x722e6267, 
-    0x32203d20, 0x3632362e, 0x37353738, 0x31363734, 0x36343835, 0x302d6534, 0x202a2035, 0x202b2078, 0x302e302d, 
-    0x39343031, 0x36353732, 0x38383534, 0x33373932, 0x0a0d3b32, 0x20202020, 0x65736c65, 0x28666920, 0x203c2078, 
-    0x2e323534, 0x31343737, 0x39303834, 0x36353334, 0x0a0d2937, 0x20202020, 0x67722020, 0x20722e62, 0x352d203d, 
-    0x3338332e, 0x34313736, 0x38383833, 0x32333333, 0x35302d65, 0x78202a20, 0x30202b20, 0x3432302e, 0x37303833, 
-    0x31303336, 0x35323533, 0x3b353231, 0x20200a0d, 0x6c652020, 0x69206573, 0x20782866, 0x3535203c, 0x39352e30, 
-    0x35343931, 0x38393433, 0x29333731, 0x20200a0d, 0x20202020, 0x2e626772, 0x203d2072, 0x35322e31, 0x30323633, 
-    0x30303037, 0x31343138, 0x2d653536, 0x2a203730, 0x2b207820, 0x2e352d20, 0x30373831, 0x35343831, 0x35333932, 
-    0x65333836, 0x3b35302d, 0x20200a0d, 0x6c652020, 0x69206573, 0x20782866, 0x3036203c, 0x36382e30, 0x34343439, 
-    0x31393831, 0x29323232, 0x20200a0d, 0x20202020, 0x2e626772, 0x203d2072, 0x30302e30, 0x38323330, 0x31353234, 
-    0x37333539, 0x20323834, 0x2078202a, 0x302d202b, 0x3038312e, 0x31313138, 0x36303431, 0x36343831, 0x0d3b3434, 
-    0x2020200a, 0x736c6520, 0x66692065, 0x3c207828, 0x38363620, 0x3136362e, 0x39393837, 0x34343334, 0x0d293735, 
-    0x2020200a, 0x72202020, 0x722e6267, 0x2d203d20, 0x30302e30, 0x33343230, 0x32363238, 0x37313730, 0x30303334, 
-    0x202a2039, 0x202b2078, 0x36312e30, 0x37333033, 0x31383632, 0x38323432, 0x3b353439, 0x20200a0d, 0x200a0d7d, 
-    0x28666920, 0x2e373634, 0x32393134, 0x37313234, 0x38313532, 0x3c203533, 0x0d297820, 0x7b20200a, 0x20200a0d, 
-    0x66692020, 0x3c207828, 0x32333520, 0x3239332e, 0x38323937, 0x30343935, 0x0d293634, 0x2020200a, 0x72202020, 
-    0x672e6267, 0x30203d20, 0x3030302e, 0x32313032, 0x39343136, 0x36353433, 0x33333930, 0x202a2034, 0x202b2078, 
-    0x302e302d, 0x37303439, 0x34393433, 0x37393437, 0x3b343635, 0x20200a0d, 0x6c652020, 0x69206573, 0x20782866, 
-    0x3535203c, 0x33352e32, 0x30323231, 0x30353432, 0x29343734, 0x20200a0d, 0x20202020, 0x2e626772, 0x203d2067, 
-    0x332e342d, 0x34383137, 0x32343437, 0x35303939, 0x65343330, 0x2035302d, 0x2078202a, 0x2e30202b, 0x33363330, 
-    0x37303235, 0x37343534, 0x35373736, 0x0a0d3b31, 0x20202020, 0x65736c65, 0x28666920, 0x203c2078, 0x2e353036, 
-    0x34303335, 0x36353336, 0x34373635, 0x0a0d2936, 0x20202020, 0x67722020, 0x20672e62, 0x302d203d, 0x3030302e, 
-    0x31303332, 0x35323132, 0x38373537, 0x36393438, 0x202a2038, 0x202b2078, 0x33312e30, 0x35343339, 0x37313334, 
-    0x33303837, 0x3b353836, 0x20200a0d, 0x200a0d7d, 0x28666920, 0x2e303034, 0x36363836, 0x37323336, 0x38343032, 
-    0x3c203533, 0x0d297820, 0x7b20200a, 0x20200a0d, 0x66692020, 0x3c207828, 0x37343420, 0x3639352e, 0x33383838, 
-    0x38303135, 0x29363634, 0x20200a0d, 0x20202020, 0x2e626772, 0x203d2062, 0x30302e30, 0x35323430, 0x38303931, 
-    0x30383432, 0x37393937, 0x2a203737, 0x2b207820, 0x2e302d20, 0x33303731, 0x39323836, 0x36343832, 0x37363032, 
-    0x200a0d3b, 0x65202020, 0x2065736c, 0x78286669, 0x35203c20, 0x322e3130, 0x30303131, 0x39363037, 0x33323437, 
-    0x200a0d29, 0x20202020, 0x62677220, 0x3d20622e, 0x2e302d20, 0x33303030, 0x32303237, 0x39383035, 0x32393930, 
-    0x34353031, 0x78202a20, 0x30202b20, 0x3638312e, 0x30333634, 0x36353936, 0x35323632, 0x0d3b3339, 0x7d20200a, 
-    0x20200a0d, 0x75746572, 0x72206e72, 0x0d3b6267, 0x0a0d7d0a, 0x0a0d0a0d, 0x45202f2f, 0x756c6176, 0x73657461, 
-    0x65687420, 0x61727420, 0x696d736e, 0x6f697373, 0x6f6c206e, 0x0d2e6562, 0x696f760a, 0x74622064, 0x675f6664, 
-    0x735f7867, 0x6874696d, 0x6176655f, 0x4e49286c, 0x5f54554f, 0x45505954, 0x64734228, 0x61764566, 0x7461756c, 
-    0x74614465, 0x64202961, 0x2c617461, 0x72625020, 0x6574614d, 0x6c616972, 0x74616d20, 0x6c66202c, 0x3374616f, 
-    0x6e697420, 0x0a0d2974, 0x200a0d7b, 0x6f6f6220, 0x7369206c, 0x6e696854, 0x6c6c6157, 0x3d206465, 0x616d2820, 
-    0x73692e74, 0x6e696854, 0x6c6c6157, 0x3b296465, 0x0a0d0a0d, 0x6c662020, 0x3274616f, 0x726f6920, 0x66203d20, 
-    0x74616f6c, 0x616d2832, 0x6f692e74, 0x202c3172, 0x2e74616d, 0x32726f69, 0x0a0d3b29, 0x66692020, 0x74616d28, 
-    0x7369642e, 0x73726570, 0x206e6f69, 0x2e30203e, 0x0d296630, 0x7b20200a, 0x20200a0d, 0x2f2f2020, 0x6e615220, 
-    0x6c6d6f64, 0x68632079, 0x65736f6f, 0x77206120, 0x6c657661, 0x74676e65, 0x66203b68, 0x6e20726f, 0x202c776f, 
-    0x66696e75, 0x6c6d726f, 0x68632079, 0x65736f6f, 0x6f726620, 0x3933206d, 0x36362d39, 0x6d6e2039, 0x200a0d2e, 
-    0x66202020, 0x74616f6c, 0x76617720, 0x6e656c65, 0x20687467, 0x656c203d, 0x57287072, 0x4c455641, 0x54474e45, 
-    0x494d5f48, 0x57202c4e, 0x4c455641, 0x54474e45, 0x414d5f48, 0x72202c58, 0x6e617265, 0x696d6f64, 0x6428657a, 
-    0x2e617461, 0x7a2e6978, 0x0d3b2929, 0x2020200a, 0x726f6920, 0x2020782e, 0x20202020, 0x20202020, 0x203d2020, 
-    0x706d6f63, 0x44657475, 0x65707369, 0x64657372, 0x28524f49, 0x2e726f69, 0x6d202c78, 0x642e7461, 0x65707369, 
-    0x6f697372, 0x77202c6e, 0x6c657661, 0x74676e65, 0x0d3b2968, 0x2020200a, 0x6e697420, 0x3d2a2074, 0x41572820, 
-    0x454c4556, 0x4854474e, 0x58414d5f, 0x57202d20, 0x4c455641, 0x54474e45, 0x494d5f48, 0x2a20294e, 0x76617720, 
-    0x6e656c65, 0x54687467, 0x4247526f, 0x76617728, 0x6e656c65, 0x29687467, 0x200a0d3b, 0x0a0d7d20, 0x20200a0d, 
-    0x736e6f63, 0x6c662074, 0x2074616f, 0x20316b6e, 0x6261203d, 0x6f642873, 0x61642874, 0x6b2e6174, 0x6d202c31, 
-    0x4e2e7461, 0x0d3b2929, 0x6320200a, 0x74736e6f, 0x6f6c6620, 0x6e207461, 0x3d20326b, 0x73626120, 0x746f6428, 
-    0x74616428, 0x326b2e61, 0x616d202c, 0x294e2e74, 0x0a0d3b29, 0x20200a0d, 0x42202f2f, 0x20464452, 0x4220726f, 
-    0x20464454, 0x6c617665, 0x200a0d3f, 0x202f2f20, 0x74206649, 0x69206568, 0x6d6f636e, 0x20676e69, 0x6867696c, 
-    0x69642074, 0x74636572, 0x206e6f69, 0x6f207369, 0x6874206e, 0x61622065, 0x61666b63, 0x0d2e6563, 0x2f20200a, 
-    0x6f44202f, 0x544f4e20, 0x636e6920, 0x6564756c, 0x67646520, 0x6e6f2d65, 0x3d3d2820, 0x302e3020, 0x61202966, 
-    0x61622073, 0x69736b63, 0x68206564, 0x20657265, 0x74206f74, 0x20656b61, 0x20656874, 0x6c666572, 0x69746365, 
-    0x70206e6f, 0x2e687461, 0x20200a0d, 0x736e6f63, 0x6f622074, 0x62206c6f, 0x736b6361, 0x20656469, 0x6428203d, 
-    0x6428746f, 0x2e617461, 0x202c326b, 0x2e74616d, 0x2029674e, 0x2e30203c, 0x3b296630, 0x0a0d0a0d, 0x6f632020, 
-    0x2074736e, 0x616f6c66, 0x68203374, 0x63203d20, 0x75706d6f, 0x685f6574, 0x5f666c61, 0x74636576, 0x6428726f, 
-    0x2e617461, 0x202c316b, 0x61746164, 0x2c326b2e, 0x74616d20, 0x202c4e2e, 0x2c726f69, 0x326b6e20, 0x6162202c, 
-    0x69736b63, 0x202c6564, 0x68547369, 0x61576e69, 0x64656c6c, 0x0a0d3b29, 0x20200a0d, 0x49202f2f, 0x6c61766e, 
-    0x66206469, 0x7220726f, 0x656c6665, 0x6f697463, 0x202f206e, 0x72666572, 0x69746361, 0x0d3f6e6f, 0x6320200a, 
-    0x74736e6f, 0x6f6c6620, 0x6e207461, 0x3d202068, 0x746f6420, 0x74616d28, 0x202c4e2e, 0x0d3b2968, 0x6320200a, 
-    0x74736e6f, 0x6f6c6620, 0x6b207461, 0x3d206831, 0x746f6420, 0x74616428, 0x316b2e61, 0x2968202c, 0x200a0d3b, 
-    0x6e6f6320, 0x66207473, 0x74616f6c, 0x68326b20, 0x64203d20, 0x6428746f, 0x2e617461, 0x202c326b, 0x2a202968, 
-    0x61622820, 0x69736b63, 0x3f206564, 0x2e312d20, 0x3a206630, 0x302e3120, 0x0d3b2966, 0x200a0d0a, 0x202f2f20, 
-    0x20316b6e, 0x20646e61, 0x6d20686e, 0x20747375, 0x20746f6e, 0x30206562, 0x2066302e, 0x7320726f, 0x65746174, 
-    0x6664702e, 0x203d3d20, 0x2e4e614e, 0x20200a0d, 0x6e286669, 0x3c20316b, 0x2e30203d, 0x7c206630, 0x686e207c, 
-    0x203d3c20, 0x66302e30, 0x207c7c20, 0x2068316b, 0x2e30203c, 0x7c206630, 0x326b207c, 0x203c2068, 0x66302e30, 
-    0x200a0d29, 0x0a0d7b20, 0x20202020, 0x61746164, 0x6664702e, 0x20202020, 0x20202020, 0x30203d20, 0x3b66302e, 
-    0x2f2f2020, 0x73626120, 0x0d62726f, 0x2020200a, 0x74616420, 0x73622e61, 0x675f6664, 0x73736f6c, 0x203d2079, 
-    0x616f6c66, 0x30283374, 0x2966302e, 0x200a0d3b, 0x72202020, 0x72757465, 0x0a0d3b6e, 0x0d7d2020, 0x200a0d0a, 
-    0x6f6c6620, 0x66207461, 0x0a0d3b72, 0x20200a0d, 0x21286669, 0x6b636162, 0x65646973, 0x200a0d29, 0x0a0d7b20, 
-    0x20202020, 0x46202f2f, 0x7320726f, 0x74746163, 0x745f7265, 0x736e6172, 0x3a74696d, 0x6c6e4f20, 0x6c612079, 
-    0x20776f6c, 0x20524954, 0x68746977, 0x44524220, 0x76652046, 0x0d2e6c61, 0x2020200a, 0x28666920, 0x54736921, 
-    0x69285249, 0x202c726f, 0x2968316b, 0x200a0d29, 0x7b202020, 0x20200a0d, 0x20202020, 0x61746164, 0x6664702e, 
-    0x20202020, 0x20202020, 0x30203d20, 0x3b66302e, 0x2f2f2020, 0x73626120, 0x0d62726f, 0x2020200a, 0x64202020, 
-    0x2e617461, 0x66647362, 0x6f6c675f, 0x20797373, 0x6c66203d, 0x3374616f, 0x302e3028, 0x0d3b2966, 0x2020200a, 
-    0x72202020, 0x72757465, 0x0a0d3b6e, 0x20202020, 0x200a0d7d, 0x65202020, 0x0d65736c, 0x2020200a, 0x0a0d7b20, 
-    0x20202020, 0x72662020, 0x31203d20, 0x3b66302e, 0x20200a0d, 0x0d7d2020, 0x7d20200a, 0x20200a0d, 0x65736c65, 
-    0x20200a0d, 0x200a0d7b, 0x66202020, 0x203d2072, 0x66302e30, 0x200a0d3b, 0x0a0d7d20, 0x20200a0d, 0x43202f2f, 
-    0x75706d6f, 0x42206574, 0x20464453, 0x20646e61, 0x0d666470, 0x6320200a, 0x74736e6f, 0x6f6c6620, 0x20337461, 
-    0x3d203068, 0x6f6c6620, 0x28337461, 0x28746f64, 0x2e74616d, 0x68202c54, 0x64202c29, 0x6d28746f, 0x422e7461, 
-    0x2968202c, 0x686e202c, 0x0a0d3b29, 0x61642020, 0x702e6174, 0x20206664, 0x20202020, 0x203d2020, 0x5f647668, 
-    0x5f786767, 0x6c617665, 0x302e3128, 0x202f2066, 0x2e74616d, 0x67756f72, 0x73656e68, 0x68202c73, 0x0d3b2930, 
-    0x200a0d0a, 0x6f6c6620, 0x47207461, 0x0a0d3b31, 0x6c662020, 0x2074616f, 0x0d3b3247, 0x6620200a, 0x74616f6c, 
-    0x32314720, 0x67203d20, 0x735f7867, 0x6874696d, 0x6168735f, 0x5f776f64, 0x6b73616d, 0x2c314728, 0x2c324720, 
-    0x6f6c6620, 0x28337461, 0x28746f64, 0x2e74616d, 0x64202c54, 0x2e617461, 0x2c29316b, 0x746f6420, 0x74616d28, 
-    0x202c422e, 0x61746164, 0x29316b2e, 0x6b6e202c, 0x0d2c2931, 0x2020200a, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x6f6c6620, 0x28337461, 0x28746f64, 0x2e74616d, 
-    0x64202c54, 0x2e617461, 0x2c29326b, 0x746f6420, 0x74616d28, 0x202c422e, 0x61746164, 0x29326b2e, 0x6b6e202c, 
-    0x202c2932, 0x2e74616d, 0x67756f72, 0x73656e68, 0x0d3b2973, 0x200a0d0a, 0x28666920, 0x54736921, 0x576e6968, 
-    0x656c6c61, 0x26262064, 0x63616220, 0x6469736b, 0x20202965, 0x52202f2f, 0x61726665, 0x6f697463, 0x0a0d3f6e, 
-    0x0d7b2020, 0x2020200a, 0x202f2f20, 0x72666552, 0x69746361, 0x70206e6f, 0x61206664, 0x4220646e, 0x0d464454, 
-    0x2020200a, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x706d7420, 0x6b203d20, 0x2a206831, 0x726f6920, 0x2d20782e, 
-    0x68326b20, 0x69202a20, 0x792e726f, 0x0d0a0d3b, 0x2020200a, 0x74616420, 0x64702e61, 0x3d2a2066, 0x68316b20, 
-    0x6b202a20, 0x2f206832, 0x6b6e2820, 0x202a2031, 0x2a20686e, 0x706d7420, 0x74202a20, 0x3b29706d, 0x20200a0d, 
-    0x200a0d7d, 0x736c6520, 0x200a0d65, 0x0a0d7b20, 0x20202020, 0x52202f2f, 0x656c6665, 0x6f697463, 0x6470206e, 
-    0x6e612066, 0x52422064, 0x28204644, 0x20646e61, 0x75657370, 0x422d6f64, 0x20464454, 0x20726f66, 0x6e696874, 
-    0x6c61772d, 0x2964656c, 0x20200a0d, 0x61642020, 0x702e6174, 0x2a206664, 0x2e30203d, 0x20663532, 0x6e28202f, 
-    0x2a20316b, 0x29686e20, 0x200a0d3b, 0x0a0d7d20, 0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x626f7270, 
-    0x28203d20, 0x6b636162, 0x65646973, 0x203f2029, 0x66302e31, 0x66202d20, 0x203a2072, 0x0d3b7266, 0x200a0d0a, 
-    0x6e6f6320, 0x66207473, 0x74616f6c, 0x73622033, 0x3d206664, 0x6f6c6620, 0x28337461, 0x626f7270, 0x47202a20, 
-    0x2a203231, 0x74616420, 0x64702e61, 0x0d3b2966, 0x200a0d0a, 0x74616420, 0x64702e61, 0x3d2a2066, 0x6f727020, 
-    0x202a2062, 0x0d3b3147, 0x200a0d0a, 0x202f2f20, 0x6c617665, 0x74756f20, 0x3a747570, 0x6c672820, 0x7973736f, 
-    0x72617020, 0x666f2074, 0x65687420, 0x73622029, 0x2a206664, 0x746f6420, 0x2c326b28, 0x726f6e20, 0x296c616d, 
-    0x20200a0d, 0x61746164, 0x6473622e, 0x6c675f66, 0x7973736f, 0x62203d20, 0x20666473, 0x6974202a, 0x0d3b746e, 
-    0x0a0d7d0a, 0x0a0d0a0d, 0x53202f2f, 0x6c706d61, 0x74207365, 0x74206568, 0x736e6172, 0x7373696d, 0x206e6f69, 
-    0x65626f6c, 0x760a0d2e, 0x2064696f, 0x66647462, 0x7867675f, 0x696d735f, 0x735f6874, 0x6c706d61, 0x4e492865, 
-    0x5f54554f, 0x45505954, 0x64734228, 0x6d615366, 0x44656c70, 0x29617461, 0x74616420, 0x50202c61, 0x614d7262, 
-    0x69726574, 0x6d206c61, 0x202c7461, 0x616f6c66, 0x74203374, 0x29746e69, 0x0d7b0a0d, 0x6220200a, 0x206c6f6f, 
-    0x68547369, 0x61576e69, 0x64656c6c, 0x28203d20, 0x2e74616d, 0x68547369, 0x61576e69, 0x64656c6c, 0x0a0d3b29, 
-    0x20200a0d, 0x57202f2f, 0x206e6568, 0x20656874, 0x706d6173, 0x676e696c, 0x74657220, 0x736e7275, 0x65766520, 
-    0x7954746e, 0x3d206570, 0x44534220, 0x56455f46, 0x5f544e45, 0x4f534241, 0x202c4252, 0x20656874, 0x68746170, 
-    0x646e6520, 0x6e692073, 0x65646973, 0x65687420, 0x79617220, 0x6e656720, 0x74617265, 0x206e6f69, 0x676f7270, 
-    0x2e6d6172, 0x20200a0d, 0x4d202f2f, 0x20656b61, 0x65727573, 0x65687420, 0x74657220, 0x656e7275, 0x61762064, 
-    0x7365756c, 0x65726120, 0x6c617620, 0x6e206469, 0x65626d75, 0x77207372, 0x206e6568, 0x696e616d, 0x616c7570, 
-    0x676e6974, 0x65687420, 0x44525020, 0x200a0d2e, 0x74616420, 0x73622e61, 0x6f5f6664, 0x5f726576, 0x20666470, 
-    0x6c66203d, 0x3374616f, 0x302e3028, 0x0d3b2966, 0x6420200a, 0x2e617461, 0x20666470, 0x20202020, 0x20202020, 
-    0x203d2020, 0x66302e30, 0x0d0a0d3b, 0x6620200a, 0x74616f6c, 0x6f692032, 0x203d2072, 0x616f6c66, 0x6d283274, 
-    0x692e7461, 0x2c31726f, 0x74616d20, 0x726f692e, 0x0d3b2932, 0x6920200a, 0x616d2866, 0x69642e74, 0x72657073, 
-    0x6e6f6973, 0x30203e20, 0x2966302e, 0x20200a0d, 0x200a0d7b, 0x2f202020, 0x6152202f, 0x6d6f646e, 0x6320796c, 
-    0x736f6f68, 0x20612065, 0x65766177, 0x676e656c, 0x203b6874, 0x20726f66, 0x2c776f6e, 0x696e7520, 0x6d726f66, 
-    0x6320796c, 0x736f6f68, 0x72662065, 0x33206d6f, 0x372d3136, 0x6e203631, 0x0a0d2e6d, 0x20202020, 0x616f6c66, 
-    0x61772074, 0x656c6576, 0x6874676e, 0x6c203d20, 0x28707265, 0x45564157, 0x474e454c, 0x4d5f4854, 0x202c4e49, 
-    0x45564157, 0x474e454c, 0x4d5f4854, 0x202c5841, 0x61726572, 0x6d6f646e, 0x28657a69, 0x61746164, 0x2e69782e, 
-    0x3b29297a, 0x20200a0d, 0x6f692020, 0x20782e72, 0x20202020, 0x20202020, 0x3d202020, 0x6d6f6320, 0x65747570, 
-    0x70736944, 0x65737265, 0x524f4964, 0x726f6928, 0x202c782e, 0x2e74616d, 0x70736964, 0x69737265, 0x202c6e6f, 
-    0x65766177, 0x676e656c, 0x3b296874, 0x20200a0d, 0x69742020, 0x2a20746e, 0x5728203d, 0x4c455641, 0x54474e45, 
-    0x414d5f48, 0x202d2058, 0x45564157, 0x474e454c, 0x4d5f4854, 0x20294e49, 0x6177202a, 0x656c6576, 0x6874676e, 
-    0x47526f54, 0x61772842, 0x656c6576, 0x6874676e, 0x0a0d3b29, 0x0d7d2020, 0x200a0d0a, 0x6e6f6320, 0x66207473, 
-    0x74616f6c, 0x316b6e20, 0x61203d20, 0x64287362, 0x6428746f, 0x2e617461, 0x202c316b, 0x2e74616d, 0x3b29294e, 
-    0x0a0d0a0d, 0x6f632020, 0x2074736e, 0x616f6c66, 0x6b203374, 0x3d203031, 0x6f6c6620, 0x28337461, 0x28746f64, 
-    0x61746164, 0x2c316b2e, 0x74616d20, 0x2c29542e, 0x746f6420, 0x74616428, 0x316b2e61, 0x616d202c, 0x29422e74, 
-    0x6b6e202c, 0x0d3b2931, 0x200a0d0a, 0x202f2f20, 0x706d6153, 0x6820656c, 0x2d666c61, 0x74636576, 0x202c726f, 
-    0x7263696d, 0x6361666f, 0x6e207465, 0x616d726f, 0x0a0d2e6c, 0x6f632020, 0x2074736e, 0x616f6c66, 0x68203374, 
-    0x203d2030, 0x5f647668, 0x5f786767, 0x706d6173, 0x765f656c, 0x2866646e, 0x2c30316b, 0x74616d20, 0x756f722e, 
-    0x656e6867, 0x202c7373, 0x61746164, 0x2e69782e, 0x3b297978, 0x0a0d0a0d, 0x66692020, 0x73626128, 0x2e306828, 
-    0x3d20297a, 0x2e30203d, 0x0d296630, 0x7b20200a, 0x20200a0d, 0x61642020, 0x652e6174, 0x746e6576, 0x7079745f, 
-    0x203d2065, 0x46445342, 0x4556455f, 0x415f544e, 0x524f5342, 0x0a0d3b42, 0x20202020, 0x75746572, 0x0d3b6e72, 
-    0x7d20200a, 0x0a0d0a0d, 0x2f2f2020, 0x61725420, 0x6f66736e, 0x74206d72, 0x6f77206f, 0x0d646c72, 0x6320200a, 
-    0x74736e6f, 0x6f6c6620, 0x20337461, 0x203d2068, 0x782e3068, 0x6d202a20, 0x542e7461, 0x68202b20, 0x20792e30, 
-    0x616d202a, 0x20422e74, 0x3068202b, 0x2a207a2e, 0x74616d20, 0x0d3b4e2e, 0x200a0d0a, 0x6e6f6320, 0x66207473, 
-    0x74616f6c, 0x20686b20, 0x6f64203d, 0x61642874, 0x6b2e6174, 0x68202c31, 0x0a0d3b29, 0x20200a0d, 0x6b286669, 
-    0x3d3c2068, 0x302e3020, 0x0a0d2966, 0x0d7b2020, 0x2020200a, 0x74616420, 0x76652e61, 0x5f746e65, 0x65707974, 
-    0x42203d20, 0x5f464453, 0x4e455645, 0x42415f54, 0x42524f53, 0x200a0d3b, 0x72202020, 0x72757465, 0x0a0d3b6e, 
-    0x0d7d2020, 0x200a0d0a, 0x202f2f20, 0x65736143, 0x61637320, 0x72657474, 0x6172745f, 0x696d736e, 0x200a0d74, 
-    0x6f6f6220, 0x6974206c, 0x203d2072, 0x736c6166, 0x0a0d3b65, 0x66692020, 0x54736928, 0x576e6968, 0x656c6c61, 
-    0x20202964, 0x4e202f2f, 0x6572206f, 0x63617266, 0x6e6f6974, 0x200a0d21, 0x0a0d7b20, 0x20202020, 0x70202f2f, 
-    0x64756573, 0x54422d6f, 0x203a4644, 0x70696c66, 0x72206120, 0x656c6665, 0x64657463, 0x66657220, 0x7463656c, 
-    0x206e6f69, 0x65726964, 0x6f697463, 0x6f74206e, 0x65687420, 0x63616220, 0x6973206b, 0x0a0d6564, 0x20202020, 
-    0x61746164, 0x20326b2e, 0x3228203d, 0x2066302e, 0x686b202a, 0x202a2029, 0x202d2068, 0x61746164, 0x3b316b2e, 
-    0x20200a0d, 0x61642020, 0x6b2e6174, 0x203d2032, 0x6d726f6e, 0x7a696c61, 0x61642865, 0x6b2e6174, 0x202d2032, 
-    0x66302e32, 0x6d202a20, 0x4e2e7461, 0x64202a20, 0x6428746f, 0x2e617461, 0x202c326b, 0x2e74616d, 0x3b29294e, 
-    0x20200a0d, 0x200a0d7d, 0x736c6520, 0x200a0d65, 0x0a0d7b20, 0x20202020, 0x42202f2f, 0x3a464454, 0x66657220, 
-    0x74636172, 0x20200a0d, 0x61642020, 0x6b2e6174, 0x203d2032, 0x72666572, 0x28746361, 0x61746164, 0x2c316b2e, 
-    0x202c6820, 0x2e726f69, 0x202f2078, 0x2e726f69, 0x6b202c79, 0x74202c68, 0x3b297269, 0x20200a0d, 0x0d0a0d7d, 
-    0x6420200a, 0x2e617461, 0x66647362, 0x65766f5f, 0x64705f72, 0x203d2066, 0x616f6c66, 0x31283374, 0x2966302e, 
-    0x2f20203b, 0x6157202f, 0x28203a73, 0x616f6c66, 0x31283374, 0x2966302e, 0x66202d20, 0x2f202972, 0x6f727020, 
-    0x2f203b62, 0x4550202f, 0x41204652, 0x7961776c, 0x68772073, 0x20657469, 0x68746977, 0x65687420, 0x69726f20, 
-    0x616e6967, 0x6573206c, 0x2e707574, 0x20200a0d, 0x61746164, 0x6576652e, 0x745f746e, 0x20657079, 0x3d202020, 
-    0x69742820, 0x3f202972, 0x44534220, 0x56455f46, 0x5f544e45, 0x534f4c47, 0x525f5953, 0x454c4645, 0x4f495443, 
-    0x203a204e, 0x46445342, 0x4556455f, 0x475f544e, 0x53534f4c, 0x52545f59, 0x4d534e41, 0x49535349, 0x0d3b4e4f, 
-    0x200a0d0a, 0x202f2f20, 0x63656843, 0x6669206b, 0x65687420, 0x73657220, 0x69746c75, 0x6420676e, 0x63657269, 
-    0x6e6f6974, 0x20736920, 0x74206e6f, 0x63206568, 0x6572726f, 0x73207463, 0x20656469, 0x7420666f, 0x61206568, 
-    0x61757463, 0x6567206c, 0x74656d6f, 0x0a0d7972, 0x6f632020, 0x2074736e, 0x616f6c66, 0x6e672074, 0x3d20326b, 
-    0x746f6420, 0x74616428, 0x326b2e61, 0x616d202c, 0x674e2e74, 0x202a2029, 0x61642828, 0x652e6174, 0x746e6576, 
-    0x7079745f, 0x3d3d2065, 0x44534220, 0x56455f46, 0x5f544e45, 0x534f4c47, 0x525f5953, 0x454c4645, 0x4f495443, 
-    0x3f20294e, 0x302e3120, 0x203a2066, 0x302e312d, 0x0d3b2966, 0x200a0d0a, 0x28666920, 0x326b6e67, 0x203d3c20, 
-    0x66302e30, 0x207c7c20, 0x616e7369, 0x6164286e, 0x6b2e6174, 0x29782e32, 0x200a0d29, 0x0a0d7b20, 0x20202020, 
-    0x61746164, 0x6576652e, 0x745f746e, 0x20657079, 0x5342203d, 0x455f4644, 0x544e4556, 0x5342415f, 0x3b42524f, 
-    0x20200a0d, 0x65722020, 0x6e727574, 0x200a0d3b, 0x0a0d7d20, 0x0a0d0a0d, 0x6f632020, 0x2074736e, 0x616f6c66, 
-    0x6b6e2074, 0x203d2032, 0x28736261, 0x28746f64, 0x61746164, 0x2c326b2e, 0x74616d20, 0x29294e2e, 0x200a0d3b, 
-    0x6e6f6320, 0x66207473, 0x74616f6c, 0x68326b20, 0x61203d20, 0x64287362, 0x6428746f, 0x2e617461, 0x202c326b, 
-    0x3b292968, 0x0a0d0a0d, 0x6c662020, 0x2074616f, 0x0d3b3147, 0x6620200a, 0x74616f6c, 0x3b324720, 0x20200a0d, 
-    0x616f6c66, 0x31472074, 0x203d2032, 0x5f786767, 0x74696d73, 0x68735f68, 0x776f6461, 0x73616d5f, 0x3147286b, 
-    0x3247202c, 0x316b202c, 0x66202c30, 0x74616f6c, 0x6f642833, 0x61642874, 0x6b2e6174, 0x6d202c32, 0x542e7461, 
-    0x64202c29, 0x6428746f, 0x2e617461, 0x202c326b, 0x2e74616d, 0x202c2942, 0x29326b6e, 0x616d202c, 0x6f722e74, 
-    0x6e686775, 0x29737365, 0x0d0a0d3b, 0x6920200a, 0x31472866, 0x3d3c2032, 0x302e3020, 0x0a0d2966, 0x0d7b2020, 
-    0x2020200a, 0x74616420, 0x76652e61, 0x5f746e65, 0x65707974, 0x42203d20, 0x5f464453, 0x4e455645, 0x42415f54, 
-    0x42524f53, 0x200a0d3b, 0x72202020, 0x72757465, 0x0a0d3b6e, 0x0d7d2020, 0x200a0d0a, 0x74616420, 0x73622e61, 
-    0x6f5f6664, 0x5f726576, 0x20666470, 0x47203d2a, 0x0a0d3b32, 0x20200a0d, 0x43202f2f, 0x75706d6f, 0x70206574, 
-    0x0a0d6664, 0x61642020, 0x702e6174, 0x3d206664, 0x64766820, 0x7867675f, 0x6176655f, 0x2e31286c, 0x2f206630, 
-    0x74616d20, 0x756f722e, 0x656e6867, 0x202c7373, 0x20293068, 0x3147202a, 0x2f20203b, 0x202a202f, 0x626f7270, 
-    0x0d0a0d3b, 0x200a0d0a, 0x28666920, 0x54736921, 0x576e6968, 0x656c6c61, 0x26262064, 0x61642820, 0x652e6174, 
-    0x746e6576, 0x7079745f, 0x3d3d2065, 0x44534220, 0x56455f46, 0x5f544e45, 0x534f4c47, 0x545f5953, 0x534e4152, 
-    0x5353494d, 0x294e4f49, 0x2f202029, 0x6669202f, 0x65722820, 0x63617266, 0x6e6f6974, 0x200a0d29, 0x0a0d7b20, 
-    0x20202020, 0x736e6f63, 0x6c662074, 0x2074616f, 0x20706d74, 0x686b203d, 0x69202a20, 0x782e726f, 0x6b202d20, 
-    0x2a206832, 0x726f6920, 0x0d3b792e, 0x2020200a, 0x28666920, 0x20706d74, 0x2930203e, 0x20200a0d, 0x0d7b2020, 
-    0x2020200a, 0x64202020, 0x2e617461, 0x20666470, 0x6b203d2a, 0x202a2068, 0x2068326b, 0x6e28202f, 0x2a20316b, 
-    0x2e306820, 0x202a207a, 0x20706d74, 0x6d74202a, 0x0d3b2970, 0x2020200a, 0x0a0d7d20, 0x0d7d2020, 0x6520200a, 
-    0x0d65736c, 0x7b20200a, 0x20200a0d, 0x61642020, 0x702e6174, 0x2a206664, 0x2e30203d, 0x20663532, 0x6e28202f, 
-    0x2a20316b, 0x2e306820, 0x0d3b297a, 0x7d20200a, 0x0a0d0a0d, 0x61642020, 0x622e6174, 0x5f666473, 0x7265766f, 
-    0x6664705f, 0x203d2a20, 0x746e6974, 0x7d0a0d3b, 0x0a0d0a0d, 0x2f2f0a0d, 0x61764520, 0x7461756c, 0x74207365, 
-    0x73206568, 0x6e656568, 0x626f6c20, 0x0a0d2e65, 0x64696f76, 0x64726220, 0x68735f66, 0x5f6e6565, 0x6c617665, 
-    0x4f4e4928, 0x545f5455, 0x28455059, 0x66647342, 0x6c617645, 0x65746175, 0x61746144, 0x61642029, 0x202c6174, 
-    0x4d726250, 0x72657461, 0x206c6169, 0x2974616d, 0x0d7b0a0d, 0x2f20200a, 0x5242202f, 0x6f204644, 0x54422072, 
-    0x65204644, 0x3f6c6176, 0x20200a0d, 0x49202f2f, 0x68742066, 0x6e692065, 0x696d6f63, 0x6c20676e, 0x74686769, 
-    0x72696420, 0x69746365, 0x69206e6f, 0x6e6f2073, 0x65687420, 0x63616220, 0x6361666b, 0x0a0d2e65, 0x2f2f2020, 
-    0x636e4920, 0x6564756c, 0x67646520, 0x6e6f2d65, 0x3d3d2820, 0x302e3020, 0x61202966, 0x6e222073, 0x696c206f, 
-    0x22746867, 0x73616320, 0x0a0d2e65, 0x6f632020, 0x2074736e, 0x6c6f6f62, 0x63616220, 0x6469736b, 0x203d2065, 
-    0x746f6428, 0x74616428, 0x326b2e61, 0x616d202c, 0x674e2e74, 0x3d3c2029, 0x302e3020, 0x0d3b2966, 0x2f20200a, 
-    0x6f4e202f, 0x6e696874, 0x6f742067, 0x61766520, 0x7461756c, 0x6f662065, 0x69672072, 0x206e6576, 0x65726964, 
-    0x6f697463, 0x0d3f736e, 0x6920200a, 0x61622866, 0x69736b63, 0x20296564, 0x202f2f20, 0x73202626, 0x74746163, 
-    0x725f7265, 0x656c6665, 0x0a0d7463, 0x0d7b2020, 0x2020200a, 0x74657220, 0x3b6e7275, 0x2f2f2020, 0x73626120, 
-    0x0d62726f, 0x7d20200a, 0x0a0d0a0d, 0x6f632020, 0x2074736e, 0x616f6c66, 0x6b6e2074, 0x203d2031, 0x28736261, 
-    0x28746f64, 0x61746164, 0x2c316b2e, 0x74616d20, 0x29294e2e, 0x200a0d3b, 0x6e6f6320, 0x66207473, 0x74616f6c, 
-    0x326b6e20, 0x61203d20, 0x64287362, 0x6428746f, 0x2e617461, 0x202c326b, 0x2e74616d, 0x3b29294e, 0x0a0d0a0d, 
-    0x2f2f2020, 0x6d6f6320, 0x65747570, 0x6c61685f, 0x65765f66, 0x726f7463, 0x66202928, 0x7320726f, 0x74746163, 
-    0x725f7265, 0x656c6665, 0x0d2e7463, 0x6320200a, 0x74736e6f, 0x6f6c6620, 0x20337461, 0x203d2068, 0x6d726f6e, 
-    0x7a696c61, 0x61642865, 0x6b2e6174, 0x202b2031, 0x61746164, 0x29326b2e, 0x0d0a0d3b, 0x2f20200a, 0x6e49202f, 
-    0x696c6176, 0x6f662064, 0x65722072, 0x63656c66, 0x6e6f6974, 0x72202f20, 0x61726665, 0x6f697463, 0x0a0d3f6e, 
-    0x6f632020, 0x2074736e, 0x616f6c66, 0x686e2074, 0x203d2020, 0x28746f64, 0x2e74616d, 0x68202c4e, 0x0a0d3b29, 
-    0x6f632020, 0x2074736e, 0x616f6c66, 0x316b2074, 0x203d2068, 0x28746f64, 0x61746164, 0x2c316b2e, 0x3b296820, 
-    0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x2068326b, 0x6f64203d, 0x61642874, 0x6b2e6174, 0x68202c32, 
-    0x0a0d3b29, 0x20200a0d, 0x6e202f2f, 0x6120316b, 0x6e20646e, 0x756d2068, 0x6e207473, 0x6220746f, 0x2e302065, 
-    0x6f206630, 0x74732072, 0x2e657461, 0x20666470, 0x4e203d3d, 0x0d2e4e61, 0x6920200a, 0x6b6e2866, 0x3d3c2031, 
-    0x302e3020, 0x7c7c2066, 0x20686e20, 0x30203d3c, 0x2066302e, 0x6b207c7c, 0x3c206831, 0x302e3020, 0x7c7c2066, 
-    0x68326b20, 0x30203c20, 0x2966302e, 0x20200a0d, 0x200a0d7b, 0x72202020, 0x72757465, 0x20203b6e, 0x61202f2f, 
-    0x726f7362, 0x200a0d62, 0x0a0d7d20, 0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x52766e69, 0x6867756f, 
-    0x7373656e, 0x31203d20, 0x2066302e, 0x6d28202f, 0x732e7461, 0x6e656568, 0x67756f52, 0x73656e68, 0x202a2073, 
-    0x2e74616d, 0x65656873, 0x756f526e, 0x656e6867, 0x3b297373, 0x2f2f2020, 0x72655020, 0x74706563, 0x206c6175, 
-    0x67756f72, 0x73656e68, 0x6f742073, 0x706c6120, 0x47206168, 0x0d0a0d2e, 0x2f20200a, 0x6f43202f, 0x7475706d, 
-    0x53422065, 0x61204644, 0x7020646e, 0x0a0d6664, 0x6f632020, 0x2074736e, 0x616f6c66, 0x68203374, 0x203d2030, 
-    0x616f6c66, 0x64283374, 0x6d28746f, 0x542e7461, 0x2968202c, 0x6f64202c, 0x616d2874, 0x2c422e74, 0x2c296820, 
-    0x29686e20, 0x0d0a0d3b, 0x6420200a, 0x2e617461, 0x20666470, 0x7668203d, 0x68735f64, 0x5f6e6565, 0x6c617665, 
-    0x766e6928, 0x67756f52, 0x73656e68, 0x68202c73, 0x297a2e30, 0x0d0a0d3b, 0x6620200a, 0x74616f6c, 0x3b314720, 
-    0x20200a0d, 0x616f6c66, 0x32472074, 0x0d0a0d3b, 0x6320200a, 0x74736e6f, 0x6f6c6620, 0x47207461, 0x3d203231, 
-    0x61637620, 0x69746976, 0x735f7365, 0x6f646168, 0x616d5f77, 0x47286b73, 0x47202c31, 0x68202c32, 0x2c7a2e30, 
-    0x6f6c6620, 0x28337461, 0x28746f64, 0x2e74616d, 0x64202c54, 0x2e617461, 0x2c29316b, 0x746f6420, 0x74616d28, 
-    0x202c422e, 0x61746164, 0x29316b2e, 0x6b6e202c, 0x202c2931, 0x2c68316b, 0x20200a0d, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x616f6c66, 
-    0x64283374, 0x6d28746f, 0x542e7461, 0x6164202c, 0x6b2e6174, 0x202c2932, 0x28746f64, 0x2e74616d, 0x64202c42, 
-    0x2e617461, 0x2c29326b, 0x326b6e20, 0x6b202c29, 0x3b296832, 0x20200a0d, 0x61746164, 0x6664702e, 0x203d2a20, 
-    0x35322e30, 0x202f2066, 0x316b6e28, 0x6e202a20, 0x0d3b2968, 0x200a0d0a, 0x6e6f6320, 0x66207473, 0x74616f6c, 
-    0x73622033, 0x3d206664, 0x6f6c6620, 0x28337461, 0x20323147, 0x6164202a, 0x702e6174, 0x3b296664, 0x0a0d0a0d, 
-    0x61642020, 0x702e6174, 0x2a206664, 0x3147203d, 0x0d0a0d3b, 0x2f20200a, 0x7665202f, 0x6f206c61, 0x75707475, 
-    0x28203a74, 0x736f6c67, 0x70207973, 0x20747261, 0x7420666f, 0x20296568, 0x66647362, 0x64202a20, 0x6b28746f, 
-    0x6e202c32, 0x616d726f, 0x0a0d296c, 0x61642020, 0x622e6174, 0x5f666473, 0x736f6c67, 0x3d207973, 0x64736220, 
-    0x202a2066, 0x2e74616d, 0x65656873, 0x6c6f436e, 0x0d3b726f, 0x0a0d7d0a, 0x0a0d0a0d, 0x53202f2f, 0x6c706d61, 
-    0x74207365, 0x73206568, 0x6e656568, 0x626f6c20, 0x0a0d2e65, 0x64696f76, 0x64726220, 0x68735f66, 0x5f6e6565, 
-    0x706d6173, 0x4928656c, 0x54554f4e, 0x5059545f, 0x73422845, 0x61536664, 0x656c706d, 0x61746144, 0x61642029, 
-    0x202c6174, 0x4d726250, 0x72657461, 0x206c6169, 0x2974616d, 0x0d7b0a0d, 0x2f20200a, 0x6857202f, 0x74206e65, 
-    0x73206568, 0x6c706d61, 0x20676e69, 0x75746572, 0x20736e72, 0x6e657665, 0x70795474, 0x203d2065, 0x46445342, 
-    0x4556455f, 0x415f544e, 0x524f5342, 0x74202c42, 0x70206568, 0x20687461, 0x73646e65, 0x736e6920, 0x20656469, 
-    0x20656874, 0x20796172, 0x656e6567, 0x69746172, 0x70206e6f, 0x72676f72, 0x0d2e6d61, 0x2f20200a, 0x614d202f, 
-    0x7320656b, 0x20657275, 0x20656874, 0x75746572, 0x64656e72, 0x6c617620, 0x20736575, 0x20657261, 0x696c6176, 
-    0x756e2064, 0x7265626d, 0x68772073, 0x6d206e65, 0x70696e61, 0x74616c75, 0x20676e69, 0x20656874, 0x2e445250, 
-    0x20200a0d, 0x61746164, 0x6473622e, 0x766f5f66, 0x705f7265, 0x3d206664, 0x6f6c6620, 0x28337461, 0x66302e30, 
-    0x0a0d3b29, 0x61642020, 0x702e6174, 0x20206664, 0x20202020, 0x20202020, 0x30203d20, 0x3b66302e, 0x0a0d0a0d, 
-    0x6f632020, 0x2074736e, 0x616f6c66, 0x6e692074, 0x756f5276, 0x656e6867, 0x3d207373, 0x302e3120, 0x202f2066, 
-    0x74616d28, 0x6568732e, 0x6f526e65, 0x6e686775, 0x20737365, 0x616d202a, 0x68732e74, 0x526e6565, 0x6867756f, 
-    0x7373656e, 0x20203b29, 0x50202f2f, 0x65637265, 0x61757470, 0x6f72206c, 0x6e686775, 0x20737365, 0x61206f74, 
-    0x6168706c, 0x0d2e4720, 0x200a0d0a, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x316b6e20, 0x61203d20, 0x64287362, 
-    0x6428746f, 0x2e617461, 0x202c316b, 0x2e74616d, 0x3b29294e, 0x0a0d0a0d, 0x6f632020, 0x2074736e, 0x616f6c66, 
-    0x6b203374, 0x3d203031, 0x6f6c6620, 0x28337461, 0x28746f64, 0x61746164, 0x2c316b2e, 0x74616d20, 0x2c29542e, 
-    0x746f6420, 0x74616428, 0x316b2e61, 0x616d202c, 0x29422e74, 0x6b6e202c, 0x0d3b2931, 0x200a0d0a, 0x6f6c6620, 
-    0x20207461, 0x20202020, 0x69782020, 0x70696c46, 0x64203d20, 0x2e617461, 0x7a2e6978, 0x200a0d3b, 0x6e6f6320, 
-    0x66207473, 0x74616f6c, 0x30682033, 0x20202020, 0x66203d20, 0x2870696c, 0x5f647668, 0x65656873, 0x61735f6e, 
-    0x656c706d, 0x74616428, 0x69782e61, 0x2c79782e, 0x766e6920, 0x67756f52, 0x73656e68, 0x202c2973, 0x2c30316b, 
-    0x46697820, 0x2970696c, 0x0d0a0d3b, 0x6920200a, 0x62612866, 0x30682873, 0x20297a2e, 0x30203d3d, 0x2966302e, 
-    0x20200a0d, 0x200a0d7b, 0x64202020, 0x2e617461, 0x6e657665, 0x79745f74, 0x3d206570, 0x44534220, 0x56455f46, 
-    0x5f544e45, 0x4f534241, 0x0d3b4252, 0x2020200a, 0x74657220, 0x3b6e7275, 0x20200a0d, 0x0d0a0d7d, 0x2f20200a, 
-    0x7254202f, 0x66736e61, 0x206d726f, 0x77206f74, 0x646c726f, 0x20200a0d, 0x736e6f63, 0x6c662074, 0x3374616f, 
-    0x3d206820, 0x2e306820, 0x202a2078, 0x2e74616d, 0x202b2054, 0x792e3068, 0x6d202a20, 0x422e7461, 0x68202b20, 
-    0x207a2e30, 0x616d202a, 0x3b4e2e74, 0x0a0d0a0d, 0x6f632020, 0x2074736e, 0x616f6c66, 0x316b2074, 0x203d2068, 
-    0x28746f64, 0x61746164, 0x2c316b2e, 0x3b296820, 0x0a0d0a0d, 0x66692020, 0x68316b28, 0x203d3c20, 0x66302e30, 
-    0x200a0d29, 0x0a0d7b20, 0x20202020, 0x61746164, 0x6576652e, 0x745f746e, 0x20657079, 0x5342203d, 0x455f4644, 
-    0x544e4556, 0x5342415f, 0x3b42524f, 0x20200a0d, 0x65722020, 0x6e727574, 0x200a0d3b, 0x0a0d7d20, 0x20200a0d, 
-    0x42202f2f, 0x3a464452, 0x66657220, 0x7463656c, 0x20200a0d, 0x61746164, 0x20326b2e, 0x20202020, 0x20202020, 
-    0x3d202020, 0x2e322820, 0x2a206630, 0x68316b20, 0x202a2029, 0x202d2068, 0x61746164, 0x3b316b2e, 0x20200a0d, 
-    0x61746164, 0x6473622e, 0x766f5f66, 0x705f7265, 0x3d206664, 0x6f6c6620, 0x28337461, 0x66302e31, 0x20203b29, 
-    0x50202f2f, 0x20465245, 0x61776c41, 0x77207379, 0x65746968, 0x74697720, 0x68742068, 0x726f2065, 0x6e696769, 
-    0x73206c61, 0x70757465, 0x200a0d2e, 0x74616420, 0x76652e61, 0x5f746e65, 0x65707974, 0x20202020, 0x5342203d, 
-    0x455f4644, 0x544e4556, 0x4f4c475f, 0x5f595353, 0x4c464552, 0x49544345, 0x0d3b4e4f, 0x200a0d0a, 0x202f2f20, 
-    0x63656843, 0x6669206b, 0x65687420, 0x73657220, 0x69746c75, 0x7220676e, 0x656c6665, 0x6f697463, 0x6964206e, 
-    0x74636572, 0x206e6f69, 0x6f207369, 0x6874206e, 0x6f632065, 0x63657272, 0x69732074, 0x6f206564, 0x68742066, 
-    0x63612065, 0x6c617574, 0x6f656720, 0x7274656d, 0x0a0d2e79, 0x6f632020, 0x2074736e, 0x616f6c66, 0x6e672074, 
-    0x3d20326b, 0x746f6420, 0x74616428, 0x326b2e61, 0x616d202c, 0x674e2e74, 0x0a0d3b29, 0x20200a0d, 0x67286669, 
-    0x20326b6e, 0x30203d3c, 0x2966302e, 0x20200a0d, 0x200a0d7b, 0x64202020, 0x2e617461, 0x6e657665, 0x79745f74, 
-    0x3d206570, 0x44534220, 0x56455f46, 0x5f544e45, 0x4f534241, 0x0d3b4252, 0x2020200a, 0x74657220, 0x3b6e7275, 
-    0x20200a0d, 0x0d0a0d7d, 0x6320200a, 0x74736e6f, 0x6f6c6620, 0x6e207461, 0x3d20326b, 0x73626120, 0x746f6428, 
-    0x74616428, 0x326b2e61, 0x616d202c, 0x294e2e74, 0x0a0d3b29, 0x6f632020, 0x2074736e, 0x616f6c66, 0x326b2074, 
-    0x203d2068, 0x28736261, 0x28746f64, 0x61746164, 0x2c326b2e, 0x29296820, 0x0d0a0d3b, 0x6620200a, 0x74616f6c, 
-    0x3b314720, 0x20200a0d, 0x616f6c66, 0x32472074, 0x0d0a0d3b, 0x6320200a, 0x74736e6f, 0x6f6c6620, 0x47207461, 
-    0x3d203231, 0x61637620, 0x69746976, 0x735f7365, 0x6f646168, 0x616d5f77, 0x47286b73, 0x47202c31, 0x68202c32, 
-    0x2c7a2e30, 0x30316b20, 0x316b202c, 0x66202c68, 0x74616f6c, 0x6f642833, 0x61642874, 0x6b2e6174, 0x6d202c32, 
-    0x542e7461, 0x64202c29, 0x6428746f, 0x2e617461, 0x202c326b, 0x2e74616d, 0x202c2942, 0x29326b6e, 0x326b202c, 
-    0x0d3b2968, 0x6920200a, 0x31472866, 0x3d3c2032, 0x302e3020, 0x0a0d2966, 0x0d7b2020, 0x2020200a, 0x74616420, 
-    0x76652e61, 0x5f746e65, 0x65707974, 0x42203d20, 0x5f464453, 0x4e455645, 0x42415f54, 0x42524f53, 0x200a0d3b, 
-    0x72202020, 0x72757465, 0x0a0d3b6e, 0x0d7d2020, 0x200a0d0a, 0x74616420, 0x73622e61, 0x6f5f6664, 0x5f726576, 
-    0x20666470, 0x47203d2a, 0x2f203231, 0x3b314720, 0x0a0d0a0d, 0x2f2f2020, 0x6d6f4320, 0x65747570, 0x66647020, 
-    0x200a0d2e, 0x74616420, 0x64702e61, 0x203d2066, 0x5f647668, 0x65656873, 0x76655f6e, 0x69286c61, 0x6f52766e, 
-    0x6e686775, 0x2c737365, 0x2e306820, 0x2a20297a, 0x3b314720, 0x0a0d0a0d, 0x61642020, 0x702e6174, 0x2a206664, 
-    0x2e30203d, 0x20663532, 0x6e28202f, 0x2a20316b, 0x2e306820, 0x0d3b297a, 0x200a0d0a, 0x74616420, 0x73622e61, 
-    0x6f5f6664, 0x5f726576, 0x20666470, 0x6d203d2a, 0x732e7461, 0x6e656568, 0x6f6c6f43, 0x0a0d3b72, 0x0d0a0d7d, 
-    0x2f0a0d0a, 0x2d2d2d2a, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d2d2d, 0x75462023, 
-    0x6974636e, 0x60206e6f, 0x66647362, 0x6c617645, 0x65746175, 0x3e0a0d60, 0x61764520, 0x7461756c, 0x74207365, 
-    0x66206568, 0x206c6c75, 0x46445342, 0x646f6d20, 0x66206c65, 0x7420726f, 0x67206568, 0x6e657669, 0x74616d20, 
-    0x61697265, 0x6e61206c, 0x65732064, 0x666f2074, 0x72696420, 0x69746365, 0x2e736e6f, 0x0a0d0a0d, 0x20756f59, 
-    0x7473756d, 0x6f727020, 0x65646976, 0x73426020, 0x76456664, 0x61756c61, 0x61446574, 0x27606174, 0x6b602073, 
-    0x202c6031, 0x60326b60, 0x6e61202c, 0x78602064, 0x70206069, 0x6d617261, 0x72657465, 0x0a0d2e73, 0x61764528, 
-    0x7461756c, 0x206e6f69, 0x73207369, 0x68636f74, 0x69747361, 0x65622063, 0x73756163, 0x68742065, 0x63207369, 
-    0x2065646f, 0x646e6172, 0x796c6d6f, 0x6d617320, 0x73656c70, 0x626f6c20, 0x64207365, 0x6e657065, 0x676e6964, 
-    0x0d6e6f20, 0x6978600a, 0x74203b60, 0x20736968, 0x76207369, 0x64696c61, 0x206f7420, 0x69206f64, 0x2061206e, 
-    0x746e6f4d, 0x61432065, 0x206f6c72, 0x68746170, 0x61727420, 0x2e726563, 0x0d0a0d29, 0x6568540a, 0x66696420, 
-    0x65737566, 0x626f6c20, 0x76652065, 0x61756c61, 0x6e6f6974, 0x646e6120, 0x65687420, 0x6d757320, 0x20666f20, 
-    0x20656874, 0x63657073, 0x72616c75, 0x626f6c20, 0x76652065, 0x61756c61, 0x6e6f6974, 0x280a0d73, 0x6c636e69, 
-    0x6e696475, 0x68742067, 0x6f632065, 0x656e6973, 0x72657420, 0x7266206d, 0x74206d6f, 0x72206568, 0x65646e65, 
-    0x676e6972, 0x75716520, 0x6f697461, 0x7720296e, 0x206c6c69, 0x72206562, 0x72757465, 0x2064656e, 0x0a0d6e69, 
-    0x74616460, 0x73622e61, 0x645f6664, 0x75666669, 0x20606573, 0x20646e61, 0x74616460, 0x73622e61, 0x675f6664, 
-    0x73736f6c, 0x202e6079, 0x69646441, 0x6e6f6974, 0x796c6c61, 0x6874202c, 0x72702065, 0x6261626f, 0x74696c69, 
-    0x68742079, 0x0a0d7461, 0x20656874, 0x706d6173, 0x676e696c, 0x646f6320, 0x69772065, 0x72206c6c, 0x72757465, 
-    0x6874206e, 0x64207369, 0x63657269, 0x6e6f6974, 0x6c697720, 0x6562206c, 0x74657220, 0x656e7275, 0x6e692064, 
-    0x61646020, 0x702e6174, 0x2e606664, 0x2d2d0a0d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2a2d2d2d, 0x760a0d2f, 0x2064696f, 0x66647362, 0x6c617645, 0x65746175, 0x4f4e4928, 0x545f5455, 0x28455059, 
-    0x66647342, 0x6c617645, 0x65746175, 0x61746144, 0x61642029, 0x202c6174, 0x4d726250, 0x72657461, 0x206c6169, 
-    0x2974616d, 0x0d7b0a0d, 0x6620200a, 0x74616f6c, 0x69742033, 0x2020746e, 0x20202020, 0x6d203d20, 0x622e7461, 
-    0x43657361, 0x726f6c6f, 0x200a0d3b, 0x6f6c6620, 0x20207461, 0x746f6456, 0x2020204e, 0x3d202020, 0x746f6420, 
-    0x74616428, 0x316b2e61, 0x616d202c, 0x294e2e74, 0x200a0d3b, 0x746e6920, 0x20202020, 0x65626f6c, 0x20202020, 
-    0x3d202020, 0x6e696620, 0x626f4c64, 0x616d2865, 0x56202c74, 0x4e746f64, 0x6164202c, 0x782e6174, 0x2c7a2e69, 
-    0x6e697420, 0x0d3b2974, 0x6420200a, 0x2e617461, 0x66647362, 0x6669645f, 0x65737566, 0x66203d20, 0x74616f6c, 
-    0x2c302833, 0x202c3020, 0x0d3b2930, 0x6420200a, 0x2e617461, 0x66647362, 0x6f6c675f, 0x20797373, 0x66203d20, 
-    0x74616f6c, 0x2c302833, 0x202c3020, 0x0d3b2930, 0x6420200a, 0x2e617461, 0x20666470, 0x20202020, 0x20202020, 
-    0x30203d20, 0x0d3b302e, 0x200a0d0a, 0x28666920, 0x65626f6c, 0x203d3d20, 0x45424f4c, 0x4649445f, 0x45535546, 
-    0x4645525f, 0x5443454c, 0x294e4f49, 0x20200a0d, 0x200a0d7b, 0x62202020, 0x5f666472, 0x66666964, 0x5f657375, 
-    0x6c617665, 0x74616428, 0x6d202c61, 0x202c7461, 0x746e6974, 0x0a0d3b29, 0x0d7d2020, 0x6520200a, 0x2065736c, 
-    0x6c286669, 0x2065626f, 0x4c203d3d, 0x5f45424f, 0x46464944, 0x5f455355, 0x4e415254, 0x53494d53, 0x4e4f4953, 
-    0x200a0d29, 0x0a0d7b20, 0x20202020, 0x66647262, 0x6669645f, 0x65737566, 0x6172745f, 0x696d736e, 0x6f697373, 
-    0x76655f6e, 0x64286c61, 0x2c617461, 0x74616d20, 0x6974202c, 0x3b29746e, 0x20200a0d, 0x200a0d7d, 0x736c6520, 
-    0x66692065, 0x626f6c28, 0x3d3d2065, 0x424f4c20, 0x50535f45, 0x4c554345, 0x525f5241, 0x454c4645, 0x4f495443, 
-    0x0a0d294e, 0x0d7b2020, 0x2020200a, 0x64726220, 0x67675f66, 0x6d735f78, 0x5f687469, 0x6c617665, 0x74616428, 
-    0x6d202c61, 0x202c7461, 0x45424f4c, 0x4550535f, 0x414c5543, 0x45525f52, 0x43454c46, 0x4e4f4954, 0x616d202c, 
-    0x70732e74, 0x6c756365, 0x6f437261, 0x29726f6c, 0x200a0d3b, 0x0a0d7d20, 0x6c652020, 0x69206573, 0x6f6c2866, 
-    0x3d206562, 0x4f4c203d, 0x535f4542, 0x55434550, 0x5f52414c, 0x4e415254, 0x53494d53, 0x4e4f4953, 0x200a0d29, 
-    0x0a0d7b20, 0x20202020, 0x66647462, 0x7867675f, 0x696d735f, 0x655f6874, 0x286c6176, 0x61746164, 0x616d202c, 
-    0x74202c74, 0x29746e69, 0x200a0d3b, 0x0a0d7d20, 0x6c652020, 0x69206573, 0x6f6c2866, 0x3d206562, 0x4f4c203d, 
-    0x4d5f4542, 0x4c415445, 0x4645525f, 0x5443454c, 0x294e4f49, 0x20200a0d, 0x200a0d7b, 0x62202020, 0x5f666472, 
-    0x5f786767, 0x74696d73, 0x76655f68, 0x64286c61, 0x2c617461, 0x74616d20, 0x4f4c202c, 0x4d5f4542, 0x4c415445, 
-    0x4645525f, 0x5443454c, 0x2c4e4f49, 0x74616d20, 0x7361622e, 0x6c6f4365, 0x3b29726f, 0x20200a0d, 0x200a0d7d, 
-    0x736c6520, 0x66692065, 0x626f6c28, 0x3d3d2065, 0x424f4c20, 0x4c435f45, 0x43524145, 0x5f54414f, 0x4c464552, 
-    0x49544345, 0x0d294e4f, 0x7b20200a, 0x20200a0d, 0x616d2020, 0x6f722e74, 0x6e686775, 0x20737365, 0x203d2020, 
-    0x616f6c66, 0x6d283274, 0x632e7461, 0x7261656c, 0x74616f63, 0x67756f52, 0x73656e68, 0x202a2073, 0x2e74616d, 
-    0x61656c63, 0x616f6372, 0x756f5274, 0x656e6867, 0x3b297373, 0x20200a0d, 0x616d2020, 0x204e2e74, 0x20202020, 
-    0x20202020, 0x203d2020, 0x2e74616d, 0x0d3b634e, 0x2020200a, 0x74616d20, 0x6972692e, 0x63736564, 0x65636e65, 
-    0x30203d20, 0x3b66302e, 0x20200a0d, 0x72622020, 0x675f6664, 0x735f7867, 0x6874696d, 0x6176655f, 0x6164286c, 
-    0x202c6174, 0x2c74616d, 0x424f4c20, 0x4c435f45, 0x43524145, 0x5f54414f, 0x4c464552, 0x49544345, 0x202c4e4f, 
-    0x616f6c66, 0x31283374, 0x2c31202c, 0x29293120, 0x200a0d3b, 0x0a0d7d20, 0x6c652020, 0x69206573, 0x6f6c2866, 
-    0x3d206562, 0x4f4c203d, 0x535f4542, 0x4e454548, 0x4645525f, 0x5443454c, 0x294e4f49, 0x20200a0d, 0x200a0d7b, 
-    0x62202020, 0x5f666472, 0x65656873, 0x76655f6e, 0x64286c61, 0x2c617461, 0x74616d20, 0x0a0d3b29, 0x0d7d2020, 
-    0x200a0d0a, 0x202f2f20, 0x6c63634f, 0x6f697375, 0x6665206e, 0x74636566, 0x6c672820, 0x6f204654, 0x756c6363, 
-    0x6e6f6973, 0x78657420, 0x65727574, 0x200a0d29, 0x74616420, 0x73622e61, 0x645f6664, 0x75666669, 0x2a206573, 
-    0x616d203d, 0x636f2e74, 0x73756c63, 0x3b6e6f69, 0x20200a0d, 0x61746164, 0x6473622e, 0x6c675f66, 0x7973736f, 
-    0x203d2a20, 0x2e74616d, 0x6c63636f, 0x6f697375, 0x0a0d3b6e, 0x0d0a0d7d, 0x2d2a2f0a, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x20230a0d, 0x636e7546, 0x6e6f6974, 0x73626020, 0x61536664, 
-    0x656c706d, 0x0d0a0d60, 0x53203e0a, 0x6c706d61, 0x74207365, 0x66206568, 0x206c6c75, 0x46445342, 0x646f6d20, 
-    0x66206c65, 0x7420726f, 0x67206568, 0x6e657669, 0x74616d20, 0x61697265, 0x6e61206c, 0x6e692064, 0x20747570, 
-    0x65726964, 0x6f697463, 0x0a0d2e6e, 0x6f590a0d, 0x756d2075, 0x70207473, 0x69766f72, 0x60206564, 0x66647342, 
-    0x706d6153, 0x6144656c, 0x27606174, 0x6b602073, 0x61206031, 0x6020646e, 0x20606978, 0x61726170, 0x6574656d, 
-    0x202e7372, 0x73696854, 0x6e756620, 0x6f697463, 0x770a0d6e, 0x206c6c69, 0x20746573, 0x20656874, 0x6568746f, 
-    0x61702072, 0x656d6172, 0x73726574, 0x20666f20, 0x64734260, 0x6d615366, 0x44656c70, 0x60617461, 0x0d0a0d2e, 
-    0x6568540a, 0x61206572, 0x74206572, 0x74206f77, 0x676e6968, 0x6f792073, 0x68732075, 0x646c756f, 0x65686320, 
-    0x61206b63, 0x72657466, 0x6c616320, 0x676e696c, 0x69687420, 0x75662073, 0x6974636e, 0x0d3a6e6f, 0x49202a0a, 
-    0x64602073, 0x2e617461, 0x6e657665, 0x79745f74, 0x20606570, 0x61757165, 0x6f74206c, 0x53426020, 0x455f4644, 
-    0x544e4556, 0x5342415f, 0x6042524f, 0x6649203f, 0x2c6f7320, 0x65687420, 0x6d617320, 0x72656c70, 0x6d617320, 
-    0x64656c70, 0x20200a0d, 0x6f206e61, 0x75707475, 0x69642074, 0x74636572, 0x206e6f69, 0x74616874, 0x756f7720, 
-    0x6220646c, 0x62612065, 0x62726f73, 0x62206465, 0x68742079, 0x616d2065, 0x69726574, 0x28206c61, 0x2e672e65, 
-    0x20746920, 0x736f6863, 0x0d612065, 0x7220200a, 0x656c6665, 0x76697463, 0x6f6c2065, 0x62206562, 0x73207475, 
-    0x6c706d61, 0x61206465, 0x63657620, 0x20726f74, 0x6f6c6562, 0x68742077, 0x75732065, 0x63616672, 0x0d2e2965, 
-    0x5420200a, 0x6c206568, 0x74686769, 0x74617020, 0x6e652068, 0x68207364, 0x2e657265, 0x202a0a0d, 0x60207349, 
-    0x61746164, 0x6664702e, 0x71652060, 0x206c6175, 0x60206f74, 0x41524944, 0x203f6043, 0x73206649, 0x74202c6f, 
-    0x20736968, 0x706d6173, 0x2064656c, 0x65702061, 0x63656672, 0x20796c74, 0x63657073, 0x72616c75, 0x626f6c20, 
-    0x0a0d2e65, 0x66492020, 0x756f7920, 0x20657227, 0x6e697375, 0x754d2067, 0x7069746c, 0x4920656c, 0x726f706d, 
-    0x636e6174, 0x61532065, 0x696c706d, 0x7720676e, 0x68676965, 0x202c7374, 0x20756f79, 0x756f6873, 0x6320646c, 
-    0x75706d6f, 0x74206574, 0x0d6d6568, 0x6120200a, 0x66692073, 0x61646020, 0x702e6174, 0x20606664, 0x20736177, 
-    0x69666e69, 0x7974696e, 0x200a0d2e, 0x2d0a0d20, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x0a0d2f2a, 0x64696f76, 0x64736220, 0x6d615366, 0x28656c70, 0x554f4e49, 0x59545f54, 0x42284550, 
-    0x53666473, 0x6c706d61, 0x74614465, 0x64202961, 0x2c617461, 0x72625020, 0x6574614d, 0x6c616972, 0x74616d20, 
-    0x7b0a0d29, 0x20200a0d, 0x616f6c66, 0x74203374, 0x20746e69, 0x20202020, 0x3d202020, 0x74616d20, 0x7361622e, 
-    0x6c6f4365, 0x0d3b726f, 0x6620200a, 0x74616f6c, 0x64562020, 0x204e746f, 0x20202020, 0x203d2020, 0x28746f64, 
-    0x61746164, 0x2c316b2e, 0x74616d20, 0x3b294e2e, 0x20200a0d, 0x20746e69, 0x6c202020, 0x2065626f, 0x20202020, 
-    0x3d202020, 0x6e696620, 0x626f4c64, 0x616d2865, 0x56202c74, 0x4e746f64, 0x6164202c, 0x782e6174, 0x2c7a2e69, 
-    0x6e697420, 0x0d3b2974, 0x6420200a, 0x2e617461, 0x20666470, 0x20202020, 0x20202020, 0x203d2020, 0x0a0d3b30, 
-    0x61642020, 0x622e6174, 0x5f666473, 0x7265766f, 0x6664705f, 0x66203d20, 0x74616f6c, 0x2e302833, 0x3b294630, 
-    0x20200a0d, 0x61746164, 0x6576652e, 0x745f746e, 0x20657079, 0x3d202020, 0x44534220, 0x56455f46, 0x5f544e45, 
-    0x4f534241, 0x0d3b4252, 0x200a0d0a, 0x28666920, 0x65626f6c, 0x203d3d20, 0x45424f4c, 0x4649445f, 0x45535546, 
-    0x4645525f, 0x5443454c, 0x294e4f49, 0x20200a0d, 0x200a0d7b, 0x62202020, 0x5f666472, 0x66666964, 0x5f657375, 
-    0x706d6173, 0x6428656c, 0x2c617461, 0x74616d20, 0x6974202c, 0x3b29746e, 0x20200a0d, 0x200a0d7d, 0x736c6520, 
-    0x66692065, 0x626f6c28, 0x3d3d2065, 0x424f4c20, 0x49445f45, 0x53554646, 0x52545f45, 0x4d534e41, 0x49535349, 
-    0x0d294e4f, 0x7b20200a, 0x20200a0d, 0x72622020, 0x645f6664, 0x75666669, 0x745f6573, 0x736e6172, 0x7373696d, 
-    0x5f6e6f69, 0x706d6173, 0x6428656c, 0x2c617461, 0x74616d20, 0x6974202c, 0x3b29746e, 0x20200a0d, 0x200a0d7d, 
-    0x736c6520, 0x66692065, 0x626f6c28, 0x3d3d2065, 0x424f4c20, 0x50535f45, 0x4c554345, 0x525f5241, 0x454c4645, 
-    0x4f495443, 0x0a0d294e, 0x0d7b2020, 0x2020200a, 0x64726220, 0x67675f66, 0x6d735f78, 0x5f687469, 0x706d6173, 
-    0x6428656c, 0x2c617461, 0x74616d20, 0x4f4c202c, 0x535f4542, 0x55434550, 0x5f52414c, 0x4c464552, 0x49544345, 
-    0x202c4e4f, 0x2e74616d, 0x63657073, 0x72616c75, 0x6f6c6f43, 0x0d3b2972, 0x7d20200a, 0x20200a0d, 0x65736c65, 
-    0x28666920, 0x65626f6c, 0x203d3d20, 0x45424f4c, 0x4550535f, 0x414c5543, 0x52545f52, 0x4d534e41, 0x49535349, 
-    0x0d294e4f, 0x7b20200a, 0x20200a0d, 0x74622020, 0x675f6664, 0x735f7867, 0x6874696d, 0x6d61735f, 0x28656c70, 
-    0x61746164, 0x616d202c, 0x74202c74, 0x29746e69, 0x200a0d3b, 0x0a0d7d20, 0x6c652020, 0x69206573, 0x6f6c2866, 
-    0x3d206562, 0x4f4c203d, 0x4d5f4542, 0x4c415445, 0x4645525f, 0x5443454c, 0x294e4f49, 0x20200a0d, 0x200a0d7b, 
-    0x62202020, 0x5f666472, 0x5f786767, 0x74696d73, 0x61735f68, 0x656c706d, 0x74616428, 0x6d202c61, 0x202c7461, 
-    0x45424f4c, 0x54454d5f, 0x525f4c41, 0x454c4645, 0x4f495443, 0x6d202c4e, 0x622e7461, 0x43657361, 0x726f6c6f, 
-    0x0a0d3b29, 0x0d7d2020, 0x6520200a, 0x2065736c, 0x6c286669, 0x2065626f, 0x4c203d3d, 0x5f45424f, 0x41454c43, 
-    0x414f4352, 0x45525f54, 0x43454c46, 0x4e4f4954, 0x200a0d29, 0x0a0d7b20, 0x20202020, 0x2e74616d, 0x67756f72, 
-    0x73656e68, 0x20202073, 0x6c66203d, 0x3274616f, 0x74616d28, 0x656c632e, 0x6f637261, 0x6f527461, 0x6e686775, 
-    0x20737365, 0x616d202a, 0x6c632e74, 0x63726165, 0x5274616f, 0x6867756f, 0x7373656e, 0x0a0d3b29, 0x20202020, 
-    0x2e74616d, 0x2020204e, 0x20202020, 0x20202020, 0x616d203d, 0x634e2e74, 0x200a0d3b, 0x6d202020, 0x422e7461, 
-    0x20202020, 0x20202020, 0x3d202020, 0x726f6e20, 0x696c616d, 0x6328657a, 0x73736f72, 0x74616d28, 0x202c4e2e, 
-    0x2e74616d, 0x3b292954, 0x2f2f2020, 0x73734120, 0x73656d75, 0x20634e20, 0x20646e61, 0x61206354, 0x6e206572, 
-    0x6320746f, 0x696c6c6f, 0x7261656e, 0x200a0d21, 0x6d202020, 0x542e7461, 0x20202020, 0x20202020, 0x3d202020, 
-    0x6f726320, 0x6d287373, 0x422e7461, 0x616d202c, 0x294e2e74, 0x200a0d3b, 0x6d202020, 0x692e7461, 0x65646972, 
-    0x6e656373, 0x3d206563, 0x302e3020, 0x0a0d3b66, 0x20202020, 0x66647262, 0x7867675f, 0x696d735f, 0x735f6874, 
-    0x6c706d61, 0x61642865, 0x202c6174, 0x2c74616d, 0x424f4c20, 0x4c435f45, 0x43524145, 0x5f54414f, 0x4c464552, 
-    0x49544345, 0x202c4e4f, 0x616f6c66, 0x31283374, 0x2c31202c, 0x29293120, 0x200a0d3b, 0x0a0d7d20, 0x6c652020, 
-    0x69206573, 0x6f6c2866, 0x3d206562, 0x4f4c203d, 0x535f4542, 0x4e454548, 0x4645525f, 0x5443454c, 0x294e4f49, 
-    0x20200a0d, 0x200a0d7b, 0x2f202020, 0x6853202f, 0x206e6565, 0x75207369, 0x676e6973, 0x65687420, 0x61747320, 
-    0x732e6574, 0x6e656568, 0x6f6c6f43, 0x6e612072, 0x74732064, 0x2e657461, 0x65656873, 0x766e496e, 0x67756f52, 
-    0x73656e68, 0x61762073, 0x7365756c, 0x72696420, 0x6c746365, 0x0a0d2e79, 0x20202020, 0x4f202f2f, 0x20796c6e, 
-    0x66647262, 0x6568735f, 0x735f6e65, 0x6c706d61, 0x656e2065, 0x20736465, 0x68742061, 0x20647269, 0x646e6172, 
-    0x73206d6f, 0x6c706d61, 0x6f662065, 0x68742072, 0x2d762065, 0x69766163, 0x73656974, 0x696c6620, 0x50202e70, 
-    0x74207475, 0x20736968, 0x61207361, 0x6d756772, 0x2e746e65, 0x20200a0d, 0x72622020, 0x735f6664, 0x6e656568, 
-    0x6d61735f, 0x28656c70, 0x61746164, 0x616d202c, 0x0d3b2974, 0x7d20200a, 0x0a0d0a0d, 0x2f2f2020, 0x6f764120, 
-    0x69206469, 0x7265746e, 0x206c616e, 0x6c666572, 0x69746365, 0x0a0d6e6f, 0x66692020, 0x74616428, 0x64702e61, 
-    0x3d3c2066, 0x302e3020, 0x31303030, 0x7c7c2046, 0x796e6120, 0x6e736928, 0x64286e61, 0x2e617461, 0x66647362, 
-    0x65766f5f, 0x64705f72, 0x29292966, 0x20200a0d, 0x200a0d7b, 0x64202020, 0x2e617461, 0x6e657665, 0x79745f74, 
-    0x3d206570, 0x44534220, 0x56455f46, 0x5f544e45, 0x4f534241, 0x0d3b4252, 0x7d20200a, 0x20200a0d, 0x28286669, 
-    0x616e7369, 0x6164286e, 0x702e6174, 0x20296664, 0x69207c7c, 0x666e6973, 0x74616428, 0x64702e61, 0x20292966, 
-    0x64202626, 0x2e617461, 0x6e657665, 0x79745f74, 0x21206570, 0x5342203d, 0x455f4644, 0x544e4556, 0x5342415f, 
-    0x2942524f, 0x20200a0d, 0x200a0d7b, 0x2f202020, 0x7254202f, 0x20746165, 0x61207361, 0x72657020, 0x74636566, 
-    0x7320796c, 0x75636570, 0x2072616c, 0x6e756f62, 0x203b6563, 0x6e616863, 0x47206567, 0x53534f4c, 0x6f742059, 
-    0x504d4920, 0x45534c55, 0x20200a0d, 0x61642020, 0x652e6174, 0x746e6576, 0x7079745f, 0x203d2065, 0x74616428, 
-    0x76652e61, 0x5f746e65, 0x65707974, 0x28202620, 0x4453427e, 0x56455f46, 0x5f544e45, 0x534f4c47, 0x29295953, 
-    0x42207c20, 0x5f464453, 0x4e455645, 0x4d495f54, 0x534c5550, 0x0a0d3b45, 0x20202020, 0x61746164, 0x6664702e, 
-    0x20202020, 0x20202020, 0x4944203d, 0x3b434152, 0x20200a0d, 0x7d0a0d7d, 0x0a0d0a0d, 0x2d2d2a2f, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0d2d2d2d, 0x5320230a, 0x6c706d69, 0x53422065, 0x4d204644, 
-    0x6c65646f, 0x68540a0d, 0x75662065, 0x6974636e, 0x20736e6f, 0x6f6c6562, 0x72612077, 0x73752065, 0x74206465, 
-    0x7665206f, 0x61756c61, 0x61206574, 0x7320646e, 0x6c706d61, 0x68742065, 0x53422065, 0x66204644, 0x6120726f, 
-    0x6d697320, 0x20656c70, 0x20524250, 0x6574616d, 0x6c616972, 0x770a0d2c, 0x6f687469, 0x61207475, 0x6120796e, 
-    0x74696464, 0x616e6f69, 0x6f6c206c, 0x20736562, 0x656b696c, 0x656c6320, 0x6f637261, 0x202c7461, 0x65656873, 
-    0x65202c6e, 0x202e6374, 0x20646e61, 0x68746977, 0x2074756f, 0x20656874, 0x6465656e, 0x20666f20, 0x646e6172, 
-    0x6e206d6f, 0x65626d75, 0x0d2e7372, 0x6968540a, 0x73692073, 0x73616220, 0x6f206465, 0x6874206e, 0x656d2065, 
-    0x6c6c6174, 0x722f6369, 0x6867756f, 0x7373656e, 0x44524220, 0x6e692046, 0x70704120, 0x69646e65, 0x20422078, 
-    0x7420666f, 0x67206568, 0x2046546c, 0x63657073, 0x63696669, 0x6f697461, 0x0a0d2e6e, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0d2f2a2d, 0x2f0a0d0a, 0x6552202f, 0x6e727574, 0x68742073, 
-    0x72702065, 0x6261626f, 0x74696c69, 0x68742079, 0x62207461, 0x53666473, 0x6c706d61, 0x6d695365, 0x20656c70, 
-    0x706d6173, 0x2073656c, 0x6c672061, 0x7973736f, 0x626f6c20, 0x0a0d2e65, 0x616f6c66, 0x73622074, 0x69536664, 
-    0x656c706d, 0x736f6c47, 0x72507973, 0x6261626f, 0x74696c69, 0x6c662879, 0x2074616f, 0x746f644e, 0x66202c56, 
-    0x74616f6c, 0x74656d20, 0x696c6c61, 0x0a0d2963, 0x200a0d7b, 0x74657220, 0x206e7275, 0x7072656c, 0x68637328, 
-    0x6b63696c, 0x73657246, 0x286c656e, 0x34302e30, 0x31202c46, 0x2c46302e, 0x6f644e20, 0x2c295674, 0x302e3120, 
-    0x6d202c46, 0x6c617465, 0x2963696c, 0x7d0a0d3b, 0x0a0d0a0d, 0x2d2d2a2f, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x0d2d2d2d, 0x4620230a, 0x74636e75, 0x206e6f69, 0x64736260, 0x61764566, 0x7461756c, 
-    0x6d695365, 0x60656c70, 0x203e0a0d, 0x6c617645, 0x65746175, 0x68742073, 0x69732065, 0x656c706d, 0x44534220, 
-    0x6f6d2046, 0x206c6564, 0x6e697375, 0x68742067, 0x69672065, 0x206e6576, 0x6574616d, 0x6c616972, 0x646e6120, 
-    0x706e6920, 0x61207475, 0x6f20646e, 0x75707475, 0x69642074, 0x74636572, 0x736e6f69, 0x0d0a0d2e, 0x756f590a, 
-    0x73756d20, 0x72702074, 0x6469766f, 0x64602065, 0x2e617461, 0x2060316b, 0x20646e61, 0x74616460, 0x326b2e61, 
-    0x62202c60, 0x64207475, 0x6f6e206f, 0x656e2074, 0x74206465, 0x7270206f, 0x6469766f, 0x64602065, 0x2e617461, 
-    0x2e606978, 0x2d2d0a0d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2a2d2d2d, 0x760a0d2f, 
-    0x2064696f, 0x66647362, 0x6c617645, 0x65746175, 0x706d6953, 0x4928656c, 0x54554f4e, 0x5059545f, 0x73422845, 
-    0x76456664, 0x61756c61, 0x61446574, 0x20296174, 0x61746164, 0x6250202c, 0x74614d72, 0x61697265, 0x616d206c, 
-    0x0a0d2974, 0x200a0d7b, 0x202f2f20, 0x63657053, 0x72616c75, 0x66657220, 0x7463656c, 0x0d6e6f69, 0x6620200a, 
-    0x74616f6c, 0x20482033, 0x20202020, 0x6f6e203d, 0x6c616d72, 0x28657a69, 0x61746164, 0x20316b2e, 0x6164202b, 
-    0x6b2e6174, 0x0d3b2932, 0x6620200a, 0x74616f6c, 0x644e2020, 0x2056746f, 0x6c63203d, 0x65706d61, 0x746f4464, 
-    0x74616d28, 0x202c4e2e, 0x61746164, 0x29316b2e, 0x200a0d3b, 0x6f6c6620, 0x20207461, 0x746f644e, 0x203d204c, 
-    0x6d616c63, 0x44646570, 0x6d28746f, 0x4e2e7461, 0x6164202c, 0x6b2e6174, 0x0d3b2932, 0x6620200a, 0x74616f6c, 
-    0x64562020, 0x2048746f, 0x6c63203d, 0x65706d61, 0x746f4464, 0x74616428, 0x316b2e61, 0x2948202c, 0x200a0d3b, 
-    0x6f6c6620, 0x20207461, 0x746f644e, 0x203d2048, 0x6d616c63, 0x44646570, 0x6d28746f, 0x4e2e7461, 0x2948202c, 
-    0x0d0a0d3b, 0x6920200a, 0x644e2866, 0x2056746f, 0x30203d3d, 0x2066302e, 0x4e207c7c, 0x4c746f64, 0x203d3d20, 
-    0x66302e30, 0x207c7c20, 0x746f6456, 0x3d3d2048, 0x302e3020, 0x7c7c2066, 0x6f644e20, 0x3d204874, 0x2e30203d, 
-    0x0d296630, 0x7b20200a, 0x20200a0d, 0x61642020, 0x622e6174, 0x5f666473, 0x66666964, 0x20657375, 0x6164203d, 
-    0x622e6174, 0x5f666473, 0x736f6c67, 0x3d207973, 0x6f6c6620, 0x28337461, 0x66302e30, 0x0a0d3b29, 0x20202020, 
-    0x61746164, 0x6664702e, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x30203d20, 0x3b66302e, 0x20200a0d, 0x65722020, 0x6e727574, 0x200a0d3b, 0x0a0d7d20, 0x20200a0d, 0x57202f2f, 
-    0x6f632065, 0x6e69626d, 0x68742065, 0x656d2065, 0x6c6c6174, 0x61206369, 0x7320646e, 0x75636570, 0x2072616c, 
-    0x65626f6c, 0x6e692073, 0x61206f74, 0x6e697320, 0x20656c67, 0x736f6c67, 0x6c207973, 0x2e65626f, 0x20200a0d, 
-    0x54202f2f, 0x6d206568, 0x6c617465, 0x2063696c, 0x67696577, 0x69207468, 0x20202073, 0x656d2020, 0x6c6c6174, 
-    0x2a206369, 0x20202020, 0x73657266, 0x286c656e, 0x3d203066, 0x73616220, 0x6c6f4365, 0x0d29726f, 0x2f20200a, 
-    0x6854202f, 0x70732065, 0x6c756365, 0x77207261, 0x68676965, 0x73692074, 0x2d312820, 0x6174656d, 0x63696c6c, 
-    0x202a2029, 0x66202020, 0x6e736572, 0x66286c65, 0x203d2030, 0x696d5f63, 0x65725f6e, 0x63656c66, 0x636e6174, 
-    0x0a0d2965, 0x2f2f2020, 0x65685420, 0x66696420, 0x65737566, 0x69657720, 0x20746867, 0x20207369, 0x6d2d3128, 
-    0x6c617465, 0x2963696c, 0x28202a20, 0x72662d31, 0x656e7365, 0x3066286c, 0x63203d20, 0x6e696d5f, 0x6665725f, 
-    0x7463656c, 0x65636e61, 0x2a202929, 0x73616220, 0x6c6f4365, 0x0a0d726f, 0x20200a0d, 0x46202f2f, 0x6e736572, 
-    0x74206c65, 0x736d7265, 0x20200a0d, 0x616f6c66, 0x63202074, 0x6e696d5f, 0x6665725f, 0x7463656c, 0x65636e61, 
-    0x30203d20, 0x4634302e, 0x200a0d3b, 0x6f6c6620, 0x20337461, 0x20203066, 0x20202020, 0x20202020, 0x20202020, 
-    0x203d2020, 0x7072656c, 0x6f6c6628, 0x28337461, 0x696d5f63, 0x65725f6e, 0x63656c66, 0x636e6174, 0x202c2965, 
-    0x2e74616d, 0x65736162, 0x6f6c6f43, 0x6d202c72, 0x6d2e7461, 0x6c617465, 0x2963696c, 0x200a0d3b, 0x6f6c6620, 
-    0x20337461, 0x6f6c4766, 0x20797373, 0x20202020, 0x20202020, 0x203d2020, 0x6c686373, 0x466b6369, 0x6e736572, 
-    0x66286c65, 0x66202c30, 0x74616f6c, 0x2e312833, 0x2c294630, 0x6f645620, 0x3b294874, 0x2f2f2020, 0x74654d20, 
-    0x696c6c61, 0x202b2063, 0x63657073, 0x72616c75, 0x20200a0d, 0x616f6c66, 0x66202074, 0x66666944, 0x20657375, 
-    0x20202020, 0x20202020, 0x73203d20, 0x696c6863, 0x72466b63, 0x656e7365, 0x2e31286c, 0x2d204630, 0x6d5f6320, 
-    0x725f6e69, 0x656c6665, 0x6e617463, 0x202c6563, 0x46302e30, 0x6456202c, 0x2948746f, 0x28202a20, 0x46302e31, 
-    0x6d202d20, 0x6d2e7461, 0x6c617465, 0x2963696c, 0x0d0a0d3b, 0x2f20200a, 0x7053202f, 0x6c756365, 0x47207261, 
-    0x0a0d5847, 0x6c662020, 0x3374616f, 0x636f6c20, 0x20486c61, 0x66203d20, 0x74616f6c, 0x6f642833, 0x616d2874, 
-    0x2c542e74, 0x2c294820, 0x746f6420, 0x74616d28, 0x202c422e, 0x202c2948, 0x746f644e, 0x0d3b2948, 0x6620200a, 
-    0x74616f6c, 0x20642020, 0x20202020, 0x203d2020, 0x5f647668, 0x5f786767, 0x6c617665, 0x302e3128, 0x202f2066, 
-    0x2e74616d, 0x67756f72, 0x73656e68, 0x6c202c73, 0x6c61636f, 0x0d3b2948, 0x6620200a, 0x74616f6c, 0x6f6c2033, 
-    0x4b6c6163, 0x203d2031, 0x616f6c66, 0x64283374, 0x6d28746f, 0x542e7461, 0x6164202c, 0x6b2e6174, 0x202c2931, 
-    0x28746f64, 0x2e74616d, 0x64202c42, 0x2e617461, 0x2c29316b, 0x6f644e20, 0x3b295674, 0x20200a0d, 0x616f6c66, 
-    0x6c203374, 0x6c61636f, 0x3d20324b, 0x6f6c6620, 0x28337461, 0x28746f64, 0x2e74616d, 0x64202c54, 0x2e617461, 
-    0x2c29326b, 0x746f6420, 0x74616d28, 0x202c422e, 0x61746164, 0x29326b2e, 0x644e202c, 0x294c746f, 0x200a0d3b, 
-    0x6f6c6620, 0x20207461, 0x3d203147, 0x302e3020, 0x47202c66, 0x203d2032, 0x66302e30, 0x200a0d3b, 0x78676720, 
-    0x696d735f, 0x735f6874, 0x6f646168, 0x616d5f77, 0x47286b73, 0x47202c31, 0x6c202c32, 0x6c61636f, 0x202c314b, 
-    0x61636f6c, 0x2c324b6c, 0x74616d20, 0x756f722e, 0x656e6867, 0x3b297373, 0x0a0d0a0d, 0x6c662020, 0x2074616f, 
-    0x66666964, 0x50657375, 0x20206664, 0x5f4d203d, 0x49505f31, 0x4e202a20, 0x4c746f64, 0x200a0d3b, 0x6f6c6620, 
-    0x73207461, 0x75636570, 0x5072616c, 0x3d206664, 0x20314720, 0x2064202a, 0x2e30202a, 0x20663532, 0x4e28202f, 
-    0x56746f64, 0x4e202a20, 0x48746f64, 0x0a0d3b29, 0x61642020, 0x702e6174, 0x20206664, 0x20202020, 0x20202020, 
-    0x656c203d, 0x64287072, 0x75666669, 0x64506573, 0x73202c66, 0x75636570, 0x5072616c, 0x202c6664, 0x66647362, 
-    0x706d6953, 0x6c47656c, 0x7973736f, 0x626f7250, 0x6c696261, 0x28797469, 0x746f644e, 0x6d202c56, 0x6d2e7461, 
-    0x6c617465, 0x2963696c, 0x0a0d3b29, 0x20200a0d, 0x61746164, 0x6473622e, 0x69645f66, 0x73756666, 0x203d2065, 
-    0x2e74616d, 0x65736162, 0x6f6c6f43, 0x202a2072, 0x66694466, 0x65737566, 0x64202a20, 0x75666669, 0x64506573, 
-    0x20203b66, 0x4c202f2f, 0x65626d61, 0x61697472, 0x200a0d6e, 0x74616420, 0x73622e61, 0x675f6664, 0x73736f6c, 
-    0x3d202079, 0x6c476620, 0x7973736f, 0x47202a20, 0x202a2032, 0x63657073, 0x72616c75, 0x3b666450, 0x20202020, 
-    0x20202020, 0x20202020, 0x202f2f20, 0x2d584747, 0x74696d53, 0x7d0a0d68, 0x0a0d0a0d, 0x2d2d2a2f, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0d2d2d2d, 0x4620230a, 0x74636e75, 0x206e6f69, 0x64736260, 
-    0x6d615366, 0x53656c70, 0x6c706d69, 0x0a0d6065, 0x7645203e, 0x61756c61, 0x20736574, 0x20656874, 0x706d6973, 
-    0x4220656c, 0x20464453, 0x65646f6d, 0x7375206c, 0x20676e69, 0x20656874, 0x65766967, 0x616d206e, 0x69726574, 
-    0x61206c61, 0x6920646e, 0x7475706e, 0x646e6120, 0x74756f20, 0x20747570, 0x65726964, 0x6f697463, 0x0d2e736e, 
-    0x590a0d0a, 0x6d20756f, 0x20747375, 0x766f7270, 0x20656469, 0x74616460, 0x316b2e61, 0x6e612060, 0x64602064, 
-    0x2e617461, 0x2e606978, 0x726f4620, 0x656e6f20, 0x6d617320, 0x20656c70, 0x7020666f, 0x20657275, 0x6c666572, 
-    0x69746365, 0x0a0d6e6f, 0x672e6528, 0x6b76202e, 0x6e696d5f, 0x61735f69, 0x656c706d, 0x61722f73, 0x72745f79, 
-    0x29656361, 0x7375202c, 0x64602065, 0x2e617461, 0x3d206978, 0x6c66203d, 0x3274616f, 0x302c3028, 0x0d2e6029, 
-    0x410a0d0a, 0x72657466, 0x6c616320, 0x676e696c, 0x69687420, 0x75662073, 0x6974636e, 0x202c6e6f, 0x20756f79, 
-    0x756f6873, 0x6320646c, 0x6b636568, 0x20666920, 0x74616460, 0x76652e61, 0x5f746e65, 0x65707974, 0x73692060, 
-    0x42600a0d, 0x5f464453, 0x4e455645, 0x42415f54, 0x42524f53, 0x49202e60, 0x6f732066, 0x6874202c, 0x61732065, 
-    0x696c706d, 0x6320676e, 0x2065646f, 0x706d6173, 0x2064656c, 0x69642061, 0x74636572, 0x206e6f69, 0x6f6c6562, 
-    0x68742077, 0x730a0d65, 0x61667275, 0x202c6563, 0x20646e61, 0x20656874, 0x6867696c, 0x61702074, 0x65206874, 
-    0x2073646e, 0x65726568, 0x74692820, 0x6f687320, 0x20646c75, 0x74206562, 0x74616572, 0x61206465, 0x20612073, 
-    0x6c666572, 0x61746365, 0x2065636e, 0x3020666f, 0x0a0d2e29, 0x68540a0d, 0x63207369, 0x2065646f, 0x6e6e6163, 
-    0x6320746f, 0x65727275, 0x796c746e, 0x74657220, 0x206e7275, 0x44502061, 0x666f2046, 0x49446020, 0x60434152, 
-    0x7562202c, 0x68742074, 0x6d207461, 0x74686769, 0x61686320, 0x2065676e, 0x0a0d6e69, 0x20656874, 0x75747566, 
-    0x0d2e6572, 0x2d2d2d0a, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2f2a2d2d, 0x6f760a0d, 
-    0x62206469, 0x53666473, 0x6c706d61, 0x6d695365, 0x28656c70, 0x554f4e49, 0x59545f54, 0x42284550, 0x53666473, 
-    0x6c706d61, 0x74614465, 0x64202961, 0x2c617461, 0x72625020, 0x6574614d, 0x6c616972, 0x74616d20, 0x7b0a0d29, 
-    0x20200a0d, 0x616f6c66, 0x74203374, 0x20746e69, 0x20202020, 0x3d202020, 0x74616d20, 0x7361622e, 0x6c6f4365, 
-    0x0d3b726f, 0x6420200a, 0x2e617461, 0x66647362, 0x65766f5f, 0x64705f72, 0x203d2066, 0x616f6c66, 0x30283374, 
-    0x2946302e, 0x0d0a0d3b, 0x6620200a, 0x74616f6c, 0x316b6e20, 0x63203d20, 0x706d616c, 0x6f446465, 0x616d2874, 
-    0x2c4e2e74, 0x74616420, 0x316b2e61, 0x0a0d3b29, 0x66692020, 0x74616428, 0x69782e61, 0x3c207a2e, 0x7362203d, 
-    0x69536664, 0x656c706d, 0x736f6c47, 0x72507973, 0x6261626f, 0x74696c69, 0x6b6e2879, 0x6d202c31, 0x6d2e7461, 
-    0x6c617465, 0x2963696c, 0x200a0d29, 0x0a0d7b20, 0x20202020, 0x47202f2f, 0x73736f6c, 0x47472079, 0x200a0d58, 
-    0x64202020, 0x2e617461, 0x6e657665, 0x79745f74, 0x3d206570, 0x44534220, 0x56455f46, 0x5f544e45, 0x534f4c47, 
-    0x525f5953, 0x454c4645, 0x4f495443, 0x0a0d3b4e, 0x20202020, 0x54202f2f, 0x736e6172, 0x6d726f66, 0x206f7420, 
-    0x61636f6c, 0x7073206c, 0x0d656361, 0x2020200a, 0x6f6c6620, 0x20337461, 0x61636f6c, 0x20314b6c, 0x3d202020, 
-    0x6f6c6620, 0x28337461, 0x28746f64, 0x2e74616d, 0x64202c54, 0x2e617461, 0x2c29316b, 0x746f6420, 0x74616d28, 
-    0x202c422e, 0x61746164, 0x29316b2e, 0x6b6e202c, 0x0d3b2931, 0x2020200a, 0x6f6c6620, 0x20337461, 0x666c6168, 
-    0x74636556, 0x3d20726f, 0x64766820, 0x7867675f, 0x6d61735f, 0x5f656c70, 0x66646e76, 0x636f6c28, 0x314b6c61, 
-    0x616d202c, 0x6f722e74, 0x6e686775, 0x2c737365, 0x74616420, 0x69782e61, 0x2979782e, 0x200a0d3b, 0x2f202020, 
-    0x7254202f, 0x66736e61, 0x206d726f, 0x6d6f7266, 0x636f6c20, 0x73206c61, 0x65636170, 0x20200a0d, 0x61682020, 
-    0x6556666c, 0x726f7463, 0x6d203d20, 0x542e7461, 0x68202a20, 0x56666c61, 0x6f746365, 0x20782e72, 0x616d202b, 
-    0x20422e74, 0x6168202a, 0x6556666c, 0x726f7463, 0x2b20792e, 0x74616d20, 0x2a204e2e, 0x6c616820, 0x63655666, 
-    0x2e726f74, 0x0a0d3b7a, 0x20202020, 0x61746164, 0x20326b2e, 0x3d202020, 0x66657220, 0x7463656c, 0x61642d28, 
-    0x6b2e6174, 0x68202c31, 0x56666c61, 0x6f746365, 0x0d3b2972, 0x7d20200a, 0x20200a0d, 0x65736c65, 0x20200a0d, 
-    0x200a0d7b, 0x2f202020, 0x6944202f, 0x73756666, 0x200a0d65, 0x64202020, 0x2e617461, 0x6e657665, 0x79745f74, 
-    0x3d206570, 0x44534220, 0x56455f46, 0x5f544e45, 0x46464944, 0x5f455355, 0x4c464552, 0x49544345, 0x0d3b4e4f, 
-    0x2020200a, 0x6f6c6620, 0x20337461, 0x61636f6c, 0x7269446c, 0x63203d20, 0x6e69736f, 0x6d615365, 0x48656c70, 
-    0x73696d65, 0x72656870, 0x61642865, 0x782e6174, 0x2c782e69, 0x74616420, 0x69782e61, 0x3b29792e, 0x20200a0d, 
-    0x61642020, 0x6b2e6174, 0x20202032, 0x20202020, 0x203d2020, 0x2e74616d, 0x202a2054, 0x61636f6c, 0x7269446c, 
-    0x2b20782e, 0x74616d20, 0x2a20422e, 0x636f6c20, 0x69446c61, 0x20792e72, 0x616d202b, 0x204e2e74, 0x6f6c202a, 
-    0x446c6163, 0x7a2e7269, 0x200a0d3b, 0x0a0d7d20, 0x20200a0d, 0x66647342, 0x6c617645, 0x65746175, 0x61746144, 
-    0x61766520, 0x7461446c, 0x0a0d3b61, 0x76652020, 0x61446c61, 0x6b2e6174, 0x203d2031, 0x61746164, 0x3b316b2e, 
-    0x20200a0d, 0x6c617665, 0x61746144, 0x20326b2e, 0x6164203d, 0x6b2e6174, 0x0a0d3b32, 0x73622020, 0x76456664, 
-    0x61756c61, 0x69536574, 0x656c706d, 0x61766528, 0x7461446c, 0x6d202c61, 0x3b297461, 0x20200a0d, 0x61746164, 
-    0x6664702e, 0x20202020, 0x20202020, 0x203d2020, 0x6c617665, 0x61746144, 0x6664702e, 0x200a0d3b, 0x6f6c6620, 
-    0x20337461, 0x66647362, 0x746f745f, 0x3d206c61, 0x61766520, 0x7461446c, 0x73622e61, 0x645f6664, 0x75666669, 
-    0x2b206573, 0x61766520, 0x7461446c, 0x73622e61, 0x675f6664, 0x73736f6c, 0x0a0d3b79, 0x66692020, 0x74616428, 
-    0x64702e61, 0x3d3c2066, 0x302e3020, 0x31303030, 0x7c7c2046, 0x796e6120, 0x6e736928, 0x62286e61, 0x5f666473, 
-    0x61746f74, 0x2929296c, 0x20200a0d, 0x200a0d7b, 0x64202020, 0x2e617461, 0x66647362, 0x65766f5f, 0x64705f72, 
-    0x203d2066, 0x616f6c66, 0x30283374, 0x2966302e, 0x200a0d3b, 0x64202020, 0x2e617461, 0x6e657665, 0x79745f74, 
-    0x20206570, 0x203d2020, 0x46445342, 0x4556455f, 0x415f544e, 0x524f5342, 0x0a0d3b42, 0x0d7d2020, 0x6520200a, 
-    0x0d65736c, 0x7b20200a, 0x20200a0d, 0x61642020, 0x622e6174, 0x5f666473, 0x7265766f, 0x6664705f, 0x62203d20, 
-    0x5f666473, 0x61746f74, 0x202f206c, 0x61746164, 0x6664702e, 0x200a0d3b, 0x0a0d7d20, 0x0d0a0d7d, 0x2d2a2f0a, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x20230a0d, 0x636e7546, 0x6e6f6974, 
-    0x73626020, 0x69536664, 0x656c706d, 0x72657641, 0x52656761, 0x656c6665, 0x6e617463, 0x0d606563, 0x52203e0a, 
-    0x72757465, 0x7420736e, 0x61206568, 0x6f727070, 0x616d6978, 0x61206574, 0x61726576, 0x72206567, 0x656c6665, 
-    0x6e617463, 0x6f206563, 0x68742066, 0x69532065, 0x656c706d, 0x44534220, 0x2d2d2046, 0x61687420, 0x73692074, 
-    0x3e0a0d2c, 0x76616020, 0x67617265, 0x766f5f65, 0x6b5f7265, 0x28662832, 0x202c316b, 0x2929326b, 0x2d2d2060, 
-    0x20666920, 0x20584747, 0x6e646964, 0x6c207427, 0x2065736f, 0x72656e65, 0x0d2e7967, 0x540a0d0a, 0x20736968, 
-    0x75207369, 0x75666573, 0x6f66206c, 0x68742072, 0x73676e69, 0x6b696c20, 0x68742065, 0x61762065, 0x6e616972, 
-    0x72206563, 0x63756465, 0x6e6f6974, 0x676c6120, 0x7469726f, 0x69206d68, 0x540a0d6e, 0x73616d6f, 0x7453207a, 
-    0x6f686361, 0x6b616977, 0x2a207327, 0x636f7453, 0x74736168, 0x53206369, 0x65657263, 0x70532d6e, 0x20656361, 
-    0x6c666552, 0x69746365, 0x2a736e6f, 0x6573203b, 0x6c612065, 0x0a0d6f73, 0x2d796152, 0x63617254, 0x20676e69, 
-    0x736d6547, 0x202c3120, 0x70616863, 0x20726574, 0x202c3233, 0x6363412a, 0x74617275, 0x65522065, 0x542d6c61, 
-    0x20656d69, 0x63657053, 0x72616c75, 0x66655220, 0x7463656c, 0x736e6f69, 0x69770a0d, 0x52206874, 0x61696461, 
-    0x2065636e, 0x68636143, 0x2a676e69, 0x2d0a0d2e, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x0a0d2f2a, 0x616f6c66, 0x62203374, 0x53666473, 0x6c706d69, 0x65764165, 0x65676172, 0x6c666552, 
-    0x61746365, 0x2865636e, 0x616f6c66, 0x6b203374, 0x50202c31, 0x614d7262, 0x69726574, 0x6d206c61, 0x0d297461, 
-    0x0a0d7b0a, 0x6c662020, 0x2074616f, 0x6f644e20, 0x20205674, 0x20202020, 0x20202020, 0x3d202020, 0x616c6320, 
-    0x6465706d, 0x28746f44, 0x2e74616d, 0x6b202c4e, 0x0d3b2931, 0x6620200a, 0x74616f6c, 0x5f632020, 0x5f6e696d, 
-    0x6c666572, 0x61746365, 0x2065636e, 0x2e30203d, 0x3b463430, 0x20200a0d, 0x616f6c66, 0x66203374, 0x20202030, 
-    0x20202020, 0x20202020, 0x20202020, 0x6c203d20, 0x28707265, 0x616f6c66, 0x63283374, 0x6e696d5f, 0x6665725f, 
-    0x7463656c, 0x65636e61, 0x6d202c29, 0x622e7461, 0x43657361, 0x726f6c6f, 0x616d202c, 0x656d2e74, 0x6c6c6174, 
-    0x3b296369, 0x20200a0d, 0x54202f2f, 0x20736968, 0x61207369, 0x6f727070, 0x616d6978, 0x62206574, 0x75616365, 
-    0x0a0d6573, 0x2f2f2020, 0x65766120, 0x65676172, 0x65766f5f, 0x326b5f72, 0x65726628, 0x6c656e73, 0x2c306628, 
-    0x302e3120, 0x56202c66, 0x48746f64, 0x21202929, 0x7266203d, 0x656e7365, 0x3066286c, 0x2e31202c, 0x202c6630, 
-    0x746f644e, 0x0d2e2956, 0x6620200a, 0x74616f6c, 0x73622033, 0x675f6664, 0x73736f6c, 0x76615f79, 0x67617265, 
-    0x203d2065, 0x6c686373, 0x466b6369, 0x6e736572, 0x66286c65, 0x66202c30, 0x74616f6c, 0x2e312833, 0x2c294630, 
-    0x6f644e20, 0x3b295674, 0x20200a0d, 0x616f6c66, 0x62203374, 0x5f666473, 0x66666964, 0x5f657375, 0x72657661, 
-    0x20656761, 0x616d203d, 0x61622e74, 0x6f436573, 0x20726f6c, 0x6373202a, 0x63696c68, 0x6572466b, 0x6c656e73, 
-    0x302e3128, 0x202d2046, 0x696d5f63, 0x65725f6e, 0x63656c66, 0x636e6174, 0x30202c65, 0x2c46302e, 0x6f644e20, 
-    0x20295674, 0x3128202a, 0x2046302e, 0x616d202d, 0x656d2e74, 0x6c6c6174, 0x3b296369, 0x20200a0d, 0x75746572, 
-    0x62206e72, 0x5f666473, 0x736f6c67, 0x615f7973, 0x61726576, 0x2b206567, 0x64736220, 0x69645f66, 0x73756666, 
-    0x76615f65, 0x67617265, 0x0a0d3b65, 0x0d0a0d7d, 0x6e75230a, 0x20666564, 0x5f54554f, 0x45505954, 0x75230a0d, 
-    0x6665646e, 0x4f4e4920, 0x545f5455, 0x0d455059, 0x6e75230a, 0x20666564, 0x41525241, 0x59545f59, 0x0a0d4550, 
-    0x65230a0d, 0x6669646e, 0x2f2f2020, 0x56564e20, 0x5f4c484b, 0x46445342, 0x4e55465f, 0x4f495443, 0x485f534e, 
-    0x00000a0d, 0x00120007, 0x00000016, 0x575c3a46, 0x6f646e69, 0x445c7377, 0x746b7365, 0x6e5c706f, 0x6f727076, 
-    0x726f635f, 0x6e5c3265, 0x61687376, 0x73726564, 0x6473625c, 0x75665f66, 0x6974636e, 0x2e736e6f, 0x6c732e68, 
-    0x00676e61, 0x10b40007, 0x00000017, 0x0a0d2a2f, 0x43202a20, 0x7279706f, 0x74686769, 0x29632820, 0x32303220, 
-    0x30322d32, 0x202c3532, 0x4449564e, 0x43204149, 0x4f50524f, 0x49544152, 0x202e4e4f, 0x6c6c4120, 0x67697220, 
-    0x20737468, 0x65736572, 0x64657672, 0x200a0d2e, 0x200a0d2a, 0x694c202a, 0x736e6563, 0x75206465, 0x7265646e, 
-    0x65687420, 0x61704120, 0x20656863, 0x6563694c, 0x2c65736e, 0x72655620, 0x6e6f6973, 0x302e3220, 0x68742820, 
-    0x4c222065, 0x6e656369, 0x29226573, 0x200a0d3b, 0x6f79202a, 0x616d2075, 0x6f6e2079, 0x73752074, 0x68742065, 
-    0x66207369, 0x20656c69, 0x65637865, 0x69207470, 0x6f63206e, 0x696c706d, 0x65636e61, 0x74697720, 0x68742068, 
-    0x694c2065, 0x736e6563, 0x0a0d2e65, 0x59202a20, 0x6d20756f, 0x6f207961, 0x69617462, 0x2061206e, 0x79706f63, 
-    0x20666f20, 0x20656874, 0x6563694c, 0x2065736e, 0x0a0d7461, 0x0a0d2a20, 0x20202a20, 0x68202020, 0x3a707474, 
-    0x77772f2f, 0x70612e77, 0x65686361, 0x67726f2e, 0x63696c2f, 0x65736e65, 0x494c2f73, 0x534e4543, 0x2e322d45, 
-    0x200a0d30, 0x200a0d2a, 0x6e55202a, 0x7373656c, 0x71657220, 0x65726975, 0x79622064, 0x70706120, 0x6163696c, 
-    0x20656c62, 0x2077616c, 0x6120726f, 0x65657267, 0x6f742064, 0x206e6920, 0x74697277, 0x2c676e69, 0x666f7320, 
-    0x72617774, 0x200a0d65, 0x6964202a, 0x69727473, 0x65747562, 0x6e752064, 0x20726564, 0x20656874, 0x6563694c, 
-    0x2065736e, 0x64207369, 0x72747369, 0x74756269, 0x6f206465, 0x6e61206e, 0x53412220, 0x22534920, 0x53414220, 
-    0x0d2c5349, 0x202a200a, 0x48544957, 0x2054554f, 0x52524157, 0x49544e41, 0x4f205345, 0x4f432052, 0x5449444e, 
-    0x534e4f49, 0x20464f20, 0x20594e41, 0x444e494b, 0x6965202c, 0x72656874, 0x70786520, 0x73736572, 0x20726f20, 
-    0x6c706d69, 0x2e646569, 0x2a200a0d, 0x65655320, 0x65687420, 0x63694c20, 0x65736e65, 0x726f6620, 0x65687420, 
-    0x65707320, 0x69666963, 0x616c2063, 0x6175676e, 0x67206567, 0x7265766f, 0x676e696e, 0x72657020, 0x7373696d, 
-    0x736e6f69, 0x646e6120, 0x2a200a0d, 0x6d696c20, 0x74617469, 0x736e6f69, 0x646e7520, 0x74207265, 0x4c206568, 
-    0x6e656369, 0x0d2e6573, 0x0d2a200a, 0x202a200a, 0x58445053, 0x6c69462d, 0x706f4365, 0x67697279, 0x65547468, 
-    0x203a7478, 0x79706f43, 0x68676972, 0x63282074, 0x30322029, 0x322d3232, 0x2c353230, 0x49564e20, 0x20414944, 
-    0x50524f43, 0x5441524f, 0x2e4e4f49, 0x2a200a0d, 0x44505320, 0x694c2d58, 0x736e6563, 0x64492d65, 0x69746e65, 
-    0x72656966, 0x7041203a, 0x65686361, 0x302e322d, 0x2a200a0d, 0x0d0a0d2f, 0x230a0d0a, 0x646e6669, 0x4e206665, 
-    0x484b5656, 0x47475f4c, 0x0d485f58, 0x6564230a, 0x656e6966, 0x56564e20, 0x5f4c484b, 0x5f584747, 0x0d312048, 
-    0x2f0a0d0a, 0x2d2d2d2a, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d2d2d, 0x65776f4c, 
-    0x656c2d72, 0x206c6576, 0x6874616d, 0x74616d65, 0x6c616369, 0x6e756620, 0x6f697463, 0x7520736e, 0x20646573, 
-    0x20726f66, 0x46445342, 0x54202e73, 0x20736968, 0x656c6966, 0x20736920, 0x656d616e, 0x66612064, 0x20726574, 
-    0x0d656874, 0x5847470a, 0x726f6e20, 0x206c616d, 0x74736964, 0x75626972, 0x6e6f6974, 0x6877202c, 0x20686369, 
-    0x74207369, 0x62206568, 0x73697361, 0x726f6620, 0x63756d20, 0x666f2068, 0x76766e20, 0x2073276b, 0x46445342, 
-    0x646f6320, 0x62202c65, 0x0a0d7475, 0x6c636e69, 0x73656475, 0x65724620, 0x6c656e73, 0x6873202c, 0x776f6461, 
-    0x2d676e69, 0x6b73616d, 0x2c676e69, 0x65687320, 0x202c6e65, 0x20646e61, 0x6e696874, 0x6c69662d, 0x7566206d, 
-    0x6974636e, 0x20736e6f, 0x77207361, 0x2e6c6c65, 0x2d2d0a0d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2a2d2d2d, 0x0d0a0d2f, 0x6e69230a, 0x64756c63, 0x63222065, 0x74736e6f, 0x73746e61, 0x732e682e, 
-    0x676e616c, 0x0d0a0d22, 0x6669230a, 0x20666564, 0x70635f5f, 0x7073756c, 0x0d73756c, 0x6564230a, 0x656e6966, 
-    0x54554f20, 0x5059545f, 0x29542845, 0x0d265420, 0x6564230a, 0x656e6966, 0x4f4e4920, 0x545f5455, 0x28455059, 
-    0x54202954, 0x230a0d26, 0x65736c65, 0x69230a0d, 0x65646e66, 0x554f2066, 0x59545f54, 0x0a0d4550, 0x66656423, 
-    0x20656e69, 0x5f54554f, 0x45505954, 0x20295428, 0x2074756f, 0x230a0d54, 0x69646e65, 0x230a0d66, 0x646e6669, 
-    0x49206665, 0x54554f4e, 0x5059545f, 0x230a0d45, 0x69666564, 0x4920656e, 0x54554f4e, 0x5059545f, 0x29542845, 
-    0x6f6e6920, 0x54207475, 0x65230a0d, 0x6669646e, 0x65230a0d, 0x6669646e, 0x0a0d0a0d, 0x53202f2f, 0x696c6863, 
-    0x46206b63, 0x6e736572, 0x61206c65, 0x6f727070, 0x616d6978, 0x6e6f6974, 0x6c660a0d, 0x2074616f, 0x6c686373, 
-    0x466b6369, 0x6e736572, 0x66286c65, 0x74616f6c, 0x2c304620, 0x6f6c6620, 0x46207461, 0x202c3039, 0x616f6c66, 
-    0x64562074, 0x2948746f, 0x0d7b0a0d, 0x7220200a, 0x72757465, 0x3046206e, 0x28202b20, 0x20303946, 0x3046202d, 
-    0x202a2029, 0x28776f70, 0x46302e31, 0x56202d20, 0x48746f64, 0x2e35202c, 0x3b294630, 0x0d7d0a0d, 0x2f0a0d0a, 
-    0x6353202f, 0x63696c68, 0x7246206b, 0x656e7365, 0x7061206c, 0x786f7270, 0x74616d69, 0x206e6f69, 0x20726f66, 
-    0x74636576, 0x0d73726f, 0x6f6c660a, 0x20337461, 0x6c686373, 0x466b6369, 0x6e736572, 0x66286c65, 0x74616f6c, 
-    0x30462033, 0x6c66202c, 0x3374616f, 0x30394620, 0x6c66202c, 0x2074616f, 0x746f6456, 0x0a0d2948, 0x200a0d7b, 
-    0x74657220, 0x206e7275, 0x2b203046, 0x39462820, 0x202d2030, 0x20293046, 0x6f70202a, 0x2e312877, 0x2d204630, 
-    0x6f645620, 0x202c4874, 0x46302e35, 0x0a0d3b29, 0x0d0a0d7d, 0x202f2f0a, 0x6c686353, 0x206b6369, 0x73657246, 
-    0x206c656e, 0x72707061, 0x6d69786f, 0x6f697461, 0x6f66206e, 0x6c662072, 0x0d74616f, 0x6f6c660a, 0x73207461, 
-    0x696c6863, 0x72466b63, 0x656e7365, 0x6c66286c, 0x2074616f, 0x2c726f69, 0x6f6c6620, 0x56207461, 0x48746f64, 
-    0x7b0a0d29, 0x20200a0d, 0x43202f2f, 0x75636c61, 0x6574616c, 0x66657220, 0x7463656c, 0x65636e61, 0x20746120, 
-    0x6d726f6e, 0x69206c61, 0x6469636e, 0x65636e65, 0x30522820, 0x200a0d29, 0x6f6c6620, 0x52207461, 0x203d2030, 
-    0x28776f70, 0x302e3128, 0x202d2046, 0x29726f69, 0x28202f20, 0x46302e31, 0x69202b20, 0x2c29726f, 0x302e3220, 
-    0x0d3b2946, 0x200a0d0a, 0x202f2f20, 0x73657246, 0x206c656e, 0x6c666572, 0x61746365, 0x2065636e, 0x6e697375, 
-    0x63532067, 0x63696c68, 0x2073276b, 0x72707061, 0x6d69786f, 0x6f697461, 0x200a0d6e, 0x74657220, 0x206e7275, 
-    0x2b203052, 0x2e312820, 0x2d204630, 0x29305220, 0x70202a20, 0x3128776f, 0x2046302e, 0x6456202d, 0x2c48746f, 
-    0x302e3520, 0x0d3b2946, 0x0a0d7d0a, 0x0a0d0a0d, 0x2d2d2f2f, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2f0a0d2d, 0x444d202f, 0x61622d4c, 0x20646573, 0x636e7566, 
-    0x6e6f6974, 0x2f0a0d73, 0x2d2d2d2f, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d0a0d, 0x4d202f2f, 0x74207869, 0x63206f77, 0x726f6c6f, 0x69772073, 0x61206874, 
-    0x63616620, 0x0d726f74, 0x6f6c660a, 0x20337461, 0x5f78696d, 0x28626772, 0x736e6f63, 0x6c662074, 0x3374616f, 
-    0x73616220, 0x63202c65, 0x74736e6f, 0x6f6c6620, 0x20337461, 0x6579616c, 0x63202c72, 0x74736e6f, 0x6f6c6620, 
-    0x20337461, 0x74636166, 0x0d29726f, 0x0a0d7b0a, 0x65722020, 0x6e727574, 0x2e312820, 0x2d206630, 0x78616d20, 
-    0x63616628, 0x2e726f74, 0x6d202c78, 0x66287861, 0x6f746361, 0x2c792e72, 0x63616620, 0x2e726f74, 0x2929297a, 
-    0x62202a20, 0x20657361, 0x6166202b, 0x726f7463, 0x6c202a20, 0x72657961, 0x7d0a0d3b, 0x0a0d0a0d, 0x53202f2f, 
-    0x72617571, 0x68742065, 0x6e692065, 0x0d747570, 0x6f6c660a, 0x73207461, 0x66287271, 0x74616f6c, 0x0d297820, 
-    0x0a0d7b0a, 0x65722020, 0x6e727574, 0x2a207820, 0x0d3b7820, 0x0a0d7d0a, 0x2f2f0a0d, 0x65684320, 0x66206b63, 
-    0x7420726f, 0x6c61746f, 0x746e6920, 0x616e7265, 0x6572206c, 0x63656c66, 0x6e6f6974, 0x6b60202e, 0x69206068, 
-    0x68742073, 0x6f642065, 0x72702074, 0x6375646f, 0x666f2074, 0x65687420, 0x65697620, 0x2f0a0d77, 0x6576202f, 
-    0x726f7463, 0x646e6120, 0x65687420, 0x6c616820, 0x65762066, 0x726f7463, 0x620a0d2e, 0x206c6f6f, 0x49547369, 
-    0x6f632852, 0x2074736e, 0x616f6c66, 0x69203274, 0x202c726f, 0x736e6f63, 0x6c662074, 0x2074616f, 0x0d29686b, 
-    0x0a0d7b0a, 0x6f632020, 0x2074736e, 0x616f6c66, 0x20622074, 0x6f69203d, 0x20782e72, 0x6f69202f, 0x3b792e72, 
-    0x20200a0d, 0x75746572, 0x28206e72, 0x66302e31, 0x28203c20, 0x202a2062, 0x202a2062, 0x302e3128, 0x202d2066, 
-    0x2a20686b, 0x29686b20, 0x0d3b2929, 0x0a0d7d0a, 0x0a0d0a0d, 0x2d2d2a2f, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x0d2d2d2d, 0x4620230a, 0x74636e75, 0x206e6f69, 0x64766860, 0x7867675f, 0x6176655f, 
-    0x0a0d606c, 0x7645203e, 0x61756c61, 0x20736574, 0x73696e61, 0x6f72746f, 0x20636970, 0x20584747, 0x74736964, 
-    0x75626972, 0x6e6f6974, 0x206e6f20, 0x20656874, 0x2d6e6f6e, 0x6a6f7270, 0x65746365, 0x65682064, 0x7073696d, 
-    0x65726568, 0x2e692820, 0x0a0d2e65, 0x7a2b203e, 0x20736920, 0x0d297075, 0x2d2d2d0a, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2f2a2d2d, 0x6c660a0d, 0x2074616f, 0x5f647668, 0x5f786767, 0x6c617665, 
-    0x6e6f6328, 0x66207473, 0x74616f6c, 0x6e692032, 0x756f5276, 0x656e6867, 0x0d2c7373, 0x2020200a, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x736e6f63, 0x6c662074, 0x3374616f, 0x20296820, 0x202f2f20, 0x66203d3d, 
-    0x74616f6c, 0x6f642833, 0x61742874, 0x6e65676e, 0x68202c74, 0x64202c29, 0x6228746f, 0x6e617469, 0x746e6567, 
-    0x2968202c, 0x6f64202c, 0x6f6e2874, 0x6c616d72, 0x2968202c, 0x7b0a0d29, 0x20200a0d, 0x736e6f63, 0x6c662074, 
-    0x2074616f, 0x20202078, 0x203d2020, 0x20782e68, 0x6e69202a, 0x756f5276, 0x656e6867, 0x782e7373, 0x200a0d3b, 
-    0x6e6f6320, 0x66207473, 0x74616f6c, 0x20207920, 0x3d202020, 0x792e6820, 0x69202a20, 0x6f52766e, 0x6e686775, 
-    0x2e737365, 0x0a0d3b79, 0x6f632020, 0x2074736e, 0x616f6c66, 0x6e612074, 0x206f7369, 0x2078203d, 0x2078202a, 
-    0x2079202b, 0x3b79202a, 0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x20202066, 0x203d2020, 0x73696e61, 
-    0x202b206f, 0x207a2e68, 0x2e68202a, 0x0a0d3b7a, 0x20200a0d, 0x75746572, 0x4d206e72, 0x505f315f, 0x202a2049, 
-    0x52766e69, 0x6867756f, 0x7373656e, 0x2a20782e, 0x766e6920, 0x67756f52, 0x73656e68, 0x20792e73, 0x2e68202a, 
-    0x202f207a, 0x2a206628, 0x3b296620, 0x0d7d0a0d, 0x2f0a0d0a, 0x2d2d2d2a, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d2d2d, 0x75462023, 0x6974636e, 0x60206e6f, 0x5f647668, 0x5f786767, 0x706d6173, 
-    0x765f656c, 0x6066646e, 0x203e0a0d, 0x706d6153, 0x2073656c, 0x706d6153, 0x2073656c, 0x69762061, 0x6c626973, 
-    0x53282065, 0x6874696d, 0x73616d2d, 0x2964656b, 0x6c616820, 0x65762066, 0x726f7463, 0x63636120, 0x6964726f, 
-    0x7420676e, 0x6874206f, 0x6e612065, 0x746f7369, 0x69706f72, 0x47472063, 0x69642058, 0x69727473, 0x69747562, 
-    0x0d2e6e6f, 0x530a0d0a, 0x45206565, 0x20636972, 0x74696548, 0x22202c7a, 0x69532041, 0x656c706d, 0x6e612072, 
-    0x78452064, 0x20746361, 0x706d6153, 0x676e696c, 0x756f5220, 0x656e6974, 0x726f6620, 0x65687420, 0x58474720, 
-    0x73694420, 0x62697274, 0x6f697475, 0x666f206e, 0x73695620, 0x656c6269, 0x726f4e20, 0x736c616d, 0x0a0d2e22, 
-    0x68540a0d, 0x6e692065, 0x20747570, 0x20646e61, 0x7074756f, 0x77207475, 0x206c6c69, 0x69206562, 0x6f6c206e, 
-    0x206c6163, 0x63617073, 0x0a0d3a65, 0x6f6c6660, 0x28337461, 0x28746f64, 0x6b202c54, 0x202c2931, 0x28746f64, 
-    0x6b202c42, 0x202c2931, 0x28746f64, 0x6b202c4e, 0x60292931, 0x2d0a0d2e, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d2f2a, 0x616f6c66, 0x68203374, 0x675f6476, 0x735f7867, 0x6c706d61, 
-    0x6e765f65, 0x66286664, 0x74616f6c, 0x2c6b2033, 0x6f6c6620, 0x20327461, 0x67756f72, 0x73656e68, 0x66202c73, 
-    0x74616f6c, 0x69782032, 0x7b0a0d29, 0x20200a0d, 0x736e6f63, 0x6c662074, 0x3374616f, 0x3d207620, 0x726f6e20, 
-    0x696c616d, 0x6628657a, 0x74616f6c, 0x2e6b2833, 0x202a2078, 0x67756f72, 0x73656e68, 0x2c782e73, 0x792e6b20, 
-    0x72202a20, 0x6867756f, 0x7373656e, 0x202c792e, 0x297a2e6b, 0x0a0d3b29, 0x20200a0d, 0x736e6f63, 0x6c662074, 
-    0x3374616f, 0x20317420, 0x7628203d, 0x3c207a2e, 0x392e3020, 0x39393939, 0x3f202966, 0x726f6e20, 0x696c616d, 
-    0x6328657a, 0x73736f72, 0x202c7628, 0x616f6c66, 0x30283374, 0x2c66302e, 0x302e3020, 0x31202c66, 0x2966302e, 
-    0x3a202929, 0x6f6c6620, 0x28337461, 0x66302e31, 0x2e30202c, 0x202c6630, 0x66302e30, 0x0a0d3b29, 0x6f632020, 
-    0x2074736e, 0x616f6c66, 0x74203374, 0x203d2032, 0x736f7263, 0x31742873, 0x2976202c, 0x0d0a0d3b, 0x6320200a, 
-    0x74736e6f, 0x6f6c6620, 0x61207461, 0x31203d20, 0x2066302e, 0x3128202f, 0x2066302e, 0x2e76202b, 0x0d3b297a, 
-    0x6320200a, 0x74736e6f, 0x6f6c6620, 0x72207461, 0x73203d20, 0x28747271, 0x782e6978, 0x0a0d3b29, 0x20200a0d, 
-    0x736e6f63, 0x6c662074, 0x2074616f, 0x20696870, 0x7828203d, 0x20792e69, 0x2961203c, 0x78203f20, 0x20792e69, 
-    0x2061202f, 0x5f4d202a, 0x3a204950, 0x505f4d20, 0x202b2049, 0x2e697828, 0x202d2079, 0x2f202961, 0x2e312820, 
-    0x2d206630, 0x20296120, 0x5f4d202a, 0x0d3b4950, 0x6620200a, 0x74616f6c, 0x20202020, 0x73202020, 0x3d202070, 
-    0x6e697320, 0x69687028, 0x0a0d3b29, 0x6c662020, 0x2074616f, 0x20202020, 0x70632020, 0x203d2020, 0x28736f63, 
-    0x29696870, 0x200a0d3b, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x20317020, 0x72203d20, 0x63202a20, 0x0a0d3b70, 
-    0x6f632020, 0x2074736e, 0x616f6c66, 0x32702074, 0x203d2020, 0x202a2072, 0x2a207073, 0x78282820, 0x20792e69, 
-    0x2961203c, 0x31203f20, 0x2066302e, 0x2e76203a, 0x0d3b297a, 0x200a0d0a, 0x6f6c6620, 0x20337461, 0x203d2068, 
-    0x2a203170, 0x20317420, 0x3270202b, 0x74202a20, 0x202b2032, 0x74727173, 0x78616d28, 0x302e3028, 0x31202c66, 
-    0x2066302e, 0x3170202d, 0x70202a20, 0x202d2031, 0x2a203270, 0x29327020, 0x202a2029, 0x0a0d3b76, 0x20200a0d, 
-    0x20782e68, 0x72203d2a, 0x6867756f, 0x7373656e, 0x0d3b782e, 0x6820200a, 0x2a20792e, 0x6f72203d, 0x6e686775, 
-    0x2e737365, 0x0a0d3b79, 0x2e682020, 0x203d207a, 0x2878616d, 0x66302e30, 0x2e68202c, 0x0d3b297a, 0x7220200a, 
-    0x72757465, 0x6f6e206e, 0x6c616d72, 0x28657a69, 0x0d3b2968, 0x0a0d7d0a, 0x6c660a0d, 0x2074616f, 0x74696d73, 
-    0x68735f68, 0x776f6461, 0x5f726f5f, 0x6b73616d, 0x6e6f6328, 0x66207473, 0x74616f6c, 0x2c6b2033, 0x6e6f6320, 
-    0x66207473, 0x74616f6c, 0x6f722032, 0x6e686775, 0x29737365, 0x0d7b0a0d, 0x6620200a, 0x74616f6c, 0x327a6b20, 
-    0x6b203d20, 0x2a207a2e, 0x7a2e6b20, 0x200a0d3b, 0x28666920, 0x20327a6b, 0x30203d3d, 0x2966302e, 0x20200a0d, 
-    0x200a0d7b, 0x72202020, 0x72757465, 0x2e30206e, 0x203b6630, 0x202f2f20, 0x61746f54, 0x20796c6c, 0x64616873, 
-    0x6465776f, 0x20200a0d, 0x200a0d7d, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x20786120, 0x20202020, 0x2e6b203d, 
-    0x202a2078, 0x67756f72, 0x73656e68, 0x3b782e73, 0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x20207961, 
-    0x3d202020, 0x792e6b20, 0x72202a20, 0x6867756f, 0x7373656e, 0x0d3b792e, 0x6320200a, 0x74736e6f, 0x6f6c6620, 
-    0x69207461, 0x615f766e, 0x203d2032, 0x20786128, 0x7861202a, 0x61202b20, 0x202a2079, 0x20297961, 0x7a6b202f, 
-    0x0a0d3b32, 0x20200a0d, 0x75746572, 0x32206e72, 0x2066302e, 0x3128202f, 0x2066302e, 0x7173202b, 0x31287472, 
-    0x2066302e, 0x6e69202b, 0x32615f76, 0x0d3b2929, 0x0a0d7d0a, 0x2a2f0a0d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x230a0d2d, 0x6e754620, 0x6f697463, 0x6760206e, 0x735f7867, 0x6874696d, 
-    0x6168735f, 0x5f776f64, 0x6b73616d, 0x3e0a0d60, 0x65685420, 0x636e7520, 0x6572726f, 0x6574616c, 0x6d532064, 
-    0x20687469, 0x64616873, 0x6e69776f, 0x616d2d67, 0x6e696b73, 0x75662067, 0x6974636e, 0x0d2e6e6f, 0x4e0a0d0a, 
-    0x2065746f, 0x74616874, 0x65687420, 0x696f6a20, 0x5320746e, 0x6874696d, 0x61687320, 0x69776f64, 0x6d2d676e, 
-    0x696b7361, 0x6620676e, 0x74636e75, 0x206e6f69, 0x2079616d, 0x6d206562, 0x2065726f, 0x6c616572, 0x69747369, 
-    0x0a0d2e63, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0d2f2a2d, 0x6f6c660a, 
-    0x67207461, 0x735f7867, 0x6874696d, 0x6168735f, 0x5f776f64, 0x6b73616d, 0x54554f28, 0x5059545f, 0x6c662845, 
-    0x2974616f, 0x2c314720, 0x54554f20, 0x5059545f, 0x6c662845, 0x2974616f, 0x2c324720, 0x6e6f6320, 0x66207473, 
-    0x74616f6c, 0x316b2033, 0x6f63202c, 0x2074736e, 0x616f6c66, 0x6b203374, 0x63202c32, 0x74736e6f, 0x6f6c6620, 
-    0x20327461, 0x67756f72, 0x73656e68, 0x0a0d2973, 0x200a0d7b, 0x20314720, 0x6d73203d, 0x5f687469, 0x64616873, 
-    0x6f5f776f, 0x616d5f72, 0x6b286b73, 0x72202c31, 0x6867756f, 0x7373656e, 0x0a0d3b29, 0x32472020, 0x73203d20, 
-    0x6874696d, 0x6168735f, 0x5f776f64, 0x6d5f726f, 0x286b7361, 0x202c326b, 0x67756f72, 0x73656e68, 0x0d3b2973, 
-    0x200a0d0a, 0x74657220, 0x206e7275, 0x2a203147, 0x3b324720, 0x0d7d0a0d, 0x0d0a0d0a, 0x202f2f0a, 0x706d6f43, 
-    0x73657475, 0x65687420, 0x75717320, 0x64657261, 0x726f6e20, 0x666f206d, 0x702f7320, 0x6c6f7020, 0x7a697261, 
-    0x46206465, 0x6e736572, 0x72206c65, 0x656c6665, 0x6f697463, 0x6f63206e, 0x69666665, 0x6e656963, 0x61207374, 
-    0x7020646e, 0x65736168, 0x69687320, 0x20737466, 0x63206e69, 0x6c706d6f, 0x75207865, 0x2074696e, 0x63726963, 
-    0x0d2e656c, 0x0d2f2f0a, 0x202f2f0a, 0x20656553, 0x2078614d, 0x6e726f42, 0x646e6120, 0x696d4520, 0x6f57206c, 
-    0x202c666c, 0x69725022, 0x7069636e, 0x2073656c, 0x4f20666f, 0x63697470, 0x202c2273, 0x74636573, 0x206e6f69, 
-    0x342e3331, 0x0d2c312e, 0x202f2f0a, 0x206e4122, 0x6f736261, 0x6e696272, 0x69662067, 0x6f206d6c, 0x2061206e, 
-    0x6e617274, 0x72617073, 0x20746e65, 0x73627573, 0x74617274, 0x0d2e2265, 0x0d2f2f0a, 0x202f2f0a, 0x73696854, 
-    0x6d6f6320, 0x66207365, 0x206d6f72, 0x2c4c444d, 0x646e6120, 0x20736920, 0x69642061, 0x72656666, 0x20746e65, 
-    0x72707061, 0x6863616f, 0x61687420, 0x6874206e, 0x78652065, 0x6c706d61, 0x2f0a0d65, 0x6d69202f, 0x6d656c70, 
-    0x61746e65, 0x6e6f6974, 0x206e6920, 0x5f52484b, 0x6574616d, 0x6c616972, 0x72695f73, 0x73656469, 0x636e6563, 
-    0x0a0d2e65, 0x616f6c66, 0x66203274, 0x6e736572, 0x635f6c65, 0x75646e6f, 0x726f7463, 0x54554f28, 0x5059545f, 
-    0x6c662845, 0x3274616f, 0x68702029, 0x5f657361, 0x66696873, 0x69735f74, 0x0a0d2c6e, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x54554f20, 0x5059545f, 0x6c662845, 0x3274616f, 0x68702029, 
-    0x5f657361, 0x66696873, 0x6f635f74, 0x0a0d2c73, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x615f6e20, 0x200a0d2c, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x736e6f63, 0x6c662074, 0x2074616f, 0x2c625f6e, 0x20200a0d, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x63202020, 0x74736e6f, 0x6f6c6620, 0x6b207461, 0x0d2c625f, 
-    0x2020200a, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x6f632020, 0x2074736e, 0x616f6c66, 
-    0x6f632074, 0x2c615f73, 0x20200a0d, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x63202020, 
-    0x74736e6f, 0x6f6c6620, 0x73207461, 0x615f6e69, 0x6471735f, 0x7b0a0d29, 0x20200a0d, 0x736e6f63, 0x6c662074, 
-    0x2074616f, 0x32625f6b, 0x3d202020, 0x625f6b20, 0x6b202a20, 0x0d3b625f, 0x6320200a, 0x74736e6f, 0x6f6c6620, 
-    0x6e207461, 0x2032625f, 0x203d2020, 0x20625f6e, 0x5f6e202a, 0x0a0d3b62, 0x6f632020, 0x2074736e, 0x616f6c66, 
-    0x5f6e2074, 0x20203261, 0x6e203d20, 0x2a20615f, 0x615f6e20, 0x200a0d3b, 0x6e6f6320, 0x66207473, 0x74616f6c, 
-    0x706d7420, 0x20202030, 0x5f6e203d, 0x2d203262, 0x625f6b20, 0x0a0d3b32, 0x6f632020, 0x2074736e, 0x616f6c66, 
-    0x61682074, 0x555f666c, 0x30203d20, 0x2066352e, 0x7428202a, 0x2030706d, 0x5f6e202d, 0x2a203261, 0x6e697320, 
-    0x735f615f, 0x3b296471, 0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x666c6168, 0x3d20565f, 0x72717320, 
-    0x616d2874, 0x2e302878, 0x202c6630, 0x666c6168, 0x2a20555f, 0x6c616820, 0x20555f66, 0x5f6b202b, 0x2a203262, 
-    0x625f6e20, 0x3b292932, 0x0a0d0a0d, 0x6f632020, 0x2074736e, 0x616f6c66, 0x5f752074, 0x3d203262, 0x6c616820, 
-    0x20555f66, 0x6168202b, 0x565f666c, 0x200a0d3b, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x625f7620, 0x203d2032, 
-    0x666c6168, 0x2d20565f, 0x6c616820, 0x3b555f66, 0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x20625f75, 
-    0x73203d20, 0x28747271, 0x2878616d, 0x66302e30, 0x5f75202c, 0x29293262, 0x200a0d3b, 0x6e6f6320, 0x66207473, 
-    0x74616f6c, 0x625f7620, 0x203d2020, 0x74727173, 0x78616d28, 0x302e3028, 0x76202c66, 0x2932625f, 0x0a0d3b29, 
-    0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x31706d74, 0x74203d20, 0x2030706d, 0x6f63202a, 0x3b615f73, 
-    0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x32706d74, 0x6e203d20, 0x2a20615f, 0x625f7520, 0x200a0d3b, 
-    0x6e6f6320, 0x66207473, 0x74616f6c, 0x706d7420, 0x203d2033, 0x302e3228, 0x202a2066, 0x20625f6e, 0x5f6b202a, 
-    0x2a202962, 0x736f6320, 0x0d3b615f, 0x6320200a, 0x74736e6f, 0x6f6c6620, 0x74207461, 0x2034706d, 0x5f6e203d, 
-    0x202a2061, 0x3b625f76, 0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x35706d74, 0x6e203d20, 0x2a20615f, 
-    0x736f6320, 0x0d3b615f, 0x200a0d0a, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x706d7420, 0x203d2036, 0x302e3228, 
-    0x202a2066, 0x35706d74, 0x202a2029, 0x3b625f76, 0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x37706d74, 
-    0x28203d20, 0x32625f75, 0x76202b20, 0x2932625f, 0x74202d20, 0x2035706d, 0x6d74202a, 0x0d3b3570, 0x200a0d0a, 
-    0x6e6f6320, 0x66207473, 0x74616f6c, 0x706d7420, 0x203d2038, 0x302e3228, 0x202a2066, 0x35706d74, 0x202a2029, 
-    0x2e322828, 0x2a206630, 0x625f6e20, 0x6b202a20, 0x2029625f, 0x5f75202a, 0x202d2062, 0x30706d74, 0x76202a20, 
-    0x3b29625f, 0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x39706d74, 0x73203d20, 0x28287271, 0x32625f6e, 
-    0x6b202b20, 0x2932625f, 0x63202a20, 0x615f736f, 0x202d2029, 0x32615f6e, 0x28202a20, 0x32625f75, 0x76202b20, 
-    0x2932625f, 0x0d0a0d3b, 0x6320200a, 0x74736e6f, 0x6f6c6620, 0x74207461, 0x3736706d, 0x20202020, 0x203d2020, 
-    0x36706d74, 0x74202a20, 0x2036706d, 0x6d74202b, 0x2a203770, 0x706d7420, 0x0a0d3b37, 0x6f632020, 0x2074736e, 
-    0x616f6c66, 0x6e692074, 0x71735f76, 0x785f7472, 0x28203d20, 0x66302e30, 0x74203c20, 0x3736706d, 0x203f2029, 
-    0x302e3128, 0x202f2066, 0x74727173, 0x706d7428, 0x29293736, 0x30203a20, 0x3b66302e, 0x20200a0d, 0x736e6f63, 
-    0x6c662074, 0x2074616f, 0x38706d74, 0x20202039, 0x3d202020, 0x706d7420, 0x202a2038, 0x38706d74, 0x74202b20, 
-    0x2039706d, 0x6d74202a, 0x0d3b3970, 0x6320200a, 0x74736e6f, 0x6f6c6620, 0x69207461, 0x735f766e, 0x5f747271, 
-    0x203d2079, 0x302e3028, 0x203c2066, 0x38706d74, 0x3f202939, 0x2e312820, 0x2f206630, 0x72717320, 0x6d742874, 
-    0x29393870, 0x203a2029, 0x66302e30, 0x0d0a0d3b, 0x7020200a, 0x65736168, 0x6968735f, 0x635f7466, 0x3d20736f, 
-    0x6f6c6620, 0x28327461, 0x37706d74, 0x69202a20, 0x735f766e, 0x5f747271, 0x74202c78, 0x2039706d, 0x6e69202a, 
-    0x71735f76, 0x795f7472, 0x0a0d3b29, 0x68702020, 0x5f657361, 0x66696873, 0x69735f74, 0x203d206e, 0x616f6c66, 
-    0x74283274, 0x2036706d, 0x6e69202a, 0x71735f76, 0x785f7472, 0x6d74202c, 0x2a203870, 0x766e6920, 0x7271735f, 
-    0x29795f74, 0x0d0a0d3b, 0x7220200a, 0x72757465, 0x6c66206e, 0x3274616f, 0x71732828, 0x6d742872, 0x2d203570, 
-    0x625f7520, 0x202b2029, 0x32625f76, 0x202f2029, 0x72717328, 0x706d7428, 0x202b2035, 0x29625f75, 0x76202b20, 
-    0x2932625f, 0x200a0d2c, 0x20202020, 0x20202020, 0x20202020, 0x28202020, 0x28727173, 0x31706d74, 0x74202d20, 
-    0x2932706d, 0x73202b20, 0x74287271, 0x2033706d, 0x6d74202d, 0x29293470, 0x28202f20, 0x28727173, 0x31706d74, 
-    0x74202b20, 0x2932706d, 0x73202b20, 0x74287271, 0x2033706d, 0x6d74202b, 0x29293470, 0x0a0d3b29, 0x0d0a0d7d, 
-    0x2f0a0d0a, 0x6953202f, 0x696c706d, 0x64656966, 0x726f6620, 0x65696420, 0x7463656c, 0x2c636972, 0x206f6e20, 
-    0x73616870, 0x68732065, 0x20746669, 0x706d6f63, 0x74617475, 0x2e6e6f69, 0x6c660a0d, 0x3274616f, 0x65726620, 
-    0x6c656e73, 0x6569645f, 0x7463656c, 0x28636972, 0x736e6f63, 0x6c662074, 0x2074616f, 0x2c615f6e, 0x6e6f6320, 
-    0x66207473, 0x74616f6c, 0x625f6e20, 0x6f63202c, 0x2074736e, 0x616f6c66, 0x6f632074, 0x2c615f73, 0x6e6f6320, 
-    0x66207473, 0x74616f6c, 0x736f6320, 0x0d29625f, 0x0a0d7b0a, 0x6f632020, 0x2074736e, 0x616f6c66, 0x616e2074, 
-    0x3d206163, 0x615f6e20, 0x63202a20, 0x615f736f, 0x200a0d3b, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x63626e20, 
-    0x203d2062, 0x20625f6e, 0x6f63202a, 0x3b625f73, 0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x20735f72, 
-    0x28203d20, 0x6163616e, 0x6e202d20, 0x29626362, 0x28202f20, 0x6163616e, 0x6e202b20, 0x29626362, 0x0d0a0d3b, 
-    0x6320200a, 0x74736e6f, 0x6f6c6620, 0x6e207461, 0x20626361, 0x5f6e203d, 0x202a2061, 0x5f736f63, 0x0a0d3b62, 
-    0x6f632020, 0x2074736e, 0x616f6c66, 0x626e2074, 0x3d206163, 0x625f6e20, 0x63202a20, 0x615f736f, 0x200a0d3b, 
-    0x6e6f6320, 0x66207473, 0x74616f6c, 0x705f7220, 0x203d2020, 0x63626e28, 0x202d2061, 0x6263616e, 0x202f2029, 
-    0x63626e28, 0x202b2061, 0x6263616e, 0x0a0d3b29, 0x20200a0d, 0x75746572, 0x66206e72, 0x74616f6c, 0x5f722832, 
-    0x202a2073, 0x2c735f72, 0x705f7220, 0x72202a20, 0x3b29705f, 0x0d7d0a0d, 0x0d0a0d0a, 0x6f6c660a, 0x20337461, 
-    0x6e696874, 0x6c69665f, 0x61665f6d, 0x726f7463, 0x6f6c6628, 0x63207461, 0x6974616f, 0x745f676e, 0x6b636968, 
-    0x7373656e, 0x6f63202c, 0x2074736e, 0x616f6c66, 0x6f632074, 0x6e697461, 0x6f695f67, 0x63202c72, 0x74736e6f, 
-    0x6f6c6620, 0x62207461, 0x5f657361, 0x2c726f69, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x636e6920, 0x6e696d6f, 
-    0x6f695f67, 0x63202c72, 0x74736e6f, 0x6f6c6620, 0x6b207461, 0x0a0d2968, 0x200a0d7b, 0x616f6320, 0x676e6974, 
-    0x6968745f, 0x656e6b63, 0x3d207373, 0x78616d20, 0x302e3028, 0x63202c66, 0x6974616f, 0x745f676e, 0x6b636968, 
-    0x7373656e, 0x0a0d3b29, 0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x306e6973, 0x7271735f, 0x203d2020, 
-    0x2878616d, 0x66302e30, 0x2e31202c, 0x2d206630, 0x20686b20, 0x686b202a, 0x0a0d3b29, 0x6f632020, 0x2074736e, 
-    0x616f6c66, 0x74652074, 0x20313061, 0x20202020, 0x6e69203d, 0x696d6f63, 0x695f676e, 0x2f20726f, 0x616f6320, 
-    0x676e6974, 0x726f695f, 0x200a0d3b, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x61746520, 0x735f3130, 0x3d207271, 
-    0x61746520, 0x2a203130, 0x61746520, 0x0d3b3130, 0x6320200a, 0x74736e6f, 0x6f6c6620, 0x73207461, 0x5f316e69, 
-    0x20727173, 0x65203d20, 0x31306174, 0x7271735f, 0x73202a20, 0x5f306e69, 0x3b727173, 0x0a0d0a0d, 0x66692020, 
-    0x302e3128, 0x203c2066, 0x316e6973, 0x7271735f, 0x2f202029, 0x4954202f, 0x74612052, 0x72696620, 0x69207473, 
-    0x7265746e, 0x65636166, 0x20200a0d, 0x200a0d7b, 0x72202020, 0x72757465, 0x6c66206e, 0x3374616f, 0x302e3128, 
-    0x0d3b2966, 0x7d20200a, 0x0a0d0a0d, 0x6f632020, 0x2074736e, 0x616f6c66, 0x63202074, 0x2031736f, 0x7173203d, 
-    0x6d287472, 0x30287861, 0x2c66302e, 0x302e3120, 0x202d2066, 0x316e6973, 0x7271735f, 0x0d3b2929, 0x6320200a, 
-    0x74736e6f, 0x6f6c6620, 0x20327461, 0x20313052, 0x66203d20, 0x6e736572, 0x645f6c65, 0x656c6569, 0x69727463, 
-    0x6e692863, 0x696d6f63, 0x695f676e, 0x202c726f, 0x74616f63, 0x5f676e69, 0x2c726f69, 0x2c686b20, 0x736f6320, 
-    0x0d3b2931, 0x200a0d0a, 0x6f6c6620, 0x20327461, 0x31696870, 0x69735f32, 0x70202c6e, 0x32316968, 0x736f635f, 
-    0x200a0d3b, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x31522032, 0x203d2032, 0x73657266, 0x5f6c656e, 0x646e6f63, 
-    0x6f746375, 0x68702872, 0x5f323169, 0x2c6e6973, 0x69687020, 0x635f3231, 0x202c736f, 0x74616f63, 0x5f676e69, 
-    0x2c726f69, 0x73616220, 0x6f695f65, 0x2f202c72, 0x6162202a, 0x6b5f6573, 0x2a203d20, 0x2e30202f, 0x202c6630, 
-    0x31736f63, 0x6973202c, 0x735f316e, 0x3b297271, 0x0a0d0a0d, 0x6f632020, 0x2074736e, 0x616f6c66, 0x6d742074, 
-    0x203d2070, 0x302e3428, 0x202a2066, 0x49505f4d, 0x202a2029, 0x74616f63, 0x5f676e69, 0x20726f69, 0x6f63202a, 
-    0x6e697461, 0x68745f67, 0x6e6b6369, 0x20737365, 0x6f63202a, 0x0d3b3173, 0x200a0d0a, 0x6e6f6320, 0x66207473, 
-    0x74616f6c, 0x31305220, 0x5f323152, 0x203d2073, 0x2878616d, 0x66302e30, 0x3052202c, 0x20782e31, 0x3152202a, 
-    0x29782e32, 0x200a0d3b, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x31307220, 0x5f323172, 0x203d2073, 0x74727173, 
-    0x31305228, 0x5f323152, 0x0d3b2973, 0x200a0d0a, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x31305220, 0x5f323152, 
-    0x203d2070, 0x2878616d, 0x66302e30, 0x3052202c, 0x20792e31, 0x3152202a, 0x29792e32, 0x200a0d3b, 0x6e6f6320, 
-    0x66207473, 0x74616f6c, 0x31307220, 0x5f323172, 0x203d2070, 0x74727173, 0x31305228, 0x5f323152, 0x0d3b2970, 
-    0x200a0d0a, 0x6f6c6620, 0x20337461, 0x207a7978, 0x6c66203d, 0x3374616f, 0x302e3028, 0x0d3b2966, 0x200a0d0a, 
-    0x212f2f20, 0x73752021, 0x20676e69, 0x20776f6c, 0x20736572, 0x6f6c6f63, 0x616d2072, 0x69686374, 0x6620676e, 
-    0x74636e75, 0x736e6f69, 0x72656820, 0x200a0d65, 0x6f6c6620, 0x6c207461, 0x64626d61, 0x696d5f61, 0x3d20206e, 
-    0x30303420, 0x3b66302e, 0x20200a0d, 0x616f6c66, 0x616c2074, 0x6164626d, 0x6574735f, 0x203d2070, 0x30372828, 
-    0x66302e30, 0x34202d20, 0x302e3030, 0x2f202966, 0x2e363120, 0x3b296630, 0x0a0d0a0d, 0x6f632020, 0x2074736e, 
-    0x616f6c66, 0x63203374, 0x785f6569, 0x315b7a79, 0x3d205d36, 0x307b7b20, 0x3932302e, 0x2c663638, 0x302e3020, 
-    0x30313330, 0x30202c66, 0x3633312e, 0x7d663930, 0x307b202c, 0x3730322e, 0x2c663531, 0x302e3020, 0x34303332, 
-    0x30202c66, 0x3539392e, 0x7d663438, 0x200a0d2c, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x2e307b20, 0x31373633, 0x202c6637, 0x36302e30, 0x66393634, 0x2e31202c, 0x35353938, 
-    0x2c7d6630, 0x2e307b20, 0x34353832, 0x202c6639, 0x33312e30, 0x66313636, 0x2e31202c, 0x33323736, 0x2c7d6636, 
-    0x20200a0d, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x302e307b, 
-    0x33333238, 0x30202c66, 0x3836322e, 0x2c663635, 0x372e3020, 0x33353636, 0x202c7d66, 0x302e307b, 0x33323731, 
-    0x30202c66, 0x3638342e, 0x2c663132, 0x322e3020, 0x39383831, 0x0d2c7d66, 0x2020200a, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x7b202020, 0x34312e30, 0x66303034, 0x2e30202c, 0x34333737, 
-    0x202c6631, 0x35302e30, 0x66363838, 0x7b202c7d, 0x30342e30, 0x66373539, 0x2e30202c, 0x35383539, 0x202c6630, 
-    0x31302e30, 0x66303832, 0x0a0d2c7d, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x307b2020, 0x3234372e, 0x2c663130, 0x392e3020, 0x37363937, 0x30202c66, 0x3030302e, 0x7d663036, 
-    0x317b202c, 0x3333302e, 0x2c663532, 0x382e3020, 0x31393534, 0x30202c66, 0x3030302e, 0x7d663030, 0x200a0d2c, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x2e317b20, 0x38333830, 
-    0x202c6635, 0x32362e30, 0x66323432, 0x2e30202c, 0x30303030, 0x2c7d6630, 0x2e307b20, 0x30323937, 0x202c6633, 
-    0x36332e30, 0x66393437, 0x2e30202c, 0x30303030, 0x2c7d6630, 0x20200a0d, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x332e307b, 0x31353738, 0x30202c66, 0x3136312e, 0x2c663533, 
-    0x302e3020, 0x30303030, 0x202c7d66, 0x312e307b, 0x31303433, 0x30202c66, 0x3235302e, 0x2c663839, 0x302e3020, 
-    0x30303030, 0x0d2c7d66, 0x2020200a, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x7b202020, 0x33302e30, 0x66313335, 0x2e30202c, 0x37333130, 0x202c6635, 0x30302e30, 0x66303030, 0x7b202c7d, 
-    0x30302e30, 0x66373138, 0x2e30202c, 0x31333030, 0x202c6637, 0x30302e30, 0x66303030, 0x0d3b7d7d, 0x200a0d0a, 
-    0x6f6c6620, 0x6c207461, 0x64626d61, 0x203d2061, 0x626d616c, 0x6d5f6164, 0x2b206e69, 0x352e3020, 0x202a2066, 
-    0x626d616c, 0x735f6164, 0x3b706574, 0x0a0d0a0d, 0x6f662020, 0x6e692872, 0x20692074, 0x3b30203d, 0x3c206920, 
-    0x3b363120, 0x692b2b20, 0x200a0d29, 0x0a0d7b20, 0x20202020, 0x736e6f63, 0x6c662074, 0x2074616f, 0x20696870, 
-    0x6d74203d, 0x202f2070, 0x626d616c, 0x0d3b6164, 0x200a0d0a, 0x66202020, 0x74616f6c, 0x69687020, 0x3d20735f, 
-    0x6e697320, 0x69687028, 0x0a0d3b29, 0x20202020, 0x616f6c66, 0x68702074, 0x20635f69, 0x6f63203d, 0x68702873, 
-    0x0d3b2969, 0x200a0d0a, 0x63202020, 0x74736e6f, 0x6f6c6620, 0x63207461, 0x705f736f, 0x735f6968, 0x70203d20, 
-    0x635f6968, 0x70202a20, 0x32316968, 0x736f635f, 0x2d20782e, 0x69687020, 0x2a20735f, 0x69687020, 0x735f3231, 
-    0x782e6e69, 0x2f20203b, 0x6f63202f, 0x2b612873, 0x3d202962, 0x736f6320, 0x20296128, 0x6f63202a, 0x29622873, 
-    0x73202d20, 0x61286e69, 0x202a2029, 0x286e6973, 0x0a0d2962, 0x20202020, 0x736e6f63, 0x6c662074, 0x2074616f, 
-    0x5f706d74, 0x20202073, 0x203d2020, 0x66302e32, 0x72202a20, 0x31723130, 0x20735f32, 0x6f63202a, 0x68705f73, 
-    0x3b735f69, 0x20200a0d, 0x6f632020, 0x2074736e, 0x616f6c66, 0x5f522074, 0x20202073, 0x20202020, 0x5228203d, 
-    0x782e3130, 0x52202b20, 0x782e3231, 0x74202b20, 0x735f706d, 0x202f2029, 0x302e3128, 0x202b2066, 0x52313052, 
-    0x735f3231, 0x74202b20, 0x735f706d, 0x0a0d3b29, 0x20200a0d, 0x6f632020, 0x2074736e, 0x616f6c66, 0x6f632074, 
-    0x68705f73, 0x20705f69, 0x6870203d, 0x20635f69, 0x6870202a, 0x5f323169, 0x2e736f63, 0x202d2079, 0x5f696870, 
-    0x202a2073, 0x31696870, 0x69735f32, 0x3b792e6e, 0x2f2f2020, 0x736f6320, 0x622b6128, 0x203d2029, 0x28736f63, 
-    0x2a202961, 0x736f6320, 0x20296228, 0x6973202d, 0x2961286e, 0x73202a20, 0x62286e69, 0x200a0d29, 0x63202020, 
-    0x74736e6f, 0x6f6c6620, 0x74207461, 0x705f706d, 0x20202020, 0x32203d20, 0x2066302e, 0x3072202a, 0x32317231, 
-    0x2a20705f, 0x736f6320, 0x6968705f, 0x0d3b705f, 0x2020200a, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x705f5220, 
-    0x20202020, 0x3d202020, 0x30522820, 0x20792e31, 0x3152202b, 0x20792e32, 0x6d74202b, 0x29705f70, 0x28202f20, 
-    0x66302e31, 0x52202b20, 0x31523130, 0x20705f32, 0x6d74202b, 0x29705f70, 0x0d0a0d3b, 0x2020200a, 0x7a797820, 
-    0x203d2b20, 0x5f656963, 0x5b7a7978, 0x2a205d69, 0x2e302820, 0x2a206635, 0x5f522820, 0x202b2073, 0x29705f52, 
-    0x0a0d3b29, 0x20200a0d, 0x616c2020, 0x6164626d, 0x203d2b20, 0x626d616c, 0x735f6164, 0x3b706574, 0x20200a0d, 
-    0x0d0a0d7d, 0x7820200a, 0x2a207a79, 0x3128203d, 0x2066302e, 0x3631202f, 0x2966302e, 0x0d0a0d3b, 0x2f20200a, 
-    0x2228202f, 0x6d726f6e, 0x7a696c61, 0x20226465, 0x68637573, 0x61687420, 0x68742074, 0x6f6c2065, 0x6620706f, 
-    0x6e20726f, 0x6873206f, 0x65746669, 0x61772064, 0x67206576, 0x73657669, 0x66657220, 0x7463656c, 0x74697669, 
-    0x31282079, 0x312c312c, 0x0a0d2929, 0x65722020, 0x6e727574, 0x616c6320, 0x6628706d, 0x74616f6c, 0x79782833, 
-    0x20782e7a, 0x3328202a, 0x3034322e, 0x2f206636, 0x342e3020, 0x30353333, 0x20296639, 0x7978202b, 0x20792e7a, 
-    0x2d28202a, 0x33352e31, 0x20663237, 0x2e30202f, 0x35333334, 0x29663930, 0x78202b20, 0x7a2e7a79, 0x28202a20, 
-    0x342e302d, 0x66363839, 0x30202f20, 0x3333342e, 0x66393035, 0x0a0d2c29, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x79782020, 0x20782e7a, 0x2d28202a, 0x36392e30, 0x20663938, 0x2e30202f, 0x35313433, 
-    0x29663238, 0x78202b20, 0x792e7a79, 0x28202a20, 0x37382e31, 0x20663835, 0x2e30202f, 0x35313433, 0x29663238, 
-    0x78202b20, 0x7a2e7a79, 0x28202a20, 0x34302e30, 0x20663531, 0x2e30202f, 0x35313433, 0x29663238, 0x200a0d2c, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x7a797820, 0x2a20782e, 0x2e302820, 0x37353530, 
-    0x202f2066, 0x32332e30, 0x66353936, 0x202b2029, 0x2e7a7978, 0x202a2079, 0x2e302d28, 0x66343032, 0x30202f20, 
-    0x3632332e, 0x29663539, 0x78202b20, 0x7a2e7a79, 0x28202a20, 0x35302e31, 0x2f206637, 0x332e3020, 0x35393632, 
-    0x2c292966, 0x20200a0d, 0x20202020, 0x20202020, 0x20202020, 0x302e3020, 0x31202c66, 0x2966302e, 0x7d0a0d3b, 
-    0x0a0d0a0d, 0x2f2f0a0d, 0x6d6f4320, 0x65747570, 0x6c616820, 0x65762066, 0x726f7463, 0x6f632820, 0x6e65766e, 
-    0x6e6f6974, 0x6f70203a, 0x69746e69, 0x7420676e, 0x756f206f, 0x696f6774, 0x6420676e, 0x63657269, 0x6e6f6974, 
-    0x696c202c, 0x7320656b, 0x69646168, 0x6e20676e, 0x616d726f, 0x0a0d296c, 0x616f6c66, 0x63203374, 0x75706d6f, 
-    0x685f6574, 0x5f666c61, 0x74636576, 0x6328726f, 0x74736e6f, 0x6f6c6620, 0x20337461, 0x202c316b, 0x736e6f63, 
-    0x6c662074, 0x3374616f, 0x2c326b20, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x6f6e2033, 0x6c616d72, 0x6f63202c, 
-    0x2074736e, 0x616f6c66, 0x69203274, 0x202c726f, 0x736e6f63, 0x6c662074, 0x2074616f, 0x2c326b6e, 0x6e6f6320, 
-    0x62207473, 0x206c6f6f, 0x6e617274, 0x73696d73, 0x6e6f6973, 0x6f63202c, 0x2074736e, 0x6c6f6f62, 0x69687420, 
-    0x6c61776e, 0x2964656c, 0x0d7b0a0d, 0x6620200a, 0x74616f6c, 0x3b682033, 0x0a0d0a0d, 0x66692020, 0x61727428, 
-    0x696d736e, 0x6f697373, 0x0a0d296e, 0x0d7b2020, 0x2020200a, 0x28666920, 0x6e696874, 0x6c6c6177, 0x20296465, 
-    0x202f2f20, 0x72206f4e, 0x61726665, 0x6f697463, 0x0a0d216e, 0x20202020, 0x200a0d7b, 0x20202020, 0x3d206820, 
-    0x20316b20, 0x6e28202b, 0x616d726f, 0x202a206c, 0x326b6e28, 0x6e202b20, 0x2029326b, 0x326b202b, 0x20203b29, 
-    0x55202f2f, 0x63206573, 0x6572726f, 0x6e6f7073, 0x676e6964, 0x66657220, 0x7463656c, 0x206e6f69, 0x65726964, 
-    0x6f697463, 0x0a0d2e6e, 0x20202020, 0x200a0d7d, 0x65202020, 0x0d65736c, 0x2020200a, 0x0a0d7b20, 0x20202020, 
-    0x20682020, 0x326b203d, 0x69202a20, 0x792e726f, 0x6b202b20, 0x202a2031, 0x2e726f69, 0x20203b78, 0x50202f2f, 
-    0x746e696f, 0x6e692073, 0x74206f74, 0x6b636968, 0x6d207265, 0x75696465, 0x0a0d2e6d, 0x20200a0d, 0x20202020, 
-    0x69286669, 0x792e726f, 0x69203e20, 0x782e726f, 0x200a0d29, 0x20202020, 0x0a0d7b20, 0x20202020, 0x20202020, 
-    0x3d2a2068, 0x2e312d20, 0x203b6630, 0x202f2f20, 0x656b614d, 0x696f7020, 0x6e69746e, 0x6f742067, 0x74756f20, 
-    0x6e696f67, 0x69642067, 0x74636572, 0x276e6f69, 0x656d2073, 0x6d756964, 0x200a0d2e, 0x20202020, 0x0a0d7d20, 
-    0x20202020, 0x200a0d7d, 0x0a0d7d20, 0x6c652020, 0x0a0d6573, 0x0d7b2020, 0x2020200a, 0x3d206820, 0x20316b20, 
-    0x326b202b, 0x2f20203b, 0x6e75202f, 0x6d726f6e, 0x7a696c61, 0x68206465, 0x2d666c61, 0x74636576, 0x0a0d726f, 
-    0x0d7d2020, 0x200a0d0a, 0x74657220, 0x206e7275, 0x6d726f6e, 0x7a696c61, 0x29682865, 0x7d0a0d3b, 0x0a0d0a0d, 
-    0x616f6c66, 0x72203374, 0x61726665, 0x63287463, 0x74736e6f, 0x6f6c6620, 0x20337461, 0x20202c6b, 0x20202020, 
-    0x64202f2f, 0x63657269, 0x6e6f6974, 0x6f702820, 0x69746e69, 0x6620676e, 0x206d6f72, 0x66727573, 0x29656361, 
-    0x20200a0d, 0x20202020, 0x20202020, 0x20202020, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x2c6e2033, 0x20202020, 
-    0x2f2f2020, 0x726f6e20, 0x0d6c616d, 0x2020200a, 0x20202020, 0x20202020, 0x20202020, 0x736e6f63, 0x6c662074, 
-    0x2074616f, 0x202c6220, 0x20202020, 0x202f2f20, 0x66657228, 0x7463656c, 0x73206465, 0x20656469, 0x29524f49, 
-    0x28202f20, 0x6e617274, 0x74696d73, 0x20646574, 0x65646973, 0x524f4920, 0x200a0d29, 0x20202020, 0x20202020, 
-    0x20202020, 0x6f632020, 0x2074736e, 0x616f6c66, 0x6e202074, 0x20202c6b, 0x2f202020, 0x6f64202f, 0x2c6e2874, 
-    0x0d296b20, 0x2020200a, 0x20202020, 0x20202020, 0x20202020, 0x5f54554f, 0x45505954, 0x6f6f6228, 0x7420296c, 
-    0x20297269, 0x202f2f20, 0x61746f74, 0x6e69206c, 0x6e726574, 0x72206c61, 0x656c6665, 0x6f697463, 0x7b0a0d6e, 
-    0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x72666572, 0x69746361, 0x3d206e6f, 0x2a206220, 0x2a206220, 
-    0x2e312820, 0x2d206630, 0x206b6e20, 0x6b6e202a, 0x0a0d3b29, 0x20200a0d, 0x20726974, 0x3128203d, 0x2066302e, 
-    0x72203d3c, 0x61726665, 0x6f697463, 0x0d3b296e, 0x200a0d0a, 0x74657220, 0x206e7275, 0x72697428, 0x203f2029, 
-    0x2a206e28, 0x6b6e2820, 0x6e202b20, 0x2d20296b, 0x20296b20, 0x6f6e203a, 0x6c616d72, 0x28657a69, 0x206b2d28, 
-    0x2062202a, 0x206e202b, 0x6228202a, 0x6e202a20, 0x202d206b, 0x74727173, 0x302e3128, 0x202d2066, 0x72666572, 
-    0x69746361, 0x29296e6f, 0x0d3b2929, 0x0a0d7d0a, 0x0a0d0a0d, 0x2d2d2a2f, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x0d2d2d2d, 0x4620230a, 0x74636e75, 0x206e6f69, 0x726f6960, 0x6572665f, 0x6c656e73, 
-    0x3e0a0d60, 0x65724620, 0x6c656e73, 0x75716520, 0x6f697461, 0x6f66206e, 0x6e612072, 0x75716520, 0x6d206c61, 
-    0x6f207869, 0x6f702066, 0x6972616c, 0x6974617a, 0x0d2e6e6f, 0x2d2d2d0a, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2f2a2d2d, 0x6c660a0d, 0x2074616f, 0x5f726f69, 0x73657266, 0x286c656e, 0x736e6f63, 
-    0x6c662074, 0x2074616f, 0x2c617465, 0x2f2f2020, 0x66657220, 0x74636172, 0x2f206465, 0x66657220, 0x7463656c, 
-    0x69206465, 0x0a0d726f, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x6f632020, 0x2074736e, 0x616f6c66, 
-    0x686b2074, 0x20202029, 0x63202f2f, 0x6e69736f, 0x666f2065, 0x676e6120, 0x6220656c, 0x65777465, 0x6e206e65, 
-    0x616d726f, 0x61682f6c, 0x762d666c, 0x6f746365, 0x6e612072, 0x69642064, 0x74636572, 0x0d6e6f69, 0x0a0d7b0a, 
-    0x6c662020, 0x2074616f, 0x74736f63, 0x61746568, 0x31203d20, 0x2066302e, 0x3128202d, 0x2066302e, 0x686b202d, 
-    0x6b202a20, 0x2f202968, 0x74652820, 0x202a2061, 0x29617465, 0x0d0a0d3b, 0x6920200a, 0x6f632866, 0x65687473, 
-    0x3c206174, 0x2e30203d, 0x0d296630, 0x7b20200a, 0x20200a0d, 0x65722020, 0x6e727574, 0x302e3120, 0x0a0d3b66, 
-    0x0d7d2020, 0x200a0d0a, 0x736f6320, 0x74656874, 0x203d2061, 0x74727173, 0x736f6328, 0x74656874, 0x203b2961, 
-    0x202f2f20, 0x72666572, 0x65746361, 0x6e612064, 0x20656c67, 0x69736f63, 0x0a0d656e, 0x20200a0d, 0x736e6f63, 
-    0x6c662074, 0x2074616f, 0x3174316e, 0x6b203d20, 0x0a0d3b68, 0x6f632020, 0x2074736e, 0x616f6c66, 0x316e2074, 
-    0x3d203274, 0x736f6320, 0x74656874, 0x0a0d3b61, 0x6f632020, 0x2074736e, 0x616f6c66, 0x326e2074, 0x3d203174, 
-    0x20686b20, 0x7465202a, 0x0a0d3b61, 0x6f632020, 0x2074736e, 0x616f6c66, 0x326e2074, 0x3d203274, 0x736f6320, 
-    0x74656874, 0x202a2061, 0x3b617465, 0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x20705f72, 0x28203d20, 
-    0x3274316e, 0x6e202d20, 0x29317432, 0x28202f20, 0x3274316e, 0x6e202b20, 0x29317432, 0x200a0d3b, 0x6e6f6320, 
-    0x66207473, 0x74616f6c, 0x6f5f7220, 0x203d2020, 0x74316e28, 0x202d2031, 0x3274326e, 0x202f2029, 0x74316e28, 
-    0x202b2031, 0x3274326e, 0x0a0d3b29, 0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x73657266, 0x30203d20, 
-    0x2066352e, 0x7228202a, 0x2a20705f, 0x705f7220, 0x72202b20, 0x2a206f5f, 0x6f5f7220, 0x0a0d3b29, 0x20200a0d, 
-    0x75746572, 0x63206e72, 0x706d616c, 0x65726628, 0x30202c73, 0x2c66302e, 0x302e3120, 0x0d3b2966, 0x0a0d7d0a, 
-    0x2a2f0a0d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x230a0d2d, 0x6e754620, 
-    0x6f697463, 0x6860206e, 0x735f6476, 0x6e656568, 0x6176655f, 0x0a0d606c, 0x7645203e, 0x61756c61, 0x20736574, 
-    0x20656874, 0x73696e61, 0x6f72746f, 0x20636970, 0x65656873, 0x6168206e, 0x762d666c, 0x6f746365, 0x69642072, 
-    0x69727473, 0x69747562, 0x6f206e6f, 0x6874206e, 0x6f6e2065, 0x72702d6e, 0x63656a6f, 0x20646574, 0x696d6568, 
-    0x65687073, 0x0d2e6572, 0x2d2d2d0a, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2f2a2d2d, 
-    0x6c660a0d, 0x2074616f, 0x5f647668, 0x65656873, 0x76655f6e, 0x63286c61, 0x74736e6f, 0x6f6c6620, 0x69207461, 
-    0x6f52766e, 0x6e686775, 0x2c737365, 0x20200a0d, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x63202020, 
-    0x74736e6f, 0x6f6c6620, 0x6e207461, 0x20202968, 0x64202f2f, 0x7328746f, 0x69646168, 0x6e5f676e, 0x616d726f, 
-    0x68202c6c, 0x7b0a0d29, 0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x546e6973, 0x61746568, 0x203d2032, 
-    0x2878616d, 0x66302e30, 0x2e31202c, 0x2d206630, 0x20686e20, 0x686e202a, 0x0a0d3b29, 0x6f632020, 0x2074736e, 
-    0x616f6c66, 0x69732074, 0x6568546e, 0x20206174, 0x7173203d, 0x73287472, 0x68546e69, 0x32617465, 0x0a0d3b29, 
-    0x20200a0d, 0x75746572, 0x28206e72, 0x52766e69, 0x6867756f, 0x7373656e, 0x32202b20, 0x2966302e, 0x70202a20, 
-    0x7328776f, 0x68546e69, 0x2c617465, 0x766e6920, 0x67756f52, 0x73656e68, 0x2a202973, 0x352e3020, 0x202a2066, 
-    0x5f315f4d, 0x2a204950, 0x3b686e20, 0x0d7d0a0d, 0x0d0a0d0a, 0x202f2f0a, 0x7473754a, 0x65687420, 0x73616d20, 
-    0x676e696b, 0x72657420, 0x6f66206d, 0x68742072, 0x2d762065, 0x69766163, 0x6d207974, 0x6c65646f, 0x660a0d2e, 
-    0x74616f6c, 0x61637620, 0x69746976, 0x6d5f7365, 0x286b7361, 0x736e6f63, 0x6c662074, 0x2074616f, 0x202c686e, 
-    0x202f2f20, 0x28736261, 0x28746f64, 0x6d726f6e, 0x202c6c61, 0x666c6168, 0x0a0d2929, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x2c686b20, 0x2f2f2020, 0x73626120, 
-    0x746f6428, 0x72696428, 0x6168202c, 0x2929666c, 0x20200a0d, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x63202020, 0x74736e6f, 0x6f6c6620, 0x6e207461, 0x2020296b, 0x61202f2f, 0x64287362, 0x6e28746f, 0x616d726f, 
-    0x64202c6c, 0x29297269, 0x0d7b0a0d, 0x7220200a, 0x72757465, 0x696d206e, 0x2e32286e, 0x2a206630, 0x20686e20, 
-    0x6b6e202a, 0x6b202f20, 0x31202c68, 0x2966302e, 0x7d0a0d3b, 0x0a0d0a0d, 0x2a2f0a0d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x230a0d2d, 0x6e754620, 0x6f697463, 0x7660206e, 0x69766163, 
-    0x73656974, 0x6168735f, 0x5f776f64, 0x6b73616d, 0x3e0a0d60, 0x6f6f4320, 0x6f542d6b, 0x6e617272, 0x73206563, 
-    0x656c7974, 0x632d7620, 0x74697661, 0x20736569, 0x64616873, 0x6e69776f, 0x616d2d67, 0x6e696b73, 0x65742067, 
-    0x0d2e6d72, 0x2d2d2d0a, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2f2a2d2d, 0x6c660a0d, 
-    0x2074616f, 0x76616376, 0x65697469, 0x68735f73, 0x776f6461, 0x73616d5f, 0x554f286b, 0x59545f54, 0x66284550, 
-    0x74616f6c, 0x31472029, 0x554f202c, 0x59545f54, 0x66284550, 0x74616f6c, 0x32472029, 0x6f63202c, 0x2074736e, 
-    0x616f6c66, 0x686e2074, 0x6f63202c, 0x2074736e, 0x616f6c66, 0x6b203374, 0x63202c31, 0x74736e6f, 0x6f6c6620, 
-    0x6b207461, 0x202c6831, 0x736e6f63, 0x6c662074, 0x3374616f, 0x2c326b20, 0x6e6f6320, 0x66207473, 0x74616f6c, 
-    0x68326b20, 0x7b0a0d29, 0x20200a0d, 0x3d203147, 0x61637620, 0x69746976, 0x6d5f7365, 0x286b7361, 0x202c686e, 
-    0x2c68316b, 0x2e316b20, 0x203b297a, 0x202f2f20, 0x6d206e49, 0x65722079, 0x7265646e, 0x74207265, 0x7a206568, 
-    0x6f6f632d, 0x6e696472, 0x20657461, 0x74207369, 0x6e206568, 0x616d726f, 0x0a0d216c, 0x32472020, 0x76203d20, 
-    0x69766163, 0x73656974, 0x73616d5f, 0x686e286b, 0x326b202c, 0x6b202c68, 0x297a2e32, 0x0d0a0d3b, 0x2f20200a, 
-    0x7465722f, 0x206e7275, 0x66657228, 0x74636172, 0x296e6f69, 0x66203f20, 0x6678616d, 0x302e3028, 0x47202c66, 
-    0x202b2031, 0x2d203247, 0x302e3120, 0x3a202966, 0x696d6620, 0x4728666e, 0x47202c31, 0x0d3b2932, 0x7220200a, 
-    0x72757465, 0x696d206e, 0x3147286e, 0x3247202c, 0x20203b29, 0x50202f2f, 0x20465245, 0x6465654e, 0x66657220, 
-    0x7463656c, 0x206e6f69, 0x796c6e6f, 0x7d0a0d2e, 0x0a0d0a0d, 0x2a2f0a0d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x230a0d2d, 0x6e754620, 0x6f697463, 0x6860206e, 0x735f6476, 0x6e656568, 
-    0x6d61735f, 0x60656c70, 0x203e0a0d, 0x706d6153, 0x2073656c, 0x61682061, 0x762d666c, 0x6f746365, 0x63612072, 
-    0x64726f63, 0x20676e69, 0x61206f74, 0x6e61206e, 0x746f7369, 0x69706f72, 0x68732063, 0x206e6565, 0x74736964, 
-    0x75626972, 0x6e6f6974, 0x2d0a0d2e, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x0a0d2f2a, 0x616f6c66, 0x68203374, 0x735f6476, 0x6e656568, 0x6d61735f, 0x28656c70, 0x736e6f63, 0x6c662074, 
-    0x3274616f, 0x2c697820, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x766e6920, 0x67756f52, 0x73656e68, 0x0a0d2973, 
-    0x200a0d7b, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x69687020, 0x32203d20, 0x2066302e, 0x5f4d202a, 0x2a204950, 
-    0x2e697820, 0x0a0d3b78, 0x20200a0d, 0x616f6c66, 0x69732074, 0x6968506e, 0x73203d20, 0x70286e69, 0x3b296968, 
-    0x20200a0d, 0x616f6c66, 0x6f632074, 0x69685073, 0x63203d20, 0x7028736f, 0x3b296968, 0x0a0d0a0d, 0x6f632020, 
-    0x2074736e, 0x616f6c66, 0x69732074, 0x6568546e, 0x3d206174, 0x776f7020, 0x302e3128, 0x202d2066, 0x792e6978, 
-    0x2e31202c, 0x2f206630, 0x6e692820, 0x756f5276, 0x656e6867, 0x2b207373, 0x302e3220, 0x3b292966, 0x20200a0d, 
-    0x736e6f63, 0x6c662074, 0x2074616f, 0x54736f63, 0x61746568, 0x73203d20, 0x28747271, 0x66302e31, 0x73202d20, 
-    0x68546e69, 0x20617465, 0x6973202a, 0x6568546e, 0x3b296174, 0x0a0d0a0d, 0x65722020, 0x6e727574, 0x726f6e20, 
-    0x696c616d, 0x6628657a, 0x74616f6c, 0x6f632833, 0x69685073, 0x73202a20, 0x68546e69, 0x2c617465, 0x6e697320, 
-    0x20696850, 0x6973202a, 0x6568546e, 0x0d2c6174, 0x2020200a, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x63202020, 0x6854736f, 0x29617465, 0x20203b29, 0x49202f2f, 0x796d206e, 0x6e657220, 0x65726564, 
-    0x68742072, 0x2d7a2065, 0x726f6f63, 0x616e6964, 0x69206574, 0x68742073, 0x6f6e2065, 0x6c616d72, 0x7d0a0d21, 
-    0x0a0d0a0d, 0x616f6c66, 0x66203374, 0x2870696c, 0x736e6f63, 0x6c662074, 0x3374616f, 0x202c6820, 0x736e6f63, 
-    0x6c662074, 0x3374616f, 0x202c6b20, 0x616f6c66, 0x69782074, 0x7b0a0d29, 0x20200a0d, 0x736e6f63, 0x6c662074, 
-    0x2074616f, 0x203d2061, 0x207a2e68, 0x2e6b202a, 0x0a0d3b7a, 0x6f632020, 0x2074736e, 0x616f6c66, 0x20622074, 
-    0x2e68203d, 0x202a2078, 0x20782e6b, 0x2e68202b, 0x202a2079, 0x3b792e6b, 0x0a0d0a0d, 0x6f632020, 0x2074736e, 
-    0x616f6c66, 0x686b2074, 0x3d202020, 0x78616d20, 0x302e3028, 0x61202c66, 0x62202b20, 0x0a0d3b29, 0x6f632020, 
-    0x2074736e, 0x616f6c66, 0x686b2074, 0x3d20665f, 0x78616d20, 0x302e3028, 0x61202c66, 0x62202d20, 0x0a0d3b29, 
-    0x20200a0d, 0x736e6f63, 0x6c662074, 0x2074616f, 0x6c665f70, 0x3d207069, 0x5f686b20, 0x202f2066, 0x20686b28, 
-    0x686b202b, 0x3b29665f, 0x0a0d0a0d, 0x2f2f2020, 0x52455020, 0x69782046, 0x20736920, 0x20746f6e, 0x64657375, 
-    0x74666120, 0x74207265, 0x20736968, 0x7265706f, 0x6f697461, 0x7962206e, 0x65687420, 0x6c6e6f20, 0x61632079, 
-    0x72656c6c, 0x64726220, 0x68735f66, 0x5f6e6565, 0x706d6173, 0x2928656c, 0x200a0d2c, 0x202f2f20, 0x74206f73, 
-    0x65726568, 0x20736920, 0x6e206f6e, 0x20646565, 0x73206f74, 0x656c6163, 0x65687420, 0x6d617320, 0x2e656c70, 
-    0x20200a0d, 0x66692f2f, 0x69782820, 0x70203c20, 0x696c665f, 0x0a0d2970, 0x2f2f2020, 0x200a0d7b, 0x202f2f20, 
-    0x20697820, 0x70203d2f, 0x696c665f, 0x0a0d3b70, 0x2f2f2020, 0x65722020, 0x6e727574, 0x6b616d20, 0x6c665f65, 
-    0x3374616f, 0x2e682d28, 0x2d202c78, 0x2c792e68, 0x7a2e6820, 0x0a0d3b29, 0x2f2f2020, 0x200a0d7d, 0x652f2f20, 
-    0x0d65736c, 0x2f20200a, 0x0a0d7b2f, 0x2f2f2020, 0x69782020, 0x28203d20, 0x2d206978, 0x665f7020, 0x2970696c, 
-    0x28202f20, 0x66302e31, 0x70202d20, 0x696c665f, 0x0d3b2970, 0x2f20200a, 0x7220202f, 0x72757465, 0x3b68206e, 
-    0x20200a0d, 0x0d7d2f2f, 0x200a0d0a, 0x74657220, 0x206e7275, 0x20697828, 0x5f70203c, 0x70696c66, 0x203f2029, 
-    0x616f6c66, 0x2d283374, 0x2c782e68, 0x2e682d20, 0x68202c79, 0x20297a2e, 0x3b68203a, 0x0d7d0a0d, 0x0d0a0d0a, 
-    0x6e75230a, 0x20666564, 0x5f54554f, 0x45505954, 0x65230a0d, 0x6669646e, 0x2f2f2020, 0x56564e20, 0x5f4c484b, 
-    0x5f584747, 0x000a0d48, 0x00130007, 0x00000019, 0x575c3a46, 0x6f646e69, 0x445c7377, 0x746b7365, 0x6e5c706f, 
-    0x6f727076, 0x726f635f, 0x6e5c3265, 0x61687376, 0x73726564, 0x7262705c, 0x7867675f, 0x63696d5f, 0x61666f72, 
-    0x2e746563, 0x6c732e68, 0x00676e61, 0x06590007, 0x0000001a, 0x0a0d2a2f, 0x43202a20, 0x7279706f, 0x74686769, 
-    0x29632820, 0x32303220, 0x30322d32, 0x202c3532, 0x4449564e, 0x43204149, 0x4f50524f, 0x49544152, 0x202e4e4f, 
-    0x6c6c4120, 0x67697220, 0x20737468, 0x65736572, 0x64657672, 0x200a0d2e, 0x200a0d2a, 0x694c202a, 0x736e6563, 
-    0x75206465, 0x7265646e, 0x65687420, 0x61704120, 0x20656863, 0x6563694c, 0x2c65736e, 0x72655620, 0x6e6f6973, 
-    0x302e3220, 0x68742820, 0x4c222065, 0x6e656369, 0x29226573, 0x200a0d3b, 0x6f79202a, 0x616d2075, 0x6f6e2079, 
-    0x73752074, 0x68742065, 0x66207369, 0x20656c69, 0x65637865, 0x69207470, 0x6f63206e, 0x696c706d, 0x65636e61, 
-    0x74697720, 0x68742068, 0x694c2065, 0x736e6563, 0x0a0d2e65, 0x59202a20, 0x6d20756f, 0x6f207961, 0x69617462, 
-    0x2061206e, 0x79706f63, 0x20666f20, 0x20656874, 0x6563694c, 0x2065736e, 0x0a0d7461, 0x0a0d2a20, 0x20202a20, 
-    0x68202020, 0x3a707474, 0x77772f2f, 0x70612e77, 0x65686361, 0x67726f2e, 0x63696c2f, 0x65736e65, 0x494c2f73, 
-    0x534e4543, 0x2e322d45, 0x200a0d30, 0x200a0d2a, 0x6e55202a, 0x7373656c, 0x71657220, 0x65726975, 0x79622064, 
-    0x70706120, 0x6163696c, 0x20656c62, 0x2077616c, 0x6120726f, 0x65657267, 0x6f742064, 0x206e6920, 0x74697277, 
-    0x2c676e69, 0x666f7320, 0x72617774, 0x200a0d65, 0x6964202a, 0x69727473, 0x65747562, 0x6e752064, 0x20726564, 
-    0x20656874, 0x6563694c, 0x2065736e, 0x64207369, 0x72747369, 0x74756269, 0x6f206465, 0x6e61206e, 0x53412220, 
-    0x22534920, 0x53414220, 0x0d2c5349, 0x202a200a, 0x48544957, 0x2054554f, 0x52524157, 0x49544e41, 0x4f205345, 
-    0x4f432052, 0x5449444e, 0x534e4f49, 0x20464f20, 0x20594e41, 0x444e494b, 0x6965202c, 0x72656874, 0x70786520, 
-    0x73736572, 0x20726f20, 0x6c706d69, 0x2e646569, 0x2a200a0d, 0x65655320, 0x65687420, 0x63694c20, 0x65736e65, 
-    0x726f6620, 0x65687420, 0x65707320, 0x69666963, 0x616c2063, 0x6175676e, 0x67206567, 0x7265766f, 0x676e696e, 
-    0x72657020, 0x7373696d, 0x736e6f69, 0x646e6120, 0x2a200a0d, 0x6d696c20, 0x74617469, 0x736e6f69, 0x646e7520, 
-    0x74207265, 0x4c206568, 0x6e656369, 0x0d2e6573, 0x0d2a200a, 0x202a200a, 0x58445053, 0x6c69462d, 0x706f4365, 
-    0x67697279, 0x65547468, 0x203a7478, 0x79706f43, 0x68676972, 0x63282074, 0x30322029, 0x322d3232, 0x2c353230, 
-    0x49564e20, 0x20414944, 0x50524f43, 0x5441524f, 0x2e4e4f49, 0x2a200a0d, 0x44505320, 0x694c2d58, 0x736e6563, 
-    0x64492d65, 0x69746e65, 0x72656966, 0x7041203a, 0x65686361, 0x302e322d, 0x2a200a0d, 0x0d0a0d2f, 0x6669230a, 
-    0x6665646e, 0x56564e20, 0x5f4c484b, 0x434e5546, 0x0a0d485f, 0x66656423, 0x20656e69, 0x4b56564e, 0x465f4c48, 
-    0x5f434e55, 0x0d312048, 0x230a0d0a, 0x6c636e69, 0x20656475, 0x616c7322, 0x745f676e, 0x73657079, 0x0d22682e, 
-    0x6e69230a, 0x64756c63, 0x63222065, 0x74736e6f, 0x73746e61, 0x732e682e, 0x676e616c, 0x0d0a0d22, 0x4d414e0a, 
-    0x41505345, 0x535f4543, 0x45444148, 0x5f4f4952, 0x49474542, 0x0d29284e, 0x230a0d0a, 0x65646669, 0x5f5f2066, 
-    0x756c7063, 0x756c7073, 0x230a0d73, 0x646e6669, 0x4f206665, 0x545f5455, 0x0d455059, 0x6564230a, 0x656e6966, 
-    0x54554f20, 0x5059545f, 0x29542845, 0x0d265420, 0x6e65230a, 0x0d666964, 0x6c65230a, 0x0a0d6573, 0x66656423, 
-    0x20656e69, 0x5f54554f, 0x45505954, 0x20295428, 0x2074756f, 0x230a0d54, 0x69646e65, 0x0d0a0d66, 0x690a0d0a, 
-    0x6e696c6e, 0x6c662065, 0x2074616f, 0x61757173, 0x66286572, 0x74616f6c, 0x0d297820, 0x0a0d7b0a, 0x65722020, 
-    0x6e727574, 0x2a207820, 0x0d3b7820, 0x0a0d7d0a, 0x6e690a0d, 0x656e696c, 0x6f6c6620, 0x73207461, 0x72757461, 
-    0x28657461, 0x616f6c66, 0x29782074, 0x0d7b0a0d, 0x7220200a, 0x72757465, 0x6c63206e, 0x28706d61, 0x30202c78, 
-    0x2c46302e, 0x302e3120, 0x0d3b2946, 0x0a0d7d0a, 0x6e690a0d, 0x656e696c, 0x6f6c6620, 0x20337461, 0x75746173, 
-    0x65746172, 0x6f6c6628, 0x20337461, 0x0a0d2978, 0x200a0d7b, 0x74657220, 0x206e7275, 0x6d616c63, 0x2c782870, 
-    0x6f6c6620, 0x28337461, 0x46302e30, 0x66202c29, 0x74616f6c, 0x2e312833, 0x29294630, 0x7d0a0d3b, 0x0a0d0a0d, 
-    0x52202f2f, 0x72757465, 0x6874206e, 0x756c2065, 0x616e696d, 0x2065636e, 0x6120666f, 0x6c6f6320, 0x0a0d726f, 
-    0x696c6e69, 0x6620656e, 0x74616f6c, 0x6d756c20, 0x6e616e69, 0x66286563, 0x74616f6c, 0x6f632033, 0x29726f6c, 
-    0x0d7b0a0d, 0x7220200a, 0x72757465, 0x6f63206e, 0x2e726f6c, 0x202a2078, 0x31322e30, 0x20463632, 0x6f63202b, 
-    0x2e726f6c, 0x202a2079, 0x31372e30, 0x20463235, 0x6f63202b, 0x2e726f6c, 0x202a207a, 0x37302e30, 0x3b463232, 
-    0x0d7d0a0d, 0x690a0d0a, 0x6e696c6e, 0x6c662065, 0x3374616f, 0x656c7320, 0x66287072, 0x74616f6c, 0x2c612033, 
-    0x6f6c6620, 0x20337461, 0x66202c62, 0x74616f6c, 0x676e6120, 0x202c656c, 0x616f6c66, 0x29742074, 0x0d7b0a0d, 
-    0x7420200a, 0x20202020, 0x20202020, 0x20202020, 0x73203d20, 0x72757461, 0x28657461, 0x0d3b2974, 0x6620200a, 
-    0x74616f6c, 0x69732020, 0x2020316e, 0x73203d20, 0x61286e69, 0x656c676e, 0x74202a20, 0x0a0d3b29, 0x6c662020, 
-    0x2074616f, 0x6e697320, 0x20202032, 0x6973203d, 0x6e61286e, 0x20656c67, 0x3128202a, 0x2046302e, 0x2974202d, 
-    0x0a0d3b29, 0x6c662020, 0x2074616f, 0x20617420, 0x20202020, 0x6973203d, 0x2f20316e, 0x69732820, 0x2b20316e, 
-    0x6e697320, 0x0d3b2932, 0x6620200a, 0x74616f6c, 0x65722033, 0x746c7573, 0x6c203d20, 0x28707265, 0x62202c61, 
-    0x6c66202c, 0x3374616f, 0x29617428, 0x0a0d3b29, 0x65722020, 0x6e727574, 0x726f6e20, 0x696c616d, 0x7228657a, 
-    0x6c757365, 0x0d3b2974, 0x0a0d7d0a, 0x6e690a0d, 0x656e696c, 0x6f6c6620, 0x63207461, 0x706d616c, 0x6f446465, 
-    0x6c662874, 0x3374616f, 0x202c7820, 0x616f6c66, 0x79203374, 0x7b0a0d29, 0x20200a0d, 0x75746572, 0x63206e72, 
-    0x706d616c, 0x746f6428, 0x202c7828, 0x202c2979, 0x46302e30, 0x2e31202c, 0x3b294630, 0x0d7d0a0d, 0x2f0a0d0a, 
-    0x2d2d2d2f, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x0a0d2d2d, 0x42202f2f, 0x646c6975, 0x6e612073, 0x74726f20, 0x6f6e6f68, 0x6c616d72, 0x73616220, 
-    0x203a7369, 0x65766967, 0x6e6f206e, 0x6120796c, 0x726f6e20, 0x206c616d, 0x74636576, 0x202c726f, 0x75746572, 
-    0x20736e72, 0x2f0a0d61, 0x6174202f, 0x6e65676e, 0x6e612074, 0x69622064, 0x676e6174, 0x2e746e65, 0x2f2f0a0d, 
-    0x2f2f0a0d, 0x69685420, 0x73752073, 0x74207365, 0x74206568, 0x6e686365, 0x65757169, 0x6f726620, 0x4922206d, 
-    0x6f72706d, 0x20646576, 0x75636361, 0x79636172, 0x65687720, 0x7562206e, 0x69646c69, 0x6120676e, 0x726f206e, 
-    0x6e6f6874, 0x616d726f, 0x2f0a0d6c, 0x6162202f, 0x22736973, 0x20796220, 0x736c654e, 0x4d206e6f, 0x202c7861, 
-    0x70747468, 0x2f2f3a73, 0x7467636a, 0x67726f2e, 0x6275702f, 0x6873696c, 0x302f6465, 0x2f363030, 0x302f3130, 
-    0x0a0d2e32, 0x41202f2f, 0x7420796e, 0x65676e61, 0x672d746e, 0x72656e65, 0x6e697461, 0x6c612067, 0x69726f67, 
-    0x206d6874, 0x7473756d, 0x6f727020, 0x65637564, 0x20746120, 0x7361656c, 0x6e6f2074, 0x69642065, 0x6e6f6373, 
-    0x756e6974, 0x0d797469, 0x202f2f0a, 0x6e656877, 0x65706f20, 0x69746172, 0x6f20676e, 0x2061206e, 0x65687073, 
-    0x28206572, 0x20657564, 0x74206f74, 0x68206568, 0x79726961, 0x6c616220, 0x6874206c, 0x65726f65, 0x203b296d, 
-    0x73696874, 0x73616820, 0x0a0d6120, 0x73202f2f, 0x6c6c616d, 0x6e697220, 0x68732d67, 0x64657061, 0x73696420, 
-    0x746e6f63, 0x69756e69, 0x61207974, 0x6f6e2074, 0x6c616d72, 0x3d207a2e, 0x302d203d, 0x3939392e, 0x39373839, 
-    0x0a0d2e36, 0x2d2d2f2f, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x0d2d2d2d, 0x6c6e690a, 0x20656e69, 0x64696f76, 0x74726f20, 0x6f6e6f68, 0x6c616d72, 
-    0x69736142, 0x6c662873, 0x3374616f, 0x726f6e20, 0x2c6c616d, 0x54554f20, 0x5059545f, 0x6c662845, 0x3374616f, 
-    0x61742029, 0x6e65676e, 0x4f202c74, 0x545f5455, 0x28455059, 0x616f6c66, 0x20293374, 0x61746962, 0x6e65676e, 
-    0x0a0d2974, 0x200a0d7b, 0x28666920, 0x6d726f6e, 0x7a2e6c61, 0x2d203c20, 0x39392e30, 0x37383939, 0x29463639, 
-    0x2f2f2020, 0x6e614820, 0x20656c64, 0x20656874, 0x676e6973, 0x72616c75, 0x0d797469, 0x7b20200a, 0x20200a0d, 
-    0x61742020, 0x6e65676e, 0x20202074, 0x6c66203d, 0x3374616f, 0x302e3028, 0x2d202c46, 0x46302e31, 0x2e30202c, 
-    0x3b294630, 0x20200a0d, 0x69622020, 0x676e6174, 0x20746e65, 0x6c66203d, 0x3374616f, 0x2e312d28, 0x202c4630, 
-    0x46302e30, 0x2e30202c, 0x3b294630, 0x20200a0d, 0x65722020, 0x6e727574, 0x200a0d3b, 0x0a0d7d20, 0x6c662020, 
-    0x2074616f, 0x20202061, 0x2e31203d, 0x2f204630, 0x2e312820, 0x2b204630, 0x726f6e20, 0x2e6c616d, 0x0d3b297a, 
-    0x6620200a, 0x74616f6c, 0x20206220, 0x2d203d20, 0x6d726f6e, 0x782e6c61, 0x6e202a20, 0x616d726f, 0x20792e6c, 
-    0x3b61202a, 0x20200a0d, 0x676e6174, 0x20746e65, 0x203d2020, 0x616f6c66, 0x31283374, 0x2046302e, 0x6f6e202d, 
-    0x6c616d72, 0x2a20782e, 0x726f6e20, 0x2e6c616d, 0x202a2078, 0x62202c61, 0x6e2d202c, 0x616d726f, 0x29782e6c, 
-    0x200a0d3b, 0x74696220, 0x65676e61, 0x3d20746e, 0x6f6c6620, 0x28337461, 0x31202c62, 0x2066302e, 0x6f6e202d, 
-    0x6c616d72, 0x2a20792e, 0x726f6e20, 0x2e6c616d, 0x202a2079, 0x2d202c61, 0x6d726f6e, 0x792e6c61, 0x0a0d3b29, 
-    0x0d0a0d7d, 0x2d2f2f0a, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2f2f0a0d, 0x6b694c20, 0x726f2065, 0x6e6f6874, 0x616d726f, 0x7361426c, 
-    0x29287369, 0x7562202c, 0x65722074, 0x6e727574, 0x20612073, 0x676e6174, 0x20746e65, 0x20646e61, 0x676e6174, 
-    0x20746e65, 0x6e676973, 0x61687420, 0x616d2074, 0x65686374, 0x2f0a0d73, 0x6874202f, 0x6c672065, 0x63204654, 
-    0x65766e6f, 0x6f69746e, 0x0a0d2e6e, 0x696c6e69, 0x6620656e, 0x74616f6c, 0x616d2034, 0x6146656b, 0x61547473, 
-    0x6e65676e, 0x6c662874, 0x3374616f, 0x726f6e20, 0x296c616d, 0x0d7b0a0d, 0x6620200a, 0x74616f6c, 0x61742033, 
-    0x6e65676e, 0x75202c74, 0x6573756e, 0x0a0d3b64, 0x726f2020, 0x6e6f6874, 0x616d726f, 0x7361426c, 0x6e287369, 
-    0x616d726f, 0x74202c6c, 0x65676e61, 0x202c746e, 0x73756e75, 0x3b296465, 0x20200a0d, 0x54202f2f, 0x67206568, 
-    0x2046546c, 0x61746962, 0x6e65676e, 0x69732074, 0x68206e67, 0x20657265, 0x31207369, 0x7320662e, 0x65636e69, 
-    0x726f6620, 0x20200a0d, 0x6e202f2f, 0x616d726f, 0x3d3d206c, 0x63657620, 0x2e302833, 0x202c4630, 0x46302e30, 
-    0x2e31202c, 0x2c294630, 0x20657720, 0x0d746567, 0x2f20200a, 0x6174202f, 0x6e65676e, 0x3d3d2074, 0x63657620, 
-    0x2e312833, 0x202c4630, 0x46302e30, 0x2e30202c, 0x20294630, 0x20646e61, 0x61746962, 0x6e65676e, 0x3d3d2074, 
-    0x63657620, 0x2e302833, 0x202c4630, 0x46302e31, 0x2e30202c, 0x2c294630, 0x20200a0d, 0x73202f2f, 0x6962206f, 
-    0x676e6174, 0x20746e65, 0x7263203d, 0x2873736f, 0x6d726f6e, 0x202c6c61, 0x676e6174, 0x29746e65, 0x200a0d2e, 
-    0x74657220, 0x206e7275, 0x616f6c66, 0x74283474, 0x65676e61, 0x202c746e, 0x29662e31, 0x7d0a0d3b, 0x0a0d0a0d, 
-    0x696c6e69, 0x6620656e, 0x74616f6c, 0x6f722033, 0x65746174, 0x6f6c6628, 0x20337461, 0x66202c76, 0x74616f6c, 
-    0x2c6b2033, 0x6f6c6620, 0x74207461, 0x61746568, 0x7b0a0d29, 0x20200a0d, 0x616f6c66, 0x6f632074, 0x68745f73, 
-    0x20617465, 0x6f63203d, 0x68742873, 0x29617465, 0x200a0d3b, 0x6f6c6620, 0x73207461, 0x745f6e69, 0x61746568, 
-    0x73203d20, 0x74286e69, 0x61746568, 0x0a0d3b29, 0x20200a0d, 0x75746572, 0x28206e72, 0x202a2076, 0x5f736f63, 
-    0x74656874, 0x2b202961, 0x72632820, 0x2873736f, 0x76202c6b, 0x202a2029, 0x5f6e6973, 0x74656874, 0x2b202961, 
-    0x206b2820, 0x6f64202a, 0x2c6b2874, 0x29297620, 0x28202a20, 0x46302e31, 0x63202d20, 0x745f736f, 0x61746568, 
-    0x0a0d3b29, 0x0d0a0d7d, 0x2f0a0d0a, 0x2d2d2d2f, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2f2f0a0d, 0x74655220, 0x206e7275, 0x20656874, 0x69205655, 0x2061206e, 
-    0x2d74616c, 0x676e6f6c, 0x52444820, 0x70616d20, 0x2f2f0a0d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0d2d2d2d, 0x6c6e690a, 0x20656e69, 0x616f6c66, 0x67203274, 
-    0x70537465, 0x69726568, 0x556c6163, 0x6c662876, 0x3374616f, 0x0d297620, 0x0a0d7b0a, 0x6c662020, 0x2074616f, 
-    0x6d6d6167, 0x203d2061, 0x6e697361, 0x2e762d28, 0x0d3b2979, 0x6620200a, 0x74616f6c, 0x65687420, 0x3d206174, 
-    0x61746120, 0x7628326e, 0x202c7a2e, 0x29782e76, 0x0d0a0d3b, 0x6620200a, 0x74616f6c, 0x76752032, 0x66203d20, 
-    0x74616f6c, 0x68742832, 0x20617465, 0x5f4d202a, 0x564f5f31, 0x505f5245, 0x202a2049, 0x46352e30, 0x6167202c, 
-    0x20616d6d, 0x5f4d202a, 0x564f5f31, 0x505f5245, 0x2b202949, 0x352e3020, 0x0a0d3b46, 0x65722020, 0x6e727574, 
-    0x3b767520, 0x0d7d0a0d, 0x2f0a0d0a, 0x2d2d2d2f, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2f2f0a0d, 0x74655220, 0x206e7275, 0x20656874, 0x65746e69, 0x6c6f7072, 
-    0x64657461, 0x6c617620, 0x62206575, 0x65777465, 0x33206e65, 0x6c617620, 0x20736575, 0x20646e61, 0x20656874, 
-    0x79726162, 0x746e6563, 0x73636972, 0x2f2f0a0d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0d2d2d2d, 0x6c6e690a, 0x20656e69, 0x616f6c66, 0x6d203274, 0x61427869, 
-    0x66287972, 0x74616f6c, 0x2c612032, 0x6f6c6620, 0x20327461, 0x66202c62, 0x74616f6c, 0x2c632032, 0x6f6c6620, 
-    0x20337461, 0x79726162, 0x7b0a0d29, 0x20200a0d, 0x75746572, 0x61206e72, 0x62202a20, 0x2e797261, 0x202b2078, 
-    0x202a2062, 0x79726162, 0x2b20792e, 0x2a206320, 0x72616220, 0x3b7a2e79, 0x0d7d0a0d, 0x690a0d0a, 0x6e696c6e, 
-    0x6c662065, 0x3374616f, 0x78696d20, 0x79726142, 0x6f6c6628, 0x20337461, 0x66202c61, 0x74616f6c, 0x2c622033, 
-    0x6f6c6620, 0x20337461, 0x66202c63, 0x74616f6c, 0x61622033, 0x0d297972, 0x0a0d7b0a, 0x65722020, 0x6e727574, 
-    0x2a206120, 0x72616220, 0x20782e79, 0x2062202b, 0x6162202a, 0x792e7972, 0x63202b20, 0x62202a20, 0x2e797261, 
-    0x0a0d3b7a, 0x0d0a0d7d, 0x6c6e690a, 0x20656e69, 0x616f6c66, 0x6d203474, 0x61427869, 0x66287972, 0x74616f6c, 
-    0x2c612034, 0x6f6c6620, 0x20347461, 0x66202c62, 0x74616f6c, 0x2c632034, 0x6f6c6620, 0x20337461, 0x79726162, 
-    0x7b0a0d29, 0x20200a0d, 0x75746572, 0x61206e72, 0x62202a20, 0x2e797261, 0x202b2078, 0x202a2062, 0x79726162, 
-    0x2b20792e, 0x2a206320, 0x72616220, 0x3b7a2e79, 0x0d7d0a0d, 0x2f0a0d0a, 0x2d2d2d2f, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2f2f0a0d, 0x74746820, 0x2f3a7370, 
-    0x7777772f, 0x6165722e, 0x6d69746c, 0x6e657265, 0x69726564, 0x632e676e, 0x722f6d6f, 0x72747961, 0x6e696361, 
-    0x6d656767, 0x6e752f73, 0x6966666f, 0x6c616963, 0x7961525f, 0x63617254, 0x47676e69, 0x5f736d65, 0x342e3176, 
-    0x6664702e, 0x2f2f0a0d, 0x2e363120, 0x20312e36, 0x49534f43, 0x572d454e, 0x48474945, 0x20444554, 0x494d4548, 
-    0x45485053, 0x4f204552, 0x4e454952, 0x20444554, 0x54204f54, 0x5a204548, 0x4958412d, 0x2f0a0d53, 0x2d2d2d2f, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x6e690a0d, 
-    0x656e696c, 0x6f6c6620, 0x20337461, 0x69736f63, 0x6153656e, 0x656c706d, 0x696d6548, 0x65687073, 0x66286572, 
-    0x74616f6c, 0x2c317220, 0x6f6c6620, 0x72207461, 0x0a0d2932, 0x200a0d7b, 0x6f6c6620, 0x20207461, 0x20202072, 
-    0x7173203d, 0x72287472, 0x0d3b2931, 0x6620200a, 0x74616f6c, 0x68702020, 0x203d2069, 0x57545f4d, 0x49505f4f, 
-    0x72202a20, 0x0a0d3b32, 0x6c662020, 0x3374616f, 0x72696420, 0x200a0d3b, 0x72696420, 0x3d20782e, 0x2a207220, 
-    0x736f6320, 0x69687028, 0x0a0d3b29, 0x69642020, 0x20792e72, 0x2072203d, 0x6973202a, 0x6870286e, 0x0d3b2969, 
-    0x6420200a, 0x7a2e7269, 0x73203d20, 0x28747271, 0x2878616d, 0x2c462e30, 0x462e3120, 0x64202d20, 0x782e7269, 
-    0x64202a20, 0x782e7269, 0x64202d20, 0x792e7269, 0x64202a20, 0x792e7269, 0x0d3b2929, 0x7220200a, 0x72757465, 
-    0x6964206e, 0x0a0d3b72, 0x0d0a0d7d, 0x202f2f0a, 0x766e6f43, 0x73747265, 0x206e6120, 0x65746e69, 0x20726567, 
-    0x61206f74, 0x6c6f6320, 0x0d2e726f, 0x202f2f0a, 0x73696854, 0x20736920, 0x67756f72, 0x20796c68, 0x6e657665, 
-    0x6420796c, 0x72747369, 0x74756269, 0x77206465, 0x69687469, 0x305b206e, 0x5e5d312c, 0x61202c33, 0x7420646e, 
-    0x66206568, 0x74737269, 0x20303120, 0x6f6c6f63, 0x0a0d7372, 0x61202f2f, 0x70206572, 0x65637265, 0x61757470, 
-    0x20796c6c, 0x74736964, 0x74636e69, 0x2f0a0d2e, 0x614c202f, 0x72656772, 0x6d756e20, 0x73726562, 0x6c697720, 
-    0x6873206c, 0x7020776f, 0x65747461, 0x2e736e72, 0x20664920, 0x20756f79, 0x746e6177, 0x206f7420, 0x6d696c65, 
-    0x74616e69, 0x68742065, 0x20657365, 0x74746170, 0x736e7265, 0x2f0a0d2c, 0x6168202f, 0x79206873, 0x2072756f, 
-    0x75706e69, 0x65622074, 0x65726f66, 0x73617020, 0x676e6973, 0x20746920, 0x74206f74, 0x20736968, 0x636e7566, 
-    0x6e6f6974, 0x2f0a0d2e, 0x6854202f, 0x6f6c2065, 0x20726577, 0x62203332, 0x20737469, 0x6020666f, 0x606c6176, 
-    0x6c697720, 0x6562206c, 0x65737520, 0x6f742064, 0x6f766120, 0x69206469, 0x65757373, 0x69772073, 0x69206874, 
-    0x742d746e, 0x6c662d6f, 0x0d74616f, 0x202f2f0a, 0x6e756f72, 0x676e6964, 0x690a0d2e, 0x6e696c6e, 0x6c662065, 
-    0x3374616f, 0x746e4920, 0x72656765, 0x6f436f54, 0x28726f6c, 0x746e6975, 0x6c617620, 0x7b0a0d29, 0x20200a0d, 
-    0x54202f2f, 0x20736968, 0x65207369, 0x76697571, 0x6e656c61, 0x6f742074, 0x61726620, 0x30287463, 0x2b20352e, 
-    0x776f6c20, 0x33327265, 0x73746942, 0x6c617628, 0x202a2029, 0x2f312d28, 0x2d202c61, 0x5e612f31, 0x2d202c32, 
-    0x5e612f31, 0x2c292933, 0x20200a0d, 0x77202f2f, 0x65726568, 0x69206120, 0x68742073, 0x6f702065, 0x69746973, 
-    0x72206576, 0x20746f6f, 0x6120666f, 0x3d20345e, 0x2b206120, 0x0d2e3120, 0x7220200a, 0x72757465, 0x7266206e, 
-    0x28746361, 0x616f6c66, 0x30283374, 0x3038312e, 0x34373238, 0x202c4639, 0x32332e30, 0x36353938, 0x2c463933, 
-    0x342e3020, 0x39323035, 0x46323539, 0x202a2029, 0x616f6c66, 0x66283374, 0x74616f6c, 0x6c617628, 0x30202620, 
-    0x46463778, 0x29464646, 0x202b2029, 0x616f6c66, 0x30283374, 0x2946352e, 0x0a0d3b29, 0x0d0a0d7d, 0x2f0a0d0a, 
-    0x2d2d2d2a, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d2d2d, 0x75462023, 0x6974636e, 
-    0x60206e6f, 0x65776f70, 0x75654872, 0x74736972, 0x0d606369, 0x54203e0a, 0x70206568, 0x7265776f, 0x75656820, 
-    0x74736972, 0x66206369, 0x6d20726f, 0x69746c75, 0x20656c70, 0x6f706d69, 0x6e617472, 0x73206563, 0x6c706d61, 
-    0x2c676e69, 0x74697720, 0x62602068, 0x20617465, 0x6032203d, 0x0d0a0d2e, 0x6565530a, 0x75716520, 0x6f697461, 
-    0x2e39206e, 0x6f203331, 0x74682066, 0x3a737074, 0x72672f2f, 0x69687061, 0x732e7363, 0x666e6174, 0x2e64726f, 
-    0x2f756465, 0x65706170, 0x762f7372, 0x68636165, 0x6568745f, 0x2f736973, 0x73656874, 0x702e7369, 0x0d2e6664, 
-    0x2d2d2d0a, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2f2a2d2d, 0x6e690a0d, 0x656e696c, 
-    0x6f6c6620, 0x70207461, 0x7265776f, 0x72756548, 0x69747369, 0x6c662863, 0x2074616f, 0x66202c61, 0x74616f6c, 
-    0x0d296220, 0x0a0d7b0a, 0x6f632020, 0x2074736e, 0x616f6c66, 0x20742074, 0x2061203d, 0x3b61202a, 0x20200a0d, 
-    0x75746572, 0x74206e72, 0x28202f20, 0x202a2062, 0x202b2062, 0x0d3b2974, 0x0a0d7d0a, 0x0a0d0a0d, 0x646e7523, 
-    0x4f206665, 0x545f5455, 0x0d455059, 0x4e0a0d0a, 0x53454d41, 0x45434150, 0x4148535f, 0x49524544, 0x4e455f4f, 
-    0x0d292844, 0x230a0d0a, 0x69646e65, 0x2f202066, 0x564e202f, 0x4c484b56, 0x4e55465f, 0x00485f43, 0x00110007, 
-    0x0000001c, 0x575c3a46, 0x6f646e69, 0x445c7377, 0x746b7365, 0x6e5c706f, 0x6f727076, 0x726f635f, 0x6e5c3265, 
-    0x61687376, 0x73726564, 0x6e75665c, 0x6f697463, 0x682e736e, 0x616c732e, 0x0000676e, 0x04260007, 0x0000001d, 
-    0x0a0d2a2f, 0x43202a20, 0x7279706f, 0x74686769, 0x29632820, 0x32303220, 0x30322d33, 0x202c3532, 0x4449564e, 
-    0x43204149, 0x4f50524f, 0x49544152, 0x202e4e4f, 0x6c6c4120, 0x67697220, 0x20737468, 0x65736572, 0x64657672, 
-    0x200a0d2e, 0x200a0d2a, 0x694c202a, 0x736e6563, 0x75206465, 0x7265646e, 0x65687420, 0x61704120, 0x20656863, 
-    0x6563694c, 0x2c65736e, 0x72655620, 0x6e6f6973, 0x302e3220, 0x68742820, 0x4c222065, 0x6e656369, 0x29226573, 
-    0x200a0d3b, 0x6f79202a, 0x616d2075, 0x6f6e2079, 0x73752074, 0x68742065, 0x66207369, 0x20656c69, 0x65637865, 
-    0x69207470, 0x6f63206e, 0x696c706d, 0x65636e61, 0x74697720, 0x68742068, 0x694c2065, 0x736e6563, 0x0a0d2e65, 
-    0x59202a20, 0x6d20756f, 0x6f207961, 0x69617462, 0x2061206e, 0x79706f63, 0x20666f20, 0x20656874, 0x6563694c, 
-    0x2065736e, 0x0a0d7461, 0x0a0d2a20, 0x20202a20, 0x68202020, 0x3a707474, 0x77772f2f, 0x70612e77, 0x65686361, 
-    0x67726f2e, 0x63696c2f, 0x65736e65, 0x494c2f73, 0x534e4543, 0x2e322d45, 0x200a0d30, 0x200a0d2a, 0x6e55202a, 
-    0x7373656c, 0x71657220, 0x65726975, 0x79622064, 0x70706120, 0x6163696c, 0x20656c62, 0x2077616c, 0x6120726f, 
-    0x65657267, 0x6f742064, 0x206e6920, 0x74697277, 0x2c676e69, 0x666f7320, 0x72617774, 0x200a0d65, 0x6964202a, 
-    0x69727473, 0x65747562, 0x6e752064, 0x20726564, 0x20656874, 0x6563694c, 0x2065736e, 0x64207369, 0x72747369, 
-    0x74756269, 0x6f206465, 0x6e61206e, 0x53412220, 0x22534920, 0x53414220, 0x0d2c5349, 0x202a200a, 0x48544957, 
-    0x2054554f, 0x52524157, 0x49544e41, 0x4f205345, 0x4f432052, 0x5449444e, 0x534e4f49, 0x20464f20, 0x20594e41, 
-    0x444e494b, 0x6965202c, 0x72656874, 0x70786520, 0x73736572, 0x20726f20, 0x6c706d69, 0x2e646569, 0x2a200a0d, 
-    0x65655320, 0x65687420, 0x63694c20, 0x65736e65, 0x726f6620, 0x65687420, 0x65707320, 0x69666963, 0x616c2063, 
-    0x6175676e, 0x67206567, 0x7265766f, 0x676e696e, 0x72657020, 0x7373696d, 0x736e6f69, 0x646e6120, 0x2a200a0d, 
-    0x6d696c20, 0x74617469, 0x736e6f69, 0x646e7520, 0x74207265, 0x4c206568, 0x6e656369, 0x0d2e6573, 0x0d2a200a, 
-    0x202a200a, 0x58445053, 0x6c69462d, 0x706f4365, 0x67697279, 0x65547468, 0x203a7478, 0x79706f43, 0x68676972, 
-    0x63282074, 0x30322029, 0x322d3332, 0x2c353230, 0x49564e20, 0x20414944, 0x50524f43, 0x5441524f, 0x2e4e4f49, 
-    0x2a200a0d, 0x44505320, 0x694c2d58, 0x736e6563, 0x64492d65, 0x69746e65, 0x72656966, 0x7041203a, 0x65686361, 
-    0x302e322d, 0x2a200a0d, 0x0d0a0d2f, 0x6669230a, 0x6665646e, 0x56564e20, 0x5f4c484b, 0x46445342, 0x5254535f, 
-    0x53544355, 0x0a0d485f, 0x66656423, 0x20656e69, 0x4b56564e, 0x425f4c48, 0x5f464453, 0x55525453, 0x5f535443, 
-    0x0d312048, 0x2f0a0d0a, 0x2d2d2d2a, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d2d2d, 
-    0x42602023, 0x5f464453, 0x4e455645, 0x20602a54, 0x69666544, 0x0d73656e, 0x54203e0a, 0x65736568, 0x65726120, 
-    0x65687420, 0x616c6620, 0x6f207367, 0x68742066, 0x42602065, 0x53666473, 0x6c706d61, 0x74614465, 0x653a3a61, 
-    0x746e6576, 0x7079745f, 0x62206065, 0x69667469, 0x2c646c65, 0x69687720, 0x0a0d6863, 0x6e69203e, 0x61636964, 
-    0x20736574, 0x20656874, 0x65707974, 0x20666f20, 0x65626f6c, 0x61687420, 0x61772074, 0x61732073, 0x656c706d, 
-    0x0a0d2e64, 0x68540a0d, 0x74207369, 0x696d7265, 0x6f6c6f6e, 0x69207967, 0x61622073, 0x20646573, 0x4d206e6f, 
-    0x69754763, 0x65206572, 0x6c612074, 0x22202c2e, 0x61542041, 0x6f6e6f78, 0x6f20796d, 0x69422066, 0x65726964, 
-    0x6f697463, 0x0d6c616e, 0x6163530a, 0x72657474, 0x20676e69, 0x74736944, 0x75626972, 0x6e6f6974, 0x6e754620, 
-    0x6f697463, 0x6f4c206e, 0x20736562, 0x20726f66, 0x646e6552, 0x6e697265, 0x6e452067, 0x656e6967, 0x22737265, 
-    0x680a0d2c, 0x73707474, 0x632f2f3a, 0x61757361, 0x66652d6c, 0x74636566, 0x6f632e73, 0x65722f6d, 0x72616573, 
-    0x4d2f6863, 0x69754763, 0x30326572, 0x53423032, 0x4d2f4644, 0x69754763, 0x30326572, 0x53423032, 0x702e4644, 
-    0x0d2e6664, 0x2d2d2d0a, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2f2a2d2d, 0x0a0d0a0d, 
-    0x49202f2f, 0x7669646e, 0x61756469, 0x6c66206c, 0x3a736761, 0x64230a0d, 0x6e696665, 0x53422065, 0x455f4644, 
-    0x544e4556, 0x5342415f, 0x2042524f, 0x20202030, 0x20202020, 0x2f202020, 0x3a30202f, 0x766e6920, 0x64696c61, 
-    0x6d617320, 0x3b656c70, 0x74617020, 0x68732068, 0x646c756f, 0x20656220, 0x63736964, 0x65647261, 0x72282064, 
-    0x61696461, 0x2065636e, 0x0a0d2930, 0x66656423, 0x20656e69, 0x46445342, 0x4556455f, 0x445f544e, 0x55464649, 
-    0x31204553, 0x20202020, 0x20202020, 0x202f2f20, 0x65203a31, 0x202e672e, 0x626d614c, 0x2e747265, 0x626f4c20, 
-    0x73692065, 0x776c6120, 0x20737961, 0x746e6563, 0x64657265, 0x206e6f20, 0x20656874, 0x66727573, 0x20656361, 
-    0x6d726f6e, 0x0d2e6c61, 0x6564230a, 0x656e6966, 0x44534220, 0x56455f46, 0x5f544e45, 0x534f4c47, 0x28205953, 
-    0x3c3c2031, 0x20293120, 0x2f2f2020, 0x203b3220, 0x746e6543, 0x6f207265, 0x6f6c2066, 0x64206562, 0x6e657065, 
-    0x6f207364, 0x6976206e, 0x6e697765, 0x6e612067, 0x3b656c67, 0x746f6e20, 0x72657020, 0x74636566, 0x7320796c, 
-    0x75636570, 0x2072616c, 0x6c666572, 0x69746365, 0x0d2e6e6f, 0x6564230a, 0x656e6966, 0x44534220, 0x56455f46, 
-    0x5f544e45, 0x55504d49, 0x2045534c, 0x3c203128, 0x2932203c, 0x2f2f2020, 0x203b3420, 0x72655022, 0x74636566, 
-    0x7320796c, 0x75636570, 0x2272616c, 0x20726f20, 0x72696d22, 0x2d726f72, 0x656b696c, 0x65722022, 0x63656c66, 
-    0x6e6f6974, 0x20726f20, 0x6e617274, 0x73696d73, 0x6e6f6973, 0x230a0d2e, 0x69666564, 0x4220656e, 0x5f464453, 
-    0x4e455645, 0x45525f54, 0x43454c46, 0x4e4f4954, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x0d5c2020, 
-    0x2820200a, 0x3c3c2031, 0x20293320, 0x202f2f20, 0x42203b38, 0x2068746f, 0x77656976, 0x646e6120, 0x67696c20, 
-    0x64207468, 0x63657269, 0x6e6f6974, 0x72612073, 0x6e6f2065, 0x65687420, 0x6d617320, 0x69732065, 0x6f206564, 
-    0x68742066, 0x65672065, 0x74656d6f, 0x20636972, 0x6d726f6e, 0x0d2e6c61, 0x6564230a, 0x656e6966, 0x44534220, 
-    0x56455f46, 0x5f544e45, 0x4e415254, 0x53494d53, 0x4e4f4953, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x200a0d5c, 0x20312820, 0x34203c3c, 0x2f202029, 0x3631202f, 0x6956203b, 0x61207765, 0x6c20646e, 0x74686769, 
-    0x72696420, 0x69746365, 0x20736e6f, 0x20657261, 0x6f206e6f, 0x736f7070, 0x20657469, 0x65646973, 0x666f2073, 
-    0x65687420, 0x6f656720, 0x7274656d, 0x6e206369, 0x616d726f, 0x0a0d2e6c, 0x2f2f0a0d, 0x6d6f4320, 0x616e6962, 
-    0x6e6f6974, 0x0a0d3a73, 0x66656423, 0x20656e69, 0x46445342, 0x4556455f, 0x445f544e, 0x55464649, 0x525f4553, 
-    0x454c4645, 0x4f495443, 0x4228204e, 0x5f464453, 0x4e455645, 0x49445f54, 0x53554646, 0x207c2045, 0x46445342, 
-    0x4556455f, 0x525f544e, 0x454c4645, 0x4f495443, 0x2020294e, 0x20202020, 0x39202f2f, 0x64230a0d, 0x6e696665, 
-    0x53422065, 0x455f4644, 0x544e4556, 0x4649445f, 0x45535546, 0x4152545f, 0x494d534e, 0x4f495353, 0x4228204e, 
-    0x5f464453, 0x4e455645, 0x49445f54, 0x53554646, 0x207c2045, 0x46445342, 0x4556455f, 0x545f544e, 0x534e4152, 
-    0x5353494d, 0x294e4f49, 0x2f2f2020, 0x0d373120, 0x6564230a, 0x656e6966, 0x44534220, 0x56455f46, 0x5f544e45, 
-    0x534f4c47, 0x525f5953, 0x454c4645, 0x4f495443, 0x4228204e, 0x5f464453, 0x4e455645, 0x4c475f54, 0x5953534f, 
-    0x42207c20, 0x5f464453, 0x4e455645, 0x45525f54, 0x43454c46, 0x4e4f4954, 0x20202029, 0x20202020, 0x202f2f20, 
-    0x0a0d3031, 0x66656423, 0x20656e69, 0x46445342, 0x4556455f, 0x475f544e, 0x53534f4c, 0x52545f59, 0x4d534e41, 
-    0x49535349, 0x28204e4f, 0x46445342, 0x4556455f, 0x475f544e, 0x53534f4c, 0x207c2059, 0x46445342, 0x4556455f, 
-    0x545f544e, 0x534e4152, 0x5353494d, 0x294e4f49, 0x20202020, 0x31202f2f, 0x230a0d38, 0x69666564, 0x4220656e, 
-    0x5f464453, 0x4e455645, 0x4d495f54, 0x534c5550, 0x45525f45, 0x43454c46, 0x4e4f4954, 0x53422820, 0x455f4644, 
-    0x544e4556, 0x504d495f, 0x45534c55, 0x42207c20, 0x5f464453, 0x4e455645, 0x45525f54, 0x43454c46, 0x4e4f4954, 
-    0x20202029, 0x2f202020, 0x3231202f, 0x64230a0d, 0x6e696665, 0x53422065, 0x455f4644, 0x544e4556, 0x504d495f, 
-    0x45534c55, 0x4152545f, 0x494d534e, 0x4f495353, 0x4228204e, 0x5f464453, 0x4e455645, 0x4d495f54, 0x534c5550, 
-    0x207c2045, 0x46445342, 0x4556455f, 0x545f544e, 0x534e4152, 0x5353494d, 0x294e4f49, 0x2f2f2020, 0x0d303220, 
-    0x2f0a0d0a, 0x2d2d2d2a, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d2d2d, 0x74732023, 
-    0x74637572, 0x73426020, 0x76456664, 0x61756c61, 0x61446574, 0x0d606174, 0x44203e0a, 0x20617461, 0x75727473, 
-    0x72757463, 0x6f662065, 0x76652072, 0x61756c61, 0x676e6974, 0x42206120, 0x2e464453, 0x65655320, 0x65687420, 
-    0x6c696620, 0x6f662065, 0x61702072, 0x656d6172, 0x20726574, 0x75636f64, 0x746e656d, 0x6f697461, 0x0a0d2e6e, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0d2f2a2d, 0x7274730a, 0x20746375, 
-    0x66647342, 0x6c617645, 0x65746175, 0x61746144, 0x0d7b0a0d, 0x6620200a, 0x74616f6c, 0x316b2033, 0x2020203b, 
-    0x20202020, 0x20202020, 0x202f2f20, 0x5d6e695b, 0x776f5420, 0x20647261, 0x20656874, 0x6f636e69, 0x676e696d, 
-    0x79617220, 0x20200a0d, 0x616f6c66, 0x6b203374, 0x20203b32, 0x20202020, 0x20202020, 0x2f2f2020, 0x6e695b20, 
-    0x6f54205d, 0x64726177, 0x65687420, 0x6d617320, 0x64656c70, 0x67696c20, 0x0a0d7468, 0x6c662020, 0x3374616f, 
-    0x3b697820, 0x20202020, 0x20202020, 0x20202020, 0x5b202f2f, 0x205d6e69, 0x61722033, 0x6d6f646e, 0x2e305b20, 
-    0x0d5d312e, 0x6620200a, 0x74616f6c, 0x73622033, 0x645f6664, 0x75666669, 0x203b6573, 0x202f2f20, 0x74756f5b, 
-    0x6944205d, 0x73756666, 0x6f632065, 0x6972746e, 0x69747562, 0x0a0d6e6f, 0x6c662020, 0x3374616f, 0x64736220, 
-    0x6c675f66, 0x7973736f, 0x2020203b, 0x5b202f2f, 0x5d74756f, 0x65705320, 0x616c7563, 0x6f632072, 0x6972746e, 
-    0x69747562, 0x0a0d6e6f, 0x6c662020, 0x2074616f, 0x66647020, 0x2020203b, 0x20202020, 0x20202020, 0x5b202f2f, 
-    0x5d74756f, 0x46445020, 0x3b7d0a0d, 0x0a0d0a0d, 0x2d2d2a2f, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x0d2d2d2d, 0x7320230a, 0x63757274, 0x42602074, 0x53666473, 0x6c706d61, 0x74614465, 0x0a0d6061, 
-    0x6144203e, 0x73206174, 0x63757274, 0x65727574, 0x726f6620, 0x6d617320, 0x6e696c70, 0x20612067, 0x46445342, 
-    0x6553202e, 0x68742065, 0x69662065, 0x6620656c, 0x7020726f, 0x6d617261, 0x72657465, 0x636f6420, 0x6e656d75, 
-    0x69746174, 0x0d2e6e6f, 0x2d2d2d0a, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2f2a2d2d, 
-    0x74730a0d, 0x74637572, 0x64734220, 0x6d615366, 0x44656c70, 0x0d617461, 0x0a0d7b0a, 0x6c662020, 0x3374616f, 
-    0x3b316b20, 0x20202020, 0x20202020, 0x20202020, 0x202f2f20, 0x5d6e695b, 0x776f5420, 0x20647261, 0x20656874, 
-    0x6f636e69, 0x676e696d, 0x79617220, 0x20200a0d, 0x616f6c66, 0x6b203374, 0x20203b32, 0x20202020, 0x20202020, 
-    0x2f202020, 0x6f5b202f, 0x205d7475, 0x61776f54, 0x74206472, 0x73206568, 0x6c706d61, 0x6c206465, 0x74686769, 
-    0x20200a0d, 0x616f6c66, 0x78203374, 0x20203b69, 0x20202020, 0x20202020, 0x2f202020, 0x695b202f, 0x33205d6e, 
-    0x6e617220, 0x206d6f64, 0x2e2e305b, 0x0a0d5d31, 0x6c662020, 0x2074616f, 0x66647020, 0x2020203b, 0x20202020, 
-    0x20202020, 0x202f2f20, 0x74756f5b, 0x4450205d, 0x200a0d46, 0x6f6c6620, 0x20337461, 0x66647362, 0x65766f5f, 
-    0x64705f72, 0x20203b66, 0x5b202f2f, 0x5d74756f, 0x6e6f6320, 0x62697274, 0x6f697475, 0x202f206e, 0x0d464450, 
-    0x6920200a, 0x2020746e, 0x76652020, 0x5f746e65, 0x65707974, 0x2020203b, 0x2f2f2020, 0x756f5b20, 0x6f205d74, 
-    0x6f20656e, 0x68742066, 0x76652065, 0x20746e65, 0x766f6261, 0x7d0a0d65, 0x0d0a0d3b, 0x6e65230a, 0x20666964, 
-    0x202f2f20, 0x4b56564e, 0x425f4c48, 0x5f464453, 0x55525453, 0x5f535443, 0x000a0d48, 0x00110007, 0x0000001f, 
-    0x575c3a46, 0x6f646e69, 0x445c7377, 0x746b7365, 0x6e5c706f, 0x6f727076, 0x726f635f, 0x6e5c3265, 0x61687376, 
-    0x73726564, 0x6473625c, 0x79745f66, 0x2e736570, 0x6c732e68, 0x00676e61, 0x072f0007, 0x00000020, 0x0a0d2a2f, 
-    0x43202a20, 0x7279706f, 0x74686769, 0x29632820, 0x31303220, 0x30322d39, 0x202c3532, 0x4449564e, 0x43204149, 
-    0x4f50524f, 0x49544152, 0x202e4e4f, 0x6c6c4120, 0x67697220, 0x20737468, 0x65736572, 0x64657672, 0x200a0d2e, 
-    0x200a0d2a, 0x694c202a, 0x736e6563, 0x75206465, 0x7265646e, 0x65687420, 0x61704120, 0x20656863, 0x6563694c, 
-    0x2c65736e, 0x72655620, 0x6e6f6973, 0x302e3220, 0x68742820, 0x4c222065, 0x6e656369, 0x29226573, 0x200a0d3b, 
-    0x6f79202a, 0x616d2075, 0x6f6e2079, 0x73752074, 0x68742065, 0x66207369, 0x20656c69, 0x65637865, 0x69207470, 
-    0x6f63206e, 0x696c706d, 0x65636e61, 0x74697720, 0x68742068, 0x694c2065, 0x736e6563, 0x0a0d2e65, 0x59202a20, 
-    0x6d20756f, 0x6f207961, 0x69617462, 0x2061206e, 0x79706f63, 0x20666f20, 0x20656874, 0x6563694c, 0x2065736e, 
-    0x0a0d7461, 0x0a0d2a20, 0x20202a20, 0x68202020, 0x3a707474, 0x77772f2f, 0x70612e77, 0x65686361, 0x67726f2e, 
-    0x63696c2f, 0x65736e65, 0x494c2f73, 0x534e4543, 0x2e322d45, 0x200a0d30, 0x200a0d2a, 0x6e55202a, 0x7373656c, 
-    0x71657220, 0x65726975, 0x79622064, 0x70706120, 0x6163696c, 0x20656c62, 0x2077616c, 0x6120726f, 0x65657267, 
-    0x6f742064, 0x206e6920, 0x74697277, 0x2c676e69, 0x666f7320, 0x72617774, 0x200a0d65, 0x6964202a, 0x69727473, 
-    0x65747562, 0x6e752064, 0x20726564, 0x20656874, 0x6563694c, 0x2065736e, 0x64207369, 0x72747369, 0x74756269, 
-    0x6f206465, 0x6e61206e, 0x53412220, 0x22534920, 0x53414220, 0x0d2c5349, 0x202a200a, 0x48544957, 0x2054554f, 
-    0x52524157, 0x49544e41, 0x4f205345, 0x4f432052, 0x5449444e, 0x534e4f49, 0x20464f20, 0x20594e41, 0x444e494b, 
-    0x6965202c, 0x72656874, 0x70786520, 0x73736572, 0x20726f20, 0x6c706d69, 0x2e646569, 0x2a200a0d, 0x65655320, 
-    0x65687420, 0x63694c20, 0x65736e65, 0x726f6620, 0x65687420, 0x65707320, 0x69666963, 0x616c2063, 0x6175676e, 
-    0x67206567, 0x7265766f, 0x676e696e, 0x72657020, 0x7373696d, 0x736e6f69, 0x646e6120, 0x2a200a0d, 0x6d696c20, 
-    0x74617469, 0x736e6f69, 0x646e7520, 0x74207265, 0x4c206568, 0x6e656369, 0x0d2e6573, 0x0d2a200a, 0x202a200a, 
-    0x58445053, 0x6c69462d, 0x706f4365, 0x67697279, 0x65547468, 0x203a7478, 0x79706f43, 0x68676972, 0x63282074, 
-    0x30322029, 0x322d3931, 0x20313230, 0x4449564e, 0x43204149, 0x4f50524f, 0x49544152, 0x0a0d4e4f, 0x53202a20, 
-    0x2d584450, 0x6563694c, 0x2d65736e, 0x6e656449, 0x69666974, 0x203a7265, 0x63617041, 0x322d6568, 0x0a0d302e, 
-    0x0d2f2a20, 0x230a0d0a, 0x646e6669, 0x50206665, 0x475f5242, 0x0d4c534c, 0x6564230a, 0x656e6966, 0x52425020, 
-    0x534c475f, 0x0d0a0d4c, 0x6e69230a, 0x64756c63, 0x6e222065, 0x61687376, 0x73726564, 0x616c732f, 0x745f676e, 
-    0x73657079, 0x0d22682e, 0x230a0d0a, 0x6c636e69, 0x20656475, 0x73766e22, 0x65646168, 0x622f7372, 0x5f666473, 
-    0x65707974, 0x2e682e73, 0x6e616c73, 0x0a0d2267, 0x636e6923, 0x6564756c, 0x766e2220, 0x64616873, 0x2f737265, 
-    0x66647362, 0x6e75665f, 0x6f697463, 0x682e736e, 0x616c732e, 0x0d22676e, 0x230a0d0a, 0x6c636e69, 0x20656475, 
-    0x73766e22, 0x65646168, 0x662f7372, 0x74636e75, 0x736e6f69, 0x732e682e, 0x676e616c, 0x0d0a0d22, 0x7274730a, 
-    0x20746375, 0x42726250, 0x4d657361, 0x72657461, 0x0d6c6169, 0x0a0d7b0a, 0x6c662020, 0x3374616f, 0x73616220, 
-    0x6c6f4365, 0x3d20726f, 0x2e317b20, 0x31202c46, 0x202c462e, 0x7d462e31, 0x2f20203b, 0x6162202f, 0x63206573, 
-    0x726f6c6f, 0x20200a0d, 0x616f6c66, 0x6f202074, 0x69636170, 0x20207974, 0x31203d20, 0x203b462e, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x2f202020, 0x2031202f, 0x706f203d, 0x65757161, 0x2030202c, 0x7566203d, 
-    0x20796c6c, 0x6e617274, 0x72617073, 0x0d746e65, 0x6620200a, 0x74616f6c, 0x6f722032, 0x6e686775, 0x20737365, 
-    0x207b203d, 0x2c462e31, 0x462e3120, 0x203b7d20, 0x20202020, 0x20202020, 0x2f2f2020, 0x3d203020, 0x6f6d7320, 
-    0x2c68746f, 0x3d203120, 0x756f7220, 0x28206867, 0x73696e61, 0x6f72746f, 0x3a636970, 0x3d207820, 0x202c5520, 
-    0x203d2079, 0x0a0d2956, 0x6c662020, 0x2074616f, 0x74656d20, 0x696c6c61, 0x3d202063, 0x462e3120, 0x2020203b, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x202f2f20, 0x203d2030, 0x6c656964, 0x72746365, 0x202c6369, 
-    0x203d2031, 0x6174656d, 0x63696c6c, 0x20200a0d, 0x616f6c66, 0x65203374, 0x7373696d, 0x20657669, 0x7b203d20, 
-    0x462e3020, 0x2e30202c, 0x30202c46, 0x7d20462e, 0x2020203b, 0x2f202020, 0x6d65202f, 0x69737369, 0x63206576, 
-    0x726f6c6f, 0x20200a0d, 0x616f6c66, 0x6f202074, 0x756c6363, 0x6e6f6973, 0x31203d20, 0x203b662e, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x2f202020, 0x636f202f, 0x73756c63, 0x206e6f69, 0x74636166, 0x0a0d726f, 
-    0x6c662020, 0x2074616f, 0x726f6920, 0x20202031, 0x3d202020, 0x462e3120, 0x2020203b, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x202f2f20, 0x65646e69, 0x666f2078, 0x66657220, 0x74636172, 0x206e6f69, 0x7563203a, 
-    0x6e657272, 0x656d2074, 0x6d756964, 0x2e692820, 0x61202e65, 0x0d297269, 0x6620200a, 0x74616f6c, 0x6f692020, 
-    0x20203272, 0x20202020, 0x2e31203d, 0x203b4635, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x2f2f2020, 
-    0x646e6920, 0x6f207865, 0x65722066, 0x63617266, 0x6e6f6974, 0x74203a20, 0x6f206568, 0x72656874, 0x64697320, 
-    0x69282065, 0x202e652e, 0x73616c67, 0x0a0d2973, 0x20200a0d, 0x616f6c66, 0x4e203374, 0x203d2020, 0x2e30207b, 
-    0x30202c46, 0x202c462e, 0x20462e31, 0x20203b7d, 0x73202f2f, 0x69646168, 0x6e20676e, 0x616d726f, 0x200a0d6c, 
-    0x6f6c6620, 0x20337461, 0x3d20674e, 0x30207b20, 0x202c462e, 0x2c462e30, 0x462e3120, 0x203b7d20, 0x202f2f20, 
-    0x6d6f6567, 0x69727465, 0x6f6e2063, 0x6c616d72, 0x20200a0d, 0x616f6c66, 0x54203374, 0x203d2020, 0x2e31207b, 
-    0x30202c46, 0x202c462e, 0x20462e30, 0x20203b7d, 0x74202f2f, 0x65676e61, 0x0a0d746e, 0x6c662020, 0x3374616f, 
-    0x20204220, 0x207b203d, 0x2c462e30, 0x462e3120, 0x2e30202c, 0x3b7d2046, 0x2f2f2020, 0x74696220, 0x65676e61, 
-    0x0a0d746e, 0x0a0d3b7d, 0x2a2f0a0d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x230a0d2d, 0x6e754620, 0x6f697463, 0x6260206e, 0x45666473, 0x756c6176, 0x53657461, 0x6c706d69, 0x0a0d6065, 
-    0x7645203e, 0x61756c61, 0x20736574, 0x20656874, 0x706d6973, 0x4220656c, 0x20464453, 0x65646f6d, 0x7375206c, 
-    0x20676e69, 0x20656874, 0x65766967, 0x616d206e, 0x69726574, 0x61206c61, 0x6920646e, 0x7475706e, 0x646e6120, 
-    0x74756f20, 0x20747570, 0x65726964, 0x6f697463, 0x0d2e736e, 0x590a0d0a, 0x6d20756f, 0x20747375, 0x766f7270, 
-    0x20656469, 0x74616460, 0x316b2e61, 0x6e612060, 0x64602064, 0x2e617461, 0x2c60326b, 0x74756220, 0x206f6420, 
-    0x20746f6e, 0x6465656e, 0x206f7420, 0x766f7270, 0x20656469, 0x74616460, 0x69782e61, 0x0a0d2e60, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0d2f2a2d, 0x696f760a, 0x73622064, 0x76456664, 
-    0x61756c61, 0x69536574, 0x656c706d, 0x6f6e6928, 0x42207475, 0x45666473, 0x756c6176, 0x44657461, 0x20617461, 
-    0x61746164, 0x6250202c, 0x73614272, 0x74614d65, 0x61697265, 0x616d206c, 0x0a0d2974, 0x200a0d7b, 0x202f2f20, 
-    0x63657053, 0x72616c75, 0x66657220, 0x7463656c, 0x0d6e6f69, 0x6620200a, 0x74616f6c, 0x20482033, 0x20202020, 
-    0x6f6e203d, 0x6c616d72, 0x28657a69, 0x61746164, 0x20316b2e, 0x6164202b, 0x6b2e6174, 0x0d3b2932, 0x6620200a, 
-    0x74616f6c, 0x644e2020, 0x2056746f, 0x6c63203d, 0x65706d61, 0x746f4464, 0x74616d28, 0x202c4e2e, 0x61746164, 
-    0x29316b2e, 0x200a0d3b, 0x6f6c6620, 0x20207461, 0x746f644e, 0x203d204c, 0x6d616c63, 0x44646570, 0x6d28746f, 
-    0x4e2e7461, 0x6164202c, 0x6b2e6174, 0x0d3b2932, 0x6620200a, 0x74616f6c, 0x64562020, 0x2048746f, 0x6c63203d, 
-    0x65706d61, 0x746f4464, 0x74616428, 0x316b2e61, 0x2948202c, 0x200a0d3b, 0x6f6c6620, 0x20207461, 0x746f644e, 
-    0x203d2048, 0x6d616c63, 0x44646570, 0x6d28746f, 0x4e2e7461, 0x2948202c, 0x0d0a0d3b, 0x6920200a, 0x644e2866, 
-    0x2056746f, 0x30203d3d, 0x2066302e, 0x4e207c7c, 0x4c746f64, 0x203d3d20, 0x66302e30, 0x207c7c20, 0x746f6456, 
-    0x3d3d2048, 0x302e3020, 0x7c7c2066, 0x6f644e20, 0x3d204874, 0x2e30203d, 0x0d296630, 0x7b20200a, 0x20200a0d, 
-    0x61642020, 0x622e6174, 0x5f666473, 0x66666964, 0x20657375, 0x6164203d, 0x622e6174, 0x5f666473, 0x736f6c67, 
-    0x3d207973, 0x6f6c6620, 0x28337461, 0x66302e30, 0x0a0d3b29, 0x20202020, 0x61746164, 0x6664702e, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x30203d20, 0x3b66302e, 0x20200a0d, 
-    0x65722020, 0x6e727574, 0x200a0d3b, 0x0a0d7d20, 0x20200a0d, 0x57202f2f, 0x6f632065, 0x6e69626d, 0x68742065, 
-    0x656d2065, 0x6c6c6174, 0x61206369, 0x7320646e, 0x75636570, 0x2072616c, 0x65626f6c, 0x6e692073, 0x61206f74, 
-    0x6e697320, 0x20656c67, 0x736f6c67, 0x6c207973, 0x2e65626f, 0x20200a0d, 0x54202f2f, 0x6d206568, 0x6c617465, 
-    0x2063696c, 0x67696577, 0x69207468, 0x20202073, 0x656d2020, 0x6c6c6174, 0x2a206369, 0x20202020, 0x73657266, 
-    0x286c656e, 0x3d203066, 0x73616220, 0x6c6f4365, 0x0d29726f, 0x2f20200a, 0x6854202f, 0x70732065, 0x6c756365, 
-    0x77207261, 0x68676965, 0x73692074, 0x2d312820, 0x6174656d, 0x63696c6c, 0x202a2029, 0x66202020, 0x6e736572, 
-    0x66286c65, 0x203d2030, 0x696d5f63, 0x65725f6e, 0x63656c66, 0x636e6174, 0x0a0d2965, 0x2f2f2020, 0x65685420, 
-    0x66696420, 0x65737566, 0x69657720, 0x20746867, 0x20207369, 0x6d2d3128, 0x6c617465, 0x2963696c, 0x28202a20, 
-    0x72662d31, 0x656e7365, 0x3066286c, 0x63203d20, 0x6e696d5f, 0x6665725f, 0x7463656c, 0x65636e61, 0x2a202929, 
-    0x73616220, 0x6c6f4365, 0x0a0d726f, 0x20200a0d, 0x46202f2f, 0x6e736572, 0x74206c65, 0x736d7265, 0x20200a0d, 
-    0x616f6c66, 0x63202074, 0x6e696d5f, 0x6665725f, 0x7463656c, 0x65636e61, 0x30203d20, 0x4634302e, 0x200a0d3b, 
-    0x6f6c6620, 0x20337461, 0x20203066, 0x20202020, 0x20202020, 0x20202020, 0x203d2020, 0x7072656c, 0x6f6c6628, 
-    0x28337461, 0x696d5f63, 0x65725f6e, 0x63656c66, 0x636e6174, 0x202c2965, 0x2e74616d, 0x65736162, 0x6f6c6f43, 
-    0x6d202c72, 0x6d2e7461, 0x6c617465, 0x2963696c, 0x200a0d3b, 0x6f6c6620, 0x20337461, 0x6f6c4766, 0x20797373, 
-    0x20202020, 0x20202020, 0x203d2020, 0x6c686373, 0x466b6369, 0x6e736572, 0x66286c65, 0x66202c30, 0x74616f6c, 
-    0x2e312833, 0x2c294630, 0x6f645620, 0x3b294874, 0x2f2f2020, 0x74654d20, 0x696c6c61, 0x202b2063, 0x63657073, 
-    0x72616c75, 0x20200a0d, 0x616f6c66, 0x66202074, 0x66666944, 0x20657375, 0x20202020, 0x20202020, 0x73203d20, 
-    0x696c6863, 0x72466b63, 0x656e7365, 0x2e31286c, 0x2d204630, 0x6d5f6320, 0x725f6e69, 0x656c6665, 0x6e617463, 
-    0x202c6563, 0x46302e30, 0x6456202c, 0x2948746f, 0x28202a20, 0x46302e31, 0x6d202d20, 0x6d2e7461, 0x6c617465, 
-    0x2963696c, 0x0d0a0d3b, 0x2f20200a, 0x7053202f, 0x6c756365, 0x47207261, 0x0a0d5847, 0x6c662020, 0x3374616f, 
-    0x636f6c20, 0x20486c61, 0x66203d20, 0x74616f6c, 0x6f642833, 0x616d2874, 0x2c542e74, 0x2c294820, 0x746f6420, 
-    0x74616d28, 0x202c422e, 0x202c2948, 0x746f644e, 0x0d3b2948, 0x6620200a, 0x74616f6c, 0x20642020, 0x20202020, 
-    0x203d2020, 0x5f647668, 0x5f786767, 0x6c617665, 0x302e3128, 0x202f2066, 0x2e74616d, 0x67756f72, 0x73656e68, 
-    0x6c202c73, 0x6c61636f, 0x0d3b2948, 0x6620200a, 0x74616f6c, 0x6f6c2033, 0x4b6c6163, 0x203d2031, 0x616f6c66, 
-    0x64283374, 0x6d28746f, 0x542e7461, 0x6164202c, 0x6b2e6174, 0x202c2931, 0x28746f64, 0x2e74616d, 0x64202c42, 
-    0x2e617461, 0x2c29316b, 0x6f644e20, 0x3b295674, 0x20200a0d, 0x616f6c66, 0x6c203374, 0x6c61636f, 0x3d20324b, 
-    0x6f6c6620, 0x28337461, 0x28746f64, 0x2e74616d, 0x64202c54, 0x2e617461, 0x2c29326b, 0x746f6420, 0x74616d28, 
-    0x202c422e, 0x61746164, 0x29326b2e, 0x644e202c, 0x294c746f, 0x200a0d3b, 0x6f6c6620, 0x20207461, 0x3d203147, 
-    0x302e3020, 0x47202c66, 0x203d2032, 0x66302e30, 0x200a0d3b, 0x78676720, 0x696d735f, 0x735f6874, 0x6f646168, 
-    0x616d5f77, 0x47286b73, 0x47202c31, 0x6c202c32, 0x6c61636f, 0x202c314b, 0x61636f6c, 0x2c324b6c, 0x74616d20, 
-    0x756f722e, 0x656e6867, 0x3b297373, 0x0a0d0a0d, 0x6c662020, 0x2074616f, 0x66666964, 0x50657375, 0x20206664, 
-    0x5f4d203d, 0x49505f31, 0x4e202a20, 0x4c746f64, 0x200a0d3b, 0x6f6c6620, 0x73207461, 0x75636570, 0x5072616c, 
-    0x3d206664, 0x20314720, 0x2064202a, 0x2e30202a, 0x20663532, 0x4e28202f, 0x56746f64, 0x4e202a20, 0x48746f64, 
-    0x0a0d3b29, 0x61642020, 0x702e6174, 0x20206664, 0x20202020, 0x20202020, 0x656c203d, 0x64287072, 0x75666669, 
-    0x64506573, 0x73202c66, 0x75636570, 0x5072616c, 0x202c6664, 0x66647362, 0x706d6953, 0x6c47656c, 0x7973736f, 
-    0x626f7250, 0x6c696261, 0x28797469, 0x746f644e, 0x6d202c56, 0x6d2e7461, 0x6c617465, 0x2963696c, 0x0a0d3b29, 
-    0x20200a0d, 0x61746164, 0x6473622e, 0x69645f66, 0x73756666, 0x203d2065, 0x2e74616d, 0x65736162, 0x6f6c6f43, 
-    0x202a2072, 0x66694466, 0x65737566, 0x64202a20, 0x75666669, 0x64506573, 0x20203b66, 0x4c202f2f, 0x65626d61, 
-    0x61697472, 0x200a0d6e, 0x74616420, 0x73622e61, 0x675f6664, 0x73736f6c, 0x3d202079, 0x6c476620, 0x7973736f, 
-    0x47202a20, 0x202a2032, 0x63657073, 0x72616c75, 0x3b666450, 0x20202020, 0x20202020, 0x20202020, 0x202f2f20, 
-    0x2d584747, 0x74696d53, 0x7d0a0d68, 0x0a0d0a0d, 0x2d2d2a2f, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x0d2d2d2d, 0x4620230a, 0x74636e75, 0x206e6f69, 0x64736260, 0x6d615366, 0x53656c70, 0x6c706d69, 
-    0x0a0d6065, 0x7645203e, 0x61756c61, 0x20736574, 0x20656874, 0x706d6973, 0x4220656c, 0x20464453, 0x65646f6d, 
-    0x7375206c, 0x20676e69, 0x20656874, 0x65766967, 0x616d206e, 0x69726574, 0x61206c61, 0x6920646e, 0x7475706e, 
-    0x646e6120, 0x74756f20, 0x20747570, 0x65726964, 0x6f697463, 0x0d2e736e, 0x590a0d0a, 0x6d20756f, 0x20747375, 
-    0x766f7270, 0x20656469, 0x74616460, 0x316b2e61, 0x6e612060, 0x64602064, 0x2e617461, 0x2e606978, 0x726f4620, 
-    0x656e6f20, 0x6d617320, 0x20656c70, 0x7020666f, 0x20657275, 0x6c666572, 0x69746365, 0x0a0d6e6f, 0x672e6528, 
-    0x6b76202e, 0x6e696d5f, 0x61735f69, 0x656c706d, 0x61722f73, 0x72745f79, 0x29656361, 0x7375202c, 0x64602065, 
-    0x2e617461, 0x3d206978, 0x6c66203d, 0x3274616f, 0x302c3028, 0x0d2e6029, 0x410a0d0a, 0x72657466, 0x6c616320, 
-    0x676e696c, 0x69687420, 0x75662073, 0x6974636e, 0x202c6e6f, 0x20756f79, 0x756f6873, 0x6320646c, 0x6b636568, 
-    0x20666920, 0x74616460, 0x76652e61, 0x5f746e65, 0x65707974, 0x73692060, 0x42600a0d, 0x5f464453, 0x4e455645, 
-    0x42415f54, 0x42524f53, 0x49202e60, 0x6f732066, 0x6874202c, 0x61732065, 0x696c706d, 0x6320676e, 0x2065646f, 
-    0x706d6173, 0x2064656c, 0x69642061, 0x74636572, 0x206e6f69, 0x6f6c6562, 0x68742077, 0x730a0d65, 0x61667275, 
-    0x202c6563, 0x20646e61, 0x20656874, 0x6867696c, 0x61702074, 0x65206874, 0x2073646e, 0x65726568, 0x74692820, 
-    0x6f687320, 0x20646c75, 0x74206562, 0x74616572, 0x61206465, 0x20612073, 0x6c666572, 0x61746365, 0x2065636e, 
-    0x3020666f, 0x0a0d2e29, 0x68540a0d, 0x63207369, 0x2065646f, 0x6e6e6163, 0x6320746f, 0x65727275, 0x796c746e, 
-    0x74657220, 0x206e7275, 0x44502061, 0x666f2046, 0x49446020, 0x60434152, 0x7562202c, 0x68742074, 0x6d207461, 
-    0x74686769, 0x61686320, 0x2065676e, 0x0a0d6e69, 0x20656874, 0x75747566, 0x0d2e6572, 0x2d2d2d0a, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2f2a2d2d, 0x6f760a0d, 0x62206469, 0x53666473, 0x6c706d61, 
-    0x6d695365, 0x28656c70, 0x756f6e69, 0x73422074, 0x61536664, 0x656c706d, 0x61746144, 0x74616420, 0x50202c61, 
-    0x61427262, 0x614d6573, 0x69726574, 0x6d206c61, 0x0d297461, 0x0a0d7b0a, 0x6c662020, 0x3374616f, 0x6e697420, 
-    0x20202074, 0x20202020, 0x6d203d20, 0x622e7461, 0x43657361, 0x726f6c6f, 0x200a0d3b, 0x74616420, 0x73622e61, 
-    0x6f5f6664, 0x5f726576, 0x20666470, 0x6c66203d, 0x3374616f, 0x302e3028, 0x0d3b2946, 0x200a0d0a, 0x6f6c6620, 
-    0x6e207461, 0x3d20316b, 0x616c6320, 0x6465706d, 0x28746f44, 0x2e74616d, 0x64202c4e, 0x2e617461, 0x3b29316b, 
-    0x20200a0d, 0x64286669, 0x2e617461, 0x7a2e6978, 0x203d3c20, 0x66647362, 0x706d6953, 0x6c47656c, 0x7973736f, 
-    0x626f7250, 0x6c696261, 0x28797469, 0x2c316b6e, 0x74616d20, 0x74656d2e, 0x696c6c61, 0x0d292963, 0x7b20200a, 
-    0x20200a0d, 0x2f2f2020, 0x6f6c4720, 0x20797373, 0x0d584747, 0x2020200a, 0x74616420, 0x76652e61, 0x5f746e65, 
-    0x65707974, 0x42203d20, 0x5f464453, 0x4e455645, 0x4c475f54, 0x5953534f, 0x4645525f, 0x5443454c, 0x3b4e4f49, 
-    0x20200a0d, 0x2f2f2020, 0x61725420, 0x6f66736e, 0x74206d72, 0x6f6c206f, 0x206c6163, 0x63617073, 0x200a0d65, 
-    0x66202020, 0x74616f6c, 0x6f6c2033, 0x4b6c6163, 0x20202031, 0x66203d20, 0x74616f6c, 0x6f642833, 0x616d2874, 
-    0x2c542e74, 0x74616420, 0x316b2e61, 0x64202c29, 0x6d28746f, 0x422e7461, 0x6164202c, 0x6b2e6174, 0x202c2931, 
-    0x29316b6e, 0x200a0d3b, 0x66202020, 0x74616f6c, 0x61682033, 0x6556666c, 0x726f7463, 0x68203d20, 0x675f6476, 
-    0x735f7867, 0x6c706d61, 0x6e765f65, 0x6c286664, 0x6c61636f, 0x202c314b, 0x2e74616d, 0x67756f72, 0x73656e68, 
-    0x64202c73, 0x2e617461, 0x782e6978, 0x0d3b2979, 0x2020200a, 0x202f2f20, 0x6e617254, 0x726f6673, 0x7266206d, 
-    0x6c206d6f, 0x6c61636f, 0x61707320, 0x0a0d6563, 0x20202020, 0x666c6168, 0x74636556, 0x3d20726f, 0x74616d20, 
-    0x2a20542e, 0x6c616820, 0x63655666, 0x2e726f74, 0x202b2078, 0x2e74616d, 0x202a2042, 0x666c6168, 0x74636556, 
-    0x792e726f, 0x6d202b20, 0x4e2e7461, 0x68202a20, 0x56666c61, 0x6f746365, 0x3b7a2e72, 0x20200a0d, 0x61642020, 
-    0x6b2e6174, 0x20202032, 0x72203d20, 0x656c6665, 0x2d287463, 0x61746164, 0x2c316b2e, 0x6c616820, 0x63655666, 
-    0x29726f74, 0x200a0d3b, 0x0a0d7d20, 0x6c652020, 0x0a0d6573, 0x0d7b2020, 0x2020200a, 0x202f2f20, 0x66666944, 
-    0x0d657375, 0x2020200a, 0x74616420, 0x76652e61, 0x5f746e65, 0x65707974, 0x42203d20, 0x5f464453, 0x4e455645, 
-    0x49445f54, 0x53554646, 0x45525f45, 0x43454c46, 0x4e4f4954, 0x200a0d3b, 0x66202020, 0x74616f6c, 0x6f6c2033, 
-    0x446c6163, 0x3d207269, 0x736f6320, 0x53656e69, 0x6c706d61, 0x6d654865, 0x68707369, 0x28657265, 0x61746164, 
-    0x2e69782e, 0x64202c78, 0x2e617461, 0x792e6978, 0x0a0d3b29, 0x20202020, 0x61746164, 0x20326b2e, 0x20202020, 
-    0x20202020, 0x616d203d, 0x20542e74, 0x6f6c202a, 0x446c6163, 0x782e7269, 0x6d202b20, 0x422e7461, 0x6c202a20, 
-    0x6c61636f, 0x2e726944, 0x202b2079, 0x2e74616d, 0x202a204e, 0x61636f6c, 0x7269446c, 0x0d3b7a2e, 0x7d20200a, 
-    0x0a0d0a0d, 0x73422020, 0x76456664, 0x61756c61, 0x61446574, 0x65206174, 0x446c6176, 0x3b617461, 0x20200a0d, 
-    0x6c617665, 0x61746144, 0x20316b2e, 0x6164203d, 0x6b2e6174, 0x0a0d3b31, 0x76652020, 0x61446c61, 0x6b2e6174, 
-    0x203d2032, 0x61746164, 0x3b326b2e, 0x20200a0d, 0x66647362, 0x6c617645, 0x65746175, 0x706d6953, 0x6528656c, 
-    0x446c6176, 0x2c617461, 0x74616d20, 0x0a0d3b29, 0x61642020, 0x702e6174, 0x20206664, 0x20202020, 0x20202020, 
-    0x7665203d, 0x61446c61, 0x702e6174, 0x0d3b6664, 0x6620200a, 0x74616f6c, 0x73622033, 0x745f6664, 0x6c61746f, 
-    0x65203d20, 0x446c6176, 0x2e617461, 0x66647362, 0x6669645f, 0x65737566, 0x65202b20, 0x446c6176, 0x2e617461, 
-    0x66647362, 0x6f6c675f, 0x3b797373, 0x20200a0d, 0x64286669, 0x2e617461, 0x20666470, 0x30203d3c, 0x3030302e, 
-    0x20463130, 0x61207c7c, 0x6928796e, 0x6e616e73, 0x64736228, 0x6f745f66, 0x296c6174, 0x0a0d2929, 0x0d7b2020, 
-    0x2020200a, 0x74616420, 0x73622e61, 0x6f5f6664, 0x5f726576, 0x20666470, 0x6c66203d, 0x3374616f, 0x302e3028, 
-    0x0d3b2966, 0x2020200a, 0x74616420, 0x76652e61, 0x5f746e65, 0x65707974, 0x20202020, 0x5342203d, 0x455f4644, 
-    0x544e4556, 0x5342415f, 0x3b42524f, 0x20200a0d, 0x200a0d7d, 0x736c6520, 0x200a0d65, 0x0a0d7b20, 0x20202020, 
-    0x61746164, 0x6473622e, 0x766f5f66, 0x705f7265, 0x3d206664, 0x64736220, 0x6f745f66, 0x206c6174, 0x6164202f, 
-    0x702e6174, 0x0d3b6664, 0x7d20200a, 0x0d7d0a0d, 0x500a0d0a, 0x61427262, 0x614d6573, 0x69726574, 0x69206c61, 
-    0x5074696e, 0x61427262, 0x614d6573, 0x69726574, 0x66286c61, 0x74616f6c, 0x61622033, 0x6f436573, 0x2c726f6c, 
-    0x6f6c6620, 0x6d207461, 0x6c617465, 0x2c63696c, 0x6f6c6620, 0x72207461, 0x6867756f, 0x7373656e, 0x6c66202c, 
-    0x3374616f, 0x202c4e20, 0x616f6c66, 0x4e203374, 0x0a0d2967, 0x200a0d7b, 0x72625020, 0x65736142, 0x6574614d, 
-    0x6c616972, 0x74616d20, 0x7b203d20, 0x0a0d3b7d, 0x616d2020, 0x61622e74, 0x6f436573, 0x20726f6c, 0x20202020, 
-    0x203d2020, 0x65736162, 0x6f6c6f43, 0x0a0d3b72, 0x616d2020, 0x656d2e74, 0x6c6c6174, 0x20206369, 0x20202020, 
-    0x203d2020, 0x6174656d, 0x63696c6c, 0x200a0d3b, 0x74616d20, 0x756f722e, 0x656e6867, 0x20207373, 0x20202020, 
-    0x66203d20, 0x74616f6c, 0x6f722832, 0x6e686775, 0x20737365, 0x6f72202a, 0x6e686775, 0x29737365, 0x200a0d3b, 
-    0x74616d20, 0x20674e2e, 0x20202020, 0x20202020, 0x20202020, 0x4e203d20, 0x0a0d3b67, 0x616d2020, 0x204e2e74, 
-    0x20202020, 0x20202020, 0x20202020, 0x203d2020, 0x0a0d3b4e, 0x726f2020, 0x6e6f6874, 0x616d726f, 0x7361426c, 
-    0x6d287369, 0x4e2e7461, 0x616d202c, 0x2c542e74, 0x74616d20, 0x3b29422e, 0x0a0d0a0d, 0x65722020, 0x6e727574, 
-    0x74616d20, 0x7d0a0d3b, 0x0a0d0a0d, 0x6c660a0d, 0x3374616f, 0x72627020, 0x6174654d, 0x63696c6c, 0x67756f52, 
-    0x73656e68, 0x6c662873, 0x3374616f, 0x626c6120, 0x2c6f6465, 0x6f6c6620, 0x6d207461, 0x6c617465, 0x2c63696c, 
-    0x6f6c6620, 0x72207461, 0x6867756f, 0x7373656e, 0x6c66202c, 0x3374616f, 0x202c4e20, 0x616f6c66, 0x56203374, 
-    0x6c66202c, 0x3374616f, 0x0d294c20, 0x0a0d7b0a, 0x73422020, 0x76456664, 0x61756c61, 0x61446574, 0x64206174, 
-    0x3b617461, 0x20200a0d, 0x61746164, 0x20316b2e, 0x3b56203d, 0x20200a0d, 0x61746164, 0x20326b2e, 0x3b4c203d, 
-    0x20200a0d, 0x61746164, 0x2069782e, 0x6c66203d, 0x3374616f, 0x302e3028, 0x203b2966, 0x202f2f20, 0x20746f4e, 
-    0x64657375, 0x206e6920, 0x6c617665, 0x69746175, 0x0a0d6e6f, 0x62502020, 0x73614272, 0x74614d65, 0x61697265, 
-    0x616d206c, 0x0a0d3b74, 0x616d2020, 0x61622e74, 0x6f436573, 0x20726f6c, 0x6c61203d, 0x6f646562, 0x200a0d3b, 
-    0x74616d20, 0x74656d2e, 0x696c6c61, 0x3d202063, 0x74656d20, 0x696c6c61, 0x0a0d3b63, 0x616d2020, 0x6f722e74, 
-    0x6e686775, 0x20737365, 0x6c66203d, 0x3274616f, 0x756f7228, 0x656e6867, 0x202c7373, 0x67756f72, 0x73656e68, 
-    0x0d3b2973, 0x6d20200a, 0x4e2e7461, 0x20202020, 0x20202020, 0x4e203d20, 0x200a0d3b, 0x74726f20, 0x6f6e6f68, 
-    0x6c616d72, 0x69736142, 0x616d2873, 0x2c4e2e74, 0x74616d20, 0x202c542e, 0x2e74616d, 0x0d3b2942, 0x6220200a, 
-    0x45666473, 0x756c6176, 0x53657461, 0x6c706d69, 0x61642865, 0x202c6174, 0x2974616d, 0x0d0a0d3b, 0x7220200a, 
-    0x72757465, 0x6164206e, 0x622e6174, 0x5f666473, 0x66666964, 0x20657375, 0x6164202b, 0x622e6174, 0x5f666473, 
-    0x736f6c67, 0x0d3b7973, 0x0a0d7d0a, 0x0a0d0a0d, 0x646e6523, 0x20206669, 0x50202f2f, 0x475f5242, 0x004c534c, 
-    0x00150007, 0x00000022, 0x575c3a46, 0x6f646e69, 0x445c7377, 0x746b7365, 0x765c706f, 0x61725f6b, 0x61727479, 
-    0x676e6963, 0x7475745f, 0x6169726f, 0x484b5f6c, 0x6f635c52, 0x6e6f6d6d, 0x6168735c, 0x73726564, 0x7262705c, 
-    0x732e682e, 0x676e616c, 0x00000000, 0x01640007, 0x00000023, 0x0a0d2a2f, 0x43202a20, 0x7279706f, 0x74686769, 
-    0x29632820, 0x32303220, 0x30322d33, 0x202c3532, 0x4449564e, 0x43204149, 0x4f50524f, 0x49544152, 0x202e4e4f, 
-    0x6c6c4120, 0x67697220, 0x20737468, 0x65736572, 0x64657672, 0x200a0d2e, 0x200a0d2a, 0x694c202a, 0x736e6563, 
-    0x75206465, 0x7265646e, 0x65687420, 0x61704120, 0x20656863, 0x6563694c, 0x2c65736e, 0x72655620, 0x6e6f6973, 
-    0x302e3220, 0x68742820, 0x4c222065, 0x6e656369, 0x29226573, 0x200a0d3b, 0x6f79202a, 0x616d2075, 0x6f6e2079, 
-    0x73752074, 0x68742065, 0x66207369, 0x20656c69, 0x65637865, 0x69207470, 0x6f63206e, 0x696c706d, 0x65636e61, 
-    0x74697720, 0x68742068, 0x694c2065, 0x736e6563, 0x0a0d2e65, 0x59202a20, 0x6d20756f, 0x6f207961, 0x69617462, 
-    0x2061206e, 0x79706f63, 0x20666f20, 0x20656874, 0x6563694c, 0x2065736e, 0x0a0d7461, 0x0a0d2a20, 0x20202a20, 
-    0x68202020, 0x3a707474, 0x77772f2f, 0x70612e77, 0x65686361, 0x67726f2e, 0x63696c2f, 0x65736e65, 0x494c2f73, 
-    0x534e4543, 0x2e322d45, 0x200a0d30, 0x200a0d2a, 0x6e55202a, 0x7373656c, 0x71657220, 0x65726975, 0x79622064, 
-    0x70706120, 0x6163696c, 0x20656c62, 0x2077616c, 0x6120726f, 0x65657267, 0x6f742064, 0x206e6920, 0x74697277, 
-    0x2c676e69, 0x666f7320, 0x72617774, 0x200a0d65, 0x6964202a, 0x69727473, 0x65747562, 0x6e752064, 0x20726564, 
-    0x20656874, 0x6563694c, 0x2065736e, 0x64207369, 0x72747369, 0x74756269, 0x6f206465, 0x6e61206e, 0x53412220, 
-    0x22534920, 0x53414220, 0x0d2c5349, 0x202a200a, 0x48544957, 0x2054554f, 0x52524157, 0x49544e41, 0x4f205345, 
-    0x4f432052, 0x5449444e, 0x534e4f49, 0x20464f20, 0x20594e41, 0x444e494b, 0x6965202c, 0x72656874, 0x70786520, 
-    0x73736572, 0x20726f20, 0x6c706d69, 0x2e646569, 0x2a200a0d, 0x65655320, 0x65687420, 0x63694c20, 0x65736e65, 
-    0x726f6620, 0x65687420, 0x65707320, 0x69666963, 0x616c2063, 0x6175676e, 0x67206567, 0x7265766f, 0x676e696e, 
-    0x72657020, 0x7373696d, 0x736e6f69, 0x646e6120, 0x2a200a0d, 0x6d696c20, 0x74617469, 0x736e6f69, 0x646e7520, 
-    0x74207265, 0x4c206568, 0x6e656369, 0x0d2e6573, 0x0d2a200a, 0x202a200a, 0x58445053, 0x6c69462d, 0x706f4365, 
-    0x67697279, 0x65547468, 0x203a7478, 0x79706f43, 0x68676972, 0x63282074, 0x30322029, 0x322d3332, 0x2c353230, 
-    0x49564e20, 0x20414944, 0x50524f43, 0x5441524f, 0x2e4e4f49, 0x2a200a0d, 0x44505320, 0x694c2d58, 0x736e6563, 
-    0x64492d65, 0x69746e65, 0x72656966, 0x7041203a, 0x65686361, 0x302e322d, 0x2a200a0d, 0x0d0a0d2f, 0x7270230a, 
-    0x616d6761, 0x636e6f20, 0x0d0a0d65, 0x6e69230a, 0x64756c63, 0x63222065, 0x6f6d6d6f, 0x6f692f6e, 0x746c675f, 
-    0x22682e66, 0x0a0d0a0d, 0x454d414e, 0x43415053, 0x48535f45, 0x52454441, 0x425f4f49, 0x4e494745, 0x0a0d2928, 
-    0x2f2f0a0d, 0x6e694220, 0x676e6964, 0x696f5020, 0x0d73746e, 0x756e650a, 0x6942206d, 0x6e69646e, 0x696f5067, 
-    0x0d73746e, 0x0a0d7b0a, 0x54652020, 0x75747865, 0x20736572, 0x2c30203d, 0x2f2f2020, 0x6e694220, 0x676e6964, 
-    0x696f7020, 0x6620746e, 0x7420726f, 0x75747865, 0x0d736572, 0x6520200a, 0x4974754f, 0x6567616d, 0x2020202c, 
-    0x2f202020, 0x6942202f, 0x6e69646e, 0x6f702067, 0x20746e69, 0x20726f66, 0x7074756f, 0x69207475, 0x6567616d, 
-    0x20200a0d, 0x616c5465, 0x20202c73, 0x20202020, 0x20202020, 0x54202f2f, 0x6c2d706f, 0x6c657665, 0x63636120, 
-    0x72656c65, 0x6f697461, 0x7473206e, 0x74637572, 0x0d657275, 0x0d3b7d0a, 0x730a0d0a, 0x63757274, 0x75542074, 
-    0x75506f74, 0x6f436873, 0x6174736e, 0x0a0d746e, 0x200a0d7b, 0x6f6c6620, 0x78337461, 0x20202033, 0x20202020, 
-    0x6d726f6e, 0x614d6c61, 0x78697274, 0x200a0d3b, 0x746e6920, 0x20202020, 0x20202020, 0x20202020, 0x74736e69, 
-    0x65636e61, 0x65646e49, 0x20203b78, 0x20202020, 0x20202020, 0x20202020, 0x49202f2f, 0x6174736e, 0x2065636e, 
-    0x65646e69, 0x6f662078, 0x68742072, 0x75632065, 0x6e657272, 0x72642074, 0x63207761, 0x0d6c6c61, 0x4720200a, 
-    0x5366746c, 0x656e6563, 0x6f666e49, 0x6373202a, 0x49656e65, 0x416f666e, 0x65726464, 0x203b7373, 0x20202020, 
-    0x20202020, 0x2f2f2020, 0x64644120, 0x73736572, 0x20666f20, 0x20656874, 0x6e656373, 0x6e692065, 0x6d726f66, 
-    0x6f697461, 0x7562206e, 0x72656666, 0x20200a0d, 0x616f6c66, 0x20203274, 0x20202020, 0x6d202020, 0x6c617465, 
-    0x5263696c, 0x6867756f, 0x7373656e, 0x7265764f, 0x65646972, 0x2f20203b, 0x654d202f, 0x6c6c6174, 0x61206369, 
-    0x7220646e, 0x6867756f, 0x7373656e, 0x65766f20, 0x64697272, 0x61762065, 0x7365756c, 0x3b7d0a0d, 0x0a0d0a0d, 
-    0x414e0a0d, 0x5053454d, 0x5f454341, 0x44414853, 0x4f495245, 0x444e455f, 0x0a0d2928, 0x00000000, 0x00190007, 
-    0x00000025, 0x575c3a46, 0x6f646e69, 0x445c7377, 0x746b7365, 0x765c706f, 0x61725f6b, 0x61727479, 0x676e6963, 
-    0x7475745f, 0x6169726f, 0x484b5f6c, 0x61725c52, 0x61727479, 0x745f6563, 0x726f7475, 0x5c6c6169, 0x625f3230, 
-    0x63697361, 0x6168735c, 0x73726564, 0x6168735c, 0x69726564, 0x00682e6f, 0x04780007, 0x00000026, 0x0a0d2a2f, 
-    0x43202a20, 0x7279706f, 0x74686769, 0x29632820, 0x32303220, 0x30322d32, 0x202c3532, 0x4449564e, 0x43204149, 
-    0x4f50524f, 0x49544152, 0x202e4e4f, 0x6c6c4120, 0x67697220, 0x20737468, 0x65736572, 0x64657672, 0x200a0d2e, 
-    0x200a0d2a, 0x694c202a, 0x736e6563, 0x75206465, 0x7265646e, 0x65687420, 0x61704120, 0x20656863, 0x6563694c, 
-    0x2c65736e, 0x72655620, 0x6e6f6973, 0x302e3220, 0x68742820, 0x4c222065, 0x6e656369, 0x29226573, 0x200a0d3b, 
-    0x6f79202a, 0x616d2075, 0x6f6e2079, 0x73752074, 0x68742065, 0x66207369, 0x20656c69, 0x65637865, 0x69207470, 
-    0x6f63206e, 0x696c706d, 0x65636e61, 0x74697720, 0x68742068, 0x694c2065, 0x736e6563, 0x0a0d2e65, 0x59202a20, 
-    0x6d20756f, 0x6f207961, 0x69617462, 0x2061206e, 0x79706f63, 0x20666f20, 0x20656874, 0x6563694c, 0x2065736e, 
-    0x0a0d7461, 0x0a0d2a20, 0x20202a20, 0x68202020, 0x3a707474, 0x77772f2f, 0x70612e77, 0x65686361, 0x67726f2e, 
-    0x63696c2f, 0x65736e65, 0x494c2f73, 0x534e4543, 0x2e322d45, 0x200a0d30, 0x200a0d2a, 0x6e55202a, 0x7373656c, 
-    0x71657220, 0x65726975, 0x79622064, 0x70706120, 0x6163696c, 0x20656c62, 0x2077616c, 0x6120726f, 0x65657267, 
-    0x6f742064, 0x206e6920, 0x74697277, 0x2c676e69, 0x666f7320, 0x72617774, 0x200a0d65, 0x6964202a, 0x69727473, 
-    0x65747562, 0x6e752064, 0x20726564, 0x20656874, 0x6563694c, 0x2065736e, 0x64207369, 0x72747369, 0x74756269, 
-    0x6f206465, 0x6e61206e, 0x53412220, 0x22534920, 0x53414220, 0x0d2c5349, 0x202a200a, 0x48544957, 0x2054554f, 
-    0x52524157, 0x49544e41, 0x4f205345, 0x4f432052, 0x5449444e, 0x534e4f49, 0x20464f20, 0x20594e41, 0x444e494b, 
-    0x6965202c, 0x72656874, 0x70786520, 0x73736572, 0x20726f20, 0x6c706d69, 0x2e646569, 0x2a200a0d, 0x65655320, 
-    0x65687420, 0x63694c20, 0x65736e65, 0x726f6620, 0x65687420, 0x65707320, 0x69666963, 0x616c2063, 0x6175676e, 
-    0x67206567, 0x7265766f, 0x676e696e, 0x72657020, 0x7373696d, 0x736e6f69, 0x646e6120, 0x2a200a0d, 0x6d696c20, 
-    0x74617469, 0x736e6f69, 0x646e7520, 0x74207265, 0x4c206568, 0x6e656369, 0x0d2e6573, 0x0d2a200a, 0x202a200a, 
-    0x58445053, 0x6c69462d, 0x706f4365, 0x67697279, 0x65547468, 0x203a7478, 0x79706f43, 0x68676972, 0x63282074, 
-    0x30322029, 0x322d3232, 0x2c353230, 0x49564e20, 0x20414944, 0x50524f43, 0x5441524f, 0x2e4e4f49, 0x2a200a0d, 
-    0x44505320, 0x694c2d58, 0x736e6563, 0x64492d65, 0x69746e65, 0x72656966, 0x7041203a, 0x65686361, 0x302e322d, 
-    0x2a200a0d, 0x0d0a0d2f, 0x6669230a, 0x6665646e, 0x594b5320, 0x4148535f, 0x49524544, 0x0d485f4f, 0x6564230a, 
-    0x656e6966, 0x594b5320, 0x4148535f, 0x49524544, 0x20485f4f, 0x0d0a0d31, 0x6e69230a, 0x64756c63, 0x73222065, 
-    0x676e616c, 0x7079745f, 0x682e7365, 0x0d0a0d22, 0x4d414e0a, 0x41505345, 0x535f4543, 0x45444148, 0x5f4f4952, 
-    0x49474542, 0x0d29284e, 0x2f0a0d0a, 0x2d2d2d2a, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x0a0d2d2d, 0x6f43203e, 0x6961746e, 0x7320736e, 0x63757274, 0x65727574, 0x6e612073, 0x75662064, 0x6974636e, 
-    0x20736e6f, 0x20726f66, 0x636f7270, 0x72756465, 0x73206c61, 0x6d20796b, 0x6c65646f, 0x0a0d2e73, 0x68540a0d, 
-    0x66207369, 0x20656c69, 0x6c636e69, 0x73656475, 0x6f777420, 0x796b7320, 0x646f6d20, 0x3a736c65, 0x73206120, 
-    0x6c706d69, 0x6b732065, 0x68742079, 0x69207461, 0x61662073, 0x74207473, 0x6f63206f, 0x7475706d, 0x61202c65, 
-    0x0a0d646e, 0x6f6d2061, 0x63206572, 0x6c706d6f, 0x22207865, 0x73796870, 0x6c616369, 0x796b7320, 0x6f6d2022, 
-    0x206c6564, 0x65736162, 0x6e6f2064, 0x6d206120, 0x6c65646f, 0x6f726620, 0x654d206d, 0x6c61746e, 0x79615220, 
-    0x646e6120, 0x74616c20, 0x0a0d7265, 0x65646f6d, 0x7a696e72, 0x69206465, 0x6874206e, 0x444d2065, 0x4453204c, 
-    0x7473204b, 0x69747261, 0x5b20676e, 0x65726568, 0x7468285d, 0x3a737074, 0x69672f2f, 0x62756874, 0x6d6f632e, 
-    0x49564e2f, 0x2f414944, 0x2d4c444d, 0x2f4b4453, 0x626f6c62, 0x3330322f, 0x34313564, 0x64316230, 0x39386565, 
-    0x37316564, 0x65363262, 0x63383238, 0x33333334, 0x38313735, 0x32363837, 0x72732f39, 0x68732f63, 0x72656461, 
-    0x646d2f73, 0x61622f6c, 0x622f6573, 0x2e657361, 0x236c646d, 0x3831314c, 0x0a0d2930, 0x74737563, 0x7a696d6f, 
-    0x66206465, 0x6e20726f, 0x6f727076, 0x6d61732d, 0x73656c70, 0x2d0a0d2e, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d2f2a, 0x69230a0d, 0x65642066, 0x656e6966, 0x4c472864, 0x726f635f, 
-    0x72705f65, 0x6c69666f, 0x20202965, 0x47202f2f, 0x0d4c534c, 0x6564230a, 0x656e6966, 0x6b536520, 0x74754f79, 
-    0x67616d49, 0x0d302065, 0x6c65230a, 0x0a0d6573, 0x6d756e65, 0x796b5320, 0x646e6942, 0x73676e69, 0x0d7b0a0d, 
-    0x6520200a, 0x4f796b53, 0x6d497475, 0x20656761, 0x2c30203d, 0x3b7d0a0d, 0x65230a0d, 0x6669646e, 0x0a0d0a0d, 
-    0x2d2d2a2f, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0d2d2d2d, 0x5320230a, 0x63757274, 
-    0x53602074, 0x6153796b, 0x696c706d, 0x6552676e, 0x746c7573, 0x3e0a0d60, 0x6e6f4320, 0x6e696174, 0x68742073, 
-    0x65722065, 0x746c7573, 0x20676e69, 0x65726964, 0x6f697463, 0x70202c6e, 0x61626f72, 0x696c6962, 0x64207974, 
-    0x69736e65, 0x66207974, 0x74636e75, 0x2c6e6f69, 0x646e6120, 0x64617220, 0x636e6169, 0x3e0a0d65, 0x6f726620, 
-    0x6173206d, 0x696c706d, 0x7420676e, 0x70206568, 0x65636f72, 0x61727564, 0x6b73206c, 0x0a0d2e79, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0d2f2a2d, 0x7274730a, 0x20746375, 0x53796b53, 
-    0x6c706d61, 0x52676e69, 0x6c757365, 0x7b0a0d74, 0x20200a0d, 0x616f6c66, 0x64203374, 0x63657269, 0x6e6f6974, 
-    0x2f20203b, 0x6944202f, 0x74636572, 0x206e6f69, 0x74206f74, 0x73206568, 0x6c706d61, 0x6c206465, 0x74686769, 
-    0x20200a0d, 0x616f6c66, 0x70202074, 0x203b6664, 0x20202020, 0x2f202020, 0x7250202f, 0x6261626f, 0x74696c69, 
-    0x65442079, 0x7469736e, 0x75462079, 0x6974636e, 0x76206e6f, 0x65756c61, 0x20200a0d, 0x616f6c66, 0x72203374, 
-    0x61696461, 0x3b65636e, 0x2f202020, 0x694c202f, 0x20746867, 0x65746e69, 0x7469736e, 0x7d0a0d79, 0x0d0a0d3b, 
-    0x2f0a0d0a, 0x2d2d2d2a, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d2d2d, 0x74532023, 
-    0x74637572, 0x6b536020, 0x6d695379, 0x50656c70, 0x6d617261, 0x72657465, 0x0a0d6073, 0x6150203e, 0x656d6172, 
-    0x73726574, 0x726f6620, 0x65687420, 0x6d697320, 0x20656c70, 0x20796b73, 0x65646f6d, 0x0a0d2e6c, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0d2f2a2d, 0x7274730a, 0x20746375, 0x53796b53, 
-    0x6c706d69, 0x72615065, 0x74656d61, 0x0d737265, 0x0a0d7b0a, 0x6c662020, 0x3374616f, 0x6e757320, 0x65726944, 
-    0x6f697463, 0x2020206e, 0x53202020, 0x474e414c, 0x4645445f, 0x544c5541, 0x6f6c6628, 0x28337461, 0x322e312d, 
-    0x33313433, 0x65343034, 0x4638302d, 0x2e30202c, 0x31373037, 0x32383630, 0x202c4639, 0x30372e30, 0x36303137, 
-    0x46393037, 0x0d3b2929, 0x6620200a, 0x74616f6c, 0x676e6120, 0x72616c75, 0x657a6953, 0x694c664f, 0x20746867, 
-    0x4e414c53, 0x45445f47, 0x4c554146, 0x2e302854, 0x46393530, 0x0a0d3b29, 0x20200a0d, 0x616f6c66, 0x73203374, 
-    0x6f436e75, 0x20726f6c, 0x4e414c53, 0x45445f47, 0x4c554146, 0x6c662854, 0x3374616f, 0x302e3128, 0x31202c46, 
-    0x2c46302e, 0x302e3120, 0x3b292946, 0x20200a0d, 0x616f6c66, 0x6c672074, 0x6953776f, 0x2020657a, 0x4e414c53, 
-    0x45445f47, 0x4c554146, 0x2e302854, 0x46313930, 0x0a0d3b29, 0x20200a0d, 0x616f6c66, 0x73203374, 0x6f43796b, 
-    0x20726f6c, 0x20202020, 0x4e414c53, 0x45445f47, 0x4c554146, 0x6c662854, 0x3374616f, 0x312e3028, 0x202c4637, 
-    0x37332e30, 0x30202c46, 0x4635362e, 0x0d3b2929, 0x6620200a, 0x74616f6c, 0x6f6c6720, 0x746e4977, 0x69736e65, 
-    0x53207974, 0x474e414c, 0x4645445f, 0x544c5541, 0x392e3028, 0x0d3b2946, 0x200a0d0a, 0x6f6c6620, 0x20337461, 
-    0x69726f68, 0x436e6f7a, 0x726f6c6f, 0x414c5320, 0x445f474e, 0x55414645, 0x6628544c, 0x74616f6c, 0x2e302833, 
-    0x2c463035, 0x372e3020, 0x202c4630, 0x32392e30, 0x3b292946, 0x20200a0d, 0x616f6c66, 0x6f682074, 0x6f7a6972, 
-    0x7a69536e, 0x20202065, 0x4e414c53, 0x45445f47, 0x4c554146, 0x2e302854, 0x3b294635, 0x0a0d0a0d, 0x6c662020, 
-    0x3374616f, 0x6f726720, 0x43646e75, 0x726f6c6f, 0x4c532020, 0x5f474e41, 0x41464544, 0x28544c55, 0x616f6c66, 
-    0x30283374, 0x4632362e, 0x2e30202c, 0x2c463935, 0x352e3020, 0x29294635, 0x200a0d3b, 0x6f6c6620, 0x67207461, 
-    0x53776f6c, 0x70726168, 0x7373656e, 0x414c5320, 0x445f474e, 0x55414645, 0x3428544c, 0x3b29462e, 0x0a0d0a0d, 
-    0x6c662020, 0x3374616f, 0x72696420, 0x69746365, 0x70556e6f, 0x414c5320, 0x445f474e, 0x55414645, 0x6628544c, 
-    0x74616f6c, 0x2e302833, 0x31202c46, 0x202c462e, 0x29462e30, 0x0a0d3b29, 0x6c662020, 0x2074616f, 0x496e7573, 
-    0x6e65746e, 0x79746973, 0x414c5320, 0x445f474e, 0x55414645, 0x3128544c, 0x2966302e, 0x0d0a0d3b, 0x6620200a, 
-    0x74616f6c, 0x696c2033, 0x52746867, 0x61696461, 0x2065636e, 0x4e414c53, 0x45445f47, 0x4c554146, 0x6c662854, 
-    0x3374616f, 0x302e3128, 0x31202c46, 0x2c46302e, 0x302e3120, 0x3b292946, 0x20200a0d, 0x616f6c66, 0x72622074, 
-    0x74686769, 0x7373656e, 0x20202020, 0x414c5320, 0x445f474e, 0x55414645, 0x3128544c, 0x2946302e, 0x7d0a0d3b, 
-    0x0d0a0d3b, 0x2f0a0d0a, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 
-    0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 
-    0x2f2f2f2f, 0x0d2f2f2f, 0x202f2f0a, 0x73796850, 0x6c616369, 0x796b5320, 0x2f2f0a0d, 0x2f2f2f2f, 0x2f2f2f2f, 
-    0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 
-    0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x2f2f2f2f, 0x0a0d2f2f, 0x2a2f0a0d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x230a0d2d, 0x72745320, 0x20746375, 0x796b5360, 
-    0x73796850, 0x6c616369, 0x61726150, 0x6574656d, 0x0d607372, 0x50203e0a, 0x6d617261, 0x72657465, 0x6f662073, 
-    0x68742072, 0x68702065, 0x63697379, 0x73206c61, 0x6d20796b, 0x6c65646f, 0x2d0a0d2e, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d2f2a, 0x75727473, 0x53207463, 0x6850796b, 0x63697379, 
-    0x61506c61, 0x656d6172, 0x73726574, 0x0d7b0a0d, 0x6620200a, 0x74616f6c, 0x67722033, 0x696e5562, 0x6e6f4374, 
-    0x73726576, 0x206e6f69, 0x4e414c53, 0x45445f47, 0x4c554146, 0x6c662854, 0x3374616f, 0x302e3128, 0x202f2066, 
-    0x30303038, 0x66302e30, 0x0d3b2929, 0x6620200a, 0x74616f6c, 0x6c756d20, 0x6c706974, 0x20726569, 0x20202020, 
-    0x20202020, 0x4e414c53, 0x45445f47, 0x4c554146, 0x2e302854, 0x3b296631, 0x0a0d0a0d, 0x6c662020, 0x2074616f, 
-    0x657a6168, 0x20202020, 0x20202020, 0x4c532020, 0x5f474e41, 0x41464544, 0x28544c55, 0x66312e30, 0x0a0d3b29, 
-    0x6c662020, 0x2074616f, 0x62646572, 0x7365756c, 0x74666968, 0x4c532020, 0x5f474e41, 0x41464544, 0x28544c55, 
-    0x66312e30, 0x0a0d3b29, 0x6c662020, 0x2074616f, 0x75746173, 0x69746172, 0x20206e6f, 0x4c532020, 0x5f474e41, 
-    0x41464544, 0x28544c55, 0x66302e31, 0x0a0d3b29, 0x6c662020, 0x2074616f, 0x69726f68, 0x486e6f7a, 0x68676965, 
-    0x4c532074, 0x5f474e41, 0x41464544, 0x28544c55, 0x66302e30, 0x0a0d3b29, 0x20200a0d, 0x616f6c66, 0x67203374, 
-    0x6e756f72, 0x6c6f4364, 0x5320726f, 0x474e414c, 0x4645445f, 0x544c5541, 0x6f6c6628, 0x28337461, 0x66342e30, 
-    0x0d3b2929, 0x6620200a, 0x74616f6c, 0x726f6820, 0x6e6f7a69, 0x72756c42, 0x4c532020, 0x5f474e41, 0x41464544, 
-    0x28544c55, 0x66332e30, 0x0a0d3b29, 0x20200a0d, 0x616f6c66, 0x6e203374, 0x74686769, 0x6f6c6f43, 0x20202072, 
-    0x53202020, 0x474e414c, 0x4645445f, 0x544c5541, 0x6f6c6628, 0x28337461, 0x66302e30, 0x2e30202c, 0x202c6630, 
-    0x31302e30, 0x3b292966, 0x20200a0d, 0x616f6c66, 0x75732074, 0x7369446e, 0x746e496b, 0x69736e65, 0x53207974, 
-    0x474e414c, 0x4645445f, 0x544c5541, 0x302e3128, 0x0d3b2966, 0x200a0d0a, 0x6f6c6620, 0x20337461, 0x446e7573, 
-    0x63657269, 0x6e6f6974, 0x414c5320, 0x445f474e, 0x55414645, 0x6628544c, 0x74616f6c, 0x312d2833, 0x3433322e, 
-    0x30343331, 0x302d6534, 0x202c4638, 0x30372e30, 0x36303137, 0x46393238, 0x2e30202c, 0x31373037, 0x30373630, 
-    0x29294639, 0x200a0d3b, 0x6f6c6620, 0x73207461, 0x69446e75, 0x63536b73, 0x20656c61, 0x414c5320, 0x445f474e, 
-    0x55414645, 0x3128544c, 0x2966302e, 0x0d0a0d3b, 0x6620200a, 0x74616f6c, 0x6e757320, 0x776f6c47, 0x65746e49, 
-    0x7469736e, 0x4c532079, 0x5f474e41, 0x41464544, 0x28544c55, 0x66302e31, 0x0a0d3b29, 0x6e692020, 0x49792074, 
-    0x20705573, 0x20202020, 0x20202020, 0x20202020, 0x414c5320, 0x445f474e, 0x55414645, 0x3128544c, 0x0a0d3b29, 
-    0x0a0d3b7d, 0x414e0a0d, 0x5053454d, 0x5f454341, 0x44414853, 0x4f495245, 0x444e455f, 0x0a0d2928, 0x65230a0d, 
-    0x6669646e, 0x2f2f2020, 0x594b5320, 0x4148535f, 0x49524544, 0x0d485f4f, 0x0000000a, 0x00100007, 0x00000028, 
-    0x575c3a46, 0x6f646e69, 0x445c7377, 0x746b7365, 0x6e5c706f, 0x6f727076, 0x726f635f, 0x6e5c3265, 0x61687376, 
-    0x73726564, 0x796b735c, 0x2e6f695f, 0x6c732e68, 0x00676e61, 0x054a0007, 0x00000029, 0x2a2f0a0d, 0x2a200a0d, 
-    0x706f4320, 0x67697279, 0x28207468, 0x32202963, 0x2d393130, 0x35323032, 0x564e202c, 0x41494449, 0x524f4320, 
-    0x41524f50, 0x4e4f4954, 0x4120202e, 0x72206c6c, 0x74686769, 0x65722073, 0x76726573, 0x0d2e6465, 0x0d2a200a, 
-    0x202a200a, 0x6563694c, 0x6465736e, 0x646e7520, 0x74207265, 0x41206568, 0x68636170, 0x694c2065, 0x736e6563, 
-    0x56202c65, 0x69737265, 0x32206e6f, 0x2820302e, 0x20656874, 0x63694c22, 0x65736e65, 0x0d3b2922, 0x202a200a, 
-    0x20756f79, 0x2079616d, 0x20746f6e, 0x20657375, 0x73696874, 0x6c696620, 0x78652065, 0x74706563, 0x206e6920, 
-    0x706d6f63, 0x6e61696c, 0x77206563, 0x20687469, 0x20656874, 0x6563694c, 0x2e65736e, 0x2a200a0d, 0x756f5920, 
-    0x79616d20, 0x74626f20, 0x206e6961, 0x6f632061, 0x6f207970, 0x68742066, 0x694c2065, 0x736e6563, 0x74612065, 
-    0x2a200a0d, 0x2a200a0d, 0x20202020, 0x74746820, 0x2f2f3a70, 0x2e777777, 0x63617061, 0x6f2e6568, 0x6c2f6772, 
-    0x6e656369, 0x2f736573, 0x4543494c, 0x2d45534e, 0x0d302e32, 0x0d2a200a, 0x202a200a, 0x656c6e55, 0x72207373, 
-    0x69757165, 0x20646572, 0x61207962, 0x696c7070, 0x6c626163, 0x616c2065, 0x726f2077, 0x72676120, 0x20646565, 
-    0x69206f74, 0x7277206e, 0x6e697469, 0x73202c67, 0x7774666f, 0x0d657261, 0x202a200a, 0x74736964, 0x75626972, 
-    0x20646574, 0x65646e75, 0x68742072, 0x694c2065, 0x736e6563, 0x73692065, 0x73696420, 0x62697274, 0x64657475, 
-    0x206e6f20, 0x22206e61, 0x49205341, 0x42202253, 0x53495341, 0x200a0d2c, 0x4957202a, 0x554f4854, 0x41572054, 
-    0x4e415252, 0x53454954, 0x20524f20, 0x444e4f43, 0x4f495449, 0x4f20534e, 0x4e412046, 0x494b2059, 0x202c444e, 
-    0x68746965, 0x65207265, 0x65727078, 0x6f207373, 0x6d692072, 0x65696c70, 0x0a0d2e64, 0x53202a20, 0x74206565, 
-    0x4c206568, 0x6e656369, 0x66206573, 0x7420726f, 0x73206568, 0x69636570, 0x20636966, 0x676e616c, 0x65676175, 
-    0x766f6720, 0x696e7265, 0x7020676e, 0x696d7265, 0x6f697373, 0x6120736e, 0x0a0d646e, 0x6c202a20, 0x74696d69, 
-    0x6f697461, 0x7520736e, 0x7265646e, 0x65687420, 0x63694c20, 0x65736e65, 0x200a0d2e, 0x200a0d2a, 0x5053202a, 
-    0x462d5844, 0x43656c69, 0x7279706f, 0x74686769, 0x74786554, 0x6f43203a, 0x69727970, 0x20746867, 0x20296328, 
-    0x39313032, 0x3230322d, 0x4e202c35, 0x49444956, 0x4f432041, 0x524f5052, 0x4f495441, 0x0a0d2e4e, 0x53202a20, 
-    0x2d584450, 0x6563694c, 0x2d65736e, 0x6e656449, 0x69666974, 0x203a7265, 0x63617041, 0x322d6568, 0x0a0d302e, 
-    0x0d2f2a20, 0x0d0a0d0a, 0x6669230a, 0x6665646e, 0x5f4f4920, 0x46544c47, 0x0a0d485f, 0x66656423, 0x20656e69, 
-    0x475f4f49, 0x5f46544c, 0x0d0a0d48, 0x6669230a, 0x20666564, 0x70635f5f, 0x7073756c, 0x0d73756c, 0x6564230a, 
-    0x656e6966, 0x45484320, 0x535f4b43, 0x43555254, 0x4c415f54, 0x4d4e4749, 0x28544e45, 0x2029735f, 0x74617473, 
-    0x615f6369, 0x72657373, 0x69732874, 0x666f657a, 0x29735f28, 0x38202520, 0x203d3d20, 0x0d3b2930, 0x6c65230a, 
-    0x64206669, 0x6e696665, 0x5f286465, 0x414c535f, 0x5f5f474e, 0x230a0d29, 0x69666564, 0x4320656e, 0x4b434548, 
-    0x5254535f, 0x5f544355, 0x47494c41, 0x4e454d4e, 0x735f2854, 0x230a0d29, 0x65736c65, 0x64230a0d, 0x6e696665, 
-    0x48432065, 0x5f4b4345, 0x55525453, 0x415f5443, 0x4e47494c, 0x544e454d, 0x29735f28, 0x0a0d0a0d, 0x54202f2f, 
-    0x20736968, 0x61207369, 0x69747520, 0x7974696c, 0x206f7420, 0x69666564, 0x6120656e, 0x66756220, 0x20726566, 
-    0x65666572, 0x636e6572, 0x6e692065, 0x534c4720, 0x0a0d2e4c, 0x55202f2f, 0x65676173, 0x6564203a, 0x72616c63, 
-    0x68742065, 0x75622065, 0x72656666, 0x66657220, 0x6e657265, 0x74206563, 0x20657079, 0x68746977, 0x5542203a, 
-    0x52454646, 0x4645525f, 0x4345445f, 0x7974284c, 0x2c296570, 0x65687720, 0x74206572, 0x20657079, 0x74207369, 
-    0x74206568, 0x20657079, 0x7420666f, 0x62206568, 0x65666675, 0x76282072, 0x2c336365, 0x6f6c6620, 0x202c7461, 
-    0x6574614d, 0x6c616972, 0x0a0d2e29, 0x54202f2f, 0x206e6568, 0x20657375, 0x20656874, 0x66667562, 0x72207265, 
-    0x72656665, 0x65636e65, 0x206e6920, 0x20656874, 0x64616873, 0x77207265, 0x3a687469, 0x46554220, 0x5f524546, 
-    0x28464552, 0x65707974, 0x6461202c, 0x73657264, 0x202c2973, 0x72656877, 0x64612065, 0x73657264, 0x73692073, 
-    0x65687420, 0x64646120, 0x73736572, 0x20666f20, 0x20656874, 0x66667562, 0x69207265, 0x6874206e, 0x68732065, 
-    0x72656461, 0x230a0d2e, 0x69666564, 0x4220656e, 0x45464655, 0x45525f52, 0x45445f46, 0x5f284c43, 0x65707974, 
-    0x20202029, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x0d5c2020, 0x6c20200a, 0x756f7961, 0x75622874, 0x72656666, 
-    0x6665725f, 0x6e657265, 0x202c6563, 0x6c616373, 0x20297261, 0x66667562, 0x5f207265, 0x65707974, 0x75422323, 
-    0x72656666, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x200a0d5c, 
-    0x20207b20, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x0d5c2020, 0x2020200a, 0x79745f20, 0x6f206570, 0x203b5d5b, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x200a0d5c, 0x0d3b7d20, 0x230a0d0a, 
-    0x69666564, 0x4220656e, 0x45464655, 0x45525f52, 0x745f2846, 0x2c657079, 0x64615f20, 0x20297264, 0x7079745f, 
-    0x42232365, 0x65666675, 0x615f2872, 0x29726464, 0x0a0d6f2e, 0x65230a0d, 0x6669646e, 0x0a0d0a0d, 0x636e6923, 
-    0x6564756c, 0x766e2220, 0x64616873, 0x2f737265, 0x5f796b73, 0x682e6f69, 0x616c732e, 0x0d22676e, 0x4e0a0d0a, 
-    0x53454d41, 0x45434150, 0x4148535f, 0x49524544, 0x45425f4f, 0x284e4947, 0x2f0a0d29, 0x4c47202f, 0x0a0d4654, 
-    0x75727473, 0x42207463, 0x65666675, 0x65695672, 0x7b0a0d77, 0x20200a0d, 0x746e6975, 0x745f3233, 0x66666f20, 
-    0x3b746573, 0x20202020, 0x2f2f2020, 0x66664f20, 0x20746573, 0x74206e69, 0x62206568, 0x65666675, 0x68772072, 
-    0x20657265, 0x20656874, 0x61746164, 0x61747320, 0x20737472, 0x206e6928, 0x65747962, 0x0a0d2973, 0x69752020, 
-    0x3233746e, 0x6320745f, 0x746e756f, 0x2020203b, 0x20202020, 0x4e202f2f, 0x65626d75, 0x666f2072, 0x656c6520, 
-    0x746e656d, 0x6e692073, 0x65687420, 0x66756220, 0x20726566, 0x77656976, 0x20200a0d, 0x746e6975, 0x745f3233, 
-    0x74796220, 0x72745365, 0x3b656469, 0x2f2f2020, 0x72745320, 0x20656469, 0x62206e69, 0x73657479, 0x74656220, 
-    0x6e656577, 0x6e6f6320, 0x75636573, 0x65766974, 0x656c6520, 0x746e656d, 0x30282073, 0x20666920, 0x68676974, 
-    0x20796c74, 0x6b636170, 0x0d296465, 0x0d3b7d0a, 0x730a0d0a, 0x63757274, 0x72542074, 0x676e6169, 0x654d656c, 
-    0x0a0d6873, 0x200a0d7b, 0x66754220, 0x56726566, 0x20776569, 0x69646e69, 0x3b736563, 0x20202020, 0x49202f2f, 
-    0x7865646e, 0x66756220, 0x20726566, 0x77656976, 0x20200a0d, 0x66667542, 0x69567265, 0x70207765, 0x7469736f, 
-    0x736e6f69, 0x2f20203b, 0x6f50202f, 0x69746973, 0x62206e6f, 0x65666675, 0x69762072, 0x28207765, 0x33636576, 
-    0x200a0d29, 0x66754220, 0x56726566, 0x20776569, 0x6d726f6e, 0x3b736c61, 0x20202020, 0x4e202f2f, 0x616d726f, 
-    0x7562206c, 0x72656666, 0x65697620, 0x76282077, 0x29336365, 0x20200a0d, 0x66667542, 0x69567265, 0x63207765, 
-    0x726f6c6f, 0x74726556, 0x2f20203b, 0x6f63202f, 0x20726f6c, 0x76207461, 0x69747265, 0x20736563, 0x63657628, 
-    0x6f202c34, 0x6f697470, 0x296c616e, 0x20200a0d, 0x66667542, 0x69567265, 0x74207765, 0x6f437865, 0x7364726f, 
-    0x2f20203b, 0x6574202f, 0x72757478, 0x6f632065, 0x6964726f, 0x6574616e, 0x75622073, 0x72656666, 0x65697620, 
-    0x76282077, 0x2c326365, 0x74706f20, 0x616e6f69, 0x0a0d296c, 0x75422020, 0x72656666, 0x77656956, 0x6e617420, 
-    0x746e6567, 0x20203b73, 0x202f2f20, 0x676e6174, 0x73746e65, 0x66756220, 0x20726566, 0x77656976, 0x65762820, 
-    0x202c3463, 0x6974706f, 0x6c616e6f, 0x7d0a0d29, 0x0d0a0d3b, 0x7274730a, 0x20746375, 0x66746c47, 0x6174654d, 
-    0x63696c6c, 0x67756f52, 0x73656e68, 0x7b0a0d73, 0x20200a0d, 0x616f6c66, 0x62203474, 0x43657361, 0x726f6c6f, 
-    0x74636146, 0x203b726f, 0x20202020, 0x2f202020, 0x6142202f, 0x63206573, 0x726f6c6f, 0x63616620, 0x20726f74, 
-    0x42475228, 0x0a0d2941, 0x6c662020, 0x2074616f, 0x74656d20, 0x696c6c61, 0x63614663, 0x3b726f74, 0x20202020, 
-    0x20202020, 0x202f2f20, 0x6174654d, 0x63696c6c, 0x63616620, 0x20726f74, 0x302e3028, 0x6e203d20, 0x6d2d6e6f, 
-    0x6c617465, 0x2c63696c, 0x302e3120, 0x6d203d20, 0x6c617465, 0x2963696c, 0x20200a0d, 0x616f6c66, 0x72202074, 
-    0x6867756f, 0x7373656e, 0x74636146, 0x203b726f, 0x20202020, 0x2f202020, 0x6f52202f, 0x6e686775, 0x20737365, 
-    0x74636166, 0x2820726f, 0x20302e30, 0x6d73203d, 0x68746f6f, 0x2e31202c, 0x203d2030, 0x67756f72, 0x0a0d2968, 
-    0x6e692020, 0x20202074, 0x73616220, 0x6c6f4365, 0x6554726f, 0x72757478, 0x646e4965, 0x203b7865, 0x202f2f20, 
-    0x65646e49, 0x666f2078, 0x65687420, 0x73616220, 0x6f632065, 0x20726f6c, 0x74786574, 0x20657275, 0x74206e69, 
-    0x47206568, 0x2046544c, 0x656c6966, 0x706f2820, 0x6e6f6974, 0x0d296c61, 0x0d3b7d0a, 0x730a0d0a, 0x63757274, 
-    0x6c472074, 0x654d6674, 0x0a0d6873, 0x200a0d7b, 0x6e697520, 0x745f3874, 0x2020202a, 0x6c672020, 0x75426674, 
-    0x72656666, 0x6e203d20, 0x706c6c75, 0x203b7274, 0x202f2f20, 0x66667542, 0x74207265, 0x6874206f, 0x61642065, 
-    0x28206174, 0x65646e69, 0x70202c78, 0x7469736f, 0x2c6e6f69, 0x726f6e20, 0x2c6c616d, 0x2e2e2e20, 0x200a0d29, 
-    0x69725420, 0x6c676e61, 0x73654d65, 0x72742068, 0x73654d69, 0x20203b68, 0x20202020, 0x20202020, 0x20202020, 
-    0x202f2f20, 0x6873654d, 0x74616420, 0x200a0d61, 0x746e6920, 0x20202020, 0x20202020, 0x6e692020, 0x54786564, 
-    0x3b657079, 0x20202020, 0x20202020, 0x20202020, 0x202f2f20, 0x65646e49, 0x79742078, 0x28206570, 0x746e6975, 
-    0x745f3631, 0x20726f20, 0x746e6975, 0x745f3233, 0x7d0a0d29, 0x0d0a0d3b, 0x756e650a, 0x6c47206d, 0x694c6674, 
-    0x54746867, 0x0d657079, 0x0a0d7b0a, 0x50652020, 0x746e696f, 0x20202020, 0x3d202020, 0x202c3020, 0x202f2f20, 
-    0x6e696f50, 0x696c2074, 0x20746867, 0x65707974, 0x20200a0d, 0x6f705365, 0x20202074, 0x20202020, 0x31203d20, 
-    0x2f20202c, 0x7053202f, 0x6c20746f, 0x74686769, 0x70797420, 0x200a0d65, 0x69446520, 0x74636572, 0x616e6f69, 
-    0x203d206c, 0x20202032, 0x44202f2f, 0x63657269, 0x6e6f6974, 0x6c206c61, 0x74686769, 0x70797420, 0x7d0a0d65, 
-    0x0d0a0d3b, 0x7274730a, 0x20746375, 0x66746c47, 0x636e7550, 0x6c617574, 0x0d7b0a0d, 0x6620200a, 0x74616f6c, 
-    0x6f702033, 0x69746973, 0x203b6e6f, 0x2f2f2020, 0x736f5020, 0x6f697469, 0x666f206e, 0x65687420, 0x6e757020, 
-    0x61757463, 0x696c206c, 0x20746867, 0x77206e69, 0x646c726f, 0x61707320, 0x0a0d6563, 0x6c662020, 0x2074616f, 
-    0x746e6920, 0x69736e65, 0x203b7974, 0x202f2f20, 0x65746e49, 0x7469736e, 0x666f2079, 0x65687420, 0x67696c20, 
-    0x0a0d7468, 0x6c662020, 0x3374616f, 0x72696420, 0x69746365, 0x203b6e6f, 0x202f2f20, 0x65726944, 0x6f697463, 
-    0x666f206e, 0x65687420, 0x67696c20, 0x28207468, 0x20726f66, 0x746f7073, 0x646e6120, 0x72696420, 0x69746365, 
-    0x6c616e6f, 0x67696c20, 0x29737468, 0x20200a0d, 0x20746e69, 0x74202020, 0x3b657079, 0x20202020, 0x2f202020, 
-    0x7954202f, 0x6f206570, 0x68742066, 0x696c2065, 0x20746867, 0x3d203028, 0x696f7020, 0x202c746e, 0x203d2031, 
-    0x746f7073, 0x2032202c, 0x6964203d, 0x74636572, 0x616e6f69, 0x0a0d296c, 0x6c662020, 0x3374616f, 0x6c6f6320, 
-    0x203b726f, 0x20202020, 0x202f2f20, 0x6f6c6f43, 0x666f2072, 0x65687420, 0x67696c20, 0x28207468, 0x29424752, 
-    0x20200a0d, 0x616f6c66, 0x63202074, 0x41656e6f, 0x656c676e, 0x2f20203b, 0x6f43202f, 0x6120656e, 0x656c676e, 
-    0x726f6620, 0x6f707320, 0x696c2074, 0x73746867, 0x6e692820, 0x64617220, 0x736e6169, 0x2030202c, 0x20726f66, 
-    0x6e696f70, 0x6e612074, 0x69642064, 0x74636572, 0x616e6f69, 0x696c206c, 0x73746867, 0x7d0a0d29, 0x0d0a0d3b, 
-    0x730a0d0a, 0x63757274, 0x6c472074, 0x6e496674, 0x6e617473, 0x0a0d6563, 0x200a0d7b, 0x6f6c6620, 0x78347461, 
-    0x72742034, 0x66736e61, 0x3b6d726f, 0x20202020, 0x2f2f2020, 0x61725420, 0x6f66736e, 0x6d206d72, 0x69727461, 
-    0x6f662078, 0x68742072, 0x6e692065, 0x6e617473, 0x28206563, 0x61636f6c, 0x6f74206c, 0x726f7720, 0x0d29646c, 
-    0x7520200a, 0x33746e69, 0x20745f32, 0x6574616d, 0x6c616972, 0x65646e49, 0x20203b78, 0x4d202f2f, 0x72657461, 
-    0x206c6169, 0x706f7270, 0x69747265, 0x66207365, 0x7420726f, 0x69206568, 0x6174736e, 0x0d65636e, 0x7520200a, 
-    0x33746e69, 0x20745f32, 0x6873656d, 0x65646e49, 0x20203b78, 0x20202020, 0x49202f2f, 0x7865646e, 0x20666f20, 
-    0x20656874, 0x6873656d, 0x206e6920, 0x20656874, 0x66746c47, 0x6873654d, 0x63657620, 0x0d726f74, 0x0d3b7d0a, 
-    0x4548430a, 0x535f4b43, 0x43555254, 0x4c415f54, 0x4d4e4749, 0x28544e45, 0x66746c47, 0x74736e49, 0x65636e61, 
-    0x0d0a0d29, 0x7274730a, 0x20746375, 0x66746c47, 0x6e656353, 0x666e4965, 0x7b0a0d6f, 0x20200a0d, 0x616f6c66, 
-    0x34783474, 0x20202020, 0x20202020, 0x20202020, 0x76202020, 0x50776569, 0x4d6a6f72, 0x69727461, 0x20203b78, 
-    0x2f202020, 0x6956202f, 0x70207765, 0x656a6f72, 0x6f697463, 0x616d206e, 0x78697274, 0x726f6620, 0x65687420, 
-    0x65637320, 0x0a0d656e, 0x6c662020, 0x3474616f, 0x20203478, 0x20202020, 0x20202020, 0x20202020, 0x6f727020, 
-    0x766e496a, 0x7274614d, 0x203b7869, 0x20202020, 0x202f2f20, 0x65766e49, 0x20657372, 0x6a6f7270, 0x69746365, 
-    0x6d206e6f, 0x69727461, 0x6f662078, 0x68742072, 0x63732065, 0x0d656e65, 0x6620200a, 0x74616f6c, 0x20347834, 
-    0x20202020, 0x20202020, 0x20202020, 0x69762020, 0x6e497765, 0x74614d76, 0x3b786972, 0x20202020, 0x2f2f2020, 
-    0x766e4920, 0x65737265, 0x65697620, 0x616d2077, 0x78697274, 0x726f6620, 0x65687420, 0x65637320, 0x0a0d656e, 
-    0x6c662020, 0x3374616f, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x6d616320, 0x50617265, 0x7469736f, 
-    0x3b6e6f69, 0x20202020, 0x202f2f20, 0x656d6143, 0x70206172, 0x7469736f, 0x206e6f69, 0x77206e69, 0x646c726f, 
-    0x61707320, 0x0a0d6563, 0x6e692020, 0x20202074, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x65737520, 
-    0x3b796b53, 0x20202020, 0x20202020, 0x20202020, 0x202f2f20, 0x74656857, 0x20726568, 0x75206f74, 0x74206573, 
-    0x73206568, 0x7220796b, 0x65646e65, 0x676e6972, 0x20200a0d, 0x616f6c66, 0x20203374, 0x20202020, 0x20202020, 
-    0x20202020, 0x62202020, 0x676b6361, 0x6e756f72, 0x6c6f4364, 0x203b726f, 0x2f202020, 0x6142202f, 0x72676b63, 
-    0x646e756f, 0x6c6f6320, 0x6f20726f, 0x68742066, 0x63732065, 0x20656e65, 0x65737528, 0x68772064, 0x6e206e65, 
-    0x7520746f, 0x676e6973, 0x796b7320, 0x200a0d29, 0x746e6920, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 
-    0x20202020, 0x4c6d756e, 0x74686769, 0x20203b73, 0x20202020, 0x20202020, 0x4e202f2f, 0x65626d75, 0x666f2072, 
-    0x6e757020, 0x61757463, 0x696c206c, 0x73746867, 0x206e6920, 0x20656874, 0x6e656373, 0x75282065, 0x6f742070, 
-    0x0d293220, 0x4720200a, 0x4966746c, 0x6174736e, 0x2a65636e, 0x20202020, 0x20202020, 0x6e692020, 0x6e617473, 
-    0x3b736563, 0x20202020, 0x20202020, 0x2f2f2020, 0x64644120, 0x73736572, 0x20666f20, 0x20656874, 0x74736e69, 
-    0x65636e61, 0x66756220, 0x20726566, 0x746e6f63, 0x696e6961, 0x4720676e, 0x4966746c, 0x6174736e, 0x2065636e, 
-    0x61746164, 0x20200a0d, 0x66746c47, 0x6873654d, 0x2020202a, 0x20202020, 0x20202020, 0x6d202020, 0x65687365, 
-    0x20203b73, 0x20202020, 0x20202020, 0x2f202020, 0x6441202f, 0x73657264, 0x666f2073, 0x65687420, 0x73656d20, 
-    0x75622068, 0x72656666, 0x6e6f6320, 0x6e696174, 0x20676e69, 0x66746c47, 0x6873654d, 0x74616420, 0x200a0d61, 
-    0x746c4720, 0x74654d66, 0x696c6c61, 0x756f5263, 0x656e6867, 0x202a7373, 0x6574616d, 0x6c616972, 0x20203b73, 
-    0x20202020, 0x20202020, 0x4d202f2f, 0x72657461, 0x206c6169, 0x706f7270, 0x69747265, 0x66207365, 0x7420726f, 
-    0x69206568, 0x6174736e, 0x0d65636e, 0x4720200a, 0x5066746c, 0x74636e75, 0x206c6175, 0x20202020, 0x20202020, 
-    0x75702020, 0x7574636e, 0x694c6c61, 0x73746867, 0x3b5d325b, 0x2f2f2020, 0x72724120, 0x6f207961, 0x75702066, 
-    0x7574636e, 0x6c206c61, 0x74686769, 0x6e692073, 0x65687420, 0x65637320, 0x2820656e, 0x74207075, 0x2932206f, 
-    0x20200a0d, 0x53796b53, 0x6c706d69, 0x72615065, 0x74656d61, 0x20737265, 0x73202020, 0x6953796b, 0x656c706d, 
-    0x61726150, 0x20203b6d, 0x2f202020, 0x6150202f, 0x656d6172, 0x73726574, 0x726f6620, 0x65687420, 0x796b7320, 
-    0x6e657220, 0x69726564, 0x0a0d676e, 0x0a0d3b7d, 0x43454843, 0x54535f4b, 0x54435552, 0x494c415f, 0x454d4e47, 
-    0x4728544e, 0x5366746c, 0x656e6563, 0x6f666e49, 0x0d0a0d29, 0x4d414e0a, 0x41505345, 0x535f4543, 0x45444148, 
-    0x5f4f4952, 0x28444e45, 0x230a0d29, 0x69646e65, 0x2f202066, 0x4f49202f, 0x544c475f, 0x0d485f46, 0x0000000a, 
-    0x00120007, 0x0000002b, 0x575c3a46, 0x6f646e69, 0x445c7377, 0x746b7365, 0x765c706f, 0x61725f6b, 0x61727479, 
-    0x676e6963, 0x7475745f, 0x6169726f, 0x484b5f6c, 0x6f635c52, 0x6e6f6d6d, 0x5f6f695c, 0x66746c67, 0x0000682e, 
-    0x0f1f0007, 0x0000002c, 0x0a0d2a2f, 0x43202a20, 0x7279706f, 0x74686769, 0x29632820, 0x32303220, 0x30322d33, 
-    0x202c3532, 0x4449564e, 0x43204149, 0x4f50524f, 0x49544152, 0x202e4e4f, 0x6c6c4120, 0x67697220, 0x20737468, 
-    0x65736572, 0x64657672, 0x200a0d2e, 0x200a0d2a, 0x694c202a, 0x736e6563, 0x75206465, 0x7265646e, 0x65687420, 
-    0x61704120, 0x20656863, 0x6563694c, 0x2c65736e, 0x72655620, 0x6e6f6973, 0x302e3220, 0x68742820, 0x4c222065, 
-    0x6e656369, 0x29226573, 0x200a0d3b, 0x6f79202a, 0x616d2075, 0x6f6e2079, 0x73752074, 0x68742065, 0x66207369, 
-    0x20656c69, 0x65637865, 0x69207470, 0x6f63206e, 0x696c706d, 0x65636e61, 0x74697720, 0x68742068, 0x694c2065, 
-    0x736e6563, 0x0a0d2e65, 0x59202a20, 0x6d20756f, 0x6f207961, 0x69617462, 0x2061206e, 0x79706f63, 0x20666f20, 
-    0x20656874, 0x6563694c, 0x2065736e, 0x0a0d7461, 0x0a0d2a20, 0x20202a20, 0x68202020, 0x3a707474, 0x77772f2f, 
-    0x70612e77, 0x65686361, 0x67726f2e, 0x63696c2f, 0x65736e65, 0x494c2f73, 0x534e4543, 0x2e322d45, 0x200a0d30, 
-    0x200a0d2a, 0x6e55202a, 0x7373656c, 0x71657220, 0x65726975, 0x79622064, 0x70706120, 0x6163696c, 0x20656c62, 
-    0x2077616c, 0x6120726f, 0x65657267, 0x6f742064, 0x206e6920, 0x74697277, 0x2c676e69, 0x666f7320, 0x72617774, 
-    0x200a0d65, 0x6964202a, 0x69727473, 0x65747562, 0x6e752064, 0x20726564, 0x20656874, 0x6563694c, 0x2065736e, 
-    0x64207369, 0x72747369, 0x74756269, 0x6f206465, 0x6e61206e, 0x53412220, 0x22534920, 0x53414220, 0x0d2c5349, 
-    0x202a200a, 0x48544957, 0x2054554f, 0x52524157, 0x49544e41, 0x4f205345, 0x4f432052, 0x5449444e, 0x534e4f49, 
-    0x20464f20, 0x20594e41, 0x444e494b, 0x6965202c, 0x72656874, 0x70786520, 0x73736572, 0x20726f20, 0x6c706d69, 
-    0x2e646569, 0x2a200a0d, 0x65655320, 0x65687420, 0x63694c20, 0x65736e65, 0x726f6620, 0x65687420, 0x65707320, 
-    0x69666963, 0x616c2063, 0x6175676e, 0x67206567, 0x7265766f, 0x676e696e, 0x72657020, 0x7373696d, 0x736e6f69, 
-    0x646e6120, 0x2a200a0d, 0x6d696c20, 0x74617469, 0x736e6f69, 0x646e7520, 0x74207265, 0x4c206568, 0x6e656369, 
-    0x0d2e6573, 0x0d2a200a, 0x202a200a, 0x58445053, 0x6c69462d, 0x706f4365, 0x67697279, 0x65547468, 0x203a7478, 
-    0x79706f43, 0x68676972, 0x63282074, 0x30322029, 0x322d3332, 0x2c353230, 0x49564e20, 0x20414944, 0x50524f43, 
-    0x5441524f, 0x2e4e4f49, 0x2a200a0d, 0x44505320, 0x694c2d58, 0x736e6563, 0x64492d65, 0x69746e65, 0x72656966, 
-    0x7041203a, 0x65686361, 0x302e322d, 0x2a200a0d, 0x0d0a0d2f, 0x6e69230a, 0x64756c63, 0x73222065, 0x65646168, 
-    0x2e6f6972, 0x0a0d2268, 0x69230a0d, 0x756c636e, 0x22206564, 0x6873766e, 0x72656461, 0x6f632f73, 0x6174736e, 
-    0x2e73746e, 0x6c732e68, 0x22676e61, 0x0a0d0a0d, 0x636e6923, 0x6564756c, 0x6f632220, 0x6e6f6d6d, 0x6168732f, 
-    0x73726564, 0x7262702f, 0x732e682e, 0x676e616c, 0x230a0d22, 0x6c636e69, 0x20656475, 0x73766e22, 0x65646168, 
-    0x732f7372, 0x665f796b, 0x74636e75, 0x736e6f69, 0x732e682e, 0x676e616c, 0x0d0a0d22, 0x6564230a, 0x656e6966, 
-    0x53494d20, 0x45445f53, 0x20485450, 0x30303031, 0x0a0d0a0d, 0x2f2f0a0d, 0x616c6320, 0x662d676e, 0x616d726f, 
-    0x666f2074, 0x2f0a0d66, 0x7550202f, 0x63206873, 0x74736e6f, 0x73746e61, 0x6e6f6320, 0x6e696174, 0x20676e69, 
-    0x6e656373, 0x6e692065, 0x6d726f66, 0x6f697461, 0x63202c6e, 0x72656d61, 0x61642061, 0x202c6174, 0x20646e61, 
-    0x6574616d, 0x6c616972, 0x65766f20, 0x64697272, 0x0a0d7365, 0x6b765b5b, 0x75703a3a, 0x635f6873, 0x74736e6f, 
-    0x5d746e61, 0x2020205d, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x736e6f43, 
-    0x746e6174, 0x66667542, 0x543c7265, 0x506f7475, 0x43687375, 0x74736e6f, 0x3e746e61, 0x73757020, 0x6e6f4368, 
-    0x0d3b7473, 0x202f2f0a, 0x74786554, 0x20657275, 0x61727261, 0x6f662079, 0x616d2072, 0x69726574, 0x74206c61, 
-    0x75747865, 0x20736572, 0x626c6128, 0x2c6f6465, 0x726f6e20, 0x206c616d, 0x7370616d, 0x7465202c, 0x0d292e63, 
-    0x765b5b0a, 0x623a3a6b, 0x69646e69, 0x4228676e, 0x69646e69, 0x6f50676e, 0x73746e69, 0x54653a3a, 0x75747865, 
-    0x2c736572, 0x5d293020, 0x2020205d, 0x6d615320, 0x72656c70, 0x74204432, 0x75747865, 0x5b736572, 0x0a0d3b5d, 
-    0x54202f2f, 0x6c2d706f, 0x6c657665, 0x63636120, 0x72656c65, 0x6f697461, 0x7473206e, 0x74637572, 0x20657275, 
-    0x746e6f63, 0x696e6961, 0x7420676e, 0x73206568, 0x656e6563, 0x6f656720, 0x7274656d, 0x69682079, 0x72617265, 
-    0x0d796863, 0x765b5b0a, 0x623a3a6b, 0x69646e69, 0x4228676e, 0x69646e69, 0x6f50676e, 0x73746e69, 0x54653a3a, 
-    0x2c73616c, 0x5d293120, 0x2020205d, 0x20202020, 0x79615220, 0x63617274, 0x41676e69, 0x6c656363, 0x74617265, 
-    0x536e6f69, 0x63757274, 0x65727574, 0x706f7420, 0x6576654c, 0x3b53416c, 0x2f2f0a0d, 0x74754f20, 0x20747570, 
-    0x67616d69, 0x68772065, 0x20657265, 0x20656874, 0x616e6966, 0x6572206c, 0x7265646e, 0x72206465, 0x6c757365, 
-    0x69772074, 0x62206c6c, 0x74732065, 0x6465726f, 0x5b5b0a0d, 0x3a3a6b76, 0x646e6962, 0x28676e69, 0x646e6942, 
-    0x50676e69, 0x746e696f, 0x653a3a73, 0x4974754f, 0x6567616d, 0x2931202c, 0x20205d5d, 0x57522020, 0x74786554, 
-    0x32657275, 0x6c663c44, 0x3474616f, 0x756f203e, 0x616d4974, 0x0d3b6567, 0x202f2f0a, 0x6e616c63, 0x6f662d67, 
-    0x74616d72, 0x0d6e6f20, 0x2f0a0d0a, 0x6152202f, 0x61702079, 0x616f6c79, 0x74732064, 0x74637572, 0x20657275, 
-    0x6163202d, 0x65697272, 0x61642073, 0x74206174, 0x756f7268, 0x74206867, 0x72206568, 0x74207961, 0x69636172, 
-    0x7020676e, 0x6c657069, 0x0d656e69, 0x7274730a, 0x20746375, 0x50746948, 0x6f6c7961, 0x0a0d6461, 0x200a0d7b, 
-    0x6f6c6620, 0x20337461, 0x6f6c6f63, 0x20203b72, 0x202f2f20, 0x75636341, 0x616c756d, 0x20646574, 0x6f6c6f63, 
-    0x6c612072, 0x20676e6f, 0x20656874, 0x20796172, 0x68746170, 0x20200a0d, 0x616f6c66, 0x77202074, 0x68676965, 
-    0x20203b74, 0x57202f2f, 0x68676965, 0x6d692f74, 0x74726f70, 0x65636e61, 0x20666f20, 0x73696874, 0x79617220, 
-    0x6f662820, 0x6d692072, 0x74726f70, 0x65636e61, 0x6d617320, 0x6e696c70, 0x0a0d2967, 0x6e692020, 0x20202074, 
-    0x70656420, 0x203b6874, 0x2f2f2020, 0x72754320, 0x746e6572, 0x63657220, 0x69737275, 0x64206e6f, 0x68747065, 
-    0x6f662820, 0x696c2072, 0x6974696d, 0x6220676e, 0x636e756f, 0x0d297365, 0x0d3b7d0a, 0x2f0a0d0a, 0x6547202f, 
-    0x6972656e, 0x75662063, 0x6974636e, 0x74206e6f, 0x6572206f, 0x65697274, 0x76206576, 0x65747265, 0x74612078, 
-    0x62697274, 0x73657475, 0x6f726620, 0x4c47206d, 0x62204654, 0x65666675, 0x61642072, 0x0a0d6174, 0x54202f2f, 
-    0x7954203a, 0x6f206570, 0x74612066, 0x62697274, 0x20657475, 0x6f6c6628, 0x202c7461, 0x616f6c66, 0x202c3274, 
-    0x616f6c66, 0x202c3374, 0x2e637465, 0x2f0a0d29, 0x6164202f, 0x75426174, 0x72656666, 0x72646441, 0x3a737365, 
-    0x73614220, 0x64612065, 0x73657264, 0x666f2073, 0x65687420, 0x544c4720, 0x75622046, 0x72656666, 0x2f2f0a0d, 
-    0x66756220, 0x56726566, 0x3a776569, 0x66754220, 0x20726566, 0x77656976, 0x6e6f6320, 0x6e696174, 0x20676e69, 
-    0x7366666f, 0x202c7465, 0x69727473, 0x202c6564, 0x20646e61, 0x6e756f63, 0x6e692074, 0x6d726f66, 0x6f697461, 
-    0x2f0a0d6e, 0x7461202f, 0x62697274, 0x49657475, 0x7865646e, 0x6e49203a, 0x20786564, 0x7420666f, 0x76206568, 
-    0x65747265, 0x74612078, 0x62697274, 0x20657475, 0x72206f74, 0x69727465, 0x0d657665, 0x675f5f0a, 0x72656e65, 
-    0x543c6369, 0x49203a20, 0x616f6c46, 0x54203e74, 0x74656720, 0x72747441, 0x74756269, 0x69752865, 0x5f38746e, 
-    0x64202a74, 0x42617461, 0x65666675, 0x64644172, 0x73736572, 0x7542202c, 0x72656666, 0x77656956, 0x66756220, 
-    0x56726566, 0x2c776569, 0x6e697520, 0x74612074, 0x62697274, 0x49657475, 0x7865646e, 0x7b0a0d29, 0x20200a0d, 
-    0x62286669, 0x65666675, 0x65695672, 0x6f632e77, 0x20746e75, 0x2930203e, 0x20200a0d, 0x200a0d7b, 0x2f202020, 
-    0x6143202f, 0x6c75636c, 0x20657461, 0x6e696f70, 0x20726574, 0x74206f74, 0x73206568, 0x69636570, 0x20636966, 
-    0x72747461, 0x74756269, 0x73752065, 0x20676e69, 0x7366666f, 0x61207465, 0x7320646e, 0x64697274, 0x200a0d65, 
-    0x54202020, 0x7470202a, 0x203d2072, 0x292a5428, 0x74616428, 0x66754261, 0x41726566, 0x65726464, 0x2b207373, 
-    0x66756220, 0x56726566, 0x2e776569, 0x7366666f, 0x2b207465, 0x74746120, 0x75626972, 0x6e496574, 0x20786564, 
-    0x7562202a, 0x72656666, 0x77656956, 0x7479622e, 0x72745365, 0x29656469, 0x200a0d3b, 0x72202020, 0x72757465, 
-    0x7470206e, 0x5d305b72, 0x200a0d3b, 0x0a0d7d20, 0x20200a0d, 0x75746572, 0x54206e72, 0x3b293128, 0x2f2f2020, 
-    0x72724520, 0x6320726f, 0x20657361, 0x6572202d, 0x6e727574, 0x66656420, 0x746c7561, 0x6c617620, 0x0a0d6575, 
-    0x0d0a0d7d, 0x202f2f0a, 0x72746552, 0x65766569, 0x69727420, 0x6c676e61, 0x65762065, 0x78657472, 0x646e6920, 
-    0x73656369, 0x6f726620, 0x6874206d, 0x656d2065, 0x69206873, 0x7865646e, 0x66756220, 0x0d726566, 0x202f2f0a, 
-    0x70707553, 0x7374726f, 0x746f6220, 0x36312068, 0x7469622d, 0x646e6120, 0x2d323320, 0x20746962, 0x65646e69, 
-    0x6f662078, 0x74616d72, 0x73612073, 0x72657020, 0x544c4720, 0x70732046, 0x66696365, 0x74616369, 0x0d6e6f69, 
-    0x746e690a, 0x65672033, 0x69725474, 0x6c676e61, 0x646e4965, 0x73656369, 0x6e697528, 0x745f3874, 0x6164202a, 
-    0x75426174, 0x72656666, 0x72646441, 0x2c737365, 0x6e6f6320, 0x54207473, 0x6e616972, 0x4d656c67, 0x20687365, 
-    0x6873656d, 0x6e69202c, 0x72702074, 0x74696d69, 0x49657669, 0x0a0d2944, 0x200a0d7b, 0x28666920, 0x6873656d, 
-    0x646e692e, 0x73656369, 0x7479622e, 0x72745365, 0x20656469, 0x73203d3d, 0x6f657a69, 0x6e692866, 0x5f363174, 
-    0x0d292974, 0x7b20200a, 0x20200a0d, 0x2f2f2020, 0x2d363120, 0x20746962, 0x69646e69, 0x20736563, 0x6e697528, 
-    0x5f363174, 0x2d202974, 0x726f6d20, 0x656d2065, 0x79726f6d, 0x66666520, 0x65696369, 0x6620746e, 0x7320726f, 
-    0x6c6c616d, 0x6d207265, 0x65687365, 0x200a0d73, 0x69202020, 0x3631746e, 0x2a33745f, 0x646e6920, 0x73656369, 
-    0x28203d20, 0x31746e69, 0x33745f36, 0x6428292a, 0x42617461, 0x65666675, 0x64644172, 0x73736572, 0x6d202b20, 
-    0x2e687365, 0x69646e69, 0x2e736563, 0x7366666f, 0x3b297465, 0x20200a0d, 0x65722020, 0x6e727574, 0x646e6920, 
-    0x73656369, 0x6972705b, 0x6974696d, 0x44496576, 0x0a0d3b5d, 0x0d7d2020, 0x6520200a, 0x2065736c, 0x6d286669, 
-    0x2e687365, 0x69646e69, 0x2e736563, 0x65747962, 0x69727453, 0x3d206564, 0x6973203d, 0x666f657a, 0x746e6928, 
-    0x745f3233, 0x0a0d2929, 0x0d7b2020, 0x2020200a, 0x202f2f20, 0x622d3233, 0x69207469, 0x6369646e, 0x28207365, 
-    0x746e6975, 0x745f3233, 0x202d2029, 0x70707573, 0x7374726f, 0x72616c20, 0x20726567, 0x6873656d, 0x77207365, 
-    0x20687469, 0x65726f6d, 0x72657620, 0x65636974, 0x200a0d73, 0x69202020, 0x2a33746e, 0x646e6920, 0x73656369, 
-    0x28203d20, 0x33746e69, 0x6428292a, 0x42617461, 0x65666675, 0x64644172, 0x73736572, 0x6d202b20, 0x2e687365, 
-    0x69646e69, 0x2e736563, 0x7366666f, 0x3b297465, 0x20200a0d, 0x65722020, 0x6e727574, 0x646e6920, 0x73656369, 
-    0x6972705b, 0x6974696d, 0x44496576, 0x0a0d3b5d, 0x0d7d2020, 0x200a0d0a, 0x74657220, 0x206e7275, 0x33746e69, 
-    0x29312d28, 0x2f20203b, 0x7245202f, 0x20726f72, 0x65736163, 0x69202d20, 0x6c61766e, 0x69206469, 0x7865646e, 
-    0x726f6620, 0x0d74616d, 0x0a0d7d0a, 0x2f2f0a0d, 0x746e4920, 0x6f707265, 0x6574616c, 0x72657620, 0x20786574, 
-    0x72747461, 0x74756269, 0x61207365, 0x736f7263, 0x20612073, 0x61697274, 0x656c676e, 0x69737520, 0x6220676e, 
-    0x63797261, 0x72746e65, 0x63206369, 0x64726f6f, 0x74616e69, 0x0a0d7365, 0x54202f2f, 0x20736968, 0x66726570, 
-    0x736d726f, 0x6f6d7320, 0x2068746f, 0x65746e69, 0x6c6f7072, 0x6f697461, 0x666f206e, 0x74746120, 0x75626972, 
-    0x20736574, 0x656b696c, 0x736f7020, 0x6f697469, 0x6e202c6e, 0x616d726f, 0x55202c6c, 0x6f632056, 0x6964726f, 
-    0x6574616e, 0x2f0a0d73, 0x3a54202f, 0x70795420, 0x666f2065, 0x74746120, 0x75626972, 0x74206574, 0x6e69206f, 
-    0x70726574, 0x74616c6f, 0x66282065, 0x74616f6c, 0x6c66202c, 0x3274616f, 0x6c66202c, 0x3374616f, 0x7465202c, 
-    0x0d292e63, 0x202f2f0a, 0x72747461, 0x74756269, 0x646e4965, 0x203a7865, 0x69646e49, 0x20736563, 0x7420666f, 
-    0x74206568, 0x65657268, 0x69727420, 0x6c676e61, 0x65762065, 0x63697472, 0x0a0d7365, 0x62202f2f, 0x63797261, 
-    0x72746e65, 0x3a736369, 0x72614220, 0x6e656379, 0x63697274, 0x6f6f6320, 0x6e696472, 0x73657461, 0x65772820, 
-    0x74686769, 0x6f662073, 0x61652072, 0x76206863, 0x65747265, 0x0a0d2978, 0x65675f5f, 0x6972656e, 0x20543c63, 
-    0x4649203a, 0x74616f6c, 0x2054203e, 0x54746567, 0x6e616972, 0x41656c67, 0x69727474, 0x65747562, 0x6e697528, 
-    0x745f3874, 0x6164202a, 0x75426174, 0x72656666, 0x72646441, 0x2c737365, 0x66754220, 0x56726566, 0x20776569, 
-    0x66667562, 0x69567265, 0x202c7765, 0x746e6975, 0x74612033, 0x62697274, 0x49657475, 0x7865646e, 0x6c66202c, 
-    0x3374616f, 0x72616220, 0x6e656379, 0x63697274, 0x0a0d2973, 0x200a0d7b, 0x202f2f20, 0x20746547, 0x20656874, 
-    0x72747461, 0x74756269, 0x61762065, 0x2065756c, 0x20726f66, 0x68636165, 0x20666f20, 0x20656874, 0x65726874, 
-    0x72742065, 0x676e6169, 0x7620656c, 0x69747265, 0x0d736563, 0x5420200a, 0x74746120, 0x3d203072, 0x74656720, 
-    0x72747441, 0x74756269, 0x3e543c65, 0x74616428, 0x66754261, 0x41726566, 0x65726464, 0x202c7373, 0x66667562, 
-    0x69567265, 0x202c7765, 0x72747461, 0x74756269, 0x646e4965, 0x782e7865, 0x0a0d3b29, 0x20542020, 0x72747461, 
-    0x203d2031, 0x41746567, 0x69727474, 0x65747562, 0x283e543c, 0x61746164, 0x66667542, 0x64417265, 0x73657264, 
-    0x62202c73, 0x65666675, 0x65695672, 0x61202c77, 0x69727474, 0x65747562, 0x65646e49, 0x29792e78, 0x200a0d3b, 
-    0x61205420, 0x32727474, 0x67203d20, 0x74417465, 0x62697274, 0x3c657475, 0x64283e54, 0x42617461, 0x65666675, 
-    0x64644172, 0x73736572, 0x7562202c, 0x72656666, 0x77656956, 0x7461202c, 0x62697274, 0x49657475, 0x7865646e, 
-    0x3b297a2e, 0x20200a0d, 0x20200a0d, 0x49202f2f, 0x7265746e, 0x616c6f70, 0x75206574, 0x676e6973, 0x72616220, 
-    0x6e656379, 0x63697274, 0x6f6f6320, 0x6e696472, 0x73657461, 0x65772820, 0x74686769, 0x75732073, 0x6f74206d, 
-    0x302e3120, 0x200a0d29, 0x74657220, 0x206e7275, 0x61622854, 0x65637972, 0x6972746e, 0x782e7363, 0x202a2029, 
-    0x72747461, 0x202b2030, 0x61622854, 0x65637972, 0x6972746e, 0x792e7363, 0x202a2029, 0x72747461, 0x202b2031, 
-    0x61622854, 0x65637972, 0x6972746e, 0x7a2e7363, 0x202a2029, 0x72747461, 0x0a0d3b32, 0x0d0a0d7d, 0x2d2f2f0a, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d2d2d, 
-    0x53202f2f, 0x4f444148, 0x45542057, 0x4e495453, 0x202d2047, 0x65746544, 0x6e696d72, 0x69207365, 0x20612066, 
-    0x6e696f70, 0x73692074, 0x206e6920, 0x64616873, 0x6620776f, 0x206d6f72, 0x696c2061, 0x20746867, 0x72756f73, 
-    0x0a0d6563, 0x2d2d2f2f, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2f0a0d2d, 0x6554202f, 0x20737473, 0x69736976, 0x696c6962, 0x62207974, 0x65777465, 0x61206e65, 
-    0x72757320, 0x65636166, 0x696f7020, 0x6120746e, 0x6120646e, 0x67696c20, 0x73207468, 0x6372756f, 0x2f0a0d65, 
-    0x6552202f, 0x6e727574, 0x2e312073, 0x66692030, 0x6c756620, 0x6c20796c, 0x202c7469, 0x20302e30, 0x66206669, 
-    0x796c6c75, 0x61687320, 0x65776f64, 0x660a0d64, 0x74616f6c, 0x73657420, 0x61685374, 0x28776f64, 0x616f6c66, 
-    0x77203374, 0x646c726f, 0x2c736f50, 0x6f6c6620, 0x20337461, 0x6c726f77, 0x726f4e64, 0x2c6c616d, 0x6f6c6620, 
-    0x20337461, 0x6867696c, 0x72694474, 0x69746365, 0x202c6e6f, 0x66746c47, 0x636e7550, 0x6c617574, 0x67696c20, 
-    0x0d297468, 0x0a0d7b0a, 0x2f2f2020, 0x65724320, 0x20657461, 0x64616873, 0x7220776f, 0x66207961, 0x206d6f72, 
-    0x66727573, 0x20656361, 0x6e696f70, 0x6f742074, 0x64726177, 0x696c2073, 0x20746867, 0x72756f73, 0x0a0d6563, 
-    0x61522020, 0x73654479, 0x68732063, 0x776f6461, 0x3b796152, 0x20200a0d, 0x4f202f2f, 0x65736666, 0x726f2074, 
-    0x6e696769, 0x696c7320, 0x6c746867, 0x6c612079, 0x20676e6f, 0x6d726f6e, 0x74206c61, 0x7661206f, 0x2064696f, 
-    0x666c6573, 0x746e692d, 0x65737265, 0x6f697463, 0x7261206e, 0x61666974, 0x0d737463, 0x7320200a, 0x6f646168, 
-    0x79615277, 0x69724f2e, 0x206e6967, 0x3d202020, 0x726f7720, 0x6f50646c, 0x202b2073, 0x6c726f77, 0x726f4e64, 
-    0x206c616d, 0x2e30202a, 0x3b313030, 0x20200a0d, 0x64616873, 0x6152776f, 0x69442e79, 0x74636572, 0x206e6f69, 
-    0x6f6e203d, 0x6c616d72, 0x28657a69, 0x6867696c, 0x72694474, 0x69746365, 0x3b296e6f, 0x20200a0d, 0x64616873, 
-    0x6152776f, 0x4d542e79, 0x20206e69, 0x20202020, 0x2e30203d, 0x3b313030, 0x2f2f2020, 0x6e694d20, 0x6d756d69, 
-    0x73696420, 0x636e6174, 0x6f742065, 0x6f766120, 0x73206469, 0x2d666c65, 0x65746e69, 0x63657372, 0x6e6f6974, 
-    0x20200a0d, 0x46202f2f, 0x6420726f, 0x63657269, 0x6e6f6974, 0x6c206c61, 0x74686769, 0x74202c73, 0x65636172, 
-    0x206f7420, 0x69666e69, 0x7974696e, 0x6f66203b, 0x6f702072, 0x2f746e69, 0x746f7073, 0x67696c20, 0x2c737468, 
-    0x61727420, 0x74206563, 0x696c206f, 0x20746867, 0x69736f70, 0x6e6f6974, 0x20200a0d, 0x64616873, 0x6152776f, 
-    0x4d542e79, 0x20207861, 0x20202020, 0x696c203d, 0x2e746867, 0x65707974, 0x203d3d20, 0x66746c47, 0x6867694c, 
-    0x70795474, 0x653a3a65, 0x65726944, 0x6f697463, 0x206c616e, 0x4e49203f, 0x494e4946, 0x3a204554, 0x6e656c20, 
-    0x28687467, 0x6867696c, 0x72694474, 0x69746365, 0x3b296e6f, 0x0a0d0a0d, 0x2f2f2020, 0x65724320, 0x20657461, 
-    0x696d2061, 0x616d696e, 0x6170206c, 0x616f6c79, 0x6f662064, 0x68732072, 0x776f6461, 0x79617220, 0x65772820, 
-    0x6c6e6f20, 0x656e2079, 0x74206465, 0x6e6b206f, 0x6920776f, 0x74692066, 0x74696820, 0x6f732073, 0x6874656d, 
-    0x29676e69, 0x20200a0d, 0x50746948, 0x6f6c7961, 0x73206461, 0x6f646168, 0x79615077, 0x64616f6c, 0x200a0d3b, 
-    0x61687320, 0x50776f64, 0x6f6c7961, 0x642e6461, 0x68747065, 0x30203d20, 0x2f20203b, 0x6957202f, 0x62206c6c, 
-    0x65732065, 0x6f742074, 0x53494d20, 0x45445f53, 0x20485450, 0x6e206669, 0x6968206f, 0x636f2074, 0x73727563, 
-    0x0a0d0a0d, 0x2f2f2020, 0x61725420, 0x74206563, 0x73206568, 0x6f646168, 0x61722077, 0x69772079, 0x6f206874, 
-    0x6d697470, 0x64657a69, 0x616c6620, 0x66207367, 0x7020726f, 0x6f667265, 0x6e616d72, 0x0d3a6563, 0x2f20200a, 
-    0x4152202f, 0x4c465f59, 0x415f4741, 0x50454343, 0x49465f54, 0x5f545352, 0x5f544948, 0x5f444e41, 0x5f444e45, 
-    0x52414553, 0x203a4843, 0x706f7453, 0x20746120, 0x73726966, 0x6e692074, 0x73726574, 0x69746365, 0x28206e6f, 
-    0x64206577, 0x74276e6f, 0x65656e20, 0x6c632064, 0x7365736f, 0x0a0d2974, 0x2f2f2020, 0x59415220, 0x414c465f, 
-    0x4b535f47, 0x435f5049, 0x45534f4c, 0x485f5453, 0x535f5449, 0x45444148, 0x53203a52, 0x2070696b, 0x65707865, 
-    0x7669736e, 0x68732065, 0x6e696461, 0x61632067, 0x6c75636c, 0x6f697461, 0x0a0d736e, 0x72542020, 0x52656361, 
-    0x74287961, 0x654c706f, 0x416c6576, 0x52202c53, 0x465f5941, 0x5f47414c, 0x45434341, 0x465f5450, 0x54535249, 
-    0x5449485f, 0x444e415f, 0x444e455f, 0x4145535f, 0x20484352, 0x4152207c, 0x4c465f59, 0x535f4741, 0x5f50494b, 
-    0x534f4c43, 0x5f545345, 0x5f544948, 0x44414853, 0x202c5245, 0x66667830, 0x2c30202c, 0x202c3020, 0x0a0d2c30, 
-    0x20202020, 0x20202020, 0x73202020, 0x6f646168, 0x79615277, 0x6873202c, 0x776f6461, 0x6c796150, 0x2964616f, 
-    0x0d0a0d3b, 0x2f20200a, 0x6649202f, 0x65687420, 0x61687320, 0x20776f64, 0x20796172, 0x20746968, 0x656d6f73, 
-    0x6e696874, 0x64282067, 0x68747065, 0x203d2120, 0x5353494d, 0x5045445f, 0x2c294854, 0x65687420, 0x67696c20, 
-    0x69207468, 0x636f2073, 0x64756c63, 0x0a0d6465, 0x65722020, 0x6e727574, 0x61687320, 0x50776f64, 0x6f6c7961, 
-    0x642e6461, 0x68747065, 0x203d2120, 0x5353494d, 0x5045445f, 0x3f204854, 0x302e3020, 0x31203a20, 0x0d3b302e, 
-    0x0a0d7d0a, 0x2f2f0a0d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x0d2d2d2d, 0x202f2f0a, 0x4847494c, 0x52502054, 0x5345434f, 0x474e4953, 0x48202d20, 0x6c646e61, 
-    0x73207365, 0x6f20796b, 0x72726576, 0x2c656469, 0x73696420, 0x636e6174, 0x74612065, 0x756e6574, 0x6f697461, 
-    0x61202c6e, 0x7320646e, 0x20746f70, 0x6867696c, 0x6f632074, 0x6520656e, 0x63656666, 0x0a0d7374, 0x2d2d2f2f, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2f0a0d2d, 
-    0x7250202f, 0x7365636f, 0x20736573, 0x6867696c, 0x72702074, 0x7265706f, 0x73656974, 0x73616220, 0x6f206465, 
-    0x7974206e, 0x61206570, 0x6120646e, 0x696c7070, 0x61207365, 0x6f727070, 0x61697270, 0x61206574, 0x6e657474, 
-    0x69746175, 0x0a0d6e6f, 0x66746c47, 0x636e7550, 0x6c617574, 0x6f727020, 0x73736563, 0x6867694c, 0x6c472874, 
-    0x63536674, 0x49656e65, 0x206f666e, 0x6e656373, 0x666e4965, 0x66202c6f, 0x74616f6c, 0x6f772033, 0x50646c72, 
-    0x0d29736f, 0x0a0d7b0a, 0x2f2f2020, 0x61745320, 0x77207472, 0x20687469, 0x20656874, 0x73726966, 0x75702074, 
-    0x7574636e, 0x6c206c61, 0x74686769, 0x206e6920, 0x20656874, 0x6e656373, 0x73282065, 0x6c706d69, 0x65696669, 
-    0x6f662064, 0x75742072, 0x69726f74, 0x0d296c61, 0x4720200a, 0x5066746c, 0x74636e75, 0x206c6175, 0x6867696c, 
-    0x203d2074, 0x6e656373, 0x666e4965, 0x75702e6f, 0x7574636e, 0x694c6c61, 0x73746867, 0x3b5d305b, 0x0a0d0a0d, 
-    0x2f2f2020, 0x796b5320, 0x65766f20, 0x64697272, 0x52203a65, 0x616c7065, 0x70206563, 0x74636e75, 0x206c6175, 
-    0x6867696c, 0x69772074, 0x73206874, 0x70206e75, 0x6d617261, 0x72657465, 0x72662073, 0x73206d6f, 0x7320796b, 
-    0x65747379, 0x200a0d6d, 0x202f2f20, 0x73696854, 0x6c6c6120, 0x2073776f, 0x6e697375, 0x72702067, 0x6465636f, 
-    0x6c617275, 0x796b7320, 0x67696c20, 0x6e697468, 0x6e692067, 0x61657473, 0x666f2064, 0x6e616d20, 0x206c6175, 
-    0x6867696c, 0x65732074, 0x0d707574, 0x6920200a, 0x63732866, 0x49656e65, 0x2e6f666e, 0x53657375, 0x3d20796b, 
-    0x2931203d, 0x20200a0d, 0x200a0d7b, 0x6c202020, 0x74686769, 0x7269642e, 0x69746365, 0x3d206e6f, 0x65637320, 
-    0x6e49656e, 0x732e6f66, 0x6953796b, 0x656c706d, 0x61726150, 0x75732e6d, 0x7269446e, 0x69746365, 0x203b6e6f, 
-    0x202f2f20, 0x206e7553, 0x65726964, 0x6f697463, 0x7266206e, 0x73206d6f, 0x0a0d796b, 0x20202020, 0x6867696c, 
-    0x6f632e74, 0x20726f6c, 0x20202020, 0x6373203d, 0x49656e65, 0x2e6f666e, 0x53796b73, 0x6c706d69, 0x72615065, 
-    0x732e6d61, 0x6f436e75, 0x3b726f6c, 0x20202020, 0x2f2f2020, 0x6e755320, 0x6c6f6320, 0x6620726f, 0x206d6f72, 
-    0x0d796b73, 0x2020200a, 0x67696c20, 0x692e7468, 0x6e65746e, 0x79746973, 0x73203d20, 0x656e6563, 0x6f666e49, 
-    0x796b732e, 0x706d6953, 0x6150656c, 0x2e6d6172, 0x496e7573, 0x6e65746e, 0x79746973, 0x2f20203b, 0x7553202f, 
-    0x6e69206e, 0x736e6574, 0x20797469, 0x6d6f7266, 0x796b7320, 0x20200a0d, 0x696c2020, 0x2e746867, 0x65707974, 
-    0x20202020, 0x203d2020, 0x66746c47, 0x6867694c, 0x70795474, 0x653a3a65, 0x65726944, 0x6f697463, 0x3b6c616e, 
-    0x20202020, 0x20202020, 0x20202020, 0x53202f2f, 0x69206e75, 0x6c612073, 0x73796177, 0x72696420, 0x69746365, 
-    0x6c616e6f, 0x20200a0d, 0x0d0a0d7d, 0x2f20200a, 0x6f50202f, 0x20746e69, 0x6867696c, 0x43203a74, 0x75636c61, 
-    0x6574616c, 0x72696420, 0x69746365, 0x66206e6f, 0x206d6f72, 0x6867696c, 0x6f742074, 0x72757320, 0x65636166, 
-    0x646e6120, 0x70706120, 0x6420796c, 0x61747369, 0x2065636e, 0x65747461, 0x7461756e, 0x0d6e6f69, 0x6920200a, 
-    0x696c2866, 0x2e746867, 0x65707974, 0x203d3d20, 0x66746c47, 0x6867694c, 0x70795474, 0x653a3a65, 0x6e696f50, 
-    0x0a0d2974, 0x0d7b2020, 0x2020200a, 0x202f2f20, 0x65726944, 0x6f697463, 0x7266206e, 0x73206d6f, 0x61667275, 
-    0x70206563, 0x746e696f, 0x206f7420, 0x6867696c, 0x6f702074, 0x69746973, 0x0a0d6e6f, 0x20202020, 0x6867696c, 
-    0x69642e74, 0x74636572, 0x206e6f69, 0x696c203d, 0x2e746867, 0x69736f70, 0x6e6f6974, 0x77202d20, 0x646c726f, 
-    0x3b736f50, 0x20200a0d, 0x6c662020, 0x2074616f, 0x20202064, 0x20202020, 0x203d2020, 0x676e656c, 0x6c286874, 
-    0x74686769, 0x7269642e, 0x69746365, 0x3b296e6f, 0x20200a0d, 0x2f2f2020, 0x70704120, 0x6920796c, 0x7265766e, 
-    0x73206573, 0x72617571, 0x616c2065, 0x69203a77, 0x6e65746e, 0x79746973, 0x63656420, 0x73616572, 0x77207365, 
-    0x20687469, 0x74736964, 0x65636e61, 0x75717320, 0x64657261, 0x20200a0d, 0x696c2020, 0x2e746867, 0x65746e69, 
-    0x7469736e, 0x3d2f2079, 0x20642820, 0x2964202a, 0x200a0d3b, 0x0a0d7d20, 0x2f2f2020, 0x6f705320, 0x696c2074, 
-    0x3a746867, 0x6c614320, 0x616c7563, 0x64206574, 0x63657269, 0x6e6f6974, 0x7061202c, 0x20796c70, 0x74736964, 
-    0x65636e61, 0x74746120, 0x61756e65, 0x6e6f6974, 0x646e6120, 0x6e6f6320, 0x61662065, 0x666f6c6c, 0x200a0d66, 
-    0x736c6520, 0x66692065, 0x67696c28, 0x742e7468, 0x20657079, 0x47203d3d, 0x4c66746c, 0x74686769, 0x65707954, 
-    0x53653a3a, 0x29746f70, 0x20200a0d, 0x200a0d7b, 0x2f202020, 0x6944202f, 0x74636572, 0x206e6f69, 0x6d6f7266, 
-    0x72757320, 0x65636166, 0x696f7020, 0x7420746e, 0x696c206f, 0x20746867, 0x69736f70, 0x6e6f6974, 0x20200a0d, 
-    0x6c662020, 0x3374616f, 0x67696c20, 0x69447468, 0x203d2072, 0x6867696c, 0x6f702e74, 0x69746973, 0x2d206e6f, 
-    0x726f7720, 0x6f50646c, 0x0a0d3b73, 0x20202020, 0x616f6c66, 0x64202074, 0x20202020, 0x20202020, 0x656c203d, 
-    0x6874676e, 0x67696c28, 0x69447468, 0x0d3b2972, 0x2020200a, 0x202f2f20, 0x6c707041, 0x69642079, 0x6e617473, 
-    0x61206563, 0x6e657474, 0x69746175, 0x28206e6f, 0x65766e69, 0x20657372, 0x61757173, 0x6c206572, 0x0d297761, 
-    0x2020200a, 0x67696c20, 0x692e7468, 0x6e65746e, 0x79746973, 0x203d2f20, 0x2a206428, 0x3b296420, 0x0a0d0a0d, 
-    0x20202020, 0x43202f2f, 0x75636c61, 0x6574616c, 0x6e6f6320, 0x74612065, 0x756e6574, 0x6f697461, 0x6162206e, 
-    0x20646573, 0x61206e6f, 0x656c676e, 0x6f726620, 0x7073206d, 0x6c20746f, 0x74686769, 0x72696420, 0x69746365, 
-    0x0a0d6e6f, 0x20202020, 0x74202f2f, 0x61746568, 0x6f63203a, 0x656e6973, 0x20666f20, 0x6c676e61, 0x65622065, 
-    0x65657774, 0x696c206e, 0x20746867, 0x65726964, 0x6f697463, 0x6e61206e, 0x70732064, 0x6420746f, 0x63657269, 
-    0x6e6f6974, 0x20200a0d, 0x6c662020, 0x2074616f, 0x74656874, 0x203d2061, 0x28746f64, 0x6d726f6e, 0x7a696c61, 
-    0x696c2865, 0x44746867, 0x2c297269, 0x726f6e20, 0x696c616d, 0x6c28657a, 0x74686769, 0x7269642e, 0x69746365, 
-    0x29296e6f, 0x200a0d3b, 0x2f202020, 0x6d53202f, 0x68746f6f, 0x6c616620, 0x66666f6c, 0x6f726620, 0x6e69206d, 
-    0x2072656e, 0x656e6f63, 0x2e312820, 0x74202930, 0x756f206f, 0x20726574, 0x656e6f63, 0x2e302820, 0x0a0d2930, 
-    0x20202020, 0x616f6c66, 0x70732074, 0x6e49746f, 0x736e6574, 0x20797469, 0x6c63203d, 0x28706d61, 0x65687428, 
-    0x2d206174, 0x736f6320, 0x67696c28, 0x632e7468, 0x41656e6f, 0x656c676e, 0x2f202929, 0x2e312820, 0x202d2030, 
-    0x28736f63, 0x6867696c, 0x6f632e74, 0x6e41656e, 0x29656c67, 0x30202c29, 0x202c302e, 0x29302e31, 0x200a0d3b, 
-    0x6c202020, 0x74686769, 0x746e692e, 0x69736e65, 0x2a207974, 0x7073203d, 0x6e49746f, 0x736e6574, 0x3b797469, 
-    0x20200a0d, 0x696c2020, 0x2e746867, 0x65726964, 0x6f697463, 0x203d206e, 0x6867696c, 0x72694474, 0x200a0d3b, 
-    0x0a0d7d20, 0x20200a0d, 0x75746572, 0x6c206e72, 0x74686769, 0x7d0a0d3b, 0x0a0d0a0d, 0x2d2d2f2f, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2f0a0d2d, 0x4152202f, 
-    0x45472059, 0x4152454e, 0x4e4f4954, 0x41485320, 0x20524544, 0x6e45202d, 0x20797274, 0x6e696f70, 0x6f662074, 
-    0x61652072, 0x70206863, 0x6c657869, 0x206e6920, 0x20656874, 0x7074756f, 0x69207475, 0x6567616d, 0x2f2f0a0d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0d2d2d2d, 
-    0x68735b0a, 0x72656461, 0x61722228, 0x6e656779, 0x74617265, 0x226e6f69, 0x0a0d5d29, 0x64696f76, 0x65677220, 
-    0x69614d6e, 0x0d29286e, 0x0a0d7b0a, 0x2f2f2020, 0x74654720, 0x65687420, 0x72756320, 0x746e6572, 0x78697020, 
-    0x63206c65, 0x64726f6f, 0x74616e69, 0x61207365, 0x6920646e, 0x6567616d, 0x6d696420, 0x69736e65, 0x0d736e6f, 
-    0x6620200a, 0x74616f6c, 0x616c2032, 0x68636e75, 0x20204449, 0x28203d20, 0x616f6c66, 0x44293274, 0x61707369, 
-    0x52686374, 0x49737961, 0x7865646e, 0x782e2928, 0x20203b79, 0x2f202020, 0x7543202f, 0x6e657272, 0x69702074, 
-    0x206c6578, 0x792c7828, 0x200a0d29, 0x6f6c6620, 0x20327461, 0x6e75616c, 0x69536863, 0x3d20657a, 0x6c662820, 
-    0x3274616f, 0x73694429, 0x63746170, 0x79615268, 0x6d694473, 0x69736e65, 0x28736e6f, 0x79782e29, 0x2f2f203b, 
-    0x616d4920, 0x73206567, 0x20657a69, 0x64697728, 0x682c6874, 0x68676965, 0x0a0d2974, 0x20200a0d, 0x52202f2f, 
-    0x69727465, 0x20657665, 0x6e656373, 0x6e692065, 0x6d726f66, 0x6f697461, 0x7266206e, 0x70206d6f, 0x20687375, 
-    0x736e6f63, 0x746e6174, 0x200a0d73, 0x746c4720, 0x65635366, 0x6e49656e, 0x73206f66, 0x656e6563, 0x6f666e49, 
-    0x70203d20, 0x43687375, 0x74736e6f, 0x6563732e, 0x6e49656e, 0x64416f66, 0x73657264, 0x5d305b73, 0x0d0a0d3b, 
-    0x2f20200a, 0x6553202f, 0x61722074, 0x72742079, 0x6e696361, 0x6c662067, 0x20736761, 0x3d203028, 0x206f6e20, 
-    0x63657073, 0x206c6169, 0x67616c66, 0x0a0d2973, 0x6f632020, 0x2074736e, 0x746e6975, 0x72202020, 0x6c467961, 
-    0x20736761, 0x203d2020, 0x0a0d3b30, 0x0a0d2020, 0x2f2f2020, 0x6e6f4320, 0x74726576, 0x78697020, 0x63206c65, 
-    0x64726f6f, 0x74616e69, 0x74207365, 0x6f6e206f, 0x6c616d72, 0x64657a69, 0x76656420, 0x20656369, 0x726f6f63, 
-    0x616e6964, 0x20736574, 0x43444e28, 0x200a0d29, 0x202f2f20, 0x676e6152, 0x5b203a65, 0x312c312d, 0x6f66205d, 
-    0x6f622072, 0x78206874, 0x646e6120, 0x0a0d7920, 0x6f632020, 0x2074736e, 0x616f6c66, 0x63203274, 0x4370696c, 
-    0x64726f6f, 0x203d2073, 0x6e75616c, 0x44496863, 0x6c202f20, 0x636e7561, 0x7a695368, 0x202a2065, 0x20302e32, 
-    0x2e31202d, 0x0a0d3b30, 0x0a0d2020, 0x2f2f2020, 0x61725420, 0x6f66736e, 0x66206d72, 0x206d6f72, 0x2043444e, 
-    0x76206f74, 0x20776569, 0x63617073, 0x73752065, 0x20676e69, 0x65766e69, 0x20657372, 0x6a6f7270, 0x69746365, 
-    0x6d206e6f, 0x69727461, 0x200a0d78, 0x6e6f6320, 0x66207473, 0x74616f6c, 0x69762034, 0x6f437765, 0x7364726f, 
-    0x6d203d20, 0x66286c75, 0x74616f6c, 0x6c632834, 0x6f437069, 0x7364726f, 0x2e31202c, 0x31202c30, 0x2c29302e, 
-    0x65637320, 0x6e49656e, 0x702e6f66, 0x496a6f72, 0x614d766e, 0x78697274, 0x0a0d3b29, 0x20200a0d, 0x43202f2f, 
-    0x74616572, 0x68742065, 0x72702065, 0x72616d69, 0x61722079, 0x200a0d79, 0x79615220, 0x63736544, 0x79617220, 
-    0x200a0d3b, 0x202f2f20, 0x6e617254, 0x726f6673, 0x6163206d, 0x6172656d, 0x69726f20, 0x206e6967, 0x302c3028, 
-    0x2029302c, 0x6d6f7266, 0x65697620, 0x70732077, 0x20656361, 0x77206f74, 0x646c726f, 0x61707320, 0x0a0d6563, 
-    0x61722020, 0x724f2e79, 0x6e696769, 0x20202020, 0x756d203d, 0x6c66286c, 0x3474616f, 0x302e3028, 0x2e30202c, 
-    0x30202c30, 0x202c302e, 0x29302e31, 0x6373202c, 0x49656e65, 0x2e6f666e, 0x77656976, 0x4d766e49, 0x69727461, 
-    0x782e2978, 0x0d3b7a79, 0x2f20200a, 0x7254202f, 0x66736e61, 0x206d726f, 0x20796172, 0x65726964, 0x6f697463, 
-    0x7266206e, 0x76206d6f, 0x20776569, 0x63617073, 0x6f742065, 0x726f7720, 0x7320646c, 0x65636170, 0x20200a0d, 
-    0x2e796172, 0x65726944, 0x6f697463, 0x203d206e, 0x286c756d, 0x616f6c66, 0x6e283474, 0x616d726f, 0x657a696c, 
-    0x65697628, 0x6f6f4377, 0x2e736472, 0x297a7978, 0x2e30202c, 0x202c2930, 0x6e656373, 0x666e4965, 0x69762e6f, 
-    0x6e497765, 0x74614d76, 0x29786972, 0x7a79782e, 0x200a0d3b, 0x79617220, 0x694d542e, 0x2020206e, 0x3d202020, 
-    0x302e3020, 0x203b3130, 0x2f202020, 0x694d202f, 0x756d696e, 0x6964206d, 0x6e617473, 0x74206563, 0x7661206f, 
-    0x2064696f, 0x666c6573, 0x746e692d, 0x65737265, 0x6f697463, 0x200a0d6e, 0x79617220, 0x614d542e, 0x20202078, 
-    0x3d202020, 0x464e4920, 0x54494e49, 0x2f203b45, 0x614d202f, 0x756d6978, 0x6964206d, 0x6e617473, 0x28206563, 
-    0x69666e69, 0x6574696e, 0x726f6620, 0x69727020, 0x7972616d, 0x79617220, 0x0a0d2973, 0x20200a0d, 0x49202f2f, 
-    0x6974696e, 0x7a696c61, 0x61722065, 0x61702079, 0x616f6c79, 0x69772064, 0x64206874, 0x75616665, 0x7620746c, 
-    0x65756c61, 0x200a0d73, 0x74694820, 0x6c796150, 0x2064616f, 0x6c796170, 0x3b64616f, 0x20200a0d, 0x6c796170, 
-    0x2e64616f, 0x6f6c6f63, 0x3d202072, 0x6f6c6620, 0x28337461, 0x30202c30, 0x2930202c, 0x2f20203b, 0x7453202f, 
-    0x20747261, 0x68746977, 0x616c6220, 0x0a0d6b63, 0x61702020, 0x616f6c79, 0x65772e64, 0x74686769, 0x31203d20, 
-    0x2020203b, 0x20202020, 0x20202020, 0x20202020, 0x202f2f20, 0x6c6c7546, 0x69657720, 0x20746867, 0x20726f66, 
-    0x6d697270, 0x20797261, 0x73796172, 0x20200a0d, 0x6c796170, 0x2e64616f, 0x74706564, 0x3d202068, 0x203b3020, 
-    0x20202020, 0x20202020, 0x20202020, 0x2f202020, 0x7453202f, 0x20747261, 0x64207461, 0x68747065, 0x0a0d3020, 
-    0x20200a0d, 0x43202f2f, 0x20747361, 0x20656874, 0x20796172, 0x6f746e69, 0x65687420, 0x65637320, 0x7520656e, 
-    0x676e6973, 0x65687420, 0x63636120, 0x72656c65, 0x6f697461, 0x7473206e, 0x74637572, 0x0d657275, 0x2f20200a, 
-    0x6150202f, 0x656d6172, 0x73726574, 0x5341203a, 0x6c66202c, 0x2c736761, 0x736e6920, 0x636e6174, 0x616d2065, 
-    0x202c6b73, 0x20746273, 0x7366666f, 0x202c7465, 0x20746273, 0x69727473, 0x202c6564, 0x7373696d, 0x66666f20, 
-    0x2c746573, 0x79617220, 0x6170202c, 0x616f6c79, 0x200a0d64, 0x61725420, 0x61526563, 0x6f742879, 0x76654c70, 
-    0x53416c65, 0x6172202c, 0x616c4679, 0x202c7367, 0x66667830, 0x2c30202c, 0x202c3020, 0x72202c30, 0x202c7961, 
-    0x6c796170, 0x2964616f, 0x200a0d3b, 0x200a0d20, 0x202f2f20, 0x20746547, 0x20656874, 0x616e6966, 0x6f63206c, 
-    0x20726f6c, 0x6d6f7266, 0x65687420, 0x79617220, 0x61727420, 0x676e6963, 0x73657220, 0x0d746c75, 0x6620200a, 
-    0x74616f6c, 0x6f632033, 0x20726f6c, 0x6170203d, 0x616f6c79, 0x6f632e64, 0x3b726f6c, 0x20200a0d, 0x20200a0d, 
-    0x57202f2f, 0x65746972, 0x65687420, 0x73657220, 0x20746c75, 0x74206f74, 0x6f206568, 0x75707475, 0x6d692074, 
-    0x0d656761, 0x6f20200a, 0x6d497475, 0x5b656761, 0x32746e69, 0x75616c28, 0x4968636e, 0x205d2944, 0x6c66203d, 
-    0x3474616f, 0x6c6f6328, 0x202c726f, 0x29302e31, 0x7d0a0d3b, 0x0a0d0a0d, 0x2d2d2f2f, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2f0a0d2d, 0x4c43202f, 0x5345534f, 
-    0x49482054, 0x48532054, 0x52454441, 0x43202d20, 0x656c6c61, 0x68772064, 0x72206e65, 0x68207961, 0x20737469, 
-    0x6d6f6567, 0x79727465, 0x65702820, 0x726f6672, 0x7320736d, 0x69646168, 0x0d29676e, 0x2d2f2f0a, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d2d2d, 0x6168735b, 
-    0x28726564, 0x6f6c6322, 0x74736573, 0x22746968, 0x0a0d5d29, 0x64696f76, 0x68637220, 0x614d7469, 0x69286e69, 
-    0x74756f6e, 0x74694820, 0x6c796150, 0x2064616f, 0x6c796170, 0x2c64616f, 0x206e6920, 0x6c697542, 0x546e4974, 
-    0x6e616972, 0x49656c67, 0x7265746e, 0x74636573, 0x416e6f69, 0x69727474, 0x65747562, 0x74612073, 0x0d297274, 
-    0x0a0d7b0a, 0x2f2f2020, 0x6e6f4320, 0x74726576, 0x69756220, 0x692d746c, 0x6162206e, 0x65637972, 0x6972746e, 
-    0x6f632063, 0x6964726f, 0x6574616e, 0x6f742073, 0x6c756620, 0x6162206c, 0x65637972, 0x6972746e, 0x6f632063, 
-    0x6964726f, 0x6574616e, 0x200a0d73, 0x202f2f20, 0x6c697542, 0x6e692d74, 0x6f727020, 0x65646976, 0x75282073, 
-    0x2029762c, 0x72656877, 0x2b752065, 0x3d772b76, 0x73202c31, 0x2077206f, 0x2d31203d, 0x0d762d75, 0x6620200a, 
-    0x74616f6c, 0x61622033, 0x65637972, 0x6972746e, 0x3d207363, 0x6f6c6620, 0x28337461, 0x202d2031, 0x72747461, 
-    0x7261622e, 0x6e656379, 0x63697274, 0x20782e73, 0x7461202d, 0x622e7274, 0x63797261, 0x72746e65, 0x2e736369, 
-    0x61202c79, 0x2e727474, 0x79726162, 0x746e6563, 0x73636972, 0x202c782e, 0x72747461, 0x7261622e, 0x6e656379, 
-    0x63697274, 0x29792e73, 0x0d0a0d3b, 0x2f20200a, 0x6547202f, 0x6e692074, 0x6e617473, 0x61206563, 0x7020646e, 
-    0x696d6972, 0x65766974, 0x666e6920, 0x616d726f, 0x6e6f6974, 0x6f726620, 0x6172206d, 0x72742079, 0x6e696361, 
-    0x75622067, 0x2d746c69, 0x0d736e69, 0x7520200a, 0x20746e69, 0x74736e69, 0x65636e61, 0x3d204449, 0x736e4920, 
-    0x636e6174, 0x646e4965, 0x29287865, 0x2f20203b, 0x6857202f, 0x20686369, 0x74736e69, 0x65636e61, 0x73617720, 
-    0x74696820, 0x20200a0d, 0x746e6975, 0x73656d20, 0x20444968, 0x20202020, 0x6e49203d, 0x6e617473, 0x44496563, 
-    0x203b2928, 0x20202020, 0x49202f2f, 0x6174736e, 0x2065636e, 0x28204449, 0x656d6173, 0x20736120, 0x74736e69, 
-    0x65636e61, 0x69204449, 0x6874206e, 0x63207369, 0x29657361, 0x20200a0d, 0x746e6975, 0x69727420, 0x20204449, 
-    0x20202020, 0x7250203d, 0x74696d69, 0x49657669, 0x7865646e, 0x203b2928, 0x57202f2f, 0x68636968, 0x69727420, 
-    0x6c676e61, 0x69772065, 0x6e696874, 0x65687420, 0x73656d20, 0x61772068, 0x69682073, 0x0d0a0d74, 0x2f20200a, 
-    0x6552202f, 0x65697274, 0x73206576, 0x656e6563, 0x74616420, 0x74732061, 0x74637572, 0x73657275, 0x20200a0d, 
-    0x66746c47, 0x6e656353, 0x666e4965, 0x2020206f, 0x20202020, 0x63732020, 0x49656e65, 0x206f666e, 0x7570203d, 
-    0x6f436873, 0x2e74736e, 0x6e656373, 0x666e4965, 0x6464416f, 0x73736572, 0x3b5d305b, 0x20200a0d, 0x66746c47, 
-    0x74736e49, 0x65636e61, 0x20202020, 0x20202020, 0x6e692020, 0x6e617473, 0x20206563, 0x6373203d, 0x49656e65, 
-    0x2e6f666e, 0x74736e69, 0x65636e61, 0x6e695b73, 0x6e617473, 0x44496563, 0x20203b5d, 0x20202020, 0x49202f2f, 
-    0x6174736e, 0x2065636e, 0x61746164, 0x20200a0d, 0x66746c47, 0x6873654d, 0x20202020, 0x20202020, 0x20202020, 
-    0x656d2020, 0x20206873, 0x20202020, 0x6373203d, 0x49656e65, 0x2e6f666e, 0x6873656d, 0x695b7365, 0x6174736e, 
-    0x2e65636e, 0x6873656d, 0x65646e49, 0x203b5d78, 0x4d202f2f, 0x20687365, 0x61746164, 0x20200a0d, 0x66746c47, 
-    0x6174654d, 0x63696c6c, 0x67756f52, 0x73656e68, 0x616d2073, 0x69726574, 0x20206c61, 0x6373203d, 0x49656e65, 
-    0x2e6f666e, 0x6574616d, 0x6c616972, 0x6e695b73, 0x6e617473, 0x6d2e6563, 0x72657461, 0x496c6169, 0x7865646e, 
-    0x2f203b5d, 0x614d202f, 0x69726574, 0x64206c61, 0x0d617461, 0x200a0d0a, 0x202f2f20, 0x65746e49, 0x6c6f7072, 
-    0x20657461, 0x74726576, 0x61207865, 0x69727474, 0x65747562, 0x63612073, 0x73736f72, 0x65687420, 0x74696820, 
-    0x69727420, 0x6c676e61, 0x200a0d65, 0x746e6920, 0x20202033, 0x69646e69, 0x20736563, 0x20202020, 0x203d2020, 
-    0x54746567, 0x6e616972, 0x49656c67, 0x6369646e, 0x6d287365, 0x2e687365, 0x66746c67, 0x66667542, 0x202c7265, 
-    0x6873656d, 0x6972742e, 0x6873654d, 0x7274202c, 0x29444969, 0x200a0d3b, 0x6f6c6620, 0x20337461, 0x20736f70, 
-    0x20202020, 0x20202020, 0x203d2020, 0x54746567, 0x6e616972, 0x41656c67, 0x69727474, 0x65747562, 0x6f6c663c, 
-    0x3e337461, 0x73656d28, 0x6c672e68, 0x75426674, 0x72656666, 0x656d202c, 0x742e6873, 0x654d6972, 0x702e6873, 
-    0x7469736f, 0x736e6f69, 0x6e69202c, 0x65636964, 0x62202c73, 0x63797261, 0x72746e65, 0x29736369, 0x200a0d3b, 
-    0x6f6c6620, 0x20337461, 0x206d726e, 0x20202020, 0x20202020, 0x203d2020, 0x54746567, 0x6e616972, 0x41656c67, 
-    0x69727474, 0x65747562, 0x6f6c663c, 0x3e337461, 0x73656d28, 0x6c672e68, 0x75426674, 0x72656666, 0x656d202c, 
-    0x742e6873, 0x654d6972, 0x6e2e6873, 0x616d726f, 0x202c736c, 0x69646e69, 0x2c736563, 0x72616220, 0x6e656379, 
-    0x63697274, 0x0d3b2973, 0x6620200a, 0x74616f6c, 0x6f772032, 0x54646c72, 0x6f437865, 0x2064726f, 0x6567203d, 
-    0x69725474, 0x6c676e61, 0x74744165, 0x75626972, 0x663c6574, 0x74616f6c, 0x6d283e32, 0x2e687365, 0x66746c67, 
-    0x66667542, 0x202c7265, 0x6873656d, 0x6972742e, 0x6873654d, 0x7865742e, 0x726f6f43, 0x202c7364, 0x69646e69, 
-    0x2c736563, 0x72616220, 0x6e656379, 0x63697274, 0x0d3b2973, 0x0d20200a, 0x2f20200a, 0x7254202f, 0x66736e61, 
-    0x206d726f, 0x6d6f7266, 0x6a626f20, 0x20746365, 0x63617073, 0x6f742065, 0x726f7720, 0x7320646c, 0x65636170, 
-    0x20200a0d, 0x616f6c66, 0x77203374, 0x646c726f, 0x20736f50, 0x20202020, 0x66203d20, 0x74616f6c, 0x756d2833, 
-    0x6c66286c, 0x3474616f, 0x736f7028, 0x2e31202c, 0x202c2930, 0x656a624f, 0x6f547463, 0x6c726f57, 0x33783464, 
-    0x29292928, 0x200a0d3b, 0x6f6c6620, 0x20337461, 0x6c726f77, 0x726f4e64, 0x206c616d, 0x203d2020, 0x6d726f6e, 
-    0x7a696c61, 0x756d2865, 0x6f57286c, 0x54646c72, 0x6a624f6f, 0x34746365, 0x29283378, 0x726e202c, 0x782e296d, 
-    0x3b297a79, 0x0a0d0a0d, 0x2f2f2020, 0x74784520, 0x74636172, 0x74616d20, 0x61697265, 0x7270206c, 0x7265706f, 
-    0x73656974, 0x42502820, 0x61702052, 0x656d6172, 0x73726574, 0x200a0d29, 0x6f6c6620, 0x20337461, 0x65626c61, 
-    0x20206f64, 0x203d2020, 0x6574616d, 0x6c616972, 0x7361622e, 0x6c6f4365, 0x6146726f, 0x726f7463, 0x7a79782e, 
-    0x2f20203b, 0x6142202f, 0x63206573, 0x726f6c6f, 0x626c612f, 0x0d6f6465, 0x6620200a, 0x74616f6c, 0x656d2020, 
-    0x6c6c6174, 0x20206369, 0x616d203d, 0x69726574, 0x6d2e6c61, 0x6c617465, 0x4663696c, 0x6f746361, 0x20203b72, 
-    0x20202020, 0x202f2f20, 0x6174654d, 0x63696c6c, 0x63616620, 0x20726f74, 0x643d3028, 0x656c6569, 0x69727463, 
-    0x31202c63, 0x74656d3d, 0x0d296c61, 0x6620200a, 0x74616f6c, 0x6f722020, 0x6e686775, 0x20737365, 0x616d203d, 
-    0x69726574, 0x722e6c61, 0x6867756f, 0x7373656e, 0x74636146, 0x203b726f, 0x20202020, 0x202f2f20, 0x66727553, 
-    0x20656361, 0x67756f72, 0x73656e68, 0x30282073, 0x6f6d733d, 0x2c68746f, 0x723d3120, 0x6867756f, 0x200a0d29, 
-    0x200a0d20, 0x202f2f20, 0x706d6153, 0x6120656c, 0x6465626c, 0x6574206f, 0x72757478, 0x66692065, 0x61766120, 
-    0x62616c69, 0x0a0d656c, 0x66692020, 0x74616d28, 0x61697265, 0x61622e6c, 0x6f436573, 0x54726f6c, 0x75747865, 
-    0x6e496572, 0x20786564, 0x2930203e, 0x20200a0d, 0x200a0d7b, 0x61202020, 0x6465626c, 0x3d2a206f, 0x78657420, 
-    0x65727574, 0x616d5b73, 0x69726574, 0x622e6c61, 0x43657361, 0x726f6c6f, 0x74786554, 0x49657275, 0x7865646e, 
-    0x61532e5d, 0x656c706d, 0x6576654c, 0x6f77286c, 0x54646c72, 0x6f437865, 0x2c64726f, 0x2e293020, 0x3b7a7978, 
-    0x20200a0d, 0x0d0a0d7d, 0x2f20200a, 0x7041202f, 0x20796c70, 0x6574616d, 0x6c616972, 0x65766f20, 0x64697272, 
-    0x66207365, 0x206d6f72, 0x68737570, 0x6e6f6320, 0x6e617473, 0x28207374, 0x20726f66, 0x75626564, 0x6e696767, 
-    0x78652f67, 0x69726570, 0x746e656d, 0x6f697461, 0x0a0d296e, 0x66692020, 0x73757028, 0x6e6f4368, 0x6d2e7473, 
-    0x6c617465, 0x5263696c, 0x6867756f, 0x7373656e, 0x7265764f, 0x65646972, 0x3e20782e, 0x2e30203d, 0x0a0d2930, 
-    0x20202020, 0x6174656d, 0x63696c6c, 0x70203d20, 0x43687375, 0x74736e6f, 0x74656d2e, 0x696c6c61, 0x756f5263, 
-    0x656e6867, 0x764f7373, 0x69727265, 0x782e6564, 0x200a0d3b, 0x28666920, 0x68737570, 0x736e6f43, 0x656d2e74, 
-    0x6c6c6174, 0x6f526369, 0x6e686775, 0x4f737365, 0x72726576, 0x2e656469, 0x3d3e2079, 0x302e3020, 0x200a0d29, 
-    0x72202020, 0x6867756f, 0x7373656e, 0x70203d20, 0x43687375, 0x74736e6f, 0x74656d2e, 0x696c6c61, 0x756f5263, 
-    0x656e6867, 0x764f7373, 0x69727265, 0x792e6564, 0x0d0a0d3b, 0x2f20200a, 0x7250202f, 0x7365636f, 0x696c2073, 
-    0x20746867, 0x68746977, 0x796b7320, 0x65766f20, 0x64697272, 0x6e612065, 0x69642064, 0x6e617473, 0x61206563, 
-    0x6e657474, 0x69746175, 0x0a0d6e6f, 0x6c472020, 0x75506674, 0x7574636e, 0x6c206c61, 0x74686769, 0x70203d20, 
-    0x65636f72, 0x694c7373, 0x28746867, 0x6e656373, 0x666e4965, 0x77202c6f, 0x646c726f, 0x29736f50, 0x0d0a0d3b, 
-    0x2f20200a, 0x6143202f, 0x6c75636c, 0x20657461, 0x6867696c, 0x676e6974, 0x63657620, 0x73726f74, 0x20200a0d, 
-    0x616f6c66, 0x4e203374, 0x6e203d20, 0x616d726f, 0x657a696c, 0x726f7728, 0x6f4e646c, 0x6c616d72, 0x20203b29, 
-    0x53202f2f, 0x61667275, 0x6e206563, 0x616d726f, 0x200a0d6c, 0x6f6c6620, 0x20337461, 0x203d2056, 0x726f572d, 
-    0x6152646c, 0x72694479, 0x69746365, 0x29286e6f, 0x2020203b, 0x202f2f20, 0x77656956, 0x72696420, 0x69746365, 
-    0x28206e6f, 0x61776f74, 0x20736472, 0x656d6163, 0x0d296172, 0x6620200a, 0x74616f6c, 0x204c2033, 0x6f6e203d, 
-    0x6c616d72, 0x28657a69, 0x6867696c, 0x69642e74, 0x74636572, 0x296e6f69, 0x2f2f203b, 0x67694c20, 0x64207468, 
-    0x63657269, 0x6e6f6974, 0x0a0d0a0d, 0x2f2f2020, 0x73655420, 0x6f662074, 0x68732072, 0x776f6461, 0x79622073, 
-    0x73616320, 0x676e6974, 0x73206120, 0x6f646168, 0x61722077, 0x6f742079, 0x64726177, 0x68742073, 0x696c2065, 
-    0x0d746867, 0x6620200a, 0x74616f6c, 0x61687320, 0x46776f64, 0x6f746361, 0x203d2072, 0x74736574, 0x64616853, 
-    0x7728776f, 0x646c726f, 0x2c736f50, 0x202c4e20, 0x6867696c, 0x69642e74, 0x74636572, 0x2c6e6f69, 0x67696c20, 
-    0x3b297468, 0x0a0d0a0d, 0x2f2f2020, 0x6c614320, 0x616c7563, 0x50206574, 0x6c205242, 0x74686769, 0x20676e69, 
-    0x6e697375, 0x68742067, 0x656d2065, 0x6c6c6174, 0x722d6369, 0x6867756f, 0x7373656e, 0x646f6d20, 0x0a0d6c65, 
-    0x2f2f2020, 0x69685420, 0x6f632073, 0x7475706d, 0x74207365, 0x66206568, 0x6c616e69, 0x6c6f6320, 0x6220726f, 
-    0x64657361, 0x206e6f20, 0x6574616d, 0x6c616972, 0x6f727020, 0x74726570, 0x20736569, 0x20646e61, 0x6867696c, 
-    0x676e6974, 0x20200a0d, 0x616f6c66, 0x63203374, 0x726f6c6f, 0x70203d20, 0x654d7262, 0x6c6c6174, 0x6f526369, 
-    0x6e686775, 0x28737365, 0x65626c61, 0x202c6f64, 0x6174656d, 0x63696c6c, 0x6f72202c, 0x6e686775, 0x2c737365, 
-    0x202c4e20, 0x4c202c56, 0x0a0d3b29, 0x0a0d2020, 0x2f2f2020, 0x70704120, 0x6c20796c, 0x74686769, 0x6c6f6320, 
-    0x202c726f, 0x65746e69, 0x7469736e, 0x61202c79, 0x7320646e, 0x6f646168, 0x61662077, 0x726f7463, 0x20200a0d, 
-    0x6f6c6f63, 0x3d2a2072, 0x67696c20, 0x632e7468, 0x726f6c6f, 0x6c202a20, 0x74686769, 0x746e692e, 0x69736e65, 
-    0x2a207974, 0x61687320, 0x46776f64, 0x6f746361, 0x0a0d3b72, 0x20200a0d, 0x53202f2f, 0x74207465, 0x66206568, 
-    0x6c616e69, 0x6c6f6320, 0x6920726f, 0x6874206e, 0x61702065, 0x616f6c79, 0x200a0d64, 0x79617020, 0x64616f6c, 
-    0x6c6f632e, 0x3d20726f, 0x6c6f6320, 0x0d3b726f, 0x0a0d7d0a, 0x2f2f0a0d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0d2d2d2d, 0x202f2f0a, 0x5353494d, 0x41485320, 
-    0x20524544, 0x6143202d, 0x64656c6c, 0x65687720, 0x6172206e, 0x6f642079, 0x276e7365, 0x69682074, 0x6e612074, 
-    0x65672079, 0x74656d6f, 0x28207972, 0x6b636162, 0x756f7267, 0x732f646e, 0x0d29796b, 0x2d2f2f0a, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 
-    0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x2d2d2d2d, 0x0a0d2d2d, 0x6168735b, 
-    0x28726564, 0x73696d22, 0x5d292273, 0x6f760a0d, 0x72206469, 0x7373696d, 0x6e69614d, 0x6f6e6928, 0x48207475, 
-    0x61507469, 0x616f6c79, 0x61702064, 0x616f6c79, 0x0a0d2964, 0x200a0d7b, 0x746c4720, 0x65635366, 0x6e49656e, 
-    0x73206f66, 0x656e6563, 0x6f666e49, 0x70203d20, 0x43687375, 0x74736e6f, 0x6563732e, 0x6e49656e, 0x64416f66, 
-    0x73657264, 0x5d305b73, 0x0d0a0d3b, 0x2f20200a, 0x6843202f, 0x206b6365, 0x73206669, 0x7320796b, 0x65747379, 
-    0x7369206d, 0x616e6520, 0x64656c62, 0x20200a0d, 0x73286669, 0x656e6563, 0x6f666e49, 0x6573752e, 0x20796b53, 
-    0x31203d3d, 0x200a0d29, 0x0a0d7b20, 0x20202020, 0x45202f2f, 0x756c6176, 0x20657461, 0x636f7270, 0x72756465, 
-    0x73206c61, 0x6320796b, 0x726f6c6f, 0x73616220, 0x6f206465, 0x6172206e, 0x69642079, 0x74636572, 0x0d6e6f69, 
-    0x2020200a, 0x202f2f20, 0x73696854, 0x65726320, 0x73657461, 0x61657220, 0x7473696c, 0x73206369, 0x6720796b, 
-    0x69646172, 0x73746e65, 0x73616220, 0x6f206465, 0x7573206e, 0x6f70206e, 0x69746973, 0x61206e6f, 0x6120646e, 
-    0x736f6d74, 0x72656870, 0x73206369, 0x74746163, 0x6e697265, 0x200a0d67, 0x66202020, 0x74616f6c, 0x6b732033, 
-    0x6c6f4379, 0x3d20726f, 0x61766520, 0x6d69536c, 0x53656c70, 0x7328796b, 0x656e6563, 0x6f666e49, 0x796b732e, 
-    0x706d6953, 0x6150656c, 0x2c6d6172, 0x726f5720, 0x6152646c, 0x72694479, 0x69746365, 0x29286e6f, 0x0a0d3b29, 
-    0x20202020, 0x6c796170, 0x2e64616f, 0x6f6c6f63, 0x3d2b2072, 0x796b7320, 0x6f6c6f43, 0x202a2072, 0x6c796170, 
-    0x2e64616f, 0x67696577, 0x0d3b7468, 0x7d20200a, 0x20200a0d, 0x65736c65, 0x20200a0d, 0x200a0d7b, 0x2f202020, 
-    0x7355202f, 0x69732065, 0x656c706d, 0x6c6f7320, 0x62206469, 0x676b6361, 0x6e756f72, 0x6f632064, 0x20726f6c, 
-    0x6e656877, 0x796b7320, 0x73797320, 0x206d6574, 0x64207369, 0x62617369, 0x0d64656c, 0x2020200a, 0x79617020, 
-    0x64616f6c, 0x6c6f632e, 0x2b20726f, 0x6373203d, 0x49656e65, 0x2e6f666e, 0x6b636162, 0x756f7267, 0x6f43646e, 
-    0x20726f6c, 0x6170202a, 0x616f6c79, 0x65772e64, 0x74686769, 0x200a0d3b, 0x0a0d7d20, 0x20200a0d, 0x53202f2f, 
-    0x64207465, 0x68747065, 0x206f7420, 0x5353494d, 0x5045445f, 0x74204854, 0x6e69206f, 0x61636964, 0x74206574, 
-    0x20736968, 0x20796172, 0x20736168, 0x696e6966, 0x64656873, 0x6f6e2820, 0x726f6d20, 0x6f622065, 0x65636e75, 
-    0x0a0d2973, 0x61702020, 0x616f6c79, 0x65642e64, 0x20687470, 0x494d203d, 0x445f5353, 0x48545045, 0x7d0a0d3b, 
-    0x00000a0d, 0x001a0007, 0x0000002e, 0x575c3a46, 0x6f646e69, 0x445c7377, 0x746b7365, 0x765c706f, 0x61725f6b, 
-    0x61727479, 0x676e6963, 0x7475745f, 0x6169726f, 0x484b5f6c, 0x61725c52, 0x61727479, 0x745f6563, 0x726f7475, 
-    0x5c6c6169, 0x625f3230, 0x63697361, 0x6168735c, 0x73726564, 0x6274725c, 0x63697361, 0x616c732e, 0x0000676e, 
-    0x00030003, 0x0000000b, 0x00000001, 0x00050007, 0x0000005a, 0x6e656772, 0x6e69614d, 0x00000000, 0x00040007, 
-    0x00000060, 0x6e616c73, 0x00006367, 0x00a60007, 0x00000061, 0x7261742d, 0x20746567, 0x72697073, 0x2d202076, 
-    0x46222049, 0x69575c3a, 0x776f646e, 0x65445c73, 0x6f746b73, 0x6b765c70, 0x7961725f, 0x63617274, 0x5f676e69, 
-    0x6f747574, 0x6c616972, 0x52484b5f, 0x6975625c, 0x5f5c646c, 0x73706564, 0x616c535c, 0x772d676e, 0x6f646e69, 
-    0x782d7377, 0x365f3638, 0x30322d34, 0x312e3532, 0x5c312e33, 0x226e6962, 0x20492d20, 0x2f3a4622, 0x646e6957, 
-    0x2f73776f, 0x6b736544, 0x2f706f74, 0x7270766e, 0x6f635f6f, 0x2f326572, 0x6873766e, 0x72656461, 0x6f685f73, 
-    0x2e2f7473, 0x2d20222e, 0x46222049, 0x69572f3a, 0x776f646e, 0x65442f73, 0x6f746b73, 0x6b762f70, 0x7961725f, 
-    0x63617274, 0x5f676e69, 0x6f747574, 0x6c616972, 0x52484b5f, 0x492d2022, 0x3a462220, 0x6e69572f, 0x73776f64, 
-    0x7365442f, 0x706f746b, 0x5f6b762f, 0x74796172, 0x69636172, 0x745f676e, 0x726f7475, 0x5f6c6169, 0x2f52484b, 
-    0x74796172, 0x65636172, 0x7475745f, 0x6169726f, 0x2d20226c, 0x46222049, 0x69572f3a, 0x776f646e, 0x65442f73, 
-    0x6f746b73, 0x6b762f70, 0x7961725f, 0x63617274, 0x5f676e69, 0x6f747574, 0x6c616972, 0x52484b5f, 0x7961722f, 
-    0x63617274, 0x75745f65, 0x69726f74, 0x302f6c61, 0x61625f32, 0x2f636973, 0x64616873, 0x22737265, 0x76662d20, 
-    0x73752d6b, 0x6e652d65, 0x70797274, 0x746e696f, 0x6d616e2d, 0x4f2d2065, 0x6d2d2030, 0x69727461, 0x616c2d78, 
-    0x74756f79, 0x776f722d, 0x6a616d2d, 0x2d20726f, 0x61706163, 0x696c6962, 0x73207974, 0x76726970, 0x365f315f, 
-    0x7670732b, 0x36746e49, 0x6f744134, 0x7363696d, 0x7670732b, 0x64616853, 0x6e497265, 0x61636f76, 0x6e6f6974, 
-    0x726f6552, 0x4e726564, 0x70732b56, 0x61685376, 0x43726564, 0x6b636f6c, 0x2b52484b, 0x52767073, 0x72547961, 
-    0x6e696361, 0x746f4d67, 0x426e6f69, 0x4e72756c, 0x70732b56, 0x79615276, 0x72657551, 0x52484b79, 0x5650532b, 
-    0x52484b5f, 0x6d6f635f, 0x65747570, 0x6168735f, 0x5f726564, 0x69726564, 0x69746176, 0x20736576, 0x726f662d, 
-    0x672d6563, 0x2d6c736c, 0x6c616373, 0x6c2d7261, 0x756f7961, 0x732d2074, 0x65676174, 0x79617220, 0x656e6567, 
-    0x69746172, 0x2d206e6f, 0x72746e65, 0x67722079, 0x614d6e65, 0x2d206e69, 0x00003267, 0x00040007, 0x00000069, 
-    0x616f6c66, 0x00000074, 0x00050007, 0x0000006f, 0x6e75616c, 0x44496863, 0x00000000, 0x00050007, 0x0000007e, 
-    0x6e75616c, 0x69536863, 0x0000657a, 0x00060007, 0x0000008c, 0x77656976, 0x6a6f7250, 0x7274614d, 0x00007869, 
-    0x00060007, 0x00000091, 0x6a6f7270, 0x4d766e49, 0x69727461, 0x00000078, 0x00060007, 0x00000093, 0x77656976, 
-    0x4d766e49, 0x69727461, 0x00000078, 0x00060007, 0x00000097, 0x656d6163, 0x6f506172, 0x69746973, 0x00006e6f, 
-    0x00030007, 0x0000009b, 0x00746e69, 0x00040007, 0x0000009d, 0x53657375, 0x0000796b, 0x00060007, 0x000000a0, 
-    0x6b636162, 0x756f7267, 0x6f43646e, 0x00726f6c, 0x00050007, 0x000000a3, 0x4c6d756e, 0x74686769, 0x00000073, 
-    0x00040007, 0x000000a7, 0x61746164, 0x00000000, 0x000a0007, 0x000000a9, 0x74614d5f, 0x53786972, 0x61726f74, 
-    0x665f6567, 0x74616f6c, 0x6e347834, 0x72757461, 0x00006c61, 0x00050007, 0x000000ac, 0x6e617274, 0x726f6673, 
-    0x0000006d, 0x00040007, 0x000000ae, 0x746e6975, 0x00000000, 0x00060007, 0x000000b0, 0x6574616d, 0x6c616972, 
-    0x65646e49, 0x00000078, 0x00050007, 0x000000b2, 0x6873656d, 0x65646e49, 0x00000078, 0x00080007, 0x000000b5, 
-    0x66746c47, 0x74736e49, 0x65636e61, 0x74616e5f, 0x6c617275, 0x00000000, 0x00050007, 0x000000ba, 0x74736e69, 
-    0x65636e61, 0x00000073, 0x00040007, 0x000000be, 0x746e6975, 0x00000038, 0x00050007, 0x000000c1, 0x66746c67, 
-    0x66667542, 0x00007265, 0x00040007, 0x000000c3, 0x7366666f, 0x00007465, 0x00040007, 0x000000c5, 0x6e756f63, 
-    0x00000074, 0x00050007, 0x000000c7, 0x65747962, 0x69727453, 0x00006564, 0x00070007, 0x000000c9, 0x66667542, 
-    0x69567265, 0x6e5f7765, 0x72757461, 0x00006c61, 0x00040007, 0x000000cb, 0x69646e69, 0x00736563, 0x00050007, 
-    0x000000cd, 0x69736f70, 0x6e6f6974, 0x00000073, 0x00040007, 0x000000cf, 0x6d726f6e, 0x00736c61, 0x00050007, 
-    0x000000d1, 0x6f6c6f63, 0x72655672, 0x00000074, 0x00050007, 0x000000d4, 0x43786574, 0x64726f6f, 0x00000073, 
-    0x00050007, 0x000000d7, 0x676e6174, 0x73746e65, 0x00000000, 0x00080007, 0x000000da, 0x61697254, 0x656c676e, 
-    0x6873654d, 0x74616e5f, 0x6c617275, 0x00000000, 0x00040007, 0x000000dc, 0x4d697274, 0x00687365, 0x00050007, 
-    0x000000de, 0x65646e69, 0x70795478, 0x00000065, 0x00070007, 0x000000e1, 0x66746c47, 0x6873654d, 0x74616e5f, 
-    0x6c617275, 0x00000000, 0x00040007, 0x000000e5, 0x6873656d, 0x00007365, 0x00060007, 0x000000e8, 0x65736162, 
-    0x6f6c6f43, 0x63614672, 0x00726f74, 0x00060007, 0x000000eb, 0x6174656d, 0x63696c6c, 0x74636146, 0x0000726f, 
-    0x00060007, 0x000000ed, 0x67756f72, 0x73656e68, 0x63614673, 0x00726f74, 0x00080007, 0x000000f0, 0x65736162, 
-    0x6f6c6f43, 0x78655472, 0x65727574, 0x65646e49, 0x00000078, 0x000a0007, 0x000000f2, 0x66746c47, 0x6174654d, 
-    0x63696c6c, 0x67756f52, 0x73656e68, 0x616e5f73, 0x61727574, 0x0000006c, 0x00050007, 0x000000f6, 0x6574616d, 
-    0x6c616972, 0x00000073, 0x00050007, 0x000000f9, 0x69736f70, 0x6e6f6974, 0x00000000, 0x00050007, 0x000000fc, 
-    0x65746e69, 0x7469736e, 0x00000079, 0x00050007, 0x000000fe, 0x65726964, 0x6f697463, 0x0000006e, 0x00040007, 
-    0x00000100, 0x65707974, 0x00000000, 0x00040007, 0x00000102, 0x6f6c6f63, 0x00000072, 0x00050007, 0x00000105, 
-    0x656e6f63, 0x6c676e41, 0x00000065, 0x00060007, 0x00000108, 0x66746c47, 0x636e7550, 0x6c617574, 0x00000000, 
-    0x00060007, 0x0000010b, 0x636e7570, 0x6c617574, 0x6867694c, 0x00007374, 0x00060007, 0x0000010f, 0x446e7573, 
-    0x63657269, 0x6e6f6974, 0x00000000, 0x00070007, 0x00000112, 0x75676e61, 0x5372616c, 0x4f657a69, 0x67694c66, 
-    0x00007468, 0x00050007, 0x00000114, 0x436e7573, 0x726f6c6f, 0x00000000, 0x00050007, 0x00000116, 0x776f6c67, 
-    0x657a6953, 0x00000000, 0x00050007, 0x00000118, 0x43796b73, 0x726f6c6f, 0x00000000, 0x00060007, 0x0000011a, 
-    0x776f6c67, 0x65746e49, 0x7469736e, 0x00000079, 0x00060007, 0x0000011c, 0x69726f68, 0x436e6f7a, 0x726f6c6f, 
-    0x00000000, 0x00050007, 0x0000011e, 0x69726f68, 0x536e6f7a, 0x00657a69, 0x00050007, 0x00000120, 0x756f7267, 
-    0x6f43646e, 0x00726f6c, 0x00060007, 0x00000122, 0x776f6c67, 0x72616853, 0x73656e70, 0x00000073, 0x00050007, 
-    0x00000125, 0x65726964, 0x6f697463, 0x0070556e, 0x00060007, 0x00000127, 0x496e7573, 0x6e65746e, 0x79746973, 
-    0x00000000, 0x00060007, 0x0000012a, 0x6867696c, 0x64615274, 0x636e6169, 0x00000065, 0x00050007, 0x0000012c, 
-    0x67697262, 0x656e7468, 0x00007373, 0x00070007, 0x0000012f, 0x53796b53, 0x6c706d69, 0x72615065, 0x74656d61, 
-    0x00737265, 0x00060007, 0x00000132, 0x53796b73, 0x6c706d69, 0x72615065, 0x00006d61, 0x00060007, 0x00000135, 
-    0x66746c47, 0x6e656353, 0x666e4965, 0x0000006f, 0x00050007, 0x00000138, 0x6e656373, 0x666e4965, 0x0000006f, 
-    0x000a0007, 0x00000146, 0x74614d5f, 0x53786972, 0x61726f74, 0x665f6567, 0x74616f6c, 0x6e337833, 0x72757461, 
-    0x00006c61, 0x00060007, 0x00000148, 0x6d726f6e, 0x614d6c61, 0x78697274, 0x00000000, 0x00060007, 0x0000014a, 
-    0x74736e69, 0x65636e61, 0x65646e49, 0x00000078, 0x00080007, 0x0000015c, 0x66746c47, 0x636e7550, 0x6c617574, 
-    0x74616e5f, 0x6c617275, 0x00000000, 0x000a0007, 0x00000160, 0x7272415f, 0x6e5f7961, 0x72757461, 0x475f6c61, 
-    0x5066746c, 0x74636e75, 0x326c6175, 0x00000000, 0x00090007, 0x00000171, 0x53796b53, 0x6c706d69, 0x72615065, 
-    0x74656d61, 0x5f737265, 0x7574616e, 0x006c6172, 0x00080007, 0x00000174, 0x66746c47, 0x6e656353, 0x666e4965, 
-    0x616e5f6f, 0x61727574, 0x0000006c, 0x00070007, 0x00000177, 0x6e656373, 0x666e4965, 0x6464416f, 0x73736572, 
-    0x00000000, 0x00090007, 0x0000017a, 0x6174656d, 0x63696c6c, 0x67756f52, 0x73656e68, 0x65764f73, 0x64697272, 
-    0x00000065, 0x00090007, 0x0000017c, 0x6f747554, 0x68737550, 0x736e6f43, 0x746e6174, 0x74616e5f, 0x6c617275, 
-    0x00000000, 0x00050007, 0x0000017f, 0x68737570, 0x736e6f43, 0x00000074, 0x00050007, 0x00000247, 0x46796172, 
-    0x7367616c, 0x00000000, 0x00050007, 0x0000024e, 0x70696c63, 0x726f6f43, 0x00007364, 0x00050007, 0x0000025a, 
-    0x77656976, 0x726f6f43, 0x00007364, 0x00040007, 0x00000262, 0x6769724f, 0x00006e69, 0x00040007, 0x00000264, 
-    0x6e694d54, 0x00000000, 0x00050007, 0x00000266, 0x65726944, 0x6f697463, 0x0000006e, 0x00040007, 0x00000268, 
-    0x78614d54, 0x00000000, 0x00040007, 0x0000026a, 0x44796152, 0x00637365, 0x00030007, 0x0000026c, 0x00796172, 
-    0x00040007, 0x00000298, 0x67696577, 0x00007468, 0x00040007, 0x0000029a, 0x74706564, 0x00000068, 0x00050007, 
-    0x0000029c, 0x50746948, 0x6f6c7961, 0x00006461, 0x00040007, 0x0000029e, 0x6c796170, 0x0064616f, 0x00030007, 
-    0x000002bc, 0x00000070, 0x00040007, 0x000002c7, 0x6d616e75, 0x00006465, 0x00050007, 0x000002c9, 0x4c706f74, 
-    0x6c657665, 0x00005341, 0x00050007, 0x000002e2, 0x4974756f, 0x6567616d, 0x00000000, 0x00050007, 0x00000312, 
-    0x69686372, 0x69614d74, 0x0000006e, 0x00a60007, 0x00000329, 0x7261742d, 0x20746567, 0x72697073, 0x2d202076, 
-    0x46222049, 0x69575c3a, 0x776f646e, 0x65445c73, 0x6f746b73, 0x6b765c70, 0x7961725f, 0x63617274, 0x5f676e69, 
-    0x6f747574, 0x6c616972, 0x52484b5f, 0x6975625c, 0x5f5c646c, 0x73706564, 0x616c535c, 0x772d676e, 0x6f646e69, 
-    0x782d7377, 0x365f3638, 0x30322d34, 0x312e3532, 0x5c312e33, 0x226e6962, 0x20492d20, 0x2f3a4622, 0x646e6957, 
-    0x2f73776f, 0x6b736544, 0x2f706f74, 0x7270766e, 0x6f635f6f, 0x2f326572, 0x6873766e, 0x72656461, 0x6f685f73, 
-    0x2e2f7473, 0x2d20222e, 0x46222049, 0x69572f3a, 0x776f646e, 0x65442f73, 0x6f746b73, 0x6b762f70, 0x7961725f, 
-    0x63617274, 0x5f676e69, 0x6f747574, 0x6c616972, 0x52484b5f, 0x492d2022, 0x3a462220, 0x6e69572f, 0x73776f64, 
-    0x7365442f, 0x706f746b, 0x5f6b762f, 0x74796172, 0x69636172, 0x745f676e, 0x726f7475, 0x5f6c6169, 0x2f52484b, 
-    0x74796172, 0x65636172, 0x7475745f, 0x6169726f, 0x2d20226c, 0x46222049, 0x69572f3a, 0x776f646e, 0x65442f73, 
-    0x6f746b73, 0x6b762f70, 0x7961725f, 0x63617274, 0x5f676e69, 0x6f747574, 0x6c616972, 0x52484b5f, 0x7961722f, 
-    0x63617274, 0x75745f65, 0x69726f74, 0x302f6c61, 0x61625f32, 0x2f636973, 0x64616873, 0x22737265, 0x76662d20, 
-    0x73752d6b, 0x6e652d65, 0x70797274, 0x746e696f, 0x6d616e2d, 0x4f2d2065, 0x6d2d2030, 0x69727461, 0x616c2d78, 
-    0x74756f79, 0x776f722d, 0x6a616d2d, 0x2d20726f, 0x61706163, 0x696c6962, 0x73207974, 0x76726970, 0x365f315f, 
-    0x7670732b, 0x36746e49, 0x6f744134, 0x7363696d, 0x7670732b, 0x64616853, 0x6e497265, 0x61636f76, 0x6e6f6974, 
-    0x726f6552, 0x4e726564, 0x70732b56, 0x61685376, 0x43726564, 0x6b636f6c, 0x2b52484b, 0x52767073, 0x72547961, 
-    0x6e696361, 0x746f4d67, 0x426e6f69, 0x4e72756c, 0x70732b56, 0x79615276, 0x72657551, 0x52484b79, 0x5650532b, 
-    0x52484b5f, 0x6d6f635f, 0x65747570, 0x6168735f, 0x5f726564, 0x69726564, 0x69746176, 0x20736576, 0x726f662d, 
-    0x672d6563, 0x2d6c736c, 0x6c616373, 0x6c2d7261, 0x756f7961, 0x732d2074, 0x65676174, 0x6f6c6320, 0x74736573, 
-    0x20746968, 0x746e652d, 0x72207972, 0x74696863, 0x6e69614d, 0x32672d20, 0x00000000, 0x00060007, 0x00000336, 
-    0x79726162, 0x746e6563, 0x73636972, 0x00000000, 0x000c0007, 0x00000338, 0x6c697542, 0x546e4974, 0x6e616972, 
-    0x49656c67, 0x7265746e, 0x74636573, 0x416e6f69, 0x69727474, 0x65747562, 0x00000073, 0x00050007, 0x0000034a, 
-    0x74736e69, 0x65636e61, 0x00004449, 0x00040007, 0x00000353, 0x6873656d, 0x00004449, 0x00040007, 0x0000035b, 
-    0x49697274, 0x00000044, 0x00060007, 0x00000410, 0x66746c47, 0x74736e49, 0x65636e61, 0x00000000, 0x00050007, 
-    0x00000412, 0x74736e69, 0x65636e61, 0x00000000, 0x00050007, 0x00000441, 0x66667542, 0x69567265, 0x00007765, 
-    0x00060007, 0x0000044a, 0x61697254, 0x656c676e, 0x6873654d, 0x00000000, 0x00050007, 0x0000044e, 0x66746c47, 
-    0x6873654d, 0x00000000, 0x00040007, 0x00000450, 0x6873656d, 0x00000000, 0x00080007, 0x00000498, 0x66746c47, 
-    0x6174654d, 0x63696c6c, 0x67756f52, 0x73656e68, 0x00000073, 0x00050007, 0x0000049a, 0x6574616d, 0x6c616972, 
-    0x00000000, 0x00070007, 0x000004c4, 0x54746567, 0x6e616972, 0x49656c67, 0x6369646e, 0x00007365, 0x00050007, 
-    0x000004d3, 0x6d697270, 0x76697469, 0x00444965, 0x00070007, 0x000004da, 0x61746164, 0x66667542, 0x64417265, 
-    0x73657264, 0x00000073, 0x00040007, 0x0000050e, 0x31746e69, 0x00000036, 0x00030007, 0x00000524, 0x00736f70, 
-    0x00080007, 0x0000053a, 0x54746567, 0x6e616972, 0x41656c67, 0x69727474, 0x65747562, 0x00000000, 0x00060007, 
-    0x00000543, 0x72747461, 0x74756269, 0x646e4965, 0x00007865, 0x00050007, 0x00000547, 0x66667562, 0x69567265, 
-    0x00007765, 0x00040007, 0x00000552, 0x72747461, 0x00000030, 0x00060007, 0x00000563, 0x41746567, 0x69727474, 
-    0x65747562, 0x00000000, 0x00030007, 0x00000587, 0x00727470, 0x00040007, 0x0000059e, 0x72747461, 0x00000031, 
-    0x00040007, 0x000005a5, 0x72747461, 0x00000032, 0x00030007, 0x000005bb, 0x006d726e, 0x00060007, 0x000005c1, 
-    0x6c726f77, 0x78655464, 0x726f6f43, 0x00000064, 0x00050007, 0x00000644, 0x6c726f77, 0x736f5064, 0x00000000, 
-    0x00050007, 0x00000650, 0x6c726f77, 0x726f4e64, 0x006c616d, 0x00040007, 0x0000065b, 0x65626c61, 0x00006f64, 
-    0x00050007, 0x00000662, 0x6174656d, 0x63696c6c, 0x00000000, 0x00050007, 0x00000668, 0x67756f72, 0x73656e68, 
-    0x00000073, 0x00050007, 0x0000067e, 0x74786574, 0x73657275, 0x00000000, 0x00040007, 0x000006ac, 0x6867696c, 
-    0x00000074, 0x00060007, 0x000006bf, 0x636f7270, 0x4c737365, 0x74686769, 0x00000000, 0x00050007, 0x0000071a, 
-    0x6867696c, 0x72694474, 0x00000000, 0x00030007, 0x00000724, 0x00000064, 0x00040007, 0x00000734, 0x74656874, 
-    0x00000061, 0x00060007, 0x0000073f, 0x746f7073, 0x65746e49, 0x7469736e, 0x00000079, 0x00030007, 0x0000077c, 
-    0x0000004e, 0x00030007, 0x00000783, 0x00000056, 0x00030007, 0x0000078d, 0x0000004c, 0x00060007, 0x00000795, 
-    0x64616873, 0x6146776f, 0x726f7463, 0x00000000, 0x00050007, 0x000007aa, 0x74736574, 0x64616853, 0x0000776f, 
-    0x00060007, 0x000007be, 0x6867696c, 0x72694474, 0x69746365, 0x00006e6f, 0x00050007, 0x000007cc, 0x64616873, 
-    0x6152776f, 0x00000079, 0x00060007, 0x000007f6, 0x64616873, 0x6150776f, 0x616f6c79, 0x00000064, 0x00080007, 
-    0x0000083c, 0x4d726270, 0x6c617465, 0x5263696c, 0x6867756f, 0x7373656e, 0x00000000, 0x00030007, 0x00000857, 
-    0x0000316b, 0x00030007, 0x0000085a, 0x0000326b, 0x00030007, 0x0000085c, 0x00006978, 0x00060007, 0x0000085e, 
-    0x66647362, 0x6669645f, 0x65737566, 0x00000000, 0x00050007, 0x00000860, 0x66647362, 0x6f6c675f, 0x00797373, 
-    0x00030007, 0x00000862, 0x00666470, 0x00070007, 0x00000864, 0x66647342, 0x6c617645, 0x65746175, 0x61746144, 
-    0x00000000, 0x00050007, 0x0000087d, 0x65736162, 0x6f6c6f43, 0x00000072, 0x00040007, 0x0000087f, 0x6361706f, 
-    0x00797469, 0x00050007, 0x00000883, 0x73696d65, 0x65766973, 0x00000000, 0x00050007, 0x00000885, 0x6c63636f, 
-    0x6f697375, 0x0000006e, 0x00040007, 0x00000887, 0x31726f69, 0x00000000, 0x00040007, 0x00000889, 0x32726f69, 
-    0x00000000, 0x00030007, 0x0000088d, 0x0000674e, 0x00030007, 0x0000088f, 0x00000054, 0x00030007, 0x00000891, 
-    0x00000042, 0x00060007, 0x00000894, 0x42726250, 0x4d657361, 0x72657461, 0x006c6169, 0x00030007, 0x00000897, 
-    0x0074616d, 0x00070007, 0x000008c7, 0x6874726f, 0x726f6e6f, 0x426c616d, 0x73697361, 0x00000000, 0x00050007, 
-    0x000008d0, 0x61746962, 0x6e65676e, 0x00000074, 0x00040007, 0x000008d3, 0x676e6174, 0x00746e65, 0x00040007, 
-    0x000008d6, 0x6d726f6e, 0x00006c61, 0x00030007, 0x000008e4, 0x00000061, 0x00030007, 0x000008ec, 0x00000062, 
-    0x00070007, 0x0000093e, 0x66647362, 0x6c617645, 0x65746175, 0x706d6953, 0x0000656c, 0x00030007, 0x00000963, 
-    0x00000048, 0x00040007, 0x0000096f, 0x746f644e, 0x00000056, 0x00050007, 0x0000097d, 0x6d616c63, 0x44646570, 
-    0x0000746f, 0x00030007, 0x00000981, 0x00000079, 0x00030007, 0x00000985, 0x00000078, 0x00040007, 0x00000991, 
-    0x746f644e, 0x0000004c, 0x00040007, 0x00000998, 0x746f6456, 0x00000048, 0x00040007, 0x0000099f, 0x746f644e, 
-    0x00000048, 0x00070007, 0x000009c4, 0x696d5f63, 0x65725f6e, 0x63656c66, 0x636e6174, 0x00000065, 0x00030007, 
-    0x000009ca, 0x00003066, 0x00040007, 0x000009d5, 0x6f6c4766, 0x00797373, 0x00060007, 0x000009e3, 0x6c686373, 
-    0x466b6369, 0x6e736572, 0x00006c65, 0x00030007, 0x000009eb, 0x00303946, 0x00030007, 0x000009ef, 0x00003046, 
-    0x00050007, 0x00000a00, 0x66694466, 0x65737566, 0x00000000, 0x00040007, 0x00000a28, 0x61636f6c, 0x0000486c, 
-    0x00060007, 0x00000a44, 0x5f647668, 0x5f786767, 0x6c617665, 0x00000000, 0x00030007, 0x00000a49, 0x00000068, 
-    0x00060007, 0x00000a4d, 0x52766e69, 0x6867756f, 0x7373656e, 0x00000000, 0x00040007, 0x00000a64, 0x73696e61, 
-    0x0000006f, 0x00030007, 0x00000a6d, 0x00000066, 0x00040007, 0x00000a7f, 0x61636f6c, 0x00314b6c, 0x00040007, 
-    0x00000a8a, 0x61636f6c, 0x00324b6c, 0x00030007, 0x00000a94, 0x00003147, 0x00030007, 0x00000a99, 0x00003247, 
-    0x00080007, 0x00000aaf, 0x5f786767, 0x74696d73, 0x68735f68, 0x776f6461, 0x73616d5f, 0x0000006b, 0x00080007, 
-    0x00000ad1, 0x74696d73, 0x68735f68, 0x776f6461, 0x5f726f5f, 0x6b73616d, 0x00000000, 0x00030007, 0x00000add, 
-    0x0000006b, 0x00030007, 0x00000ae4, 0x00327a6b, 0x00030007, 0x00000af0, 0x00007861, 0x00030007, 0x00000af9, 
-    0x00007961, 0x00040007, 0x00000b02, 0x5f766e69, 0x00003261, 0x00050007, 0x00000b23, 0x66666964, 0x50657375, 
-    0x00006664, 0x00050007, 0x00000b29, 0x63657073, 0x72616c75, 0x00666450, 0x00090007, 0x00000b3f, 0x66647362, 
-    0x706d6953, 0x6c47656c, 0x7973736f, 0x626f7250, 0x6c696261, 0x00797469, 0x00050007, 0x00000bb3, 0x73696d72, 
-    0x69614d73, 0x0000006e, 0x00a40007, 0x00000bbe, 0x7261742d, 0x20746567, 0x72697073, 0x2d202076, 0x46222049, 
-    0x69575c3a, 0x776f646e, 0x65445c73, 0x6f746b73, 0x6b765c70, 0x7961725f, 0x63617274, 0x5f676e69, 0x6f747574, 
-    0x6c616972, 0x52484b5f, 0x6975625c, 0x5f5c646c, 0x73706564, 0x616c535c, 0x772d676e, 0x6f646e69, 0x782d7377, 
-    0x365f3638, 0x30322d34, 0x312e3532, 0x5c312e33, 0x226e6962, 0x20492d20, 0x2f3a4622, 0x646e6957, 0x2f73776f, 
-    0x6b736544, 0x2f706f74, 0x7270766e, 0x6f635f6f, 0x2f326572, 0x6873766e, 0x72656461, 0x6f685f73, 0x2e2f7473, 
-    0x2d20222e, 0x46222049, 0x69572f3a, 0x776f646e, 0x65442f73, 0x6f746b73, 0x6b762f70, 0x7961725f, 0x63617274, 
-    0x5f676e69, 0x6f747574, 0x6c616972, 0x52484b5f, 0x492d2022, 0x3a462220, 0x6e69572f, 0x73776f64, 0x7365442f, 
-    0x706f746b, 0x5f6b762f, 0x74796172, 0x69636172, 0x745f676e, 0x726f7475, 0x5f6c6169, 0x2f52484b, 0x74796172, 
-    0x65636172, 0x7475745f, 0x6169726f, 0x2d20226c, 0x46222049, 0x69572f3a, 0x776f646e, 0x65442f73, 0x6f746b73, 
-    0x6b762f70, 0x7961725f, 0x63617274, 0x5f676e69, 0x6f747574, 0x6c616972, 0x52484b5f, 0x7961722f, 0x63617274, 
-    0x75745f65, 0x69726f74, 0x302f6c61, 0x61625f32, 0x2f636973, 0x64616873, 0x22737265, 0x76662d20, 0x73752d6b, 
-    0x6e652d65, 0x70797274, 0x746e696f, 0x6d616e2d, 0x4f2d2065, 0x6d2d2030, 0x69727461, 0x616c2d78, 0x74756f79, 
-    0x776f722d, 0x6a616d2d, 0x2d20726f, 0x61706163, 0x696c6962, 0x73207974, 0x76726970, 0x365f315f, 0x7670732b, 
-    0x36746e49, 0x6f744134, 0x7363696d, 0x7670732b, 0x64616853, 0x6e497265, 0x61636f76, 0x6e6f6974, 0x726f6552, 
-    0x4e726564, 0x70732b56, 0x61685376, 0x43726564, 0x6b636f6c, 0x2b52484b, 0x52767073, 0x72547961, 0x6e696361, 
-    0x746f4d67, 0x426e6f69, 0x4e72756c, 0x70732b56, 0x79615276, 0x72657551, 0x52484b79, 0x5650532b, 0x52484b5f, 
-    0x6d6f635f, 0x65747570, 0x6168735f, 0x5f726564, 0x69726564, 0x69746176, 0x20736576, 0x726f662d, 0x672d6563, 
-    0x2d6c736c, 0x6c616373, 0x6c2d7261, 0x756f7961, 0x732d2074, 0x65676174, 0x73696d20, 0x652d2073, 0x7972746e, 
-    0x696d7220, 0x614d7373, 0x2d206e69, 0x00003267, 0x00060007, 0x00000ca0, 0x6c617665, 0x706d6953, 0x6b53656c, 
-    0x00000079, 0x00040007, 0x00000ca7, 0x61726170, 0x0000736d, 0x00050007, 0x00000cc2, 0x76656c65, 0x6f697461, 
-    0x0000006e, 0x00030007, 0x00000ccb, 0x00706f74, 0x00040007, 0x00000cd3, 0x74746f62, 0x00006d6f, 0x00050007, 
-    0x00000cdb, 0x69766e65, 0x6d6e6f72, 0x00746e65, 0x00060007, 0x00000ce5, 0x6c676e61, 0x4c6f5465, 0x74686769, 
-    0x00000000, 0x00060007, 0x00000cee, 0x666c6168, 0x75676e41, 0x5372616c, 0x00657a69, 0x00050007, 0x00000cf6, 
-    0x776f6c67, 0x75706e49, 0x00000074, 0x00050007, 0x00000d0b, 0x4c6e7573, 0x74686769, 0x00000000, 0x00060005, 
-    0x00000043, 0x66746c47, 0x636e7550, 0x6c617574, 0x00000000, 0x00060006, 0x00000043, 0x00000000, 0x69736f70, 
-    0x6e6f6974, 0x00000000, 0x00060006, 0x00000043, 0x00000001, 0x65746e69, 0x7469736e, 0x00000079, 0x00060006, 
-    0x00000043, 0x00000002, 0x65726964, 0x6f697463, 0x0000006e, 0x00050006, 0x00000043, 0x00000003, 0x65707974, 
-    0x00000000, 0x00050006, 0x00000043, 0x00000004, 0x6f6c6f63, 0x00000072, 0x00060006, 0x00000043, 0x00000005, 
-    0x656e6f63, 0x6c676e41, 0x00000065, 0x00070005, 0x00000045, 0x53796b53, 0x6c706d69, 0x72615065, 0x74656d61, 
-    0x00737265, 0x00070006, 0x00000045, 0x00000000, 0x446e7573, 0x63657269, 0x6e6f6974, 0x00000000, 0x00080006, 
-    0x00000045, 0x00000001, 0x75676e61, 0x5372616c, 0x4f657a69, 0x67694c66, 0x00007468, 0x00060006, 0x00000045, 
-    0x00000002, 0x436e7573, 0x726f6c6f, 0x00000000, 0x00060006, 0x00000045, 0x00000003, 0x776f6c67, 0x657a6953, 
-    0x00000000, 0x00060006, 0x00000045, 0x00000004, 0x43796b73, 0x726f6c6f, 0x00000000, 0x00070006, 0x00000045, 
-    0x00000005, 0x776f6c67, 0x65746e49, 0x7469736e, 0x00000079, 0x00070006, 0x00000045, 0x00000006, 0x69726f68, 
-    0x436e6f7a, 0x726f6c6f, 0x00000000, 0x00060006, 0x00000045, 0x00000007, 0x69726f68, 0x536e6f7a, 0x00657a69, 
-    0x00060006, 0x00000045, 0x00000008, 0x756f7267, 0x6f43646e, 0x00726f6c, 0x00070006, 0x00000045, 0x00000009, 
-    0x776f6c67, 0x72616853, 0x73656e70, 0x00000073, 0x00060006, 0x00000045, 0x0000000a, 0x65726964, 0x6f697463, 
-    0x0070556e, 0x00070006, 0x00000045, 0x0000000b, 0x496e7573, 0x6e65746e, 0x79746973, 0x00000000, 0x00070006, 
-    0x00000045, 0x0000000c, 0x6867696c, 0x64615274, 0x636e6169, 0x00000065, 0x00060006, 0x00000045, 0x0000000d, 
-    0x67697262, 0x656e7468, 0x00007373, 0x00060005, 0x00000037, 0x66746c47, 0x6e656353, 0x666e4965, 0x0000006f, 
-    0x00070006, 0x00000037, 0x00000000, 0x77656976, 0x6a6f7250, 0x7274614d, 0x00007869, 0x00070006, 0x00000037, 
-    0x00000001, 0x6a6f7270, 0x4d766e49, 0x69727461, 0x00000078, 0x00070006, 0x00000037, 0x00000002, 0x77656976, 
-    0x4d766e49, 0x69727461, 0x00000078, 0x00070006, 0x00000037, 0x00000003, 0x656d6163, 0x6f506172, 0x69746973, 
-    0x00006e6f, 0x00050006, 0x00000037, 0x00000004, 0x53657375, 0x0000796b, 0x00070006, 0x00000037, 0x00000005, 
-    0x6b636162, 0x756f7267, 0x6f43646e, 0x00726f6c, 0x00060006, 0x00000037, 0x00000006, 0x4c6d756e, 0x74686769, 
-    0x00000073, 0x00060006, 0x00000037, 0x00000007, 0x74736e69, 0x65636e61, 0x00000073, 0x00050006, 0x00000037, 
-    0x00000008, 0x6873656d, 0x00007365, 0x00060006, 0x00000037, 0x00000009, 0x6574616d, 0x6c616972, 0x00000073, 
-    0x00070006, 0x00000037, 0x0000000a, 0x636e7570, 0x6c617574, 0x6867694c, 0x00007374, 0x00070006, 0x00000037, 
-    0x0000000b, 0x53796b73, 0x6c706d69, 0x72615065, 0x00006d61, 0x00040005, 0x0000004d, 0x44796152, 0x00637365, 
-    0x00050006, 0x0000004d, 0x00000000, 0x6769724f, 0x00006e69, 0x00050006, 0x0000004d, 0x00000001, 0x6e694d54, 
-    0x00000000, 0x00060006, 0x0000004d, 0x00000002, 0x65726944, 0x6f697463, 0x0000006e, 0x00050006, 0x0000004d, 
-    0x00000003, 0x78614d54, 0x00000000, 0x00030005, 0x00000050, 0x00796172, 0x00030005, 0x00000050, 0x00796172, 
-    0x00050005, 0x00000051, 0x50746948, 0x6f6c7961, 0x00006461, 0x00050006, 0x00000051, 0x00000000, 0x6f6c6f63, 
-    0x00000072, 0x00050006, 0x00000051, 0x00000001, 0x67696577, 0x00007468, 0x00050006, 0x00000051, 0x00000002, 
-    0x74706564, 0x00000068, 0x00040005, 0x00000054, 0x6c796170, 0x0064616f, 0x00040005, 0x00000054, 0x6c796170, 
-    0x0064616f, 0x00050005, 0x0000006e, 0x6e75616c, 0x44496863, 0x00000000, 0x00050005, 0x0000007d, 0x6e75616c, 
-    0x69536863, 0x0000657a, 0x00050005, 0x00000137, 0x6e656373, 0x666e4965, 0x0000006f, 0x000a0005, 0x0000013c, 
-    0x74614d5f, 0x53786972, 0x61726f74, 0x665f6567, 0x74616f6c, 0x6e337833, 0x72757461, 0x00006c61, 0x00050006, 
-    0x0000013c, 0x00000000, 0x61746164, 0x00000000, 0x00090005, 0x0000013b, 0x6f747554, 0x68737550, 0x736e6f43, 
-    0x746e6174, 0x74616e5f, 0x6c617275, 0x00000000, 0x00070006, 0x0000013b, 0x00000000, 0x6d726f6e, 0x614d6c61, 
-    0x78697274, 0x00000000, 0x00070006, 0x0000013b, 0x00000001, 0x74736e69, 0x65636e61, 0x65646e49, 0x00000078, 
-    0x00080006, 0x0000013b, 0x00000002, 0x6e656373, 0x666e4965, 0x6464416f, 0x73736572, 0x00000000, 0x000a0006, 
-    0x0000013b, 0x00000003, 0x6174656d, 0x63696c6c, 0x67756f52, 0x73656e68, 0x65764f73, 0x64697272, 0x00000065, 
-    0x00050005, 0x00000142, 0x68737570, 0x736e6f43, 0x00000074, 0x000a0005, 0x00000186, 0x74614d5f, 0x53786972, 
-    0x61726f74, 0x665f6567, 0x74616f6c, 0x6e347834, 0x72757461, 0x00006c61, 0x00050006, 0x00000186, 0x00000000, 
-    0x61746164, 0x00000000, 0x00080005, 0x000001fc, 0x66746c47, 0x636e7550, 0x6c617574, 0x74616e5f, 0x6c617275, 
-    0x00000000, 0x00060006, 0x000001fc, 0x00000000, 0x69736f70, 0x6e6f6974, 0x00000000, 0x00060006, 0x000001fc, 
-    0x00000001, 0x65746e69, 0x7469736e, 0x00000079, 0x00060006, 0x000001fc, 0x00000002, 0x65726964, 0x6f697463, 
-    0x0000006e, 0x00050006, 0x000001fc, 0x00000003, 0x65707974, 0x00000000, 0x00050006, 0x000001fc, 0x00000004, 
-    0x6f6c6f63, 0x00000072, 0x00060006, 0x000001fc, 0x00000005, 0x656e6f63, 0x6c676e41, 0x00000065, 0x00050005, 
-    0x00000246, 0x46796172, 0x7367616c, 0x00000000, 0x00050005, 0x0000024d, 0x70696c63, 0x726f6f43, 0x00007364, 
-    0x00050005, 0x00000255, 0x70696c63, 0x726f6f43, 0x00007364, 0x00050005, 0x00000259, 0x77656976, 0x726f6f43, 
-    0x00007364, 0x00030005, 0x0000026b, 0x00796172, 0x00040005, 0x0000029d, 0x6c796170, 0x0064616f, 0x00030005, 
-    0x000002ba, 0x00000070, 0x00050005, 0x000002c5, 0x4c706f74, 0x6c657665, 0x00005341, 0x00040005, 0x000002d2, 
-    0x6f6c6f63, 0x00000072, 0x00040005, 0x000002d4, 0x6f6c6f63, 0x00000072, 0x00050005, 0x000002df, 0x4974756f, 
-    0x6567616d, 0x00000000, 0x00050005, 0x0000002f, 0x6e656772, 0x6e69614d, 0x00000000, 0x00060005, 0x000002ef, 
-    0x66746c47, 0x74736e49, 0x65636e61, 0x00000000, 0x00060006, 0x000002ef, 0x00000000, 0x6e617274, 0x726f6673, 
-    0x0000006d, 0x00070006, 0x000002ef, 0x00000001, 0x6574616d, 0x6c616972, 0x65646e49, 0x00000078, 0x00060006, 
-    0x000002ef, 0x00000002, 0x6873656d, 0x65646e49, 0x00000078, 0x00050005, 0x000002f6, 0x66667542, 0x69567265, 
-    0x00007765, 0x00050006, 0x000002f6, 0x00000000, 0x7366666f, 0x00007465, 0x00050006, 0x000002f6, 0x00000001, 
-    0x6e756f63, 0x00000074, 0x00060006, 0x000002f6, 0x00000002, 0x65747962, 0x69727453, 0x00006564, 0x00060005, 
-    0x000002f5, 0x61697254, 0x656c676e, 0x6873654d, 0x00000000, 0x00050006, 0x000002f5, 0x00000000, 0x69646e69, 
-    0x00736563, 0x00060006, 0x000002f5, 0x00000001, 0x69736f70, 0x6e6f6974, 0x00000073, 0x00050006, 0x000002f5, 
-    0x00000002, 0x6d726f6e, 0x00736c61, 0x00060006, 0x000002f5, 0x00000003, 0x6f6c6f63, 0x72655672, 0x00000074, 
-    0x00060006, 0x000002f5, 0x00000004, 0x43786574, 0x64726f6f, 0x00000073, 0x00060006, 0x000002f5, 0x00000005, 
-    0x676e6174, 0x73746e65, 0x00000000, 0x00050005, 0x000002f2, 0x66746c47, 0x6873654d, 0x00000000, 0x00060006, 
-    0x000002f2, 0x00000000, 0x66746c67, 0x66667542, 0x00007265, 0x00050006, 0x000002f2, 0x00000001, 0x4d697274, 
-    0x00687365, 0x00060006, 0x000002f2, 0x00000002, 0x65646e69, 0x70795478, 0x00000065, 0x00080005, 0x000002f9, 
-    0x66746c47, 0x6174654d, 0x63696c6c, 0x67756f52, 0x73656e68, 0x00000073, 0x00070006, 0x000002f9, 0x00000000, 
-    0x65736162, 0x6f6c6f43, 0x63614672, 0x00726f74, 0x00070006, 0x000002f9, 0x00000001, 0x6174656d, 0x63696c6c, 
-    0x74636146, 0x0000726f, 0x00070006, 0x000002f9, 0x00000002, 0x67756f72, 0x73656e68, 0x63614673, 0x00726f74, 
-    0x00090006, 0x000002f9, 0x00000003, 0x65736162, 0x6f6c6f43, 0x78655472, 0x65727574, 0x65646e49, 0x00000078, 
-    0x00040005, 0x00000307, 0x65626c61, 0x00006f64, 0x00040005, 0x00000307, 0x65626c61, 0x00006f64, 0x00050005, 
-    0x00000308, 0x6174656d, 0x63696c6c, 0x00000000, 0x00050005, 0x00000308, 0x6174656d, 0x63696c6c, 0x00000000, 
-    0x00050005, 0x00000309, 0x67756f72, 0x73656e68, 0x00000073, 0x00050005, 0x00000309, 0x67756f72, 0x73656e68, 
-    0x00000073, 0x00040005, 0x0000032a, 0x6c796170, 0x0064616f, 0x000c0005, 0x00000331, 0x6c697542, 0x546e4974, 
-    0x6e616972, 0x49656c67, 0x7265746e, 0x74636573, 0x416e6f69, 0x69727474, 0x65747562, 0x00000073, 0x00070006, 
-    0x00000331, 0x00000000, 0x79726162, 0x746e6563, 0x73636972, 0x00000000, 0x00060005, 0x0000033e, 0x79726162, 
-    0x746e6563, 0x73636972, 0x00000000, 0x00060005, 0x00000345, 0x79726162, 0x746e6563, 0x73636972, 0x00000000, 
-    0x00050005, 0x00000349, 0x74736e69, 0x65636e61, 0x00004449, 0x00040005, 0x00000352, 0x6873656d, 0x00004449, 
-    0x00040005, 0x0000035a, 0x49697274, 0x00000044, 0x00050005, 0x00000362, 0x6e656373, 0x666e4965, 0x0000006f, 
-    0x00050005, 0x00000411, 0x74736e69, 0x65636e61, 0x00000000, 0x00040005, 0x0000044f, 0x6873656d, 0x00000000, 
-    0x00050005, 0x00000499, 0x6574616d, 0x6c616972, 0x00000000, 0x00040005, 0x000004ab, 0x69646e69, 0x00736563, 
-    0x00070005, 0x000004b1, 0x61746164, 0x66667542, 0x64417265, 0x73657264, 0x00000073, 0x00040005, 0x000004b2, 
-    0x6873656d, 0x00000000, 0x00050005, 0x000004b3, 0x6d697270, 0x76697469, 0x00444965, 0x00050005, 0x000004d2, 
-    0x6d697270, 0x76697469, 0x00444965, 0x00040005, 0x000004d6, 0x6873656d, 0x00000000, 0x00070005, 0x000004d9, 
-    0x61746164, 0x66667542, 0x64417265, 0x73657264, 0x00000073, 0x00040005, 0x000004f9, 0x69646e69, 0x00736563, 
-    0x00040005, 0x00000511, 0x69646e69, 0x00736563, 0x00070005, 0x000004af, 0x54746567, 0x6e616972, 0x49656c67, 
-    0x6369646e, 0x00007365, 0x00040005, 0x000004ae, 0x69646e69, 0x00736563, 0x00030005, 0x00000523, 0x00736f70, 
-    0x00070005, 0x0000052a, 0x61746164, 0x66667542, 0x64417265, 0x73657264, 0x00000073, 0x00050005, 0x0000052b, 
-    0x66667562, 0x69567265, 0x00007765, 0x00060005, 0x0000052c, 0x72747461, 0x74756269, 0x646e4965, 0x00007865, 
-    0x00060005, 0x0000052d, 0x79726162, 0x746e6563, 0x73636972, 0x00000000, 0x00060005, 0x0000053e, 0x79726162, 
-    0x746e6563, 0x73636972, 0x00000000, 0x00060005, 0x00000542, 0x72747461, 0x74756269, 0x646e4965, 0x00007865, 
-    0x00050005, 0x00000546, 0x66667562, 0x69567265, 0x00007765, 0x00070005, 0x0000054a, 0x61746164, 0x66667542, 
-    0x64417265, 0x73657264, 0x00000073, 0x00040005, 0x00000551, 0x72747461, 0x00000030, 0x00070005, 0x00000558, 
-    0x61746164, 0x66667542, 0x64417265, 0x73657264, 0x00000073, 0x00050005, 0x00000559, 0x66667562, 0x69567265, 
-    0x00007765, 0x00060005, 0x0000055a, 0x72747461, 0x74756269, 0x646e4965, 0x00007865, 0x00060005, 0x0000056b, 
-    0x72747461, 0x74756269, 0x646e4965, 0x00007865, 0x00050005, 0x0000056e, 0x66667562, 0x69567265, 0x00007765, 
-    0x00070005, 0x00000571, 0x61746164, 0x66667542, 0x64417265, 0x73657264, 0x00000073, 0x00030005, 0x00000586, 
-    0x00727470, 0x00060005, 0x00000556, 0x41746567, 0x69727474, 0x65747562, 0x00000000, 0x00040005, 0x00000555, 
-    0x72747461, 0x00000030, 0x00040005, 0x0000059d, 0x72747461, 0x00000031, 0x00040005, 0x000005a1, 0x72747461, 
-    0x00000031, 0x00040005, 0x000005a4, 0x72747461, 0x00000032, 0x00040005, 0x000005a8, 0x72747461, 0x00000032, 
-    0x00080005, 0x00000528, 0x54746567, 0x6e616972, 0x41656c67, 0x69727474, 0x65747562, 0x00000000, 0x00030005, 
-    0x00000527, 0x00736f70, 0x00030005, 0x000005ba, 0x006d726e, 0x00030005, 0x000005bd, 0x006d726e, 0x00060005, 
-    0x000005c0, 0x6c726f77, 0x78655464, 0x726f6f43, 0x00000064, 0x00070005, 0x000005c6, 0x61746164, 0x66667542, 
-    0x64417265, 0x73657264, 0x00000073, 0x00050005, 0x000005c7, 0x66667562, 0x69567265, 0x00007765, 0x00060005, 
-    0x000005c8, 0x72747461, 0x74756269, 0x646e4965, 0x00007865, 0x00060005, 0x000005c9, 0x79726162, 0x746e6563, 
-    0x73636972, 0x00000000, 0x00060005, 0x000005d6, 0x79726162, 0x746e6563, 0x73636972, 0x00000000, 0x00060005, 
-    0x000005d9, 0x72747461, 0x74756269, 0x646e4965, 0x00007865, 0x00050005, 0x000005dc, 0x66667562, 0x69567265, 
-    0x00007765, 0x00070005, 0x000005df, 0x61746164, 0x66667542, 0x64417265, 0x73657264, 0x00000073, 0x00040005, 
-    0x000005e5, 0x72747461, 0x00000030, 0x00070005, 0x000005eb, 0x61746164, 0x66667542, 0x64417265, 0x73657264, 
-    0x00000073, 0x00050005, 0x000005ec, 0x66667562, 0x69567265, 0x00007765, 0x00060005, 0x000005ed, 0x72747461, 
-    0x74756269, 0x646e4965, 0x00007865, 0x00060005, 0x000005fd, 0x72747461, 0x74756269, 0x646e4965, 0x00007865, 
-    0x00050005, 0x00000600, 0x66667562, 0x69567265, 0x00007765, 0x00070005, 0x00000603, 0x61746164, 0x66667542, 
-    0x64417265, 0x73657264, 0x00000073, 0x00030005, 0x00000614, 0x00727470, 0x00060005, 0x000005e9, 0x41746567, 
-    0x69727474, 0x65747562, 0x00000000, 0x00040005, 0x000005e8, 0x72747461, 0x00000030, 0x00040005, 0x00000628, 
-    0x72747461, 0x00000031, 0x00040005, 0x0000062b, 0x72747461, 0x00000031, 0x00040005, 0x0000062e, 0x72747461, 
-    0x00000032, 0x00040005, 0x00000631, 0x72747461, 0x00000032, 0x00080005, 0x000005c4, 0x54746567, 0x6e616972, 
-    0x41656c67, 0x69727474, 0x65747562, 0x00000000, 0x00060005, 0x000005c3, 0x6c726f77, 0x78655464, 0x726f6f43, 
-    0x00000064, 0x00050005, 0x00000643, 0x6c726f77, 0x736f5064, 0x00000000, 0x00050005, 0x0000064f, 0x6c726f77, 
-    0x726f4e64, 0x006c616d, 0x00040005, 0x0000065a, 0x65626c61, 0x00006f64, 0x00040005, 0x0000065d, 0x65626c61, 
-    0x00006f64, 0x00050005, 0x00000661, 0x6174656d, 0x63696c6c, 0x00000000, 0x00050005, 0x00000667, 0x67756f72, 
-    0x73656e68, 0x00000073, 0x00050005, 0x0000067a, 0x74786574, 0x73657275, 0x00000000, 0x00040005, 0x00000683, 
-    0x706d6173, 0x0064656c, 0x00040005, 0x00000686, 0x65626c61, 0x00006f64, 0x00040005, 0x000006ab, 0x6867696c, 
-    0x00000074, 0x00050005, 0x000006b1, 0x6e656373, 0x666e4965, 0x0000006f, 0x00050005, 0x000006b2, 0x6c726f77, 
-    0x736f5064, 0x00000000, 0x00040005, 0x000006b7, 0x6867696c, 0x00000074, 0x00040005, 0x000006b7, 0x6867696c, 
-    0x00000074, 0x00050005, 0x000006d1, 0x6c726f77, 0x736f5064, 0x00000000, 0x00050005, 0x000006d4, 0x6e656373, 
-    0x666e4965, 0x0000006f, 0x00040005, 0x000006db, 0x6867696c, 0x00000074, 0x00050005, 0x00000719, 0x6867696c, 
-    0x72694474, 0x00000000, 0x00050005, 0x0000071f, 0x6867696c, 0x72694474, 0x00000000, 0x00030005, 0x00000723, 
-    0x00000064, 0x00040005, 0x00000733, 0x74656874, 0x00000061, 0x00060005, 0x0000073e, 0x746f7073, 0x65746e49, 
-    0x7469736e, 0x00000079, 0x00030005, 0x00000765, 0x00000064, 0x00060005, 0x000006af, 0x636f7270, 0x4c737365, 
-    0x74686769, 0x00000000, 0x00040005, 0x000006ae, 0x6867696c, 0x00000074, 0x00030005, 0x0000077b, 0x0000004e, 
-    0x00030005, 0x00000782, 0x00000056, 0x00030005, 0x00000788, 0x00000056, 0x00030005, 0x0000078c, 0x0000004c, 
-    0x00060005, 0x00000794, 0x64616873, 0x6146776f, 0x726f7463, 0x00000000, 0x00050005, 0x0000079a, 0x6c726f77, 
-    0x736f5064, 0x00000000, 0x00050005, 0x0000079b, 0x6c726f77, 0x726f4e64, 0x006c616d, 0x00060005, 0x0000079c, 
-    0x6867696c, 0x72694474, 0x69746365, 0x00006e6f, 0x00040005, 0x0000079d, 0x6867696c, 0x00000074, 0x00050005, 
-    0x000007a4, 0x64616873, 0x6152776f, 0x00000079, 0x00050005, 0x000007a4, 0x64616873, 0x6152776f, 0x00000079, 
-    0x00060005, 0x000007a7, 0x64616873, 0x6150776f, 0x616f6c79, 0x00000064, 0x00060005, 0x000007a7, 0x64616873, 
-    0x6150776f, 0x616f6c79, 0x00000064, 0x00040005, 0x000007ba, 0x6867696c, 0x00000074, 0x00060005, 0x000007bd, 
-    0x6867696c, 0x72694474, 0x69746365, 0x00006e6f, 0x00050005, 0x000007c1, 0x6c726f77, 0x726f4e64, 0x006c616d, 
-    0x00050005, 0x000007c4, 0x6c726f77, 0x736f5064, 0x00000000, 0x00050005, 0x000007cb, 0x64616873, 0x6152776f, 
-    0x00000079, 0x00060005, 0x000007f5, 0x64616873, 0x6150776f, 0x616f6c79, 0x00000064, 0x00050005, 0x00000798, 
-    0x74736574, 0x64616853, 0x0000776f, 0x00060005, 0x00000797, 0x64616873, 0x6146776f, 0x726f7463, 0x00000000, 
-    0x00040005, 0x0000081b, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000823, 0x65626c61, 0x00006f64, 0x00050005, 
-    0x00000824, 0x6174656d, 0x63696c6c, 0x00000000, 0x00050005, 0x00000825, 0x67756f72, 0x73656e68, 0x00000073, 
-    0x00030005, 0x00000826, 0x0000004e, 0x00030005, 0x00000827, 0x00000056, 0x00030005, 0x00000828, 0x0000004c, 
-    0x00070005, 0x00000830, 0x66647342, 0x6c617645, 0x65746175, 0x61746144, 0x00000000, 0x00040006, 0x00000830, 
-    0x00000000, 0x0000316b, 0x00040006, 0x00000830, 0x00000001, 0x0000326b, 0x00040006, 0x00000830, 0x00000002, 
-    0x00006978, 0x00070006, 0x00000830, 0x00000003, 0x66647362, 0x6669645f, 0x65737566, 0x00000000, 0x00060006, 
-    0x00000830, 0x00000004, 0x66647362, 0x6f6c675f, 0x00797373, 0x00040006, 0x00000830, 0x00000005, 0x00666470, 
-    0x00040005, 0x00000833, 0x61746164, 0x00000000, 0x00040005, 0x00000833, 0x61746164, 0x00000000, 0x00060005, 
-    0x00000834, 0x42726250, 0x4d657361, 0x72657461, 0x006c6169, 0x00060006, 0x00000834, 0x00000000, 0x65736162, 
-    0x6f6c6f43, 0x00000072, 0x00050006, 0x00000834, 0x00000001, 0x6361706f, 0x00797469, 0x00060006, 0x00000834, 
-    0x00000002, 0x67756f72, 0x73656e68, 0x00000073, 0x00060006, 0x00000834, 0x00000003, 0x6174656d, 0x63696c6c, 
-    0x00000000, 0x00060006, 0x00000834, 0x00000004, 0x73696d65, 0x65766973, 0x00000000, 0x00060006, 0x00000834, 
-    0x00000005, 0x6c63636f, 0x6f697375, 0x0000006e, 0x00050006, 0x00000834, 0x00000006, 0x31726f69, 0x00000000, 
-    0x00050006, 0x00000834, 0x00000007, 0x32726f69, 0x00000000, 0x00040006, 0x00000834, 0x00000008, 0x0000004e, 
-    0x00040006, 0x00000834, 0x00000009, 0x0000674e, 0x00040006, 0x00000834, 0x0000000a, 0x00000054, 0x00040006, 
-    0x00000834, 0x0000000b, 0x00000042, 0x00030005, 0x00000837, 0x0074616d, 0x00030005, 0x00000837, 0x0074616d, 
-    0x00030005, 0x00000840, 0x0000004c, 0x00030005, 0x00000843, 0x00000056, 0x00030005, 0x00000846, 0x0000004e, 
-    0x00050005, 0x00000849, 0x67756f72, 0x73656e68, 0x00000073, 0x00050005, 0x0000084c, 0x6174656d, 0x63696c6c, 
-    0x00000000, 0x00040005, 0x0000084f, 0x65626c61, 0x00006f64, 0x00040005, 0x00000865, 0x61746164, 0x00000000, 
-    0x00030005, 0x00000896, 0x0074616d, 0x00040005, 0x000008bc, 0x6d726f6e, 0x00006c61, 0x00040005, 0x000008bd, 
-    0x676e6174, 0x00746e65, 0x00050005, 0x000008be, 0x61746962, 0x6e65676e, 0x00000074, 0x00050005, 0x000008cf, 
-    0x61746962, 0x6e65676e, 0x00000074, 0x00040005, 0x000008d2, 0x676e6174, 0x00746e65, 0x00040005, 0x000008d5, 
-    0x6d726f6e, 0x00006c61, 0x00030005, 0x000008e3, 0x00000061, 0x00030005, 0x000008e7, 0x00000061, 0x00030005, 
-    0x000008eb, 0x00000062, 0x00030005, 0x000008f2, 0x00000062, 0x00070005, 0x000008ba, 0x6874726f, 0x726f6e6f, 
-    0x426c616d, 0x73697361, 0x00000000, 0x00040005, 0x00000922, 0x61746164, 0x00000000, 0x00030005, 0x00000923, 
-    0x0074616d, 0x00030005, 0x00000937, 0x00003147, 0x00030005, 0x00000937, 0x00003147, 0x00030005, 0x00000939, 
-    0x00003247, 0x00030005, 0x00000939, 0x00003247, 0x00030005, 0x00000958, 0x0074616d, 0x00040005, 0x0000095b, 
-    0x61746164, 0x00000000, 0x00030005, 0x00000962, 0x00000048, 0x00040005, 0x0000096e, 0x746f644e, 0x00000056, 
-    0x00030005, 0x00000976, 0x00000078, 0x00030005, 0x00000977, 0x00000079, 0x00030005, 0x00000980, 0x00000079, 
-    0x00030005, 0x00000984, 0x00000078, 0x00050005, 0x00000974, 0x6d616c63, 0x44646570, 0x0000746f, 0x00040005, 
-    0x00000973, 0x746f644e, 0x00000056, 0x00040005, 0x00000990, 0x746f644e, 0x0000004c, 0x00040005, 0x00000994, 
-    0x746f644e, 0x0000004c, 0x00040005, 0x00000997, 0x746f6456, 0x00000048, 0x00040005, 0x0000099b, 0x746f6456, 
-    0x00000048, 0x00040005, 0x0000099e, 0x746f644e, 0x00000048, 0x00040005, 0x000009a1, 0x746f644e, 0x00000048, 
-    0x00070005, 0x000009c3, 0x696d5f63, 0x65725f6e, 0x63656c66, 0x636e6174, 0x00000065, 0x00030005, 0x000009c9, 
-    0x00003066, 0x00040005, 0x000009d4, 0x6f6c4766, 0x00797373, 0x00030005, 0x000009da, 0x00003046, 0x00030005, 
-    0x000009db, 0x00303946, 0x00040005, 0x000009dc, 0x746f6456, 0x00000048, 0x00040005, 0x000009e7, 0x746f6456, 
-    0x00000048, 0x00030005, 0x000009ea, 0x00303946, 0x00030005, 0x000009ee, 0x00003046, 0x00060005, 0x000009d8, 
-    0x6c686373, 0x466b6369, 0x6e736572, 0x00006c65, 0x00040005, 0x000009d7, 0x6f6c4766, 0x00797373, 0x00050005, 
-    0x000009ff, 0x66694466, 0x65737566, 0x00000000, 0x00030005, 0x00000a05, 0x00003046, 0x00030005, 0x00000a06, 
-    0x00303946, 0x00040005, 0x00000a07, 0x746f6456, 0x00000048, 0x00040005, 0x00000a10, 0x746f6456, 0x00000048, 
-    0x00030005, 0x00000a13, 0x00303946, 0x00030005, 0x00000a16, 0x00003046, 0x00060005, 0x00000a03, 0x6c686373, 
-    0x466b6369, 0x6e736572, 0x00006c65, 0x00050005, 0x00000a24, 0x66694466, 0x65737566, 0x00000000, 0x00040005, 
-    0x00000a27, 0x61636f6c, 0x0000486c, 0x00040005, 0x00000a2e, 0x61636f6c, 0x0000486c, 0x00030005, 0x00000a31, 
-    0x00000064, 0x00060005, 0x00000a39, 0x52766e69, 0x6867756f, 0x7373656e, 0x00000000, 0x00030005, 0x00000a3a, 
-    0x00000068, 0x00030005, 0x00000a48, 0x00000068, 0x00060005, 0x00000a4c, 0x52766e69, 0x6867756f, 0x7373656e, 
-    0x00000000, 0x00030005, 0x00000a53, 0x00000078, 0x00030005, 0x00000a57, 0x00000078, 0x00030005, 0x00000a5b, 
-    0x00000079, 0x00030005, 0x00000a5f, 0x00000079, 0x00040005, 0x00000a63, 0x73696e61, 0x0000006f, 0x00040005, 
-    0x00000a68, 0x73696e61, 0x0000006f, 0x00030005, 0x00000a6c, 0x00000066, 0x00030005, 0x00000a71, 0x00000066, 
-    0x00060005, 0x00000a37, 0x5f647668, 0x5f786767, 0x6c617665, 0x00000000, 0x00030005, 0x00000a36, 0x00000064, 
-    0x00040005, 0x00000a7e, 0x61636f6c, 0x00314b6c, 0x00040005, 0x00000a85, 0x61636f6c, 0x00314b6c, 0x00040005, 
-    0x00000a89, 0x61636f6c, 0x00324b6c, 0x00040005, 0x00000a90, 0x61636f6c, 0x00324b6c, 0x00030005, 0x00000a93, 
-    0x00003147, 0x00030005, 0x00000a98, 0x00003247, 0x00030005, 0x00000aa2, 0x00003147, 0x00030005, 0x00000aa3, 
-    0x00003247, 0x00030005, 0x00000aa4, 0x0000316b, 0x00030005, 0x00000aa5, 0x0000326b, 0x00050005, 0x00000aa6, 
-    0x67756f72, 0x73656e68, 0x00000073, 0x00050005, 0x00000ab2, 0x67756f72, 0x73656e68, 0x00000073, 0x00030005, 
-    0x00000ab5, 0x0000326b, 0x00030005, 0x00000ab8, 0x0000316b, 0x00030005, 0x00000abb, 0x00003247, 0x00030005, 
-    0x00000abd, 0x00003147, 0x00030005, 0x00000ac6, 0x0000006b, 0x00050005, 0x00000ac7, 0x67756f72, 0x73656e68, 
-    0x00000073, 0x00050005, 0x00000ad9, 0x67756f72, 0x73656e68, 0x00000073, 0x00030005, 0x00000adc, 0x0000006b, 
-    0x00030005, 0x00000ae3, 0x00327a6b, 0x00030005, 0x00000ae7, 0x00327a6b, 0x00030005, 0x00000aef, 0x00007861, 
-    0x00030005, 0x00000af4, 0x00007861, 0x00030005, 0x00000af8, 0x00007961, 0x00030005, 0x00000afd, 0x00007961, 
-    0x00040005, 0x00000b01, 0x5f766e69, 0x00003261, 0x00040005, 0x00000b07, 0x5f766e69, 0x00003261, 0x00080005, 
-    0x00000ac4, 0x74696d73, 0x68735f68, 0x776f6461, 0x5f726f5f, 0x6b73616d, 0x00000000, 0x00080005, 0x00000aa0, 
-    0x5f786767, 0x74696d73, 0x68735f68, 0x776f6461, 0x73616d5f, 0x0000006b, 0x00050005, 0x00000b22, 0x66666964, 
-    0x50657375, 0x00006664, 0x00050005, 0x00000b25, 0x66666964, 0x50657375, 0x00006664, 0x00050005, 0x00000b28, 
-    0x63657073, 0x72616c75, 0x00666450, 0x00050005, 0x00000b30, 0x63657073, 0x72616c75, 0x00666450, 0x00040005, 
-    0x00000b38, 0x746f644e, 0x00000056, 0x00050005, 0x00000b39, 0x6174656d, 0x63696c6c, 0x00000000, 0x00050005, 
-    0x00000b43, 0x6174656d, 0x63696c6c, 0x00000000, 0x00040005, 0x00000b46, 0x746f644e, 0x00000056, 0x00030005, 
-    0x00000b4e, 0x00003046, 0x00030005, 0x00000b4f, 0x00303946, 0x00040005, 0x00000b50, 0x746f6456, 0x00000048, 
-    0x00040005, 0x00000b56, 0x746f6456, 0x00000048, 0x00030005, 0x00000b59, 0x00303946, 0x00030005, 0x00000b5c, 
-    0x00003046, 0x00060005, 0x00000b4d, 0x6c686373, 0x466b6369, 0x6e736572, 0x00006c65, 0x00090005, 0x00000b36, 
-    0x66647362, 0x706d6953, 0x6c47656c, 0x7973736f, 0x626f7250, 0x6c696261, 0x00797469, 0x00070005, 0x00000920, 
-    0x66647362, 0x6c617645, 0x65746175, 0x706d6953, 0x0000656c, 0x00080005, 0x00000821, 0x4d726270, 0x6c617465, 
-    0x5263696c, 0x6867756f, 0x7373656e, 0x00000000, 0x00040005, 0x00000820, 0x6f6c6f63, 0x00000072, 0x00040005, 
-    0x00000ba3, 0x6f6c6f63, 0x00000072, 0x00050005, 0x000002e7, 0x69686372, 0x69614d74, 0x0000006e, 0x00040005, 
-    0x00000bbf, 0x6c796170, 0x0064616f, 0x00050005, 0x00000bc9, 0x6e656373, 0x666e4965, 0x0000006f, 0x00050005, 
-    0x00000c86, 0x43796b73, 0x726f6c6f, 0x00000000, 0x00040005, 0x00000c8c, 0x61726170, 0x0000736d, 0x00050005, 
-    0x00000c8d, 0x65726964, 0x6f697463, 0x0000006e, 0x00050005, 0x00000ca3, 0x65726964, 0x6f697463, 0x0000006e, 
-    0x00040005, 0x00000ca6, 0x61726170, 0x0000736d, 0x00050005, 0x00000cad, 0x43796b73, 0x726f6c6f, 0x00000000, 
-    0x00050005, 0x00000cb1, 0x43796b73, 0x726f6c6f, 0x00000000, 0x00060005, 0x00000cb5, 0x69726f68, 0x436e6f7a, 
-    0x726f6c6f, 0x00000000, 0x00060005, 0x00000cb8, 0x69726f68, 0x436e6f7a, 0x726f6c6f, 0x00000000, 0x00050005, 
-    0x00000cbb, 0x756f7267, 0x6f43646e, 0x00726f6c, 0x00050005, 0x00000cbe, 0x756f7267, 0x6f43646e, 0x00726f6c, 
-    0x00050005, 0x00000cc1, 0x76656c65, 0x6f697461, 0x0000006e, 0x00030005, 0x00000cca, 0x00706f74, 0x00040005, 
-    0x00000cd2, 0x74746f62, 0x00006d6f, 0x00050005, 0x00000cda, 0x69766e65, 0x6d6e6f72, 0x00746e65, 0x00060005, 
-    0x00000ce4, 0x6c676e61, 0x4c6f5465, 0x74686769, 0x00000000, 0x00060005, 0x00000ced, 0x666c6168, 0x75676e41, 
-    0x5372616c, 0x00657a69, 0x00060005, 0x00000cf1, 0x666c6168, 0x75676e41, 0x5372616c, 0x00657a69, 0x00050005, 
-    0x00000cf5, 0x776f6c67, 0x75706e49, 0x00000074, 0x00060005, 0x00000d02, 0x776f6c67, 0x65746e49, 0x7469736e, 
-    0x00000079, 0x00060005, 0x00000d07, 0x776f6c67, 0x65746e49, 0x7469736e, 0x00000079, 0x00050005, 0x00000d0a, 
-    0x4c6e7573, 0x74686769, 0x00000000, 0x00050005, 0x00000d0e, 0x4c6e7573, 0x74686769, 0x00000000, 0x00060005, 
-    0x00000c8a, 0x6c617665, 0x706d6953, 0x6b53656c, 0x00000079, 0x00050005, 0x00000c89, 0x43796b73, 0x726f6c6f, 
-    0x00000000, 0x00050005, 0x00000bad, 0x73696d72, 0x69614d73, 0x0000006e, 0x00080005, 0x0000003c, 0x66746c47, 
-    0x74736e49, 0x65636e61, 0x74616e5f, 0x6c617275, 0x00000000, 0x00060006, 0x0000003c, 0x00000000, 0x6e617274, 
-    0x726f6673, 0x0000006d, 0x00070006, 0x0000003c, 0x00000001, 0x6574616d, 0x6c616972, 0x65646e49, 0x00000078, 
-    0x00060006, 0x0000003c, 0x00000002, 0x6873656d, 0x65646e49, 0x00000078, 0x00070005, 0x00000459, 0x66667542, 
-    0x69567265, 0x6e5f7765, 0x72757461, 0x00006c61, 0x00050006, 0x00000459, 0x00000000, 0x7366666f, 0x00007465, 
-    0x00050006, 0x00000459, 0x00000001, 0x6e756f63, 0x00000074, 0x00060006, 0x00000459, 0x00000002, 0x65747962, 
-    0x69727453, 0x00006564, 0x00080005, 0x00000456, 0x61697254, 0x656c676e, 0x6873654d, 0x74616e5f, 0x6c617275, 
-    0x00000000, 0x00050006, 0x00000456, 0x00000000, 0x69646e69, 0x00736563, 0x00060006, 0x00000456, 0x00000001, 
-    0x69736f70, 0x6e6f6974, 0x00000073, 0x00050006, 0x00000456, 0x00000002, 0x6d726f6e, 0x00736c61, 0x00060006, 
-    0x00000456, 0x00000003, 0x6f6c6f63, 0x72655672, 0x00000074, 0x00060006, 0x00000456, 0x00000004, 0x43786574, 
-    0x64726f6f, 0x00000073, 0x00060006, 0x00000456, 0x00000005, 0x676e6174, 0x73746e65, 0x00000000, 0x00070005, 
-    0x0000003e, 0x66746c47, 0x6873654d, 0x74616e5f, 0x6c617275, 0x00000000, 0x00060006, 0x0000003e, 0x00000000, 
-    0x66746c67, 0x66667542, 0x00007265, 0x00050006, 0x0000003e, 0x00000001, 0x4d697274, 0x00687365, 0x00060006, 
-    0x0000003e, 0x00000002, 0x65646e69, 0x70795478, 0x00000065, 0x000a0005, 0x00000040, 0x66746c47, 0x6174654d, 
-    0x63696c6c, 0x67756f52, 0x73656e68, 0x616e5f73, 0x61727574, 0x0000006c, 0x00070006, 0x00000040, 0x00000000, 
-    0x65736162, 0x6f6c6f43, 0x63614672, 0x00726f74, 0x00070006, 0x00000040, 0x00000001, 0x6174656d, 0x63696c6c, 
-    0x74636146, 0x0000726f, 0x00070006, 0x00000040, 0x00000002, 0x67756f72, 0x73656e68, 0x63614673, 0x00726f74, 
-    0x00090006, 0x00000040, 0x00000003, 0x65736162, 0x6f6c6f43, 0x78655472, 0x65727574, 0x65646e49, 0x00000078, 
-    0x000a0005, 0x000001f8, 0x7272415f, 0x6e5f7961, 0x72757461, 0x475f6c61, 0x5066746c, 0x74636e75, 0x326c6175, 
-    0x00000000, 0x00050006, 0x000001f8, 0x00000000, 0x61746164, 0x00000000, 0x00090005, 0x0000021f, 0x53796b53, 
-    0x6c706d69, 0x72615065, 0x74656d61, 0x5f737265, 0x7574616e, 0x006c6172, 0x00070006, 0x0000021f, 0x00000000, 
-    0x446e7573, 0x63657269, 0x6e6f6974, 0x00000000, 0x00080006, 0x0000021f, 0x00000001, 0x75676e61, 0x5372616c, 
-    0x4f657a69, 0x67694c66, 0x00007468, 0x00060006, 0x0000021f, 0x00000002, 0x436e7573, 0x726f6c6f, 0x00000000, 
-    0x00060006, 0x0000021f, 0x00000003, 0x776f6c67, 0x657a6953, 0x00000000, 0x00060006, 0x0000021f, 0x00000004, 
-    0x43796b73, 0x726f6c6f, 0x00000000, 0x00070006, 0x0000021f, 0x00000005, 0x776f6c67, 0x65746e49, 0x7469736e, 
-    0x00000079, 0x00070006, 0x0000021f, 0x00000006, 0x69726f68, 0x436e6f7a, 0x726f6c6f, 0x00000000, 0x00060006, 
-    0x0000021f, 0x00000007, 0x69726f68, 0x536e6f7a, 0x00657a69, 0x00060006, 0x0000021f, 0x00000008, 0x756f7267, 
-    0x6f43646e, 0x00726f6c, 0x00070006, 0x0000021f, 0x00000009, 0x776f6c67, 0x72616853, 0x73656e70, 0x00000073, 
-    0x00060006, 0x0000021f, 0x0000000a, 0x65726964, 0x6f697463, 0x0070556e, 0x00070006, 0x0000021f, 0x0000000b, 
-    0x496e7573, 0x6e65746e, 0x79746973, 0x00000000, 0x00070006, 0x0000021f, 0x0000000c, 0x6867696c, 0x64615274, 
-    0x636e6169, 0x00000065, 0x00060006, 0x0000021f, 0x0000000d, 0x67697262, 0x656e7468, 0x00007373, 0x00080005, 
-    0x0000013f, 0x66746c47, 0x6e656353, 0x666e4965, 0x616e5f6f, 0x61727574, 0x0000006c, 0x00070006, 0x0000013f, 
-    0x00000000, 0x77656976, 0x6a6f7250, 0x7274614d, 0x00007869, 0x00070006, 0x0000013f, 0x00000001, 0x6a6f7270, 
-    0x4d766e49, 0x69727461, 0x00000078, 0x00070006, 0x0000013f, 0x00000002, 0x77656976, 0x4d766e49, 0x69727461, 
-    0x00000078, 0x00070006, 0x0000013f, 0x00000003, 0x656d6163, 0x6f506172, 0x69746973, 0x00006e6f, 0x00050006, 
-    0x0000013f, 0x00000004, 0x53657375, 0x0000796b, 0x00070006, 0x0000013f, 0x00000005, 0x6b636162, 0x756f7267, 
-    0x6f43646e, 0x00726f6c, 0x00060006, 0x0000013f, 0x00000006, 0x4c6d756e, 0x74686769, 0x00000073, 0x00060006, 
-    0x0000013f, 0x00000007, 0x74736e69, 0x65636e61, 0x00000073, 0x00050006, 0x0000013f, 0x00000008, 0x6873656d, 
-    0x00007365, 0x00060006, 0x0000013f, 0x00000009, 0x6574616d, 0x6c616972, 0x00000073, 0x00070006, 0x0000013f, 
-    0x0000000a, 0x636e7570, 0x6c617574, 0x6867694c, 0x00007374, 0x00070006, 0x0000013f, 0x0000000b, 0x53796b73, 
-    0x6c706d69, 0x72615065, 0x00006d61, 0x00040047, 0x0000003d, 0x00000006, 0x00000048, 0x00040047, 0x0000003f, 
-    0x00000006, 0x00000058, 0x00040047, 0x00000041, 0x00000006, 0x0000001c, 0x00040047, 0x00000076, 0x0000000b, 
-    0x000014c7, 0x00040047, 0x00000081, 0x0000000b, 0x000014c8, 0x00040047, 0x0000013d, 0x00000006, 0x0000000c, 
-    0x00050048, 0x0000013c, 0x00000000, 0x00000023, 0x00000000, 0x00040047, 0x00000140, 0x00000006, 0x000001c8, 
-    0x00030047, 0x0000013b, 0x00000002, 0x00050048, 0x0000013b, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 
-    0x0000013b, 0x00000001, 0x00000023, 0x00000024, 0x00050048, 0x0000013b, 0x00000002, 0x00000023, 0x00000028, 
-    0x00050048, 0x0000013b, 0x00000003, 0x00000023, 0x00000030, 0x00040047, 0x00000187, 0x00000006, 0x00000040, 
-    0x00040047, 0x00000189, 0x00000006, 0x00000010, 0x00050048, 0x00000186, 0x00000000, 0x00000023, 0x00000000, 
-    0x00040047, 0x000001df, 0x00000006, 0x0000000c, 0x00040047, 0x000001e2, 0x00000006, 0x00000004, 0x00040047, 
-    0x000001ec, 0x00000006, 0x00000008, 0x00040047, 0x000001f0, 0x00000006, 0x00000008, 0x00040047, 0x000001f4, 
-    0x00000006, 0x00000008, 0x00040047, 0x000001f9, 0x00000006, 0x00000060, 0x00050048, 0x000001fc, 0x00000000, 
-    0x00000023, 0x00000000, 0x00050048, 0x000001fc, 0x00000001, 0x00000023, 0x0000000c, 0x00050048, 0x000001fc, 
-    0x00000002, 0x00000023, 0x00000010, 0x00050048, 0x000001fc, 0x00000003, 0x00000023, 0x0000001c, 0x00050048, 
-    0x000001fc, 0x00000004, 0x00000023, 0x00000020, 0x00050048, 0x000001fc, 0x00000005, 0x00000023, 0x0000002c, 
-    0x00040047, 0x000001fb, 0x00000006, 0x00000030, 0x00040047, 0x000001fd, 0x00000006, 0x00000060, 0x00040047, 
-    0x000001ff, 0x00000006, 0x00000030, 0x00040047, 0x00000203, 0x00000006, 0x00000004, 0x00040047, 0x00000220, 
-    0x00000006, 0x00000070, 0x00040047, 0x000002ba, 0x0000001e, 0x00000000, 0x00040047, 0x000002c5, 0x00000021, 
-    0x00000002, 0x00040047, 0x000002c5, 0x00000022, 0x00000001, 0x00040047, 0x000002df, 0x00000021, 0x00000001, 
-    0x00040047, 0x000002df, 0x00000022, 0x00000001, 0x00040047, 0x000002f4, 0x00000006, 0x00000001, 0x00040047, 
-    0x0000034e, 0x0000000b, 0x00000006, 0x00040047, 0x00000356, 0x0000000b, 0x000014cf, 0x00040047, 0x0000035e, 
-    0x0000000b, 0x00000007, 0x00040047, 0x00000431, 0x00000006, 0x00000004, 0x00040047, 0x00000453, 0x00000006, 
-    0x00000008, 0x00040047, 0x00000457, 0x00000006, 0x00000048, 0x00040047, 0x0000045a, 0x00000006, 0x0000000c, 
-    0x00040047, 0x0000049d, 0x00000006, 0x00000010, 0x00030047, 0x000004b1, 0x00000014, 0x00030047, 0x000004b9, 
-    0x000014ec, 0x00040047, 0x000004ba, 0x00000006, 0x0000000c, 0x00030047, 0x000004bc, 0x000014ec, 0x00040047, 
-    0x000004bf, 0x00000006, 0x00000006, 0x00030047, 0x000004c1, 0x000014ec, 0x00030047, 0x0000052a, 0x00000014, 
-    0x00030047, 0x00000534, 0x000014ec, 0x00030047, 0x00000558, 0x00000014, 0x00030047, 0x0000055e, 0x000014ec, 
-    0x00030047, 0x00000560, 0x000014ec, 0x00030047, 0x000005c6, 0x00000014, 0x00030047, 0x000005ce, 0x000014ec, 
-    0x00030047, 0x000005eb, 0x00000014, 0x00030047, 0x000005f1, 0x000014ec, 0x00040047, 0x000005f2, 0x00000006, 
-    0x00000008, 0x00030047, 0x000005f4, 0x000014ec, 0x00040047, 0x0000064a, 0x0000000b, 0x000014d2, 0x00040047, 
-    0x00000653, 0x0000000b, 0x000014d3, 0x00040047, 0x0000067a, 0x00000021, 0x00000000, 0x00040047, 0x0000067a, 
-    0x00000022, 0x00000000, 0x00040047, 0x00000787, 0x0000000b, 0x000014ca, 0x00050048, 0x0000003c, 0x00000000, 
-    0x00000023, 0x00000000, 0x00050048, 0x0000003c, 0x00000001, 0x00000023, 0x00000040, 0x00050048, 0x0000003c, 
-    0x00000002, 0x00000023, 0x00000044, 0x00050048, 0x00000459, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 
-    0x00000459, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000459, 0x00000002, 0x00000023, 0x00000008, 
-    0x00050048, 0x00000456, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000456, 0x00000001, 0x00000023, 
-    0x0000000c, 0x00050048, 0x00000456, 0x00000002, 0x00000023, 0x00000018, 0x00050048, 0x00000456, 0x00000003, 
-    0x00000023, 0x00000024, 0x00050048, 0x00000456, 0x00000004, 0x00000023, 0x00000030, 0x00050048, 0x00000456, 
-    0x00000005, 0x00000023, 0x0000003c, 0x00050048, 0x0000003e, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 
-    0x0000003e, 0x00000001, 0x00000023, 0x00000008, 0x00050048, 0x0000003e, 0x00000002, 0x00000023, 0x00000050, 
-    0x00050048, 0x00000040, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000040, 0x00000001, 0x00000023, 
-    0x00000010, 0x00050048, 0x00000040, 0x00000002, 0x00000023, 0x00000014, 0x00050048, 0x00000040, 0x00000003, 
-    0x00000023, 0x00000018, 0x00050048, 0x000001f8, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000021f, 
-    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000021f, 0x00000001, 0x00000023, 0x0000000c, 0x00050048, 
-    0x0000021f, 0x00000002, 0x00000023, 0x00000010, 0x00050048, 0x0000021f, 0x00000003, 0x00000023, 0x0000001c, 
-    0x00050048, 0x0000021f, 0x00000004, 0x00000023, 0x00000020, 0x00050048, 0x0000021f, 0x00000005, 0x00000023, 
-    0x0000002c, 0x00050048, 0x0000021f, 0x00000006, 0x00000023, 0x00000030, 0x00050048, 0x0000021f, 0x00000007, 
-    0x00000023, 0x0000003c, 0x00050048, 0x0000021f, 0x00000008, 0x00000023, 0x00000040, 0x00050048, 0x0000021f, 
-    0x00000009, 0x00000023, 0x0000004c, 0x00050048, 0x0000021f, 0x0000000a, 0x00000023, 0x00000050, 0x00050048, 
-    0x0000021f, 0x0000000b, 0x00000023, 0x0000005c, 0x00050048, 0x0000021f, 0x0000000c, 0x00000023, 0x00000060, 
-    0x00050048, 0x0000021f, 0x0000000d, 0x00000023, 0x0000006c, 0x00050048, 0x0000013f, 0x00000000, 0x00000023, 
-    0x00000000, 0x00050048, 0x0000013f, 0x00000001, 0x00000023, 0x00000040, 0x00050048, 0x0000013f, 0x00000002, 
-    0x00000023, 0x00000080, 0x00050048, 0x0000013f, 0x00000003, 0x00000023, 0x000000c0, 0x00050048, 0x0000013f, 
-    0x00000004, 0x00000023, 0x000000cc, 0x00050048, 0x0000013f, 0x00000005, 0x00000023, 0x000000d0, 0x00050048, 
-    0x0000013f, 0x00000006, 0x00000023, 0x000000dc, 0x00050048, 0x0000013f, 0x00000007, 0x00000023, 0x000000e0, 
-    0x00050048, 0x0000013f, 0x00000008, 0x00000023, 0x000000e8, 0x00050048, 0x0000013f, 0x00000009, 0x00000023, 
-    0x000000f0, 0x00050048, 0x0000013f, 0x0000000a, 0x00000023, 0x000000f8, 0x00050048, 0x0000013f, 0x0000000b, 
-    0x00000023, 0x00000158, 0x00020013, 0x00000003, 0x0007000c, 0x00000003, 0x00000004, 0x00000002, 0x00000023, 
-    0x00000005, 0x00000001, 0x00040015, 0x00000006, 0x00000020, 0x00000000, 0x0004002b, 0x00000006, 0x00000007, 
-    0x0000000b, 0x0004002b, 0x00000006, 0x00000008, 0x00000005, 0x0004002b, 0x00000006, 0x00000009, 0x00000064, 
-    0x0009000c, 0x00000003, 0x0000000a, 0x00000002, 0x00000001, 0x00000009, 0x00000008, 0x00000004, 0x00000007, 
-    0x0007000c, 0x00000003, 0x0000000c, 0x00000002, 0x00000023, 0x0000000d, 0x0000000b, 0x0007000c, 0x00000003, 
-    0x0000000f, 0x00000002, 0x00000023, 0x00000010, 0x0000000e, 0x0007000c, 0x00000003, 0x00000012, 0x00000002, 
-    0x00000023, 0x00000013, 0x00000011, 0x0007000c, 0x00000003, 0x00000015, 0x00000002, 0x00000023, 0x00000016, 
-    0x00000014, 0x0007000c, 0x00000003, 0x00000018, 0x00000002, 0x00000023, 0x00000019, 0x00000017, 0x0007000c, 
-    0x00000003, 0x0000001b, 0x00000002, 0x00000023, 0x0000001c, 0x0000001a, 0x0007000c, 0x00000003, 0x0000001e, 
-    0x00000002, 0x00000023, 0x0000001f, 0x0000001d, 0x0007000c, 0x00000003, 0x00000021, 0x00000002, 0x00000023, 
-    0x00000022, 0x00000020, 0x0007000c, 0x00000003, 0x00000024, 0x00000002, 0x00000023, 0x00000025, 0x00000023, 
-    0x0007000c, 0x00000003, 0x00000027, 0x00000002, 0x00000023, 0x00000028, 0x00000026, 0x0007000c, 0x00000003, 
-    0x0000002a, 0x00000002, 0x00000023, 0x0000002b, 0x00000029, 0x0007000c, 0x00000003, 0x0000002d, 0x00000002, 
-    0x00000023, 0x0000002e, 0x0000002c, 0x00030021, 0x00000030, 0x00000003, 0x00030016, 0x00000032, 0x00000020, 
-    0x00040017, 0x00000033, 0x00000032, 0x00000002, 0x00040020, 0x00000034, 0x00000007, 0x00000033, 0x00040017, 
-    0x00000038, 0x00000032, 0x00000004, 0x00040018, 0x00000039, 0x00000038, 0x00000004, 0x00040017, 0x0000003a, 
-    0x00000032, 0x00000003, 0x00040015, 0x0000003b, 0x00000020, 0x00000001, 0x00030027, 0x0000003d, 0x000014e5, 
-    0x00030027, 0x0000003f, 0x000014e5, 0x00030027, 0x00000041, 0x000014e5, 0x0008001e, 0x00000043, 0x0000003a, 
-    0x00000032, 0x0000003a, 0x0000003b, 0x0000003a, 0x00000032, 0x0004002b, 0x0000003b, 0x00000044, 0x00000002, 
-    0x0004001c, 0x00000042, 0x00000043, 0x00000044, 0x0010001e, 0x00000045, 0x0000003a, 0x00000032, 0x0000003a, 
-    0x00000032, 0x0000003a, 0x00000032, 0x0000003a, 0x00000032, 0x0000003a, 0x00000032, 0x0000003a, 0x00000032, 
-    0x0000003a, 0x00000032, 0x000e001e, 0x00000037, 0x00000039, 0x00000039, 0x00000039, 0x0000003a, 0x0000003b, 
-    0x0000003a, 0x0000003b, 0x0000003d, 0x0000003f, 0x00000041, 0x00000042, 0x00000045, 0x00040020, 0x00000046, 
-    0x00000007, 0x00000037, 0x00040020, 0x00000048, 0x00000007, 0x00000006, 0x00040020, 0x0000004b, 0x00000007, 
-    0x00000038, 0x0006001e, 0x0000004d, 0x0000003a, 0x00000032, 0x0000003a, 0x00000032, 0x00040020, 0x0000004e, 
-    0x00000007, 0x0000004d, 0x0005001e, 0x00000051, 0x0000003a, 0x00000032, 0x0000003b, 0x00040020, 0x00000052, 
-    0x00000007, 0x00000051, 0x00040020, 0x00000055, 0x00000007, 0x0000003a, 0x0004002b, 0x00000006, 0x00000058, 
-    0x00000000, 0x0007000c, 0x00000003, 0x00000057, 0x00000002, 0x00000008, 0x00000058, 0x00000003, 0x0004002b, 
-    0x00000006, 0x0000005b, 0x000000b9, 0x0004002b, 0x00000006, 0x0000005c, 0x00000006, 0x000e000c, 0x00000003, 
-    0x00000059, 0x00000002, 0x00000014, 0x0000005a, 0x00000057, 0x0000002d, 0x0000005b, 0x0000005c, 0x0000000a, 
-    0x0000005a, 0x00000058, 0x0000005b, 0x0009000c, 0x00000003, 0x0000005f, 0x00000002, 0x0000006b, 0x00000059, 
-    0x0000000a, 0x00000060, 0x00000061, 0x0004002b, 0x00000006, 0x00000063, 0x000000bc, 0x0004002b, 0x00000006, 
-    0x00000064, 0x00000003, 0x0004002b, 0x00000006, 0x00000065, 0x00000004, 0x0004002b, 0x00000006, 0x0000006a, 
-    0x00000020, 0x0004002b, 0x00000006, 0x0000006b, 0x00020000, 0x0009000c, 0x00000003, 0x00000068, 0x00000002, 
-    0x00000002, 0x00000069, 0x0000006a, 0x00000064, 0x0000006b, 0x0004002b, 0x00000006, 0x0000006d, 0x00000002, 
-    0x0007000c, 0x00000003, 0x0000006c, 0x00000002, 0x00000006, 0x00000068, 0x0000006d, 0x0004002b, 0x00000006, 
-    0x00000070, 0x0000000a, 0x000c000c, 0x00000003, 0x0000006e, 0x00000002, 0x0000001a, 0x0000006f, 0x0000006c, 
-    0x0000002d, 0x00000063, 0x00000070, 0x00000059, 0x00000058, 0x0005000c, 0x00000003, 0x00000071, 0x00000002, 
-    0x0000001f, 0x00040017, 0x00000073, 0x00000006, 0x00000003, 0x00040020, 0x00000075, 0x00000001, 0x00000073, 
-    0x00040017, 0x00000077, 0x00000006, 0x00000002, 0x0004002b, 0x00000006, 0x0000007c, 0x000000bd, 0x000c000c, 
-    0x00000003, 0x0000007d, 0x00000002, 0x0000001a, 0x0000007e, 0x0000006c, 0x0000002d, 0x0000007c, 0x00000070, 
-    0x00000059, 0x00000058, 0x0004002b, 0x00000006, 0x00000086, 0x000000c0, 0x0007000c, 0x00000003, 0x00000087, 
-    0x00000002, 0x00000006, 0x00000068, 0x00000065, 0x00020014, 0x00000089, 0x0003002a, 0x00000089, 0x0000008a, 
-    0x0008000c, 0x00000003, 0x00000088, 0x00000002, 0x0000006c, 0x00000087, 0x00000065, 0x0000008a, 0x0004002b, 
-    0x00000006, 0x0000008d, 0x0000006b, 0x0004002b, 0x00000006, 0x0000008e, 0x00000008, 0x0004002b, 0x00000006, 
-    0x0000008f, 0x00000200, 0x000d000c, 0x00000003, 0x0000008b, 0x00000002, 0x0000000b, 0x0000008c, 0x00000088, 
-    0x0000002a, 0x0000008d, 0x0000008e, 0x00000058, 0x0000008f, 0x00000058, 0x000d000c, 0x00000003, 0x00000090, 
-    0x00000002, 0x0000000b, 0x00000091, 0x00000088, 0x0000002a, 0x0000008d, 0x0000008e, 0x0000008f, 0x0000008f, 
-    0x00000058, 0x0004002b, 0x00000006, 0x00000094, 0x00000400, 0x000d000c, 0x00000003, 0x00000092, 0x00000002, 
-    0x0000000b, 0x00000093, 0x00000088, 0x0000002a, 0x0000008d, 0x0000008e, 0x00000094, 0x0000008f, 0x00000058, 
-    0x0007000c, 0x00000003, 0x00000095, 0x00000002, 0x00000006, 0x00000068, 0x00000064, 0x0004002b, 0x00000006, 
-    0x00000098, 0x00000600, 0x0004002b, 0x00000006, 0x00000099, 0x00000060, 0x000d000c, 0x00000003, 0x00000096, 
-    0x00000002, 0x0000000b, 0x00000097, 0x00000095, 0x0000002a, 0x0000008d, 0x0000008e, 0x00000098, 0x00000099, 
-    0x00000058, 0x0009000c, 0x00000003, 0x0000009a, 0x00000002, 0x00000002, 0x0000009b, 0x0000006a, 0x00000065, 
-    0x0000006b, 0x0004002b, 0x00000006, 0x0000009e, 0x00000660, 0x000d000c, 0x00000003, 0x0000009c, 0x00000002, 
-    0x0000000b, 0x0000009d, 0x0000009a, 0x0000002a, 0x0000008d, 0x0000008e, 0x0000009e, 0x0000006a, 0x00000058, 
-    0x0004002b, 0x00000006, 0x000000a1, 0x00000680, 0x000d000c, 0x00000003, 0x0000009f, 0x00000002, 0x0000000b, 
-    0x000000a0, 0x00000095, 0x0000002a, 0x0000008d, 0x0000008e, 0x000000a1, 0x00000099, 0x00000058, 0x0004002b, 
-    0x00000006, 0x000000a4, 0x000006e0, 0x000d000c, 0x00000003, 0x000000a2, 0x00000002, 0x0000000b, 0x000000a3, 
-    0x0000009a, 0x0000002a, 0x0000008d, 0x0000008e, 0x000000a4, 0x0000006a, 0x00000058, 0x0007000c, 0x00000003, 
-    0x000000a5, 0x00000002, 0x00000005, 0x00000087, 0x00000065, 0x000d000c, 0x00000003, 0x000000a6, 0x00000002, 
-    0x0000000b, 0x000000a7, 0x000000a5, 0x00000004, 0x00000058, 0x00000058, 0x00000058, 0x0000008f, 0x00000058, 
-    0x0004002b, 0x00000006, 0x000000aa, 0x00000001, 0x000f000c, 0x00000003, 0x000000a8, 0x00000002, 0x0000000a, 
-    0x000000a9, 0x000000aa, 0x00000004, 0x00000058, 0x00000058, 0x0000000a, 0x000000a9, 0x0000008f, 0x0000006b, 
-    0x000000a6, 0x000d000c, 0x00000003, 0x000000ab, 0x00000002, 0x0000000b, 0x000000ac, 0x000000a8, 0x00000004, 
-    0x00000058, 0x00000058, 0x00000058, 0x0000008f, 0x00000058, 0x0009000c, 0x00000003, 0x000000ad, 0x00000002, 
-    0x00000002, 0x000000ae, 0x0000006a, 0x0000005c, 0x0000006b, 0x000d000c, 0x00000003, 0x000000af, 0x00000002, 
-    0x0000000b, 0x000000b0, 0x000000ad, 0x00000004, 0x00000058, 0x00000058, 0x0000008f, 0x0000006a, 0x00000058, 
-    0x0004002b, 0x00000006, 0x000000b3, 0x00000220, 0x000d000c, 0x00000003, 0x000000b1, 0x00000002, 0x0000000b, 
-    0x000000b2, 0x000000ad, 0x00000004, 0x00000058, 0x00000058, 0x000000b3, 0x0000006a, 0x00000058, 0x0004002b, 
-    0x00000006, 0x000000b6, 0x00000240, 0x0011000c, 0x00000003, 0x000000b4, 0x00000002, 0x0000000a, 0x000000b5, 
-    0x000000aa, 0x00000004, 0x00000058, 0x00000058, 0x0000000a, 0x000000b5, 0x000000b6, 0x0000006b, 0x000000ab, 
-    0x000000af, 0x000000b1, 0x0004002b, 0x00000006, 0x000000b8, 0x000014e5, 0x0008000c, 0x00000003, 0x000000b7, 
-    0x00000002, 0x00000003, 0x000000b4, 0x000000b8, 0x0000006b, 0x0004002b, 0x00000006, 0x000000bb, 0x00000700, 
-    0x0004002b, 0x00000006, 0x000000bc, 0x00000040, 0x000d000c, 0x00000003, 0x000000b9, 0x00000002, 0x0000000b, 
-    0x000000ba, 0x000000b7, 0x0000002a, 0x0000008d, 0x0000008e, 0x000000bb, 0x000000bc, 0x00000058, 0x0009000c, 
-    0x00000003, 0x000000bd, 0x00000002, 0x00000002, 0x000000be, 0x0000008e, 0x0000005c, 0x0000006b, 0x0008000c, 
-    0x00000003, 0x000000bf, 0x00000002, 0x00000003, 0x000000bd, 0x000000b8, 0x0000006b, 0x000d000c, 0x00000003, 
-    0x000000c0, 0x00000002, 0x0000000b, 0x000000c1, 0x000000bf, 0x00000004, 0x00000058, 0x00000058, 0x00000058, 
-    0x000000bc, 0x00000058, 0x000d000c, 0x00000003, 0x000000c2, 0x00000002, 0x0000000b, 0x000000c3, 0x000000ad, 
-    0x00000004, 0x00000058, 0x00000058, 0x00000058, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x000000c4, 
-    0x00000002, 0x0000000b, 0x000000c5, 0x000000ad, 0x00000004, 0x00000058, 0x00000058, 0x0000006a, 0x0000006a, 
-    0x00000058, 0x000d000c, 0x00000003, 0x000000c6, 0x00000002, 0x0000000b, 0x000000c7, 0x000000ad, 0x00000004, 
-    0x00000058, 0x00000058, 0x000000bc, 0x0000006a, 0x00000058, 0x0011000c, 0x00000003, 0x000000c8, 0x00000002, 
-    0x0000000a, 0x000000c9, 0x000000aa, 0x00000004, 0x00000058, 0x00000058, 0x0000000a, 0x000000c9, 0x00000099, 
-    0x0000006b, 0x000000c2, 0x000000c4, 0x000000c6, 0x000d000c, 0x00000003, 0x000000ca, 0x00000002, 0x0000000b, 
-    0x000000cb, 0x000000c8, 0x00000004, 0x00000058, 0x00000058, 0x00000058, 0x00000099, 0x00000058, 0x000d000c, 
-    0x00000003, 0x000000cc, 0x00000002, 0x0000000b, 0x000000cd, 0x000000c8, 0x00000004, 0x00000058, 0x00000058, 
-    0x00000099, 0x00000099, 0x00000058, 0x000d000c, 0x00000003, 0x000000ce, 0x00000002, 0x0000000b, 0x000000cf, 
-    0x000000c8, 0x00000004, 0x00000058, 0x00000058, 0x00000086, 0x00000099, 0x00000058, 0x0004002b, 0x00000006, 
-    0x000000d2, 0x00000120, 0x000d000c, 0x00000003, 0x000000d0, 0x00000002, 0x0000000b, 0x000000d1, 0x000000c8, 
-    0x00000004, 0x00000058, 0x00000058, 0x000000d2, 0x00000099, 0x00000058, 0x0004002b, 0x00000006, 0x000000d5, 
-    0x00000180, 0x000d000c, 0x00000003, 0x000000d3, 0x00000002, 0x0000000b, 0x000000d4, 0x000000c8, 0x00000004, 
-    0x00000058, 0x00000058, 0x000000d5, 0x00000099, 0x00000058, 0x0004002b, 0x00000006, 0x000000d8, 0x000001e0, 
-    0x000d000c, 0x00000003, 0x000000d6, 0x00000002, 0x0000000b, 0x000000d7, 0x000000c8, 0x00000004, 0x00000058, 
-    0x00000058, 0x000000d8, 0x00000099, 0x00000058, 0x0014000c, 0x00000003, 0x000000d9, 0x00000002, 0x0000000a, 
-    0x000000da, 0x000000aa, 0x00000004, 0x00000058, 0x00000058, 0x0000000a, 0x000000da, 0x000000b6, 0x0000006b, 
-    0x000000ca, 0x000000cc, 0x000000ce, 0x000000d0, 0x000000d3, 0x000000d6, 0x000d000c, 0x00000003, 0x000000db, 
-    0x00000002, 0x0000000b, 0x000000dc, 0x000000d9, 0x00000004, 0x00000058, 0x00000058, 0x000000bc, 0x000000b6, 
-    0x00000058, 0x0004002b, 0x00000006, 0x000000df, 0x00000280, 0x000d000c, 0x00000003, 0x000000dd, 0x00000002, 
-    0x0000000b, 0x000000de, 0x0000009a, 0x00000004, 0x00000058, 0x00000058, 0x000000df, 0x0000006a, 0x00000058, 
-    0x0004002b, 0x00000006, 0x000000e2, 0x000002a0, 0x0011000c, 0x00000003, 0x000000e0, 0x00000002, 0x0000000a, 
-    0x000000e1, 0x000000aa, 0x00000004, 0x00000058, 0x00000058, 0x0000000a, 0x000000e1, 0x000000e2, 0x0000006b, 
-    0x000000c0, 0x000000db, 0x000000dd, 0x0008000c, 0x00000003, 0x000000e3, 0x00000002, 0x00000003, 0x000000e0, 
-    0x000000b8, 0x0000006b, 0x0004002b, 0x00000006, 0x000000e6, 0x00000740, 0x000d000c, 0x00000003, 0x000000e4, 
-    0x00000002, 0x0000000b, 0x000000e5, 0x000000e3, 0x0000002a, 0x0000008d, 0x0000008e, 0x000000e6, 0x000000bc, 
-    0x00000058, 0x0004002b, 0x00000006, 0x000000e9, 0x00000080, 0x000d000c, 0x00000003, 0x000000e7, 0x00000002, 
-    0x0000000b, 0x000000e8, 0x00000087, 0x00000004, 0x00000058, 0x00000058, 0x00000058, 0x000000e9, 0x00000058, 
-    0x000d000c, 0x00000003, 0x000000ea, 0x00000002, 0x0000000b, 0x000000eb, 0x00000068, 0x00000004, 0x00000058, 
-    0x00000058, 0x000000e9, 0x0000006a, 0x00000058, 0x0004002b, 0x00000006, 0x000000ee, 0x000000a0, 0x000d000c, 
-    0x00000003, 0x000000ec, 0x00000002, 0x0000000b, 0x000000ed, 0x00000068, 0x00000004, 0x00000058, 0x00000058, 
-    0x000000ee, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x000000ef, 0x00000002, 0x0000000b, 0x000000f0, 
-    0x0000009a, 0x00000004, 0x00000058, 0x00000058, 0x00000086, 0x0000006a, 0x00000058, 0x0004002b, 0x00000006, 
-    0x000000f3, 0x000000e0, 0x0012000c, 0x00000003, 0x000000f1, 0x00000002, 0x0000000a, 0x000000f2, 0x000000aa, 
-    0x00000004, 0x00000058, 0x00000058, 0x0000000a, 0x000000f2, 0x000000f3, 0x0000006b, 0x000000e7, 0x000000ea, 
-    0x000000ec, 0x000000ef, 0x0008000c, 0x00000003, 0x000000f4, 0x00000002, 0x00000003, 0x000000f1, 0x000000b8, 
-    0x0000006b, 0x0004002b, 0x00000006, 0x000000f7, 0x00000780, 0x000d000c, 0x00000003, 0x000000f5, 0x00000002, 
-    0x0000000b, 0x000000f6, 0x000000f4, 0x0000002a, 0x0000008d, 0x0000008e, 0x000000f7, 0x000000bc, 0x00000058, 
-    0x0004002b, 0x00000006, 0x000000fa, 0x00000058, 0x000d000c, 0x00000003, 0x000000f8, 0x00000002, 0x0000000b, 
-    0x000000f9, 0x00000095, 0x0000002a, 0x000000fa, 0x0000008e, 0x00000058, 0x00000099, 0x00000058, 0x000d000c, 
-    0x00000003, 0x000000fb, 0x00000002, 0x0000000b, 0x000000fc, 0x00000068, 0x0000002a, 0x000000fa, 0x0000008e, 
-    0x00000099, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x000000fd, 0x00000002, 0x0000000b, 0x000000fe, 
-    0x00000095, 0x0000002a, 0x000000fa, 0x0000008e, 0x000000e9, 0x00000099, 0x00000058, 0x000d000c, 0x00000003, 
-    0x000000ff, 0x00000002, 0x0000000b, 0x00000100, 0x0000009a, 0x0000002a, 0x000000fa, 0x0000008e, 0x000000f3, 
-    0x0000006a, 0x00000058, 0x0004002b, 0x00000006, 0x00000103, 0x00000100, 0x000d000c, 0x00000003, 0x00000101, 
-    0x00000002, 0x0000000b, 0x00000102, 0x00000095, 0x0000002a, 0x000000fa, 0x0000008e, 0x00000103, 0x00000099, 
-    0x00000058, 0x0004002b, 0x00000006, 0x00000106, 0x00000160, 0x000d000c, 0x00000003, 0x00000104, 0x00000002, 
-    0x0000000b, 0x00000105, 0x00000068, 0x0000002a, 0x000000fa, 0x0000008e, 0x00000106, 0x0000006a, 0x00000058, 
-    0x0014000c, 0x00000003, 0x00000107, 0x00000002, 0x0000000a, 0x00000108, 0x000000aa, 0x0000002a, 0x000000fa, 
-    0x0000008e, 0x0000000a, 0x00000108, 0x000000d5, 0x0000006b, 0x000000f8, 0x000000fb, 0x000000fd, 0x000000ff, 
-    0x00000101, 0x00000104, 0x0007000c, 0x00000003, 0x00000109, 0x00000002, 0x00000005, 0x00000107, 0x0000006d, 
-    0x0004002b, 0x00000006, 0x0000010c, 0x000007c0, 0x0004002b, 0x00000006, 0x0000010d, 0x00000300, 0x000d000c, 
-    0x00000003, 0x0000010a, 0x00000002, 0x0000000b, 0x0000010b, 0x00000109, 0x0000002a, 0x0000008d, 0x0000008e, 
-    0x0000010c, 0x0000010d, 0x00000058, 0x0004002b, 0x00000006, 0x00000110, 0x0000003e, 0x000d000c, 0x00000003, 
-    0x0000010e, 0x00000002, 0x0000000b, 0x0000010f, 0x00000095, 0x00000027, 0x00000110, 0x0000008e, 0x00000058, 
-    0x00000099, 0x00000058, 0x000d000c, 0x00000003, 0x00000111, 0x00000002, 0x0000000b, 0x00000112, 0x00000068, 
-    0x00000027, 0x00000110, 0x0000008e, 0x00000099, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x00000113, 
-    0x00000002, 0x0000000b, 0x00000114, 0x00000095, 0x00000027, 0x00000110, 0x0000008e, 0x000000e9, 0x00000099, 
-    0x00000058, 0x000d000c, 0x00000003, 0x00000115, 0x00000002, 0x0000000b, 0x00000116, 0x00000068, 0x00000027, 
-    0x00000110, 0x0000008e, 0x000000f3, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x00000117, 0x00000002, 
-    0x0000000b, 0x00000118, 0x00000095, 0x00000027, 0x00000110, 0x0000008e, 0x00000103, 0x00000099, 0x00000058, 
-    0x000d000c, 0x00000003, 0x00000119, 0x00000002, 0x0000000b, 0x0000011a, 0x00000068, 0x00000027, 0x00000110, 
-    0x0000008e, 0x00000106, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x0000011b, 0x00000002, 0x0000000b, 
-    0x0000011c, 0x00000095, 0x00000027, 0x00000110, 0x0000008e, 0x000000d5, 0x00000099, 0x00000058, 0x000d000c, 
-    0x00000003, 0x0000011d, 0x00000002, 0x0000000b, 0x0000011e, 0x00000068, 0x00000027, 0x00000110, 0x0000008e, 
-    0x000000d8, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x0000011f, 0x00000002, 0x0000000b, 0x00000120, 
-    0x00000095, 0x00000027, 0x00000110, 0x0000008e, 0x0000008f, 0x00000099, 0x00000058, 0x0004002b, 0x00000006, 
-    0x00000123, 0x00000260, 0x000d000c, 0x00000003, 0x00000121, 0x00000002, 0x0000000b, 0x00000122, 0x00000068, 
-    0x00000027, 0x00000110, 0x0000008e, 0x00000123, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x00000124, 
-    0x00000002, 0x0000000b, 0x00000125, 0x00000095, 0x00000027, 0x00000110, 0x0000008e, 0x000000df, 0x00000099, 
-    0x00000058, 0x0004002b, 0x00000006, 0x00000128, 0x000002e0, 0x000d000c, 0x00000003, 0x00000126, 0x00000002, 
-    0x0000000b, 0x00000127, 0x00000068, 0x00000027, 0x00000110, 0x0000008e, 0x00000128, 0x0000006a, 0x00000058, 
-    0x000d000c, 0x00000003, 0x00000129, 0x00000002, 0x0000000b, 0x0000012a, 0x00000095, 0x00000027, 0x00000110, 
-    0x0000008e, 0x0000010d, 0x00000099, 0x00000058, 0x0004002b, 0x00000006, 0x0000012d, 0x00000360, 0x000d000c, 
-    0x00000003, 0x0000012b, 0x00000002, 0x0000000b, 0x0000012c, 0x00000068, 0x00000027, 0x00000110, 0x0000008e, 
-    0x0000012d, 0x0000006a, 0x00000058, 0x0004002b, 0x00000006, 0x00000130, 0x00000380, 0x001c000c, 0x00000003, 
-    0x0000012e, 0x00000002, 0x0000000a, 0x0000012f, 0x000000aa, 0x00000027, 0x00000110, 0x0000008e, 0x0000000a, 
-    0x0000012f, 0x00000130, 0x0000006b, 0x0000010e, 0x00000111, 0x00000113, 0x00000115, 0x00000117, 0x00000119, 
-    0x0000011b, 0x0000011d, 0x0000011f, 0x00000121, 0x00000124, 0x00000126, 0x00000129, 0x0000012b, 0x0004002b, 
-    0x00000006, 0x00000133, 0x00000ac0, 0x000d000c, 0x00000003, 0x00000131, 0x00000002, 0x0000000b, 0x00000132, 
-    0x0000012e, 0x0000002a, 0x0000008d, 0x0000008e, 0x00000133, 0x00000130, 0x00000058, 0x0004002b, 0x00000006, 
-    0x00000136, 0x00000e40, 0x001a000c, 0x00000003, 0x00000134, 0x00000002, 0x0000000a, 0x00000135, 0x000000aa, 
-    0x0000002a, 0x0000008d, 0x0000008e, 0x0000000a, 0x00000135, 0x00000136, 0x0000006b, 0x0000008b, 0x00000090, 
-    0x00000092, 0x00000096, 0x0000009c, 0x0000009f, 0x000000a2, 0x000000b9, 0x000000e4, 0x000000f5, 0x0000010a, 
-    0x00000131, 0x0004002b, 0x00000006, 0x00000139, 0x00000011, 0x000c000c, 0x00000003, 0x00000137, 0x00000002, 
-    0x0000001a, 0x00000138, 0x00000134, 0x0000002d, 0x00000086, 0x00000139, 0x00000059, 0x00000058, 0x0004002b, 
-    0x0000003b, 0x0000013e, 0x00000003, 0x0004001c, 0x0000013d, 0x0000003a, 0x0000013e, 0x0003001e, 0x0000013c, 
-    0x0000013d, 0x00030027, 0x00000140, 0x000014e5, 0x0006001e, 0x0000013b, 0x0000013c, 0x0000003b, 0x00000140, 
-    0x00000033, 0x00040020, 0x00000141, 0x00000009, 0x0000013b, 0x0007000c, 0x00000003, 0x00000143, 0x00000002, 
-    0x00000005, 0x00000095, 0x00000064, 0x000d000c, 0x00000003, 0x00000144, 0x00000002, 0x0000000b, 0x000000a7, 
-    0x00000143, 0x00000004, 0x00000058, 0x00000058, 0x00000058, 0x000000d2, 0x00000058, 0x000f000c, 0x00000003, 
-    0x00000145, 0x00000002, 0x0000000a, 0x00000146, 0x000000aa, 0x00000004, 0x00000058, 0x00000058, 0x0000000a, 
-    0x00000146, 0x000000d2, 0x0000006b, 0x00000144, 0x000d000c, 0x00000003, 0x00000147, 0x00000002, 0x0000000b, 
-    0x00000148, 0x00000145, 0x00000004, 0x00000058, 0x00000058, 0x00000058, 0x000000d2, 0x00000058, 0x000d000c, 
-    0x00000003, 0x00000149, 0x00000002, 0x0000000b, 0x0000014a, 0x0000009a, 0x00000004, 0x00000058, 0x00000058, 
-    0x000000d2, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x0000014b, 0x00000002, 0x0000000b, 0x0000008c, 
-    0x000000a8, 0x00000004, 0x00000058, 0x00000058, 0x00000058, 0x0000008f, 0x00000058, 0x000d000c, 0x00000003, 
-    0x0000014c, 0x00000002, 0x0000000b, 0x00000091, 0x000000a8, 0x00000004, 0x00000058, 0x00000058, 0x0000008f, 
-    0x0000008f, 0x00000058, 0x000d000c, 0x00000003, 0x0000014d, 0x00000002, 0x0000000b, 0x00000093, 0x000000a8, 
-    0x00000004, 0x00000058, 0x00000058, 0x00000094, 0x0000008f, 0x00000058, 0x000d000c, 0x00000003, 0x0000014e, 
-    0x00000002, 0x0000000b, 0x00000097, 0x00000095, 0x00000004, 0x00000058, 0x00000058, 0x00000098, 0x00000099, 
-    0x00000058, 0x000d000c, 0x00000003, 0x0000014f, 0x00000002, 0x0000000b, 0x0000009d, 0x0000009a, 0x00000004, 
-    0x00000058, 0x00000058, 0x0000009e, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x00000150, 0x00000002, 
-    0x0000000b, 0x000000a0, 0x00000095, 0x00000004, 0x00000058, 0x00000058, 0x000000a1, 0x00000099, 0x00000058, 
-    0x000d000c, 0x00000003, 0x00000151, 0x00000002, 0x0000000b, 0x000000a3, 0x0000009a, 0x00000004, 0x00000058, 
-    0x00000058, 0x000000a4, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x00000152, 0x00000002, 0x0000000b, 
-    0x000000ba, 0x000000b7, 0x00000004, 0x00000058, 0x00000058, 0x000000bb, 0x000000bc, 0x00000058, 0x000d000c, 
-    0x00000003, 0x00000153, 0x00000002, 0x0000000b, 0x000000e5, 0x000000e3, 0x00000004, 0x00000058, 0x00000058, 
-    0x000000e6, 0x000000bc, 0x00000058, 0x000d000c, 0x00000003, 0x00000154, 0x00000002, 0x0000000b, 0x000000f6, 
-    0x000000f4, 0x00000004, 0x00000058, 0x00000058, 0x000000f7, 0x000000bc, 0x00000058, 0x000d000c, 0x00000003, 
-    0x00000155, 0x00000002, 0x0000000b, 0x000000f9, 0x00000095, 0x00000004, 0x00000058, 0x00000058, 0x00000058, 
-    0x00000099, 0x00000058, 0x000d000c, 0x00000003, 0x00000156, 0x00000002, 0x0000000b, 0x000000fc, 0x00000068, 
-    0x00000004, 0x00000058, 0x00000058, 0x00000099, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x00000157, 
-    0x00000002, 0x0000000b, 0x000000fe, 0x00000095, 0x00000004, 0x00000058, 0x00000058, 0x000000e9, 0x00000099, 
-    0x00000058, 0x000d000c, 0x00000003, 0x00000158, 0x00000002, 0x0000000b, 0x00000100, 0x0000009a, 0x00000004, 
-    0x00000058, 0x00000058, 0x000000f3, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x00000159, 0x00000002, 
-    0x0000000b, 0x00000102, 0x00000095, 0x00000004, 0x00000058, 0x00000058, 0x00000103, 0x00000099, 0x00000058, 
-    0x000d000c, 0x00000003, 0x0000015a, 0x00000002, 0x0000000b, 0x00000105, 0x00000068, 0x00000004, 0x00000058, 
-    0x00000058, 0x00000106, 0x0000006a, 0x00000058, 0x0014000c, 0x00000003, 0x0000015b, 0x00000002, 0x0000000a, 
-    0x0000015c, 0x000000aa, 0x00000004, 0x00000058, 0x00000058, 0x0000000a, 0x0000015c, 0x000000d5, 0x0000006b, 
-    0x00000155, 0x00000156, 0x00000157, 0x00000158, 0x00000159, 0x0000015a, 0x0007000c, 0x00000003, 0x0000015d, 
-    0x00000002, 0x00000005, 0x0000015b, 0x0000006d, 0x000d000c, 0x00000003, 0x0000015e, 0x00000002, 0x0000000b, 
-    0x000000a7, 0x0000015d, 0x00000004, 0x00000058, 0x00000058, 0x00000058, 0x0000010d, 0x00000058, 0x000f000c, 
-    0x00000003, 0x0000015f, 0x00000002, 0x0000000a, 0x00000160, 0x000000aa, 0x00000004, 0x00000058, 0x00000058, 
-    0x0000000a, 0x00000160, 0x0000010d, 0x0000006b, 0x0000015e, 0x000d000c, 0x00000003, 0x00000161, 0x00000002, 
-    0x0000000b, 0x0000010b, 0x0000015f, 0x00000004, 0x00000058, 0x00000058, 0x0000010c, 0x0000010d, 0x00000058, 
-    0x000d000c, 0x00000003, 0x00000162, 0x00000002, 0x0000000b, 0x0000010f, 0x00000095, 0x00000004, 0x00000058, 
-    0x00000058, 0x00000058, 0x00000099, 0x00000058, 0x000d000c, 0x00000003, 0x00000163, 0x00000002, 0x0000000b, 
-    0x00000112, 0x00000068, 0x00000004, 0x00000058, 0x00000058, 0x00000099, 0x0000006a, 0x00000058, 0x000d000c, 
-    0x00000003, 0x00000164, 0x00000002, 0x0000000b, 0x00000114, 0x00000095, 0x00000004, 0x00000058, 0x00000058, 
-    0x000000e9, 0x00000099, 0x00000058, 0x000d000c, 0x00000003, 0x00000165, 0x00000002, 0x0000000b, 0x00000116, 
-    0x00000068, 0x00000004, 0x00000058, 0x00000058, 0x000000f3, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 
-    0x00000166, 0x00000002, 0x0000000b, 0x00000118, 0x00000095, 0x00000004, 0x00000058, 0x00000058, 0x00000103, 
-    0x00000099, 0x00000058, 0x000d000c, 0x00000003, 0x00000167, 0x00000002, 0x0000000b, 0x0000011a, 0x00000068, 
-    0x00000004, 0x00000058, 0x00000058, 0x00000106, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x00000168, 
-    0x00000002, 0x0000000b, 0x0000011c, 0x00000095, 0x00000004, 0x00000058, 0x00000058, 0x000000d5, 0x00000099, 
-    0x00000058, 0x000d000c, 0x00000003, 0x00000169, 0x00000002, 0x0000000b, 0x0000011e, 0x00000068, 0x00000004, 
-    0x00000058, 0x00000058, 0x000000d8, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x0000016a, 0x00000002, 
-    0x0000000b, 0x00000120, 0x00000095, 0x00000004, 0x00000058, 0x00000058, 0x0000008f, 0x00000099, 0x00000058, 
-    0x000d000c, 0x00000003, 0x0000016b, 0x00000002, 0x0000000b, 0x00000122, 0x00000068, 0x00000004, 0x00000058, 
-    0x00000058, 0x00000123, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x0000016c, 0x00000002, 0x0000000b, 
-    0x00000125, 0x00000095, 0x00000004, 0x00000058, 0x00000058, 0x000000df, 0x00000099, 0x00000058, 0x000d000c, 
-    0x00000003, 0x0000016d, 0x00000002, 0x0000000b, 0x00000127, 0x00000068, 0x00000004, 0x00000058, 0x00000058, 
-    0x00000128, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x0000016e, 0x00000002, 0x0000000b, 0x0000012a, 
-    0x00000095, 0x00000004, 0x00000058, 0x00000058, 0x0000010d, 0x00000099, 0x00000058, 0x000d000c, 0x00000003, 
-    0x0000016f, 0x00000002, 0x0000000b, 0x0000012c, 0x00000068, 0x00000004, 0x00000058, 0x00000058, 0x0000012d, 
-    0x0000006a, 0x00000058, 0x001c000c, 0x00000003, 0x00000170, 0x00000002, 0x0000000a, 0x00000171, 0x000000aa, 
-    0x00000004, 0x00000058, 0x00000058, 0x0000000a, 0x00000171, 0x00000130, 0x0000006b, 0x00000162, 0x00000163, 
-    0x00000164, 0x00000165, 0x00000166, 0x00000167, 0x00000168, 0x00000169, 0x0000016a, 0x0000016b, 0x0000016c, 
-    0x0000016d, 0x0000016e, 0x0000016f, 0x000d000c, 0x00000003, 0x00000172, 0x00000002, 0x0000000b, 0x00000132, 
-    0x00000170, 0x00000004, 0x00000058, 0x00000058, 0x00000133, 0x00000130, 0x00000058, 0x001a000c, 0x00000003, 
-    0x00000173, 0x00000002, 0x0000000a, 0x00000174, 0x000000aa, 0x00000004, 0x00000058, 0x00000058, 0x0000000a, 
-    0x00000174, 0x00000136, 0x0000006b, 0x0000014b, 0x0000014c, 0x0000014d, 0x0000014e, 0x0000014f, 0x00000150, 
-    0x00000151, 0x00000152, 0x00000153, 0x00000154, 0x00000161, 0x00000172, 0x0008000c, 0x00000003, 0x00000175, 
-    0x00000002, 0x00000003, 0x00000173, 0x000000b8, 0x0000006b, 0x0004002b, 0x00000006, 0x00000178, 0x00000140, 
-    0x000d000c, 0x00000003, 0x00000176, 0x00000002, 0x0000000b, 0x00000177, 0x00000175, 0x00000004, 0x00000058, 
-    0x00000058, 0x00000178, 0x000000bc, 0x00000058, 0x000d000c, 0x00000003, 0x00000179, 0x00000002, 0x0000000b, 
-    0x0000017a, 0x0000006c, 0x00000004, 0x00000058, 0x00000058, 0x000000d5, 0x000000bc, 0x00000058, 0x0004002b, 
-    0x00000006, 0x0000017d, 0x000001c0, 0x0012000c, 0x00000003, 0x0000017b, 0x00000002, 0x0000000a, 0x0000017c, 
-    0x000000aa, 0x00000004, 0x00000058, 0x00000058, 0x0000000a, 0x0000017c, 0x0000017d, 0x0000006b, 0x00000147, 
-    0x00000149, 0x00000176, 0x00000179, 0x0004002b, 0x00000006, 0x00000180, 0x00000052, 0x00040020, 0x00000181, 
-    0x00000009, 0x00000140, 0x0004002b, 0x0000003b, 0x00000185, 0x00000000, 0x00030027, 0x00000187, 0x000014e5, 
-    0x0004002b, 0x0000003b, 0x0000018a, 0x00000004, 0x0004001c, 0x00000189, 0x00000038, 0x0000018a, 0x0003001e, 
-    0x00000186, 0x00000189, 0x0004002b, 0x0000003b, 0x000001a6, 0x00000001, 0x00040020, 0x000001df, 0x000014e5, 
-    0x0000003a, 0x00040020, 0x000001e2, 0x000014e5, 0x0000003b, 0x0004002b, 0x0000003b, 0x000001e5, 0x00000005, 
-    0x0004002b, 0x0000003b, 0x000001e8, 0x00000006, 0x0004002b, 0x0000003b, 0x000001eb, 0x00000007, 0x00040020, 
-    0x000001ec, 0x000014e5, 0x0000003d, 0x0004002b, 0x0000003b, 0x000001ef, 0x00000008, 0x00040020, 0x000001f0, 
-    0x000014e5, 0x0000003f, 0x0004002b, 0x0000003b, 0x000001f3, 0x00000009, 0x00040020, 0x000001f4, 0x000014e5, 
-    0x00000041, 0x0004002b, 0x0000003b, 0x000001f7, 0x0000000a, 0x00030027, 0x000001f9, 0x000014e5, 0x0008001e, 
-    0x000001fc, 0x0000003a, 0x00000032, 0x0000003a, 0x0000003b, 0x0000003a, 0x00000032, 0x0004001c, 0x000001fb, 
-    0x000001fc, 0x00000044, 0x00040020, 0x000001fd, 0x000014e5, 0x000001fb, 0x00040020, 0x000001ff, 0x000014e5, 
-    0x000001fc, 0x00040020, 0x00000203, 0x000014e5, 0x00000032, 0x0004002b, 0x0000003b, 0x0000021e, 0x0000000b, 
-    0x00030027, 0x00000220, 0x000014e5, 0x0004002b, 0x0000003b, 0x0000023a, 0x0000000c, 0x0004002b, 0x0000003b, 
-    0x0000023d, 0x0000000d, 0x0004002b, 0x00000006, 0x00000244, 0x000000c3, 0x0004002b, 0x00000006, 0x00000245, 
-    0x00000009, 0x0004002b, 0x00000006, 0x00000248, 0x00000010, 0x000c000c, 0x00000003, 0x00000246, 0x00000002, 
-    0x0000001a, 0x00000247, 0x000000ad, 0x0000002d, 0x00000244, 0x00000248, 0x00000059, 0x00000058, 0x0004002b, 
-    0x00000006, 0x0000024c, 0x000000c7, 0x000c000c, 0x00000003, 0x0000024d, 0x00000002, 0x0000001a, 0x0000024e, 
-    0x0000006c, 0x0000002d, 0x0000024c, 0x00000248, 0x00000059, 0x00000058, 0x0004002b, 0x00000032, 0x00000252, 
-    0x40000000, 0x0004002b, 0x00000032, 0x00000254, 0x3f800000, 0x0004002b, 0x00000006, 0x00000258, 0x000000ca, 
-    0x000c000c, 0x00000003, 0x00000259, 0x00000002, 0x0000001a, 0x0000025a, 0x00000087, 0x0000002d, 0x00000258, 
-    0x00000248, 0x00000059, 0x00000058, 0x0004002b, 0x00000006, 0x00000260, 0x000000cd, 0x000d000c, 0x00000003, 
-    0x00000261, 0x00000002, 0x0000000b, 0x00000262, 0x00000095, 0x00000004, 0x00000058, 0x00000058, 0x00000058, 
-    0x00000099, 0x00000058, 0x000d000c, 0x00000003, 0x00000263, 0x00000002, 0x0000000b, 0x00000264, 0x00000068, 
-    0x00000004, 0x00000058, 0x00000058, 0x00000099, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x00000265, 
-    0x00000002, 0x0000000b, 0x00000266, 0x00000095, 0x00000004, 0x00000058, 0x00000058, 0x000000e9, 0x00000099, 
-    0x00000058, 0x000d000c, 0x00000003, 0x00000267, 0x00000002, 0x0000000b, 0x00000268, 0x00000068, 0x00000004, 
-    0x00000058, 0x00000058, 0x000000f3, 0x0000006a, 0x00000058, 0x0012000c, 0x00000003, 0x00000269, 0x00000002, 
-    0x0000000a, 0x0000026a, 0x000000aa, 0x00000004, 0x00000058, 0x00000058, 0x0000000a, 0x0000026a, 0x00000103, 
-    0x0000006b, 0x00000261, 0x00000263, 0x00000265, 0x00000267, 0x000c000c, 0x00000003, 0x0000026b, 0x00000002, 
-    0x0000001a, 0x0000026c, 0x00000269, 0x0000002d, 0x00000260, 0x00000007, 0x00000059, 0x00000058, 0x0004002b, 
-    0x00000006, 0x0000026f, 0x000000cf, 0x0004002b, 0x00000032, 0x00000273, 0x00000000, 0x0007002c, 0x00000038, 
-    0x00000272, 0x00000273, 0x00000273, 0x00000273, 0x00000254, 0x0004002b, 0x00000006, 0x00000279, 0x000000d1, 
-    0x0004002b, 0x00000006, 0x00000285, 0x000000d2, 0x00040020, 0x00000286, 0x00000007, 0x00000032, 0x0004002b, 
-    0x00000032, 0x00000288, 0x3a83126f, 0x0004002b, 0x00000006, 0x0000028d, 0x000000d3, 0x0004002b, 0x00000032, 
-    0x0000028f, 0x749dc5ae, 0x0004002b, 0x00000006, 0x00000294, 0x000000d6, 0x0004002b, 0x00000006, 0x00000296, 
-    0x0000002a, 0x000d000c, 0x00000003, 0x00000295, 0x00000002, 0x0000000b, 0x00000102, 0x00000095, 0x0000002d, 
-    0x00000296, 0x0000008e, 0x00000058, 0x00000099, 0x00000058, 0x000d000c, 0x00000003, 0x00000297, 0x00000002, 
-    0x0000000b, 0x00000298, 0x00000068, 0x0000002d, 0x00000296, 0x0000008e, 0x00000099, 0x0000006a, 0x00000058, 
-    0x000d000c, 0x00000003, 0x00000299, 0x00000002, 0x0000000b, 0x0000029a, 0x0000009a, 0x0000002d, 0x00000296, 
-    0x0000008e, 0x000000e9, 0x0000006a, 0x00000058, 0x0011000c, 0x00000003, 0x0000029b, 0x00000002, 0x0000000a, 
-    0x0000029c, 0x000000aa, 0x0000002d, 0x00000296, 0x0000008e, 0x0000000a, 0x0000029c, 0x000000ee, 0x0000006b, 
-    0x00000295, 0x00000297, 0x00000299, 0x0004002b, 0x00000006, 0x0000029f, 0x0000000e, 0x000c000c, 0x00000003, 
-    0x0000029d, 0x00000002, 0x0000001a, 0x0000029e, 0x0000029b, 0x0000002d, 0x00000294, 0x0000029f, 0x00000059, 
-    0x00000058, 0x0004002b, 0x00000006, 0x000002a2, 0x000000d7, 0x0006002c, 0x0000003a, 0x000002a4, 0x00000273, 
-    0x00000273, 0x00000273, 0x0004002b, 0x00000006, 0x000002a9, 0x000000d8, 0x0004002b, 0x00000006, 0x000002af, 
-    0x000000d9, 0x00040020, 0x000002b0, 0x00000007, 0x0000003b, 0x0004002b, 0x00000006, 0x000002b6, 0x000000dd, 
-    0x00040020, 0x000002b9, 0x000014da, 0x00000051, 0x000214dd, 0x000002c2, 0x00040020, 0x000002c4, 0x00000000, 
-    0x000002c2, 0x000e000c, 0x00000003, 0x000002c6, 0x00000002, 0x0000000a, 0x000002c7, 0x00000058, 0x00000004, 
-    0x00000058, 0x00000058, 0x0000000a, 0x000002c7, 0x00000058, 0x0000006b, 0x0004002b, 0x00000006, 0x000002ca, 
-    0x00000024, 0x0004002b, 0x00000006, 0x000002cb, 0x00000051, 0x0004002b, 0x00000006, 0x000002cc, 0x000000ff, 
-    0x000c000c, 0x00000003, 0x000002d2, 0x00000002, 0x0000001a, 0x00000102, 0x00000095, 0x0000002d, 0x000000f3, 
-    0x00000070, 0x00000059, 0x00000058, 0x0004002b, 0x00000006, 0x000002d7, 0x000000e3, 0x00040017, 0x000002d8, 
-    0x0000003b, 0x00000002, 0x00090019, 0x000002dc, 0x00000032, 0x00000001, 0x00000002, 0x00000000, 0x00000000, 
-    0x00000002, 0x00000000, 0x00040020, 0x000002de, 0x00000000, 0x000002dc, 0x000e000c, 0x00000003, 0x000002e0, 
-    0x00000002, 0x0000000a, 0x000002c7, 0x00000058, 0x00000004, 0x00000058, 0x00000058, 0x0000000a, 0x000002c7, 
-    0x00000058, 0x0000006b, 0x0004002b, 0x00000006, 0x000002e3, 0x00000026, 0x0004002b, 0x00000006, 0x000002e4, 
-    0x00000045, 0x0005001e, 0x000002ef, 0x00000039, 0x00000006, 0x00000006, 0x00040020, 0x000002f0, 0x00000007, 
-    0x000002ef, 0x00040015, 0x000002f3, 0x00000008, 0x00000000, 0x00040020, 0x000002f4, 0x000014e5, 0x000002f3, 
-    0x0005001e, 0x000002f6, 0x00000006, 0x00000006, 0x00000006, 0x0008001e, 0x000002f5, 0x000002f6, 0x000002f6, 
-    0x000002f6, 0x000002f6, 0x000002f6, 0x000002f6, 0x0005001e, 0x000002f2, 0x000002f4, 0x000002f5, 0x0000003b, 
-    0x00040020, 0x000002f7, 0x00000007, 0x000002f2, 0x0006001e, 0x000002f9, 0x00000038, 0x00000032, 0x00000032, 
-    0x0000003b, 0x00040020, 0x000002fa, 0x00000007, 0x000002f9, 0x00040017, 0x000002fc, 0x0000003b, 0x00000003, 
-    0x00040020, 0x000002fd, 0x00000007, 0x000002fc, 0x00040020, 0x0000030a, 0x00000007, 0x00000043, 0x0004002b, 
-    0x00000006, 0x00000313, 0x000000ea, 0x000e000c, 0x00000003, 0x00000311, 0x00000002, 0x00000014, 0x00000312, 
-    0x00000057, 0x0000002d, 0x00000313, 0x0000005c, 0x0000000a, 0x00000312, 0x00000058, 0x00000313, 0x0009000c, 
-    0x00000003, 0x00000328, 0x00000002, 0x0000006b, 0x00000311, 0x0000000a, 0x00000060, 0x00000329, 0x000d000c, 
-    0x00000003, 0x0000032a, 0x00000002, 0x0000001a, 0x0000029e, 0x0000029b, 0x0000002d, 0x00000313, 0x0000005c, 
-    0x00000311, 0x00000058, 0x000000aa, 0x00040020, 0x0000032d, 0x000014de, 0x00000051, 0x0003001e, 0x00000331, 
-    0x00000033, 0x00040020, 0x00000333, 0x000014db, 0x00000331, 0x000d000c, 0x00000003, 0x00000335, 0x00000002, 
-    0x0000000b, 0x00000336, 0x0000006c, 0x00000004, 0x00000058, 0x00000058, 0x00000058, 0x000000bc, 0x00000058, 
-    0x000f000c, 0x00000003, 0x00000337, 0x00000002, 0x0000000a, 0x00000338, 0x000000aa, 0x00000004, 0x00000058, 
-    0x00000058, 0x0000000a, 0x00000338, 0x000000bc, 0x0000006b, 0x00000335, 0x0004002b, 0x00000006, 0x0000033b, 
-    0x000000ee, 0x000c000c, 0x00000003, 0x0000033e, 0x00000002, 0x0000001a, 0x00000336, 0x00000095, 0x0000002d, 
-    0x0000033b, 0x00000070, 0x00000311, 0x00000058, 0x0004002b, 0x00000006, 0x00000348, 0x000000f1, 0x000c000c, 
-    0x00000003, 0x00000349, 0x00000002, 0x0000001a, 0x0000034a, 0x000000ad, 0x0000002d, 0x00000348, 0x0000008e, 
-    0x00000311, 0x00000058, 0x00040020, 0x0000034d, 0x00000001, 0x00000006, 0x0004002b, 0x00000006, 0x00000351, 
-    0x000000f2, 0x000c000c, 0x00000003, 0x00000352, 0x00000002, 0x0000001a, 0x00000353, 0x000000ad, 0x0000002d, 
-    0x00000351, 0x0000008e, 0x00000311, 0x00000058, 0x0004002b, 0x00000006, 0x00000359, 0x000000f3, 0x000c000c, 
-    0x00000003, 0x0000035a, 0x00000002, 0x0000001a, 0x0000035b, 0x000000ad, 0x0000002d, 0x00000359, 0x0000008e, 
-    0x00000311, 0x00000058, 0x0004002b, 0x00000006, 0x00000361, 0x000000f6, 0x0004002b, 0x00000006, 0x00000363, 
-    0x00000019, 0x000c000c, 0x00000003, 0x00000362, 0x00000002, 0x0000001a, 0x00000138, 0x00000134, 0x0000002d, 
-    0x00000361, 0x00000363, 0x00000311, 0x00000058, 0x0004002b, 0x00000006, 0x0000040a, 0x000000f7, 0x0004002b, 
-    0x00000006, 0x0000040c, 0x00000063, 0x000d000c, 0x00000003, 0x0000040b, 0x00000002, 0x0000000b, 0x000000ac, 
-    0x00000088, 0x0000002a, 0x0000040c, 0x0000008e, 0x00000058, 0x0000008f, 0x00000058, 0x000d000c, 0x00000003, 
-    0x0000040d, 0x00000002, 0x0000000b, 0x000000b0, 0x000000ad, 0x0000002a, 0x0000040c, 0x0000008e, 0x0000008f, 
-    0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x0000040e, 0x00000002, 0x0000000b, 0x000000b2, 0x000000ad, 
-    0x0000002a, 0x0000040c, 0x0000008e, 0x000000b3, 0x0000006a, 0x00000058, 0x0011000c, 0x00000003, 0x0000040f, 
-    0x00000002, 0x0000000a, 0x00000410, 0x000000aa, 0x0000002a, 0x0000040c, 0x0000008e, 0x0000000a, 0x00000410, 
-    0x000000b6, 0x0000006b, 0x0000040b, 0x0000040d, 0x0000040e, 0x000c000c, 0x00000003, 0x00000411, 0x00000002, 
-    0x0000001a, 0x00000412, 0x0000040f, 0x0000002d, 0x0000040a, 0x00000363, 0x00000311, 0x00000058, 0x00040020, 
-    0x00000431, 0x000014e5, 0x00000006, 0x0004002b, 0x00000006, 0x00000439, 0x000000f8, 0x0004002b, 0x00000006, 
-    0x0000043b, 0x0000004a, 0x000d000c, 0x00000003, 0x0000043a, 0x00000002, 0x0000000b, 0x000000c1, 0x000000bf, 
-    0x0000002a, 0x0000043b, 0x0000008e, 0x00000058, 0x000000bc, 0x00000058, 0x0004002b, 0x00000006, 0x0000043d, 
-    0x00000031, 0x000d000c, 0x00000003, 0x0000043c, 0x00000002, 0x0000000b, 0x000000c3, 0x000000ad, 0x0000002a, 
-    0x0000043d, 0x0000008e, 0x00000058, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x0000043e, 0x00000002, 
-    0x0000000b, 0x000000c5, 0x000000ad, 0x0000002a, 0x0000043d, 0x0000008e, 0x0000006a, 0x0000006a, 0x00000058, 
-    0x000d000c, 0x00000003, 0x0000043f, 0x00000002, 0x0000000b, 0x000000c7, 0x000000ad, 0x0000002a, 0x0000043d, 
-    0x0000008e, 0x000000bc, 0x0000006a, 0x00000058, 0x0011000c, 0x00000003, 0x00000440, 0x00000002, 0x0000000a, 
-    0x00000441, 0x000000aa, 0x0000002a, 0x0000043d, 0x0000008e, 0x0000000a, 0x00000441, 0x00000099, 0x0000006b, 
-    0x0000043c, 0x0000043e, 0x0000043f, 0x0004002b, 0x00000006, 0x00000443, 0x00000038, 0x000d000c, 0x00000003, 
-    0x00000442, 0x00000002, 0x0000000b, 0x000000cb, 0x00000440, 0x0000002a, 0x00000443, 0x0000008e, 0x00000058, 
-    0x00000099, 0x00000058, 0x000d000c, 0x00000003, 0x00000444, 0x00000002, 0x0000000b, 0x000000cd, 0x00000440, 
-    0x0000002a, 0x00000443, 0x0000008e, 0x00000099, 0x00000099, 0x00000058, 0x000d000c, 0x00000003, 0x00000445, 
-    0x00000002, 0x0000000b, 0x000000cf, 0x00000440, 0x0000002a, 0x00000443, 0x0000008e, 0x00000086, 0x00000099, 
-    0x00000058, 0x000d000c, 0x00000003, 0x00000446, 0x00000002, 0x0000000b, 0x000000d1, 0x00000440, 0x0000002a, 
-    0x00000443, 0x0000008e, 0x000000d2, 0x00000099, 0x00000058, 0x000d000c, 0x00000003, 0x00000447, 0x00000002, 
-    0x0000000b, 0x000000d4, 0x00000440, 0x0000002a, 0x00000443, 0x0000008e, 0x000000d5, 0x00000099, 0x00000058, 
-    0x000d000c, 0x00000003, 0x00000448, 0x00000002, 0x0000000b, 0x000000d7, 0x00000440, 0x0000002a, 0x00000443, 
-    0x0000008e, 0x000000d8, 0x00000099, 0x00000058, 0x0014000c, 0x00000003, 0x00000449, 0x00000002, 0x0000000a, 
-    0x0000044a, 0x000000aa, 0x0000002a, 0x00000443, 0x0000008e, 0x0000000a, 0x0000044a, 0x000000b6, 0x0000006b, 
-    0x00000442, 0x00000444, 0x00000445, 0x00000446, 0x00000447, 0x00000448, 0x000d000c, 0x00000003, 0x0000044b, 
-    0x00000002, 0x0000000b, 0x000000dc, 0x00000449, 0x0000002a, 0x0000043b, 0x0000008e, 0x000000bc, 0x000000b6, 
-    0x00000058, 0x000d000c, 0x00000003, 0x0000044c, 0x00000002, 0x0000000b, 0x000000de, 0x0000009a, 0x0000002a, 
-    0x0000043b, 0x0000008e, 0x000000df, 0x0000006a, 0x00000058, 0x0011000c, 0x00000003, 0x0000044d, 0x00000002, 
-    0x0000000a, 0x0000044e, 0x000000aa, 0x0000002a, 0x0000043b, 0x0000008e, 0x0000000a, 0x0000044e, 0x000000e2, 
-    0x0000006b, 0x0000043a, 0x0000044b, 0x0000044c, 0x000c000c, 0x00000003, 0x0000044f, 0x00000002, 0x0000001a, 
-    0x00000450, 0x0000044d, 0x0000002d, 0x00000439, 0x00000363, 0x00000311, 0x00000058, 0x00040020, 0x00000453, 
-    0x000014e5, 0x000002f4, 0x00030027, 0x00000457, 0x000014e5, 0x00030027, 0x0000045a, 0x000014e5, 0x0004002b, 
-    0x00000006, 0x00000491, 0x000000f9, 0x0004002b, 0x00000006, 0x00000493, 0x00000042, 0x000d000c, 0x00000003, 
-    0x00000492, 0x00000002, 0x0000000b, 0x000000e8, 0x00000087, 0x0000002a, 0x00000493, 0x0000008e, 0x00000058, 
-    0x000000e9, 0x00000058, 0x000d000c, 0x00000003, 0x00000494, 0x00000002, 0x0000000b, 0x000000eb, 0x00000068, 
-    0x0000002a, 0x00000493, 0x0000008e, 0x000000e9, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x00000495, 
-    0x00000002, 0x0000000b, 0x000000ed, 0x00000068, 0x0000002a, 0x00000493, 0x0000008e, 0x000000ee, 0x0000006a, 
-    0x00000058, 0x000d000c, 0x00000003, 0x00000496, 0x00000002, 0x0000000b, 0x000000f0, 0x0000009a, 0x0000002a, 
-    0x00000493, 0x0000008e, 0x00000086, 0x0000006a, 0x00000058, 0x0012000c, 0x00000003, 0x00000497, 0x00000002, 
-    0x0000000a, 0x00000498, 0x000000aa, 0x0000002a, 0x00000493, 0x0000008e, 0x0000000a, 0x00000498, 0x000000f3, 
-    0x0000006b, 0x00000492, 0x00000494, 0x00000495, 0x00000496, 0x000c000c, 0x00000003, 0x00000499, 0x00000002, 
-    0x0000001a, 0x0000049a, 0x00000497, 0x0000002d, 0x00000491, 0x00000363, 0x00000311, 0x00000058, 0x00040020, 
-    0x0000049d, 0x000014e5, 0x00000038, 0x0004002b, 0x00000006, 0x000004a9, 0x000000fc, 0x0007000c, 0x00000003, 
-    0x000004aa, 0x00000002, 0x00000006, 0x0000009a, 0x00000064, 0x000c000c, 0x00000003, 0x000004ab, 0x00000002, 
-    0x0000001a, 0x000000cb, 0x000004aa, 0x0000002d, 0x000004a9, 0x00000070, 0x00000311, 0x00000058, 0x00060021, 
-    0x000004b0, 0x000002fc, 0x000002f4, 0x000002f5, 0x0000003b, 0x00040020, 0x000004b6, 0x00000007, 0x000002f5, 
-    0x00040020, 0x000004b8, 0x00000007, 0x000002f4, 0x00040020, 0x000004ba, 0x000014e5, 0x000002fc, 0x00040020, 
-    0x000004bb, 0x00000007, 0x000004ba, 0x00040015, 0x000004bd, 0x00000010, 0x00000001, 0x00040017, 0x000004be, 
-    0x000004bd, 0x00000003, 0x00040020, 0x000004bf, 0x000014e5, 0x000004be, 0x00040020, 0x000004c0, 0x00000007, 
-    0x000004bf, 0x0007000c, 0x00000003, 0x000004c2, 0x00000002, 0x00000008, 0x00000058, 0x00000003, 0x0004002b, 
-    0x00000006, 0x000004c5, 0x00000044, 0x000e000c, 0x00000003, 0x000004c3, 0x00000002, 0x00000014, 0x000004c4, 
-    0x000004c2, 0x0000002d, 0x000004c5, 0x0000005c, 0x0000000a, 0x000004c4, 0x00000058, 0x000004c5, 0x000d000c, 
-    0x00000003, 0x000004d2, 0x00000002, 0x0000001a, 0x000004d3, 0x0000009a, 0x0000002d, 0x000004c5, 0x0000005c, 
-    0x000004c3, 0x00000058, 0x00000064, 0x000d000c, 0x00000003, 0x000004d6, 0x00000002, 0x0000001a, 0x00000450, 
-    0x00000449, 0x0000002d, 0x000004c5, 0x0000005c, 0x000004c3, 0x00000058, 0x0000006d, 0x000d000c, 0x00000003, 
-    0x000004d9, 0x00000002, 0x0000001a, 0x000004da, 0x000000bf, 0x0000002d, 0x000004c5, 0x0000005c, 0x000004c3, 
-    0x00000058, 0x000000aa, 0x0004002b, 0x00000006, 0x000004de, 0x00000046, 0x0004002b, 0x00000006, 0x000004e5, 
-    0x0000001e, 0x0004002b, 0x00000006, 0x000004e6, 0x0000001f, 0x0004002b, 0x00000006, 0x000004e9, 0x0000004c, 
-    0x0004002b, 0x00000006, 0x000004ec, 0x00000023, 0x0004002b, 0x00000006, 0x000004f0, 0x00000053, 0x0004002b, 
-    0x0000003b, 0x000004f2, 0xffffffff, 0x0006002c, 0x000002fc, 0x000004f1, 0x000004f2, 0x000004f2, 0x000004f2, 
-    0x0004002b, 0x00000006, 0x000004f5, 0x0000004f, 0x0008000c, 0x00000003, 0x000004f8, 0x00000002, 0x00000003, 
-    0x000004aa, 0x000000b8, 0x0000006b, 0x000c000c, 0x00000003, 0x000004f9, 0x00000002, 0x0000001a, 0x000000cb, 
-    0x000004f8, 0x0000002d, 0x000004f5, 0x00000007, 0x000004c3, 0x00000058, 0x00040015, 0x000004fc, 0x00000040, 
-    0x00000000, 0x00040015, 0x000004fe, 0x00000040, 0x00000001, 0x0004002b, 0x00000006, 0x00000505, 0x00000050, 
-    0x0004002b, 0x00000006, 0x0000050a, 0x00000049, 0x0009000c, 0x00000003, 0x0000050d, 0x00000002, 0x00000002, 
-    0x0000050e, 0x00000248, 0x00000065, 0x0000006b, 0x0007000c, 0x00000003, 0x0000050f, 0x00000002, 0x00000006, 
-    0x0000050d, 0x00000064, 0x0008000c, 0x00000003, 0x00000510, 0x00000002, 0x00000003, 0x0000050f, 0x000000b8, 
-    0x0000006b, 0x0004002b, 0x00000006, 0x00000512, 0x0000000f, 0x000c000c, 0x00000003, 0x00000511, 0x00000002, 
-    0x0000001a, 0x000000cb, 0x00000510, 0x0000002d, 0x0000050a, 0x00000512, 0x000004c3, 0x00000058, 0x0004002b, 
-    0x00000006, 0x00000522, 0x000000fd, 0x000c000c, 0x00000003, 0x00000523, 0x00000002, 0x0000001a, 0x00000524, 
-    0x00000095, 0x0000002d, 0x00000522, 0x00000070, 0x00000311, 0x00000058, 0x00070021, 0x00000529, 0x0000003a, 
-    0x000002f4, 0x000002f6, 0x00000073, 0x0000003a, 0x00040020, 0x00000530, 0x00000007, 0x00000073, 0x00040020, 
-    0x00000532, 0x00000007, 0x000002f6, 0x0007000c, 0x00000003, 0x00000538, 0x00000002, 0x00000008, 0x00000058, 
-    0x00000003, 0x0004002b, 0x00000006, 0x0000053b, 0x0000005b, 0x000e000c, 0x00000003, 0x00000539, 0x00000002, 
-    0x00000014, 0x0000053a, 0x00000538, 0x0000002d, 0x0000053b, 0x00000363, 0x0000000a, 0x0000053a, 0x00000058, 
-    0x0000053b, 0x000d000c, 0x00000003, 0x0000053e, 0x00000002, 0x0000001a, 0x00000336, 0x00000095, 0x0000002d, 
-    0x0000053b, 0x00000363, 0x00000539, 0x00000058, 0x00000065, 0x0007000c, 0x00000003, 0x00000541, 0x00000002, 
-    0x00000006, 0x000000ad, 0x00000064, 0x000d000c, 0x00000003, 0x00000542, 0x00000002, 0x0000001a, 0x00000543, 
-    0x00000541, 0x0000002d, 0x0000053b, 0x00000363, 0x00000539, 0x00000058, 0x00000064, 0x000d000c, 0x00000003, 
-    0x00000546, 0x00000002, 0x0000001a, 0x00000547, 0x00000440, 0x0000002d, 0x0000053b, 0x00000363, 0x00000539, 
-    0x00000058, 0x0000006d, 0x000d000c, 0x00000003, 0x0000054a, 0x00000002, 0x0000001a, 0x000004da, 0x000000bf, 
-    0x0000002d, 0x0000053b, 0x00000363, 0x00000539, 0x00000058, 0x000000aa, 0x0004002b, 0x00000006, 0x0000054e, 
-    0x0000005e, 0x000c000c, 0x00000003, 0x00000551, 0x00000002, 0x0000001a, 0x00000552, 0x00000095, 0x0000002d, 
-    0x0000054e, 0x00000008, 0x00000539, 0x00000058, 0x00060021, 0x00000557, 0x0000003a, 0x000002f4, 0x000002f6, 
-    0x00000006, 0x00040020, 0x0000055f, 0x00000007, 0x000001df, 0x0007000c, 0x00000003, 0x00000561, 0x00000002, 
-    0x00000008, 0x00000058, 0x00000003, 0x0004002b, 0x00000006, 0x00000564, 0x00000036, 0x000e000c, 0x00000003, 
-    0x00000562, 0x00000002, 0x00000014, 0x00000563, 0x00000561, 0x0000002d, 0x00000564, 0x00000363, 0x0000000a, 
-    0x00000563, 0x00000058, 0x00000564, 0x000d000c, 0x00000003, 0x0000056b, 0x00000002, 0x0000001a, 0x00000543, 
-    0x000000ad, 0x0000002d, 0x00000564, 0x00000363, 0x00000562, 0x00000058, 0x00000064, 0x000d000c, 0x00000003, 
-    0x0000056e, 0x00000002, 0x0000001a, 0x00000547, 0x00000440, 0x0000002d, 0x00000564, 0x00000363, 0x00000562, 
-    0x00000058, 0x0000006d, 0x000d000c, 0x00000003, 0x00000571, 0x00000002, 0x0000001a, 0x000004da, 0x000000bf, 
-    0x0000002d, 0x00000564, 0x00000363, 0x00000562, 0x00000058, 0x000000aa, 0x0004002b, 0x00000006, 0x0000057a, 
-    0x00000017, 0x0004002b, 0x00000006, 0x0000057b, 0x00000018, 0x0004002b, 0x00000006, 0x0000057e, 0x0000003f, 
-    0x0006002c, 0x0000003a, 0x0000057f, 0x00000254, 0x00000254, 0x00000254, 0x0004002b, 0x00000006, 0x00000582, 
-    0x0000003b, 0x0008000c, 0x00000003, 0x00000585, 0x00000002, 0x00000003, 0x00000095, 0x000000b8, 0x0000006b, 
-    0x000c000c, 0x00000003, 0x00000586, 0x00000002, 0x0000001a, 0x00000587, 0x00000585, 0x0000002d, 0x00000582, 
-    0x0000008e, 0x00000562, 0x00000058, 0x0004002b, 0x00000006, 0x00000596, 0x0000003c, 0x0004002b, 0x00000006, 
-    0x0000059c, 0x0000005f, 0x000c000c, 0x00000003, 0x0000059d, 0x00000002, 0x0000001a, 0x0000059e, 0x00000095, 
-    0x0000002d, 0x0000059c, 0x00000008, 0x00000539, 0x00000058, 0x000c000c, 0x00000003, 0x000005a4, 0x00000002, 
-    0x0000001a, 0x000005a5, 0x00000095, 0x0000002d, 0x00000099, 0x00000008, 0x00000539, 0x00000058, 0x0004002b, 
-    0x00000006, 0x000005b9, 0x000000fe, 0x000c000c, 0x00000003, 0x000005ba, 0x00000002, 0x0000001a, 0x000005bb, 
-    0x00000095, 0x0000002d, 0x000005b9, 0x00000070, 0x00000311, 0x00000058, 0x000c000c, 0x00000003, 0x000005c0, 
-    0x00000002, 0x0000001a, 0x000005c1, 0x0000006c, 0x0000002d, 0x000002cc, 0x00000070, 0x00000311, 0x00000058, 
-    0x00070021, 0x000005c5, 0x00000033, 0x000002f4, 0x000002f6, 0x00000073, 0x0000003a, 0x0007000c, 0x00000003, 
-    0x000005d2, 0x00000002, 0x00000008, 0x00000058, 0x00000003, 0x000e000c, 0x00000003, 0x000005d3, 0x00000002, 
-    0x00000014, 0x0000053a, 0x000005d2, 0x0000002d, 0x0000053b, 0x00000363, 0x0000000a, 0x0000053a, 0x00000058, 
-    0x0000053b, 0x000d000c, 0x00000003, 0x000005d6, 0x00000002, 0x0000001a, 0x00000336, 0x00000095, 0x0000002d, 
-    0x0000053b, 0x00000363, 0x000005d3, 0x00000058, 0x00000065, 0x000d000c, 0x00000003, 0x000005d9, 0x00000002, 
-    0x0000001a, 0x00000543, 0x00000541, 0x0000002d, 0x0000053b, 0x00000363, 0x000005d3, 0x00000058, 0x00000064, 
-    0x000d000c, 0x00000003, 0x000005dc, 0x00000002, 0x0000001a, 0x00000547, 0x00000440, 0x0000002d, 0x0000053b, 
-    0x00000363, 0x000005d3, 0x00000058, 0x0000006d, 0x000d000c, 0x00000003, 0x000005df, 0x00000002, 0x0000001a, 
-    0x000004da, 0x000000bf, 0x0000002d, 0x0000053b, 0x00000363, 0x000005d3, 0x00000058, 0x000000aa, 0x000c000c, 
-    0x00000003, 0x000005e5, 0x00000002, 0x0000001a, 0x00000552, 0x0000006c, 0x0000002d, 0x0000054e, 0x00000008, 
-    0x000005d3, 0x00000058, 0x00060021, 0x000005ea, 0x00000033, 0x000002f4, 0x000002f6, 0x00000006, 0x00040020, 
-    0x000005f2, 0x000014e5, 0x00000033, 0x00040020, 0x000005f3, 0x00000007, 0x000005f2, 0x0007000c, 0x00000003, 
-    0x000005f5, 0x00000002, 0x00000008, 0x00000058, 0x00000003, 0x000e000c, 0x00000003, 0x000005f6, 0x00000002, 
-    0x00000014, 0x00000563, 0x000005f5, 0x0000002d, 0x00000564, 0x00000363, 0x0000000a, 0x00000563, 0x00000058, 
-    0x00000564, 0x000d000c, 0x00000003, 0x000005fd, 0x00000002, 0x0000001a, 0x00000543, 0x000000ad, 0x0000002d, 
-    0x00000564, 0x00000363, 0x000005f6, 0x00000058, 0x00000064, 0x000d000c, 0x00000003, 0x00000600, 0x00000002, 
-    0x0000001a, 0x00000547, 0x00000440, 0x0000002d, 0x00000564, 0x00000363, 0x000005f6, 0x00000058, 0x0000006d, 
-    0x000d000c, 0x00000003, 0x00000603, 0x00000002, 0x0000001a, 0x000004da, 0x000000bf, 0x0000002d, 0x00000564, 
-    0x00000363, 0x000005f6, 0x00000058, 0x000000aa, 0x0005002c, 0x00000033, 0x0000060e, 0x00000254, 0x00000254, 
-    0x0008000c, 0x00000003, 0x00000613, 0x00000002, 0x00000003, 0x0000006c, 0x000000b8, 0x0000006b, 0x000c000c, 
-    0x00000003, 0x00000614, 0x00000002, 0x0000001a, 0x00000587, 0x00000613, 0x0000002d, 0x00000582, 0x0000008e, 
-    0x000005f6, 0x00000058, 0x000c000c, 0x00000003, 0x00000628, 0x00000002, 0x0000001a, 0x0000059e, 0x0000006c, 
-    0x0000002d, 0x0000059c, 0x00000008, 0x000005d3, 0x00000058, 0x000c000c, 0x00000003, 0x0000062e, 0x00000002, 
-    0x0000001a, 0x000005a5, 0x0000006c, 0x0000002d, 0x00000099, 0x00000008, 0x000005d3, 0x00000058, 0x0004002b, 
-    0x00000006, 0x00000642, 0x00000102, 0x000c000c, 0x00000003, 0x00000643, 0x00000002, 0x0000001a, 0x00000644, 
-    0x00000095, 0x0000002d, 0x00000642, 0x00000070, 0x00000311, 0x00000058, 0x00040018, 0x00000647, 0x0000003a, 
-    0x00000004, 0x00040020, 0x00000649, 0x00000001, 0x00000647, 0x0004002b, 0x00000006, 0x0000064e, 0x00000103, 
-    0x000c000c, 0x00000003, 0x0000064f, 0x00000002, 0x0000001a, 0x00000650, 0x00000095, 0x0000002d, 0x0000064e, 
-    0x00000070, 0x00000311, 0x00000058, 0x0004002b, 0x00000006, 0x00000659, 0x00000106, 0x000c000c, 0x00000003, 
-    0x0000065a, 0x00000002, 0x0000001a, 0x0000065b, 0x00000095, 0x0000002d, 0x00000659, 0x00000070, 0x00000311, 
-    0x00000058, 0x0004002b, 0x00000006, 0x00000660, 0x00000107, 0x000c000c, 0x00000003, 0x00000661, 0x00000002, 
-    0x0000001a, 0x00000662, 0x00000068, 0x0000002d, 0x00000660, 0x00000070, 0x00000311, 0x00000058, 0x0004002b, 
-    0x00000006, 0x00000666, 0x00000108, 0x000c000c, 0x00000003, 0x00000667, 0x00000002, 0x0000001a, 0x00000668, 
-    0x00000068, 0x0000002d, 0x00000666, 0x00000070, 0x00000311, 0x00000058, 0x0004002b, 0x00000006, 0x0000066c, 
-    0x0000010b, 0x0004002b, 0x00000006, 0x0000066f, 0x00000025, 0x0004002b, 0x00000006, 0x00000674, 0x0000010d, 
-    0x00090019, 0x00000677, 0x00000032, 0x00000001, 0x00000002, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 
-    0x0003001b, 0x00000678, 0x00000677, 0x0003001d, 0x00000676, 0x00000678, 0x00040020, 0x00000679, 0x00000000, 
-    0x00000676, 0x000e000c, 0x00000003, 0x0000067b, 0x00000002, 0x0000000a, 0x000002c7, 0x00000058, 0x00000004, 
-    0x00000058, 0x00000058, 0x0000000a, 0x000002c7, 0x00000058, 0x0000006b, 0x0007000c, 0x00000003, 0x0000067c, 
-    0x00000002, 0x00000005, 0x0000067b, 0x00000058, 0x0004002b, 0x00000006, 0x0000067f, 0x00000022, 0x00040020, 
-    0x00000680, 0x00000000, 0x00000678, 0x0004002b, 0x00000006, 0x0000068b, 0x00000111, 0x00040020, 0x0000068c, 
-    0x00000009, 0x00000033, 0x0004002b, 0x00000006, 0x00000692, 0x0000002c, 0x0004002b, 0x00000006, 0x00000693, 
-    0x0000002d, 0x0004002b, 0x00000006, 0x00000698, 0x00000112, 0x0004002b, 0x00000006, 0x0000069d, 0x00000113, 
-    0x0004002b, 0x00000006, 0x000006a5, 0x00000114, 0x0004002b, 0x00000006, 0x000006aa, 0x00000117, 0x000c000c, 
-    0x00000003, 0x000006ab, 0x00000002, 0x0000001a, 0x000006ac, 0x00000107, 0x0000002d, 0x000006aa, 0x00000248, 
-    0x00000311, 0x00000058, 0x00050021, 0x000006b0, 0x00000043, 0x00000037, 0x0000003a, 0x0007000c, 0x00000003, 
-    0x000006bd, 0x00000002, 0x00000008, 0x00000058, 0x00000003, 0x0004002b, 0x00000006, 0x000006c0, 0x00000088, 
-    0x000e000c, 0x00000003, 0x000006be, 0x00000002, 0x00000014, 0x000006bf, 0x000006bd, 0x0000002d, 0x000006c0, 
-    0x0000029f, 0x0000000a, 0x000006bf, 0x00000058, 0x000006c0, 0x000d000c, 0x00000003, 0x000006d1, 0x00000002, 
-    0x0000001a, 0x00000644, 0x00000095, 0x0000002d, 0x000006c0, 0x0000029f, 0x000006be, 0x00000058, 0x0000006d, 
-    0x000d000c, 0x00000003, 0x000006d4, 0x00000002, 0x0000001a, 0x00000138, 0x00000134, 0x0000002d, 0x000006c0, 
-    0x0000029f, 0x000006be, 0x00000058, 0x000000aa, 0x0004002b, 0x00000006, 0x000006d8, 0x0000008b, 0x000c000c, 
-    0x00000003, 0x000006db, 0x00000002, 0x0000001a, 0x000006ac, 0x00000107, 0x0000002d, 0x000006d8, 0x00000248, 
-    0x000006be, 0x00000058, 0x0004002b, 0x00000006, 0x000006e2, 0x0000008f, 0x0004002b, 0x00000006, 0x000006e8, 
-    0x00000091, 0x0004002b, 0x00000006, 0x000006f2, 0x00000092, 0x0004002b, 0x00000006, 0x000006f9, 0x00000093, 
-    0x0004002b, 0x00000006, 0x00000700, 0x00000094, 0x0004002b, 0x00000006, 0x00000707, 0x00000098, 0x0004002b, 
-    0x00000006, 0x0000070c, 0x00000012, 0x0004002b, 0x00000006, 0x0000070f, 0x000000a1, 0x0004002b, 0x00000006, 
-    0x00000713, 0x00000016, 0x0004002b, 0x00000006, 0x00000716, 0x000000a4, 0x0004002b, 0x00000006, 0x0000071b, 
-    0x0000000c, 0x000c000c, 0x00000003, 0x00000719, 0x00000002, 0x0000001a, 0x0000071a, 0x00000095, 0x0000002d, 
-    0x00000716, 0x0000071b, 0x000006be, 0x00000058, 0x0004002b, 0x00000006, 0x00000722, 0x000000a5, 0x000c000c, 
-    0x00000003, 0x00000723, 0x00000002, 0x0000001a, 0x00000724, 0x00000068, 0x0000002d, 0x00000722, 0x0000071b, 
-    0x000006be, 0x00000058, 0x0004002b, 0x00000006, 0x00000729, 0x000000a7, 0x0004002b, 0x00000006, 0x00000732, 
-    0x000000ab, 0x000c000c, 0x00000003, 0x00000733, 0x00000002, 0x0000001a, 0x00000734, 0x00000068, 0x0000002d, 
-    0x00000732, 0x00000007, 0x000006be, 0x00000058, 0x0004002b, 0x00000006, 0x0000073d, 0x000000ad, 0x000c000c, 
-    0x00000003, 0x0000073e, 0x00000002, 0x0000001a, 0x0000073f, 0x00000068, 0x0000002d, 0x0000073d, 0x00000007, 
-    0x000006be, 0x00000058, 0x0004002b, 0x00000006, 0x0000074c, 0x000000ae, 0x0004002b, 0x00000006, 0x00000752, 
-    0x000000af, 0x0004002b, 0x00000006, 0x00000759, 0x0000009b, 0x0004002b, 0x00000006, 0x00000764, 0x0000009c, 
-    0x000c000c, 0x00000003, 0x00000765, 0x00000002, 0x0000001a, 0x00000724, 0x00000068, 0x0000002d, 0x00000764, 
-    0x00000007, 0x000006be, 0x00000058, 0x0004002b, 0x00000006, 0x0000076b, 0x0000009e, 0x0004002b, 0x00000006, 
-    0x00000775, 0x000000b2, 0x0004002b, 0x00000006, 0x0000077a, 0x0000011a, 0x000c000c, 0x00000003, 0x0000077b, 
-    0x00000002, 0x0000001a, 0x0000077c, 0x00000095, 0x0000002d, 0x0000077a, 0x00000070, 0x00000311, 0x00000058, 
-    0x0004002b, 0x00000006, 0x00000781, 0x0000011b, 0x000c000c, 0x00000003, 0x00000782, 0x00000002, 0x0000001a, 
-    0x00000783, 0x00000095, 0x0000002d, 0x00000781, 0x00000070, 0x00000311, 0x00000058, 0x00040020, 0x00000786, 
-    0x00000001, 0x0000003a, 0x0004002b, 0x00000006, 0x0000078b, 0x0000011c, 0x000c000c, 0x00000003, 0x0000078c, 
-    0x00000002, 0x0000001a, 0x0000078d, 0x00000095, 0x0000002d, 0x0000078b, 0x00000070, 0x00000311, 0x00000058, 
-    0x0004002b, 0x00000006, 0x00000793, 0x0000011f, 0x000c000c, 0x00000003, 0x00000794, 0x00000002, 0x0000001a, 
-    0x00000795, 0x00000068, 0x0000002d, 0x00000793, 0x00000245, 0x00000311, 0x00000058, 0x00070021, 0x00000799, 
-    0x00000032, 0x0000003a, 0x0000003a, 0x0000003a, 0x00000043, 0x0007000c, 0x00000003, 0x000007a8, 0x00000002, 
-    0x00000008, 0x00000058, 0x00000003, 0x0004002b, 0x00000006, 0x000007ab, 0x00000007, 0x000e000c, 0x00000003, 
-    0x000007a9, 0x00000002, 0x00000014, 0x000007aa, 0x000007a8, 0x0000002d, 0x0000008d, 0x000007ab, 0x0000000a, 
-    0x000007aa, 0x00000058, 0x0000008d, 0x000d000c, 0x00000003, 0x000007ba, 0x00000002, 0x0000001a, 0x000006ac, 
-    0x00000107, 0x0000002d, 0x0000008d, 0x000007ab, 0x000007a9, 0x00000058, 0x00000065, 0x000d000c, 0x00000003, 
-    0x000007bd, 0x00000002, 0x0000001a, 0x000007be, 0x00000095, 0x0000002d, 0x0000008d, 0x000007ab, 0x000007a9, 
-    0x00000058, 0x00000064, 0x000d000c, 0x00000003, 0x000007c1, 0x00000002, 0x0000001a, 0x00000650, 0x00000095, 
-    0x0000002d, 0x0000008d, 0x000007ab, 0x000007a9, 0x00000058, 0x0000006d, 0x000d000c, 0x00000003, 0x000007c4, 
-    0x00000002, 0x0000001a, 0x00000644, 0x00000095, 0x0000002d, 0x0000008d, 0x000007ab, 0x000007a9, 0x00000058, 
-    0x000000aa, 0x0004002b, 0x00000006, 0x000007c8, 0x0000006e, 0x000c000c, 0x00000003, 0x000007cb, 0x00000002, 
-    0x0000001a, 0x000007cc, 0x00000269, 0x0000002d, 0x000007c8, 0x00000007, 0x000007a9, 0x00000058, 0x0004002b, 
-    0x00000006, 0x000007cf, 0x00000070, 0x0004002b, 0x00000006, 0x000007d7, 0x00000071, 0x0004002b, 0x00000006, 
-    0x000007de, 0x00000072, 0x0004002b, 0x00000006, 0x000007e4, 0x00000074, 0x0004002b, 0x00000006, 0x000007f4, 
-    0x00000077, 0x000c000c, 0x00000003, 0x000007f5, 0x00000002, 0x0000001a, 0x000007f6, 0x0000029b, 0x0000002d, 
-    0x000007f4, 0x0000029f, 0x000007a9, 0x00000058, 0x0004002b, 0x00000006, 0x000007f9, 0x00000078, 0x0004002b, 
-    0x00000006, 0x000007ff, 0x0000007d, 0x0004002b, 0x00000006, 0x0000080d, 0x00000081, 0x0004002b, 0x0000003b, 
-    0x00000810, 0x000003e8, 0x0004002b, 0x00000006, 0x0000081a, 0x00000123, 0x000c000c, 0x00000003, 0x0000081b, 
-    0x00000002, 0x0000001a, 0x00000102, 0x00000095, 0x0000002d, 0x0000081a, 0x00000070, 0x00000311, 0x00000058, 
-    0x00090021, 0x00000822, 0x0000003a, 0x0000003a, 0x00000032, 0x00000032, 0x0000003a, 0x0000003a, 0x0000003a, 
-    0x0008001e, 0x00000830, 0x0000003a, 0x0000003a, 0x0000003a, 0x0000003a, 0x0000003a, 0x00000032, 0x00040020, 
-    0x00000831, 0x00000007, 0x00000830, 0x000e001e, 0x00000834, 0x0000003a, 0x00000032, 0x00000033, 0x00000032, 
-    0x0000003a, 0x00000032, 0x00000032, 0x00000032, 0x0000003a, 0x0000003a, 0x0000003a, 0x0000003a, 0x00040020, 
-    0x00000835, 0x00000007, 0x00000834, 0x0007000c, 0x00000003, 0x0000083a, 0x00000002, 0x00000008, 0x00000058, 
-    0x00000003, 0x0004002b, 0x00000006, 0x0000083d, 0x000000a6, 0x000e000c, 0x00000003, 0x0000083b, 0x00000002, 
-    0x00000014, 0x0000083c, 0x0000083a, 0x00000021, 0x0000083d, 0x0000008e, 0x0000000a, 0x0000083c, 0x00000058, 
-    0x0000083d, 0x000d000c, 0x00000003, 0x00000840, 0x00000002, 0x0000001a, 0x0000078d, 0x00000095, 0x00000021, 
-    0x0000083d, 0x0000008e, 0x0000083b, 0x00000058, 0x0000005c, 0x000d000c, 0x00000003, 0x00000843, 0x00000002, 
-    0x0000001a, 0x00000783, 0x00000095, 0x00000021, 0x0000083d, 0x0000008e, 0x0000083b, 0x00000058, 0x00000008, 
-    0x000d000c, 0x00000003, 0x00000846, 0x00000002, 0x0000001a, 0x0000077c, 0x00000095, 0x00000021, 0x0000083d, 
-    0x0000008e, 0x0000083b, 0x00000058, 0x00000065, 0x000d000c, 0x00000003, 0x00000849, 0x00000002, 0x0000001a, 
-    0x00000668, 0x00000068, 0x00000021, 0x0000083d, 0x0000008e, 0x0000083b, 0x00000058, 0x00000064, 0x000d000c, 
-    0x00000003, 0x0000084c, 0x00000002, 0x0000001a, 0x00000662, 0x00000068, 0x00000021, 0x0000083d, 0x0000008e, 
-    0x0000083b, 0x00000058, 0x0000006d, 0x000d000c, 0x00000003, 0x0000084f, 0x00000002, 0x0000001a, 0x0000065b, 
-    0x00000095, 0x00000021, 0x0000083d, 0x0000008e, 0x0000083b, 0x00000058, 0x000000aa, 0x0004002b, 0x00000006, 
-    0x00000853, 0x000000a8, 0x0004002b, 0x00000006, 0x00000858, 0x00000037, 0x000d000c, 0x00000003, 0x00000856, 
-    0x00000002, 0x0000000b, 0x00000857, 0x00000095, 0x0000001e, 0x00000858, 0x0000008e, 0x00000058, 0x00000099, 
-    0x00000058, 0x000d000c, 0x00000003, 0x00000859, 0x00000002, 0x0000000b, 0x0000085a, 0x00000095, 0x0000001e, 
-    0x00000858, 0x0000008e, 0x00000099, 0x00000099, 0x00000058, 0x000d000c, 0x00000003, 0x0000085b, 0x00000002, 
-    0x0000000b, 0x0000085c, 0x00000095, 0x0000001e, 0x00000858, 0x0000008e, 0x00000086, 0x00000099, 0x00000058, 
-    0x000d000c, 0x00000003, 0x0000085d, 0x00000002, 0x0000000b, 0x0000085e, 0x00000095, 0x0000001e, 0x00000858, 
-    0x0000008e, 0x000000d2, 0x00000099, 0x00000058, 0x000d000c, 0x00000003, 0x0000085f, 0x00000002, 0x0000000b, 
-    0x00000860, 0x00000095, 0x0000001e, 0x00000858, 0x0000008e, 0x000000d5, 0x00000099, 0x00000058, 0x000d000c, 
-    0x00000003, 0x00000861, 0x00000002, 0x0000000b, 0x00000862, 0x00000068, 0x0000001e, 0x00000858, 0x0000008e, 
-    0x000000d8, 0x0000006a, 0x00000058, 0x0014000c, 0x00000003, 0x00000863, 0x00000002, 0x0000000a, 0x00000864, 
-    0x000000aa, 0x0000001e, 0x00000858, 0x0000008e, 0x0000000a, 0x00000864, 0x0000008f, 0x0000006b, 0x00000856, 
-    0x00000859, 0x0000085b, 0x0000085d, 0x0000085f, 0x00000861, 0x0004002b, 0x00000006, 0x00000866, 0x00000014, 
-    0x000c000c, 0x00000003, 0x00000865, 0x00000002, 0x0000001a, 0x000000a7, 0x00000863, 0x00000021, 0x00000853, 
-    0x00000866, 0x0000083b, 0x00000058, 0x0004002b, 0x00000006, 0x00000869, 0x000000a9, 0x0004002b, 0x00000006, 
-    0x0000086f, 0x000000aa, 0x0006002c, 0x0000003a, 0x00000876, 0x00000273, 0x00000273, 0x00000273, 0x0004002b, 
-    0x00000006, 0x0000087b, 0x000000ac, 0x000d000c, 0x00000003, 0x0000087c, 0x00000002, 0x0000000b, 0x0000087d, 
-    0x00000095, 0x00000021, 0x000004e5, 0x0000008e, 0x00000058, 0x00000099, 0x00000058, 0x000d000c, 0x00000003, 
-    0x0000087e, 0x00000002, 0x0000000b, 0x0000087f, 0x00000068, 0x00000021, 0x000004e5, 0x0000008e, 0x00000099, 
-    0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x00000880, 0x00000002, 0x0000000b, 0x00000668, 0x0000006c, 
-    0x00000021, 0x000004e5, 0x0000008e, 0x000000e9, 0x000000bc, 0x00000058, 0x000d000c, 0x00000003, 0x00000881, 
-    0x00000002, 0x0000000b, 0x00000662, 0x00000068, 0x00000021, 0x000004e5, 0x0000008e, 0x00000086, 0x0000006a, 
-    0x00000058, 0x000d000c, 0x00000003, 0x00000882, 0x00000002, 0x0000000b, 0x00000883, 0x00000095, 0x00000021, 
-    0x000004e5, 0x0000008e, 0x000000f3, 0x00000099, 0x00000058, 0x000d000c, 0x00000003, 0x00000884, 0x00000002, 
-    0x0000000b, 0x00000885, 0x00000068, 0x00000021, 0x000004e5, 0x0000008e, 0x00000178, 0x0000006a, 0x00000058, 
-    0x000d000c, 0x00000003, 0x00000886, 0x00000002, 0x0000000b, 0x00000887, 0x00000068, 0x00000021, 0x000004e5, 
-    0x0000008e, 0x00000106, 0x0000006a, 0x00000058, 0x000d000c, 0x00000003, 0x00000888, 0x00000002, 0x0000000b, 
-    0x00000889, 0x00000068, 0x00000021, 0x000004e5, 0x0000008e, 0x000000d5, 0x0000006a, 0x00000058, 0x0004002b, 
-    0x00000006, 0x0000088b, 0x000001a0, 0x000d000c, 0x00000003, 0x0000088a, 0x00000002, 0x0000000b, 0x0000077c, 
-    0x00000095, 0x00000021, 0x000004e5, 0x0000008e, 0x0000088b, 0x00000099, 0x00000058, 0x000d000c, 0x00000003, 
-    0x0000088c, 0x00000002, 0x0000000b, 0x0000088d, 0x00000095, 0x00000021, 0x000004e5, 0x0000008e, 0x0000008f, 
-    0x00000099, 0x00000058, 0x000d000c, 0x00000003, 0x0000088e, 0x00000002, 0x0000000b, 0x0000088f, 0x00000095, 
-    0x00000021, 0x000004e5, 0x0000008e, 0x00000123, 0x00000099, 0x00000058, 0x0004002b, 0x00000006, 0x00000892, 
-    0x000002c0, 0x000d000c, 0x00000003, 0x00000890, 0x00000002, 0x0000000b, 0x00000891, 0x00000095, 0x00000021, 
-    0x000004e5, 0x0000008e, 0x00000892, 0x00000099, 0x00000058, 0x0004002b, 0x00000006, 0x00000895, 0x00000320, 
-    0x001a000c, 0x00000003, 0x00000893, 0x00000002, 0x0000000a, 0x00000894, 0x000000aa, 0x00000021, 0x000004e5, 
-    0x0000008e, 0x0000000a, 0x00000894, 0x00000895, 0x0000006b, 0x0000087c, 0x0000087e, 0x00000880, 0x00000881, 
-    0x00000882, 0x00000884, 0x00000886, 0x00000888, 0x0000088a, 0x0000088c, 0x0000088e, 0x00000890, 0x0004002b, 
-    0x00000006, 0x00000898, 0x00000013, 0x000c000c, 0x00000003, 0x00000896, 0x00000002, 0x0000001a, 0x00000897, 
-    0x00000893, 0x00000021, 0x0000087b, 0x00000898, 0x0000083b, 0x00000058, 0x0004002b, 0x00000006, 0x000008ab, 
-    0x000000b0, 0x0004002b, 0x00000006, 0x000008b1, 0x000000b1, 0x00060021, 0x000008bb, 0x00000003, 0x0000003a, 
-    0x00000055, 0x00000055, 0x0007000c, 0x00000003, 0x000008c5, 0x00000002, 0x00000008, 0x00000058, 0x00000003, 
-    0x0004002b, 0x00000006, 0x000008c8, 0x0000000d, 0x000e000c, 0x00000003, 0x000008c6, 0x00000002, 0x00000014, 
-    0x000008c7, 0x000008c5, 0x0000001b, 0x000004f0, 0x000008c8, 0x0000000a, 0x000008c7, 0x00000058, 0x000004f0, 
-    0x000d000c, 0x00000003, 0x000008cf, 0x00000002, 0x0000001a, 0x000008d0, 0x00000095, 0x0000001b, 0x000004f0, 
-    0x000008c8, 0x000008c6, 0x00000058, 0x00000064, 0x000d000c, 0x00000003, 0x000008d2, 0x00000002, 0x0000001a, 
-    0x000008d3, 0x00000095, 0x0000001b, 0x000004f0, 0x000008c8, 0x000008c6, 0x00000058, 0x0000006d, 0x000d000c, 
-    0x00000003, 0x000008d5, 0x00000002, 0x0000001a, 0x000008d6, 0x00000095, 0x0000001b, 0x000004f0, 0x000008c8, 
-    0x000008c6, 0x00000058, 0x000000aa, 0x0004002b, 0x00000006, 0x000008da, 0x00000055, 0x0004002b, 0x00000032, 
-    0x000008df, 0xbf7fff36, 0x000c000c, 0x00000003, 0x000008e3, 0x00000002, 0x0000001a, 0x000008e4, 0x00000068, 
-    0x0000001b, 0x0000053b, 0x00000245, 0x000008c6, 0x00000058, 0x0004002b, 0x00000006, 0x000008ea, 0x0000005c, 
-    0x000c000c, 0x00000003, 0x000008eb, 0x00000002, 0x0000001a, 0x000008ec, 0x00000068, 0x0000001b, 0x000008ea, 
-    0x00000245, 0x000008c6, 0x00000058, 0x0004002b, 0x00000006, 0x000008f5, 0x0000005d, 0x0004002b, 0x00000006, 
-    0x00000906, 0x00000057, 0x0004002b, 0x00000032, 0x0000090a, 0xbf800000, 0x0006002c, 0x0000003a, 0x00000909, 
-    0x00000273, 0x0000090a, 0x00000273, 0x0006002c, 0x0000003a, 0x0000090e, 0x0000090a, 0x00000273, 0x00000273, 
-    0x0004002b, 0x00000006, 0x00000912, 0x00000059, 0x00050021, 0x00000921, 0x00000003, 0x00000831, 0x00000834, 
-    0x00040020, 0x0000092c, 0x00000007, 0x00000089, 0x0007000c, 0x00000003, 0x0000093c, 0x00000002, 0x00000008, 
-    0x00000058, 0x00000003, 0x0004002b, 0x00000006, 0x0000093f, 0x00000035, 0x000e000c, 0x00000003, 0x0000093d, 
-    0x00000002, 0x00000014, 0x0000093e, 0x0000093c, 0x00000021, 0x0000093f, 0x0000005c, 0x0000000a, 0x0000093e, 
-    0x00000058, 0x0000093f, 0x000d000c, 0x00000003, 0x00000958, 0x00000002, 0x0000001a, 0x00000897, 0x00000893, 
-    0x00000021, 0x0000093f, 0x0000005c, 0x0000093d, 0x00000058, 0x0000006d, 0x000d000c, 0x00000003, 0x0000095b, 
-    0x00000002, 0x0000001a, 0x000000a7, 0x00000863, 0x00000021, 0x0000093f, 0x0000005c, 0x0000093d, 0x00000058, 
-    0x000000aa, 0x000c000c, 0x00000003, 0x00000962, 0x00000002, 0x0000001a, 0x00000963, 0x00000095, 0x00000021, 
-    0x00000443, 0x00000070, 0x0000093d, 0x00000058, 0x0004002b, 0x00000006, 0x0000096d, 0x00000039, 0x000c000c, 
-    0x00000003, 0x0000096e, 0x00000002, 0x0000001a, 0x0000096f, 0x00000068, 0x00000021, 0x0000096d, 0x00000070, 
-    0x0000093d, 0x00000058, 0x00050021, 0x00000975, 0x00000032, 0x0000003a, 0x0000003a, 0x0007000c, 0x00000003, 
-    0x0000097b, 0x00000002, 0x00000008, 0x00000058, 0x00000003, 0x000e000c, 0x00000003, 0x0000097c, 0x00000002, 
-    0x00000014, 0x0000097d, 0x0000097b, 0x0000001b, 0x000004c5, 0x0000029f, 0x0000000a, 0x0000097d, 0x00000058, 
-    0x000004c5, 0x000d000c, 0x00000003, 0x00000980, 0x00000002, 0x0000001a, 0x00000981, 0x00000095, 0x0000001b, 
-    0x000004c5, 0x0000029f, 0x0000097c, 0x00000058, 0x0000006d, 0x000d000c, 0x00000003, 0x00000984, 0x00000002, 
-    0x0000001a, 0x00000985, 0x00000095, 0x0000001b, 0x000004c5, 0x0000029f, 0x0000097c, 0x00000058, 0x000000aa, 
-    0x0004002b, 0x00000006, 0x0000098f, 0x0000003a, 0x000c000c, 0x00000003, 0x00000990, 0x00000002, 0x0000001a, 
-    0x00000991, 0x00000068, 0x00000021, 0x0000098f, 0x00000070, 0x0000093d, 0x00000058, 0x000c000c, 0x00000003, 
-    0x00000997, 0x00000002, 0x0000001a, 0x00000998, 0x00000068, 0x00000021, 0x00000582, 0x00000070, 0x0000093d, 
-    0x00000058, 0x000c000c, 0x00000003, 0x0000099e, 0x00000002, 0x0000001a, 0x0000099f, 0x00000068, 0x00000021, 
-    0x00000596, 0x00000070, 0x0000093d, 0x00000058, 0x00030029, 0x00000089, 0x000009aa, 0x0004002b, 0x00000006, 
-    0x000009ae, 0x00000015, 0x0004002b, 0x00000006, 0x000009c2, 0x0000004b, 0x000c000c, 0x00000003, 0x000009c3, 
-    0x00000002, 0x0000001a, 0x000009c4, 0x00000068, 0x00000021, 0x000009c2, 0x00000070, 0x0000093d, 0x00000058, 
-    0x0004002b, 0x00000032, 0x000009c6, 0x3d23d70a, 0x000c000c, 0x00000003, 0x000009c9, 0x00000002, 0x0000001a, 
-    0x000009ca, 0x00000095, 0x00000021, 0x000004e9, 0x00000070, 0x0000093d, 0x00000058, 0x0006002c, 0x0000003a, 
-    0x000009d0, 0x000009c6, 0x000009c6, 0x000009c6, 0x0004002b, 0x00000006, 0x000009d3, 0x0000004d, 0x000c000c, 
-    0x00000003, 0x000009d4, 0x00000002, 0x0000001a, 0x000009d5, 0x00000095, 0x00000021, 0x000009d3, 0x00000070, 
-    0x0000093d, 0x00000058, 0x00060021, 0x000009d9, 0x0000003a, 0x0000003a, 0x0000003a, 0x00000032, 0x0007000c, 
-    0x00000003, 0x000009e1, 0x00000002, 0x00000008, 0x00000058, 0x00000003, 0x0004002b, 0x00000006, 0x000009e4, 
-    0x00000033, 0x000e000c, 0x00000003, 0x000009e2, 0x00000002, 0x00000014, 0x000009e3, 0x000009e1, 0x00000018, 
-    0x000009e4, 0x0000008e, 0x0000000a, 0x000009e3, 0x00000058, 0x000009e4, 0x000d000c, 0x00000003, 0x000009e7, 
-    0x00000002, 0x0000001a, 0x00000998, 0x00000068, 0x00000018, 0x000009e4, 0x0000008e, 0x000009e2, 0x00000058, 
-    0x00000064, 0x000d000c, 0x00000003, 0x000009ea, 0x00000002, 0x0000001a, 0x000009eb, 0x00000095, 0x00000018, 
-    0x000009e4, 0x0000008e, 0x000009e2, 0x00000058, 0x0000006d, 0x000d000c, 0x00000003, 0x000009ee, 0x00000002, 
-    0x0000001a, 0x000009ef, 0x00000095, 0x00000018, 0x000009e4, 0x0000008e, 0x000009e2, 0x00000058, 0x000000aa, 
-    0x0004002b, 0x00000032, 0x000009f7, 0x40a00000, 0x0006002c, 0x0000003a, 0x000009fb, 0x00000254, 0x00000254, 
-    0x00000254, 0x0004002b, 0x00000006, 0x000009fe, 0x0000004e, 0x000c000c, 0x00000003, 0x000009ff, 0x00000002, 
-    0x0000001a, 0x00000a00, 0x00000068, 0x00000021, 0x000009fe, 0x00000070, 0x0000093d, 0x00000058, 0x00060021, 
-    0x00000a04, 0x00000032, 0x00000032, 0x00000032, 0x00000032, 0x0007000c, 0x00000003, 0x00000a0c, 0x00000002, 
-    0x00000008, 0x00000058, 0x00000003, 0x000e000c, 0x00000003, 0x00000a0d, 0x00000002, 0x00000014, 0x000009e3, 
-    0x00000a0c, 0x00000018, 0x00000693, 0x000007ab, 0x0000000a, 0x000009e3, 0x00000058, 0x00000693, 0x000d000c, 
-    0x00000003, 0x00000a10, 0x00000002, 0x0000001a, 0x00000998, 0x00000068, 0x00000018, 0x00000693, 0x000007ab, 
-    0x00000a0d, 0x00000058, 0x00000064, 0x000d000c, 0x00000003, 0x00000a13, 0x00000002, 0x0000001a, 0x000009eb, 
-    0x00000068, 0x00000018, 0x00000693, 0x000007ab, 0x00000a0d, 0x00000058, 0x0000006d, 0x000d000c, 0x00000003, 
-    0x00000a16, 0x00000002, 0x0000001a, 0x000009ef, 0x00000068, 0x00000018, 0x00000693, 0x000007ab, 0x00000a0d, 
-    0x00000058, 0x000000aa, 0x0004002b, 0x00000006, 0x00000a1a, 0x0000002f, 0x0004002b, 0x00000032, 0x00000a22, 
-    0x3f75c28f, 0x000c000c, 0x00000003, 0x00000a27, 0x00000002, 0x0000001a, 0x00000a28, 0x00000095, 0x00000021, 
-    0x000002cb, 0x00000070, 0x0000093d, 0x00000058, 0x000c000c, 0x00000003, 0x00000a31, 0x00000002, 0x0000001a, 
-    0x00000724, 0x00000068, 0x00000021, 0x00000180, 0x00000070, 0x0000093d, 0x00000058, 0x00050021, 0x00000a38, 
-    0x00000032, 0x00000033, 0x0000003a, 0x0007000c, 0x00000003, 0x00000a42, 0x00000002, 0x00000008, 0x00000058, 
-    0x00000003, 0x0004002b, 0x00000006, 0x00000a45, 0x00000061, 0x000e000c, 0x00000003, 0x00000a43, 0x00000002, 
-    0x00000014, 0x00000a44, 0x00000a42, 0x00000018, 0x00000a45, 0x000007ab, 0x0000000a, 0x00000a44, 0x00000058, 
-    0x00000a45, 0x000d000c, 0x00000003, 0x00000a48, 0x00000002, 0x0000001a, 0x00000a49, 0x00000095, 0x00000018, 
-    0x00000a45, 0x000007ab, 0x00000a43, 0x00000058, 0x0000006d, 0x000d000c, 0x00000003, 0x00000a4c, 0x00000002, 
-    0x0000001a, 0x00000a4d, 0x0000006c, 0x00000018, 0x00000a45, 0x000007ab, 0x00000a43, 0x00000058, 0x000000aa, 
-    0x000c000c, 0x00000003, 0x00000a53, 0x00000002, 0x0000001a, 0x00000985, 0x00000068, 0x00000018, 0x00000009, 
-    0x00000512, 0x00000a43, 0x00000058, 0x0004002b, 0x00000006, 0x00000a5a, 0x00000065, 0x000c000c, 0x00000003, 
-    0x00000a5b, 0x00000002, 0x0000001a, 0x00000981, 0x00000068, 0x00000018, 0x00000a5a, 0x00000512, 0x00000a43, 
-    0x00000058, 0x0004002b, 0x00000006, 0x00000a62, 0x00000066, 0x000c000c, 0x00000003, 0x00000a63, 0x00000002, 
-    0x0000001a, 0x00000a64, 0x00000068, 0x00000018, 0x00000a62, 0x00000512, 0x00000a43, 0x00000058, 0x0004002b, 
-    0x00000006, 0x00000a6b, 0x00000067, 0x000c000c, 0x00000003, 0x00000a6c, 0x00000002, 0x0000001a, 0x00000a6d, 
-    0x00000068, 0x00000018, 0x00000a6b, 0x00000512, 0x00000a43, 0x00000058, 0x0004002b, 0x00000006, 0x00000a74, 
-    0x00000069, 0x0004002b, 0x00000032, 0x00000a76, 0x3ea2f983, 0x000c000c, 0x00000003, 0x00000a7e, 0x00000002, 
-    0x0000001a, 0x00000a7f, 0x00000095, 0x00000021, 0x000004f0, 0x00000070, 0x0000093d, 0x00000058, 0x0004002b, 
-    0x00000006, 0x00000a88, 0x00000054, 0x000c000c, 0x00000003, 0x00000a89, 0x00000002, 0x0000001a, 0x00000a8a, 
-    0x00000095, 0x00000021, 0x00000a88, 0x00000070, 0x0000093d, 0x00000058, 0x000c000c, 0x00000003, 0x00000a93, 
-    0x00000002, 0x0000001a, 0x00000a94, 0x00000068, 0x00000021, 0x000008da, 0x00000070, 0x0000093d, 0x00000058, 
-    0x000c000c, 0x00000003, 0x00000a98, 0x00000002, 0x0000001a, 0x00000a99, 0x00000068, 0x00000021, 0x000008da, 
-    0x000009ae, 0x0000093d, 0x00000058, 0x0004002b, 0x00000006, 0x00000a9e, 0x00000056, 0x00080021, 0x00000aa1, 
-    0x00000032, 0x00000286, 0x00000286, 0x0000003a, 0x0000003a, 0x00000033, 0x0007000c, 0x00000003, 0x00000aad, 
-    0x00000002, 0x00000008, 0x00000058, 0x00000003, 0x000e000c, 0x00000003, 0x00000aae, 0x00000002, 0x00000014, 
-    0x00000aaf, 0x00000aad, 0x00000018, 0x0000070f, 0x000007ab, 0x0000000a, 0x00000aaf, 0x00000058, 0x0000070f, 
-    0x000d000c, 0x00000003, 0x00000ab2, 0x00000002, 0x0000001a, 0x00000668, 0x0000006c, 0x00000018, 0x0000070f, 
-    0x000007ab, 0x00000aae, 0x00000058, 0x00000008, 0x000d000c, 0x00000003, 0x00000ab5, 0x00000002, 0x0000001a, 
-    0x0000085a, 0x00000095, 0x00000018, 0x0000070f, 0x000007ab, 0x00000aae, 0x00000058, 0x00000065, 0x000d000c, 
-    0x00000003, 0x00000ab8, 0x00000002, 0x0000001a, 0x00000857, 0x00000095, 0x00000018, 0x0000070f, 0x000007ab, 
-    0x00000aae, 0x00000058, 0x00000064, 0x000d000c, 0x00000003, 0x00000abb, 0x00000002, 0x0000001a, 0x00000a99, 
-    0x00000068, 0x00000018, 0x0000070f, 0x000007ab, 0x00000aae, 0x00000058, 0x0000006d, 0x000d000c, 0x00000003, 
-    0x00000abd, 0x00000002, 0x0000001a, 0x00000a94, 0x00000068, 0x00000018, 0x0000070f, 0x000007ab, 0x00000aae, 
-    0x00000058, 0x000000aa, 0x0004002b, 0x00000006, 0x00000ac0, 0x000000a3, 0x00050021, 0x00000ac5, 0x00000032, 
-    0x0000003a, 0x00000033, 0x0007000c, 0x00000003, 0x00000acf, 0x00000002, 0x00000008, 0x00000058, 0x00000003, 
-    0x0004002b, 0x00000006, 0x00000ad2, 0x0000008d, 0x000e000c, 0x00000003, 0x00000ad0, 0x00000002, 0x00000014, 
-    0x00000ad1, 0x00000acf, 0x00000018, 0x00000ad2, 0x000007ab, 0x0000000a, 0x00000ad1, 0x00000058, 0x00000ad2, 
-    0x000d000c, 0x00000003, 0x00000ad9, 0x00000002, 0x0000001a, 0x00000668, 0x0000006c, 0x00000018, 0x00000ad2, 
-    0x000007ab, 0x00000ad0, 0x00000058, 0x0000006d, 0x000d000c, 0x00000003, 0x00000adc, 0x00000002, 0x0000001a, 
-    0x00000add, 0x00000095, 0x00000018, 0x00000ad2, 0x000007ab, 0x00000ad0, 0x00000058, 0x000000aa, 0x000c000c, 
-    0x00000003, 0x00000ae3, 0x00000002, 0x0000001a, 0x00000ae4, 0x00000068, 0x00000018, 0x000006e2, 0x00000245, 
-    0x00000ad0, 0x00000058, 0x0004002b, 0x00000006, 0x00000aea, 0x00000090, 0x000c000c, 0x00000003, 0x00000aef, 
-    0x00000002, 0x0000001a, 0x00000af0, 0x00000068, 0x00000018, 0x00000700, 0x00000512, 0x00000ad0, 0x00000058, 
-    0x0004002b, 0x00000006, 0x00000af7, 0x00000095, 0x000c000c, 0x00000003, 0x00000af8, 0x00000002, 0x0000001a, 
-    0x00000af9, 0x00000068, 0x00000018, 0x00000af7, 0x00000512, 0x00000ad0, 0x00000058, 0x0004002b, 0x00000006, 
-    0x00000b00, 0x00000096, 0x000c000c, 0x00000003, 0x00000b01, 0x00000002, 0x0000001a, 0x00000b02, 0x00000068, 
-    0x00000018, 0x00000b00, 0x00000512, 0x00000ad0, 0x00000058, 0x000c000c, 0x00000003, 0x00000b22, 0x00000002, 
-    0x0000001a, 0x00000b23, 0x00000068, 0x00000021, 0x000000fa, 0x00000245, 0x0000093d, 0x00000058, 0x000c000c, 
-    0x00000003, 0x00000b28, 0x00000002, 0x0000001a, 0x00000b29, 0x00000068, 0x00000021, 0x00000912, 0x00000245, 
-    0x0000093d, 0x00000058, 0x0004002b, 0x00000032, 0x00000b2e, 0x3e800000, 0x0004002b, 0x00000006, 0x00000b33, 
-    0x0000005a, 0x00050021, 0x00000b37, 0x00000032, 0x00000032, 0x00000032, 0x0007000c, 0x00000003, 0x00000b3d, 
-    0x00000002, 0x00000008, 0x00000058, 0x00000003, 0x0004002b, 0x00000006, 0x00000b40, 0x00000423, 0x000e000c, 
-    0x00000003, 0x00000b3e, 0x00000002, 0x00000014, 0x00000b3f, 0x00000b3d, 0x00000015, 0x00000b40, 0x000007ab, 
-    0x0000000a, 0x00000b3f, 0x00000058, 0x00000b40, 0x000d000c, 0x00000003, 0x00000b43, 0x00000002, 0x0000001a, 
-    0x00000662, 0x00000068, 0x00000015, 0x00000b40, 0x000007ab, 0x00000b3e, 0x00000058, 0x0000006d, 0x000d000c, 
-    0x00000003, 0x00000b46, 0x00000002, 0x0000001a, 0x0000096f, 0x00000068, 0x00000015, 0x00000b40, 0x000007ab, 
-    0x00000b3e, 0x00000058, 0x000000aa, 0x0004002b, 0x00000006, 0x00000b4a, 0x00000425, 0x000d000c, 0x00000003, 
-    0x00000b56, 0x00000002, 0x0000001a, 0x00000998, 0x00000068, 0x00000018, 0x00000693, 0x000007ab, 0x0000000a, 
-    0x00000058, 0x00000064, 0x000d000c, 0x00000003, 0x00000b59, 0x00000002, 0x0000001a, 0x000009eb, 0x00000068, 
-    0x00000018, 0x00000693, 0x000007ab, 0x0000000a, 0x00000058, 0x0000006d, 0x000d000c, 0x00000003, 0x00000b5c, 
-    0x00000002, 0x0000001a, 0x000009ef, 0x00000068, 0x00000018, 0x00000693, 0x000007ab, 0x0000000a, 0x00000058, 
-    0x000000aa, 0x0006002c, 0x0000003a, 0x00000b82, 0x00000273, 0x00000273, 0x00000273, 0x0004002b, 0x00000006, 
-    0x00000b8b, 0x00000041, 0x0004002b, 0x00000006, 0x00000b95, 0x000000b4, 0x0004002b, 0x00000006, 0x00000b9e, 
-    0x00000126, 0x0004002b, 0x00000006, 0x00000ba6, 0x00000129, 0x00040020, 0x00000ba7, 0x000014de, 0x0000003a, 
-    0x0004002b, 0x00000006, 0x00000bb4, 0x00000130, 0x000e000c, 0x00000003, 0x00000bb2, 0x00000002, 0x00000014, 
-    0x00000bb3, 0x00000057, 0x0000002d, 0x00000bb4, 0x0000005c, 0x0000000a, 0x00000bb3, 0x00000058, 0x00000bb4, 
-    0x0009000c, 0x00000003, 0x00000bbd, 0x00000002, 0x0000006b, 0x00000bb2, 0x0000000a, 0x00000060, 0x00000bbe, 
-    0x000d000c, 0x00000003, 0x00000bbf, 0x00000002, 0x0000001a, 0x0000029e, 0x0000029b, 0x0000002d, 0x00000bb4, 
-    0x0000005c, 0x00000bb2, 0x00000058, 0x000000aa, 0x0004002b, 0x00000006, 0x00000bc6, 0x00000132, 0x000c000c, 
-    0x00000003, 0x00000bc9, 0x00000002, 0x0000001a, 0x00000138, 0x00000134, 0x0000002d, 0x00000bc6, 0x00000139, 
-    0x00000bb2, 0x00000058, 0x0004002b, 0x00000006, 0x00000c70, 0x00000135, 0x0004002b, 0x00000006, 0x00000c75, 
-    0x0000013f, 0x00040020, 0x00000c78, 0x000014de, 0x00000032, 0x0004002b, 0x00000006, 0x00000c83, 0x00000139, 
-    0x000c000c, 0x00000003, 0x00000c86, 0x00000002, 0x0000001a, 0x00000118, 0x00000095, 0x0000002d, 0x00000c83, 
-    0x0000071b, 0x00000bb2, 0x00000058, 0x00050021, 0x00000c8b, 0x0000003a, 0x00000045, 0x0000003a, 0x00040020, 
-    0x00000c90, 0x00000007, 0x00000045, 0x0007000c, 0x00000003, 0x00000c9e, 0x00000002, 0x00000008, 0x00000058, 
-    0x00000003, 0x000e000c, 0x00000003, 0x00000c9f, 0x00000002, 0x00000014, 0x00000ca0, 0x00000c9e, 0x00000012, 
-    0x000004e5, 0x00000512, 0x0000000a, 0x00000ca0, 0x00000058, 0x000004e5, 0x000d000c, 0x00000003, 0x00000ca3, 
-    0x00000002, 0x0000001a, 0x000000fe, 0x00000095, 0x00000012, 0x000004e5, 0x00000512, 0x00000c9f, 0x00000058, 
-    0x0000006d, 0x000d000c, 0x00000003, 0x00000ca6, 0x00000002, 0x0000001a, 0x00000ca7, 0x0000012e, 0x00000012, 
-    0x000004e5, 0x00000512, 0x00000c9f, 0x00000058, 0x000000aa, 0x000c000c, 0x00000003, 0x00000cad, 0x00000002, 
-    0x0000001a, 0x00000118, 0x00000095, 0x00000012, 0x0000006a, 0x00000070, 0x00000c9f, 0x00000058, 0x0004002b, 
-    0x00000006, 0x00000cb4, 0x00000021, 0x000c000c, 0x00000003, 0x00000cb5, 0x00000002, 0x0000001a, 0x0000011c, 
-    0x00000095, 0x00000012, 0x00000cb4, 0x00000070, 0x00000c9f, 0x00000058, 0x000c000c, 0x00000003, 0x00000cbb, 
-    0x00000002, 0x0000001a, 0x00000120, 0x00000095, 0x00000012, 0x0000067f, 0x00000070, 0x00000c9f, 0x00000058, 
-    0x000c000c, 0x00000003, 0x00000cc1, 0x00000002, 0x0000001a, 0x00000cc2, 0x00000068, 0x00000012, 0x0000066f, 
-    0x00000070, 0x00000c9f, 0x00000058, 0x000c000c, 0x00000003, 0x00000cca, 0x00000002, 0x0000001a, 0x00000ccb, 
-    0x00000068, 0x00000012, 0x000002e3, 0x00000070, 0x00000c9f, 0x00000058, 0x0004002b, 0x00000006, 0x00000cd1, 
-    0x00000027, 0x000c000c, 0x00000003, 0x00000cd2, 0x00000002, 0x0000001a, 0x00000cd3, 0x00000068, 0x00000012, 
-    0x00000cd1, 0x00000070, 0x00000c9f, 0x00000058, 0x0004002b, 0x00000006, 0x00000cd9, 0x00000028, 0x000c000c, 
-    0x00000003, 0x00000cda, 0x00000002, 0x0000001a, 0x00000cdb, 0x00000095, 0x00000012, 0x00000cd9, 0x00000070, 
-    0x00000c9f, 0x00000058, 0x0004002b, 0x00000006, 0x00000ce3, 0x0000002b, 0x000c000c, 0x00000003, 0x00000ce4, 
-    0x00000002, 0x0000001a, 0x00000ce5, 0x00000068, 0x00000012, 0x00000ce3, 0x00000245, 0x00000c9f, 0x00000058, 
-    0x000c000c, 0x00000003, 0x00000ced, 0x00000002, 0x0000001a, 0x00000cee, 0x00000068, 0x00000012, 0x00000692, 
-    0x00000245, 0x00000c9f, 0x00000058, 0x0004002b, 0x00000032, 0x00000cf2, 0x3f000000, 0x000c000c, 0x00000003, 
-    0x00000cf5, 0x00000002, 0x0000001a, 0x00000cf6, 0x00000068, 0x00000012, 0x00000693, 0x00000245, 0x00000c9f, 
-    0x00000058, 0x0004002b, 0x00000006, 0x00000d01, 0x00000030, 0x000c000c, 0x00000003, 0x00000d02, 0x00000002, 
-    0x0000001a, 0x0000011a, 0x00000068, 0x00000012, 0x00000d01, 0x00000070, 0x00000c9f, 0x00000058, 0x000c000c, 
-    0x00000003, 0x00000d0a, 0x00000002, 0x0000001a, 0x00000d0b, 0x00000095, 0x00000012, 0x0000043d, 0x00000070, 
-    0x00000c9f, 0x00000058, 0x0004002b, 0x00000006, 0x00000d15, 0x0000013a, 0x0004002b, 0x00000006, 0x00000d21, 
-    0x00000143, 0x00040020, 0x00000d22, 0x000014de, 0x0000003b, 0x0005001e, 0x0000003c, 0x00000186, 0x00000006, 
-    0x00000006, 0x00040020, 0x0000003d, 0x000014e5, 0x0000003c, 0x0005001e, 0x00000459, 0x00000006, 0x00000006, 
-    0x00000006, 0x0008001e, 0x00000456, 0x00000459, 0x00000459, 0x00000459, 0x00000459, 0x00000459, 0x00000459, 
-    0x0005001e, 0x0000003e, 0x000002f4, 0x00000456, 0x0000003b, 0x00040020, 0x0000003f, 0x000014e5, 0x0000003e, 
-    0x0006001e, 0x00000040, 0x00000038, 0x00000032, 0x00000032, 0x0000003b, 0x00040020, 0x00000041, 0x000014e5, 
-    0x00000040, 0x0003001e, 0x000001f8, 0x000001fb, 0x0010001e, 0x0000021f, 0x0000003a, 0x00000032, 0x0000003a, 
-    0x00000032, 0x0000003a, 0x00000032, 0x0000003a, 0x00000032, 0x0000003a, 0x00000032, 0x0000003a, 0x00000032, 
-    0x0000003a, 0x00000032, 0x000e001e, 0x0000013f, 0x00000186, 0x00000186, 0x00000186, 0x0000003a, 0x0000003b, 
-    0x0000003a, 0x0000003b, 0x0000003d, 0x0000003f, 0x00000041, 0x000001f8, 0x0000021f, 0x00040020, 0x00000140, 
-    0x000014e5, 0x0000013f, 0x00040020, 0x00000187, 0x000014e5, 0x00000186, 0x00040020, 0x000001f9, 0x000014e5, 
-    0x000001f8, 0x00040020, 0x00000220, 0x000014e5, 0x0000021f, 0x00040020, 0x00000457, 0x000014e5, 0x00000456, 
-    0x00040020, 0x0000045a, 0x000014e5, 0x00000459, 0x0004003b, 0x00000075, 0x00000076, 0x00000001, 0x0004003b, 
-    0x00000075, 0x00000081, 0x00000001, 0x0004003b, 0x00000141, 0x00000142, 0x00000009, 0x000e000c, 0x00000003, 
-    0x0000017e, 0x00000002, 0x00000012, 0x0000017f, 0x0000017b, 0x0000002d, 0x0000006a, 0x00000180, 0x0000000a, 
-    0x0000017f, 0x00000142, 0x00000058, 0x0004003b, 0x000002b9, 0x000002ba, 0x000014da, 0x000e000c, 0x00000003, 
-    0x000002bb, 0x00000002, 0x00000012, 0x000002bc, 0x0000029b, 0x00000004, 0x00000058, 0x00000058, 0x0000000a, 
-    0x000002bc, 0x000002ba, 0x00000058, 0x0004003b, 0x000002c4, 0x000002c5, 0x00000000, 0x000e000c, 0x00000003, 
-    0x000002c8, 0x00000002, 0x00000012, 0x000002c9, 0x000002c6, 0x0000002d, 0x000002ca, 0x000002cb, 0x0000000a, 
-    0x000002c9, 0x000002c5, 0x00000058, 0x0004003b, 0x000002de, 0x000002df, 0x00000000, 0x000e000c, 0x00000003, 
-    0x000002e1, 0x00000002, 0x00000012, 0x000002e2, 0x000002e0, 0x0000002d, 0x000002e3, 0x000002e4, 0x0000000a, 
-    0x000002e2, 0x000002df, 0x00000058, 0x0004003b, 0x0000032d, 0x0000032e, 0x000014de, 0x000e000c, 0x00000003, 
-    0x0000032f, 0x00000002, 0x00000012, 0x000002c7, 0x0000029b, 0x00000004, 0x00000058, 0x00000058, 0x0000000a, 
-    0x000002c7, 0x0000032e, 0x00000058, 0x0004003b, 0x00000333, 0x00000334, 0x000014db, 0x000e000c, 0x00000003, 
-    0x00000339, 0x00000002, 0x00000012, 0x000002c7, 0x00000337, 0x00000004, 0x00000058, 0x00000058, 0x0000000a, 
-    0x000002c7, 0x00000334, 0x00000058, 0x0004003b, 0x0000034d, 0x0000034e, 0x00000001, 0x0004003b, 0x0000034d, 
-    0x00000356, 0x00000001, 0x0004003b, 0x0000034d, 0x0000035e, 0x00000001, 0x0004003b, 0x00000649, 0x0000064a, 
-    0x00000001, 0x0004003b, 0x00000649, 0x00000653, 0x00000001, 0x0004003b, 0x00000679, 0x0000067a, 0x00000000, 
-    0x000e000c, 0x00000003, 0x0000067d, 0x00000002, 0x00000012, 0x0000067e, 0x0000067c, 0x0000002d, 0x0000067f, 
-    0x00000582, 0x0000000a, 0x0000067e, 0x0000067a, 0x00000058, 0x0004003b, 0x00000786, 0x00000787, 0x00000001, 
-    0x0004003b, 0x0000032d, 0x00000bc2, 0x000014de, 0x000e000c, 0x00000003, 0x00000bc3, 0x00000002, 0x00000012, 
-    0x000002c7, 0x0000029b, 0x00000004, 0x00000058, 0x00000058, 0x0000000a, 0x000002c7, 0x00000bc2, 0x00000058, 
-    0x00050036, 0x00000003, 0x0000002f, 0x00000000, 0x00000030, 0x000200f8, 0x00000031, 0x0004003b, 0x00000034, 
-    0x00000035, 0x00000007, 0x0004003b, 0x00000034, 0x00000036, 0x00000007, 0x0004003b, 0x00000046, 0x00000047, 
-    0x00000007, 0x0004003b, 0x00000048, 0x00000049, 0x00000007, 0x0004003b, 0x00000034, 0x0000004a, 0x00000007, 
-    0x0004003b, 0x0000004b, 0x0000004c, 0x00000007, 0x0004003b, 0x0000004e, 0x0000004f, 0x00000007, 0x0004003b, 
-    0x0000004e, 0x00000050, 0x00000007, 0x0004003b, 0x00000052, 0x00000053, 0x00000007, 0x0004003b, 0x00000052, 
-    0x00000054, 0x00000007, 0x0004003b, 0x00000055, 0x00000056, 0x00000007, 0x0007000c, 0x00000003, 0x0000005d, 
-    0x00000002, 0x00000065, 0x00000059, 0x0000002f, 0x0006000c, 0x00000003, 0x0000005e, 0x00000002, 0x00000017, 
-    0x00000059, 0x000a000c, 0x00000003, 0x00000062, 0x00000002, 0x00000067, 0x0000002d, 0x00000063, 0x00000063, 
-    0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x00000066, 0x00000002, 0x00000067, 0x0000002d, 0x00000063, 
-    0x00000063, 0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x00000067, 0x00000002, 0x00000067, 0x0000002d, 
-    0x00000063, 0x00000063, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000072, 0x00000002, 0x0000001c, 
-    0x0000006e, 0x00000035, 0x00000071, 0x0004003d, 0x00000073, 0x00000074, 0x00000076, 0x0007004f, 0x00000077, 
-    0x00000078, 0x00000074, 0x00000074, 0x00000000, 0x00000001, 0x00040070, 0x00000033, 0x00000079, 0x00000078, 
-    0x0003003e, 0x00000035, 0x00000079, 0x000a000c, 0x00000003, 0x0000007b, 0x00000002, 0x00000067, 0x0000002d, 
-    0x0000007c, 0x0000007c, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x0000007f, 0x00000002, 0x0000001c, 
-    0x0000007d, 0x00000036, 0x00000071, 0x0004003d, 0x00000073, 0x00000080, 0x00000081, 0x0007004f, 0x00000077, 
-    0x00000082, 0x00000080, 0x00000080, 0x00000000, 0x00000001, 0x00040070, 0x00000033, 0x00000083, 0x00000082, 
-    0x0003003e, 0x00000036, 0x00000083, 0x000a000c, 0x00000003, 0x00000085, 0x00000002, 0x00000067, 0x0000002d, 
-    0x00000086, 0x00000086, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x0000013a, 0x00000002, 0x0000001c, 
-    0x00000137, 0x00000047, 0x00000071, 0x00050042, 0x00000181, 0x00000182, 0x00000142, 0x00000044, 0x0004003d, 
-    0x00000140, 0x00000183, 0x00000182, 0x00050043, 0x00000140, 0x00000184, 0x00000183, 0x00000185, 0x00050042, 
-    0x00000187, 0x00000188, 0x00000184, 0x00000185, 0x0006003d, 0x00000186, 0x0000018b, 0x00000188, 0x00000002, 
-    0x00000004, 0x00050051, 0x00000189, 0x0000018c, 0x0000018b, 0x00000000, 0x00050051, 0x00000038, 0x0000018d, 
-    0x0000018c, 0x00000000, 0x00050051, 0x00000032, 0x0000018e, 0x0000018d, 0x00000000, 0x00050051, 0x00000032, 
-    0x0000018f, 0x0000018d, 0x00000001, 0x00050051, 0x00000032, 0x00000190, 0x0000018d, 0x00000002, 0x00050051, 
-    0x00000032, 0x00000191, 0x0000018d, 0x00000003, 0x00050051, 0x00000038, 0x00000192, 0x0000018c, 0x00000001, 
-    0x00050051, 0x00000032, 0x00000193, 0x00000192, 0x00000000, 0x00050051, 0x00000032, 0x00000194, 0x00000192, 
-    0x00000001, 0x00050051, 0x00000032, 0x00000195, 0x00000192, 0x00000002, 0x00050051, 0x00000032, 0x00000196, 
-    0x00000192, 0x00000003, 0x00050051, 0x00000038, 0x00000197, 0x0000018c, 0x00000002, 0x00050051, 0x00000032, 
-    0x00000198, 0x00000197, 0x00000000, 0x00050051, 0x00000032, 0x00000199, 0x00000197, 0x00000001, 0x00050051, 
-    0x00000032, 0x0000019a, 0x00000197, 0x00000002, 0x00050051, 0x00000032, 0x0000019b, 0x00000197, 0x00000003, 
-    0x00050051, 0x00000038, 0x0000019c, 0x0000018c, 0x00000003, 0x00050051, 0x00000032, 0x0000019d, 0x0000019c, 
-    0x00000000, 0x00050051, 0x00000032, 0x0000019e, 0x0000019c, 0x00000001, 0x00050051, 0x00000032, 0x0000019f, 
-    0x0000019c, 0x00000002, 0x00050051, 0x00000032, 0x000001a0, 0x0000019c, 0x00000003, 0x00070050, 0x00000038, 
-    0x000001a1, 0x0000018e, 0x0000018f, 0x00000190, 0x00000191, 0x00070050, 0x00000038, 0x000001a2, 0x00000193, 
-    0x00000194, 0x00000195, 0x00000196, 0x00070050, 0x00000038, 0x000001a3, 0x00000198, 0x00000199, 0x0000019a, 
-    0x0000019b, 0x00070050, 0x00000038, 0x000001a4, 0x0000019d, 0x0000019e, 0x0000019f, 0x000001a0, 0x00070050, 
-    0x00000039, 0x000001a5, 0x000001a1, 0x000001a2, 0x000001a3, 0x000001a4, 0x00050042, 0x00000187, 0x000001a7, 
-    0x00000184, 0x000001a6, 0x0006003d, 0x00000186, 0x000001a8, 0x000001a7, 0x00000002, 0x00000004, 0x00050051, 
-    0x00000189, 0x000001a9, 0x000001a8, 0x00000000, 0x00050051, 0x00000038, 0x000001aa, 0x000001a9, 0x00000000, 
-    0x00050051, 0x00000032, 0x000001ab, 0x000001aa, 0x00000000, 0x00050051, 0x00000032, 0x000001ac, 0x000001aa, 
-    0x00000001, 0x00050051, 0x00000032, 0x000001ad, 0x000001aa, 0x00000002, 0x00050051, 0x00000032, 0x000001ae, 
-    0x000001aa, 0x00000003, 0x00050051, 0x00000038, 0x000001af, 0x000001a9, 0x00000001, 0x00050051, 0x00000032, 
-    0x000001b0, 0x000001af, 0x00000000, 0x00050051, 0x00000032, 0x000001b1, 0x000001af, 0x00000001, 0x00050051, 
-    0x00000032, 0x000001b2, 0x000001af, 0x00000002, 0x00050051, 0x00000032, 0x000001b3, 0x000001af, 0x00000003, 
-    0x00050051, 0x00000038, 0x000001b4, 0x000001a9, 0x00000002, 0x00050051, 0x00000032, 0x000001b5, 0x000001b4, 
-    0x00000000, 0x00050051, 0x00000032, 0x000001b6, 0x000001b4, 0x00000001, 0x00050051, 0x00000032, 0x000001b7, 
-    0x000001b4, 0x00000002, 0x00050051, 0x00000032, 0x000001b8, 0x000001b4, 0x00000003, 0x00050051, 0x00000038, 
-    0x000001b9, 0x000001a9, 0x00000003, 0x00050051, 0x00000032, 0x000001ba, 0x000001b9, 0x00000000, 0x00050051, 
-    0x00000032, 0x000001bb, 0x000001b9, 0x00000001, 0x00050051, 0x00000032, 0x000001bc, 0x000001b9, 0x00000002, 
-    0x00050051, 0x00000032, 0x000001bd, 0x000001b9, 0x00000003, 0x00070050, 0x00000038, 0x000001be, 0x000001ab, 
-    0x000001ac, 0x000001ad, 0x000001ae, 0x00070050, 0x00000038, 0x000001bf, 0x000001b0, 0x000001b1, 0x000001b2, 
-    0x000001b3, 0x00070050, 0x00000038, 0x000001c0, 0x000001b5, 0x000001b6, 0x000001b7, 0x000001b8, 0x00070050, 
-    0x00000038, 0x000001c1, 0x000001ba, 0x000001bb, 0x000001bc, 0x000001bd, 0x00070050, 0x00000039, 0x000001c2, 
-    0x000001be, 0x000001bf, 0x000001c0, 0x000001c1, 0x00050042, 0x00000187, 0x000001c3, 0x00000184, 0x00000044, 
-    0x0006003d, 0x00000186, 0x000001c4, 0x000001c3, 0x00000002, 0x00000004, 0x00050051, 0x00000189, 0x000001c5, 
-    0x000001c4, 0x00000000, 0x00050051, 0x00000038, 0x000001c6, 0x000001c5, 0x00000000, 0x00050051, 0x00000032, 
-    0x000001c7, 0x000001c6, 0x00000000, 0x00050051, 0x00000032, 0x000001c8, 0x000001c6, 0x00000001, 0x00050051, 
-    0x00000032, 0x000001c9, 0x000001c6, 0x00000002, 0x00050051, 0x00000032, 0x000001ca, 0x000001c6, 0x00000003, 
-    0x00050051, 0x00000038, 0x000001cb, 0x000001c5, 0x00000001, 0x00050051, 0x00000032, 0x000001cc, 0x000001cb, 
-    0x00000000, 0x00050051, 0x00000032, 0x000001cd, 0x000001cb, 0x00000001, 0x00050051, 0x00000032, 0x000001ce, 
-    0x000001cb, 0x00000002, 0x00050051, 0x00000032, 0x000001cf, 0x000001cb, 0x00000003, 0x00050051, 0x00000038, 
-    0x000001d0, 0x000001c5, 0x00000002, 0x00050051, 0x00000032, 0x000001d1, 0x000001d0, 0x00000000, 0x00050051, 
-    0x00000032, 0x000001d2, 0x000001d0, 0x00000001, 0x00050051, 0x00000032, 0x000001d3, 0x000001d0, 0x00000002, 
-    0x00050051, 0x00000032, 0x000001d4, 0x000001d0, 0x00000003, 0x00050051, 0x00000038, 0x000001d5, 0x000001c5, 
-    0x00000003, 0x00050051, 0x00000032, 0x000001d6, 0x000001d5, 0x00000000, 0x00050051, 0x00000032, 0x000001d7, 
-    0x000001d5, 0x00000001, 0x00050051, 0x00000032, 0x000001d8, 0x000001d5, 0x00000002, 0x00050051, 0x00000032, 
-    0x000001d9, 0x000001d5, 0x00000003, 0x00070050, 0x00000038, 0x000001da, 0x000001c7, 0x000001c8, 0x000001c9, 
-    0x000001ca, 0x00070050, 0x00000038, 0x000001db, 0x000001cc, 0x000001cd, 0x000001ce, 0x000001cf, 0x00070050, 
-    0x00000038, 0x000001dc, 0x000001d1, 0x000001d2, 0x000001d3, 0x000001d4, 0x00070050, 0x00000038, 0x000001dd, 
-    0x000001d6, 0x000001d7, 0x000001d8, 0x000001d9, 0x00070050, 0x00000039, 0x000001de, 0x000001da, 0x000001db, 
-    0x000001dc, 0x000001dd, 0x00050042, 0x000001df, 0x000001e0, 0x00000184, 0x0000013e, 0x0006003d, 0x0000003a, 
-    0x000001e1, 0x000001e0, 0x00000002, 0x00000004, 0x00050042, 0x000001e2, 0x000001e3, 0x00000184, 0x0000018a, 
-    0x0006003d, 0x0000003b, 0x000001e4, 0x000001e3, 0x00000002, 0x00000004, 0x00050042, 0x000001df, 0x000001e6, 
-    0x00000184, 0x000001e5, 0x0006003d, 0x0000003a, 0x000001e7, 0x000001e6, 0x00000002, 0x00000004, 0x00050042, 
-    0x000001e2, 0x000001e9, 0x00000184, 0x000001e8, 0x0006003d, 0x0000003b, 0x000001ea, 0x000001e9, 0x00000002, 
-    0x00000004, 0x00050042, 0x000001ec, 0x000001ed, 0x00000184, 0x000001eb, 0x0006003d, 0x0000003d, 0x000001ee, 
-    0x000001ed, 0x00000002, 0x00000008, 0x00050042, 0x000001f0, 0x000001f1, 0x00000184, 0x000001ef, 0x0006003d, 
-    0x0000003f, 0x000001f2, 0x000001f1, 0x00000002, 0x00000008, 0x00050042, 0x000001f4, 0x000001f5, 0x00000184, 
-    0x000001f3, 0x0006003d, 0x00000041, 0x000001f6, 0x000001f5, 0x00000002, 0x00000008, 0x00050042, 0x000001f9, 
-    0x000001fa, 0x00000184, 0x000001f7, 0x00050042, 0x000001fd, 0x000001fe, 0x000001fa, 0x00000185, 0x00050041, 
-    0x000001ff, 0x00000200, 0x000001fe, 0x00000185, 0x00050042, 0x000001df, 0x00000201, 0x00000200, 0x00000185, 
-    0x0006003d, 0x0000003a, 0x00000202, 0x00000201, 0x00000002, 0x00000004, 0x00050042, 0x00000203, 0x00000204, 
-    0x00000200, 0x000001a6, 0x0006003d, 0x00000032, 0x00000205, 0x00000204, 0x00000002, 0x00000004, 0x00050042, 
-    0x000001df, 0x00000206, 0x00000200, 0x00000044, 0x0006003d, 0x0000003a, 0x00000207, 0x00000206, 0x00000002, 
-    0x00000004, 0x00050042, 0x000001e2, 0x00000208, 0x00000200, 0x0000013e, 0x0006003d, 0x0000003b, 0x00000209, 
-    0x00000208, 0x00000002, 0x00000004, 0x00050042, 0x000001df, 0x0000020a, 0x00000200, 0x0000018a, 0x0006003d, 
-    0x0000003a, 0x0000020b, 0x0000020a, 0x00000002, 0x00000004, 0x00050042, 0x00000203, 0x0000020c, 0x00000200, 
-    0x000001e5, 0x0006003d, 0x00000032, 0x0000020d, 0x0000020c, 0x00000002, 0x00000004, 0x00090050, 0x00000043, 
-    0x0000020e, 0x00000202, 0x00000205, 0x00000207, 0x00000209, 0x0000020b, 0x0000020d, 0x00050041, 0x000001ff, 
-    0x0000020f, 0x000001fe, 0x000001a6, 0x00050042, 0x000001df, 0x00000210, 0x0000020f, 0x00000185, 0x0006003d, 
-    0x0000003a, 0x00000211, 0x00000210, 0x00000002, 0x00000004, 0x00050042, 0x00000203, 0x00000212, 0x0000020f, 
-    0x000001a6, 0x0006003d, 0x00000032, 0x00000213, 0x00000212, 0x00000002, 0x00000004, 0x00050042, 0x000001df, 
-    0x00000214, 0x0000020f, 0x00000044, 0x0006003d, 0x0000003a, 0x00000215, 0x00000214, 0x00000002, 0x00000004, 
-    0x00050042, 0x000001e2, 0x00000216, 0x0000020f, 0x0000013e, 0x0006003d, 0x0000003b, 0x00000217, 0x00000216, 
-    0x00000002, 0x00000004, 0x00050042, 0x000001df, 0x00000218, 0x0000020f, 0x0000018a, 0x0006003d, 0x0000003a, 
-    0x00000219, 0x00000218, 0x00000002, 0x00000004, 0x00050042, 0x00000203, 0x0000021a, 0x0000020f, 0x000001e5, 
-    0x0006003d, 0x00000032, 0x0000021b, 0x0000021a, 0x00000002, 0x00000004, 0x00090050, 0x00000043, 0x0000021c, 
-    0x00000211, 0x00000213, 0x00000215, 0x00000217, 0x00000219, 0x0000021b, 0x00050050, 0x00000042, 0x0000021d, 
-    0x0000020e, 0x0000021c, 0x00050042, 0x00000220, 0x00000221, 0x00000184, 0x0000021e, 0x00050042, 0x000001df, 
-    0x00000222, 0x00000221, 0x00000185, 0x0006003d, 0x0000003a, 0x00000223, 0x00000222, 0x00000002, 0x00000004, 
-    0x00050042, 0x00000203, 0x00000224, 0x00000221, 0x000001a6, 0x0006003d, 0x00000032, 0x00000225, 0x00000224, 
-    0x00000002, 0x00000004, 0x00050042, 0x000001df, 0x00000226, 0x00000221, 0x00000044, 0x0006003d, 0x0000003a, 
-    0x00000227, 0x00000226, 0x00000002, 0x00000004, 0x00050042, 0x00000203, 0x00000228, 0x00000221, 0x0000013e, 
-    0x0006003d, 0x00000032, 0x00000229, 0x00000228, 0x00000002, 0x00000004, 0x00050042, 0x000001df, 0x0000022a, 
-    0x00000221, 0x0000018a, 0x0006003d, 0x0000003a, 0x0000022b, 0x0000022a, 0x00000002, 0x00000004, 0x00050042, 
-    0x00000203, 0x0000022c, 0x00000221, 0x000001e5, 0x0006003d, 0x00000032, 0x0000022d, 0x0000022c, 0x00000002, 
-    0x00000004, 0x00050042, 0x000001df, 0x0000022e, 0x00000221, 0x000001e8, 0x0006003d, 0x0000003a, 0x0000022f, 
-    0x0000022e, 0x00000002, 0x00000004, 0x00050042, 0x00000203, 0x00000230, 0x00000221, 0x000001eb, 0x0006003d, 
-    0x00000032, 0x00000231, 0x00000230, 0x00000002, 0x00000004, 0x00050042, 0x000001df, 0x00000232, 0x00000221, 
-    0x000001ef, 0x0006003d, 0x0000003a, 0x00000233, 0x00000232, 0x00000002, 0x00000004, 0x00050042, 0x00000203, 
-    0x00000234, 0x00000221, 0x000001f3, 0x0006003d, 0x00000032, 0x00000235, 0x00000234, 0x00000002, 0x00000004, 
-    0x00050042, 0x000001df, 0x00000236, 0x00000221, 0x000001f7, 0x0006003d, 0x0000003a, 0x00000237, 0x00000236, 
-    0x00000002, 0x00000004, 0x00050042, 0x00000203, 0x00000238, 0x00000221, 0x0000021e, 0x0006003d, 0x00000032, 
-    0x00000239, 0x00000238, 0x00000002, 0x00000004, 0x00050042, 0x000001df, 0x0000023b, 0x00000221, 0x0000023a, 
-    0x0006003d, 0x0000003a, 0x0000023c, 0x0000023b, 0x00000002, 0x00000004, 0x00050042, 0x00000203, 0x0000023e, 
-    0x00000221, 0x0000023d, 0x0006003d, 0x00000032, 0x0000023f, 0x0000023e, 0x00000002, 0x00000004, 0x00110050, 
-    0x00000045, 0x00000240, 0x00000223, 0x00000225, 0x00000227, 0x00000229, 0x0000022b, 0x0000022d, 0x0000022f, 
-    0x00000231, 0x00000233, 0x00000235, 0x00000237, 0x00000239, 0x0000023c, 0x0000023f, 0x000f0050, 0x00000037, 
-    0x00000241, 0x000001a5, 0x000001c2, 0x000001de, 0x000001e1, 0x000001e4, 0x000001e7, 0x000001ea, 0x000001ee, 
-    0x000001f2, 0x000001f6, 0x0000021d, 0x00000240, 0x0003003e, 0x00000047, 0x00000241, 0x000a000c, 0x00000003, 
-    0x00000243, 0x00000002, 0x00000067, 0x0000002d, 0x00000244, 0x00000244, 0x00000245, 0x00000070, 0x0008000c, 
-    0x00000003, 0x00000249, 0x00000002, 0x0000001c, 0x00000246, 0x00000049, 0x00000071, 0x0003003e, 0x00000049, 
-    0x00000058, 0x000a000c, 0x00000003, 0x0000024b, 0x00000002, 0x00000067, 0x0000002d, 0x0000024c, 0x0000024c, 
-    0x00000245, 0x00000070, 0x0008000c, 0x00000003, 0x0000024f, 0x00000002, 0x0000001c, 0x0000024d, 0x0000004a, 
-    0x00000071, 0x00050088, 0x00000033, 0x00000250, 0x00000079, 0x00000083, 0x0005008e, 0x00000033, 0x00000251, 
-    0x00000250, 0x00000252, 0x00050050, 0x00000033, 0x00000253, 0x00000254, 0x00000254, 0x00050083, 0x00000033, 
-    0x00000255, 0x00000251, 0x00000253, 0x0003003e, 0x0000004a, 0x00000255, 0x000a000c, 0x00000003, 0x00000257, 
-    0x00000002, 0x00000067, 0x0000002d, 0x00000258, 0x00000258, 0x00000245, 0x00000070, 0x0008000c, 0x00000003, 
-    0x0000025b, 0x00000002, 0x0000001c, 0x00000259, 0x0000004c, 0x00000071, 0x00060050, 0x00000038, 0x0000025c, 
-    0x00000255, 0x00000254, 0x00000254, 0x00050091, 0x00000038, 0x0000025d, 0x000001c2, 0x0000025c, 0x0003003e, 
-    0x0000004c, 0x0000025d, 0x000a000c, 0x00000003, 0x0000025f, 0x00000002, 0x00000067, 0x0000002d, 0x00000260, 
-    0x00000260, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x0000026d, 0x00000002, 0x0000001c, 0x0000026b, 
-    0x0000004f, 0x00000071, 0x000a000c, 0x00000003, 0x0000026e, 0x00000002, 0x00000067, 0x0000002d, 0x0000026f, 
-    0x0000026f, 0x00000064, 0x00000065, 0x00050042, 0x00000055, 0x00000270, 0x00000050, 0x00000185, 0x00050091, 
-    0x00000038, 0x00000271, 0x000001de, 0x00000272, 0x0008004f, 0x0000003a, 0x00000274, 0x00000271, 0x00000271, 
-    0x00000000, 0x00000001, 0x00000002, 0x0003003e, 0x00000270, 0x00000274, 0x00050042, 0x00000055, 0x00000276, 
-    0x0000004f, 0x00000185, 0x0003003e, 0x00000276, 0x00000274, 0x000a000c, 0x00000003, 0x00000278, 0x00000002, 
-    0x00000067, 0x0000002d, 0x00000279, 0x00000279, 0x00000064, 0x00000065, 0x00050042, 0x00000055, 0x0000027a, 
-    0x00000050, 0x00000044, 0x0008004f, 0x0000003a, 0x0000027b, 0x0000025d, 0x0000025d, 0x00000000, 0x00000001, 
-    0x00000002, 0x0006000c, 0x0000003a, 0x0000027c, 0x0000027d, 0x00000045, 0x0000027b, 0x00050050, 0x00000038, 
-    0x0000027e, 0x0000027c, 0x00000273, 0x00050091, 0x00000038, 0x0000027f, 0x000001de, 0x0000027e, 0x0008004f, 
-    0x0000003a, 0x00000280, 0x0000027f, 0x0000027f, 0x00000000, 0x00000001, 0x00000002, 0x0003003e, 0x0000027a, 
-    0x00000280, 0x00050042, 0x00000055, 0x00000282, 0x0000004f, 0x00000044, 0x0003003e, 0x00000282, 0x00000280, 
-    0x000a000c, 0x00000003, 0x00000284, 0x00000002, 0x00000067, 0x0000002d, 0x00000285, 0x00000285, 0x00000064, 
-    0x00000065, 0x00050042, 0x00000286, 0x00000287, 0x00000050, 0x000001a6, 0x0003003e, 0x00000287, 0x00000288, 
-    0x00050042, 0x00000286, 0x0000028a, 0x0000004f, 0x000001a6, 0x0003003e, 0x0000028a, 0x00000288, 0x000a000c, 
-    0x00000003, 0x0000028c, 0x00000002, 0x00000067, 0x0000002d, 0x0000028d, 0x0000028d, 0x00000064, 0x00000065, 
-    0x00050042, 0x00000286, 0x0000028e, 0x00000050, 0x0000013e, 0x0003003e, 0x0000028e, 0x0000028f, 0x00050042, 
-    0x00000286, 0x00000291, 0x0000004f, 0x0000013e, 0x0003003e, 0x00000291, 0x0000028f, 0x000a000c, 0x00000003, 
-    0x00000293, 0x00000002, 0x00000067, 0x0000002d, 0x00000294, 0x00000294, 0x00000064, 0x00000065, 0x0008000c, 
-    0x00000003, 0x000002a0, 0x00000002, 0x0000001c, 0x0000029d, 0x00000053, 0x00000071, 0x000a000c, 0x00000003, 
-    0x000002a1, 0x00000002, 0x00000067, 0x0000002d, 0x000002a2, 0x000002a2, 0x00000064, 0x00000065, 0x00050042, 
-    0x00000055, 0x000002a3, 0x00000054, 0x00000185, 0x0003003e, 0x000002a3, 0x000002a4, 0x00050042, 0x00000055, 
-    0x000002a6, 0x00000053, 0x00000185, 0x0003003e, 0x000002a6, 0x000002a4, 0x000a000c, 0x00000003, 0x000002a8, 
-    0x00000002, 0x00000067, 0x0000002d, 0x000002a9, 0x000002a9, 0x00000064, 0x00000065, 0x00050042, 0x00000286, 
-    0x000002aa, 0x00000054, 0x000001a6, 0x0003003e, 0x000002aa, 0x00000254, 0x00050042, 0x00000286, 0x000002ac, 
-    0x00000053, 0x000001a6, 0x0003003e, 0x000002ac, 0x00000254, 0x000a000c, 0x00000003, 0x000002ae, 0x00000002, 
-    0x00000067, 0x0000002d, 0x000002af, 0x000002af, 0x00000064, 0x00000065, 0x00050042, 0x000002b0, 0x000002b1, 
-    0x00000054, 0x00000044, 0x0003003e, 0x000002b1, 0x00000185, 0x00050042, 0x000002b0, 0x000002b3, 0x00000053, 
-    0x00000044, 0x0003003e, 0x000002b3, 0x00000185, 0x000a000c, 0x00000003, 0x000002b5, 0x00000002, 0x00000067, 
-    0x0000002d, 0x000002b6, 0x000002b6, 0x00000064, 0x00000065, 0x0004003d, 0x0000004d, 0x000002b7, 0x00000050, 
-    0x0004003d, 0x00000051, 0x000002b8, 0x00000054, 0x0003003e, 0x000002ba, 0x000002b8, 0x00050051, 0x0000003a, 
-    0x000002be, 0x000002b7, 0x00000000, 0x00050051, 0x0000003a, 0x000002bf, 0x000002b7, 0x00000002, 0x00050051, 
-    0x00000032, 0x000002c0, 0x000002b7, 0x00000001, 0x00050051, 0x00000032, 0x000002c1, 0x000002b7, 0x00000003, 
-    0x0004003d, 0x000002c2, 0x000002c3, 0x000002c5, 0x000c115d, 0x000002c3, 0x00000058, 0x000002cc, 0x00000058, 
-    0x00000058, 0x00000058, 0x000002be, 0x000002c0, 0x000002bf, 0x000002c1, 0x000002ba, 0x0004003d, 0x00000051, 
-    0x000002ce, 0x000002ba, 0x0003003e, 0x00000054, 0x000002ce, 0x0003003e, 0x00000053, 0x000002ce, 0x000a000c, 
-    0x00000003, 0x000002d1, 0x00000002, 0x00000067, 0x0000002d, 0x000000f3, 0x000000f3, 0x00000064, 0x00000065, 
-    0x0008000c, 0x00000003, 0x000002d3, 0x00000002, 0x0000001c, 0x000002d2, 0x00000056, 0x00000071, 0x0004003d, 
-    0x0000003a, 0x000002d4, 0x000002a3, 0x0003003e, 0x00000056, 0x000002d4, 0x000a000c, 0x00000003, 0x000002d6, 
-    0x00000002, 0x00000067, 0x0000002d, 0x000002d7, 0x000002d7, 0x00000064, 0x00000065, 0x0004006e, 0x000002d8, 
-    0x000002d9, 0x00000079, 0x0004007c, 0x00000077, 0x000002da, 0x000002d9, 0x00050050, 0x00000038, 0x000002db, 
-    0x000002d4, 0x00000254, 0x0004003d, 0x000002dc, 0x000002dd, 0x000002df, 0x00040063, 0x000002dd, 0x000002da, 
-    0x000002db, 0x000100fd, 0x00010038, 0x00050036, 0x00000003, 0x000002e7, 0x00000000, 0x00000030, 0x000200f8, 
-    0x000002e8, 0x0004003b, 0x00000052, 0x000002e9, 0x00000007, 0x0004003b, 0x00000055, 0x000002ea, 0x00000007, 
-    0x0004003b, 0x00000048, 0x000002eb, 0x00000007, 0x0004003b, 0x00000048, 0x000002ec, 0x00000007, 0x0004003b, 
-    0x00000048, 0x000002ed, 0x00000007, 0x0004003b, 0x00000046, 0x000002ee, 0x00000007, 0x0004003b, 0x000002f0, 
-    0x000002f1, 0x00000007, 0x0004003b, 0x000002f7, 0x000002f8, 0x00000007, 0x0004003b, 0x000002fa, 0x000002fb, 
-    0x00000007, 0x0004003b, 0x000002fd, 0x000002fe, 0x00000007, 0x0004003b, 0x00000055, 0x000002ff, 0x00000007, 
-    0x0004003b, 0x00000055, 0x00000300, 0x00000007, 0x0004003b, 0x00000034, 0x00000301, 0x00000007, 0x0004003b, 
-    0x00000055, 0x00000302, 0x00000007, 0x0004003b, 0x00000055, 0x00000303, 0x00000007, 0x0004003b, 0x00000055, 
-    0x00000304, 0x00000007, 0x0004003b, 0x00000286, 0x00000305, 0x00000007, 0x0004003b, 0x00000286, 0x00000306, 
-    0x00000007, 0x0004003b, 0x00000055, 0x00000307, 0x00000007, 0x0004003b, 0x00000286, 0x00000308, 0x00000007, 
-    0x0004003b, 0x00000286, 0x00000309, 0x00000007, 0x0004003b, 0x0000030a, 0x0000030b, 0x00000007, 0x0004003b, 
-    0x00000055, 0x0000030c, 0x00000007, 0x0004003b, 0x00000055, 0x0000030d, 0x00000007, 0x0004003b, 0x00000055, 
-    0x0000030e, 0x00000007, 0x0004003b, 0x00000286, 0x0000030f, 0x00000007, 0x0004003b, 0x00000055, 0x00000310, 
-    0x00000007, 0x0007000c, 0x00000003, 0x00000314, 0x00000002, 0x00000065, 0x00000311, 0x000002e7, 0x0006000c, 
-    0x00000003, 0x00000315, 0x00000002, 0x00000017, 0x00000311, 0x0008000c, 0x00000003, 0x0000032b, 0x00000002, 
-    0x0000001c, 0x0000032a, 0x000002e9, 0x00000071, 0x0004003d, 0x00000051, 0x0000032c, 0x0000032e, 0x0003003e, 
-    0x000002e9, 0x0000032c, 0x0004003d, 0x00000331, 0x00000332, 0x00000334, 0x000a000c, 0x00000003, 0x0000033a, 
-    0x00000002, 0x00000067, 0x0000002d, 0x0000033b, 0x0000033b, 0x00000064, 0x00000065, 0x000a000c, 0x00000003, 
-    0x0000033c, 0x00000002, 0x00000067, 0x0000002d, 0x0000033b, 0x0000033b, 0x00000064, 0x00000065, 0x000a000c, 
-    0x00000003, 0x0000033d, 0x00000002, 0x00000067, 0x0000002d, 0x0000033b, 0x0000033b, 0x00000064, 0x00000065, 
-    0x0008000c, 0x00000003, 0x0000033f, 0x00000002, 0x0000001c, 0x0000033e, 0x000002ea, 0x00000071, 0x00050051, 
-    0x00000033, 0x00000340, 0x00000332, 0x00000000, 0x00050051, 0x00000032, 0x00000341, 0x00000340, 0x00000000, 
-    0x00050083, 0x00000032, 0x00000342, 0x00000254, 0x00000341, 0x00050051, 0x00000032, 0x00000343, 0x00000340, 
-    0x00000001, 0x00050083, 0x00000032, 0x00000344, 0x00000342, 0x00000343, 0x00060050, 0x0000003a, 0x00000345, 
-    0x00000344, 0x00000341, 0x00000343, 0x0003003e, 0x000002ea, 0x00000345, 0x000a000c, 0x00000003, 0x00000347, 
-    0x00000002, 0x00000067, 0x0000002d, 0x00000348, 0x00000348, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 
-    0x0000034b, 0x00000002, 0x0000001c, 0x00000349, 0x000002eb, 0x00000071, 0x0004003d, 0x00000006, 0x0000034c, 
-    0x0000034e, 0x0003003e, 0x000002eb, 0x0000034c, 0x000a000c, 0x00000003, 0x00000350, 0x00000002, 0x00000067, 
-    0x0000002d, 0x00000351, 0x00000351, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000354, 0x00000002, 
-    0x0000001c, 0x00000352, 0x000002ec, 0x00000071, 0x0004003d, 0x00000006, 0x00000355, 0x00000356, 0x0003003e, 
-    0x000002ec, 0x00000355, 0x000a000c, 0x00000003, 0x00000358, 0x00000002, 0x00000067, 0x0000002d, 0x00000359, 
-    0x00000359, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x0000035c, 0x00000002, 0x0000001c, 0x0000035a, 
-    0x000002ed, 0x00000071, 0x0004003d, 0x00000006, 0x0000035d, 0x0000035e, 0x0003003e, 0x000002ed, 0x0000035d, 
-    0x000a000c, 0x00000003, 0x00000360, 0x00000002, 0x00000067, 0x0000002d, 0x00000361, 0x00000361, 0x00000064, 
-    0x00000065, 0x0008000c, 0x00000003, 0x00000364, 0x00000002, 0x0000001c, 0x00000362, 0x000002ee, 0x00000071, 
-    0x00050042, 0x00000181, 0x00000365, 0x00000142, 0x00000044, 0x0004003d, 0x00000140, 0x00000366, 0x00000365, 
-    0x00050043, 0x00000140, 0x00000367, 0x00000366, 0x00000185, 0x00050042, 0x00000187, 0x00000368, 0x00000367, 
-    0x00000185, 0x0006003d, 0x00000186, 0x00000369, 0x00000368, 0x00000002, 0x00000004, 0x00050051, 0x00000189, 
-    0x0000036a, 0x00000369, 0x00000000, 0x00050051, 0x00000038, 0x0000036b, 0x0000036a, 0x00000000, 0x00050051, 
-    0x00000032, 0x0000036c, 0x0000036b, 0x00000000, 0x00050051, 0x00000032, 0x0000036d, 0x0000036b, 0x00000001, 
-    0x00050051, 0x00000032, 0x0000036e, 0x0000036b, 0x00000002, 0x00050051, 0x00000032, 0x0000036f, 0x0000036b, 
-    0x00000003, 0x00050051, 0x00000038, 0x00000370, 0x0000036a, 0x00000001, 0x00050051, 0x00000032, 0x00000371, 
-    0x00000370, 0x00000000, 0x00050051, 0x00000032, 0x00000372, 0x00000370, 0x00000001, 0x00050051, 0x00000032, 
-    0x00000373, 0x00000370, 0x00000002, 0x00050051, 0x00000032, 0x00000374, 0x00000370, 0x00000003, 0x00050051, 
-    0x00000038, 0x00000375, 0x0000036a, 0x00000002, 0x00050051, 0x00000032, 0x00000376, 0x00000375, 0x00000000, 
-    0x00050051, 0x00000032, 0x00000377, 0x00000375, 0x00000001, 0x00050051, 0x00000032, 0x00000378, 0x00000375, 
-    0x00000002, 0x00050051, 0x00000032, 0x00000379, 0x00000375, 0x00000003, 0x00050051, 0x00000038, 0x0000037a, 
-    0x0000036a, 0x00000003, 0x00050051, 0x00000032, 0x0000037b, 0x0000037a, 0x00000000, 0x00050051, 0x00000032, 
-    0x0000037c, 0x0000037a, 0x00000001, 0x00050051, 0x00000032, 0x0000037d, 0x0000037a, 0x00000002, 0x00050051, 
-    0x00000032, 0x0000037e, 0x0000037a, 0x00000003, 0x00070050, 0x00000038, 0x0000037f, 0x0000036c, 0x0000036d, 
-    0x0000036e, 0x0000036f, 0x00070050, 0x00000038, 0x00000380, 0x00000371, 0x00000372, 0x00000373, 0x00000374, 
-    0x00070050, 0x00000038, 0x00000381, 0x00000376, 0x00000377, 0x00000378, 0x00000379, 0x00070050, 0x00000038, 
-    0x00000382, 0x0000037b, 0x0000037c, 0x0000037d, 0x0000037e, 0x00070050, 0x00000039, 0x00000383, 0x0000037f, 
-    0x00000380, 0x00000381, 0x00000382, 0x00050042, 0x00000187, 0x00000384, 0x00000367, 0x000001a6, 0x0006003d, 
-    0x00000186, 0x00000385, 0x00000384, 0x00000002, 0x00000004, 0x00050051, 0x00000189, 0x00000386, 0x00000385, 
-    0x00000000, 0x00050051, 0x00000038, 0x00000387, 0x00000386, 0x00000000, 0x00050051, 0x00000032, 0x00000388, 
-    0x00000387, 0x00000000, 0x00050051, 0x00000032, 0x00000389, 0x00000387, 0x00000001, 0x00050051, 0x00000032, 
-    0x0000038a, 0x00000387, 0x00000002, 0x00050051, 0x00000032, 0x0000038b, 0x00000387, 0x00000003, 0x00050051, 
-    0x00000038, 0x0000038c, 0x00000386, 0x00000001, 0x00050051, 0x00000032, 0x0000038d, 0x0000038c, 0x00000000, 
-    0x00050051, 0x00000032, 0x0000038e, 0x0000038c, 0x00000001, 0x00050051, 0x00000032, 0x0000038f, 0x0000038c, 
-    0x00000002, 0x00050051, 0x00000032, 0x00000390, 0x0000038c, 0x00000003, 0x00050051, 0x00000038, 0x00000391, 
-    0x00000386, 0x00000002, 0x00050051, 0x00000032, 0x00000392, 0x00000391, 0x00000000, 0x00050051, 0x00000032, 
-    0x00000393, 0x00000391, 0x00000001, 0x00050051, 0x00000032, 0x00000394, 0x00000391, 0x00000002, 0x00050051, 
-    0x00000032, 0x00000395, 0x00000391, 0x00000003, 0x00050051, 0x00000038, 0x00000396, 0x00000386, 0x00000003, 
-    0x00050051, 0x00000032, 0x00000397, 0x00000396, 0x00000000, 0x00050051, 0x00000032, 0x00000398, 0x00000396, 
-    0x00000001, 0x00050051, 0x00000032, 0x00000399, 0x00000396, 0x00000002, 0x00050051, 0x00000032, 0x0000039a, 
-    0x00000396, 0x00000003, 0x00070050, 0x00000038, 0x0000039b, 0x00000388, 0x00000389, 0x0000038a, 0x0000038b, 
-    0x00070050, 0x00000038, 0x0000039c, 0x0000038d, 0x0000038e, 0x0000038f, 0x00000390, 0x00070050, 0x00000038, 
-    0x0000039d, 0x00000392, 0x00000393, 0x00000394, 0x00000395, 0x00070050, 0x00000038, 0x0000039e, 0x00000397, 
-    0x00000398, 0x00000399, 0x0000039a, 0x00070050, 0x00000039, 0x0000039f, 0x0000039b, 0x0000039c, 0x0000039d, 
-    0x0000039e, 0x00050042, 0x00000187, 0x000003a0, 0x00000367, 0x00000044, 0x0006003d, 0x00000186, 0x000003a1, 
-    0x000003a0, 0x00000002, 0x00000004, 0x00050051, 0x00000189, 0x000003a2, 0x000003a1, 0x00000000, 0x00050051, 
-    0x00000038, 0x000003a3, 0x000003a2, 0x00000000, 0x00050051, 0x00000032, 0x000003a4, 0x000003a3, 0x00000000, 
-    0x00050051, 0x00000032, 0x000003a5, 0x000003a3, 0x00000001, 0x00050051, 0x00000032, 0x000003a6, 0x000003a3, 
-    0x00000002, 0x00050051, 0x00000032, 0x000003a7, 0x000003a3, 0x00000003, 0x00050051, 0x00000038, 0x000003a8, 
-    0x000003a2, 0x00000001, 0x00050051, 0x00000032, 0x000003a9, 0x000003a8, 0x00000000, 0x00050051, 0x00000032, 
-    0x000003aa, 0x000003a8, 0x00000001, 0x00050051, 0x00000032, 0x000003ab, 0x000003a8, 0x00000002, 0x00050051, 
-    0x00000032, 0x000003ac, 0x000003a8, 0x00000003, 0x00050051, 0x00000038, 0x000003ad, 0x000003a2, 0x00000002, 
-    0x00050051, 0x00000032, 0x000003ae, 0x000003ad, 0x00000000, 0x00050051, 0x00000032, 0x000003af, 0x000003ad, 
-    0x00000001, 0x00050051, 0x00000032, 0x000003b0, 0x000003ad, 0x00000002, 0x00050051, 0x00000032, 0x000003b1, 
-    0x000003ad, 0x00000003, 0x00050051, 0x00000038, 0x000003b2, 0x000003a2, 0x00000003, 0x00050051, 0x00000032, 
-    0x000003b3, 0x000003b2, 0x00000000, 0x00050051, 0x00000032, 0x000003b4, 0x000003b2, 0x00000001, 0x00050051, 
-    0x00000032, 0x000003b5, 0x000003b2, 0x00000002, 0x00050051, 0x00000032, 0x000003b6, 0x000003b2, 0x00000003, 
-    0x00070050, 0x00000038, 0x000003b7, 0x000003a4, 0x000003a5, 0x000003a6, 0x000003a7, 0x00070050, 0x00000038, 
-    0x000003b8, 0x000003a9, 0x000003aa, 0x000003ab, 0x000003ac, 0x00070050, 0x00000038, 0x000003b9, 0x000003ae, 
-    0x000003af, 0x000003b0, 0x000003b1, 0x00070050, 0x00000038, 0x000003ba, 0x000003b3, 0x000003b4, 0x000003b5, 
-    0x000003b6, 0x00070050, 0x00000039, 0x000003bb, 0x000003b7, 0x000003b8, 0x000003b9, 0x000003ba, 0x00050042, 
-    0x000001df, 0x000003bc, 0x00000367, 0x0000013e, 0x0006003d, 0x0000003a, 0x000003bd, 0x000003bc, 0x00000002, 
-    0x00000004, 0x00050042, 0x000001e2, 0x000003be, 0x00000367, 0x0000018a, 0x0006003d, 0x0000003b, 0x000003bf, 
-    0x000003be, 0x00000002, 0x00000004, 0x00050042, 0x000001df, 0x000003c0, 0x00000367, 0x000001e5, 0x0006003d, 
-    0x0000003a, 0x000003c1, 0x000003c0, 0x00000002, 0x00000004, 0x00050042, 0x000001e2, 0x000003c2, 0x00000367, 
-    0x000001e8, 0x0006003d, 0x0000003b, 0x000003c3, 0x000003c2, 0x00000002, 0x00000004, 0x00050042, 0x000001ec, 
-    0x000003c4, 0x00000367, 0x000001eb, 0x0006003d, 0x0000003d, 0x000003c5, 0x000003c4, 0x00000002, 0x00000008, 
-    0x00050042, 0x000001f0, 0x000003c6, 0x00000367, 0x000001ef, 0x0006003d, 0x0000003f, 0x000003c7, 0x000003c6, 
-    0x00000002, 0x00000008, 0x00050042, 0x000001f4, 0x000003c8, 0x00000367, 0x000001f3, 0x0006003d, 0x00000041, 
-    0x000003c9, 0x000003c8, 0x00000002, 0x00000008, 0x00050042, 0x000001f9, 0x000003ca, 0x00000367, 0x000001f7, 
-    0x00050042, 0x000001fd, 0x000003cb, 0x000003ca, 0x00000185, 0x00050041, 0x000001ff, 0x000003cc, 0x000003cb, 
-    0x00000185, 0x00050042, 0x000001df, 0x000003cd, 0x000003cc, 0x00000185, 0x0006003d, 0x0000003a, 0x000003ce, 
-    0x000003cd, 0x00000002, 0x00000004, 0x00050042, 0x00000203, 0x000003cf, 0x000003cc, 0x000001a6, 0x0006003d, 
-    0x00000032, 0x000003d0, 0x000003cf, 0x00000002, 0x00000004, 0x00050042, 0x000001df, 0x000003d1, 0x000003cc, 
-    0x00000044, 0x0006003d, 0x0000003a, 0x000003d2, 0x000003d1, 0x00000002, 0x00000004, 0x00050042, 0x000001e2, 
-    0x000003d3, 0x000003cc, 0x0000013e, 0x0006003d, 0x0000003b, 0x000003d4, 0x000003d3, 0x00000002, 0x00000004, 
-    0x00050042, 0x000001df, 0x000003d5, 0x000003cc, 0x0000018a, 0x0006003d, 0x0000003a, 0x000003d6, 0x000003d5, 
-    0x00000002, 0x00000004, 0x00050042, 0x00000203, 0x000003d7, 0x000003cc, 0x000001e5, 0x0006003d, 0x00000032, 
-    0x000003d8, 0x000003d7, 0x00000002, 0x00000004, 0x00090050, 0x00000043, 0x000003d9, 0x000003ce, 0x000003d0, 
-    0x000003d2, 0x000003d4, 0x000003d6, 0x000003d8, 0x00050041, 0x000001ff, 0x000003da, 0x000003cb, 0x000001a6, 
-    0x00050042, 0x000001df, 0x000003db, 0x000003da, 0x00000185, 0x0006003d, 0x0000003a, 0x000003dc, 0x000003db, 
-    0x00000002, 0x00000004, 0x00050042, 0x00000203, 0x000003dd, 0x000003da, 0x000001a6, 0x0006003d, 0x00000032, 
-    0x000003de, 0x000003dd, 0x00000002, 0x00000004, 0x00050042, 0x000001df, 0x000003df, 0x000003da, 0x00000044, 
-    0x0006003d, 0x0000003a, 0x000003e0, 0x000003df, 0x00000002, 0x00000004, 0x00050042, 0x000001e2, 0x000003e1, 
-    0x000003da, 0x0000013e, 0x0006003d, 0x0000003b, 0x000003e2, 0x000003e1, 0x00000002, 0x00000004, 0x00050042, 
-    0x000001df, 0x000003e3, 0x000003da, 0x0000018a, 0x0006003d, 0x0000003a, 0x000003e4, 0x000003e3, 0x00000002, 
-    0x00000004, 0x00050042, 0x00000203, 0x000003e5, 0x000003da, 0x000001e5, 0x0006003d, 0x00000032, 0x000003e6, 
-    0x000003e5, 0x00000002, 0x00000004, 0x00090050, 0x00000043, 0x000003e7, 0x000003dc, 0x000003de, 0x000003e0, 
-    0x000003e2, 0x000003e4, 0x000003e6, 0x00050050, 0x00000042, 0x000003e8, 0x000003d9, 0x000003e7, 0x00050042, 
-    0x00000220, 0x000003e9, 0x00000367, 0x0000021e, 0x00050042, 0x000001df, 0x000003ea, 0x000003e9, 0x00000185, 
-    0x0006003d, 0x0000003a, 0x000003eb, 0x000003ea, 0x00000002, 0x00000004, 0x00050042, 0x00000203, 0x000003ec, 
-    0x000003e9, 0x000001a6, 0x0006003d, 0x00000032, 0x000003ed, 0x000003ec, 0x00000002, 0x00000004, 0x00050042, 
-    0x000001df, 0x000003ee, 0x000003e9, 0x00000044, 0x0006003d, 0x0000003a, 0x000003ef, 0x000003ee, 0x00000002, 
-    0x00000004, 0x00050042, 0x00000203, 0x000003f0, 0x000003e9, 0x0000013e, 0x0006003d, 0x00000032, 0x000003f1, 
-    0x000003f0, 0x00000002, 0x00000004, 0x00050042, 0x000001df, 0x000003f2, 0x000003e9, 0x0000018a, 0x0006003d, 
-    0x0000003a, 0x000003f3, 0x000003f2, 0x00000002, 0x00000004, 0x00050042, 0x00000203, 0x000003f4, 0x000003e9, 
-    0x000001e5, 0x0006003d, 0x00000032, 0x000003f5, 0x000003f4, 0x00000002, 0x00000004, 0x00050042, 0x000001df, 
-    0x000003f6, 0x000003e9, 0x000001e8, 0x0006003d, 0x0000003a, 0x000003f7, 0x000003f6, 0x00000002, 0x00000004, 
-    0x00050042, 0x00000203, 0x000003f8, 0x000003e9, 0x000001eb, 0x0006003d, 0x00000032, 0x000003f9, 0x000003f8, 
-    0x00000002, 0x00000004, 0x00050042, 0x000001df, 0x000003fa, 0x000003e9, 0x000001ef, 0x0006003d, 0x0000003a, 
-    0x000003fb, 0x000003fa, 0x00000002, 0x00000004, 0x00050042, 0x00000203, 0x000003fc, 0x000003e9, 0x000001f3, 
-    0x0006003d, 0x00000032, 0x000003fd, 0x000003fc, 0x00000002, 0x00000004, 0x00050042, 0x000001df, 0x000003fe, 
-    0x000003e9, 0x000001f7, 0x0006003d, 0x0000003a, 0x000003ff, 0x000003fe, 0x00000002, 0x00000004, 0x00050042, 
-    0x00000203, 0x00000400, 0x000003e9, 0x0000021e, 0x0006003d, 0x00000032, 0x00000401, 0x00000400, 0x00000002, 
-    0x00000004, 0x00050042, 0x000001df, 0x00000402, 0x000003e9, 0x0000023a, 0x0006003d, 0x0000003a, 0x00000403, 
-    0x00000402, 0x00000002, 0x00000004, 0x00050042, 0x00000203, 0x00000404, 0x000003e9, 0x0000023d, 0x0006003d, 
-    0x00000032, 0x00000405, 0x00000404, 0x00000002, 0x00000004, 0x00110050, 0x00000045, 0x00000406, 0x000003eb, 
-    0x000003ed, 0x000003ef, 0x000003f1, 0x000003f3, 0x000003f5, 0x000003f7, 0x000003f9, 0x000003fb, 0x000003fd, 
-    0x000003ff, 0x00000401, 0x00000403, 0x00000405, 0x000f0050, 0x00000037, 0x00000407, 0x00000383, 0x0000039f, 
-    0x000003bb, 0x000003bd, 0x000003bf, 0x000003c1, 0x000003c3, 0x000003c5, 0x000003c7, 0x000003c9, 0x000003e8, 
-    0x00000406, 0x0003003e, 0x000002ee, 0x00000407, 0x000a000c, 0x00000003, 0x00000409, 0x00000002, 0x00000067, 
-    0x0000002d, 0x0000040a, 0x0000040a, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000413, 0x00000002, 
-    0x0000001c, 0x00000411, 0x000002f1, 0x00000071, 0x00050043, 0x0000003d, 0x00000414, 0x000003c5, 0x0000034c, 
-    0x00050042, 0x00000187, 0x00000415, 0x00000414, 0x00000185, 0x0006003d, 0x00000186, 0x00000416, 0x00000415, 
-    0x00000002, 0x00000004, 0x00050051, 0x00000189, 0x00000417, 0x00000416, 0x00000000, 0x00050051, 0x00000038, 
-    0x00000418, 0x00000417, 0x00000000, 0x00050051, 0x00000032, 0x00000419, 0x00000418, 0x00000000, 0x00050051, 
-    0x00000032, 0x0000041a, 0x00000418, 0x00000001, 0x00050051, 0x00000032, 0x0000041b, 0x00000418, 0x00000002, 
-    0x00050051, 0x00000032, 0x0000041c, 0x00000418, 0x00000003, 0x00050051, 0x00000038, 0x0000041d, 0x00000417, 
-    0x00000001, 0x00050051, 0x00000032, 0x0000041e, 0x0000041d, 0x00000000, 0x00050051, 0x00000032, 0x0000041f, 
-    0x0000041d, 0x00000001, 0x00050051, 0x00000032, 0x00000420, 0x0000041d, 0x00000002, 0x00050051, 0x00000032, 
-    0x00000421, 0x0000041d, 0x00000003, 0x00050051, 0x00000038, 0x00000422, 0x00000417, 0x00000002, 0x00050051, 
-    0x00000032, 0x00000423, 0x00000422, 0x00000000, 0x00050051, 0x00000032, 0x00000424, 0x00000422, 0x00000001, 
-    0x00050051, 0x00000032, 0x00000425, 0x00000422, 0x00000002, 0x00050051, 0x00000032, 0x00000426, 0x00000422, 
-    0x00000003, 0x00050051, 0x00000038, 0x00000427, 0x00000417, 0x00000003, 0x00050051, 0x00000032, 0x00000428, 
-    0x00000427, 0x00000000, 0x00050051, 0x00000032, 0x00000429, 0x00000427, 0x00000001, 0x00050051, 0x00000032, 
-    0x0000042a, 0x00000427, 0x00000002, 0x00050051, 0x00000032, 0x0000042b, 0x00000427, 0x00000003, 0x00070050, 
-    0x00000038, 0x0000042c, 0x00000419, 0x0000041a, 0x0000041b, 0x0000041c, 0x00070050, 0x00000038, 0x0000042d, 
-    0x0000041e, 0x0000041f, 0x00000420, 0x00000421, 0x00070050, 0x00000038, 0x0000042e, 0x00000423, 0x00000424, 
-    0x00000425, 0x00000426, 0x00070050, 0x00000038, 0x0000042f, 0x00000428, 0x00000429, 0x0000042a, 0x0000042b, 
-    0x00070050, 0x00000039, 0x00000430, 0x0000042c, 0x0000042d, 0x0000042e, 0x0000042f, 0x00050042, 0x00000431, 
-    0x00000432, 0x00000414, 0x000001a6, 0x0006003d, 0x00000006, 0x00000433, 0x00000432, 0x00000002, 0x00000004, 
-    0x00050042, 0x00000431, 0x00000434, 0x00000414, 0x00000044, 0x0006003d, 0x00000006, 0x00000435, 0x00000434, 
-    0x00000002, 0x00000004, 0x00060050, 0x000002ef, 0x00000436, 0x00000430, 0x00000433, 0x00000435, 0x0003003e, 
-    0x000002f1, 0x00000436, 0x000a000c, 0x00000003, 0x00000438, 0x00000002, 0x00000067, 0x0000002d, 0x00000439, 
-    0x00000439, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000451, 0x00000002, 0x0000001c, 0x0000044f, 
-    0x000002f8, 0x00000071, 0x00050043, 0x0000003f, 0x00000452, 0x000003c7, 0x00000435, 0x00050042, 0x00000453, 
-    0x00000454, 0x00000452, 0x00000185, 0x0006003d, 0x000002f4, 0x00000455, 0x00000454, 0x00000002, 0x00000008, 
-    0x00050042, 0x00000457, 0x00000458, 0x00000452, 0x000001a6, 0x00050042, 0x0000045a, 0x0000045b, 0x00000458, 
-    0x00000185, 0x00050042, 0x00000431, 0x0000045c, 0x0000045b, 0x00000185, 0x0006003d, 0x00000006, 0x0000045d, 
-    0x0000045c, 0x00000002, 0x00000004, 0x00050042, 0x00000431, 0x0000045e, 0x0000045b, 0x000001a6, 0x0006003d, 
-    0x00000006, 0x0000045f, 0x0000045e, 0x00000002, 0x00000004, 0x00050042, 0x00000431, 0x00000460, 0x0000045b, 
-    0x00000044, 0x0006003d, 0x00000006, 0x00000461, 0x00000460, 0x00000002, 0x00000004, 0x00060050, 0x000002f6, 
-    0x00000462, 0x0000045d, 0x0000045f, 0x00000461, 0x00050042, 0x0000045a, 0x00000463, 0x00000458, 0x000001a6, 
-    0x00050042, 0x00000431, 0x00000464, 0x00000463, 0x00000185, 0x0006003d, 0x00000006, 0x00000465, 0x00000464, 
-    0x00000002, 0x00000004, 0x00050042, 0x00000431, 0x00000466, 0x00000463, 0x000001a6, 0x0006003d, 0x00000006, 
-    0x00000467, 0x00000466, 0x00000002, 0x00000004, 0x00050042, 0x00000431, 0x00000468, 0x00000463, 0x00000044, 
-    0x0006003d, 0x00000006, 0x00000469, 0x00000468, 0x00000002, 0x00000004, 0x00060050, 0x000002f6, 0x0000046a, 
-    0x00000465, 0x00000467, 0x00000469, 0x00050042, 0x0000045a, 0x0000046b, 0x00000458, 0x00000044, 0x00050042, 
-    0x00000431, 0x0000046c, 0x0000046b, 0x00000185, 0x0006003d, 0x00000006, 0x0000046d, 0x0000046c, 0x00000002, 
-    0x00000004, 0x00050042, 0x00000431, 0x0000046e, 0x0000046b, 0x000001a6, 0x0006003d, 0x00000006, 0x0000046f, 
-    0x0000046e, 0x00000002, 0x00000004, 0x00050042, 0x00000431, 0x00000470, 0x0000046b, 0x00000044, 0x0006003d, 
-    0x00000006, 0x00000471, 0x00000470, 0x00000002, 0x00000004, 0x00060050, 0x000002f6, 0x00000472, 0x0000046d, 
-    0x0000046f, 0x00000471, 0x00050042, 0x0000045a, 0x00000473, 0x00000458, 0x0000013e, 0x00050042, 0x00000431, 
-    0x00000474, 0x00000473, 0x00000185, 0x0006003d, 0x00000006, 0x00000475, 0x00000474, 0x00000002, 0x00000004, 
-    0x00050042, 0x00000431, 0x00000476, 0x00000473, 0x000001a6, 0x0006003d, 0x00000006, 0x00000477, 0x00000476, 
-    0x00000002, 0x00000004, 0x00050042, 0x00000431, 0x00000478, 0x00000473, 0x00000044, 0x0006003d, 0x00000006, 
-    0x00000479, 0x00000478, 0x00000002, 0x00000004, 0x00060050, 0x000002f6, 0x0000047a, 0x00000475, 0x00000477, 
-    0x00000479, 0x00050042, 0x0000045a, 0x0000047b, 0x00000458, 0x0000018a, 0x00050042, 0x00000431, 0x0000047c, 
-    0x0000047b, 0x00000185, 0x0006003d, 0x00000006, 0x0000047d, 0x0000047c, 0x00000002, 0x00000004, 0x00050042, 
-    0x00000431, 0x0000047e, 0x0000047b, 0x000001a6, 0x0006003d, 0x00000006, 0x0000047f, 0x0000047e, 0x00000002, 
-    0x00000004, 0x00050042, 0x00000431, 0x00000480, 0x0000047b, 0x00000044, 0x0006003d, 0x00000006, 0x00000481, 
-    0x00000480, 0x00000002, 0x00000004, 0x00060050, 0x000002f6, 0x00000482, 0x0000047d, 0x0000047f, 0x00000481, 
-    0x00050042, 0x0000045a, 0x00000483, 0x00000458, 0x000001e5, 0x00050042, 0x00000431, 0x00000484, 0x00000483, 
-    0x00000185, 0x0006003d, 0x00000006, 0x00000485, 0x00000484, 0x00000002, 0x00000004, 0x00050042, 0x00000431, 
-    0x00000486, 0x00000483, 0x000001a6, 0x0006003d, 0x00000006, 0x00000487, 0x00000486, 0x00000002, 0x00000004, 
-    0x00050042, 0x00000431, 0x00000488, 0x00000483, 0x00000044, 0x0006003d, 0x00000006, 0x00000489, 0x00000488, 
-    0x00000002, 0x00000004, 0x00060050, 0x000002f6, 0x0000048a, 0x00000485, 0x00000487, 0x00000489, 0x00090050, 
-    0x000002f5, 0x0000048b, 0x00000462, 0x0000046a, 0x00000472, 0x0000047a, 0x00000482, 0x0000048a, 0x00050042, 
-    0x000001e2, 0x0000048c, 0x00000452, 0x00000044, 0x0006003d, 0x0000003b, 0x0000048d, 0x0000048c, 0x00000002, 
-    0x00000004, 0x00060050, 0x000002f2, 0x0000048e, 0x00000455, 0x0000048b, 0x0000048d, 0x0003003e, 0x000002f8, 
-    0x0000048e, 0x000a000c, 0x00000003, 0x00000490, 0x00000002, 0x00000067, 0x0000002d, 0x00000491, 0x00000491, 
-    0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x0000049b, 0x00000002, 0x0000001c, 0x00000499, 0x000002fb, 
-    0x00000071, 0x00050043, 0x00000041, 0x0000049c, 0x000003c9, 0x00000433, 0x00050042, 0x0000049d, 0x0000049e, 
-    0x0000049c, 0x00000185, 0x0006003d, 0x00000038, 0x0000049f, 0x0000049e, 0x00000002, 0x00000004, 0x00050042, 
-    0x00000203, 0x000004a0, 0x0000049c, 0x000001a6, 0x0006003d, 0x00000032, 0x000004a1, 0x000004a0, 0x00000002, 
-    0x00000004, 0x00050042, 0x00000203, 0x000004a2, 0x0000049c, 0x00000044, 0x0006003d, 0x00000032, 0x000004a3, 
-    0x000004a2, 0x00000002, 0x00000004, 0x00050042, 0x000001e2, 0x000004a4, 0x0000049c, 0x0000013e, 0x0006003d, 
-    0x0000003b, 0x000004a5, 0x000004a4, 0x00000002, 0x00000004, 0x00070050, 0x000002f9, 0x000004a6, 0x0000049f, 
-    0x000004a1, 0x000004a3, 0x000004a5, 0x0003003e, 0x000002fb, 0x000004a6, 0x000a000c, 0x00000003, 0x000004a8, 
-    0x00000002, 0x00000067, 0x0000002d, 0x000004a9, 0x000004a9, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 
-    0x000004ac, 0x00000002, 0x0000001c, 0x000004ab, 0x000002fe, 0x00000071, 0x0004007c, 0x0000003b, 0x000004ad, 
-    0x0000035d, 0x00070039, 0x000002fc, 0x000004ae, 0x000004af, 0x00000455, 0x0000048b, 0x000004ad, 0x0003003e, 
-    0x000002fe, 0x000004ae, 0x000a000c, 0x00000003, 0x00000521, 0x00000002, 0x00000067, 0x0000002d, 0x00000522, 
-    0x00000522, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000525, 0x00000002, 0x0000001c, 0x00000523, 
-    0x000002ff, 0x00000071, 0x0004007c, 0x00000073, 0x00000526, 0x000004ae, 0x00080039, 0x0000003a, 0x00000527, 
-    0x00000528, 0x00000455, 0x0000046a, 0x00000526, 0x00000345, 0x0003003e, 0x000002ff, 0x00000527, 0x000a000c, 
-    0x00000003, 0x000005b8, 0x00000002, 0x00000067, 0x0000002d, 0x000005b9, 0x000005b9, 0x00000064, 0x00000065, 
-    0x0008000c, 0x00000003, 0x000005bc, 0x00000002, 0x0000001c, 0x000005ba, 0x00000300, 0x00000071, 0x00080039, 
-    0x0000003a, 0x000005bd, 0x00000528, 0x00000455, 0x00000472, 0x00000526, 0x00000345, 0x0003003e, 0x00000300, 
-    0x000005bd, 0x000a000c, 0x00000003, 0x000005bf, 0x00000002, 0x00000067, 0x0000002d, 0x000002cc, 0x000002cc, 
-    0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x000005c2, 0x00000002, 0x0000001c, 0x000005c0, 0x00000301, 
-    0x00000071, 0x00080039, 0x00000033, 0x000005c3, 0x000005c4, 0x00000455, 0x00000482, 0x00000526, 0x00000345, 
-    0x0003003e, 0x00000301, 0x000005c3, 0x000a000c, 0x00000003, 0x00000641, 0x00000002, 0x00000067, 0x0000002d, 
-    0x00000642, 0x00000642, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000645, 0x00000002, 0x0000001c, 
-    0x00000643, 0x00000302, 0x00000071, 0x00050050, 0x00000038, 0x00000646, 0x00000527, 0x00000254, 0x0004003d, 
-    0x00000647, 0x00000648, 0x0000064a, 0x00050091, 0x0000003a, 0x0000064b, 0x00000648, 0x00000646, 0x0003003e, 
-    0x00000302, 0x0000064b, 0x000a000c, 0x00000003, 0x0000064d, 0x00000002, 0x00000067, 0x0000002d, 0x0000064e, 
-    0x0000064e, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000651, 0x00000002, 0x0000001c, 0x0000064f, 
-    0x00000303, 0x00000071, 0x0004003d, 0x00000647, 0x00000652, 0x00000653, 0x00050090, 0x00000038, 0x00000654, 
-    0x000005bd, 0x00000652, 0x0008004f, 0x0000003a, 0x00000655, 0x00000654, 0x00000654, 0x00000000, 0x00000001, 
-    0x00000002, 0x0006000c, 0x0000003a, 0x00000656, 0x0000027d, 0x00000045, 0x00000655, 0x0003003e, 0x00000303, 
-    0x00000656, 0x000a000c, 0x00000003, 0x00000658, 0x00000002, 0x00000067, 0x0000002d, 0x00000659, 0x00000659, 
-    0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x0000065c, 0x00000002, 0x0000001c, 0x0000065a, 0x00000304, 
-    0x00000071, 0x0008004f, 0x0000003a, 0x0000065d, 0x0000049f, 0x0000049f, 0x00000000, 0x00000001, 0x00000002, 
-    0x0003003e, 0x00000304, 0x0000065d, 0x000a000c, 0x00000003, 0x0000065f, 0x00000002, 0x00000067, 0x0000002d, 
-    0x00000660, 0x00000660, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000663, 0x00000002, 0x0000001c, 
-    0x00000661, 0x00000305, 0x00000071, 0x0003003e, 0x00000305, 0x000004a1, 0x000a000c, 0x00000003, 0x00000665, 
-    0x00000002, 0x00000067, 0x0000002d, 0x00000666, 0x00000666, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 
-    0x00000669, 0x00000002, 0x0000001c, 0x00000667, 0x00000306, 0x00000071, 0x0003003e, 0x00000306, 0x000004a3, 
-    0x000a000c, 0x00000003, 0x0000066b, 0x00000002, 0x00000067, 0x0000002d, 0x0000066c, 0x0000066c, 0x00000064, 
-    0x00000065, 0x000500ad, 0x00000089, 0x0000066d, 0x000004a5, 0x00000185, 0x000a000c, 0x00000003, 0x0000066e, 
-    0x00000002, 0x00000067, 0x0000002d, 0x0000066c, 0x0000066c, 0x0000066f, 0x000002e3, 0x000300f7, 0x0000031a, 
-    0x00000000, 0x000400fa, 0x0000066d, 0x00000318, 0x00000316, 0x000200f8, 0x00000316, 0x0006000c, 0x00000003, 
-    0x00000317, 0x00000002, 0x00000017, 0x00000311, 0x0003003e, 0x00000307, 0x0000065d, 0x000200f9, 0x0000031a, 
-    0x000200f8, 0x00000318, 0x0006000c, 0x00000003, 0x00000319, 0x00000002, 0x00000017, 0x00000311, 0x000a000c, 
-    0x00000003, 0x00000673, 0x00000002, 0x00000067, 0x0000002d, 0x00000674, 0x00000674, 0x00000008, 0x0000005c, 
-    0x000a000c, 0x00000003, 0x00000675, 0x00000002, 0x00000067, 0x0000002d, 0x00000674, 0x00000674, 0x00000008, 
-    0x0000005c, 0x00050041, 0x00000680, 0x00000681, 0x0000067a, 0x000004a5, 0x0004003d, 0x00000678, 0x00000682, 
-    0x00000681, 0x00070058, 0x00000038, 0x00000683, 0x00000682, 0x000005c3, 0x00000002, 0x00000273, 0x00040053, 
-    0x00000038, 0x00000684, 0x00000683, 0x0008004f, 0x0000003a, 0x00000685, 0x00000684, 0x00000684, 0x00000000, 
-    0x00000001, 0x00000002, 0x00050085, 0x0000003a, 0x00000686, 0x0000065d, 0x00000685, 0x0003003e, 0x00000304, 
-    0x00000686, 0x0003003e, 0x00000307, 0x00000686, 0x000200f9, 0x0000031a, 0x000200f8, 0x0000031a, 0x0006000c, 
-    0x00000003, 0x0000031b, 0x00000002, 0x00000017, 0x00000311, 0x000a000c, 0x00000003, 0x0000068a, 0x00000002, 
-    0x00000067, 0x0000002d, 0x0000068b, 0x0000068b, 0x00000064, 0x00000065, 0x00050042, 0x0000068c, 0x0000068d, 
-    0x00000142, 0x0000013e, 0x0004003d, 0x00000033, 0x0000068e, 0x0000068d, 0x00050051, 0x00000032, 0x0000068f, 
-    0x0000068e, 0x00000000, 0x000500be, 0x00000089, 0x00000690, 0x0000068f, 0x00000273, 0x000a000c, 0x00000003, 
-    0x00000691, 0x00000002, 0x00000067, 0x0000002d, 0x0000068b, 0x0000068b, 0x00000692, 0x00000693, 0x000300f7, 
-    0x00000320, 0x00000000, 0x000400fa, 0x00000690, 0x0000031e, 0x0000031c, 0x000200f8, 0x0000031c, 0x0006000c, 
-    0x00000003, 0x0000031d, 0x00000002, 0x00000017, 0x00000311, 0x0003003e, 0x00000308, 0x000004a1, 0x000200f9, 
-    0x00000320, 0x000200f8, 0x0000031e, 0x0006000c, 0x00000003, 0x0000031f, 0x00000002, 0x00000017, 0x00000311, 
-    0x000a000c, 0x00000003, 0x00000697, 0x00000002, 0x00000067, 0x0000002d, 0x00000698, 0x00000698, 0x00000008, 
-    0x0000005c, 0x0003003e, 0x00000305, 0x0000068f, 0x0003003e, 0x00000308, 0x0000068f, 0x000200f9, 0x00000320, 
-    0x000200f8, 0x00000320, 0x0006000c, 0x00000003, 0x00000321, 0x00000002, 0x00000017, 0x00000311, 0x000a000c, 
-    0x00000003, 0x0000069c, 0x00000002, 0x00000067, 0x0000002d, 0x0000069d, 0x0000069d, 0x00000064, 0x00000065, 
-    0x00050051, 0x00000032, 0x0000069e, 0x0000068e, 0x00000001, 0x000500be, 0x00000089, 0x0000069f, 0x0000069e, 
-    0x00000273, 0x000a000c, 0x00000003, 0x000006a0, 0x00000002, 0x00000067, 0x0000002d, 0x0000069d, 0x0000069d, 
-    0x00000692, 0x00000693, 0x000300f7, 0x00000326, 0x00000000, 0x000400fa, 0x0000069f, 0x00000324, 0x00000322, 
-    0x000200f8, 0x00000322, 0x0006000c, 0x00000003, 0x00000323, 0x00000002, 0x00000017, 0x00000311, 0x0003003e, 
-    0x00000309, 0x000004a3, 0x000200f9, 0x00000326, 0x000200f8, 0x00000324, 0x0006000c, 0x00000003, 0x00000325, 
-    0x00000002, 0x00000017, 0x00000311, 0x000a000c, 0x00000003, 0x000006a4, 0x00000002, 0x00000067, 0x0000002d, 
-    0x000006a5, 0x000006a5, 0x00000008, 0x0000005c, 0x0003003e, 0x00000306, 0x0000069e, 0x0003003e, 0x00000309, 
-    0x0000069e, 0x000200f9, 0x00000326, 0x000200f8, 0x00000326, 0x0006000c, 0x00000003, 0x00000327, 0x00000002, 
-    0x00000017, 0x00000311, 0x000a000c, 0x00000003, 0x000006a9, 0x00000002, 0x00000067, 0x0000002d, 0x000006aa, 
-    0x000006aa, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x000006ad, 0x00000002, 0x0000001c, 0x000006ab, 
-    0x0000030b, 0x00000071, 0x00060039, 0x00000043, 0x000006ae, 0x000006af, 0x00000407, 0x0000064b, 0x0003003e, 
-    0x0000030b, 0x000006ae, 0x000a000c, 0x00000003, 0x00000779, 0x00000002, 0x00000067, 0x0000002d, 0x0000077a, 
-    0x0000077a, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x0000077d, 0x00000002, 0x0000001c, 0x0000077b, 
-    0x0000030c, 0x00000071, 0x0006000c, 0x0000003a, 0x0000077e, 0x0000027d, 0x00000045, 0x00000656, 0x0003003e, 
-    0x0000030c, 0x0000077e, 0x000a000c, 0x00000003, 0x00000780, 0x00000002, 0x00000067, 0x0000002d, 0x00000781, 
-    0x00000781, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000784, 0x00000002, 0x0000001c, 0x00000782, 
-    0x0000030d, 0x00000071, 0x0004003d, 0x0000003a, 0x00000785, 0x00000787, 0x0004007f, 0x0000003a, 0x00000788, 
-    0x00000785, 0x0003003e, 0x0000030d, 0x00000788, 0x000a000c, 0x00000003, 0x0000078a, 0x00000002, 0x00000067, 
-    0x0000002d, 0x0000078b, 0x0000078b, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x0000078e, 0x00000002, 
-    0x0000001c, 0x0000078c, 0x0000030e, 0x00000071, 0x00050051, 0x0000003a, 0x0000078f, 0x000006ae, 0x00000002, 
-    0x0006000c, 0x0000003a, 0x00000790, 0x0000027d, 0x00000045, 0x0000078f, 0x0003003e, 0x0000030e, 0x00000790, 
-    0x000a000c, 0x00000003, 0x00000792, 0x00000002, 0x00000067, 0x0000002d, 0x00000793, 0x00000793, 0x00000064, 
-    0x00000065, 0x0008000c, 0x00000003, 0x00000796, 0x00000002, 0x0000001c, 0x00000794, 0x0000030f, 0x00000071, 
-    0x00080039, 0x00000032, 0x00000797, 0x00000798, 0x0000064b, 0x0000077e, 0x0000078f, 0x000006ae, 0x0003003e, 
-    0x0000030f, 0x00000797, 0x000a000c, 0x00000003, 0x00000819, 0x00000002, 0x00000067, 0x0000002d, 0x0000081a, 
-    0x0000081a, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x0000081c, 0x00000002, 0x0000001c, 0x0000081b, 
-    0x00000310, 0x00000071, 0x0004003d, 0x0000003a, 0x0000081d, 0x00000307, 0x0004003d, 0x00000032, 0x0000081e, 
-    0x00000308, 0x0004003d, 0x00000032, 0x0000081f, 0x00000309, 0x000a0039, 0x0000003a, 0x00000820, 0x00000821, 
-    0x0000081d, 0x0000081e, 0x0000081f, 0x0000077e, 0x00000788, 0x00000790, 0x0003003e, 0x00000310, 0x00000820, 
-    0x000a000c, 0x00000003, 0x00000b9d, 0x00000002, 0x00000067, 0x0000002d, 0x00000b9e, 0x00000b9e, 0x00000064, 
-    0x00000065, 0x00050051, 0x0000003a, 0x00000b9f, 0x000006ae, 0x00000004, 0x00050051, 0x00000032, 0x00000ba0, 
-    0x000006ae, 0x00000001, 0x0005008e, 0x0000003a, 0x00000ba1, 0x00000b9f, 0x00000ba0, 0x0005008e, 0x0000003a, 
-    0x00000ba2, 0x00000ba1, 0x00000797, 0x00050085, 0x0000003a, 0x00000ba3, 0x00000820, 0x00000ba2, 0x0003003e, 
-    0x00000310, 0x00000ba3, 0x000a000c, 0x00000003, 0x00000ba5, 0x00000002, 0x00000067, 0x0000002d, 0x00000ba6, 
-    0x00000ba6, 0x00000064, 0x00000065, 0x00050042, 0x00000ba7, 0x00000ba8, 0x0000032e, 0x00000185, 0x0003003e, 
-    0x00000ba8, 0x00000ba3, 0x00050042, 0x00000055, 0x00000baa, 0x000002e9, 0x00000185, 0x0003003e, 0x00000baa, 
-    0x00000ba3, 0x000100fd, 0x00010038, 0x00050036, 0x000002fc, 0x000004af, 0x00000000, 0x000004b0, 0x00030037, 
-    0x000002f4, 0x000004b1, 0x00030037, 0x000002f5, 0x000004b2, 0x00030037, 0x0000003b, 0x000004b3, 0x000200f8, 
-    0x000004b4, 0x0004003b, 0x000002b0, 0x000004b5, 0x00000007, 0x0004003b, 0x000004b6, 0x000004b7, 0x00000007, 
-    0x0004003b, 0x000004b8, 0x000004b9, 0x00000007, 0x0004003b, 0x000004bb, 0x000004bc, 0x00000007, 0x0004003b, 
-    0x000004c0, 0x000004c1, 0x00000007, 0x0007000c, 0x00000003, 0x000004c6, 0x00000002, 0x00000065, 0x000004c3, 
-    0x000004af, 0x0006000c, 0x00000003, 0x000004c7, 0x00000002, 0x00000017, 0x000004c3, 0x0008000c, 0x00000003, 
-    0x000004d4, 0x00000002, 0x0000001c, 0x000004d2, 0x000004b5, 0x00000071, 0x0003003e, 0x000004b5, 0x000004b3, 
-    0x0008000c, 0x00000003, 0x000004d7, 0x00000002, 0x0000001c, 0x000004d6, 0x000004b7, 0x00000071, 0x0003003e, 
-    0x000004b7, 0x000004b2, 0x0008000c, 0x00000003, 0x000004db, 0x00000002, 0x0000001c, 0x000004d9, 0x000004b9, 
-    0x00000071, 0x0003003e, 0x000004b9, 0x000004b1, 0x000a000c, 0x00000003, 0x000004dd, 0x00000002, 0x00000067, 
-    0x0000002d, 0x000004de, 0x000004de, 0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x000004df, 0x00000002, 
-    0x00000067, 0x0000002d, 0x000004de, 0x000004de, 0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x000004e0, 
-    0x00000002, 0x00000067, 0x0000002d, 0x000004de, 0x000004de, 0x00000064, 0x00000065, 0x00050051, 0x000002f6, 
-    0x000004e1, 0x000004b2, 0x00000000, 0x00050051, 0x00000006, 0x000004e2, 0x000004e1, 0x00000002, 0x000500aa, 
-    0x00000089, 0x000004e3, 0x000004e2, 0x0000006d, 0x000a000c, 0x00000003, 0x000004e4, 0x00000002, 0x00000067, 
-    0x0000002d, 0x000004de, 0x000004de, 0x000004e5, 0x000004e6, 0x000300f7, 0x000004cc, 0x00000000, 0x000400fa, 
-    0x000004e3, 0x000004d0, 0x000004c8, 0x000200f8, 0x000004c8, 0x0006000c, 0x00000003, 0x000004c9, 0x00000002, 
-    0x00000017, 0x000004c3, 0x000a000c, 0x00000003, 0x000004e8, 0x00000002, 0x00000067, 0x0000002d, 0x000004e9, 
-    0x000004e9, 0x0000008e, 0x00000245, 0x000500aa, 0x00000089, 0x000004ea, 0x000004e2, 0x00000065, 0x000a000c, 
-    0x00000003, 0x000004eb, 0x00000002, 0x00000067, 0x0000002d, 0x000004e9, 0x000004e9, 0x000004ec, 0x000002ca, 
-    0x000300f7, 0x000004ca, 0x00000000, 0x000400fa, 0x000004ea, 0x000004ce, 0x000004ca, 0x000200f8, 0x000004ca, 
-    0x0006000c, 0x00000003, 0x000004cb, 0x00000002, 0x00000017, 0x000004c3, 0x000200f9, 0x000004cc, 0x000200f8, 
-    0x000004cc, 0x0006000c, 0x00000003, 0x000004cd, 0x00000002, 0x00000017, 0x000004c3, 0x000a000c, 0x00000003, 
-    0x000004ef, 0x00000002, 0x00000067, 0x0000002d, 0x000004f0, 0x000004f0, 0x00000064, 0x00000065, 0x000200fe, 
-    0x000004f1, 0x000200f8, 0x000004ce, 0x0006000c, 0x00000003, 0x000004cf, 0x00000002, 0x00000017, 0x000004c3, 
-    0x000a000c, 0x00000003, 0x000004f4, 0x00000002, 0x00000067, 0x0000002d, 0x000004f5, 0x000004f5, 0x00000008, 
-    0x0000005c, 0x000a000c, 0x00000003, 0x000004f6, 0x00000002, 0x00000067, 0x0000002d, 0x000004f5, 0x000004f5, 
-    0x00000008, 0x0000005c, 0x000a000c, 0x00000003, 0x000004f7, 0x00000002, 0x00000067, 0x0000002d, 0x000004f5, 
-    0x000004f5, 0x00000008, 0x0000005c, 0x0008000c, 0x00000003, 0x000004fa, 0x00000002, 0x0000001c, 0x000004f9, 
-    0x000004bc, 0x00000071, 0x00050051, 0x00000006, 0x000004fb, 0x000004e1, 0x00000000, 0x00040071, 0x000004fc, 
-    0x000004fd, 0x000004fb, 0x0004007c, 0x000004fe, 0x000004ff, 0x000004fd, 0x00050043, 0x000002f4, 0x00000500, 
-    0x000004b1, 0x000004ff, 0x0004007c, 0x000004fc, 0x00000501, 0x00000500, 0x0004007c, 0x000004ba, 0x00000502, 
-    0x00000501, 0x0003003e, 0x000004bc, 0x00000502, 0x000a000c, 0x00000003, 0x00000504, 0x00000002, 0x00000067, 
-    0x0000002d, 0x00000505, 0x00000505, 0x00000008, 0x0000005c, 0x00050043, 0x000004ba, 0x00000506, 0x00000502, 
-    0x000004b3, 0x0006003d, 0x000002fc, 0x00000507, 0x00000506, 0x00000002, 0x00000004, 0x000200fe, 0x00000507, 
-    0x000200f8, 0x000004d0, 0x0006000c, 0x00000003, 0x000004d1, 0x00000002, 0x00000017, 0x000004c3, 0x000a000c, 
-    0x00000003, 0x00000509, 0x00000002, 0x00000067, 0x0000002d, 0x0000050a, 0x0000050a, 0x00000008, 0x0000005c, 
-    0x000a000c, 0x00000003, 0x0000050b, 0x00000002, 0x00000067, 0x0000002d, 0x0000050a, 0x0000050a, 0x00000008, 
-    0x0000005c, 0x000a000c, 0x00000003, 0x0000050c, 0x00000002, 0x00000067, 0x0000002d, 0x0000050a, 0x0000050a, 
-    0x00000008, 0x0000005c, 0x0008000c, 0x00000003, 0x00000513, 0x00000002, 0x0000001c, 0x00000511, 0x000004c1, 
-    0x00000071, 0x00050051, 0x00000006, 0x00000514, 0x000004e1, 0x00000000, 0x00040071, 0x000004fc, 0x00000515, 
-    0x00000514, 0x0004007c, 0x000004fe, 0x00000516, 0x00000515, 0x00050043, 0x000002f4, 0x00000517, 0x000004b1, 
-    0x00000516, 0x0004007c, 0x000004fc, 0x00000518, 0x00000517, 0x0004007c, 0x000004bf, 0x00000519, 0x00000518, 
-    0x0003003e, 0x000004c1, 0x00000519, 0x000a000c, 0x00000003, 0x0000051b, 0x00000002, 0x00000067, 0x0000002d, 
-    0x0000043b, 0x0000043b, 0x00000008, 0x0000005c, 0x00050043, 0x000004bf, 0x0000051c, 0x00000519, 0x000004b3, 
-    0x0006003d, 0x000004be, 0x0000051d, 0x0000051c, 0x00000002, 0x00000002, 0x00040072, 0x000002fc, 0x0000051e, 
-    0x0000051d, 0x000200fe, 0x0000051e, 0x00010038, 0x00050036, 0x0000003a, 0x00000528, 0x00000000, 0x00000529, 
-    0x00030037, 0x000002f4, 0x0000052a, 0x00030037, 0x000002f6, 0x0000052b, 0x00030037, 0x00000073, 0x0000052c, 
-    0x00030037, 0x0000003a, 0x0000052d, 0x000200f8, 0x0000052e, 0x0004003b, 0x00000055, 0x0000052f, 0x00000007, 
-    0x0004003b, 0x00000530, 0x00000531, 0x00000007, 0x0004003b, 0x00000532, 0x00000533, 0x00000007, 0x0004003b, 
-    0x000004b8, 0x00000534, 0x00000007, 0x0004003b, 0x00000055, 0x00000535, 0x00000007, 0x0004003b, 0x00000055, 
-    0x00000536, 0x00000007, 0x0004003b, 0x00000055, 0x00000537, 0x00000007, 0x0007000c, 0x00000003, 0x0000053c, 
-    0x00000002, 0x00000065, 0x00000539, 0x00000528, 0x0006000c, 0x00000003, 0x0000053d, 0x00000002, 0x00000017, 
-    0x00000539, 0x0008000c, 0x00000003, 0x0000053f, 0x00000002, 0x0000001c, 0x0000053e, 0x0000052f, 0x00000071, 
-    0x0003003e, 0x0000052f, 0x0000052d, 0x0008000c, 0x00000003, 0x00000544, 0x00000002, 0x0000001c, 0x00000542, 
-    0x00000531, 0x00000071, 0x0003003e, 0x00000531, 0x0000052c, 0x0008000c, 0x00000003, 0x00000548, 0x00000002, 
-    0x0000001c, 0x00000546, 0x00000533, 0x00000071, 0x0003003e, 0x00000533, 0x0000052b, 0x0008000c, 0x00000003, 
-    0x0000054b, 0x00000002, 0x0000001c, 0x0000054a, 0x00000534, 0x00000071, 0x0003003e, 0x00000534, 0x0000052a, 
-    0x000a000c, 0x00000003, 0x0000054d, 0x00000002, 0x00000067, 0x0000002d, 0x0000054e, 0x0000054e, 0x00000064, 
-    0x00000065, 0x000a000c, 0x00000003, 0x0000054f, 0x00000002, 0x00000067, 0x0000002d, 0x0000054e, 0x0000054e, 
-    0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x00000550, 0x00000002, 0x00000067, 0x0000002d, 0x0000054e, 
-    0x0000054e, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000553, 0x00000002, 0x0000001c, 0x00000551, 
-    0x00000535, 0x00000071, 0x00050051, 0x00000006, 0x00000554, 0x0000052c, 0x00000000, 0x00070039, 0x0000003a, 
-    0x00000555, 0x00000556, 0x0000052a, 0x0000052b, 0x00000554, 0x0003003e, 0x00000535, 0x00000555, 0x000a000c, 
-    0x00000003, 0x0000059b, 0x00000002, 0x00000067, 0x0000002d, 0x0000059c, 0x0000059c, 0x00000064, 0x00000065, 
-    0x0008000c, 0x00000003, 0x0000059f, 0x00000002, 0x0000001c, 0x0000059d, 0x00000536, 0x00000071, 0x00050051, 
-    0x00000006, 0x000005a0, 0x0000052c, 0x00000001, 0x00070039, 0x0000003a, 0x000005a1, 0x00000556, 0x0000052a, 
-    0x0000052b, 0x000005a0, 0x0003003e, 0x00000536, 0x000005a1, 0x000a000c, 0x00000003, 0x000005a3, 0x00000002, 
-    0x00000067, 0x0000002d, 0x00000099, 0x00000099, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x000005a6, 
-    0x00000002, 0x0000001c, 0x000005a4, 0x00000537, 0x00000071, 0x00050051, 0x00000006, 0x000005a7, 0x0000052c, 
-    0x00000002, 0x00070039, 0x0000003a, 0x000005a8, 0x00000556, 0x0000052a, 0x0000052b, 0x000005a7, 0x0003003e, 
-    0x00000537, 0x000005a8, 0x000a000c, 0x00000003, 0x000005aa, 0x00000002, 0x00000067, 0x0000002d, 0x0000040c, 
-    0x0000040c, 0x00000064, 0x00000065, 0x00050051, 0x00000032, 0x000005ab, 0x0000052d, 0x00000000, 0x00060050, 
-    0x0000003a, 0x000005ac, 0x000005ab, 0x000005ab, 0x000005ab, 0x00050085, 0x0000003a, 0x000005ad, 0x000005ac, 
-    0x00000555, 0x00050051, 0x00000032, 0x000005ae, 0x0000052d, 0x00000001, 0x00060050, 0x0000003a, 0x000005af, 
-    0x000005ae, 0x000005ae, 0x000005ae, 0x00050085, 0x0000003a, 0x000005b0, 0x000005af, 0x000005a1, 0x00050081, 
-    0x0000003a, 0x000005b1, 0x000005ad, 0x000005b0, 0x00050051, 0x00000032, 0x000005b2, 0x0000052d, 0x00000002, 
-    0x00060050, 0x0000003a, 0x000005b3, 0x000005b2, 0x000005b2, 0x000005b2, 0x00050085, 0x0000003a, 0x000005b4, 
-    0x000005b3, 0x000005a8, 0x00050081, 0x0000003a, 0x000005b5, 0x000005b1, 0x000005b4, 0x000200fe, 0x000005b5, 
-    0x00010038, 0x00050036, 0x0000003a, 0x00000556, 0x00000000, 0x00000557, 0x00030037, 0x000002f4, 0x00000558, 
-    0x00030037, 0x000002f6, 0x00000559, 0x00030037, 0x00000006, 0x0000055a, 0x000200f8, 0x0000055b, 0x0004003b, 
-    0x00000048, 0x0000055c, 0x00000007, 0x0004003b, 0x00000532, 0x0000055d, 0x00000007, 0x0004003b, 0x000004b8, 
-    0x0000055e, 0x00000007, 0x0004003b, 0x0000055f, 0x00000560, 0x00000007, 0x0007000c, 0x00000003, 0x00000565, 
-    0x00000002, 0x00000065, 0x00000562, 0x00000556, 0x0006000c, 0x00000003, 0x00000566, 0x00000002, 0x00000017, 
-    0x00000562, 0x0008000c, 0x00000003, 0x0000056c, 0x00000002, 0x0000001c, 0x0000056b, 0x0000055c, 0x00000071, 
-    0x0003003e, 0x0000055c, 0x0000055a, 0x0008000c, 0x00000003, 0x0000056f, 0x00000002, 0x0000001c, 0x0000056e, 
-    0x0000055d, 0x00000071, 0x0003003e, 0x0000055d, 0x00000559, 0x0008000c, 0x00000003, 0x00000572, 0x00000002, 
-    0x0000001c, 0x00000571, 0x0000055e, 0x00000071, 0x0003003e, 0x0000055e, 0x00000558, 0x000a000c, 0x00000003, 
-    0x00000574, 0x00000002, 0x00000067, 0x0000002d, 0x00000443, 0x00000443, 0x00000064, 0x00000065, 0x000a000c, 
-    0x00000003, 0x00000575, 0x00000002, 0x00000067, 0x0000002d, 0x00000443, 0x00000443, 0x00000064, 0x00000065, 
-    0x000a000c, 0x00000003, 0x00000576, 0x00000002, 0x00000067, 0x0000002d, 0x00000443, 0x00000443, 0x00000064, 
-    0x00000065, 0x00050051, 0x00000006, 0x00000577, 0x00000559, 0x00000001, 0x000500ac, 0x00000089, 0x00000578, 
-    0x00000577, 0x00000058, 0x000a000c, 0x00000003, 0x00000579, 0x00000002, 0x00000067, 0x0000002d, 0x00000443, 
-    0x00000443, 0x0000057a, 0x0000057b, 0x000300f7, 0x00000567, 0x00000000, 0x000400fa, 0x00000578, 0x00000569, 
-    0x00000567, 0x000200f8, 0x00000567, 0x0006000c, 0x00000003, 0x00000568, 0x00000002, 0x00000017, 0x00000562, 
-    0x000a000c, 0x00000003, 0x0000057d, 0x00000002, 0x00000067, 0x0000002d, 0x0000057e, 0x0000057e, 0x00000064, 
-    0x00000065, 0x000200fe, 0x0000057f, 0x000200f8, 0x00000569, 0x0006000c, 0x00000003, 0x0000056a, 0x00000002, 
-    0x00000017, 0x00000562, 0x000a000c, 0x00000003, 0x00000581, 0x00000002, 0x00000067, 0x0000002d, 0x00000582, 
-    0x00000582, 0x00000008, 0x0000005c, 0x000a000c, 0x00000003, 0x00000583, 0x00000002, 0x00000067, 0x0000002d, 
-    0x00000582, 0x00000582, 0x00000008, 0x0000005c, 0x000a000c, 0x00000003, 0x00000584, 0x00000002, 0x00000067, 
-    0x0000002d, 0x00000582, 0x00000582, 0x00000008, 0x0000005c, 0x0008000c, 0x00000003, 0x00000588, 0x00000002, 
-    0x0000001c, 0x00000586, 0x00000560, 0x00000071, 0x00050051, 0x00000006, 0x00000589, 0x00000559, 0x00000000, 
-    0x00040071, 0x000004fc, 0x0000058a, 0x00000589, 0x0004007c, 0x000004fe, 0x0000058b, 0x0000058a, 0x00050043, 
-    0x000002f4, 0x0000058c, 0x00000558, 0x0000058b, 0x00050051, 0x00000006, 0x0000058d, 0x00000559, 0x00000002, 
-    0x00050084, 0x00000006, 0x0000058e, 0x0000055a, 0x0000058d, 0x00040071, 0x000004fc, 0x0000058f, 0x0000058e, 
-    0x0004007c, 0x000004fe, 0x00000590, 0x0000058f, 0x00050043, 0x000002f4, 0x00000591, 0x0000058c, 0x00000590, 
-    0x0004007c, 0x000004fc, 0x00000592, 0x00000591, 0x0004007c, 0x000001df, 0x00000593, 0x00000592, 0x0003003e, 
-    0x00000560, 0x00000593, 0x000a000c, 0x00000003, 0x00000595, 0x00000002, 0x00000067, 0x0000002d, 0x00000596, 
-    0x00000596, 0x00000008, 0x0000005c, 0x00050043, 0x000001df, 0x00000597, 0x00000593, 0x00000185, 0x0006003d, 
-    0x0000003a, 0x00000598, 0x00000597, 0x00000002, 0x00000004, 0x000200fe, 0x00000598, 0x00010038, 0x00050036, 
-    0x00000033, 0x000005c4, 0x00000000, 0x000005c5, 0x00030037, 0x000002f4, 0x000005c6, 0x00030037, 0x000002f6, 
-    0x000005c7, 0x00030037, 0x00000073, 0x000005c8, 0x00030037, 0x0000003a, 0x000005c9, 0x000200f8, 0x000005ca, 
-    0x0004003b, 0x00000055, 0x000005cb, 0x00000007, 0x0004003b, 0x00000530, 0x000005cc, 0x00000007, 0x0004003b, 
-    0x00000532, 0x000005cd, 0x00000007, 0x0004003b, 0x000004b8, 0x000005ce, 0x00000007, 0x0004003b, 0x00000034, 
-    0x000005cf, 0x00000007, 0x0004003b, 0x00000034, 0x000005d0, 0x00000007, 0x0004003b, 0x00000034, 0x000005d1, 
-    0x00000007, 0x0007000c, 0x00000003, 0x000005d4, 0x00000002, 0x00000065, 0x000005d3, 0x000005c4, 0x0006000c, 
-    0x00000003, 0x000005d5, 0x00000002, 0x00000017, 0x000005d3, 0x0008000c, 0x00000003, 0x000005d7, 0x00000002, 
-    0x0000001c, 0x000005d6, 0x000005cb, 0x00000071, 0x0003003e, 0x000005cb, 0x000005c9, 0x0008000c, 0x00000003, 
-    0x000005da, 0x00000002, 0x0000001c, 0x000005d9, 0x000005cc, 0x00000071, 0x0003003e, 0x000005cc, 0x000005c8, 
-    0x0008000c, 0x00000003, 0x000005dd, 0x00000002, 0x0000001c, 0x000005dc, 0x000005cd, 0x00000071, 0x0003003e, 
-    0x000005cd, 0x000005c7, 0x0008000c, 0x00000003, 0x000005e0, 0x00000002, 0x0000001c, 0x000005df, 0x000005ce, 
-    0x00000071, 0x0003003e, 0x000005ce, 0x000005c6, 0x000a000c, 0x00000003, 0x000005e2, 0x00000002, 0x00000067, 
-    0x0000002d, 0x0000054e, 0x0000054e, 0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x000005e3, 0x00000002, 
-    0x00000067, 0x0000002d, 0x0000054e, 0x0000054e, 0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x000005e4, 
-    0x00000002, 0x00000067, 0x0000002d, 0x0000054e, 0x0000054e, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 
-    0x000005e6, 0x00000002, 0x0000001c, 0x000005e5, 0x000005cf, 0x00000071, 0x00050051, 0x00000006, 0x000005e7, 
-    0x000005c8, 0x00000000, 0x00070039, 0x00000033, 0x000005e8, 0x000005e9, 0x000005c6, 0x000005c7, 0x000005e7, 
-    0x0003003e, 0x000005cf, 0x000005e8, 0x000a000c, 0x00000003, 0x00000627, 0x00000002, 0x00000067, 0x0000002d, 
-    0x0000059c, 0x0000059c, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000629, 0x00000002, 0x0000001c, 
-    0x00000628, 0x000005d0, 0x00000071, 0x00050051, 0x00000006, 0x0000062a, 0x000005c8, 0x00000001, 0x00070039, 
-    0x00000033, 0x0000062b, 0x000005e9, 0x000005c6, 0x000005c7, 0x0000062a, 0x0003003e, 0x000005d0, 0x0000062b, 
-    0x000a000c, 0x00000003, 0x0000062d, 0x00000002, 0x00000067, 0x0000002d, 0x00000099, 0x00000099, 0x00000064, 
-    0x00000065, 0x0008000c, 0x00000003, 0x0000062f, 0x00000002, 0x0000001c, 0x0000062e, 0x000005d1, 0x00000071, 
-    0x00050051, 0x00000006, 0x00000630, 0x000005c8, 0x00000002, 0x00070039, 0x00000033, 0x00000631, 0x000005e9, 
-    0x000005c6, 0x000005c7, 0x00000630, 0x0003003e, 0x000005d1, 0x00000631, 0x000a000c, 0x00000003, 0x00000633, 
-    0x00000002, 0x00000067, 0x0000002d, 0x0000040c, 0x0000040c, 0x00000064, 0x00000065, 0x00050051, 0x00000032, 
-    0x00000634, 0x000005c9, 0x00000000, 0x00050050, 0x00000033, 0x00000635, 0x00000634, 0x00000634, 0x00050085, 
-    0x00000033, 0x00000636, 0x00000635, 0x000005e8, 0x00050051, 0x00000032, 0x00000637, 0x000005c9, 0x00000001, 
-    0x00050050, 0x00000033, 0x00000638, 0x00000637, 0x00000637, 0x00050085, 0x00000033, 0x00000639, 0x00000638, 
-    0x0000062b, 0x00050081, 0x00000033, 0x0000063a, 0x00000636, 0x00000639, 0x00050051, 0x00000032, 0x0000063b, 
-    0x000005c9, 0x00000002, 0x00050050, 0x00000033, 0x0000063c, 0x0000063b, 0x0000063b, 0x00050085, 0x00000033, 
-    0x0000063d, 0x0000063c, 0x00000631, 0x00050081, 0x00000033, 0x0000063e, 0x0000063a, 0x0000063d, 0x000200fe, 
-    0x0000063e, 0x00010038, 0x00050036, 0x00000033, 0x000005e9, 0x00000000, 0x000005ea, 0x00030037, 0x000002f4, 
-    0x000005eb, 0x00030037, 0x000002f6, 0x000005ec, 0x00030037, 0x00000006, 0x000005ed, 0x000200f8, 0x000005ee, 
-    0x0004003b, 0x00000048, 0x000005ef, 0x00000007, 0x0004003b, 0x00000532, 0x000005f0, 0x00000007, 0x0004003b, 
-    0x000004b8, 0x000005f1, 0x00000007, 0x0004003b, 0x000005f3, 0x000005f4, 0x00000007, 0x0007000c, 0x00000003, 
-    0x000005f7, 0x00000002, 0x00000065, 0x000005f6, 0x000005e9, 0x0006000c, 0x00000003, 0x000005f8, 0x00000002, 
-    0x00000017, 0x000005f6, 0x0008000c, 0x00000003, 0x000005fe, 0x00000002, 0x0000001c, 0x000005fd, 0x000005ef, 
-    0x00000071, 0x0003003e, 0x000005ef, 0x000005ed, 0x0008000c, 0x00000003, 0x00000601, 0x00000002, 0x0000001c, 
-    0x00000600, 0x000005f0, 0x00000071, 0x0003003e, 0x000005f0, 0x000005ec, 0x0008000c, 0x00000003, 0x00000604, 
-    0x00000002, 0x0000001c, 0x00000603, 0x000005f1, 0x00000071, 0x0003003e, 0x000005f1, 0x000005eb, 0x000a000c, 
-    0x00000003, 0x00000606, 0x00000002, 0x00000067, 0x0000002d, 0x00000443, 0x00000443, 0x00000064, 0x00000065, 
-    0x000a000c, 0x00000003, 0x00000607, 0x00000002, 0x00000067, 0x0000002d, 0x00000443, 0x00000443, 0x00000064, 
-    0x00000065, 0x000a000c, 0x00000003, 0x00000608, 0x00000002, 0x00000067, 0x0000002d, 0x00000443, 0x00000443, 
-    0x00000064, 0x00000065, 0x00050051, 0x00000006, 0x00000609, 0x000005ec, 0x00000001, 0x000500ac, 0x00000089, 
-    0x0000060a, 0x00000609, 0x00000058, 0x000a000c, 0x00000003, 0x0000060b, 0x00000002, 0x00000067, 0x0000002d, 
-    0x00000443, 0x00000443, 0x0000057a, 0x0000057b, 0x000300f7, 0x000005f9, 0x00000000, 0x000400fa, 0x0000060a, 
-    0x000005fb, 0x000005f9, 0x000200f8, 0x000005f9, 0x0006000c, 0x00000003, 0x000005fa, 0x00000002, 0x00000017, 
-    0x000005f6, 0x000a000c, 0x00000003, 0x0000060d, 0x00000002, 0x00000067, 0x0000002d, 0x0000057e, 0x0000057e, 
-    0x00000064, 0x00000065, 0x000200fe, 0x0000060e, 0x000200f8, 0x000005fb, 0x0006000c, 0x00000003, 0x000005fc, 
-    0x00000002, 0x00000017, 0x000005f6, 0x000a000c, 0x00000003, 0x00000610, 0x00000002, 0x00000067, 0x0000002d, 
-    0x00000582, 0x00000582, 0x00000008, 0x0000005c, 0x000a000c, 0x00000003, 0x00000611, 0x00000002, 0x00000067, 
-    0x0000002d, 0x00000582, 0x00000582, 0x00000008, 0x0000005c, 0x000a000c, 0x00000003, 0x00000612, 0x00000002, 
-    0x00000067, 0x0000002d, 0x00000582, 0x00000582, 0x00000008, 0x0000005c, 0x0008000c, 0x00000003, 0x00000615, 
-    0x00000002, 0x0000001c, 0x00000614, 0x000005f4, 0x00000071, 0x00050051, 0x00000006, 0x00000616, 0x000005ec, 
-    0x00000000, 0x00040071, 0x000004fc, 0x00000617, 0x00000616, 0x0004007c, 0x000004fe, 0x00000618, 0x00000617, 
-    0x00050043, 0x000002f4, 0x00000619, 0x000005eb, 0x00000618, 0x00050051, 0x00000006, 0x0000061a, 0x000005ec, 
-    0x00000002, 0x00050084, 0x00000006, 0x0000061b, 0x000005ed, 0x0000061a, 0x00040071, 0x000004fc, 0x0000061c, 
-    0x0000061b, 0x0004007c, 0x000004fe, 0x0000061d, 0x0000061c, 0x00050043, 0x000002f4, 0x0000061e, 0x00000619, 
-    0x0000061d, 0x0004007c, 0x000004fc, 0x0000061f, 0x0000061e, 0x0004007c, 0x000005f2, 0x00000620, 0x0000061f, 
-    0x0003003e, 0x000005f4, 0x00000620, 0x000a000c, 0x00000003, 0x00000622, 0x00000002, 0x00000067, 0x0000002d, 
-    0x00000596, 0x00000596, 0x00000008, 0x0000005c, 0x00050043, 0x000005f2, 0x00000623, 0x00000620, 0x00000185, 
-    0x0006003d, 0x00000033, 0x00000624, 0x00000623, 0x00000002, 0x00000004, 0x000200fe, 0x00000624, 0x00010038, 
-    0x00050036, 0x00000043, 0x000006af, 0x00000000, 0x000006b0, 0x00030037, 0x00000037, 0x000006b1, 0x00030037, 
-    0x0000003a, 0x000006b2, 0x000200f8, 0x000006b3, 0x0004003b, 0x00000055, 0x000006b4, 0x00000007, 0x0004003b, 
-    0x00000046, 0x000006b5, 0x00000007, 0x0004003b, 0x0000030a, 0x000006b6, 0x00000007, 0x0004003b, 0x0000030a, 
-    0x000006b7, 0x00000007, 0x0004003b, 0x00000055, 0x000006b8, 0x00000007, 0x0004003b, 0x00000286, 0x000006b9, 
-    0x00000007, 0x0004003b, 0x00000286, 0x000006ba, 0x00000007, 0x0004003b, 0x00000286, 0x000006bb, 0x00000007, 
-    0x0004003b, 0x00000286, 0x000006bc, 0x00000007, 0x0007000c, 0x00000003, 0x000006c1, 0x00000002, 0x00000065, 
-    0x000006be, 0x000006af, 0x0006000c, 0x00000003, 0x000006c2, 0x00000002, 0x00000017, 0x000006be, 0x0008000c, 
-    0x00000003, 0x000006d2, 0x00000002, 0x0000001c, 0x000006d1, 0x000006b4, 0x00000071, 0x0003003e, 0x000006b4, 
-    0x000006b2, 0x0008000c, 0x00000003, 0x000006d5, 0x00000002, 0x0000001c, 0x000006d4, 0x000006b5, 0x00000071, 
-    0x0003003e, 0x000006b5, 0x000006b1, 0x000a000c, 0x00000003, 0x000006d7, 0x00000002, 0x00000067, 0x0000002d, 
-    0x000006d8, 0x000006d8, 0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x000006d9, 0x00000002, 0x00000067, 
-    0x0000002d, 0x000006d8, 0x000006d8, 0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x000006da, 0x00000002, 
-    0x00000067, 0x0000002d, 0x000006d8, 0x000006d8, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x000006dc, 
-    0x00000002, 0x0000001c, 0x000006db, 0x000006b6, 0x00000071, 0x00050051, 0x00000042, 0x000006dd, 0x000006b1, 
-    0x0000000a, 0x00050051, 0x00000043, 0x000006de, 0x000006dd, 0x00000000, 0x0003003e, 0x000006b7, 0x000006de, 
-    0x0003003e, 0x000006b6, 0x000006de, 0x000a000c, 0x00000003, 0x000006e1, 0x00000002, 0x00000067, 0x0000002d, 
-    0x000006e2, 0x000006e2, 0x00000064, 0x00000065, 0x00050051, 0x0000003b, 0x000006e3, 0x000006b1, 0x00000004, 
-    0x000500aa, 0x00000089, 0x000006e4, 0x000006e3, 0x000001a6, 0x000a000c, 0x00000003, 0x000006e5, 0x00000002, 
-    0x00000067, 0x0000002d, 0x000006e2, 0x000006e2, 0x0000057a, 0x0000057b, 0x000300f7, 0x000006c5, 0x00000000, 
-    0x000400fa, 0x000006e4, 0x000006c3, 0x000006c5, 0x000200f8, 0x000006c3, 0x0006000c, 0x00000003, 0x000006c4, 
-    0x00000002, 0x00000017, 0x000006be, 0x000a000c, 0x00000003, 0x000006e7, 0x00000002, 0x00000067, 0x0000002d, 
-    0x000006e8, 0x000006e8, 0x00000008, 0x0000005c, 0x000a000c, 0x00000003, 0x000006e9, 0x00000002, 0x00000067, 
-    0x0000002d, 0x000006e8, 0x000006e8, 0x00000008, 0x0000005c, 0x000a000c, 0x00000003, 0x000006ea, 0x00000002, 
-    0x00000067, 0x0000002d, 0x000006e8, 0x000006e8, 0x00000008, 0x0000005c, 0x00050042, 0x00000055, 0x000006eb, 
-    0x000006b7, 0x00000044, 0x00050051, 0x00000045, 0x000006ec, 0x000006b1, 0x0000000b, 0x00050051, 0x0000003a, 
-    0x000006ed, 0x000006ec, 0x00000000, 0x0003003e, 0x000006eb, 0x000006ed, 0x00050042, 0x00000055, 0x000006ef, 
-    0x000006b6, 0x00000044, 0x0003003e, 0x000006ef, 0x000006ed, 0x000a000c, 0x00000003, 0x000006f1, 0x00000002, 
-    0x00000067, 0x0000002d, 0x000006f2, 0x000006f2, 0x00000008, 0x0000005c, 0x00050042, 0x00000055, 0x000006f3, 
-    0x000006b7, 0x0000018a, 0x00050051, 0x0000003a, 0x000006f4, 0x000006ec, 0x00000002, 0x0003003e, 0x000006f3, 
-    0x000006f4, 0x00050042, 0x00000055, 0x000006f6, 0x000006b6, 0x0000018a, 0x0003003e, 0x000006f6, 0x000006f4, 
-    0x000a000c, 0x00000003, 0x000006f8, 0x00000002, 0x00000067, 0x0000002d, 0x000006f9, 0x000006f9, 0x00000008, 
-    0x0000005c, 0x00050042, 0x00000286, 0x000006fa, 0x000006b7, 0x000001a6, 0x00050051, 0x00000032, 0x000006fb, 
-    0x000006ec, 0x0000000b, 0x0003003e, 0x000006fa, 0x000006fb, 0x00050042, 0x00000286, 0x000006fd, 0x000006b6, 
-    0x000001a6, 0x0003003e, 0x000006fd, 0x000006fb, 0x000a000c, 0x00000003, 0x000006ff, 0x00000002, 0x00000067, 
-    0x0000002d, 0x00000700, 0x00000700, 0x00000008, 0x0000005c, 0x00050042, 0x000002b0, 0x00000701, 0x000006b7, 
-    0x0000013e, 0x0003003e, 0x00000701, 0x00000044, 0x00050042, 0x000002b0, 0x00000703, 0x000006b6, 0x0000013e, 
-    0x0003003e, 0x00000703, 0x00000044, 0x000200f9, 0x000006c5, 0x000200f8, 0x000006c5, 0x0006000c, 0x00000003, 
-    0x000006c6, 0x00000002, 0x00000017, 0x000006be, 0x000a000c, 0x00000003, 0x00000706, 0x00000002, 0x00000067, 
-    0x0000002d, 0x00000707, 0x00000707, 0x00000064, 0x00000065, 0x00050042, 0x000002b0, 0x00000708, 0x000006b7, 
-    0x0000013e, 0x0004003d, 0x0000003b, 0x00000709, 0x00000708, 0x000500aa, 0x00000089, 0x0000070a, 0x00000709, 
-    0x00000185, 0x000a000c, 0x00000003, 0x0000070b, 0x00000002, 0x00000067, 0x0000002d, 0x00000707, 0x00000707, 
-    0x00000139, 0x0000070c, 0x000300f7, 0x000006cf, 0x00000000, 0x000400fa, 0x0000070a, 0x000006cd, 0x000006c7, 
-    0x000200f8, 0x000006c7, 0x0006000c, 0x00000003, 0x000006c8, 0x00000002, 0x00000017, 0x000006be, 0x000a000c, 
-    0x00000003, 0x0000070e, 0x00000002, 0x00000067, 0x0000002d, 0x0000070f, 0x0000070f, 0x0000008e, 0x00000245, 
-    0x0004003d, 0x0000003b, 0x00000710, 0x00000708, 0x000500aa, 0x00000089, 0x00000711, 0x00000710, 0x000001a6, 
-    0x000a000c, 0x00000003, 0x00000712, 0x00000002, 0x00000067, 0x0000002d, 0x0000070f, 0x0000070f, 0x00000713, 
-    0x0000057a, 0x000300f7, 0x000006cb, 0x00000000, 0x000400fa, 0x00000711, 0x000006c9, 0x000006cb, 0x000200f8, 
-    0x000006c9, 0x0006000c, 0x00000003, 0x000006ca, 0x00000002, 0x00000017, 0x000006be, 0x000a000c, 0x00000003, 
-    0x00000715, 0x00000002, 0x00000067, 0x0000002d, 0x00000716, 0x00000716, 0x00000008, 0x0000005c, 0x000a000c, 
-    0x00000003, 0x00000717, 0x00000002, 0x00000067, 0x0000002d, 0x00000716, 0x00000716, 0x00000008, 0x0000005c, 
-    0x000a000c, 0x00000003, 0x00000718, 0x00000002, 0x00000067, 0x0000002d, 0x00000716, 0x00000716, 0x00000008, 
-    0x0000005c, 0x0008000c, 0x00000003, 0x0000071c, 0x00000002, 0x0000001c, 0x00000719, 0x000006b8, 0x00000071, 
-    0x00050042, 0x00000055, 0x0000071d, 0x000006b7, 0x00000185, 0x0004003d, 0x0000003a, 0x0000071e, 0x0000071d, 
-    0x00050083, 0x0000003a, 0x0000071f, 0x0000071e, 0x000006b2, 0x0003003e, 0x000006b8, 0x0000071f, 0x000a000c, 
-    0x00000003, 0x00000721, 0x00000002, 0x00000067, 0x0000002d, 0x00000722, 0x00000722, 0x00000008, 0x0000005c, 
-    0x0008000c, 0x00000003, 0x00000725, 0x00000002, 0x0000001c, 0x00000723, 0x000006b9, 0x00000071, 0x0006000c, 
-    0x00000032, 0x00000726, 0x0000027d, 0x00000042, 0x0000071f, 0x0003003e, 0x000006b9, 0x00000726, 0x000a000c, 
-    0x00000003, 0x00000728, 0x00000002, 0x00000067, 0x0000002d, 0x00000729, 0x00000729, 0x00000008, 0x0000005c, 
-    0x00050042, 0x00000286, 0x0000072a, 0x000006b7, 0x000001a6, 0x00050085, 0x00000032, 0x0000072b, 0x00000726, 
-    0x00000726, 0x0004003d, 0x00000032, 0x0000072c, 0x0000072a, 0x00050088, 0x00000032, 0x0000072d, 0x0000072c, 
-    0x0000072b, 0x0003003e, 0x0000072a, 0x0000072d, 0x00050042, 0x00000286, 0x0000072f, 0x000006b6, 0x000001a6, 
-    0x0003003e, 0x0000072f, 0x0000072d, 0x000a000c, 0x00000003, 0x00000731, 0x00000002, 0x00000067, 0x0000002d, 
-    0x00000732, 0x00000732, 0x00000008, 0x0000005c, 0x0008000c, 0x00000003, 0x00000735, 0x00000002, 0x0000001c, 
-    0x00000733, 0x000006ba, 0x00000071, 0x0006000c, 0x0000003a, 0x00000736, 0x0000027d, 0x00000045, 0x0000071f, 
-    0x00050042, 0x00000055, 0x00000737, 0x000006b7, 0x00000044, 0x0004003d, 0x0000003a, 0x00000738, 0x00000737, 
-    0x0006000c, 0x0000003a, 0x00000739, 0x0000027d, 0x00000045, 0x00000738, 0x00050094, 0x00000032, 0x0000073a, 
-    0x00000736, 0x00000739, 0x0003003e, 0x000006ba, 0x0000073a, 0x000a000c, 0x00000003, 0x0000073c, 0x00000002, 
-    0x00000067, 0x0000002d, 0x0000073d, 0x0000073d, 0x00000008, 0x0000005c, 0x0008000c, 0x00000003, 0x00000740, 
-    0x00000002, 0x0000001c, 0x0000073e, 0x000006bb, 0x00000071, 0x00050042, 0x00000286, 0x00000741, 0x000006b7, 
-    0x000001e5, 0x0004003d, 0x00000032, 0x00000742, 0x00000741, 0x0006000c, 0x00000032, 0x00000743, 0x0000027d, 
-    0x0000000e, 0x00000742, 0x00050083, 0x00000032, 0x00000744, 0x0000073a, 0x00000743, 0x0004003d, 0x00000032, 
-    0x00000745, 0x00000741, 0x0006000c, 0x00000032, 0x00000746, 0x0000027d, 0x0000000e, 0x00000745, 0x00050083, 
-    0x00000032, 0x00000747, 0x00000254, 0x00000746, 0x00050088, 0x00000032, 0x00000748, 0x00000744, 0x00000747, 
-    0x0008000c, 0x00000032, 0x00000749, 0x0000027d, 0x0000002b, 0x00000748, 0x00000273, 0x00000254, 0x0003003e, 
-    0x000006bb, 0x00000749, 0x000a000c, 0x00000003, 0x0000074b, 0x00000002, 0x00000067, 0x0000002d, 0x0000074c, 
-    0x0000074c, 0x00000008, 0x0000005c, 0x0004003d, 0x00000032, 0x0000074d, 0x0000072a, 0x00050085, 0x00000032, 
-    0x0000074e, 0x0000074d, 0x00000749, 0x0003003e, 0x0000072a, 0x0000074e, 0x0003003e, 0x0000072f, 0x0000074e, 
-    0x000a000c, 0x00000003, 0x00000751, 0x00000002, 0x00000067, 0x0000002d, 0x00000752, 0x00000752, 0x00000008, 
-    0x0000005c, 0x0003003e, 0x00000737, 0x0000071f, 0x00050042, 0x00000055, 0x00000754, 0x000006b6, 0x00000044, 
-    0x0003003e, 0x00000754, 0x0000071f, 0x000200f9, 0x000006cb, 0x000200f8, 0x000006cb, 0x0006000c, 0x00000003, 
-    0x000006cc, 0x00000002, 0x00000017, 0x000006be, 0x000200f9, 0x000006cf, 0x000200f8, 0x000006cd, 0x0006000c, 
-    0x00000003, 0x000006ce, 0x00000002, 0x00000017, 0x000006be, 0x000a000c, 0x00000003, 0x00000758, 0x00000002, 
-    0x00000067, 0x0000002d, 0x00000759, 0x00000759, 0x00000008, 0x0000005c, 0x000a000c, 0x00000003, 0x0000075a, 
-    0x00000002, 0x00000067, 0x0000002d, 0x00000759, 0x00000759, 0x00000008, 0x0000005c, 0x000a000c, 0x00000003, 
-    0x0000075b, 0x00000002, 0x00000067, 0x0000002d, 0x00000759, 0x00000759, 0x00000008, 0x0000005c, 0x00050042, 
-    0x00000055, 0x0000075c, 0x000006b7, 0x00000044, 0x00050042, 0x00000055, 0x0000075d, 0x000006b7, 0x00000185, 
-    0x0004003d, 0x0000003a, 0x0000075e, 0x0000075d, 0x00050083, 0x0000003a, 0x0000075f, 0x0000075e, 0x000006b2, 
-    0x0003003e, 0x0000075c, 0x0000075f, 0x00050042, 0x00000055, 0x00000761, 0x000006b6, 0x00000044, 0x0003003e, 
-    0x00000761, 0x0000075f, 0x000a000c, 0x00000003, 0x00000763, 0x00000002, 0x00000067, 0x0000002d, 0x00000764, 
-    0x00000764, 0x00000008, 0x0000005c, 0x0008000c, 0x00000003, 0x00000766, 0x00000002, 0x0000001c, 0x00000765, 
-    0x000006bc, 0x00000071, 0x0004003d, 0x0000003a, 0x00000767, 0x0000075c, 0x0006000c, 0x00000032, 0x00000768, 
-    0x0000027d, 0x00000042, 0x00000767, 0x0003003e, 0x000006bc, 0x00000768, 0x000a000c, 0x00000003, 0x0000076a, 
-    0x00000002, 0x00000067, 0x0000002d, 0x0000076b, 0x0000076b, 0x00000008, 0x0000005c, 0x00050042, 0x00000286, 
-    0x0000076c, 0x000006b7, 0x000001a6, 0x00050085, 0x00000032, 0x0000076d, 0x00000768, 0x00000768, 0x0004003d, 
-    0x00000032, 0x0000076e, 0x0000076c, 0x00050088, 0x00000032, 0x0000076f, 0x0000076e, 0x0000076d, 0x0003003e, 
-    0x0000076c, 0x0000076f, 0x00050042, 0x00000286, 0x00000771, 0x000006b6, 0x000001a6, 0x0003003e, 0x00000771, 
-    0x0000076f, 0x000200f9, 0x000006cf, 0x000200f8, 0x000006cf, 0x0006000c, 0x00000003, 0x000006d0, 0x00000002, 
-    0x00000017, 0x000006be, 0x000a000c, 0x00000003, 0x00000774, 0x00000002, 0x00000067, 0x0000002d, 0x00000775, 
-    0x00000775, 0x00000064, 0x00000065, 0x0004003d, 0x00000043, 0x00000776, 0x000006b7, 0x000200fe, 0x00000776, 
-    0x00010038, 0x00050036, 0x00000032, 0x00000798, 0x00000000, 0x00000799, 0x00030037, 0x0000003a, 0x0000079a, 
-    0x00030037, 0x0000003a, 0x0000079b, 0x00030037, 0x0000003a, 0x0000079c, 0x00030037, 0x00000043, 0x0000079d, 
-    0x000200f8, 0x0000079e, 0x0004003b, 0x0000030a, 0x0000079f, 0x00000007, 0x0004003b, 0x00000055, 0x000007a0, 
-    0x00000007, 0x0004003b, 0x00000055, 0x000007a1, 0x00000007, 0x0004003b, 0x00000055, 0x000007a2, 0x00000007, 
-    0x0004003b, 0x0000004e, 0x000007a3, 0x00000007, 0x0004003b, 0x0000004e, 0x000007a4, 0x00000007, 0x0004003b, 
-    0x00000286, 0x000007a5, 0x00000007, 0x0004003b, 0x00000052, 0x000007a6, 0x00000007, 0x0004003b, 0x00000052, 
-    0x000007a7, 0x00000007, 0x0007000c, 0x00000003, 0x000007ac, 0x00000002, 0x00000065, 0x000007a9, 0x00000798, 
-    0x0006000c, 0x00000003, 0x000007ad, 0x00000002, 0x00000017, 0x000007a9, 0x0008000c, 0x00000003, 0x000007bb, 
-    0x00000002, 0x0000001c, 0x000007ba, 0x0000079f, 0x00000071, 0x0003003e, 0x0000079f, 0x0000079d, 0x0008000c, 
-    0x00000003, 0x000007bf, 0x00000002, 0x0000001c, 0x000007bd, 0x000007a0, 0x00000071, 0x0003003e, 0x000007a0, 
-    0x0000079c, 0x0008000c, 0x00000003, 0x000007c2, 0x00000002, 0x0000001c, 0x000007c1, 0x000007a1, 0x00000071, 
-    0x0003003e, 0x000007a1, 0x0000079b, 0x0008000c, 0x00000003, 0x000007c5, 0x00000002, 0x0000001c, 0x000007c4, 
-    0x000007a2, 0x00000071, 0x0003003e, 0x000007a2, 0x0000079a, 0x000a000c, 0x00000003, 0x000007c7, 0x00000002, 
-    0x00000067, 0x0000002d, 0x000007c8, 0x000007c8, 0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x000007c9, 
-    0x00000002, 0x00000067, 0x0000002d, 0x000007c8, 0x000007c8, 0x00000064, 0x00000065, 0x000a000c, 0x00000003, 
-    0x000007ca, 0x00000002, 0x00000067, 0x0000002d, 0x000007c8, 0x000007c8, 0x00000064, 0x00000065, 0x0008000c, 
-    0x00000003, 0x000007cd, 0x00000002, 0x0000001c, 0x000007cb, 0x000007a3, 0x00000071, 0x000a000c, 0x00000003, 
-    0x000007ce, 0x00000002, 0x00000067, 0x0000002d, 0x000007cf, 0x000007cf, 0x00000064, 0x00000065, 0x00050042, 
-    0x00000055, 0x000007d0, 0x000007a4, 0x00000185, 0x0005008e, 0x0000003a, 0x000007d1, 0x0000079b, 0x00000288, 
-    0x00050081, 0x0000003a, 0x000007d2, 0x0000079a, 0x000007d1, 0x0003003e, 0x000007d0, 0x000007d2, 0x00050042, 
-    0x00000055, 0x000007d4, 0x000007a3, 0x00000185, 0x0003003e, 0x000007d4, 0x000007d2, 0x000a000c, 0x00000003, 
-    0x000007d6, 0x00000002, 0x00000067, 0x0000002d, 0x000007d7, 0x000007d7, 0x00000064, 0x00000065, 0x00050042, 
-    0x00000055, 0x000007d8, 0x000007a4, 0x00000044, 0x0006000c, 0x0000003a, 0x000007d9, 0x0000027d, 0x00000045, 
-    0x0000079c, 0x0003003e, 0x000007d8, 0x000007d9, 0x00050042, 0x00000055, 0x000007db, 0x000007a3, 0x00000044, 
-    0x0003003e, 0x000007db, 0x000007d9, 0x000a000c, 0x00000003, 0x000007dd, 0x00000002, 0x00000067, 0x0000002d, 
-    0x000007de, 0x000007de, 0x00000064, 0x00000065, 0x00050042, 0x00000286, 0x000007df, 0x000007a4, 0x000001a6, 
-    0x0003003e, 0x000007df, 0x00000288, 0x00050042, 0x00000286, 0x000007e1, 0x000007a3, 0x000001a6, 0x0003003e, 
-    0x000007e1, 0x00000288, 0x000a000c, 0x00000003, 0x000007e3, 0x00000002, 0x00000067, 0x0000002d, 0x000007e4, 
-    0x000007e4, 0x00000064, 0x00000065, 0x00050042, 0x00000286, 0x000007e5, 0x000007a4, 0x0000013e, 0x00050051, 
-    0x0000003b, 0x000007e6, 0x0000079d, 0x00000003, 0x000500aa, 0x00000089, 0x000007e7, 0x000007e6, 0x00000044, 
-    0x000300f7, 0x000007b2, 0x00000000, 0x000400fa, 0x000007e7, 0x000007b0, 0x000007ae, 0x000200f8, 0x000007ae, 
-    0x0006000c, 0x00000003, 0x000007af, 0x00000002, 0x00000017, 0x000007a9, 0x0006000c, 0x00000032, 0x000007e9, 
-    0x0000027d, 0x00000042, 0x0000079c, 0x0003003e, 0x000007a5, 0x000007e9, 0x000200f9, 0x000007b2, 0x000200f8, 
-    0x000007b0, 0x0006000c, 0x00000003, 0x000007b1, 0x00000002, 0x00000017, 0x000007a9, 0x0003003e, 0x000007a5, 
-    0x0000028f, 0x000200f9, 0x000007b2, 0x000200f8, 0x000007b2, 0x0006000c, 0x00000003, 0x000007b3, 0x00000002, 
-    0x00000017, 0x000007a9, 0x0004003d, 0x00000032, 0x000007ee, 0x000007a5, 0x0003003e, 0x000007e5, 0x000007ee, 
-    0x00050042, 0x00000286, 0x000007f0, 0x000007a3, 0x0000013e, 0x0004003d, 0x00000032, 0x000007f1, 0x000007a5, 
-    0x0003003e, 0x000007f0, 0x000007f1, 0x000a000c, 0x00000003, 0x000007f3, 0x00000002, 0x00000067, 0x0000002d, 
-    0x000007f4, 0x000007f4, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x000007f7, 0x00000002, 0x0000001c, 
-    0x000007f5, 0x000007a6, 0x00000071, 0x000a000c, 0x00000003, 0x000007f8, 0x00000002, 0x00000067, 0x0000002d, 
-    0x000007f9, 0x000007f9, 0x00000064, 0x00000065, 0x00050042, 0x000002b0, 0x000007fa, 0x000007a7, 0x00000044, 
-    0x0003003e, 0x000007fa, 0x00000185, 0x00050042, 0x000002b0, 0x000007fc, 0x000007a6, 0x00000044, 0x0003003e, 
-    0x000007fc, 0x00000185, 0x000a000c, 0x00000003, 0x000007fe, 0x00000002, 0x00000067, 0x0000002d, 0x000007ff, 
-    0x000007ff, 0x00000064, 0x00000065, 0x0004003d, 0x0000004d, 0x00000800, 0x000007a4, 0x0004003d, 0x00000051, 
-    0x00000801, 0x000007a7, 0x0003003e, 0x000002ba, 0x00000801, 0x00050051, 0x0000003a, 0x00000803, 0x00000800, 
-    0x00000000, 0x00050051, 0x0000003a, 0x00000804, 0x00000800, 0x00000002, 0x00050051, 0x00000032, 0x00000805, 
-    0x00000800, 0x00000001, 0x00050051, 0x00000032, 0x00000806, 0x00000800, 0x00000003, 0x0004003d, 0x000002c2, 
-    0x00000807, 0x000002c5, 0x000c115d, 0x00000807, 0x0000071b, 0x000002cc, 0x00000058, 0x00000058, 0x00000058, 
-    0x00000803, 0x00000805, 0x00000804, 0x00000806, 0x000002ba, 0x0004003d, 0x00000051, 0x00000809, 0x000002ba, 
-    0x0003003e, 0x000007a7, 0x00000809, 0x0003003e, 0x000007a6, 0x00000809, 0x000a000c, 0x00000003, 0x0000080c, 
-    0x00000002, 0x00000067, 0x0000002d, 0x0000080d, 0x0000080d, 0x00000064, 0x00000065, 0x0004003d, 0x0000003b, 
-    0x0000080e, 0x000007fa, 0x000500ab, 0x00000089, 0x0000080f, 0x0000080e, 0x00000810, 0x000300f7, 0x000007b8, 
-    0x00000000, 0x000400fa, 0x0000080f, 0x000007b6, 0x000007b4, 0x000200f8, 0x000007b4, 0x0006000c, 0x00000003, 
-    0x000007b5, 0x00000002, 0x00000017, 0x000007a9, 0x0003003e, 0x000007a5, 0x00000254, 0x000200f9, 0x000007b8, 
-    0x000200f8, 0x000007b6, 0x0006000c, 0x00000003, 0x000007b7, 0x00000002, 0x00000017, 0x000007a9, 0x0003003e, 
-    0x000007a5, 0x00000273, 0x000200f9, 0x000007b8, 0x000200f8, 0x000007b8, 0x0006000c, 0x00000003, 0x000007b9, 
-    0x00000002, 0x00000017, 0x000007a9, 0x0004003d, 0x00000032, 0x00000816, 0x000007a5, 0x000200fe, 0x00000816, 
-    0x00010038, 0x00050036, 0x0000003a, 0x00000821, 0x00000000, 0x00000822, 0x00030037, 0x0000003a, 0x00000823, 
-    0x00030037, 0x00000032, 0x00000824, 0x00030037, 0x00000032, 0x00000825, 0x00030037, 0x0000003a, 0x00000826, 
-    0x00030037, 0x0000003a, 0x00000827, 0x00030037, 0x0000003a, 0x00000828, 0x000200f8, 0x00000829, 0x0004003b, 
-    0x00000055, 0x0000082a, 0x00000007, 0x0004003b, 0x00000055, 0x0000082b, 0x00000007, 0x0004003b, 0x00000055, 
-    0x0000082c, 0x00000007, 0x0004003b, 0x00000286, 0x0000082d, 0x00000007, 0x0004003b, 0x00000286, 0x0000082e, 
-    0x00000007, 0x0004003b, 0x00000055, 0x0000082f, 0x00000007, 0x0004003b, 0x00000831, 0x00000832, 0x00000007, 
-    0x0004003b, 0x00000831, 0x00000833, 0x00000007, 0x0004003b, 0x00000835, 0x00000836, 0x00000007, 0x0004003b, 
-    0x00000835, 0x00000837, 0x00000007, 0x0004003b, 0x00000055, 0x00000838, 0x00000007, 0x0004003b, 0x00000055, 
-    0x00000839, 0x00000007, 0x0007000c, 0x00000003, 0x0000083e, 0x00000002, 0x00000065, 0x0000083b, 0x00000821, 
-    0x0006000c, 0x00000003, 0x0000083f, 0x00000002, 0x00000017, 0x0000083b, 0x0008000c, 0x00000003, 0x00000841, 
-    0x00000002, 0x0000001c, 0x00000840, 0x0000082a, 0x00000071, 0x0003003e, 0x0000082a, 0x00000828, 0x0008000c, 
-    0x00000003, 0x00000844, 0x00000002, 0x0000001c, 0x00000843, 0x0000082b, 0x00000071, 0x0003003e, 0x0000082b, 
-    0x00000827, 0x0008000c, 0x00000003, 0x00000847, 0x00000002, 0x0000001c, 0x00000846, 0x0000082c, 0x00000071, 
-    0x0003003e, 0x0000082c, 0x00000826, 0x0008000c, 0x00000003, 0x0000084a, 0x00000002, 0x0000001c, 0x00000849, 
-    0x0000082d, 0x00000071, 0x0003003e, 0x0000082d, 0x00000825, 0x0008000c, 0x00000003, 0x0000084d, 0x00000002, 
-    0x0000001c, 0x0000084c, 0x0000082e, 0x00000071, 0x0003003e, 0x0000082e, 0x00000824, 0x0008000c, 0x00000003, 
-    0x00000850, 0x00000002, 0x0000001c, 0x0000084f, 0x0000082f, 0x00000071, 0x0003003e, 0x0000082f, 0x00000823, 
-    0x000a000c, 0x00000003, 0x00000852, 0x00000002, 0x00000067, 0x00000021, 0x00000853, 0x00000853, 0x00000064, 
-    0x00000065, 0x000a000c, 0x00000003, 0x00000854, 0x00000002, 0x00000067, 0x00000021, 0x00000853, 0x00000853, 
-    0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x00000855, 0x00000002, 0x00000067, 0x00000021, 0x00000853, 
-    0x00000853, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000867, 0x00000002, 0x0000001c, 0x00000865, 
-    0x00000832, 0x00000071, 0x000a000c, 0x00000003, 0x00000868, 0x00000002, 0x00000067, 0x00000021, 0x00000869, 
-    0x00000869, 0x00000064, 0x00000065, 0x00050042, 0x00000055, 0x0000086a, 0x00000833, 0x00000185, 0x0003003e, 
-    0x0000086a, 0x00000827, 0x00050042, 0x00000055, 0x0000086c, 0x00000832, 0x00000185, 0x0003003e, 0x0000086c, 
-    0x00000827, 0x000a000c, 0x00000003, 0x0000086e, 0x00000002, 0x00000067, 0x00000021, 0x0000086f, 0x0000086f, 
-    0x00000064, 0x00000065, 0x00050042, 0x00000055, 0x00000870, 0x00000833, 0x000001a6, 0x0003003e, 0x00000870, 
-    0x00000828, 0x00050042, 0x00000055, 0x00000872, 0x00000832, 0x000001a6, 0x0003003e, 0x00000872, 0x00000828, 
-    0x000a000c, 0x00000003, 0x00000874, 0x00000002, 0x00000067, 0x00000021, 0x00000732, 0x00000732, 0x00000064, 
-    0x00000065, 0x00050042, 0x00000055, 0x00000875, 0x00000833, 0x00000044, 0x0003003e, 0x00000875, 0x00000876, 
-    0x00050042, 0x00000055, 0x00000878, 0x00000832, 0x00000044, 0x0003003e, 0x00000878, 0x00000876, 0x000a000c, 
-    0x00000003, 0x0000087a, 0x00000002, 0x00000067, 0x00000021, 0x0000087b, 0x0000087b, 0x00000064, 0x00000065, 
-    0x0008000c, 0x00000003, 0x00000899, 0x00000002, 0x0000001c, 0x00000896, 0x00000836, 0x00000071, 0x000a000c, 
-    0x00000003, 0x0000089a, 0x00000002, 0x00000067, 0x00000021, 0x0000073d, 0x0000073d, 0x00000064, 0x00000065, 
-    0x00050042, 0x00000055, 0x0000089b, 0x00000837, 0x00000185, 0x0003003e, 0x0000089b, 0x00000823, 0x00050042, 
-    0x00000055, 0x0000089d, 0x00000836, 0x00000185, 0x0003003e, 0x0000089d, 0x00000823, 0x000a000c, 0x00000003, 
-    0x0000089f, 0x00000002, 0x00000067, 0x00000021, 0x0000074c, 0x0000074c, 0x00000064, 0x00000065, 0x00050042, 
-    0x00000286, 0x000008a0, 0x00000837, 0x0000013e, 0x0003003e, 0x000008a0, 0x00000824, 0x00050042, 0x00000286, 
-    0x000008a2, 0x00000836, 0x0000013e, 0x0003003e, 0x000008a2, 0x00000824, 0x000a000c, 0x00000003, 0x000008a4, 
-    0x00000002, 0x00000067, 0x00000021, 0x00000752, 0x00000752, 0x00000064, 0x00000065, 0x00050042, 0x00000034, 
-    0x000008a5, 0x00000837, 0x00000044, 0x00050050, 0x00000033, 0x000008a6, 0x00000825, 0x00000825, 0x0003003e, 
-    0x000008a5, 0x000008a6, 0x00050042, 0x00000034, 0x000008a8, 0x00000836, 0x00000044, 0x0003003e, 0x000008a8, 
-    0x000008a6, 0x000a000c, 0x00000003, 0x000008aa, 0x00000002, 0x00000067, 0x00000021, 0x000008ab, 0x000008ab, 
-    0x00000064, 0x00000065, 0x00050042, 0x00000055, 0x000008ac, 0x00000837, 0x000001ef, 0x0003003e, 0x000008ac, 
-    0x00000826, 0x00050042, 0x00000055, 0x000008ae, 0x00000836, 0x000001ef, 0x0003003e, 0x000008ae, 0x00000826, 
-    0x000a000c, 0x00000003, 0x000008b0, 0x00000002, 0x00000067, 0x00000021, 0x000008b1, 0x000008b1, 0x00000064, 
-    0x00000065, 0x0004003d, 0x0000003a, 0x000008b2, 0x000008ac, 0x00050042, 0x00000055, 0x000008b3, 0x00000837, 
-    0x000001f7, 0x00050042, 0x00000055, 0x000008b4, 0x00000837, 0x0000021e, 0x0004003d, 0x0000003a, 0x000008b5, 
-    0x000008b3, 0x0003003e, 0x00000838, 0x000008b5, 0x0004003d, 0x0000003a, 0x000008b7, 0x000008b4, 0x0003003e, 
-    0x00000839, 0x000008b7, 0x00070039, 0x00000003, 0x000008b9, 0x000008ba, 0x000008b2, 0x00000838, 0x00000839, 
-    0x0004003d, 0x0000003a, 0x00000914, 0x00000838, 0x0003003e, 0x000008b3, 0x00000914, 0x0004003d, 0x0000003a, 
-    0x00000916, 0x00000839, 0x0003003e, 0x000008b4, 0x00000916, 0x00050042, 0x00000055, 0x00000918, 0x00000836, 
-    0x0000021e, 0x0003003e, 0x00000918, 0x00000916, 0x0004003d, 0x0000003a, 0x0000091a, 0x000008b3, 0x00050042, 
-    0x00000055, 0x0000091b, 0x00000836, 0x000001f7, 0x0003003e, 0x0000091b, 0x0000091a, 0x000a000c, 0x00000003, 
-    0x0000091d, 0x00000002, 0x00000067, 0x00000021, 0x00000775, 0x00000775, 0x00000064, 0x00000065, 0x0004003d, 
-    0x00000834, 0x0000091e, 0x00000837, 0x00060039, 0x00000003, 0x0000091f, 0x00000920, 0x00000833, 0x0000091e, 
-    0x0004003d, 0x00000830, 0x00000b92, 0x00000833, 0x0003003e, 0x00000832, 0x00000b92, 0x000a000c, 0x00000003, 
-    0x00000b94, 0x00000002, 0x00000067, 0x00000021, 0x00000b95, 0x00000b95, 0x00000064, 0x00000065, 0x00050042, 
-    0x00000055, 0x00000b96, 0x00000833, 0x0000013e, 0x0004003d, 0x0000003a, 0x00000b97, 0x00000b96, 0x00050042, 
-    0x00000055, 0x00000b98, 0x00000833, 0x0000018a, 0x0004003d, 0x0000003a, 0x00000b99, 0x00000b98, 0x00050081, 
-    0x0000003a, 0x00000b9a, 0x00000b97, 0x00000b99, 0x000200fe, 0x00000b9a, 0x00010038, 0x00050036, 0x00000003, 
-    0x000008ba, 0x00000000, 0x000008bb, 0x00030037, 0x0000003a, 0x000008bc, 0x00030037, 0x00000055, 0x000008bd, 
-    0x00030037, 0x00000055, 0x000008be, 0x000200f8, 0x000008bf, 0x0004003b, 0x00000055, 0x000008c0, 0x00000007, 
-    0x0004003b, 0x00000055, 0x000008c1, 0x00000007, 0x0004003b, 0x00000055, 0x000008c2, 0x00000007, 0x0004003b, 
-    0x00000286, 0x000008c3, 0x00000007, 0x0004003b, 0x00000286, 0x000008c4, 0x00000007, 0x0007000c, 0x00000003, 
-    0x000008c9, 0x00000002, 0x00000065, 0x000008c6, 0x000008ba, 0x0006000c, 0x00000003, 0x000008ca, 0x00000002, 
-    0x00000017, 0x000008c6, 0x0008000c, 0x00000003, 0x000008d1, 0x00000002, 0x0000001c, 0x000008cf, 0x000008c0, 
-    0x00000071, 0x0008000c, 0x00000003, 0x000008d4, 0x00000002, 0x0000001c, 0x000008d2, 0x000008c1, 0x00000071, 
-    0x0008000c, 0x00000003, 0x000008d7, 0x00000002, 0x0000001c, 0x000008d5, 0x000008c2, 0x00000071, 0x0003003e, 
-    0x000008c2, 0x000008bc, 0x000a000c, 0x00000003, 0x000008d9, 0x00000002, 0x00000067, 0x0000001b, 0x000008da, 
-    0x000008da, 0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x000008db, 0x00000002, 0x00000067, 0x0000001b, 
-    0x000008da, 0x000008da, 0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x000008dc, 0x00000002, 0x00000067, 
-    0x0000001b, 0x000008da, 0x000008da, 0x00000064, 0x00000065, 0x00050051, 0x00000032, 0x000008dd, 0x000008bc, 
-    0x00000002, 0x000500b8, 0x00000089, 0x000008de, 0x000008dd, 0x000008df, 0x000a000c, 0x00000003, 0x000008e0, 
-    0x00000002, 0x00000067, 0x0000001b, 0x000008da, 0x000008da, 0x00000512, 0x00000248, 0x000300f7, 0x000008cb, 
-    0x00000000, 0x000400fa, 0x000008de, 0x000008cd, 0x000008cb, 0x000200f8, 0x000008cb, 0x0006000c, 0x00000003, 
-    0x000008cc, 0x00000002, 0x00000017, 0x000008c6, 0x000a000c, 0x00000003, 0x000008e2, 0x00000002, 0x00000067, 
-    0x0000001b, 0x0000053b, 0x0000053b, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x000008e5, 0x00000002, 
-    0x0000001c, 0x000008e3, 0x000008c3, 0x00000071, 0x00050081, 0x00000032, 0x000008e6, 0x00000254, 0x000008dd, 
-    0x00050088, 0x00000032, 0x000008e7, 0x00000254, 0x000008e6, 0x0003003e, 0x000008c3, 0x000008e7, 0x000a000c, 
-    0x00000003, 0x000008e9, 0x00000002, 0x00000067, 0x0000001b, 0x000008ea, 0x000008ea, 0x00000064, 0x00000065, 
-    0x0008000c, 0x00000003, 0x000008ed, 0x00000002, 0x0000001c, 0x000008eb, 0x000008c4, 0x00000071, 0x00050051, 
-    0x00000032, 0x000008ee, 0x000008bc, 0x00000000, 0x0004007f, 0x00000032, 0x000008ef, 0x000008ee, 0x00050051, 
-    0x00000032, 0x000008f0, 0x000008bc, 0x00000001, 0x00050085, 0x00000032, 0x000008f1, 0x000008ef, 0x000008f0, 
-    0x00050085, 0x00000032, 0x000008f2, 0x000008f1, 0x000008e7, 0x0003003e, 0x000008c4, 0x000008f2, 0x000a000c, 
-    0x00000003, 0x000008f4, 0x00000002, 0x00000067, 0x0000001b, 0x000008f5, 0x000008f5, 0x00000064, 0x00000065, 
-    0x00050085, 0x00000032, 0x000008f6, 0x000008ee, 0x000008ee, 0x00050085, 0x00000032, 0x000008f7, 0x000008f6, 
-    0x000008e7, 0x00050083, 0x00000032, 0x000008f8, 0x00000254, 0x000008f7, 0x00060050, 0x0000003a, 0x000008f9, 
-    0x000008f8, 0x000008f2, 0x000008ef, 0x0003003e, 0x000008bd, 0x000008f9, 0x0003003e, 0x000008c1, 0x000008f9, 
-    0x000a000c, 0x00000003, 0x000008fc, 0x00000002, 0x00000067, 0x0000001b, 0x0000054e, 0x0000054e, 0x00000064, 
-    0x00000065, 0x00050085, 0x00000032, 0x000008fd, 0x000008f0, 0x000008f0, 0x00050085, 0x00000032, 0x000008fe, 
-    0x000008fd, 0x000008e7, 0x00050083, 0x00000032, 0x000008ff, 0x00000254, 0x000008fe, 0x0004007f, 0x00000032, 
-    0x00000900, 0x000008f0, 0x00060050, 0x0000003a, 0x00000901, 0x000008f2, 0x000008ff, 0x00000900, 0x0003003e, 
-    0x000008be, 0x00000901, 0x0003003e, 0x000008c0, 0x00000901, 0x000100fd, 0x000200f8, 0x000008cd, 0x0006000c, 
-    0x00000003, 0x000008ce, 0x00000002, 0x00000017, 0x000008c6, 0x000a000c, 0x00000003, 0x00000905, 0x00000002, 
-    0x00000067, 0x0000001b, 0x00000906, 0x00000906, 0x00000008, 0x0000005c, 0x000a000c, 0x00000003, 0x00000907, 
-    0x00000002, 0x00000067, 0x0000001b, 0x00000906, 0x00000906, 0x00000008, 0x0000005c, 0x000a000c, 0x00000003, 
-    0x00000908, 0x00000002, 0x00000067, 0x0000001b, 0x00000906, 0x00000906, 0x00000008, 0x0000005c, 0x0003003e, 
-    0x000008bd, 0x00000909, 0x0003003e, 0x000008c1, 0x00000909, 0x000a000c, 0x00000003, 0x0000090d, 0x00000002, 
-    0x00000067, 0x0000001b, 0x000000fa, 0x000000fa, 0x00000008, 0x0000005c, 0x0003003e, 0x000008be, 0x0000090e, 
-    0x0003003e, 0x000008c0, 0x0000090e, 0x000a000c, 0x00000003, 0x00000911, 0x00000002, 0x00000067, 0x0000001b, 
-    0x00000912, 0x00000912, 0x00000008, 0x0000005c, 0x000100fd, 0x00010038, 0x00050036, 0x00000003, 0x00000920, 
-    0x00000000, 0x00000921, 0x00030037, 0x00000831, 0x00000922, 0x00030037, 0x00000834, 0x00000923, 0x000200f8, 
-    0x00000924, 0x0004003b, 0x00000835, 0x00000925, 0x00000007, 0x0004003b, 0x00000831, 0x00000926, 0x00000007, 
-    0x0004003b, 0x00000055, 0x00000927, 0x00000007, 0x0004003b, 0x00000286, 0x00000928, 0x00000007, 0x0004003b, 
-    0x00000286, 0x00000929, 0x00000007, 0x0004003b, 0x00000286, 0x0000092a, 0x00000007, 0x0004003b, 0x00000286, 
-    0x0000092b, 0x00000007, 0x0004003b, 0x0000092c, 0x0000092d, 0x00000007, 0x0004003b, 0x00000286, 0x0000092e, 
-    0x00000007, 0x0004003b, 0x00000055, 0x0000092f, 0x00000007, 0x0004003b, 0x00000055, 0x00000930, 0x00000007, 
-    0x0004003b, 0x00000286, 0x00000931, 0x00000007, 0x0004003b, 0x00000055, 0x00000932, 0x00000007, 0x0004003b, 
-    0x00000286, 0x00000933, 0x00000007, 0x0004003b, 0x00000055, 0x00000934, 0x00000007, 0x0004003b, 0x00000055, 
-    0x00000935, 0x00000007, 0x0004003b, 0x00000286, 0x00000936, 0x00000007, 0x0004003b, 0x00000286, 0x00000937, 
-    0x00000007, 0x0004003b, 0x00000286, 0x00000938, 0x00000007, 0x0004003b, 0x00000286, 0x00000939, 0x00000007, 
-    0x0004003b, 0x00000286, 0x0000093a, 0x00000007, 0x0004003b, 0x00000286, 0x0000093b, 0x00000007, 0x0007000c, 
-    0x00000003, 0x00000940, 0x00000002, 0x00000065, 0x0000093d, 0x00000920, 0x0006000c, 0x00000003, 0x00000941, 
-    0x00000002, 0x00000017, 0x0000093d, 0x0008000c, 0x00000003, 0x00000959, 0x00000002, 0x0000001c, 0x00000958, 
-    0x00000925, 0x00000071, 0x0003003e, 0x00000925, 0x00000923, 0x0008000c, 0x00000003, 0x0000095c, 0x00000002, 
-    0x0000001c, 0x0000095b, 0x00000926, 0x00000071, 0x0004003d, 0x00000830, 0x0000095d, 0x00000922, 0x0003003e, 
-    0x00000926, 0x0000095d, 0x000a000c, 0x00000003, 0x0000095f, 0x00000002, 0x00000067, 0x00000021, 0x00000443, 
-    0x00000443, 0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x00000960, 0x00000002, 0x00000067, 0x00000021, 
-    0x00000443, 0x00000443, 0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x00000961, 0x00000002, 0x00000067, 
-    0x00000021, 0x00000443, 0x00000443, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000964, 0x00000002, 
-    0x0000001c, 0x00000962, 0x00000927, 0x00000071, 0x00050042, 0x00000055, 0x00000965, 0x00000922, 0x00000185, 
-    0x0004003d, 0x0000003a, 0x00000966, 0x00000965, 0x00050042, 0x00000055, 0x00000967, 0x00000922, 0x000001a6, 
-    0x0004003d, 0x0000003a, 0x00000968, 0x00000967, 0x00050081, 0x0000003a, 0x00000969, 0x00000966, 0x00000968, 
-    0x0006000c, 0x0000003a, 0x0000096a, 0x0000027d, 0x00000045, 0x00000969, 0x0003003e, 0x00000927, 0x0000096a, 
-    0x000a000c, 0x00000003, 0x0000096c, 0x00000002, 0x00000067, 0x00000021, 0x0000096d, 0x0000096d, 0x00000064, 
-    0x00000065, 0x0008000c, 0x00000003, 0x00000970, 0x00000002, 0x0000001c, 0x0000096e, 0x00000928, 0x00000071, 
-    0x00050051, 0x0000003a, 0x00000971, 0x00000923, 0x00000008, 0x0004003d, 0x0000003a, 0x00000972, 0x00000965, 
-    0x00060039, 0x00000032, 0x00000973, 0x00000974, 0x00000971, 0x00000972, 0x0003003e, 0x00000928, 0x00000973, 
-    0x000a000c, 0x00000003, 0x0000098e, 0x00000002, 0x00000067, 0x00000021, 0x0000098f, 0x0000098f, 0x00000064, 
-    0x00000065, 0x0008000c, 0x00000003, 0x00000992, 0x00000002, 0x0000001c, 0x00000990, 0x00000929, 0x00000071, 
-    0x0004003d, 0x0000003a, 0x00000993, 0x00000967, 0x00060039, 0x00000032, 0x00000994, 0x00000974, 0x00000971, 
-    0x00000993, 0x0003003e, 0x00000929, 0x00000994, 0x000a000c, 0x00000003, 0x00000996, 0x00000002, 0x00000067, 
-    0x00000021, 0x00000582, 0x00000582, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000999, 0x00000002, 
-    0x0000001c, 0x00000997, 0x0000092a, 0x00000071, 0x0004003d, 0x0000003a, 0x0000099a, 0x00000965, 0x00060039, 
-    0x00000032, 0x0000099b, 0x00000974, 0x0000099a, 0x0000096a, 0x0003003e, 0x0000092a, 0x0000099b, 0x000a000c, 
-    0x00000003, 0x0000099d, 0x00000002, 0x00000067, 0x00000021, 0x00000596, 0x00000596, 0x00000064, 0x00000065, 
-    0x0008000c, 0x00000003, 0x000009a0, 0x00000002, 0x0000001c, 0x0000099e, 0x0000092b, 0x00000071, 0x00060039, 
-    0x00000032, 0x000009a1, 0x00000974, 0x00000971, 0x0000096a, 0x0003003e, 0x0000092b, 0x000009a1, 0x000a000c, 
-    0x00000003, 0x000009a3, 0x00000002, 0x00000067, 0x00000021, 0x00000110, 0x00000110, 0x00000064, 0x00000065, 
-    0x000500b4, 0x00000089, 0x000009a4, 0x00000973, 0x00000273, 0x000a000c, 0x00000003, 0x000009a5, 0x00000002, 
-    0x00000067, 0x00000021, 0x00000110, 0x00000110, 0x0000071b, 0x000008c8, 0x000300f7, 0x00000946, 0x00000000, 
-    0x000400fa, 0x000009a4, 0x00000944, 0x00000942, 0x000200f8, 0x00000942, 0x0006000c, 0x00000003, 0x00000943, 
-    0x00000002, 0x00000017, 0x0000093d, 0x000500b4, 0x00000089, 0x000009a7, 0x00000994, 0x00000273, 0x0003003e, 
-    0x0000092d, 0x000009a7, 0x000200f9, 0x00000946, 0x000200f8, 0x00000944, 0x0006000c, 0x00000003, 0x00000945, 
-    0x00000002, 0x00000017, 0x0000093d, 0x0003003e, 0x0000092d, 0x000009aa, 0x000200f9, 0x00000946, 0x000200f8, 
-    0x00000946, 0x0006000c, 0x00000003, 0x00000947, 0x00000002, 0x00000017, 0x0000093d, 0x000a000c, 0x00000003, 
-    0x000009ad, 0x00000002, 0x00000067, 0x00000021, 0x00000110, 0x00000110, 0x00000866, 0x000009ae, 0x0004003d, 
-    0x00000089, 0x000009af, 0x0000092d, 0x000300f7, 0x0000094c, 0x00000000, 0x000400fa, 0x000009af, 0x0000094a, 
-    0x00000948, 0x000200f8, 0x00000948, 0x0006000c, 0x00000003, 0x00000949, 0x00000002, 0x00000017, 0x0000093d, 
-    0x000500b4, 0x00000089, 0x000009b1, 0x0000099b, 0x00000273, 0x0003003e, 0x0000092d, 0x000009b1, 0x000200f9, 
-    0x0000094c, 0x000200f8, 0x0000094a, 0x0006000c, 0x00000003, 0x0000094b, 0x00000002, 0x00000017, 0x0000093d, 
-    0x0003003e, 0x0000092d, 0x000009aa, 0x000200f9, 0x0000094c, 0x000200f8, 0x0000094c, 0x0006000c, 0x00000003, 
-    0x0000094d, 0x00000002, 0x00000017, 0x0000093d, 0x000a000c, 0x00000003, 0x000009b6, 0x00000002, 0x00000067, 
-    0x00000021, 0x00000110, 0x00000110, 0x0000066f, 0x000002e3, 0x0004003d, 0x00000089, 0x000009b7, 0x0000092d, 
-    0x000300f7, 0x00000952, 0x00000000, 0x000400fa, 0x000009b7, 0x00000950, 0x0000094e, 0x000200f8, 0x0000094e, 
-    0x0006000c, 0x00000003, 0x0000094f, 0x00000002, 0x00000017, 0x0000093d, 0x000500b4, 0x00000089, 0x000009b9, 
-    0x000009a1, 0x00000273, 0x0003003e, 0x0000092d, 0x000009b9, 0x000200f9, 0x00000952, 0x000200f8, 0x00000950, 
-    0x0006000c, 0x00000003, 0x00000951, 0x00000002, 0x00000017, 0x0000093d, 0x0003003e, 0x0000092d, 0x000009aa, 
-    0x000200f9, 0x00000952, 0x000200f8, 0x00000952, 0x0006000c, 0x00000003, 0x00000953, 0x00000002, 0x00000017, 
-    0x0000093d, 0x000a000c, 0x00000003, 0x000009be, 0x00000002, 0x00000067, 0x00000021, 0x00000110, 0x00000110, 
-    0x00000564, 0x00000858, 0x0004003d, 0x00000089, 0x000009bf, 0x0000092d, 0x000300f7, 0x00000954, 0x00000000, 
-    0x000400fa, 0x000009bf, 0x00000956, 0x00000954, 0x000200f8, 0x00000954, 0x0006000c, 0x00000003, 0x00000955, 
-    0x00000002, 0x00000017, 0x0000093d, 0x000a000c, 0x00000003, 0x000009c1, 0x00000002, 0x00000067, 0x00000021, 
-    0x000009c2, 0x000009c2, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x000009c5, 0x00000002, 0x0000001c, 
-    0x000009c3, 0x0000092e, 0x00000071, 0x0003003e, 0x0000092e, 0x000009c6, 0x000a000c, 0x00000003, 0x000009c8, 
-    0x00000002, 0x00000067, 0x00000021, 0x000004e9, 0x000004e9, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 
-    0x000009cb, 0x00000002, 0x0000001c, 0x000009c9, 0x0000092f, 0x00000071, 0x00050051, 0x0000003a, 0x000009cc, 
-    0x00000923, 0x00000000, 0x00050051, 0x00000032, 0x000009cd, 0x00000923, 0x00000003, 0x00060050, 0x0000003a, 
-    0x000009ce, 0x000009cd, 0x000009cd, 0x000009cd, 0x0008000c, 0x0000003a, 0x000009cf, 0x0000027d, 0x0000002e, 
-    0x000009d0, 0x000009cc, 0x000009ce, 0x0003003e, 0x0000092f, 0x000009cf, 0x000a000c, 0x00000003, 0x000009d2, 
-    0x00000002, 0x00000067, 0x00000021, 0x000009d3, 0x000009d3, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 
-    0x000009d6, 0x00000002, 0x0000001c, 0x000009d4, 0x00000930, 0x00000071, 0x00070039, 0x0000003a, 0x000009d7, 
-    0x000009d8, 0x000009cf, 0x000009fb, 0x0000099b, 0x0003003e, 0x00000930, 0x000009d7, 0x000a000c, 0x00000003, 
-    0x000009fd, 0x00000002, 0x00000067, 0x00000021, 0x000009fe, 0x000009fe, 0x00000064, 0x00000065, 0x0008000c, 
-    0x00000003, 0x00000a01, 0x00000002, 0x0000001c, 0x000009ff, 0x00000931, 0x00000071, 0x00070039, 0x00000032, 
-    0x00000a02, 0x00000a03, 0x00000a22, 0x00000273, 0x0000099b, 0x00050083, 0x00000032, 0x00000a23, 0x00000254, 
-    0x000009cd, 0x00050085, 0x00000032, 0x00000a24, 0x00000a02, 0x00000a23, 0x0003003e, 0x00000931, 0x00000a24, 
-    0x000a000c, 0x00000003, 0x00000a26, 0x00000002, 0x00000067, 0x00000021, 0x000002cb, 0x000002cb, 0x00000064, 
-    0x00000065, 0x0008000c, 0x00000003, 0x00000a29, 0x00000002, 0x0000001c, 0x00000a27, 0x00000932, 0x00000071, 
-    0x00050051, 0x0000003a, 0x00000a2a, 0x00000923, 0x0000000a, 0x00050094, 0x00000032, 0x00000a2b, 0x00000a2a, 
-    0x0000096a, 0x00050051, 0x0000003a, 0x00000a2c, 0x00000923, 0x0000000b, 0x00050094, 0x00000032, 0x00000a2d, 
-    0x00000a2c, 0x0000096a, 0x00060050, 0x0000003a, 0x00000a2e, 0x00000a2b, 0x00000a2d, 0x000009a1, 0x0003003e, 
-    0x00000932, 0x00000a2e, 0x000a000c, 0x00000003, 0x00000a30, 0x00000002, 0x00000067, 0x00000021, 0x00000180, 
-    0x00000180, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000a32, 0x00000002, 0x0000001c, 0x00000a31, 
-    0x00000933, 0x00000071, 0x00050051, 0x00000033, 0x00000a33, 0x00000923, 0x00000002, 0x00050050, 0x00000033, 
-    0x00000a34, 0x00000254, 0x00000254, 0x00050088, 0x00000033, 0x00000a35, 0x00000a34, 0x00000a33, 0x00060039, 
-    0x00000032, 0x00000a36, 0x00000a37, 0x00000a35, 0x00000a2e, 0x0003003e, 0x00000933, 0x00000a36, 0x000a000c, 
-    0x00000003, 0x00000a7d, 0x00000002, 0x00000067, 0x00000021, 0x000004f0, 0x000004f0, 0x00000064, 0x00000065, 
-    0x0008000c, 0x00000003, 0x00000a80, 0x00000002, 0x0000001c, 0x00000a7e, 0x00000934, 0x00000071, 0x0004003d, 
-    0x0000003a, 0x00000a81, 0x00000965, 0x00050094, 0x00000032, 0x00000a82, 0x00000a2a, 0x00000a81, 0x0004003d, 
-    0x0000003a, 0x00000a83, 0x00000965, 0x00050094, 0x00000032, 0x00000a84, 0x00000a2c, 0x00000a83, 0x00060050, 
-    0x0000003a, 0x00000a85, 0x00000a82, 0x00000a84, 0x00000973, 0x0003003e, 0x00000934, 0x00000a85, 0x000a000c, 
-    0x00000003, 0x00000a87, 0x00000002, 0x00000067, 0x00000021, 0x00000a88, 0x00000a88, 0x00000064, 0x00000065, 
-    0x0008000c, 0x00000003, 0x00000a8b, 0x00000002, 0x0000001c, 0x00000a89, 0x00000935, 0x00000071, 0x0004003d, 
-    0x0000003a, 0x00000a8c, 0x00000967, 0x00050094, 0x00000032, 0x00000a8d, 0x00000a2a, 0x00000a8c, 0x0004003d, 
-    0x0000003a, 0x00000a8e, 0x00000967, 0x00050094, 0x00000032, 0x00000a8f, 0x00000a2c, 0x00000a8e, 0x00060050, 
-    0x0000003a, 0x00000a90, 0x00000a8d, 0x00000a8f, 0x00000994, 0x0003003e, 0x00000935, 0x00000a90, 0x000a000c, 
-    0x00000003, 0x00000a92, 0x00000002, 0x00000067, 0x00000021, 0x000008da, 0x000008da, 0x00000064, 0x00000065, 
-    0x0008000c, 0x00000003, 0x00000a95, 0x00000002, 0x0000001c, 0x00000a93, 0x00000936, 0x00000071, 0x0003003e, 
-    0x00000937, 0x00000273, 0x0003003e, 0x00000936, 0x00000273, 0x0008000c, 0x00000003, 0x00000a9a, 0x00000002, 
-    0x0000001c, 0x00000a98, 0x00000938, 0x00000071, 0x0003003e, 0x00000939, 0x00000273, 0x0003003e, 0x00000938, 
-    0x00000273, 0x000a000c, 0x00000003, 0x00000a9d, 0x00000002, 0x00000067, 0x00000021, 0x00000a9e, 0x00000a9e, 
-    0x00000064, 0x00000065, 0x00090039, 0x00000032, 0x00000a9f, 0x00000aa0, 0x00000937, 0x00000939, 0x00000a85, 
-    0x00000a90, 0x00000a33, 0x0004003d, 0x00000032, 0x00000b1d, 0x00000939, 0x0003003e, 0x00000938, 0x00000b1d, 
-    0x0004003d, 0x00000032, 0x00000b1f, 0x00000937, 0x0003003e, 0x00000936, 0x00000b1f, 0x000a000c, 0x00000003, 
-    0x00000b21, 0x00000002, 0x00000067, 0x00000021, 0x000000fa, 0x000000fa, 0x00000064, 0x00000065, 0x0008000c, 
-    0x00000003, 0x00000b24, 0x00000002, 0x0000001c, 0x00000b22, 0x0000093a, 0x00000071, 0x00050085, 0x00000032, 
-    0x00000b25, 0x00000a76, 0x00000994, 0x0003003e, 0x0000093a, 0x00000b25, 0x000a000c, 0x00000003, 0x00000b27, 
-    0x00000002, 0x00000067, 0x00000021, 0x00000912, 0x00000912, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 
-    0x00000b2a, 0x00000002, 0x0000001c, 0x00000b28, 0x0000093b, 0x00000071, 0x0004003d, 0x00000032, 0x00000b2b, 
-    0x00000937, 0x00050085, 0x00000032, 0x00000b2c, 0x00000b2b, 0x00000a36, 0x00050085, 0x00000032, 0x00000b2d, 
-    0x00000b2c, 0x00000b2e, 0x00050085, 0x00000032, 0x00000b2f, 0x00000973, 0x000009a1, 0x00050088, 0x00000032, 
-    0x00000b30, 0x00000b2d, 0x00000b2f, 0x0003003e, 0x0000093b, 0x00000b30, 0x000a000c, 0x00000003, 0x00000b32, 
-    0x00000002, 0x00000067, 0x00000021, 0x00000b33, 0x00000b33, 0x00000064, 0x00000065, 0x00050042, 0x00000286, 
-    0x00000b34, 0x00000922, 0x000001e5, 0x00060039, 0x00000032, 0x00000b35, 0x00000b36, 0x00000973, 0x000009cd, 
-    0x0008000c, 0x00000032, 0x00000b69, 0x0000027d, 0x0000002e, 0x00000b25, 0x00000b30, 0x00000b35, 0x0003003e, 
-    0x00000b34, 0x00000b69, 0x00050042, 0x00000286, 0x00000b6b, 0x00000926, 0x000001e5, 0x0003003e, 0x00000b6b, 
-    0x00000b69, 0x000a000c, 0x00000003, 0x00000b6d, 0x00000002, 0x00000067, 0x00000021, 0x000008ea, 0x000008ea, 
-    0x00000064, 0x00000065, 0x00050042, 0x00000055, 0x00000b6e, 0x00000922, 0x0000013e, 0x0005008e, 0x0000003a, 
-    0x00000b6f, 0x000009cc, 0x00000a24, 0x0005008e, 0x0000003a, 0x00000b70, 0x00000b6f, 0x00000b25, 0x0003003e, 
-    0x00000b6e, 0x00000b70, 0x00050042, 0x00000055, 0x00000b72, 0x00000926, 0x0000013e, 0x0003003e, 0x00000b72, 
-    0x00000b70, 0x000a000c, 0x00000003, 0x00000b74, 0x00000002, 0x00000067, 0x00000021, 0x000008f5, 0x000008f5, 
-    0x00000064, 0x00000065, 0x00050042, 0x00000055, 0x00000b75, 0x00000922, 0x0000018a, 0x0004003d, 0x00000032, 
-    0x00000b76, 0x00000939, 0x0005008e, 0x0000003a, 0x00000b77, 0x000009d7, 0x00000b76, 0x0005008e, 0x0000003a, 
-    0x00000b78, 0x00000b77, 0x00000b30, 0x0003003e, 0x00000b75, 0x00000b78, 0x00050042, 0x00000055, 0x00000b7a, 
-    0x00000926, 0x0000018a, 0x0003003e, 0x00000b7a, 0x00000b78, 0x000100fd, 0x000200f8, 0x00000956, 0x0006000c, 
-    0x00000003, 0x00000957, 0x00000002, 0x00000017, 0x0000093d, 0x000a000c, 0x00000003, 0x00000b7d, 0x00000002, 
-    0x00000067, 0x00000021, 0x000000bc, 0x000000bc, 0x00000008, 0x0000005c, 0x000a000c, 0x00000003, 0x00000b7e, 
-    0x00000002, 0x00000067, 0x00000021, 0x000000bc, 0x000000bc, 0x00000008, 0x0000005c, 0x000a000c, 0x00000003, 
-    0x00000b7f, 0x00000002, 0x00000067, 0x00000021, 0x000000bc, 0x000000bc, 0x00000008, 0x0000005c, 0x00050042, 
-    0x00000055, 0x00000b80, 0x00000922, 0x0000013e, 0x00050042, 0x00000055, 0x00000b81, 0x00000922, 0x0000018a, 
-    0x0003003e, 0x00000b81, 0x00000b82, 0x00050042, 0x00000055, 0x00000b84, 0x00000926, 0x0000018a, 0x0003003e, 
-    0x00000b84, 0x00000b82, 0x0004003d, 0x0000003a, 0x00000b86, 0x00000b81, 0x0003003e, 0x00000b80, 0x00000b86, 
-    0x00050042, 0x00000055, 0x00000b88, 0x00000926, 0x0000013e, 0x0003003e, 0x00000b88, 0x00000b86, 0x000a000c, 
-    0x00000003, 0x00000b8a, 0x00000002, 0x00000067, 0x00000021, 0x00000b8b, 0x00000b8b, 0x00000008, 0x0000005c, 
-    0x00050042, 0x00000286, 0x00000b8c, 0x00000922, 0x000001e5, 0x0003003e, 0x00000b8c, 0x00000273, 0x00050042, 
-    0x00000286, 0x00000b8e, 0x00000926, 0x000001e5, 0x0003003e, 0x00000b8e, 0x00000273, 0x000a000c, 0x00000003, 
-    0x00000b90, 0x00000002, 0x00000067, 0x00000021, 0x00000493, 0x00000493, 0x00000008, 0x0000005c, 0x000100fd, 
-    0x00010038, 0x00050036, 0x00000032, 0x00000974, 0x00000000, 0x00000975, 0x00030037, 0x0000003a, 0x00000976, 
-    0x00030037, 0x0000003a, 0x00000977, 0x000200f8, 0x00000978, 0x0004003b, 0x00000055, 0x00000979, 0x00000007, 
-    0x0004003b, 0x00000055, 0x0000097a, 0x00000007, 0x0007000c, 0x00000003, 0x0000097e, 0x00000002, 0x00000065, 
-    0x0000097c, 0x00000974, 0x0006000c, 0x00000003, 0x0000097f, 0x00000002, 0x00000017, 0x0000097c, 0x0008000c, 
-    0x00000003, 0x00000982, 0x00000002, 0x0000001c, 0x00000980, 0x00000979, 0x00000071, 0x0003003e, 0x00000979, 
-    0x00000977, 0x0008000c, 0x00000003, 0x00000986, 0x00000002, 0x0000001c, 0x00000984, 0x0000097a, 0x00000071, 
-    0x0003003e, 0x0000097a, 0x00000976, 0x000a000c, 0x00000003, 0x00000988, 0x00000002, 0x00000067, 0x0000001b, 
-    0x000004de, 0x000004de, 0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x00000989, 0x00000002, 0x00000067, 
-    0x0000001b, 0x000004de, 0x000004de, 0x00000064, 0x00000065, 0x00050094, 0x00000032, 0x0000098a, 0x00000976, 
-    0x00000977, 0x0008000c, 0x00000032, 0x0000098b, 0x0000027d, 0x0000002b, 0x0000098a, 0x00000273, 0x00000254, 
-    0x000200fe, 0x0000098b, 0x00010038, 0x00050036, 0x0000003a, 0x000009d8, 0x00000000, 0x000009d9, 0x00030037, 
-    0x0000003a, 0x000009da, 0x00030037, 0x0000003a, 0x000009db, 0x00030037, 0x00000032, 0x000009dc, 0x000200f8, 
-    0x000009dd, 0x0004003b, 0x00000286, 0x000009de, 0x00000007, 0x0004003b, 0x00000055, 0x000009df, 0x00000007, 
-    0x0004003b, 0x00000055, 0x000009e0, 0x00000007, 0x0007000c, 0x00000003, 0x000009e5, 0x00000002, 0x00000065, 
-    0x000009e2, 0x000009d8, 0x0006000c, 0x00000003, 0x000009e6, 0x00000002, 0x00000017, 0x000009e2, 0x0008000c, 
-    0x00000003, 0x000009e8, 0x00000002, 0x0000001c, 0x000009e7, 0x000009de, 0x00000071, 0x0003003e, 0x000009de, 
-    0x000009dc, 0x0008000c, 0x00000003, 0x000009ec, 0x00000002, 0x0000001c, 0x000009ea, 0x000009df, 0x00000071, 
-    0x0003003e, 0x000009df, 0x000009db, 0x0008000c, 0x00000003, 0x000009f0, 0x00000002, 0x0000001c, 0x000009ee, 
-    0x000009e0, 0x00000071, 0x0003003e, 0x000009e0, 0x000009da, 0x000a000c, 0x00000003, 0x000009f2, 0x00000002, 
-    0x00000067, 0x00000018, 0x0000093f, 0x0000093f, 0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x000009f3, 
-    0x00000002, 0x00000067, 0x00000018, 0x0000093f, 0x0000093f, 0x00000064, 0x00000065, 0x00050083, 0x0000003a, 
-    0x000009f4, 0x000009db, 0x000009da, 0x00050083, 0x00000032, 0x000009f5, 0x00000254, 0x000009dc, 0x0007000c, 
-    0x00000032, 0x000009f6, 0x0000027d, 0x0000001a, 0x000009f5, 0x000009f7, 0x0005008e, 0x0000003a, 0x000009f8, 
-    0x000009f4, 0x000009f6, 0x00050081, 0x0000003a, 0x000009f9, 0x000009da, 0x000009f8, 0x000200fe, 0x000009f9, 
-    0x00010038, 0x00050036, 0x00000032, 0x00000a03, 0x00000000, 0x00000a04, 0x00030037, 0x00000032, 0x00000a05, 
-    0x00030037, 0x00000032, 0x00000a06, 0x00030037, 0x00000032, 0x00000a07, 0x000200f8, 0x00000a08, 0x0004003b, 
-    0x00000286, 0x00000a09, 0x00000007, 0x0004003b, 0x00000286, 0x00000a0a, 0x00000007, 0x0004003b, 0x00000286, 
-    0x00000a0b, 0x00000007, 0x0007000c, 0x00000003, 0x00000a0e, 0x00000002, 0x00000065, 0x00000a0d, 0x00000a03, 
-    0x0006000c, 0x00000003, 0x00000a0f, 0x00000002, 0x00000017, 0x00000a0d, 0x0008000c, 0x00000003, 0x00000a11, 
-    0x00000002, 0x0000001c, 0x00000a10, 0x00000a09, 0x00000071, 0x0003003e, 0x00000a09, 0x00000a07, 0x0008000c, 
-    0x00000003, 0x00000a14, 0x00000002, 0x0000001c, 0x00000a13, 0x00000a0a, 0x00000071, 0x0003003e, 0x00000a0a, 
-    0x00000a06, 0x0008000c, 0x00000003, 0x00000a17, 0x00000002, 0x0000001c, 0x00000a16, 0x00000a0b, 0x00000071, 
-    0x0003003e, 0x00000a0b, 0x00000a05, 0x000a000c, 0x00000003, 0x00000a19, 0x00000002, 0x00000067, 0x00000018, 
-    0x00000a1a, 0x00000a1a, 0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x00000a1b, 0x00000002, 0x00000067, 
-    0x00000018, 0x00000a1a, 0x00000a1a, 0x00000064, 0x00000065, 0x00050083, 0x00000032, 0x00000a1c, 0x00000a06, 
-    0x00000a05, 0x00050083, 0x00000032, 0x00000a1d, 0x00000254, 0x00000a07, 0x0007000c, 0x00000032, 0x00000a1e, 
-    0x0000027d, 0x0000001a, 0x00000a1d, 0x000009f7, 0x00050085, 0x00000032, 0x00000a1f, 0x00000a1c, 0x00000a1e, 
-    0x00050081, 0x00000032, 0x00000a20, 0x00000a05, 0x00000a1f, 0x000200fe, 0x00000a20, 0x00010038, 0x00050036, 
-    0x00000032, 0x00000a37, 0x00000000, 0x00000a38, 0x00030037, 0x00000033, 0x00000a39, 0x00030037, 0x0000003a, 
-    0x00000a3a, 0x000200f8, 0x00000a3b, 0x0004003b, 0x00000055, 0x00000a3c, 0x00000007, 0x0004003b, 0x00000034, 
-    0x00000a3d, 0x00000007, 0x0004003b, 0x00000286, 0x00000a3e, 0x00000007, 0x0004003b, 0x00000286, 0x00000a3f, 
-    0x00000007, 0x0004003b, 0x00000286, 0x00000a40, 0x00000007, 0x0004003b, 0x00000286, 0x00000a41, 0x00000007, 
-    0x0007000c, 0x00000003, 0x00000a46, 0x00000002, 0x00000065, 0x00000a43, 0x00000a37, 0x0006000c, 0x00000003, 
-    0x00000a47, 0x00000002, 0x00000017, 0x00000a43, 0x0008000c, 0x00000003, 0x00000a4a, 0x00000002, 0x0000001c, 
-    0x00000a48, 0x00000a3c, 0x00000071, 0x0003003e, 0x00000a3c, 0x00000a3a, 0x0008000c, 0x00000003, 0x00000a4e, 
-    0x00000002, 0x0000001c, 0x00000a4c, 0x00000a3d, 0x00000071, 0x0003003e, 0x00000a3d, 0x00000a39, 0x000a000c, 
-    0x00000003, 0x00000a50, 0x00000002, 0x00000067, 0x00000018, 0x00000009, 0x00000009, 0x00000064, 0x00000065, 
-    0x000a000c, 0x00000003, 0x00000a51, 0x00000002, 0x00000067, 0x00000018, 0x00000009, 0x00000009, 0x00000064, 
-    0x00000065, 0x000a000c, 0x00000003, 0x00000a52, 0x00000002, 0x00000067, 0x00000018, 0x00000009, 0x00000009, 
-    0x00000245, 0x00000070, 0x0008000c, 0x00000003, 0x00000a54, 0x00000002, 0x0000001c, 0x00000a53, 0x00000a3e, 
-    0x00000071, 0x00050051, 0x00000032, 0x00000a55, 0x00000a3a, 0x00000000, 0x00050051, 0x00000032, 0x00000a56, 
-    0x00000a39, 0x00000000, 0x00050085, 0x00000032, 0x00000a57, 0x00000a55, 0x00000a56, 0x0003003e, 0x00000a3e, 
-    0x00000a57, 0x000a000c, 0x00000003, 0x00000a59, 0x00000002, 0x00000067, 0x00000018, 0x00000a5a, 0x00000a5a, 
-    0x00000245, 0x00000070, 0x0008000c, 0x00000003, 0x00000a5c, 0x00000002, 0x0000001c, 0x00000a5b, 0x00000a3f, 
-    0x00000071, 0x00050051, 0x00000032, 0x00000a5d, 0x00000a3a, 0x00000001, 0x00050051, 0x00000032, 0x00000a5e, 
-    0x00000a39, 0x00000001, 0x00050085, 0x00000032, 0x00000a5f, 0x00000a5d, 0x00000a5e, 0x0003003e, 0x00000a3f, 
-    0x00000a5f, 0x000a000c, 0x00000003, 0x00000a61, 0x00000002, 0x00000067, 0x00000018, 0x00000a62, 0x00000a62, 
-    0x00000245, 0x00000070, 0x0008000c, 0x00000003, 0x00000a65, 0x00000002, 0x0000001c, 0x00000a63, 0x00000a40, 
-    0x00000071, 0x00050085, 0x00000032, 0x00000a66, 0x00000a57, 0x00000a57, 0x00050085, 0x00000032, 0x00000a67, 
-    0x00000a5f, 0x00000a5f, 0x00050081, 0x00000032, 0x00000a68, 0x00000a66, 0x00000a67, 0x0003003e, 0x00000a40, 
-    0x00000a68, 0x000a000c, 0x00000003, 0x00000a6a, 0x00000002, 0x00000067, 0x00000018, 0x00000a6b, 0x00000a6b, 
-    0x00000245, 0x00000070, 0x0008000c, 0x00000003, 0x00000a6e, 0x00000002, 0x0000001c, 0x00000a6c, 0x00000a41, 
-    0x00000071, 0x00050051, 0x00000032, 0x00000a6f, 0x00000a3a, 0x00000002, 0x00050085, 0x00000032, 0x00000a70, 
-    0x00000a6f, 0x00000a6f, 0x00050081, 0x00000032, 0x00000a71, 0x00000a68, 0x00000a70, 0x0003003e, 0x00000a41, 
-    0x00000a71, 0x000a000c, 0x00000003, 0x00000a73, 0x00000002, 0x00000067, 0x00000018, 0x00000a74, 0x00000a74, 
-    0x00000064, 0x00000065, 0x00050085, 0x00000032, 0x00000a75, 0x00000a76, 0x00000a56, 0x00050085, 0x00000032, 
-    0x00000a77, 0x00000a75, 0x00000a5e, 0x00050085, 0x00000032, 0x00000a78, 0x00000a77, 0x00000a6f, 0x00050085, 
-    0x00000032, 0x00000a79, 0x00000a71, 0x00000a71, 0x00050088, 0x00000032, 0x00000a7a, 0x00000a78, 0x00000a79, 
-    0x000200fe, 0x00000a7a, 0x00010038, 0x00050036, 0x00000032, 0x00000aa0, 0x00000000, 0x00000aa1, 0x00030037, 
-    0x00000286, 0x00000aa2, 0x00030037, 0x00000286, 0x00000aa3, 0x00030037, 0x0000003a, 0x00000aa4, 0x00030037, 
-    0x0000003a, 0x00000aa5, 0x00030037, 0x00000033, 0x00000aa6, 0x000200f8, 0x00000aa7, 0x0004003b, 0x00000034, 
-    0x00000aa8, 0x00000007, 0x0004003b, 0x00000055, 0x00000aa9, 0x00000007, 0x0004003b, 0x00000055, 0x00000aaa, 
-    0x00000007, 0x0004003b, 0x00000286, 0x00000aab, 0x00000007, 0x0004003b, 0x00000286, 0x00000aac, 0x00000007, 
-    0x0007000c, 0x00000003, 0x00000ab0, 0x00000002, 0x00000065, 0x00000aae, 0x00000aa0, 0x0006000c, 0x00000003, 
-    0x00000ab1, 0x00000002, 0x00000017, 0x00000aae, 0x0008000c, 0x00000003, 0x00000ab3, 0x00000002, 0x0000001c, 
-    0x00000ab2, 0x00000aa8, 0x00000071, 0x0003003e, 0x00000aa8, 0x00000aa6, 0x0008000c, 0x00000003, 0x00000ab6, 
-    0x00000002, 0x0000001c, 0x00000ab5, 0x00000aa9, 0x00000071, 0x0003003e, 0x00000aa9, 0x00000aa5, 0x0008000c, 
-    0x00000003, 0x00000ab9, 0x00000002, 0x0000001c, 0x00000ab8, 0x00000aaa, 0x00000071, 0x0003003e, 0x00000aaa, 
-    0x00000aa4, 0x0008000c, 0x00000003, 0x00000abc, 0x00000002, 0x0000001c, 0x00000abb, 0x00000aab, 0x00000071, 
-    0x0008000c, 0x00000003, 0x00000abe, 0x00000002, 0x0000001c, 0x00000abd, 0x00000aac, 0x00000071, 0x000a000c, 
-    0x00000003, 0x00000abf, 0x00000002, 0x00000067, 0x00000018, 0x00000ac0, 0x00000ac0, 0x00000064, 0x00000065, 
-    0x000a000c, 0x00000003, 0x00000ac1, 0x00000002, 0x00000067, 0x00000018, 0x00000ac0, 0x00000ac0, 0x00000064, 
-    0x00000065, 0x000a000c, 0x00000003, 0x00000ac2, 0x00000002, 0x00000067, 0x00000018, 0x00000ac0, 0x00000ac0, 
-    0x00000064, 0x00000065, 0x00060039, 0x00000032, 0x00000ac3, 0x00000ac4, 0x00000aa4, 0x00000aa6, 0x0003003e, 
-    0x00000aa2, 0x00000ac3, 0x0003003e, 0x00000aac, 0x00000ac3, 0x000a000c, 0x00000003, 0x00000b14, 0x00000002, 
-    0x00000067, 0x00000018, 0x00000716, 0x00000716, 0x00000064, 0x00000065, 0x00060039, 0x00000032, 0x00000b15, 
-    0x00000ac4, 0x00000aa5, 0x00000aa6, 0x0003003e, 0x00000aa3, 0x00000b15, 0x0003003e, 0x00000aab, 0x00000b15, 
-    0x000a000c, 0x00000003, 0x00000b18, 0x00000002, 0x00000067, 0x00000018, 0x0000083d, 0x0000083d, 0x00000064, 
-    0x00000065, 0x0004003d, 0x00000032, 0x00000b19, 0x00000aa2, 0x0004003d, 0x00000032, 0x00000b1a, 0x00000aa3, 
-    0x00050085, 0x00000032, 0x00000b1b, 0x00000b19, 0x00000b1a, 0x000200fe, 0x00000b1b, 0x00010038, 0x00050036, 
-    0x00000032, 0x00000ac4, 0x00000000, 0x00000ac5, 0x00030037, 0x0000003a, 0x00000ac6, 0x00030037, 0x00000033, 
-    0x00000ac7, 0x000200f8, 0x00000ac8, 0x0004003b, 0x00000034, 0x00000ac9, 0x00000007, 0x0004003b, 0x00000055, 
-    0x00000aca, 0x00000007, 0x0004003b, 0x00000286, 0x00000acb, 0x00000007, 0x0004003b, 0x00000286, 0x00000acc, 
-    0x00000007, 0x0004003b, 0x00000286, 0x00000acd, 0x00000007, 0x0004003b, 0x00000286, 0x00000ace, 0x00000007, 
-    0x0007000c, 0x00000003, 0x00000ad3, 0x00000002, 0x00000065, 0x00000ad0, 0x00000ac4, 0x0006000c, 0x00000003, 
-    0x00000ad4, 0x00000002, 0x00000017, 0x00000ad0, 0x0008000c, 0x00000003, 0x00000ada, 0x00000002, 0x0000001c, 
-    0x00000ad9, 0x00000ac9, 0x00000071, 0x0003003e, 0x00000ac9, 0x00000ac7, 0x0008000c, 0x00000003, 0x00000ade, 
-    0x00000002, 0x0000001c, 0x00000adc, 0x00000aca, 0x00000071, 0x0003003e, 0x00000aca, 0x00000ac6, 0x000a000c, 
-    0x00000003, 0x00000ae0, 0x00000002, 0x00000067, 0x00000018, 0x000006e2, 0x000006e2, 0x00000064, 0x00000065, 
-    0x000a000c, 0x00000003, 0x00000ae1, 0x00000002, 0x00000067, 0x00000018, 0x000006e2, 0x000006e2, 0x00000064, 
-    0x00000065, 0x000a000c, 0x00000003, 0x00000ae2, 0x00000002, 0x00000067, 0x00000018, 0x000006e2, 0x000006e2, 
-    0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000ae5, 0x00000002, 0x0000001c, 0x00000ae3, 0x00000acb, 
-    0x00000071, 0x00050051, 0x00000032, 0x00000ae6, 0x00000ac6, 0x00000002, 0x00050085, 0x00000032, 0x00000ae7, 
-    0x00000ae6, 0x00000ae6, 0x0003003e, 0x00000acb, 0x00000ae7, 0x000a000c, 0x00000003, 0x00000ae9, 0x00000002, 
-    0x00000067, 0x00000018, 0x00000aea, 0x00000aea, 0x00000064, 0x00000065, 0x000500b4, 0x00000089, 0x00000aeb, 
-    0x00000ae7, 0x00000273, 0x000a000c, 0x00000003, 0x00000aec, 0x00000002, 0x00000067, 0x00000018, 0x00000aea, 
-    0x00000aea, 0x00000070, 0x00000007, 0x000300f7, 0x00000ad5, 0x00000000, 0x000400fa, 0x00000aeb, 0x00000ad7, 
-    0x00000ad5, 0x000200f8, 0x00000ad5, 0x0006000c, 0x00000003, 0x00000ad6, 0x00000002, 0x00000017, 0x00000ad0, 
-    0x000a000c, 0x00000003, 0x00000aee, 0x00000002, 0x00000067, 0x00000018, 0x00000700, 0x00000700, 0x00000245, 
-    0x00000070, 0x0008000c, 0x00000003, 0x00000af1, 0x00000002, 0x0000001c, 0x00000aef, 0x00000acc, 0x00000071, 
-    0x00050051, 0x00000032, 0x00000af2, 0x00000ac6, 0x00000000, 0x00050051, 0x00000032, 0x00000af3, 0x00000ac7, 
-    0x00000000, 0x00050085, 0x00000032, 0x00000af4, 0x00000af2, 0x00000af3, 0x0003003e, 0x00000acc, 0x00000af4, 
-    0x000a000c, 0x00000003, 0x00000af6, 0x00000002, 0x00000067, 0x00000018, 0x00000af7, 0x00000af7, 0x00000245, 
-    0x00000070, 0x0008000c, 0x00000003, 0x00000afa, 0x00000002, 0x0000001c, 0x00000af8, 0x00000acd, 0x00000071, 
-    0x00050051, 0x00000032, 0x00000afb, 0x00000ac6, 0x00000001, 0x00050051, 0x00000032, 0x00000afc, 0x00000ac7, 
-    0x00000001, 0x00050085, 0x00000032, 0x00000afd, 0x00000afb, 0x00000afc, 0x0003003e, 0x00000acd, 0x00000afd, 
-    0x000a000c, 0x00000003, 0x00000aff, 0x00000002, 0x00000067, 0x00000018, 0x00000b00, 0x00000b00, 0x00000245, 
-    0x00000070, 0x0008000c, 0x00000003, 0x00000b03, 0x00000002, 0x0000001c, 0x00000b01, 0x00000ace, 0x00000071, 
-    0x00050085, 0x00000032, 0x00000b04, 0x00000af4, 0x00000af4, 0x00050085, 0x00000032, 0x00000b05, 0x00000afd, 
-    0x00000afd, 0x00050081, 0x00000032, 0x00000b06, 0x00000b04, 0x00000b05, 0x00050088, 0x00000032, 0x00000b07, 
-    0x00000b06, 0x00000ae7, 0x0003003e, 0x00000ace, 0x00000b07, 0x000a000c, 0x00000003, 0x00000b09, 0x00000002, 
-    0x00000067, 0x00000018, 0x00000707, 0x00000707, 0x00000064, 0x00000065, 0x00050081, 0x00000032, 0x00000b0a, 
-    0x00000254, 0x00000b07, 0x0006000c, 0x00000032, 0x00000b0b, 0x0000027d, 0x0000001f, 0x00000b0a, 0x00050081, 
-    0x00000032, 0x00000b0c, 0x00000254, 0x00000b0b, 0x00050088, 0x00000032, 0x00000b0d, 0x00000252, 0x00000b0c, 
-    0x000200fe, 0x00000b0d, 0x000200f8, 0x00000ad7, 0x0006000c, 0x00000003, 0x00000ad8, 0x00000002, 0x00000017, 
-    0x00000ad0, 0x000a000c, 0x00000003, 0x00000b0f, 0x00000002, 0x00000067, 0x00000018, 0x000006f2, 0x000006f2, 
-    0x00000008, 0x0000005c, 0x000a000c, 0x00000003, 0x00000b10, 0x00000002, 0x00000067, 0x00000018, 0x000006f2, 
-    0x000006f2, 0x00000008, 0x0000005c, 0x000200fe, 0x00000273, 0x00010038, 0x00050036, 0x00000032, 0x00000b36, 
-    0x00000000, 0x00000b37, 0x00030037, 0x00000032, 0x00000b38, 0x00030037, 0x00000032, 0x00000b39, 0x000200f8, 
-    0x00000b3a, 0x0004003b, 0x00000286, 0x00000b3b, 0x00000007, 0x0004003b, 0x00000286, 0x00000b3c, 0x00000007, 
-    0x0007000c, 0x00000003, 0x00000b41, 0x00000002, 0x00000065, 0x00000b3e, 0x00000b36, 0x0006000c, 0x00000003, 
-    0x00000b42, 0x00000002, 0x00000017, 0x00000b3e, 0x0008000c, 0x00000003, 0x00000b44, 0x00000002, 0x0000001c, 
-    0x00000b43, 0x00000b3b, 0x00000071, 0x0003003e, 0x00000b3b, 0x00000b39, 0x0008000c, 0x00000003, 0x00000b47, 
-    0x00000002, 0x0000001c, 0x00000b46, 0x00000b3c, 0x00000071, 0x0003003e, 0x00000b3c, 0x00000b38, 0x000a000c, 
-    0x00000003, 0x00000b49, 0x00000002, 0x00000067, 0x00000015, 0x00000b4a, 0x00000b4a, 0x00000064, 0x00000065, 
-    0x000a000c, 0x00000003, 0x00000b4b, 0x00000002, 0x00000067, 0x00000015, 0x00000b4a, 0x00000b4a, 0x00000064, 
-    0x00000065, 0x00070039, 0x00000032, 0x00000b4c, 0x00000b4d, 0x000009c6, 0x00000254, 0x00000b38, 0x0008000c, 
-    0x00000032, 0x00000b67, 0x0000027d, 0x0000002e, 0x00000b4c, 0x00000254, 0x00000b39, 0x000200fe, 0x00000b67, 
-    0x00010038, 0x00050036, 0x00000032, 0x00000b4d, 0x00000000, 0x00000a04, 0x00030037, 0x00000032, 0x00000b4e, 
-    0x00030037, 0x00000032, 0x00000b4f, 0x00030037, 0x00000032, 0x00000b50, 0x000200f8, 0x00000b51, 0x0004003b, 
-    0x00000286, 0x00000b52, 0x00000007, 0x0004003b, 0x00000286, 0x00000b53, 0x00000007, 0x0004003b, 0x00000286, 
-    0x00000b54, 0x00000007, 0x0006000c, 0x00000003, 0x00000b55, 0x00000002, 0x00000017, 0x00000a0d, 0x0008000c, 
-    0x00000003, 0x00000b57, 0x00000002, 0x0000001c, 0x00000b56, 0x00000b52, 0x00000071, 0x0003003e, 0x00000b52, 
-    0x00000b50, 0x0008000c, 0x00000003, 0x00000b5a, 0x00000002, 0x0000001c, 0x00000b59, 0x00000b53, 0x00000071, 
-    0x0003003e, 0x00000b53, 0x00000b4f, 0x0008000c, 0x00000003, 0x00000b5d, 0x00000002, 0x0000001c, 0x00000b5c, 
-    0x00000b54, 0x00000071, 0x0003003e, 0x00000b54, 0x00000b4e, 0x000a000c, 0x00000003, 0x00000b5f, 0x00000002, 
-    0x00000067, 0x00000018, 0x00000a1a, 0x00000a1a, 0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x00000b60, 
-    0x00000002, 0x00000067, 0x00000018, 0x00000a1a, 0x00000a1a, 0x00000064, 0x00000065, 0x00050083, 0x00000032, 
-    0x00000b61, 0x00000b4f, 0x00000b4e, 0x00050083, 0x00000032, 0x00000b62, 0x00000254, 0x00000b50, 0x0007000c, 
-    0x00000032, 0x00000b63, 0x0000027d, 0x0000001a, 0x00000b62, 0x000009f7, 0x00050085, 0x00000032, 0x00000b64, 
-    0x00000b61, 0x00000b63, 0x00050081, 0x00000032, 0x00000b65, 0x00000b4e, 0x00000b64, 0x000200fe, 0x00000b65, 
-    0x00010038, 0x00050036, 0x00000003, 0x00000bad, 0x00000000, 0x00000030, 0x000200f8, 0x00000bae, 0x0004003b, 
-    0x00000052, 0x00000baf, 0x00000007, 0x0004003b, 0x00000046, 0x00000bb0, 0x00000007, 0x0004003b, 0x00000055, 
-    0x00000bb1, 0x00000007, 0x0007000c, 0x00000003, 0x00000bb5, 0x00000002, 0x00000065, 0x00000bb2, 0x00000bad, 
-    0x0006000c, 0x00000003, 0x00000bb6, 0x00000002, 0x00000017, 0x00000bb2, 0x0008000c, 0x00000003, 0x00000bc0, 
-    0x00000002, 0x0000001c, 0x00000bbf, 0x00000baf, 0x00000071, 0x0004003d, 0x00000051, 0x00000bc1, 0x00000bc2, 
-    0x0003003e, 0x00000baf, 0x00000bc1, 0x000a000c, 0x00000003, 0x00000bc5, 0x00000002, 0x00000067, 0x0000002d, 
-    0x00000bc6, 0x00000bc6, 0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x00000bc7, 0x00000002, 0x00000067, 
-    0x0000002d, 0x00000bc6, 0x00000bc6, 0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x00000bc8, 0x00000002, 
-    0x00000067, 0x0000002d, 0x00000bc6, 0x00000bc6, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000bca, 
-    0x00000002, 0x0000001c, 0x00000bc9, 0x00000bb0, 0x00000071, 0x00050042, 0x00000181, 0x00000bcb, 0x00000142, 
-    0x00000044, 0x0004003d, 0x00000140, 0x00000bcc, 0x00000bcb, 0x00050043, 0x00000140, 0x00000bcd, 0x00000bcc, 
-    0x00000185, 0x00050042, 0x00000187, 0x00000bce, 0x00000bcd, 0x00000185, 0x0006003d, 0x00000186, 0x00000bcf, 
-    0x00000bce, 0x00000002, 0x00000004, 0x00050051, 0x00000189, 0x00000bd0, 0x00000bcf, 0x00000000, 0x00050051, 
-    0x00000038, 0x00000bd1, 0x00000bd0, 0x00000000, 0x00050051, 0x00000032, 0x00000bd2, 0x00000bd1, 0x00000000, 
-    0x00050051, 0x00000032, 0x00000bd3, 0x00000bd1, 0x00000001, 0x00050051, 0x00000032, 0x00000bd4, 0x00000bd1, 
-    0x00000002, 0x00050051, 0x00000032, 0x00000bd5, 0x00000bd1, 0x00000003, 0x00050051, 0x00000038, 0x00000bd6, 
-    0x00000bd0, 0x00000001, 0x00050051, 0x00000032, 0x00000bd7, 0x00000bd6, 0x00000000, 0x00050051, 0x00000032, 
-    0x00000bd8, 0x00000bd6, 0x00000001, 0x00050051, 0x00000032, 0x00000bd9, 0x00000bd6, 0x00000002, 0x00050051, 
-    0x00000032, 0x00000bda, 0x00000bd6, 0x00000003, 0x00050051, 0x00000038, 0x00000bdb, 0x00000bd0, 0x00000002, 
-    0x00050051, 0x00000032, 0x00000bdc, 0x00000bdb, 0x00000000, 0x00050051, 0x00000032, 0x00000bdd, 0x00000bdb, 
-    0x00000001, 0x00050051, 0x00000032, 0x00000bde, 0x00000bdb, 0x00000002, 0x00050051, 0x00000032, 0x00000bdf, 
-    0x00000bdb, 0x00000003, 0x00050051, 0x00000038, 0x00000be0, 0x00000bd0, 0x00000003, 0x00050051, 0x00000032, 
-    0x00000be1, 0x00000be0, 0x00000000, 0x00050051, 0x00000032, 0x00000be2, 0x00000be0, 0x00000001, 0x00050051, 
-    0x00000032, 0x00000be3, 0x00000be0, 0x00000002, 0x00050051, 0x00000032, 0x00000be4, 0x00000be0, 0x00000003, 
-    0x00070050, 0x00000038, 0x00000be5, 0x00000bd2, 0x00000bd3, 0x00000bd4, 0x00000bd5, 0x00070050, 0x00000038, 
-    0x00000be6, 0x00000bd7, 0x00000bd8, 0x00000bd9, 0x00000bda, 0x00070050, 0x00000038, 0x00000be7, 0x00000bdc, 
-    0x00000bdd, 0x00000bde, 0x00000bdf, 0x00070050, 0x00000038, 0x00000be8, 0x00000be1, 0x00000be2, 0x00000be3, 
-    0x00000be4, 0x00070050, 0x00000039, 0x00000be9, 0x00000be5, 0x00000be6, 0x00000be7, 0x00000be8, 0x00050042, 
-    0x00000187, 0x00000bea, 0x00000bcd, 0x000001a6, 0x0006003d, 0x00000186, 0x00000beb, 0x00000bea, 0x00000002, 
-    0x00000004, 0x00050051, 0x00000189, 0x00000bec, 0x00000beb, 0x00000000, 0x00050051, 0x00000038, 0x00000bed, 
-    0x00000bec, 0x00000000, 0x00050051, 0x00000032, 0x00000bee, 0x00000bed, 0x00000000, 0x00050051, 0x00000032, 
-    0x00000bef, 0x00000bed, 0x00000001, 0x00050051, 0x00000032, 0x00000bf0, 0x00000bed, 0x00000002, 0x00050051, 
-    0x00000032, 0x00000bf1, 0x00000bed, 0x00000003, 0x00050051, 0x00000038, 0x00000bf2, 0x00000bec, 0x00000001, 
-    0x00050051, 0x00000032, 0x00000bf3, 0x00000bf2, 0x00000000, 0x00050051, 0x00000032, 0x00000bf4, 0x00000bf2, 
-    0x00000001, 0x00050051, 0x00000032, 0x00000bf5, 0x00000bf2, 0x00000002, 0x00050051, 0x00000032, 0x00000bf6, 
-    0x00000bf2, 0x00000003, 0x00050051, 0x00000038, 0x00000bf7, 0x00000bec, 0x00000002, 0x00050051, 0x00000032, 
-    0x00000bf8, 0x00000bf7, 0x00000000, 0x00050051, 0x00000032, 0x00000bf9, 0x00000bf7, 0x00000001, 0x00050051, 
-    0x00000032, 0x00000bfa, 0x00000bf7, 0x00000002, 0x00050051, 0x00000032, 0x00000bfb, 0x00000bf7, 0x00000003, 
-    0x00050051, 0x00000038, 0x00000bfc, 0x00000bec, 0x00000003, 0x00050051, 0x00000032, 0x00000bfd, 0x00000bfc, 
-    0x00000000, 0x00050051, 0x00000032, 0x00000bfe, 0x00000bfc, 0x00000001, 0x00050051, 0x00000032, 0x00000bff, 
-    0x00000bfc, 0x00000002, 0x00050051, 0x00000032, 0x00000c00, 0x00000bfc, 0x00000003, 0x00070050, 0x00000038, 
-    0x00000c01, 0x00000bee, 0x00000bef, 0x00000bf0, 0x00000bf1, 0x00070050, 0x00000038, 0x00000c02, 0x00000bf3, 
-    0x00000bf4, 0x00000bf5, 0x00000bf6, 0x00070050, 0x00000038, 0x00000c03, 0x00000bf8, 0x00000bf9, 0x00000bfa, 
-    0x00000bfb, 0x00070050, 0x00000038, 0x00000c04, 0x00000bfd, 0x00000bfe, 0x00000bff, 0x00000c00, 0x00070050, 
-    0x00000039, 0x00000c05, 0x00000c01, 0x00000c02, 0x00000c03, 0x00000c04, 0x00050042, 0x00000187, 0x00000c06, 
-    0x00000bcd, 0x00000044, 0x0006003d, 0x00000186, 0x00000c07, 0x00000c06, 0x00000002, 0x00000004, 0x00050051, 
-    0x00000189, 0x00000c08, 0x00000c07, 0x00000000, 0x00050051, 0x00000038, 0x00000c09, 0x00000c08, 0x00000000, 
-    0x00050051, 0x00000032, 0x00000c0a, 0x00000c09, 0x00000000, 0x00050051, 0x00000032, 0x00000c0b, 0x00000c09, 
-    0x00000001, 0x00050051, 0x00000032, 0x00000c0c, 0x00000c09, 0x00000002, 0x00050051, 0x00000032, 0x00000c0d, 
-    0x00000c09, 0x00000003, 0x00050051, 0x00000038, 0x00000c0e, 0x00000c08, 0x00000001, 0x00050051, 0x00000032, 
-    0x00000c0f, 0x00000c0e, 0x00000000, 0x00050051, 0x00000032, 0x00000c10, 0x00000c0e, 0x00000001, 0x00050051, 
-    0x00000032, 0x00000c11, 0x00000c0e, 0x00000002, 0x00050051, 0x00000032, 0x00000c12, 0x00000c0e, 0x00000003, 
-    0x00050051, 0x00000038, 0x00000c13, 0x00000c08, 0x00000002, 0x00050051, 0x00000032, 0x00000c14, 0x00000c13, 
-    0x00000000, 0x00050051, 0x00000032, 0x00000c15, 0x00000c13, 0x00000001, 0x00050051, 0x00000032, 0x00000c16, 
-    0x00000c13, 0x00000002, 0x00050051, 0x00000032, 0x00000c17, 0x00000c13, 0x00000003, 0x00050051, 0x00000038, 
-    0x00000c18, 0x00000c08, 0x00000003, 0x00050051, 0x00000032, 0x00000c19, 0x00000c18, 0x00000000, 0x00050051, 
-    0x00000032, 0x00000c1a, 0x00000c18, 0x00000001, 0x00050051, 0x00000032, 0x00000c1b, 0x00000c18, 0x00000002, 
-    0x00050051, 0x00000032, 0x00000c1c, 0x00000c18, 0x00000003, 0x00070050, 0x00000038, 0x00000c1d, 0x00000c0a, 
-    0x00000c0b, 0x00000c0c, 0x00000c0d, 0x00070050, 0x00000038, 0x00000c1e, 0x00000c0f, 0x00000c10, 0x00000c11, 
-    0x00000c12, 0x00070050, 0x00000038, 0x00000c1f, 0x00000c14, 0x00000c15, 0x00000c16, 0x00000c17, 0x00070050, 
-    0x00000038, 0x00000c20, 0x00000c19, 0x00000c1a, 0x00000c1b, 0x00000c1c, 0x00070050, 0x00000039, 0x00000c21, 
-    0x00000c1d, 0x00000c1e, 0x00000c1f, 0x00000c20, 0x00050042, 0x000001df, 0x00000c22, 0x00000bcd, 0x0000013e, 
-    0x0006003d, 0x0000003a, 0x00000c23, 0x00000c22, 0x00000002, 0x00000004, 0x00050042, 0x000001e2, 0x00000c24, 
-    0x00000bcd, 0x0000018a, 0x0006003d, 0x0000003b, 0x00000c25, 0x00000c24, 0x00000002, 0x00000004, 0x00050042, 
-    0x000001df, 0x00000c26, 0x00000bcd, 0x000001e5, 0x0006003d, 0x0000003a, 0x00000c27, 0x00000c26, 0x00000002, 
-    0x00000004, 0x00050042, 0x000001e2, 0x00000c28, 0x00000bcd, 0x000001e8, 0x0006003d, 0x0000003b, 0x00000c29, 
-    0x00000c28, 0x00000002, 0x00000004, 0x00050042, 0x000001ec, 0x00000c2a, 0x00000bcd, 0x000001eb, 0x0006003d, 
-    0x0000003d, 0x00000c2b, 0x00000c2a, 0x00000002, 0x00000008, 0x00050042, 0x000001f0, 0x00000c2c, 0x00000bcd, 
-    0x000001ef, 0x0006003d, 0x0000003f, 0x00000c2d, 0x00000c2c, 0x00000002, 0x00000008, 0x00050042, 0x000001f4, 
-    0x00000c2e, 0x00000bcd, 0x000001f3, 0x0006003d, 0x00000041, 0x00000c2f, 0x00000c2e, 0x00000002, 0x00000008, 
-    0x00050042, 0x000001f9, 0x00000c30, 0x00000bcd, 0x000001f7, 0x00050042, 0x000001fd, 0x00000c31, 0x00000c30, 
-    0x00000185, 0x00050041, 0x000001ff, 0x00000c32, 0x00000c31, 0x00000185, 0x00050042, 0x000001df, 0x00000c33, 
-    0x00000c32, 0x00000185, 0x0006003d, 0x0000003a, 0x00000c34, 0x00000c33, 0x00000002, 0x00000004, 0x00050042, 
-    0x00000203, 0x00000c35, 0x00000c32, 0x000001a6, 0x0006003d, 0x00000032, 0x00000c36, 0x00000c35, 0x00000002, 
-    0x00000004, 0x00050042, 0x000001df, 0x00000c37, 0x00000c32, 0x00000044, 0x0006003d, 0x0000003a, 0x00000c38, 
-    0x00000c37, 0x00000002, 0x00000004, 0x00050042, 0x000001e2, 0x00000c39, 0x00000c32, 0x0000013e, 0x0006003d, 
-    0x0000003b, 0x00000c3a, 0x00000c39, 0x00000002, 0x00000004, 0x00050042, 0x000001df, 0x00000c3b, 0x00000c32, 
-    0x0000018a, 0x0006003d, 0x0000003a, 0x00000c3c, 0x00000c3b, 0x00000002, 0x00000004, 0x00050042, 0x00000203, 
-    0x00000c3d, 0x00000c32, 0x000001e5, 0x0006003d, 0x00000032, 0x00000c3e, 0x00000c3d, 0x00000002, 0x00000004, 
-    0x00090050, 0x00000043, 0x00000c3f, 0x00000c34, 0x00000c36, 0x00000c38, 0x00000c3a, 0x00000c3c, 0x00000c3e, 
-    0x00050041, 0x000001ff, 0x00000c40, 0x00000c31, 0x000001a6, 0x00050042, 0x000001df, 0x00000c41, 0x00000c40, 
-    0x00000185, 0x0006003d, 0x0000003a, 0x00000c42, 0x00000c41, 0x00000002, 0x00000004, 0x00050042, 0x00000203, 
-    0x00000c43, 0x00000c40, 0x000001a6, 0x0006003d, 0x00000032, 0x00000c44, 0x00000c43, 0x00000002, 0x00000004, 
-    0x00050042, 0x000001df, 0x00000c45, 0x00000c40, 0x00000044, 0x0006003d, 0x0000003a, 0x00000c46, 0x00000c45, 
-    0x00000002, 0x00000004, 0x00050042, 0x000001e2, 0x00000c47, 0x00000c40, 0x0000013e, 0x0006003d, 0x0000003b, 
-    0x00000c48, 0x00000c47, 0x00000002, 0x00000004, 0x00050042, 0x000001df, 0x00000c49, 0x00000c40, 0x0000018a, 
-    0x0006003d, 0x0000003a, 0x00000c4a, 0x00000c49, 0x00000002, 0x00000004, 0x00050042, 0x00000203, 0x00000c4b, 
-    0x00000c40, 0x000001e5, 0x0006003d, 0x00000032, 0x00000c4c, 0x00000c4b, 0x00000002, 0x00000004, 0x00090050, 
-    0x00000043, 0x00000c4d, 0x00000c42, 0x00000c44, 0x00000c46, 0x00000c48, 0x00000c4a, 0x00000c4c, 0x00050050, 
-    0x00000042, 0x00000c4e, 0x00000c3f, 0x00000c4d, 0x00050042, 0x00000220, 0x00000c4f, 0x00000bcd, 0x0000021e, 
-    0x00050042, 0x000001df, 0x00000c50, 0x00000c4f, 0x00000185, 0x0006003d, 0x0000003a, 0x00000c51, 0x00000c50, 
-    0x00000002, 0x00000004, 0x00050042, 0x00000203, 0x00000c52, 0x00000c4f, 0x000001a6, 0x0006003d, 0x00000032, 
-    0x00000c53, 0x00000c52, 0x00000002, 0x00000004, 0x00050042, 0x000001df, 0x00000c54, 0x00000c4f, 0x00000044, 
-    0x0006003d, 0x0000003a, 0x00000c55, 0x00000c54, 0x00000002, 0x00000004, 0x00050042, 0x00000203, 0x00000c56, 
-    0x00000c4f, 0x0000013e, 0x0006003d, 0x00000032, 0x00000c57, 0x00000c56, 0x00000002, 0x00000004, 0x00050042, 
-    0x000001df, 0x00000c58, 0x00000c4f, 0x0000018a, 0x0006003d, 0x0000003a, 0x00000c59, 0x00000c58, 0x00000002, 
-    0x00000004, 0x00050042, 0x00000203, 0x00000c5a, 0x00000c4f, 0x000001e5, 0x0006003d, 0x00000032, 0x00000c5b, 
-    0x00000c5a, 0x00000002, 0x00000004, 0x00050042, 0x000001df, 0x00000c5c, 0x00000c4f, 0x000001e8, 0x0006003d, 
-    0x0000003a, 0x00000c5d, 0x00000c5c, 0x00000002, 0x00000004, 0x00050042, 0x00000203, 0x00000c5e, 0x00000c4f, 
-    0x000001eb, 0x0006003d, 0x00000032, 0x00000c5f, 0x00000c5e, 0x00000002, 0x00000004, 0x00050042, 0x000001df, 
-    0x00000c60, 0x00000c4f, 0x000001ef, 0x0006003d, 0x0000003a, 0x00000c61, 0x00000c60, 0x00000002, 0x00000004, 
-    0x00050042, 0x00000203, 0x00000c62, 0x00000c4f, 0x000001f3, 0x0006003d, 0x00000032, 0x00000c63, 0x00000c62, 
-    0x00000002, 0x00000004, 0x00050042, 0x000001df, 0x00000c64, 0x00000c4f, 0x000001f7, 0x0006003d, 0x0000003a, 
-    0x00000c65, 0x00000c64, 0x00000002, 0x00000004, 0x00050042, 0x00000203, 0x00000c66, 0x00000c4f, 0x0000021e, 
-    0x0006003d, 0x00000032, 0x00000c67, 0x00000c66, 0x00000002, 0x00000004, 0x00050042, 0x000001df, 0x00000c68, 
-    0x00000c4f, 0x0000023a, 0x0006003d, 0x0000003a, 0x00000c69, 0x00000c68, 0x00000002, 0x00000004, 0x00050042, 
-    0x00000203, 0x00000c6a, 0x00000c4f, 0x0000023d, 0x0006003d, 0x00000032, 0x00000c6b, 0x00000c6a, 0x00000002, 
-    0x00000004, 0x00110050, 0x00000045, 0x00000c6c, 0x00000c51, 0x00000c53, 0x00000c55, 0x00000c57, 0x00000c59, 
-    0x00000c5b, 0x00000c5d, 0x00000c5f, 0x00000c61, 0x00000c63, 0x00000c65, 0x00000c67, 0x00000c69, 0x00000c6b, 
-    0x000f0050, 0x00000037, 0x00000c6d, 0x00000be9, 0x00000c05, 0x00000c21, 0x00000c23, 0x00000c25, 0x00000c27, 
-    0x00000c29, 0x00000c2b, 0x00000c2d, 0x00000c2f, 0x00000c4e, 0x00000c6c, 0x0003003e, 0x00000bb0, 0x00000c6d, 
-    0x000a000c, 0x00000003, 0x00000c6f, 0x00000002, 0x00000067, 0x0000002d, 0x00000c70, 0x00000c70, 0x00000064, 
-    0x00000065, 0x000500aa, 0x00000089, 0x00000c71, 0x00000c25, 0x000001a6, 0x000a000c, 0x00000003, 0x00000c72, 
-    0x00000002, 0x00000067, 0x0000002d, 0x00000c70, 0x00000c70, 0x0000057a, 0x0000057b, 0x000300f7, 0x00000bbb, 
-    0x00000000, 0x000400fa, 0x00000c71, 0x00000bb9, 0x00000bb7, 0x000200f8, 0x00000bb7, 0x0006000c, 0x00000003, 
-    0x00000bb8, 0x00000002, 0x00000017, 0x00000bb2, 0x000a000c, 0x00000003, 0x00000c74, 0x00000002, 0x00000067, 
-    0x0000002d, 0x00000c75, 0x00000c75, 0x00000008, 0x0000005c, 0x000a000c, 0x00000003, 0x00000c76, 0x00000002, 
-    0x00000067, 0x0000002d, 0x00000c75, 0x00000c75, 0x00000008, 0x0000005c, 0x00050042, 0x00000ba7, 0x00000c77, 
-    0x00000bc2, 0x00000185, 0x00050042, 0x00000c78, 0x00000c79, 0x00000bc2, 0x000001a6, 0x0004003d, 0x00000032, 
-    0x00000c7a, 0x00000c79, 0x0005008e, 0x0000003a, 0x00000c7b, 0x00000c27, 0x00000c7a, 0x0004003d, 0x0000003a, 
-    0x00000c7c, 0x00000c77, 0x00050081, 0x0000003a, 0x00000c7d, 0x00000c7c, 0x00000c7b, 0x0003003e, 0x00000c77, 
-    0x00000c7d, 0x00050042, 0x00000055, 0x00000c7f, 0x00000baf, 0x00000185, 0x0003003e, 0x00000c7f, 0x00000c7d, 
-    0x000200f9, 0x00000bbb, 0x000200f8, 0x00000bb9, 0x0006000c, 0x00000003, 0x00000bba, 0x00000002, 0x00000017, 
-    0x00000bb2, 0x000a000c, 0x00000003, 0x00000c82, 0x00000002, 0x00000067, 0x0000002d, 0x00000c83, 0x00000c83, 
-    0x00000008, 0x0000005c, 0x000a000c, 0x00000003, 0x00000c84, 0x00000002, 0x00000067, 0x0000002d, 0x00000c83, 
-    0x00000c83, 0x00000008, 0x0000005c, 0x000a000c, 0x00000003, 0x00000c85, 0x00000002, 0x00000067, 0x0000002d, 
-    0x00000c83, 0x00000c83, 0x00000008, 0x0000005c, 0x0008000c, 0x00000003, 0x00000c87, 0x00000002, 0x0000001c, 
-    0x00000c86, 0x00000bb1, 0x00000071, 0x0004003d, 0x0000003a, 0x00000c88, 0x00000787, 0x00060039, 0x0000003a, 
-    0x00000c89, 0x00000c8a, 0x00000c6c, 0x00000c88, 0x0003003e, 0x00000bb1, 0x00000c89, 0x000a000c, 0x00000003, 
-    0x00000d14, 0x00000002, 0x00000067, 0x0000002d, 0x00000d15, 0x00000d15, 0x00000008, 0x0000005c, 0x00050042, 
-    0x00000ba7, 0x00000d16, 0x00000bc2, 0x00000185, 0x00050042, 0x00000c78, 0x00000d17, 0x00000bc2, 0x000001a6, 
-    0x0004003d, 0x00000032, 0x00000d18, 0x00000d17, 0x0005008e, 0x0000003a, 0x00000d19, 0x00000c89, 0x00000d18, 
-    0x0004003d, 0x0000003a, 0x00000d1a, 0x00000d16, 0x00050081, 0x0000003a, 0x00000d1b, 0x00000d1a, 0x00000d19, 
-    0x0003003e, 0x00000d16, 0x00000d1b, 0x00050042, 0x00000055, 0x00000d1d, 0x00000baf, 0x00000185, 0x0003003e, 
-    0x00000d1d, 0x00000d1b, 0x000200f9, 0x00000bbb, 0x000200f8, 0x00000bbb, 0x0006000c, 0x00000003, 0x00000bbc, 
-    0x00000002, 0x00000017, 0x00000bb2, 0x000a000c, 0x00000003, 0x00000d20, 0x00000002, 0x00000067, 0x0000002d, 
-    0x00000d21, 0x00000d21, 0x00000064, 0x00000065, 0x00050042, 0x00000d22, 0x00000d23, 0x00000bc2, 0x00000044, 
-    0x0003003e, 0x00000d23, 0x00000810, 0x00050042, 0x000002b0, 0x00000d25, 0x00000baf, 0x00000044, 0x0003003e, 
-    0x00000d25, 0x00000810, 0x000100fd, 0x00010038, 0x00050036, 0x0000003a, 0x00000c8a, 0x00000000, 0x00000c8b, 
-    0x00030037, 0x00000045, 0x00000c8c, 0x00030037, 0x0000003a, 0x00000c8d, 0x000200f8, 0x00000c8e, 0x0004003b, 
-    0x00000055, 0x00000c8f, 0x00000007, 0x0004003b, 0x00000c90, 0x00000c91, 0x00000007, 0x0004003b, 0x00000055, 
-    0x00000c92, 0x00000007, 0x0004003b, 0x00000055, 0x00000c93, 0x00000007, 0x0004003b, 0x00000055, 0x00000c94, 
-    0x00000007, 0x0004003b, 0x00000286, 0x00000c95, 0x00000007, 0x0004003b, 0x00000286, 0x00000c96, 0x00000007, 
-    0x0004003b, 0x00000286, 0x00000c97, 0x00000007, 0x0004003b, 0x00000055, 0x00000c98, 0x00000007, 0x0004003b, 
-    0x00000286, 0x00000c99, 0x00000007, 0x0004003b, 0x00000286, 0x00000c9a, 0x00000007, 0x0004003b, 0x00000286, 
-    0x00000c9b, 0x00000007, 0x0004003b, 0x00000286, 0x00000c9c, 0x00000007, 0x0004003b, 0x00000055, 0x00000c9d, 
-    0x00000007, 0x0007000c, 0x00000003, 0x00000ca1, 0x00000002, 0x00000065, 0x00000c9f, 0x00000c8a, 0x0006000c, 
-    0x00000003, 0x00000ca2, 0x00000002, 0x00000017, 0x00000c9f, 0x0008000c, 0x00000003, 0x00000ca4, 0x00000002, 
-    0x0000001c, 0x00000ca3, 0x00000c8f, 0x00000071, 0x0003003e, 0x00000c8f, 0x00000c8d, 0x0008000c, 0x00000003, 
-    0x00000ca8, 0x00000002, 0x0000001c, 0x00000ca6, 0x00000c91, 0x00000071, 0x0003003e, 0x00000c91, 0x00000c8c, 
-    0x000a000c, 0x00000003, 0x00000caa, 0x00000002, 0x00000067, 0x00000012, 0x0000006a, 0x0000006a, 0x00000064, 
-    0x00000065, 0x000a000c, 0x00000003, 0x00000cab, 0x00000002, 0x00000067, 0x00000012, 0x0000006a, 0x0000006a, 
-    0x00000064, 0x00000065, 0x000a000c, 0x00000003, 0x00000cac, 0x00000002, 0x00000067, 0x00000012, 0x0000006a, 
-    0x0000006a, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000cae, 0x00000002, 0x0000001c, 0x00000cad, 
-    0x00000c92, 0x00000071, 0x00050051, 0x0000003a, 0x00000caf, 0x00000c8c, 0x00000004, 0x00050051, 0x00000032, 
-    0x00000cb0, 0x00000c8c, 0x0000000d, 0x0005008e, 0x0000003a, 0x00000cb1, 0x00000caf, 0x00000cb0, 0x0003003e, 
-    0x00000c92, 0x00000cb1, 0x000a000c, 0x00000003, 0x00000cb3, 0x00000002, 0x00000067, 0x00000012, 0x00000cb4, 
-    0x00000cb4, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000cb6, 0x00000002, 0x0000001c, 0x00000cb5, 
-    0x00000c93, 0x00000071, 0x00050051, 0x0000003a, 0x00000cb7, 0x00000c8c, 0x00000006, 0x0005008e, 0x0000003a, 
-    0x00000cb8, 0x00000cb7, 0x00000cb0, 0x0003003e, 0x00000c93, 0x00000cb8, 0x000a000c, 0x00000003, 0x00000cba, 
-    0x00000002, 0x00000067, 0x00000012, 0x0000067f, 0x0000067f, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 
-    0x00000cbc, 0x00000002, 0x0000001c, 0x00000cbb, 0x00000c94, 0x00000071, 0x00050051, 0x0000003a, 0x00000cbd, 
-    0x00000c8c, 0x00000008, 0x0005008e, 0x0000003a, 0x00000cbe, 0x00000cbd, 0x00000cb0, 0x0003003e, 0x00000c94, 
-    0x00000cbe, 0x000a000c, 0x00000003, 0x00000cc0, 0x00000002, 0x00000067, 0x00000012, 0x0000066f, 0x0000066f, 
-    0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000cc3, 0x00000002, 0x0000001c, 0x00000cc1, 0x00000c95, 
-    0x00000071, 0x00050051, 0x0000003a, 0x00000cc4, 0x00000c8c, 0x0000000a, 0x00050094, 0x00000032, 0x00000cc5, 
-    0x00000c8d, 0x00000cc4, 0x0008000c, 0x00000032, 0x00000cc6, 0x0000027d, 0x0000002b, 0x00000cc5, 0x0000090a, 
-    0x00000254, 0x0006000c, 0x00000032, 0x00000cc7, 0x0000027d, 0x00000010, 0x00000cc6, 0x0003003e, 0x00000c95, 
-    0x00000cc7, 0x000a000c, 0x00000003, 0x00000cc9, 0x00000002, 0x00000067, 0x00000012, 0x000002e3, 0x000002e3, 
-    0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000ccc, 0x00000002, 0x0000001c, 0x00000cca, 0x00000c96, 
-    0x00000071, 0x00050051, 0x00000032, 0x00000ccd, 0x00000c8c, 0x00000007, 0x0008000c, 0x00000032, 0x00000cce, 
-    0x0000027d, 0x00000031, 0x00000273, 0x00000ccd, 0x00000cc7, 0x0003003e, 0x00000c96, 0x00000cce, 0x000a000c, 
-    0x00000003, 0x00000cd0, 0x00000002, 0x00000067, 0x00000012, 0x00000cd1, 0x00000cd1, 0x00000064, 0x00000065, 
-    0x0008000c, 0x00000003, 0x00000cd4, 0x00000002, 0x0000001c, 0x00000cd2, 0x00000c97, 0x00000071, 0x0004007f, 
-    0x00000032, 0x00000cd5, 0x00000cc7, 0x0008000c, 0x00000032, 0x00000cd6, 0x0000027d, 0x00000031, 0x00000273, 
-    0x00000ccd, 0x00000cd5, 0x0003003e, 0x00000c97, 0x00000cd6, 0x000a000c, 0x00000003, 0x00000cd8, 0x00000002, 
-    0x00000067, 0x00000012, 0x00000cd9, 0x00000cd9, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000cdc, 
-    0x00000002, 0x0000001c, 0x00000cda, 0x00000c98, 0x00000071, 0x00060050, 0x0000003a, 0x00000cdd, 0x00000cd6, 
-    0x00000cd6, 0x00000cd6, 0x0008000c, 0x0000003a, 0x00000cde, 0x0000027d, 0x0000002e, 0x00000cb8, 0x00000cbe, 
-    0x00000cdd, 0x00060050, 0x0000003a, 0x00000cdf, 0x00000cce, 0x00000cce, 0x00000cce, 0x0008000c, 0x0000003a, 
-    0x00000ce0, 0x0000027d, 0x0000002e, 0x00000cde, 0x00000cb1, 0x00000cdf, 0x0003003e, 0x00000c98, 0x00000ce0, 
-    0x000a000c, 0x00000003, 0x00000ce2, 0x00000002, 0x00000067, 0x00000012, 0x00000ce3, 0x00000ce3, 0x00000064, 
-    0x00000065, 0x0008000c, 0x00000003, 0x00000ce6, 0x00000002, 0x0000001c, 0x00000ce4, 0x00000c99, 0x00000071, 
-    0x00050051, 0x0000003a, 0x00000ce7, 0x00000c8c, 0x00000000, 0x00050094, 0x00000032, 0x00000ce8, 0x00000c8d, 
-    0x00000ce7, 0x0008000c, 0x00000032, 0x00000ce9, 0x0000027d, 0x0000002b, 0x00000ce8, 0x00000273, 0x00000254, 
-    0x0006000c, 0x00000032, 0x00000cea, 0x0000027d, 0x00000011, 0x00000ce9, 0x0003003e, 0x00000c99, 0x00000cea, 
-    0x000a000c, 0x00000003, 0x00000cec, 0x00000002, 0x00000067, 0x00000012, 0x00000692, 0x00000692, 0x00000064, 
-    0x00000065, 0x0008000c, 0x00000003, 0x00000cef, 0x00000002, 0x0000001c, 0x00000ced, 0x00000c9a, 0x00000071, 
-    0x00050051, 0x00000032, 0x00000cf0, 0x00000c8c, 0x00000001, 0x00050085, 0x00000032, 0x00000cf1, 0x00000cf0, 
-    0x00000cf2, 0x0003003e, 0x00000c9a, 0x00000cf1, 0x000a000c, 0x00000003, 0x00000cf4, 0x00000002, 0x00000067, 
-    0x00000012, 0x00000693, 0x00000693, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000cf7, 0x00000002, 
-    0x0000001c, 0x00000cf5, 0x00000c9b, 0x00000071, 0x00050051, 0x00000032, 0x00000cf8, 0x00000c8c, 0x00000003, 
-    0x00050083, 0x00000032, 0x00000cf9, 0x00000cf1, 0x00000cf8, 0x00050081, 0x00000032, 0x00000cfa, 0x00000cf1, 
-    0x00000cf8, 0x0008000c, 0x00000032, 0x00000cfb, 0x0000027d, 0x00000031, 0x00000cf9, 0x00000cfa, 0x00000cea, 
-    0x00050083, 0x00000032, 0x00000cfc, 0x00000254, 0x00000cfb, 0x00050085, 0x00000032, 0x00000cfd, 0x00000252, 
-    0x00000cfc, 0x0008000c, 0x00000032, 0x00000cfe, 0x0000027d, 0x0000002b, 0x00000cfd, 0x00000273, 0x00000254, 
-    0x0003003e, 0x00000c9b, 0x00000cfe, 0x000a000c, 0x00000003, 0x00000d00, 0x00000002, 0x00000067, 0x00000012, 
-    0x00000d01, 0x00000d01, 0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000d03, 0x00000002, 0x0000001c, 
-    0x00000d02, 0x00000c9c, 0x00000071, 0x00050051, 0x00000032, 0x00000d04, 0x00000c8c, 0x00000005, 0x00050051, 
-    0x00000032, 0x00000d05, 0x00000c8c, 0x00000009, 0x0007000c, 0x00000032, 0x00000d06, 0x0000027d, 0x0000001a, 
-    0x00000cfe, 0x00000d05, 0x00050085, 0x00000032, 0x00000d07, 0x00000d04, 0x00000d06, 0x0003003e, 0x00000c9c, 
-    0x00000d07, 0x000a000c, 0x00000003, 0x00000d09, 0x00000002, 0x00000067, 0x00000012, 0x0000043d, 0x0000043d, 
-    0x00000064, 0x00000065, 0x0008000c, 0x00000003, 0x00000d0c, 0x00000002, 0x0000001c, 0x00000d0a, 0x00000c9d, 
-    0x00000071, 0x00050051, 0x0000003a, 0x00000d0d, 0x00000c8c, 0x0000000c, 0x0005008e, 0x0000003a, 0x00000d0e, 
-    0x00000d0d, 0x00000d07, 0x0003003e, 0x00000c9d, 0x00000d0e, 0x000a000c, 0x00000003, 0x00000d10, 0x00000002, 
-    0x00000067, 0x00000012, 0x000009e4, 0x000009e4, 0x00000064, 0x00000065, 0x00050081, 0x0000003a, 0x00000d11, 
-    0x00000ce0, 0x00000d0e, 0x000200fe, 0x00000d11, 0x00010038, 
-};
-
-const size_t rtbasic_slang_sizeInBytes = 240104;
-